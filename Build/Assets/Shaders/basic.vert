@@ -6,9 +6,16 @@ layout (location = 1) in vec2 a_texcoord;
 out vec2 v_texcoord;
  
 uniform mat4 u_model;
-uniform mat4 u_view;
-uniform mat4 u_projection;
- 
+
+// shared per-pass camera state (std140, matching CameraBlockData) -
+// uploaded once by the scene instead of per program
+layout(std140, binding = 0) uniform CameraBlock
+{
+	mat4 u_view;
+	mat4 u_projection;
+	vec3 u_ambient_light;
+};
+
 void main()
 {
 	v_texcoord = a_texcoord;
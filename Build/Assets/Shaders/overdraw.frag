@@ -0,0 +1,9 @@
+#version 460 core
+
+out vec4 f_color;
+
+// one brightness step per shaded layer (additive blend)
+void main()
+{
+	f_color = vec4(0.08, 0.08, 0.08, 1.0);
+}
@@ -0,0 +1,18 @@
+#version 460 core
+
+layout (location = 0) in vec3 a_position;
+
+uniform mat4 u_model;
+
+// shared per-pass camera block, uploaded once by the scene
+layout(std140, binding = 0) uniform CameraBlock
+{
+	mat4 u_view;
+	mat4 u_projection;
+	vec3 u_ambient_light;
+};
+
+void main()
+{
+	gl_Position = u_projection * u_view * u_model * vec4(a_position, 1.0);
+}
@@ -1,12 +1,11 @@
 #version 430
 
-layout (location = 0) in vec3 a_position;
-layout (location = 1) in vec2 a_texcoord;
-
 out vec2 v_texcoord;
 
+// attribute-less fullscreen triangle - one oversized triangle generated
+// from gl_VertexID, no vertex buffer or scene geometry needed
 void main()
 {
-	v_texcoord = a_texcoord;
-	gl_Position = vec4(a_position, 1.0);
+	v_texcoord = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+	gl_Position = vec4(v_texcoord * 2.0 - 1.0, 0.0, 1.0);
 }
@@ -6,9 +6,15 @@ layout (location = 2) in vec3 a_normal;
 out vec3 v_texcoord;
  
 uniform mat4 u_model;
-uniform mat4 u_view;
-uniform mat4 u_projection;
- 
+
+// shared per-pass camera block, uploaded once by the scene
+layout(std140, binding = 0) uniform CameraBlock
+{
+	mat4 u_view;
+	mat4 u_projection;
+	vec3 u_ambient_light;
+};
+
 void main()
 {
 	// transform position and normal to world space
@@ -1,5 +1,10 @@
 #version 460 core
-#define MAX_LIGHTS		5
+#define MAX_CASCADES	4
+
+// froxel grid dimensions, matching LightClusters
+#define CLUSTER_TILES_X		16
+#define CLUSTER_TILES_Y		9
+#define CLUSTER_SLICES_Z	24
 #define POINT			0
 #define DIRECTIONAL		1
 #define SPOT			2
@@ -10,14 +15,15 @@
 #define	NORMAL_MAP		 (1<<3)
 #define CUBE_MAP		 (1<<4)
 #define SHADOW_MAP       (1<<5)
+#define LIGHT_MAP        (1<<6)
 
 in VS_OUT{
 	in vec2 texcoord;
 	in vec3 position;
 	in vec3 normal;
-	vec4 shadowcoord;
+	vec3 worldpos;
 	mat3 tbn;
-	
+
 }fs_in;
 
 out vec4 f_color;
@@ -47,17 +53,60 @@ uniform struct Material
 	uint parameters;
 } u_material;
 
-uniform vec3 u_ambient_light;
+// shared per-pass camera state (std140, matching CameraBlockData) -
+// declared the same as the vertex stage's copy so the program links
+layout(std140, binding = 0) uniform CameraBlock
+{
+	mat4 u_view;
+	mat4 u_projection;
+	vec3 u_ambient_light;
+};
+
 uniform sampler2D u_texture;
 
-uniform int u_numLights = 1;
-uniform Light u_lights[MAX_LIGHTS];
+// clustered light set - view-space lights packed into vec4s, plus the
+// per-cluster offset/count grid and flattened index list, bound as SSBOs
+struct ClusterLight
+{
+	vec4 positionRange;			// xyz view-space position, w range
+	vec4 directionIntensity;	// xyz view-space direction, w intensity
+	vec4 colorType;				// rgb color, w light type
+	vec4 spot;					// x/y inner/outer spot angle, z shadow caster
+};
+
+layout(std430, binding = 2) readonly buffer LightData { ClusterLight b_lights[]; };
+layout(std430, binding = 3) readonly buffer ClusterGrid { uvec2 b_clusters[]; };
+layout(std430, binding = 4) readonly buffer LightIndices { uint b_lightIndices[]; };
+
+uniform vec2 u_cluster_depth;	// camera near / far
+uniform vec2 u_screen_size;
 
 uniform sampler2D u_baseMap;
 uniform sampler2D u_specularMap;
 uniform sampler2D u_emissiveMap;
 uniform sampler2D u_normalMap;
-uniform sampler2D u_shadowMap;
+uniform sampler2D u_lightMap;
+
+// cascaded shadow map - one depth array layer per cascade, crop matrices
+// and view-space split distances distributed by the scene each frame
+uniform sampler2DArray u_shadowMap;
+uniform mat4 u_cascade_vp[MAX_CASCADES];
+uniform float u_cascade_splits[MAX_CASCADES];
+uniform int u_cascade_count = 1;
+
+uint clusterIndex(in float viewDepth)
+{
+	// screen tile from the fragment position, depth slice from the same
+	// logarithmic distribution the CPU binning uses
+	uvec2 tile = uvec2(gl_FragCoord.xy / u_screen_size * vec2(CLUSTER_TILES_X, CLUSTER_TILES_Y));
+	tile = min(tile, uvec2(CLUSTER_TILES_X - 1, CLUSTER_TILES_Y - 1));
+
+	float logScale = float(CLUSTER_SLICES_Z) / log(u_cluster_depth.y / u_cluster_depth.x);
+	uint slice = uint(clamp(log(max(viewDepth, u_cluster_depth.x) / u_cluster_depth.x) * logScale,
+		0.0, float(CLUSTER_SLICES_Z - 1)));
+
+	return (slice * CLUSTER_TILES_Y + tile.y) * CLUSTER_TILES_X + tile.x;
+}
 
 float calculateAttenuation(in float light_distance, in float range)
 {	
@@ -65,9 +114,19 @@ float calculateAttenuation(in float light_distance, in float range)
 	return pow(attenuation, 2.0);
 } 
 
-float calculateShadow(in vec4 shadowcoord, in float bias)
+float calculateShadow(in vec3 worldpos, in float viewDepth, in float bias)
 {
-	return texture(u_shadowMap, shadowcoord.xy).z < shadowcoord.z - bias ? 0.0 : 1.0;
+	// pick the first cascade whose split covers this fragment's view depth
+	int cascade = u_cascade_count - 1;
+	for (int i = 0; i < u_cascade_count; i++)
+	{
+		if (viewDepth <= u_cascade_splits[i]) { cascade = i; break; }
+	}
+
+	vec4 shadowcoord = u_cascade_vp[cascade] * vec4(worldpos, 1.0);
+	shadowcoord /= shadowcoord.w;
+
+	return texture(u_shadowMap, vec3(shadowcoord.xy, cascade)).z < shadowcoord.z - bias ? 0.0 : 1.0;
 }
 
 vec3 calculateLight(in Light light, in vec3 position,in vec3 normal, in float specularMask)
@@ -157,13 +216,34 @@ void main()
 		: 1;
 
 	vec3 color = u_ambient_light;
-	for (int i = 0; i < u_numLights; i++)
+
+	// baked static-light contribution - those lights were removed from the
+	// runtime set at record time, the lightmap carries them instead
+	if ((u_material.parameters & LIGHT_MAP) != 0u)
+		color += texture(u_lightMap, fs_in.texcoord).rgb;
+
+	// shade only the lights binned into this fragment's cluster
+	uvec2 cluster = b_clusters[clusterIndex(-fs_in.position.z)];
+	for (uint i = 0u; i < cluster.y; i++)
 	{
-		float shadow = (u_lights[i].shadowCaster && ((u_material.parameters & NORMAL_MAP) != 0u))
-			? calculateShadow(fs_in.shadowcoord, 0.001)
+		ClusterLight data = b_lights[b_lightIndices[cluster.x + i]];
+
+		Light light;
+		light.type = int(data.colorType.w);
+		light.shadowCaster = data.spot.z != 0.0;
+		light.position = data.positionRange.xyz;
+		light.range = data.positionRange.w;
+		light.direction = data.directionIntensity.xyz;
+		light.intensity = data.directionIntensity.w;
+		light.color = data.colorType.rgb;
+		light.innerSpotAngle = data.spot.x;
+		light.outerSpotAngle = data.spot.y;
+
+		float shadow = (light.shadowCaster && ((u_material.parameters & NORMAL_MAP) != 0u))
+			? calculateShadow(fs_in.worldpos, -fs_in.position.z, 0.001)
 			: 1.0;
-		color += calculateLight(u_lights[i], fs_in.position, normal, specularMask) * shadow;
-	}	
+		color += calculateLight(light, fs_in.position, normal, specularMask) * shadow;
+	}
 
 	vec4 emissive = ((u_material.parameters & EMISSIVE_MAP) != 0u)
 		? texture(u_emissiveMap, fs_in.texcoord) * vec4(u_material.emissiveColor, 1)
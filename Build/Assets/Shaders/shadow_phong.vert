@@ -9,16 +9,20 @@ layout (location = 2) in vec3 a_tangent;
 	out vec2 texcoord;
 	out vec3 position;
 	out vec3 normal;
-	vec4 shadowcoord;
+	vec3 worldpos;
 	mat3 tbn;
 }vs_out;
- 
+
 uniform mat4 u_model;
-uniform mat4 u_view;
-uniform mat4 u_projection;
-uniform mat4 u_shadow_vp;
 
-uniform vec3 u_ambient_light; 
+// shared per-pass camera state (std140, matching CameraBlockData) -
+// declared the same as the fragment stage's copy so the program links
+layout(std140, binding = 0) uniform CameraBlock
+{
+	mat4 u_view;
+	mat4 u_projection;
+	vec3 u_ambient_light;
+};
 
 struct Light
 {
@@ -55,7 +59,9 @@ void main()
 	vs_out.texcoord = (a_texcoord * u_material.tiling) + u_material.offset;
 	vs_out.position = vec3(model_view * vec4(a_position, 1));
 	vs_out.normal = normalize(normal_matrix * a_normal);
-	vs_out.shadowcoord = u_shadow_vp * u_model * vec4(a_position, 1);
+	// cascade selection happens per fragment, so only the world position
+	// crosses the interface - each cascade's crop matrix projects it there
+	vs_out.worldpos = vec3(u_model * vec4(a_position, 1.0));
 
 	vec3 N = normalize(normal_matrix * a_normal);
 	vec3 T = normalize(normal_matrix * a_tangent);
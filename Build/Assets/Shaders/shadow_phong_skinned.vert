@@ -0,0 +1,100 @@
+#version 460 core
+
+layout (location = 0) in vec3 a_position;
+layout (location = 1) in vec2 a_texcoord;
+layout (location = 2) in vec3 a_normal;
+layout (location = 2) in vec3 a_tangent;
+
+// skin stream - joints arrive as unnormalized bytes (cast back to int),
+// weights normalized to [0,1] summing to 1
+layout (location = 8) in vec4 a_joints;
+layout (location = 9) in vec4 a_weights;
+
+// joint palette for the current draw, uploaded by scene playback
+layout(std430, binding = 5) readonly buffer SkinPalette
+{
+	mat4 b_joints[];
+};
+
+ out VS_OUT
+{
+	out vec2 texcoord;
+	out vec3 position;
+	out vec3 normal;
+	vec3 worldpos;
+	mat3 tbn;
+}vs_out;
+
+uniform mat4 u_model;
+
+// shared per-pass camera state (std140, matching CameraBlockData) -
+// declared the same as the fragment stage's copy so the program links
+layout(std140, binding = 0) uniform CameraBlock
+{
+	mat4 u_view;
+	mat4 u_projection;
+	vec3 u_ambient_light;
+};
+
+struct Light
+{
+	int type;
+	vec3 position;
+	vec3 color;
+	vec3 direction;
+	float range;
+	float intensity;
+	float outerSpotAngle;
+	float innerSpotAngle;
+} u_light;
+
+uniform struct Material
+{
+	vec3 baseColor;
+	vec3 emissiveColor;
+
+	float shininess;
+	vec2 tiling;
+	vec2 offset;
+
+	uint parameters;
+} u_material;
+
+
+void main()
+{
+	// blend the four influence matrices, then skin position and basis
+	// before the rigid path's transforms
+	mat4 skin =
+		a_weights.x * b_joints[int(a_joints.x)] +
+		a_weights.y * b_joints[int(a_joints.y)] +
+		a_weights.z * b_joints[int(a_joints.z)] +
+		a_weights.w * b_joints[int(a_joints.w)];
+
+	vec3 position = vec3(skin * vec4(a_position, 1.0));
+	vec3 normal = mat3(skin) * a_normal;
+	vec3 tangent = mat3(skin) * a_tangent;
+
+	vs_out.texcoord = a_texcoord * u_material.tiling + u_material.offset;
+
+	mat4 model_view = u_view * u_model;
+	mat3 normal_matrix = transpose(inverse(mat3(model_view)));
+	vec4 view_pos = model_view * vec4(position, 1.0);
+	vs_out.texcoord = (a_texcoord * u_material.tiling) + u_material.offset;
+	vs_out.position = vec3(model_view * vec4(position, 1));
+	vs_out.normal = normalize(normal_matrix * normal);
+	// cascade selection happens per fragment, so only the world position
+	// crosses the interface - each cascade's crop matrix projects it there
+	vs_out.worldpos = vec3(u_model * vec4(position, 1.0));
+
+	vec3 N = normalize(normal_matrix * normal);
+	vec3 T = normalize(normal_matrix * tangent);
+	// re-orthogonalize T with respect to N
+	T = normalize(T - dot(T, N) * N);
+	vec3 B = normalize(cross(N, T));
+	vs_out.tbn = mat3(T, B, N);
+
+	vs_out.normal = normalize(mat3(model_view) * normal);
+
+	gl_Position = u_projection * u_view * u_model * vec4(position, 1.0);
+}
@@ -5,13 +5,21 @@ layout (location = 0) in vec3 a_position;
 out vec3 v_texcoord;
  
 uniform mat4 u_model;
-uniform mat4 u_view;
-uniform mat4 u_projection;
- 
+
+// shared per-pass camera block, uploaded once by the scene
+layout(std140, binding = 0) uniform CameraBlock
+{
+	mat4 u_view;
+	mat4 u_projection;
+	vec3 u_ambient_light;
+};
+
 void main()
 {
 	v_texcoord = a_position;
 	mat4 viewProjection = u_projection * mat4(mat3(u_view));
-	
-	gl_Position = viewProjection * vec4(a_position, 1.0);
+
+	// pin depth to the far plane (z = w) - the sky draws after the opaques
+	// with GL_LEQUAL, so only pixels no geometry covered shade
+	gl_Position = (viewProjection * vec4(a_position, 1.0)).xyww;
 }
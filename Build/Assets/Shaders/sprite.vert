@@ -0,0 +1,42 @@
+#version 460 core
+
+// matches SpriteBatch::SpriteInstance (std430)
+struct SpriteInstance
+{
+	vec4 rect;		// x, y, w, h in screen pixels
+	vec4 uvRect;	// source region (u, v, w, h) in texture space
+	vec4 color;
+};
+
+// instance stream, uploaded by SpriteBatch::End
+layout(std430, binding = 0) readonly buffer InstanceBuffer
+{
+	SpriteInstance b_instances[];
+};
+
+uniform vec2 u_screenSize;
+
+// first instance of the current same-texture range
+uniform int u_base = 0;
+
+out vec2 v_texcoord;
+out vec4 v_color;
+
+void main()
+{
+	SpriteInstance instance = b_instances[u_base + gl_InstanceID];
+
+	// triangle-strip corner from gl_VertexID: (0,0) (1,0) (0,1) (1,1),
+	// y growing downward like the quad layout
+	vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);
+
+	// pixels to clip space - screen origin top-left, clip origin center
+	vec2 pixel = instance.rect.xy + corner * instance.rect.zw;
+	gl_Position = vec4(
+		pixel.x / u_screenSize.x * 2.0 - 1.0,
+		1.0 - pixel.y / u_screenSize.y * 2.0,
+		0.0, 1.0);
+
+	v_texcoord = instance.uvRect.xy + corner * instance.uvRect.zw;
+	v_color = instance.color;
+}
@@ -0,0 +1,13 @@
+#version 460 core
+
+in vec2 v_texcoord;
+
+out vec4 f_color;
+
+uniform sampler2D u_texture;
+uniform vec4 u_color = vec4(1.0);
+
+void main()
+{
+	f_color = texture(u_texture, v_texcoord) * u_color;
+}
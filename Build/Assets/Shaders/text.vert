@@ -0,0 +1,39 @@
+#version 460 core
+
+// matches Text::GlyphQuad (std430)
+struct GlyphQuad
+{
+	vec4 rect;		// x, y, w, h in pixels relative to the string origin
+	vec4 uvRect;	// atlas region (u, v, w, h)
+};
+
+// glyph stream, rebuilt by Text::Rebuild when the string changes
+layout(std430, binding = 0) readonly buffer GlyphBuffer
+{
+	GlyphQuad b_glyphs[];
+};
+
+// string placement - position is the top-left in screen pixels
+uniform vec2 u_screenSize;
+uniform vec2 u_position;
+uniform float u_scale = 1.0;
+
+out vec2 v_texcoord;
+
+void main()
+{
+	GlyphQuad glyph = b_glyphs[gl_InstanceID];
+
+	// triangle-strip corner from gl_VertexID: (0,0) (1,0) (0,1) (1,1),
+	// y growing downward like the glyph layout
+	vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);
+
+	// pixels to clip space - screen origin top-left, clip origin center
+	vec2 pixel = u_position + (glyph.rect.xy + corner * glyph.rect.zw) * u_scale;
+	gl_Position = vec4(
+		pixel.x / u_screenSize.x * 2.0 - 1.0,
+		1.0 - pixel.y / u_screenSize.y * 2.0,
+		0.0, 1.0);
+
+	v_texcoord = glyph.uvRect.xy + corner * glyph.uvRect.zw;
+}
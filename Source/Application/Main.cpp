@@ -4,10 +4,33 @@ int main(int argc, char* argv[]) {
     neu::file::SetCurrentDirectory("Assets");
     LOG_INFO("current directory {}", neu::file::GetCurrentDirectory());
 
+    // serve assets from the pack when present - loose files still win, so
+    // shipping builds mount it while development reads edited files
+    if (neu::file::Exists("assets.npak")) neu::file::MountPack("assets.npak");
+
+    // determinism mode arguments: recording or replaying input locks the
+    // simulation to a fixed step and a fixed random seed, so a replayed
+    // session is bit-identical between builds for perf A/B comparisons
+    std::string recordInput, playInput;
+    unsigned int seed = 0x5EED;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--record-input" && i + 1 < argc) recordInput = argv[++i];
+        else if (arg == "--play-input" && i + 1 < argc) playInput = argv[++i];
+        else if (arg == "--seed" && i + 1 < argc) seed = (unsigned int)std::atoi(argv[++i]);
+    }
+
     // initialize engine
     LOG_INFO("initialize engine...");
     neu::GetEngine().Initialize();
 
+    if (!recordInput.empty() || !playInput.empty()) {
+        neu::random::seed(seed);
+        neu::GetEngine().GetTime().SetDeterministicDelta(1.0f / 60.0f);
+        if (!playInput.empty()) neu::GetEngine().GetInput().StartPlayback(playInput);
+        else neu::GetEngine().GetInput().StartRecording(recordInput);
+    }
+
     SDL_Event e;
     bool quit = false;
 
@@ -20,8 +43,10 @@ int main(int argc, char* argv[]) {
     renderTexture->Create(1024, 1024);
     neu::Resources().AddResource("postprocessTexture", renderTexture);
 
+    // cascaded shadow map - one depth array layer per cascade, fit to the
+    // view frustum by the scene (camera "cascades" in the scene file)
     renderTexture = std::make_shared<neu::RenderTexture>();
-    renderTexture->CreateDepth(1024, 1024);
+    renderTexture->CreateDepthArray(1024, 1024, 3);
     neu::Resources().AddResource("shadowTexture", renderTexture);
 
     auto scene = std::make_unique<neu::Scene>();
@@ -30,14 +55,12 @@ int main(int argc, char* argv[]) {
 
     auto editor = std::make_unique<neu::Editor>();
 
-    // MAIN LOOP
-    while (!quit) {
-        while (SDL_PollEvent(&e)) {
-            if (e.type == SDL_EVENT_QUIT) {
-                quit = true;
-            }
-            ImGui_ImplSDL3_ProcessEvent(&e);
-        }
+    // one full frame: update, scene, editor, draw, present. Factored out of
+    // the loop so the renderer can keep ticking it from inside the OS modal
+    // move/resize loop - on Windows a title-bar drag parks the thread in a
+    // nested message pump and SDL_PollEvent stops returning, so without the
+    // modal tick the simulation freezes for the whole drag
+    auto frame = [&] {
         // update
         neu::GetEngine().Update();
         float dt = neu::GetEngine().GetTime().GetDeltaTime();
@@ -46,6 +69,11 @@ int main(int argc, char* argv[]) {
         //scene
         scene->Update(dt);
 
+        // record this frame's draw submission on a worker - the sorted
+        // command lists build while the ImGui widgets below run, and
+        // scene->Draw waits for the job before playing the queue back
+        scene->RecordDrawAsync();
+
         //editor
         editor->Begin();
         editor->UpdateGUI(*scene);
@@ -57,7 +85,23 @@ int main(int argc, char* argv[]) {
         ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 
         neu::GetEngine().GetRenderer().Present();
+    };
+    neu::GetEngine().GetRenderer().SetModalTickCallback(frame);
+
+    // MAIN LOOP
+    while (!quit) {
+        while (SDL_PollEvent(&e)) {
+            if (e.type == SDL_EVENT_QUIT) {
+                quit = true;
+            }
+            neu::GetEngine().GetInput().ProcessEvent(e);
+            ImGui_ImplSDL3_ProcessEvent(&e);
+        }
+        frame();
     }
+
+    // drop the modal tick before the scene and editor it captures go away
+    neu::GetEngine().GetRenderer().SetModalTickCallback(nullptr);
     neu::GetEngine().Shutdown();
 
     return 0;
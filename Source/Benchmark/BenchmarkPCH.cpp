@@ -0,0 +1 @@
+#include "BenchmarkPCH.h"
@@ -0,0 +1,278 @@
+#include <chrono>
+#include <format>
+
+// Headless benchmark harness: boots the engine against a hidden window
+// (vsync off), loads the scenes named on the command line, replays a
+// deterministic camera orbit for a fixed number of simulated frames and
+// reports per-system frame statistics (min/avg/p99/max) as CSV or JSON.
+// Builds with frame counters compiled in (NEU_FRAME_STATS_ENABLED) add
+// rows for draw calls, triangles, texture binds, state changes and
+// buffer upload kilobytes per frame.
+//
+//   Benchmark [scene.json ...] [--frames N] [--warmup N] [--output file] [--json]
+//
+// Every frame steps the scene with a fixed delta and drives the camera
+// from the frame index, so two runs over the same content and commit
+// produce the same work - the numbers are stable enough to diff between
+// commits in a nightly run.
+
+namespace {
+    // fixed simulation step so replay is identical regardless of how fast
+    // the machine executes the frames
+    constexpr float kFixedDelta = 1.0f / 60.0f;
+
+    // camera orbit rate around the scene origin, radians per simulated second
+    constexpr float kOrbitSpeed = 0.5f;
+
+    using bench_clock = std::chrono::steady_clock;
+
+    // milliseconds elapsed since the given time point
+    float ElapsedMs(bench_clock::time_point start) {
+        return std::chrono::duration<float, std::milli>(bench_clock::now() - start).count();
+    }
+
+    // summary of one metric's per-frame samples
+    struct Stats {
+        float min{ 0 };
+        float avg{ 0 };
+        float p99{ 0 };
+        float max{ 0 };
+    };
+
+    Stats Summarize(std::vector<float> samples) {
+        Stats stats;
+        if (samples.empty()) return stats;
+
+        std::sort(samples.begin(), samples.end());
+
+        float total = 0;
+        for (float sample : samples) total += sample;
+
+        stats.min = samples.front();
+        stats.avg = total / samples.size();
+        stats.p99 = samples[(size_t)((samples.size() - 1) * 0.99f)];
+        stats.max = samples.back();
+        return stats;
+    }
+
+    // one output row: a named metric for one benchmarked scene
+    struct MetricRow {
+        std::string scene;
+        std::string metric;
+        size_t frames;
+        Stats stats;
+    };
+}
+
+int main(int argc, char* argv[]) {
+    // defaults, overridden by command line
+    std::vector<std::string> sceneNames;
+    std::string outputName = "benchmark.csv";
+    size_t frames = 600;
+    size_t warmup = 60;
+    bool json = false;
+
+    unsigned int seed = 0x5EED;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--frames" && i + 1 < argc) frames = (size_t)std::atoi(argv[++i]);
+        else if (arg == "--warmup" && i + 1 < argc) warmup = (size_t)std::atoi(argv[++i]);
+        else if (arg == "--output" && i + 1 < argc) outputName = argv[++i];
+        else if (arg == "--seed" && i + 1 < argc) seed = (unsigned int)std::atoi(argv[++i]);
+        else if (arg == "--json") json = true;
+        else sceneNames.push_back(arg);
+    }
+    if (sceneNames.empty()) sceneNames.push_back("scenes/scene04.json");
+    if (json && outputName == "benchmark.csv") outputName = "benchmark.json";
+
+    neu::file::SetCurrentDirectory("Assets");
+    if (neu::file::Exists("assets.npak")) neu::file::MountPack("assets.npak");
+
+    // headless boot: hidden window, vsync off, otherwise the full engine
+    LOG_INFO("initialize engine (headless)...");
+    neu::GetEngine().Initialize(true);
+
+    // determinism: a fixed seed restarts every thread's random stream from
+    // a known point, and Time advances by the same fixed step the loop
+    // below feeds Scene::Update - two runs over the same content and commit
+    // simulate bit-identical gameplay, so a 2% frame-time delta between
+    // builds is signal, not run-to-run noise
+    neu::random::seed(seed);
+    neu::GetEngine().GetTime().SetDeterministicDelta(kFixedDelta);
+
+    std::vector<MetricRow> rows;
+
+    for (auto& sceneName : sceneNames) {
+        LOG_INFO("benchmark {}: {} frames ({} warmup)", sceneName, frames, warmup);
+
+        // load time covers file read, parse and resource creation - first
+        // in the run it sees cold caches, exactly like application startup
+        auto scene = std::make_unique<neu::Scene>();
+        auto loadStart = bench_clock::now();
+        scene->Load(sceneName);
+        scene->Start();
+        float loadMs = ElapsedMs(loadStart);
+        rows.push_back({ sceneName, "load", 1, { loadMs, loadMs, loadMs, loadMs } });
+
+        // replay anchors: handle and start position of every non-shadow
+        // camera actor, orbited around the scene origin each frame
+        struct CameraAnchor {
+            neu::ActorHandle handle;
+            glm::vec3 start;
+        };
+        std::vector<CameraAnchor> anchors;
+        for (auto camera : scene->GetActorComponents<neu::CameraComponent>()) {
+            if (camera->shadowCamera) continue;
+            anchors.push_back({ camera->owner->handle, camera->owner->transform.position });
+        }
+
+        std::vector<float> resourceSamples, updateSamples, drawSamples, presentSamples, frameSamples;
+
+#ifdef NEU_FRAME_STATS_ENABLED
+        // render counter samples - present rolls FrameStats, so reading
+        // after it sees the frame just completed
+        std::vector<float> drawCallSamples, triangleSamples, textureBindSamples, stateChangeSamples, uploadSamples;
+#endif
+
+#ifdef NEU_MEM_TRACKING_ENABLED
+        // per-tag live kilobytes, one sample stream per subsystem tag
+        std::vector<float> memorySamples[(int)neu::MemTag::Count];
+#endif
+
+        for (size_t frame = 0; frame < warmup + frames; frame++) {
+            auto frameStart = bench_clock::now();
+
+            // mirror Engine::Update's frame upkeep minus input/audio, which
+            // a headless replay has no use for
+            neu::Profiler::EndFrame();
+            neu::FrameArena::Reset();
+            neu::GetEngine().GetTime().Tick();
+
+            // deterministic camera path - orbit the start position around
+            // the world Y axis, always looking at the origin
+            float angle = kOrbitSpeed * kFixedDelta * frame;
+            for (auto& anchor : anchors) {
+                neu::Actor* actor = scene->GetActor(anchor.handle);
+                if (!actor) continue;
+
+                float radius = glm::length(glm::vec2{ anchor.start.x, anchor.start.z });
+                if (radius <= 0) continue;
+
+                actor->transform.position = glm::vec3{ std::cos(angle) * radius, anchor.start.y, std::sin(angle) * radius };
+                actor->transform.rotationq = glm::quatLookAt(glm::normalize(-actor->transform.position), glm::vec3{ 0, 1, 0 });
+            }
+
+            // RESOURCES: async load finalization on the main thread
+            auto start = bench_clock::now();
+            neu::Resources().Update();
+            if (frame >= warmup) resourceSamples.push_back(ElapsedMs(start));
+
+            // UPDATE: the scene's fixed-step frame
+            start = bench_clock::now();
+            scene->Update(kFixedDelta);
+            if (frame >= warmup) updateSamples.push_back(ElapsedMs(start));
+
+            neu::EventManager::Instance().DispatchQueued();
+
+            // DRAW: command recording (inline, so the cost is attributed
+            // here) plus GL playback
+            start = bench_clock::now();
+            scene->Draw(neu::GetEngine().GetRenderer());
+            if (frame >= warmup) drawSamples.push_back(ElapsedMs(start));
+
+            // PRESENT: buffer swap, where queued GPU work gets drained
+            start = bench_clock::now();
+            neu::GetEngine().GetRenderer().Present();
+            if (frame >= warmup) presentSamples.push_back(ElapsedMs(start));
+
+            if (frame >= warmup) frameSamples.push_back(ElapsedMs(frameStart));
+
+#ifdef NEU_FRAME_STATS_ENABLED
+            if (frame >= warmup) {
+                auto& stats = neu::FrameStats::GetFrame();
+                drawCallSamples.push_back((float)stats.drawCalls);
+                triangleSamples.push_back((float)stats.triangles);
+                textureBindSamples.push_back((float)stats.textureBinds);
+                stateChangeSamples.push_back((float)stats.stateChanges);
+                uploadSamples.push_back((float)(stats.uploadBytes >> 10));
+            }
+#endif
+
+#ifdef NEU_MEM_TRACKING_ENABLED
+            if (frame >= warmup) {
+                // mirror the externally-accounted tags first, as
+                // Engine::Update would (the headless loop skips audio)
+                neu::MemoryTracker::Sample(neu::MemTag::Resources, neu::Resources().GetMemoryUsed());
+                for (int tag = 0; tag < (int)neu::MemTag::Count; tag++) {
+                    memorySamples[tag].push_back((float)(neu::MemoryTracker::GetStats((neu::MemTag)tag).liveBytes >> 10));
+                }
+            }
+#endif
+        }
+
+        rows.push_back({ sceneName, "resources", frames, Summarize(std::move(resourceSamples)) });
+        rows.push_back({ sceneName, "scene_update", frames, Summarize(std::move(updateSamples)) });
+        rows.push_back({ sceneName, "draw", frames, Summarize(std::move(drawSamples)) });
+        rows.push_back({ sceneName, "present", frames, Summarize(std::move(presentSamples)) });
+        rows.push_back({ sceneName, "frame", frames, Summarize(std::move(frameSamples)) });
+
+#ifdef NEU_FRAME_STATS_ENABLED
+        // counter rows use the metric name to carry the unit - the stat
+        // columns themselves are unit-agnostic
+        rows.push_back({ sceneName, "draw_calls", frames, Summarize(std::move(drawCallSamples)) });
+        rows.push_back({ sceneName, "triangles", frames, Summarize(std::move(triangleSamples)) });
+        rows.push_back({ sceneName, "texture_binds", frames, Summarize(std::move(textureBindSamples)) });
+        rows.push_back({ sceneName, "state_changes", frames, Summarize(std::move(stateChangeSamples)) });
+        rows.push_back({ sceneName, "upload_kb", frames, Summarize(std::move(uploadSamples)) });
+#endif
+
+#ifdef NEU_MEM_TRACKING_ENABLED
+        for (int tag = 0; tag < (int)neu::MemTag::Count; tag++) {
+            rows.push_back({ sceneName, std::format("mem_{}_kb", neu::MemTagName((neu::MemTag)tag)), frames, Summarize(std::move(memorySamples[tag])) });
+        }
+#endif
+
+        // tear the scene down before the next one loads, same order as
+        // Engine::Shutdown for an engine-owned scene
+        scene->Destroyed();
+        scene.reset();
+    }
+
+    // emit the report - CSV by default, JSON with --json
+    std::ofstream output(outputName);
+    if (json) {
+        output << "{\n  \"rows\": [\n";
+        for (size_t i = 0; i < rows.size(); i++) {
+            auto& row = rows[i];
+            output << std::format(
+                "    {{ \"scene\": \"{}\", \"metric\": \"{}\", \"frames\": {}, \"min\": {:.4f}, \"avg\": {:.4f}, \"p99\": {:.4f}, \"max\": {:.4f} }}{}\n",
+                row.scene, row.metric, row.frames,
+                row.stats.min, row.stats.avg, row.stats.p99, row.stats.max,
+                (i + 1 < rows.size()) ? "," : "");
+        }
+        output << "  ]\n}\n";
+    }
+    else {
+        output << "scene,metric,frames,min,avg,p99,max\n";
+        for (auto& row : rows) {
+            output << std::format("{},{},{},{:.4f},{:.4f},{:.4f},{:.4f}\n",
+                row.scene, row.metric, row.frames,
+                row.stats.min, row.stats.avg, row.stats.p99, row.stats.max);
+        }
+    }
+    output.close();
+
+    // final memory state per tag - a tag whose live bytes grew across the
+    // run (vs its steady-state rows above) is leaking per frame
+    neu::MemoryTracker::Dump();
+
+    for (auto& row : rows) {
+        LOG_INFO("{} {}: avg {:.3f} / p99 {:.3f}", row.scene, row.metric, row.stats.avg, row.stats.p99);
+    }
+    LOG_INFO("benchmark report written to {}", outputName);
+
+    neu::GetEngine().Shutdown();
+
+    return 0;
+}
@@ -0,0 +1,383 @@
+#include "NavMesh.h"
+#include "Framework/Scene.h"
+#include "Components/ColliderComponent.h"
+#include "Renderer/DebugDraw.h"
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+#include <queue>
+
+namespace neu {
+	namespace {
+		// baked binary container: header then one walkability byte per cell.
+		// Regions rebuild at load - they derive from the walkable bitmap in
+		// one pass, so the format doesn't carry them
+		constexpr uint32_t kNavMagic = 0x4d56414e;	// "NAVM"
+		constexpr uint32_t kNavVersion = 1;
+
+		struct NavHeader {
+			uint32_t magic;
+			uint32_t version;
+			float origin[3];
+			float cellSize;
+			int32_t width;
+			int32_t height;
+		};
+
+		// A* node ordering for the priority queue (lowest f first)
+		struct OpenNode {
+			float f;
+			int index;
+			bool operator>(const OpenNode& other) const { return f > other.f; }
+		};
+
+		using open_queue_t = std::priority_queue<OpenNode, std::vector<OpenNode>, std::greater<OpenNode>>;
+	}
+
+	bool NavMesh::Load(const std::string& filename) {
+		std::vector<uint8_t> data;
+		if (!file::ReadBinaryFile(filename, data)) {
+			LOG_ERROR("Could not read navmesh {}.", filename);
+			return false;
+		}
+
+		if (data.size() < sizeof(NavHeader)) {
+			LOG_ERROR("Navmesh {} is truncated.", filename);
+			return false;
+		}
+
+		NavHeader header;
+		std::memcpy(&header, data.data(), sizeof(header));
+		if (header.magic != kNavMagic || header.version != kNavVersion) {
+			LOG_ERROR("Navmesh {} has an unknown format (rebake it).", filename);
+			return false;
+		}
+
+		size_t cellCount = (size_t)header.width * header.height;
+		if (data.size() < sizeof(NavHeader) + cellCount) {
+			LOG_ERROR("Navmesh {} is truncated.", filename);
+			return false;
+		}
+
+		m_origin = { header.origin[0], header.origin[1], header.origin[2] };
+		m_cellSize = header.cellSize;
+		m_width = header.width;
+		m_height = header.height;
+		m_walkable.assign(data.begin() + sizeof(NavHeader), data.begin() + sizeof(NavHeader) + cellCount);
+
+		BuildRegions();
+
+		LOG_INFO("Loaded navmesh {} ({}x{} cells, {} regions).", filename, m_width, m_height, m_regions.size());
+
+		return true;
+	}
+
+	bool NavMesh::Bake(Scene& scene, const Bounds& bounds, float cellSize, float agentRadius, const std::string& filename) {
+		if (!bounds.valid || cellSize <= 0) return false;
+
+		NavMesh navMesh;
+		navMesh.m_origin = bounds.min;
+		navMesh.m_cellSize = cellSize;
+		navMesh.m_width = math::max(1, (int)glm::ceil((bounds.max.x - bounds.min.x) / cellSize));
+		navMesh.m_height = math::max(1, (int)glm::ceil((bounds.max.z - bounds.min.z) / cellSize));
+		navMesh.m_walkable.assign((size_t)navMesh.m_width * navMesh.m_height, 1);
+
+		// block every cell whose XZ square, inflated by the agent radius,
+		// overlaps a collider's world AABB. The bake flattens the level to
+		// one layer - collider height is ignored
+		for (int z = 0; z < navMesh.m_height; z++) {
+			for (int x = 0; x < navMesh.m_width; x++) {
+				Bounds cell;
+				cell.Encapsulate(bounds.min + glm::vec3{ x * cellSize, 0, z * cellSize });
+				cell.Encapsulate(bounds.min + glm::vec3{ (x + 1) * cellSize, 0, (z + 1) * cellSize });
+				cell.min.y = bounds.min.y;
+				cell.max.y = bounds.max.y;
+				cell = cell.Expanded(agentRadius);
+
+				for (auto actor : scene.QueryAABB(cell)) {
+					auto collider = actor->GetComponent<ColliderComponent>();
+					if (!collider) continue;
+
+					Bounds colliderBounds = collider->GetWorldBounds();
+					if (colliderBounds.min.x <= cell.max.x && colliderBounds.max.x >= cell.min.x &&
+						colliderBounds.min.z <= cell.max.z && colliderBounds.max.z >= cell.min.z) {
+						navMesh.m_walkable[navMesh.CellIndex(x, z)] = 0;
+						break;
+					}
+				}
+			}
+		}
+
+		std::vector<uint8_t> data(sizeof(NavHeader) + navMesh.m_walkable.size());
+		NavHeader header{ kNavMagic, kNavVersion,
+			{ navMesh.m_origin.x, navMesh.m_origin.y, navMesh.m_origin.z },
+			navMesh.m_cellSize, navMesh.m_width, navMesh.m_height };
+		std::memcpy(data.data(), &header, sizeof(header));
+		std::memcpy(data.data() + sizeof(header), navMesh.m_walkable.data(), navMesh.m_walkable.size());
+
+		if (!file::WriteBinaryFile(filename, data)) {
+			LOG_ERROR("Could not write navmesh {}.", filename);
+			return false;
+		}
+
+		LOG_INFO("Baked navmesh {} ({}x{} cells).", filename, navMesh.m_width, navMesh.m_height);
+
+		return true;
+	}
+
+	glm::vec3 NavMesh::CellCenter(int index) const {
+		int x = index % m_width;
+		int z = index / m_width;
+		return m_origin + glm::vec3{ (x + 0.5f) * m_cellSize, 0, (z + 0.5f) * m_cellSize };
+	}
+
+	int NavMesh::CellAt(const glm::vec3& position) const {
+		int x = (int)glm::floor((position.x - m_origin.x) / m_cellSize);
+		int z = (int)glm::floor((position.z - m_origin.z) / m_cellSize);
+		if (!CellWalkable(x, z)) return -1;
+
+		return CellIndex(x, z);
+	}
+
+	/// <summary>
+	/// Groups cells into kRegionSize-square blocks; blocks containing
+	/// walkable cells become region nodes, adjacent when any walkable cell
+	/// pair crosses the shared block edge. Disconnected pockets inside one
+	/// block share a region - the cell-level search still separates them,
+	/// the corridor is just conservative.
+	/// </summary>
+	void NavMesh::BuildRegions() {
+		m_regions.clear();
+		m_regionIds.assign(m_walkable.size(), kNoRegion);
+
+		int blocksX = (m_width + kRegionSize - 1) / kRegionSize;
+		int blocksZ = (m_height + kRegionSize - 1) / kRegionSize;
+
+		// block -> region id, for blocks with at least one walkable cell
+		std::vector<uint16_t> blockRegion((size_t)blocksX * blocksZ, kNoRegion);
+
+		for (int blockZ = 0; blockZ < blocksZ; blockZ++) {
+			for (int blockX = 0; blockX < blocksX; blockX++) {
+				glm::vec3 centerSum{ 0 };
+				int walkableCount = 0;
+
+				for (int z = blockZ * kRegionSize; z < math::min((blockZ + 1) * kRegionSize, m_height); z++) {
+					for (int x = blockX * kRegionSize; x < math::min((blockX + 1) * kRegionSize, m_width); x++) {
+						if (!m_walkable[CellIndex(x, z)]) continue;
+						centerSum += CellCenter(CellIndex(x, z));
+						walkableCount++;
+					}
+				}
+				if (walkableCount == 0) continue;
+
+				uint16_t region = (uint16_t)m_regions.size();
+				blockRegion[blockZ * blocksX + blockX] = region;
+				m_regions.push_back({ centerSum / (float)walkableCount, {} });
+
+				for (int z = blockZ * kRegionSize; z < math::min((blockZ + 1) * kRegionSize, m_height); z++) {
+					for (int x = blockX * kRegionSize; x < math::min((blockX + 1) * kRegionSize, m_width); x++) {
+						if (m_walkable[CellIndex(x, z)]) m_regionIds[CellIndex(x, z)] = region;
+					}
+				}
+			}
+		}
+
+		// connect regions whose blocks touch through a walkable cell pair
+		auto connect = [this](uint16_t a, uint16_t b) {
+			if (a == kNoRegion || b == kNoRegion || a == b) return;
+			auto& neighbors = m_regions[a].neighbors;
+			if (std::find(neighbors.begin(), neighbors.end(), b) == neighbors.end()) {
+				neighbors.push_back(b);
+				m_regions[b].neighbors.push_back(a);
+			}
+		};
+
+		for (int z = 0; z < m_height; z++) {
+			for (int x = 0; x < m_width; x++) {
+				if (!m_walkable[CellIndex(x, z)]) continue;
+
+				if (CellWalkable(x + 1, z)) connect(m_regionIds[CellIndex(x, z)], m_regionIds[CellIndex(x + 1, z)]);
+				if (CellWalkable(x, z + 1)) connect(m_regionIds[CellIndex(x, z)], m_regionIds[CellIndex(x, z + 1)]);
+			}
+		}
+	}
+
+	bool NavMesh::FindRegionCorridor(int startCell, int endCell, std::vector<uint16_t>& corridor) const {
+		uint16_t startRegion = m_regionIds[startCell];
+		uint16_t endRegion = m_regionIds[endCell];
+
+		corridor.clear();
+		if (startRegion == endRegion) {
+			corridor.push_back(startRegion);
+			return true;
+		}
+
+		// A* over the region graph, euclidean center distance heuristic
+		glm::vec3 goal = m_regions[endRegion].center;
+		std::vector<float> gScore(m_regions.size(), FLT_MAX);
+		std::vector<uint16_t> cameFrom(m_regions.size(), kNoRegion);
+
+		open_queue_t open;
+		gScore[startRegion] = 0;
+		open.push({ glm::distance(m_regions[startRegion].center, goal), startRegion });
+
+		while (!open.empty()) {
+			auto [f, current] = open.top();
+			open.pop();
+
+			if (current == endRegion) {
+				for (uint16_t region = endRegion; region != kNoRegion; region = cameFrom[region]) {
+					corridor.push_back(region);
+				}
+				std::reverse(corridor.begin(), corridor.end());
+				return true;
+			}
+
+			for (uint16_t neighbor : m_regions[current].neighbors) {
+				float g = gScore[current] + glm::distance(m_regions[current].center, m_regions[neighbor].center);
+				if (g >= gScore[neighbor]) continue;
+
+				gScore[neighbor] = g;
+				cameFrom[neighbor] = (uint16_t)current;
+				open.push({ g + glm::distance(m_regions[neighbor].center, goal), neighbor });
+			}
+		}
+
+		return false;
+	}
+
+	bool NavMesh::FindCellPath(int startCell, int endCell, const std::vector<uint16_t>& corridor, std::vector<int>& cells) const {
+		// the fine search only expands cells whose region is on the coarse
+		// corridor, so the flood stays a narrow band instead of the grid
+		std::vector<uint8_t> allowed(m_regions.size(), 0);
+		for (uint16_t region : corridor) allowed[region] = 1;
+
+		std::vector<float> gScore(m_walkable.size(), FLT_MAX);
+		std::vector<int> cameFrom(m_walkable.size(), -1);
+
+		glm::vec3 goal = CellCenter(endCell);
+
+		open_queue_t open;
+		gScore[startCell] = 0;
+		open.push({ glm::distance(CellCenter(startCell), goal), startCell });
+
+		while (!open.empty()) {
+			auto [f, current] = open.top();
+			open.pop();
+
+			if (current == endCell) {
+				cells.clear();
+				for (int cell = endCell; cell != -1; cell = cameFrom[cell]) cells.push_back(cell);
+				std::reverse(cells.begin(), cells.end());
+				return true;
+			}
+
+			int x = current % m_width;
+			int z = current / m_width;
+			const int neighborX[] = { x + 1, x - 1, x, x };
+			const int neighborZ[] = { z, z, z + 1, z - 1 };
+
+			for (int i = 0; i < 4; i++) {
+				if (!CellWalkable(neighborX[i], neighborZ[i])) continue;
+
+				int neighbor = CellIndex(neighborX[i], neighborZ[i]);
+				if (!allowed[m_regionIds[neighbor]]) continue;
+
+				float g = gScore[current] + m_cellSize;
+				if (g >= gScore[neighbor]) continue;
+
+				gScore[neighbor] = g;
+				cameFrom[neighbor] = current;
+				open.push({ g + glm::distance(CellCenter(neighbor), goal), neighbor });
+			}
+		}
+
+		return false;
+	}
+
+	bool NavMesh::LineWalkable(int fromCell, int toCell) const {
+		glm::vec3 from = CellCenter(fromCell);
+		glm::vec3 to = CellCenter(toCell);
+
+		// sample the segment at quarter-cell steps - conservative enough
+		// for string pulling, no supercover bookkeeping
+		float length = glm::distance(from, to);
+		int steps = math::max(1, (int)(length / (m_cellSize * 0.25f)));
+		for (int i = 1; i < steps; i++) {
+			if (CellAt(glm::mix(from, to, (float)i / steps)) == -1) return false;
+		}
+
+		return true;
+	}
+
+	void NavMesh::SmoothPath(const std::vector<int>& cells, std::vector<glm::vec3>& path) const {
+		path.clear();
+		if (cells.empty()) return;
+
+		// greedy string pulling: from each waypoint jump to the furthest
+		// cell still in line of sight, dropping the staircase the 4-way
+		// grid search produces
+		size_t current = 0;
+		path.push_back(CellCenter(cells[current]));
+
+		while (current + 1 < cells.size()) {
+			size_t furthest = current + 1;
+			for (size_t candidate = cells.size() - 1; candidate > current + 1; candidate--) {
+				if (LineWalkable(cells[current], cells[candidate])) {
+					furthest = candidate;
+					break;
+				}
+			}
+
+			current = furthest;
+			path.push_back(CellCenter(cells[current]));
+		}
+	}
+
+	bool NavMesh::FindPath(const glm::vec3& start, const glm::vec3& end, std::vector<glm::vec3>& path) const {
+		path.clear();
+
+		int startCell = CellAt(start);
+		int endCell = CellAt(end);
+		if (startCell == -1 || endCell == -1) return false;
+
+		std::vector<uint16_t> corridor;
+		if (!FindRegionCorridor(startCell, endCell, corridor)) return false;
+
+		std::vector<int> cells;
+		if (!FindCellPath(startCell, endCell, corridor, cells)) return false;
+
+		SmoothPath(cells, path);
+
+		return true;
+	}
+
+	void NavMesh::DebugDrawMesh() const {
+#if NEU_DEBUG_DRAW_ENABLED
+		auto& debug = DebugDraw::Instance();
+
+		// walkable contour: cell edges bordering blocked space
+		const glm::vec4 edgeColor{ 0.2f, 0.8f, 1.0f, 1.0f };
+		for (int z = 0; z < m_height; z++) {
+			for (int x = 0; x < m_width; x++) {
+				if (!m_walkable[CellIndex(x, z)]) continue;
+
+				glm::vec3 corner = m_origin + glm::vec3{ x * m_cellSize, 0, z * m_cellSize };
+				if (!CellWalkable(x - 1, z)) debug.AddLine(corner, corner + glm::vec3{ 0, 0, m_cellSize }, edgeColor);
+				if (!CellWalkable(x + 1, z)) debug.AddLine(corner + glm::vec3{ m_cellSize, 0, 0 }, corner + glm::vec3{ m_cellSize, 0, m_cellSize }, edgeColor);
+				if (!CellWalkable(x, z - 1)) debug.AddLine(corner, corner + glm::vec3{ m_cellSize, 0, 0 }, edgeColor);
+				if (!CellWalkable(x, z + 1)) debug.AddLine(corner + glm::vec3{ 0, 0, m_cellSize }, corner + glm::vec3{ m_cellSize, 0, m_cellSize }, edgeColor);
+			}
+		}
+
+		// region graph: centers and adjacency
+		const glm::vec4 regionColor{ 1.0f, 0.7f, 0.1f, 1.0f };
+		for (size_t region = 0; region < m_regions.size(); region++) {
+			debug.AddSphere(m_regions[region].center, m_cellSize * 0.25f, regionColor);
+			for (uint16_t neighbor : m_regions[region].neighbors) {
+				if (neighbor > region) debug.AddLine(m_regions[region].center, m_regions[neighbor].center, regionColor);
+			}
+		}
+#endif
+	}
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include "Resources/Resource.h"
+#include "Math/Bounds.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace neu {
+	class Scene;
+
+	/// <summary>
+	/// Walkable-space navigation mesh over a horizontal cell grid.
+	///
+	/// Baked from the level's collision ahead of time - Bake() writes the
+	/// ".nav" binary into the asset directory so it ships inside the asset
+	/// pack - and loaded at runtime as a resource. Cells group into
+	/// fixed-size regions at load, giving the hierarchical search its
+	/// coarse level: FindPath runs A* over the region graph first, then a
+	/// cell-level A* constrained to the region corridor, so a long path
+	/// never floods the whole grid. Many-agent workloads should go through
+	/// NavMeshScheduler, which time-slices queries under a frame budget.
+	///
+	/// The grid is a single horizontal layer - multi-floor levels need a
+	/// real voxelized bake, which this format leaves room for (versioned
+	/// header).
+	/// </summary>
+	class NavMesh : public Resource {
+	public:
+		bool Load(const std::string& filename);
+
+		/// <summary>
+		/// Bakes walkability from the scene's colliders over the given
+		/// bounds and writes the ".nav" binary. A cell is blocked when any
+		/// collider's world AABB, inflated by the agent radius, overlaps
+		/// its column in XZ. Intended for the editor/bake step - the
+		/// runtime only ever loads the result.
+		/// </summary>
+		/// <param name="scene">Scene whose colliders define the obstacles</param>
+		/// <param name="bounds">World region to bake, XZ extent becomes the grid</param>
+		/// <param name="cellSize">Cell edge length in world units</param>
+		/// <param name="agentRadius">Obstacle inflation for agent girth</param>
+		/// <param name="filename">Output path for the baked binary</param>
+		/// <returns>true when the bake wrote the file</returns>
+		static bool Bake(Scene& scene, const Bounds& bounds, float cellSize, float agentRadius, const std::string& filename);
+
+		/// <summary>
+		/// Hierarchical path query: region-graph A* for the corridor, then
+		/// a cell search inside it, then string-pulling over the cell path.
+		/// </summary>
+		/// <param name="start">Path start in world space</param>
+		/// <param name="end">Path end in world space</param>
+		/// <param name="path">Receives the waypoints, start to end</param>
+		/// <returns>false when either end is off the mesh or no route exists</returns>
+		bool FindPath(const glm::vec3& start, const glm::vec3& end, std::vector<glm::vec3>& path) const;
+
+		/// <summary>
+		/// True when the position lies on a walkable cell.
+		/// </summary>
+		bool IsWalkable(const glm::vec3& position) const { return CellAt(position) != -1; }
+
+		/// <summary>
+		/// Draws the walkable contour and the region graph through
+		/// DebugDraw - a no-op in shipping builds like the rest of the
+		/// debug drawing.
+		/// </summary>
+		void DebugDrawMesh() const;
+
+		int GetRegionCount() const { return (int)m_regions.size(); }
+
+	private:
+		int CellIndex(int x, int z) const { return z * m_width + x; }
+		bool CellWalkable(int x, int z) const {
+			return x >= 0 && x < m_width && z >= 0 && z < m_height && m_walkable[CellIndex(x, z)];
+		}
+		glm::vec3 CellCenter(int index) const;
+
+		// cell containing the position, -1 when outside or unwalkable
+		int CellAt(const glm::vec3& position) const;
+
+		bool FindRegionCorridor(int startCell, int endCell, std::vector<uint16_t>& corridor) const;
+		bool FindCellPath(int startCell, int endCell, const std::vector<uint16_t>& corridor, std::vector<int>& cells) const;
+		void SmoothPath(const std::vector<int>& cells, std::vector<glm::vec3>& path) const;
+
+		// conservative cell-grid line of sight between two cell centers
+		bool LineWalkable(int fromCell, int toCell) const;
+
+		void BuildRegions();
+
+	private:
+		// cells group into square blocks; blocks with walkable cells become
+		// the nodes of the coarse region graph
+		static constexpr int kRegionSize = 8;
+		static constexpr uint16_t kNoRegion = 0xffff;
+
+		struct Region {
+			glm::vec3 center{ 0 };
+			std::vector<uint16_t> neighbors;
+		};
+
+		glm::vec3 m_origin{ 0 };	// world min corner of cell (0, 0)
+		float m_cellSize{ 1 };
+		int m_width{ 0 };
+		int m_height{ 0 };
+
+		std::vector<uint8_t> m_walkable;	// one flag per cell
+		std::vector<uint16_t> m_regionIds;	// per cell, kNoRegion off-mesh
+		std::vector<Region> m_regions;
+	};
+}
@@ -0,0 +1,86 @@
+#include "NavMeshQuery.h"
+#include <algorithm>
+#include <chrono>
+
+namespace neu {
+	glm::vec3 PathCorridor::Advance(const glm::vec3& position, float reach) {
+		if (!valid || Finished()) return position;
+
+		// pop waypoints the agent has reached - several can go in one
+		// frame when waypoints cluster after smoothing
+		while (next < waypoints.size() && glm::distance(position, waypoints[next]) <= reach) {
+			next++;
+		}
+
+		return Finished() ? waypoints.back() : waypoints[next];
+	}
+
+	NavMeshScheduler::agent_t NavMeshScheduler::CreateAgent() {
+		agent_t agent = m_nextAgent++;
+		m_corridors.emplace(agent, PathCorridor{});
+		return agent;
+	}
+
+	void NavMeshScheduler::DestroyAgent(agent_t agent) {
+		m_corridors.erase(agent);
+		std::erase_if(m_queue, [agent](const Request& request) { return request.agent == agent; });
+	}
+
+	void NavMeshScheduler::RequestPath(agent_t agent, const glm::vec3& start, const glm::vec3& end) {
+		if (!m_corridors.contains(agent)) return;
+
+		// re-target an already queued request in place - an agent holds at
+		// most one queue slot, so a spamming chaser can't starve the rest
+		for (auto& request : m_queue) {
+			if (request.agent == agent) {
+				request.start = start;
+				request.end = end;
+				return;
+			}
+		}
+
+		m_queue.push_back({ agent, start, end });
+	}
+
+	void NavMeshScheduler::Update(const NavMesh& navMesh, float budgetMs) {
+		if (m_queue.empty()) return;
+
+		PROFILE_SCOPE("NavMeshScheduler::Update");
+
+		auto start = std::chrono::steady_clock::now();
+		auto elapsedMs = [&start]() {
+			return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+		};
+
+		// always resolve at least one request, even over a tiny budget -
+		// otherwise a long query could stall the queue forever
+		do {
+			Request request = m_queue.front();
+			m_queue.pop_front();
+
+			auto it = m_corridors.find(request.agent);
+			if (it == m_corridors.end()) continue;
+
+			PathCorridor& corridor = it->second;
+			std::vector<glm::vec3> path;
+			if (navMesh.FindPath(request.start, request.end, path)) {
+				corridor.waypoints = std::move(path);
+				corridor.next = 0;
+				corridor.target = request.end;
+				corridor.valid = true;
+			}
+			else {
+				// off-mesh or unreachable - drop the stale corridor so the
+				// agent doesn't chase a path to somewhere else
+				corridor.waypoints.clear();
+				corridor.next = 0;
+				corridor.valid = false;
+			}
+		} while (!m_queue.empty() && elapsedMs() < budgetMs);
+	}
+
+	PathCorridor* NavMeshScheduler::GetCorridor(agent_t agent) {
+		auto it = m_corridors.find(agent);
+		return (it != m_corridors.end()) ? &it->second : nullptr;
+	}
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include "NavMesh.h"
+#include <deque>
+#include <unordered_map>
+
+namespace neu {
+	/// <summary>
+	/// Cached path corridor for one agent.
+	///
+	/// Holds the waypoints of the agent's last resolved path and the
+	/// agent's progress along them, so steering reads the corridor every
+	/// frame while repaths happen only when the target moves - the
+	/// scheduler overwrites it in place when a queued request resolves.
+	/// </summary>
+	struct PathCorridor {
+		std::vector<glm::vec3> waypoints;
+		size_t next{ 0 };
+		glm::vec3 target{ 0 };
+		bool valid{ false };
+
+		/// <summary>
+		/// Steering target along the corridor: returns the current
+		/// waypoint, popping it once the agent is within reach of it.
+		/// Returns the position itself while no path is cached.
+		/// </summary>
+		/// <param name="position">Agent position in world space</param>
+		/// <param name="reach">Distance at which a waypoint counts reached</param>
+		glm::vec3 Advance(const glm::vec3& position, float reach);
+
+		bool Finished() const { return next >= waypoints.size(); }
+	};
+
+	/// <summary>
+	/// Time-sliced scheduler for navmesh path queries.
+	///
+	/// Agents request repaths at will; Update() resolves queued requests
+	/// oldest-first until the frame budget is spent and writes results
+	/// into each agent's cached corridor. A crowd repathing at once costs
+	/// a bounded slice per frame instead of a spike, at the price of a
+	/// few frames' latency for requests at the back of the queue - the
+	/// old corridor stays valid until the new path lands. Owned by
+	/// gameplay, one per scene/navmesh pair.
+	/// </summary>
+	class NavMeshScheduler {
+	public:
+		using agent_t = uint32_t;
+
+		/// <summary>
+		/// Registers an agent and its empty corridor.
+		/// </summary>
+		agent_t CreateAgent();
+
+		/// <summary>
+		/// Drops the agent's corridor and any queued request.
+		/// </summary>
+		void DestroyAgent(agent_t agent);
+
+		/// <summary>
+		/// Queues (or re-targets, when already queued) the agent's path
+		/// request. The cached corridor keeps steering the agent until the
+		/// request resolves.
+		/// </summary>
+		void RequestPath(agent_t agent, const glm::vec3& start, const glm::vec3& end);
+
+		/// <summary>
+		/// Resolves queued requests oldest-first until the budget is
+		/// spent. Call once per frame after the scene update.
+		/// </summary>
+		/// <param name="navMesh">Mesh the queries run against</param>
+		/// <param name="budgetMs">Per-frame path cost ceiling</param>
+		void Update(const NavMesh& navMesh, float budgetMs = 0.5f);
+
+		/// <summary>
+		/// The agent's cached corridor, null for unknown agents.
+		/// </summary>
+		PathCorridor* GetCorridor(agent_t agent);
+
+		size_t GetPendingCount() const { return m_queue.size(); }
+
+	private:
+		struct Request {
+			agent_t agent{ 0 };
+			glm::vec3 start{ 0 };
+			glm::vec3 end{ 0 };
+		};
+
+		agent_t m_nextAgent{ 1 };
+		std::unordered_map<agent_t, PathCorridor> m_corridors;
+		std::deque<Request> m_queue;
+	};
+}
@@ -12,12 +12,13 @@ namespace neu {
 	}
 
 	/// <summary>
-	/// Queries FMOD to determine if this channel is currently playing audio.
+	/// Queries FMOD to determine if this channel is still mixing audio.
 	/// A channel with a null FMOD channel pointer is considered not playing.
 	/// Handles cases where the channel has finished or been stolen by FMOD.
+	/// Audio thread only.
 	/// </summary>
 	/// <returns>True if audio is actively playing on this channel; otherwise, false</returns>
-	bool AudioChannel::IsPlaying() {
+	bool AudioChannel::PollPlaying() {
 		if (m_channel == nullptr) return false;
 
 		bool playing = false;
@@ -37,113 +38,92 @@ namespace neu {
 	}
 
 	/// <summary>
-	/// Immediately stops playback on this channel.
-	/// After calling Stop, the channel becomes available for reuse.
-	/// Asserts if the channel pointer is null.
+	/// Queues a stop for this channel on the audio thread.
+	/// The channel becomes available for reuse once the voice retires.
 	/// </summary>
 	void AudioChannel::Stop() {
-		ASSERT_MSG(m_channel != nullptr, "Audio channel is null");
-
-		FMOD_RESULT result = m_channel->stop();
-		AudioSystem::CheckFMODResult(result);
+		AudioSystem::Command command{ AudioSystem::Command::Type::Stop, this };
+		m_system->Enqueue(command);
 	}
 
 	/// <summary>
-	/// Pauses or resumes playback on this channel.
+	/// Queues a pause or resume for this channel on the audio thread.
 	/// When paused, the sound position is maintained and can be resumed later.
-	/// Asserts if the channel pointer is null.
 	/// </summary>
 	/// <param name="paused">True to pause playback, false to resume</param>
 	void AudioChannel::SetPaused(bool paused) {
-		ASSERT_MSG(m_channel != nullptr, "Audio channel is null");
+		m_paused = paused;
 
-		FMOD_RESULT result = m_channel->setPaused(paused);
-		AudioSystem::CheckFMODResult(result);
+		AudioSystem::Command command{ AudioSystem::Command::Type::SetPaused, this };
+		command.flag = paused;
+		m_system->Enqueue(command);
 	}
 
 	/// <summary>
-	/// Checks if the channel is currently in a paused state.
-	/// Asserts if the channel pointer is null.
-	/// </summary>
-	/// <returns>True if the channel is paused; otherwise, false</returns>
-	bool AudioChannel::IsPaused() const {
-		ASSERT_MSG(m_channel != nullptr, "Audio channel is null");
-
-		bool paused = false;
-		FMOD_RESULT result = m_channel->getPaused(&paused);
-		AudioSystem::CheckFMODResult(result);
-
-		return paused;
-	}
-
-	/// <summary>
-	/// Sets the volume level for this channel.
+	/// Queues a volume change for this channel on the audio thread.
 	/// The volume is clamped to the range [0.0, 1.0] to ensure valid values.
-	/// Asserts if the channel pointer is null.
+	/// The cached value also drives the virtualization pass, since FMOD
+	/// reports zero volume while a voice is parked.
 	/// </summary>
 	/// <param name="volume">Desired volume level (0.0 = silent, 1.0 = full volume)</param>
 	void AudioChannel::SetVolume(float volume) {
-		ASSERT_MSG(m_channel != nullptr, "Audio channel is null");
-
 		// Clamp volume to valid range to prevent audio distortion or errors
 		volume = math::clamp(volume, 0.0f, 1.0f);
-		FMOD_RESULT result = m_channel->setVolume(volume);
-		AudioSystem::CheckFMODResult(result);
-	}
-
-	/// <summary>
-	/// Retrieves the current volume level of this channel.
-	/// Asserts if the channel pointer is null.
-	/// </summary>
-	/// <returns>The current volume level (0.0 to 1.0), or -1 if retrieval fails</returns>
-	float AudioChannel::GetVolume()	const {
-		ASSERT_MSG(m_channel != nullptr, "Audio channel is null");
-
-		float volume = -1;
-		FMOD_RESULT result = m_channel->getVolume(&volume);
-		AudioSystem::CheckFMODResult(result);
+		m_volume.store(volume);
 
-		return volume;
+		AudioSystem::Command command{ AudioSystem::Command::Type::SetVolume, this };
+		command.value = volume;
+		m_system->Enqueue(command);
 	}
 
 	/// <summary>
-	/// Sets the pitch/frequency multiplier for this channel.
+	/// Queues a pitch change for this channel on the audio thread.
 	/// Values above 1.0 increase pitch and playback speed.
 	/// Values below 1.0 decrease pitch and playback speed.
-	/// Asserts if the channel pointer is null.
 	/// </summary>
-	/// <param name="frequency">Pitch multiplier (1.0 = normal pitch)</param>
-	void AudioChannel::SetPitch(float frequency) {
-		ASSERT_MSG(m_channel != nullptr, "Audio channel is null");
+	/// <param name="pitch">Pitch multiplier (1.0 = normal pitch)</param>
+	void AudioChannel::SetPitch(float pitch) {
+		m_pitch = pitch;
 
-		FMOD_RESULT result = m_channel->setPitch(frequency);
-		AudioSystem::CheckFMODResult(result);
+		AudioSystem::Command command{ AudioSystem::Command::Type::SetPitch, this };
+		command.value = pitch;
+		m_system->Enqueue(command);
 	}
 
 	/// <summary>
-	/// Retrieves the current pitch multiplier for this channel.
-	/// Asserts if the channel pointer is null.
+	/// Queues a loop count change for this channel on the audio thread.
 	/// </summary>
-	/// <returns>The current pitch value, or 0 if retrieval fails</returns>
-	float AudioChannel::GetPitch() const {
-		ASSERT_MSG(m_channel != nullptr, "Audio channel is null");
-
-		float pitch = 0;
-		FMOD_RESULT result = m_channel->getPitch(&pitch);
-		AudioSystem::CheckFMODResult(result);
-
-		return pitch;
+	/// <param name="loopCount">Number of loops (-1 = infinite loop, 0 = play once, >0 = loop N times)</param>
+	void AudioChannel::SetLoopCount(int loopCount) {
+		AudioSystem::Command command{ AudioSystem::Command::Type::SetLoopCount, this };
+		command.count = loopCount;
+		m_system->Enqueue(command);
 	}
 
 	/// <summary>
-	/// Sets the number of times the audio should loop.
-	/// Asserts if the channel pointer is null.
+	/// Queues a mute or unmute for this channel on the audio thread. The
+	/// timeline keeps running while muted, which is what lets the
+	/// virtualization pass park an inaudible voice and revive it in sync
+	/// later.
 	/// </summary>
-	/// <param name="loopCount">Number of loops (-1 = infinite loop, 0 = play once, >0 = loop N times)</param>
-	void AudioChannel::SetLoopCount(int loopCount) {
-		ASSERT_MSG(m_channel != nullptr, "Audio channel is null");
+	/// <param name="mute">True to silence the channel, false to restore it</param>
+	void AudioChannel::SetMute(bool mute) {
+		AudioSystem::Command command{ AudioSystem::Command::Type::SetMute, this };
+		command.flag = mute;
+		m_system->Enqueue(command);
+	}
 
-		FMOD_RESULT result = m_channel->setLoopCount(loopCount);
-		AudioSystem::CheckFMODResult(result);
+	/// <summary>
+	/// Queues a 3D position/velocity update for this channel on the audio
+	/// thread. FMOD attenuates and pans the voice from these against the
+	/// listener snapshot.
+	/// </summary>
+	/// <param name="position">World-space emitter position</param>
+	/// <param name="velocity">Emitter velocity in units per second, for doppler</param>
+	void AudioChannel::Set3DAttributes(const glm::vec3& position, const glm::vec3& velocity) {
+		AudioSystem::Command command{ AudioSystem::Command::Type::Set3DAttributes, this };
+		command.position = position;
+		command.velocity = velocity;
+		m_system->Enqueue(command);
 	}
-}
\ No newline at end of file
+}
@@ -1,4 +1,6 @@
 #pragma once
+#include <glm/glm.hpp>
+#include <atomic>
 
 namespace FMOD { class Channel; }
 
@@ -7,6 +9,9 @@ namespace neu {
 	/// Represents a single audio channel that can play one sound at a time.
 	/// Provides control over playback state, volume, pitch, and looping.
 	/// Channels are managed by the AudioSystem and reused when sounds finish playing.
+	/// The setters queue commands to the audio thread instead of calling FMOD
+	/// directly; the getters return the last requested values, since FMOD's
+	/// own state lives behind the command queue.
 	/// </summary>
 	class AudioChannel {
 	public:
@@ -19,13 +24,14 @@ namespace neu {
 		void Update();
 
 		/// <summary>
-		/// Checks if the channel is currently playing audio.
+		/// Checks if the channel is currently in use: true from the play
+		/// request until the audio thread retires the finished voice.
 		/// </summary>
-		/// <returns>True if audio is playing on this channel; otherwise, false</returns>
-		bool IsPlaying();
+		/// <returns>True if a voice is live on this channel; otherwise, false</returns>
+		bool IsPlaying() const { return m_active.load(); }
 
 		/// <summary>
-		/// Stops playback on this channel immediately.
+		/// Stops playback on this channel.
 		/// The channel will become available for reuse.
 		/// </summary>
 		void Stop();
@@ -37,10 +43,10 @@ namespace neu {
 		void SetPaused(bool paused);
 
 		/// <summary>
-		/// Checks if the channel is currently paused.
+		/// Checks if the channel was last requested paused.
 		/// </summary>
 		/// <returns>True if the channel is paused; otherwise, false</returns>
-		bool IsPaused() const;
+		bool IsPaused() const { return m_paused; }
 
 		/// <summary>
 		/// Sets the volume level for this channel.
@@ -49,10 +55,10 @@ namespace neu {
 		void SetVolume(float volume);
 
 		/// <summary>
-		/// Gets the current volume level of this channel.
+		/// Gets the last requested volume level of this channel.
 		/// </summary>
 		/// <returns>The current volume (0.0 to 1.0)</returns>
-		float GetVolume() const;
+		float GetVolume() const { return m_volume.load(); }
 
 		/// <summary>
 		/// Sets the pitch/frequency multiplier for this channel.
@@ -62,10 +68,10 @@ namespace neu {
 		void SetPitch(float pitch = 1.0f);
 
 		/// <summary>
-		/// Gets the current pitch multiplier.
+		/// Gets the last requested pitch multiplier.
 		/// </summary>
 		/// <returns>The current pitch value</returns>
-		float GetPitch() const;
+		float GetPitch() const { return m_pitch; }
 
 		/// <summary>
 		/// Sets the number of times the sound should loop.
@@ -73,15 +79,81 @@ namespace neu {
 		/// <param name="loopCount">Number of loops (-1 for infinite loop, 0 for no loop)</param>
 		void SetLoopCount(int loopCount);
 
+		/// <summary>
+		/// Mutes or unmutes this channel. A muted channel keeps advancing
+		/// its timeline, so a parked (virtual) voice resumes mid-sound in
+		/// the right place instead of restarting.
+		/// </summary>
+		/// <param name="mute">True to mute, false to restore output</param>
+		void SetMute(bool mute);
+
+		/// <summary>
+		/// Checks whether the voice is currently parked by the audio
+		/// system's virtualization pass (muted for inaudibility).
+		/// </summary>
+		/// <returns>True if the voice is parked; otherwise, false</returns>
+		bool IsVirtual() const { return m_virtual; }
+
+		/// <summary>
+		/// Queues a 3D position/velocity update for this channel on the
+		/// audio thread. Only meaningful for voices of spatial clips.
+		/// </summary>
+		/// <param name="position">World-space emitter position</param>
+		/// <param name="velocity">Emitter velocity in units per second, for doppler</param>
+		void Set3DAttributes(const glm::vec3& position, const glm::vec3& velocity);
+
+		/// <summary>
+		/// The clip the current voice belongs to. Systems that hold a
+		/// channel across frames compare this against their own clip to
+		/// detect the voice being stolen for another sound.
+		/// </summary>
+		/// <returns>The owning clip, only meaningful while IsPlaying</returns>
+		const class AudioClip* GetClip() const { return m_clip; }
+
+	private:
+		/// <summary>
+		/// Queries FMOD for whether audio is still playing, handling handles
+		/// the mixer finished or stole. Audio thread only - the retire pass
+		/// uses this; everyone else reads IsPlaying.
+		/// </summary>
+		/// <returns>True if audio is actively playing on this channel; otherwise, false</returns>
+		bool PollPlaying();
+
 	private:
 		// Allow AudioSystem to access private members for channel management
 		friend class AudioSystem;
 
-		// Flag indicating if this channel is actively being used (currently unused)
-		bool m_active{ false };
+		// owning system, for routing commands onto the audio thread
+		class AudioSystem* m_system{ nullptr };
 
-		// Pointer to the underlying FMOD channel object
-		// nullptr when not playing any sound
+		// Pointer to the underlying FMOD channel object - written by the
+		// audio thread when the Play command executes, audio thread only
 		FMOD::Channel* m_channel{ nullptr };
+
+		// true from the play request until the audio thread retires the
+		// finished voice - the channel pool's definition of "in use"
+		std::atomic<bool> m_active{ false };
+
+		// set when a Play command is queued and cleared when it executes,
+		// so the retire pass never reclaims a voice whose play is still in
+		// the queue
+		std::atomic<bool> m_playPending{ false };
+
+		// voice management state: the clip this voice belongs to (instance
+		// caps compare identity, only valid while active; the audio thread
+		// also polls it for readiness while a play is parked - it is stable
+		// for as long as the voice stays claimed) and its steal priority;
+		// the requested volume is shared with the audio thread's
+		// virtualization pass
+		class AudioClip* m_clip{ nullptr };
+		int m_priority{ 0 };
+		std::atomic<float> m_volume{ 1 };
+
+		// parked by the virtualization pass - audio thread only
+		bool m_virtual{ false };
+
+		// cached requested state backing the main-thread getters
+		float m_pitch{ 1 };
+		bool m_paused{ false };
 	};
-}
\ No newline at end of file
+}
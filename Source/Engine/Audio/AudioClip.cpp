@@ -1,4 +1,5 @@
 #include "AudioClip.h"
+#include "AudioCook.h"
 #include "AudioSystem.h"
 
 namespace neu {
@@ -24,11 +25,100 @@ namespace neu {
             m_sound = nullptr;
         }
 
-        // Create the FMOD sound object using default settings
-        // FMOD_DEFAULT loads the sound into memory and decompresses it
-        FMOD_RESULT result = audioSystem.m_system->createSound(filename.c_str(), FMOD_DEFAULT, 0, &m_sound);
+        // optional sidecar metadata (<filename>.meta) - long music tracks
+        // set "stream": true so FMOD decodes from disk in chunks during
+        // playback instead of decompressing the whole file into memory here,
+        // the clip class for the cook ("category") and the voice management
+        // knobs ride along (see GetPriority / GetMaxInstances)
+        bool stream = false;
+        std::string category;
+        std::string metaFilename = filename + ".meta";
+        if (file::Exists(metaFilename)) {
+            serial::document_t document;
+            if (serial::Load(metaFilename, document)) {
+                SERIAL_READ(document, stream);
+                SERIAL_READ_NAME(document, "category", category);
+                SERIAL_READ_NAME(document, "priority", m_priority);
+                SERIAL_READ_NAME(document, "maxInstances", m_maxInstances);
+                SERIAL_READ_NAME(document, "spatial", m_spatial);
+                SERIAL_READ_NAME(document, "minDistance", m_minDistance);
+                SERIAL_READ_NAME(document, "maxDistance", m_maxDistance);
+                SERIAL_READ_NAME(document, "dropAfter", m_dropAfter);
+            }
+        }
+        m_streaming = stream;
+        m_ready.store(false);
+
+        // non-streamed clips route through the cook: categorized clips
+        // resolve to their cooked sibling (IMA ADPCM at the category's
+        // rate and channel policy - see AudioCook.h), cooking it here when
+        // stale or missing. Uncategorized clips resolve to the source and
+        // load exactly as before
+        std::string openFilename = filename;
+        if (!stream) {
+            openFilename = audio::ResolveCookedClip(filename, audio::CategoryFromString(category), m_spatial);
+            m_compressedSample = openFilename != filename;
+        }
+
+        // Create the FMOD sound object
+        // FMOD_DEFAULT loads the sound into memory and decompresses it,
+        // FMOD_CREATESTREAM keeps only a small decode buffer resident;
+        // cooked clips open as compressed samples so the ADPCM payload
+        // stays resident in its 4-bit form and decodes at mix time;
+        // spatial clips open in 3D so their voices position and attenuate.
+        // FMOD_NONBLOCKING hands the read and decode to FMOD's async open
+        // thread - createSound returns immediately and IsReady polls the
+        // open state, so the calling thread never blocks on disk
+        FMOD_MODE mode = stream ? FMOD_CREATESTREAM : (m_compressedSample ? FMOD_CREATECOMPRESSEDSAMPLE : FMOD_DEFAULT);
+        if (m_spatial) mode |= FMOD_3D;
+        mode |= FMOD_NONBLOCKING;
+        FMOD_RESULT result = audioSystem.m_system->createSound(openFilename.c_str(), mode, 0, &m_sound);
         if (!AudioSystem::CheckFMODResult(result)) return false;
 
+        // seed the budget figure from the opened file so scene-load
+        // reports don't see zero while the async open is in flight - exact
+        // for compressed samples, the PCM payload within a header for WAV
+        // sources; IsReady replaces it with FMOD's measured figure
+        if (!stream) m_memorySize = (size_t)file::GetSize(openFilename);
+
+        return true;
+    }
+
+    /// <summary>
+    /// Polls FMOD's async open state. The first poll that finds the sound
+    /// ready finalizes it: the 3D rolloff range (rejected with
+    /// FMOD_ERR_NOTREADY while the open is in flight) and the decompressed
+    /// PCM size for the resource budget. Both the main thread (play fast
+    /// path) and the audio thread (parked plays) poll; the finalize calls
+    /// are idempotent and FMOD's API is internally locked, so a race just
+    /// repeats them.
+    /// </summary>
+    /// <returns>True once the sound is ready to play</returns>
+    bool AudioClip::IsReady() {
+        if (m_ready.load()) return true;
+        if (m_sound == nullptr) return false;
+
+        FMOD_OPENSTATE state = FMOD_OPENSTATE_ERROR;
+        if (!AudioSystem::CheckFMODResult(m_sound->getOpenState(&state, nullptr, nullptr, nullptr))) return false;
+        if (state != FMOD_OPENSTATE_READY && state != FMOD_OPENSTATE_PLAYING) return false;
+
+        // the rolloff range lives on the sound, so every voice of the clip
+        // inherits it without a per-play call
+        if (m_spatial) {
+            AudioSystem::CheckFMODResult(m_sound->set3DMinMaxDistance(m_minDistance, m_maxDistance));
+        }
+
+        // record the resident size for the resource budget - compressed
+        // samples hold their cooked payload, uncompressed clips the
+        // decoded PCM, and streams never hold the full payload at all, so
+        // they charge nothing
+        unsigned int bytes = 0;
+        FMOD_TIMEUNIT unit = m_compressedSample ? FMOD_TIMEUNIT_RAWBYTES : FMOD_TIMEUNIT_PCMBYTES;
+        if (!m_streaming && m_sound->getLength(&bytes, unit) == FMOD_OK) {
+            m_memorySize = bytes;
+        }
+
+        m_ready.store(true);
         return true;
     }
 }
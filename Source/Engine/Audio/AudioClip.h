@@ -1,5 +1,6 @@
 #pragma once
 #include "Resources/Resource.h"
+#include <atomic>
 
 namespace FMOD { class Sound; }
 
@@ -15,13 +16,78 @@ namespace neu {
 		~AudioClip();
 
 		/// <summary>
-		/// Loads an audio file from disk into memory.
+		/// Opens an audio file without blocking: the sound is created with
+		/// FMOD_NONBLOCKING and FMOD reads and decodes it on its own async
+		/// thread, so a first play mid-combat never stalls the caller on
+		/// disk. Readiness is polled through IsReady; plays requested before
+		/// the open finishes queue on the audio thread until ready.
 		/// </summary>
 		/// <param name="filename">Path to the audio file to load</param>
 		/// <param name="audioSystem">Reference to the AudioSystem that will manage this clip</param>
-		/// <returns>True if the audio file was successfully loaded; otherwise, false</returns>
+		/// <returns>True if the async open was started; otherwise, false</returns>
 		bool Load(const std::string& filename, class AudioSystem& audioSystem);
 
+		/// <summary>
+		/// Polls whether the async open has finished, finalizing the clip
+		/// (3D rolloff range, memory accounting) the first time it has.
+		/// Callable from the main and audio threads; the finalize step is
+		/// idempotent.
+		/// </summary>
+		/// <returns>True once the sound is ready to play</returns>
+		bool IsReady();
+
+		/// <summary>
+		/// True when the clip was opened as an FMOD stream (selected by a
+		/// "stream" flag in the clip's sidecar .meta file) - streamed clips
+		/// decode from disk during playback instead of living in memory.
+		/// </summary>
+		bool IsStreaming() const { return m_streaming; }
+
+		/// <summary>
+		/// Resident bytes held by the FMOD sound, for the resource budget
+		/// accounting: decompressed PCM for uncompressed clips, the cooked
+		/// ADPCM payload for clips opened from their cooked sibling (see
+		/// AudioCook.h), zero for streamed clips. Seeded from the opened
+		/// file's size until the async open finishes.
+		/// </summary>
+		/// <returns>Resident size in bytes</returns>
+		size_t GetMemorySize() const override { return m_memorySize; }
+
+		/// <summary>
+		/// Steal priority for voice management, from the sidecar .meta
+		/// ("priority"). Higher values win steals when the channel pool is
+		/// full; equal priority is stealable.
+		/// </summary>
+		int GetPriority() const { return m_priority; }
+
+		/// <summary>
+		/// Most simultaneous voices this clip may hold, from the sidecar
+		/// .meta ("maxInstances"). At the cap a new play recycles the
+		/// quietest existing instance instead of taking another channel.
+		/// </summary>
+		int GetMaxInstances() const { return m_maxInstances; }
+
+		/// <summary>
+		/// True when the clip was opened for 3D positioning (sidecar .meta
+		/// "spatial" flag) - its voices attenuate by distance from the
+		/// listener between the min/max range.
+		/// </summary>
+		bool IsSpatial() const { return m_spatial; }
+
+		/// <summary>
+		/// Distance at which 3D attenuation stops reducing the clip, from
+		/// the sidecar .meta ("maxDistance"). Emitters use this as their
+		/// audible-range cull radius.
+		/// </summary>
+		float GetMaxDistance() const { return m_maxDistance; }
+
+		/// <summary>
+		/// Seconds a one-shot play may wait for a still-opening clip before
+		/// it gets dropped, from the sidecar .meta ("dropAfter"). Zero or
+		/// negative waits indefinitely; looped plays always wait.
+		/// </summary>
+		float GetDropAfter() const { return m_dropAfter; }
+
 	private:
 		// Allow AudioSystem to access private members for playback
 		friend class AudioSystem;
@@ -29,5 +95,34 @@ namespace neu {
 		// Pointer to the underlying FMOD sound object
 		// Initialized to nullptr and managed throughout the clip's lifetime
 		FMOD::Sound* m_sound{ nullptr };
+
+		// resident bytes, queried from FMOD at load
+		size_t m_memorySize{ 0 };
+
+		// opened with FMOD_CREATESTREAM
+		bool m_streaming{ false };
+
+		// opened from the cooked sibling with FMOD_CREATECOMPRESSEDSAMPLE -
+		// the payload stays compressed in memory and the budget charges
+		// raw bytes, not decoded PCM
+		bool m_compressedSample{ false };
+
+		// voice management knobs from the sidecar .meta - defaults leave
+		// plenty of headroom for untagged clips
+		int m_priority{ 128 };
+		int m_maxInstances{ 8 };
+
+		// 3D positioning from the sidecar .meta: opened with FMOD_3D and
+		// the rolloff range applied once the async open finishes
+		bool m_spatial{ false };
+		float m_minDistance{ 1 };
+		float m_maxDistance{ 100 };
+
+		// drop policy for plays parked on a still-opening clip
+		float m_dropAfter{ 0.5f };
+
+		// async open finished and the clip was finalized - set by IsReady
+		// from whichever thread polls first
+		std::atomic<bool> m_ready{ false };
 	};
 }
\ No newline at end of file
@@ -0,0 +1,327 @@
+#include "AudioCook.h"
+#include <cstdint>
+#include <vector>
+
+namespace {
+	// ---- source parsing ----
+	// interleaved 16-bit PCM pulled out of a source WAV - the only input
+	// the cook accepts; anything already compressed ships as-is
+	struct SourcePcm {
+		int channels{ 0 };
+		int sampleRate{ 0 };
+		std::vector<int16_t> samples;
+	};
+
+	uint16_t ReadU16(const std::vector<uint8_t>& bytes, size_t offset) {
+		return (uint16_t)(bytes[offset] | (bytes[offset + 1] << 8));
+	}
+
+	uint32_t ReadU32(const std::vector<uint8_t>& bytes, size_t offset) {
+		return bytes[offset] | (bytes[offset + 1] << 8) | (bytes[offset + 2] << 16) | ((uint32_t)bytes[offset + 3] << 24);
+	}
+
+	// walks the RIFF chunks for fmt and data. Only plain 16-bit PCM in
+	// one or two channels parses - the format every source clip actually
+	// uses - so an exotic source just skips the cook instead of failing it
+	bool ParseWavPcm16(const std::vector<uint8_t>& bytes, SourcePcm& out) {
+		if (bytes.size() < 12) return false;
+		if (ReadU32(bytes, 0) != 0x46464952 /* RIFF */ || ReadU32(bytes, 8) != 0x45564157 /* WAVE */) return false;
+
+		bool haveFormat = false;
+		size_t offset = 12;
+		while (offset + 8 <= bytes.size()) {
+			uint32_t id = ReadU32(bytes, offset);
+			uint32_t size = ReadU32(bytes, offset + 4);
+			offset += 8;
+			if (offset + size > bytes.size()) return false;
+
+			if (id == 0x20746d66 /* fmt */ && size >= 16) {
+				if (ReadU16(bytes, offset) != 1 /* PCM */) return false;
+				out.channels = ReadU16(bytes, offset + 2);
+				out.sampleRate = (int)ReadU32(bytes, offset + 4);
+				if (ReadU16(bytes, offset + 14) != 16) return false;
+				if (out.channels < 1 || out.channels > 2 || out.sampleRate <= 0) return false;
+				haveFormat = true;
+			}
+			else if (id == 0x61746164 /* data */) {
+				if (!haveFormat) return false;
+				out.samples.resize(size / sizeof(int16_t));
+				for (size_t i = 0; i < out.samples.size(); i++) {
+					out.samples[i] = (int16_t)ReadU16(bytes, offset + i * sizeof(int16_t));
+				}
+				return !out.samples.empty();
+			}
+
+			// chunks are word-aligned
+			offset += size + (size & 1);
+		}
+		return false;
+	}
+
+	// ---- policy transforms ----
+	void DownmixToMono(SourcePcm& pcm) {
+		if (pcm.channels != 2) return;
+
+		size_t frames = pcm.samples.size() / 2;
+		for (size_t i = 0; i < frames; i++) {
+			pcm.samples[i] = (int16_t)(((int)pcm.samples[i * 2] + pcm.samples[i * 2 + 1]) / 2);
+		}
+		pcm.samples.resize(frames);
+		pcm.channels = 1;
+	}
+
+	// decimating resampler: a box prefilter sized to the ratio, then
+	// linear interpolation. Not a mastering-grade kernel, but transparent
+	// for the effects content this path targets - music never cooks
+	void Resample(SourcePcm& pcm, int targetRate) {
+		if (targetRate >= pcm.sampleRate) return;
+
+		size_t frames = pcm.samples.size() / pcm.channels;
+		int width = pcm.sampleRate / targetRate;
+		if (width > 1) {
+			// moving average per channel knocks down the content above the
+			// target's Nyquist before it can alias through the interpolation
+			std::vector<int16_t> filtered(pcm.samples.size());
+			for (int channel = 0; channel < pcm.channels; channel++) {
+				for (size_t i = 0; i < frames; i++) {
+					int sum = 0;
+					for (int j = 0; j < width; j++) {
+						size_t frame = (i + j < frames) ? i + j : frames - 1;
+						sum += pcm.samples[frame * pcm.channels + channel];
+					}
+					filtered[i * pcm.channels + channel] = (int16_t)(sum / width);
+				}
+			}
+			pcm.samples = std::move(filtered);
+		}
+
+		size_t outFrames = (size_t)((uint64_t)frames * targetRate / pcm.sampleRate);
+		std::vector<int16_t> out(outFrames * pcm.channels);
+		for (size_t i = 0; i < outFrames; i++) {
+			double position = (double)i * pcm.sampleRate / targetRate;
+			size_t frame = (size_t)position;
+			double fraction = position - (double)frame;
+			size_t next = (frame + 1 < frames) ? frame + 1 : frames - 1;
+
+			for (int channel = 0; channel < pcm.channels; channel++) {
+				double a = pcm.samples[frame * pcm.channels + channel];
+				double b = pcm.samples[next * pcm.channels + channel];
+				out[i * pcm.channels + channel] = (int16_t)(a + (b - a) * fraction);
+			}
+		}
+		pcm.samples = std::move(out);
+		pcm.sampleRate = targetRate;
+	}
+
+	// ---- IMA ADPCM encoder ----
+	// the standard IMA tables - each 4-bit code stores a signed fraction
+	// of an adaptive step, and the index table walks the step up on large
+	// codes and down on small ones
+	constexpr int kStepTable[89] = {
+		7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+		19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+		50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+		130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+		337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+		876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+		2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+		5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+		15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+	};
+	constexpr int kIndexTable[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+	struct AdpcmState {
+		int predictor{ 0 };
+		int index{ 0 };
+	};
+
+	// encodes one sample against the running state, updating the state
+	// with the decoder's reconstruction so both sides track identically
+	uint8_t EncodeNibble(AdpcmState& state, int sample) {
+		int step = kStepTable[state.index];
+		int diff = sample - state.predictor;
+
+		uint8_t nibble = 0;
+		if (diff < 0) { nibble = 8; diff = -diff; }
+		if (diff >= step) { nibble |= 4; diff -= step; }
+		if (diff >= step >> 1) { nibble |= 2; diff -= step >> 1; }
+		if (diff >= step >> 2) { nibble |= 1; }
+
+		// reconstruct exactly as the decoder will
+		int delta = step >> 3;
+		if (nibble & 4) delta += step;
+		if (nibble & 2) delta += step >> 1;
+		if (nibble & 1) delta += step >> 2;
+		state.predictor += (nibble & 8) ? -delta : delta;
+		if (state.predictor > 32767) state.predictor = 32767;
+		else if (state.predictor < -32768) state.predictor = -32768;
+
+		state.index += kIndexTable[nibble & 7];
+		if (state.index < 0) state.index = 0;
+		else if (state.index > 88) state.index = 88;
+
+		return nibble;
+	}
+
+	// 512 data bytes per channel per block - each block opens with a
+	// 4-byte per-channel header (predictor, step index) carrying the
+	// block's first sample, so a decoder can seek by block
+	constexpr size_t kBlockBytesPerChannel = 512;
+	constexpr size_t kSamplesPerBlock = (kBlockBytesPerChannel - 4) * 2 + 1;
+
+	void AppendU16(std::vector<uint8_t>& out, uint16_t value) {
+		out.push_back((uint8_t)(value & 0xff));
+		out.push_back((uint8_t)(value >> 8));
+	}
+
+	void AppendU32(std::vector<uint8_t>& out, uint32_t value) {
+		AppendU16(out, (uint16_t)(value & 0xffff));
+		AppendU16(out, (uint16_t)(value >> 16));
+	}
+
+	// packs the transformed PCM into a RIFF/WAVE of IMA ADPCM blocks
+	// (format tag 0x11) - the layout FMOD and every WAV tool decode. The
+	// trailing partial block pads by repeating the final sample, and the
+	// fact chunk records the true frame count
+	void EncodeAdpcmWav(const SourcePcm& pcm, std::vector<uint8_t>& out) {
+		int channels = pcm.channels;
+		size_t frames = pcm.samples.size() / channels;
+		size_t blockAlign = kBlockBytesPerChannel * channels;
+		size_t blocks = (frames + kSamplesPerBlock - 1) / kSamplesPerBlock;
+		size_t dataSize = blocks * blockAlign;
+
+		out.clear();
+		out.reserve(12 + 28 + 12 + 8 + dataSize);
+
+		// a frame index clamped to the end - the pad policy in one place
+		auto sampleAt = [&](size_t frame, int channel) {
+			if (frame >= frames) frame = frames - 1;
+			return (int)pcm.samples[frame * channels + channel];
+		};
+
+		AppendU32(out, 0x46464952);									// RIFF
+		AppendU32(out, (uint32_t)(4 + 28 + 12 + 8 + dataSize));
+		AppendU32(out, 0x45564157);									// WAVE
+
+		AppendU32(out, 0x20746d66);									// fmt
+		AppendU32(out, 20);
+		AppendU16(out, 0x11);										// IMA ADPCM
+		AppendU16(out, (uint16_t)channels);
+		AppendU32(out, (uint32_t)pcm.sampleRate);
+		AppendU32(out, (uint32_t)((uint64_t)pcm.sampleRate * blockAlign / kSamplesPerBlock));
+		AppendU16(out, (uint16_t)blockAlign);
+		AppendU16(out, 4);											// bits per sample
+		AppendU16(out, 2);											// extension size
+		AppendU16(out, (uint16_t)kSamplesPerBlock);
+
+		AppendU32(out, 0x74636166);									// fact
+		AppendU32(out, 4);
+		AppendU32(out, (uint32_t)frames);
+
+		AppendU32(out, 0x61746164);									// data
+		AppendU32(out, (uint32_t)dataSize);
+
+		std::vector<AdpcmState> states(channels);
+		for (size_t block = 0; block < blocks; block++) {
+			size_t first = block * kSamplesPerBlock;
+
+			// per-channel header eats the block's first sample verbatim
+			for (int channel = 0; channel < channels; channel++) {
+				states[channel].predictor = sampleAt(first, channel);
+				AppendU16(out, (uint16_t)(int16_t)states[channel].predictor);
+				out.push_back((uint8_t)states[channel].index);
+				out.push_back(0);
+			}
+
+			// data nibbles pack low-first, and stereo interleaves in
+			// 4-byte (8-sample) words per channel
+			for (size_t group = 1; group < kSamplesPerBlock; group += 8) {
+				for (int channel = 0; channel < channels; channel++) {
+					for (size_t pair = 0; pair < 8; pair += 2) {
+						uint8_t low = EncodeNibble(states[channel], sampleAt(first + group + pair, channel));
+						uint8_t high = EncodeNibble(states[channel], sampleAt(first + group + pair + 1, channel));
+						out.push_back((uint8_t)(low | (high << 4)));
+					}
+				}
+			}
+		}
+	}
+
+	// ---- category policy ----
+	// target rate and downmix per clip class - the table the header
+	// documents. Spatial clips mix from one signal regardless of class
+	struct CookPolicy {
+		int sampleRate;
+		bool mono;
+	};
+
+	bool GetCookPolicy(neu::audio::ClipCategory category, bool spatial, CookPolicy& policy) {
+		switch (category) {
+		case neu::audio::ClipCategory::OneShot:
+			policy = { 22050, true };
+			return true;
+		case neu::audio::ClipCategory::Ambient:
+			policy = { 32000, spatial };
+			return true;
+		default:
+			return false;
+		}
+	}
+}
+
+namespace neu::audio {
+	ClipCategory CategoryFromString(const std::string& category) {
+		if (category == "oneshot") return ClipCategory::OneShot;
+		if (category == "ambient") return ClipCategory::Ambient;
+		if (category == "music") return ClipCategory::Music;
+		return ClipCategory::None;
+	}
+
+	std::string GetCookedFilename(const std::string& filename) {
+		return filename + ".nwav";
+	}
+
+	std::string ResolveCookedClip(const std::string& filename, ClipCategory category, bool spatial) {
+		CookPolicy policy;
+		if (!GetCookPolicy(category, spatial, policy)) return filename;
+
+		// development edits win: a loose source or .meta newer than the
+		// cooked sibling recooks (the .meta carries the category, so a
+		// reclassified clip never plays its old policy). No loose source
+		// at all is the shipped case - the sibling is trusted as cooked
+		std::string cookedFilename = GetCookedFilename(filename);
+		if (file::Exists(cookedFilename)) {
+			if (!file::Exists(filename)) return cookedFilename;
+
+			uint64_t cookedTime = file::GetModifiedTime(cookedFilename);
+			bool stale = file::GetModifiedTime(filename) > cookedTime;
+			std::string metaFilename = filename + ".meta";
+			stale |= file::Exists(metaFilename) && file::GetModifiedTime(metaFilename) > cookedTime;
+			if (!stale) return cookedFilename;
+		}
+
+		std::vector<uint8_t> bytes;
+		if (!file::ReadBinaryFile(filename, bytes)) return filename;
+
+		SourcePcm pcm;
+		if (!ParseWavPcm16(bytes, pcm)) {
+			// already-compressed or exotic sources ship as-is - the cook
+			// only earns its keep on the raw PCM the pipeline delivers
+			LOG_CAT_DEBUG(Audio, "{} is not a 16-bit PCM WAV - loading uncooked", filename);
+			return filename;
+		}
+
+		if (policy.mono) DownmixToMono(pcm);
+		Resample(pcm, policy.sampleRate);
+
+		std::vector<uint8_t> cooked;
+		EncodeAdpcmWav(pcm, cooked);
+		if (!file::WriteBinaryFile(cookedFilename, cooked)) {
+			LOG_CAT_WARNING(Audio, "could not write cooked clip {}", cookedFilename);
+			return filename;
+		}
+
+		LOG_CAT_INFO(Audio, "cooked {}: {} KB -> {} KB resident", filename, bytes.size() >> 10, cooked.size() >> 10);
+		return cookedFilename;
+	}
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include <string>
+
+/// <summary>
+/// Cook-time audio transcoding. Source audio lands as 48 kHz stereo PCM
+/// across the board, which makes a UI blip cost the same resident bytes
+/// per second as a music stem. The cook transcodes each clip by its
+/// declared category (sidecar .meta "category") into a cooked sibling
+/// (&lt;file&gt;.nwav - same sibling scheme as .nenv/.ntex/.spv), choosing
+/// sample rate, channel downmix and codec per class:
+///
+///   "oneshot"  22050 Hz, mono,                   IMA ADPCM
+///   "ambient"  32000 Hz, mono when spatial,      IMA ADPCM
+///   "music"    untouched - streams from disk, resident cost is a
+///              decode buffer, not the payload
+///
+/// The output is a standard RIFF/WAVE container carrying IMA ADPCM
+/// blocks (format tag 0x11), which FMOD decodes natively and - opened as
+/// a compressed sample - keeps resident in its 4-bit form instead of
+/// decompressing at load. The encoder lives in this translation unit for
+/// the same reason the pack codec does: no external tool or library
+/// dependency on cook machines. Uncategorized clips cook nothing and
+/// load exactly as before.
+/// </summary>
+namespace neu::audio {
+	/// <summary>
+	/// Clip class from the sidecar .meta "category" - selects the cook
+	/// policy above. None (absent or unrecognized) means no transcoding.
+	/// </summary>
+	enum class ClipCategory {
+		None,
+		OneShot,
+		Ambient,
+		Music
+	};
+
+	/// <summary>
+	/// Parses a .meta "category" string ("oneshot", "ambient", "music");
+	/// anything else maps to None.
+	/// </summary>
+	ClipCategory CategoryFromString(const std::string& category);
+
+	/// <summary>
+	/// Path of the cooked sibling for a source clip (&lt;file&gt;.nwav).
+	/// </summary>
+	std::string GetCookedFilename(const std::string& filename);
+
+	/// <summary>
+	/// Returns the filename the clip should open: the cooked sibling when
+	/// it exists and is no older than the source and its .meta (cooking it
+	/// here when stale or missing and the source is a 16-bit PCM WAV),
+	/// otherwise the source itself. A cooked sibling with no source beside
+	/// it is the shipped case and is trusted as-is. Categories that cook
+	/// nothing (None, Music) and non-PCM sources always resolve to the
+	/// source, so the clip loads exactly as it did before cooking existed.
+	/// </summary>
+	/// <param name="filename">Path to the source clip</param>
+	/// <param name="category">Clip class from the sidecar .meta</param>
+	/// <param name="spatial">True for 3D clips - spatial voices mix from one signal, so they downmix to mono regardless of class</param>
+	/// <returns>The filename to hand to the audio system</returns>
+	std::string ResolveCookedClip(const std::string& filename, ClipCategory category, bool spatial);
+}
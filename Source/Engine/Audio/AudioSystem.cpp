@@ -1,5 +1,6 @@
 #include "AudioSystem.h"
 #include "AudioClip.h"
+#include <chrono>
 
 namespace neu {
 	/// <summary>
@@ -10,7 +11,7 @@ namespace neu {
 	/// <returns>True if the FMOD operation was successful (FMOD_OK); otherwise, false</returns>
 	bool AudioSystem::CheckFMODResult(FMOD_RESULT result) {
 		if (result != FMOD_OK) {
-			LOG_ERROR("FMOD error {}", FMOD_ErrorString(result));
+			LOG_CAT_ERROR(Audio, "FMOD error {}", FMOD_ErrorString(result));
 			return false;
 		}
 
@@ -19,7 +20,8 @@ namespace neu {
 
 	/// <summary>
 	/// Searches the channel pool for an available channel.
-	/// A channel is considered free if it's not currently playing audio.
+	/// A channel is free when no voice has claimed it - claims are made on
+	/// the calling thread and released by the audio thread's retire pass.
 	/// </summary>
 	/// <returns>Pointer to the first free channel found, or nullptr if all channels are busy</returns>
 	AudioChannel* AudioSystem::GetFreeChannel()
@@ -31,10 +33,358 @@ namespace neu {
 		return nullptr;
 	}
 
+	/// <summary>
+	/// Picks the channel a new voice will play on, applying the clip's
+	/// serialized caps. At the clip's max-instance cap the quietest playing
+	/// instance is recycled; with the pool exhausted the quietest voice of
+	/// equal or lower priority is stolen. Only when everything playing
+	/// outranks the clip does the play get dropped.
+	/// </summary>
+	/// <param name="audioClip">The clip about to play</param>
+	/// <returns>A claimed channel ready for a Play command, or nullptr if the play was dropped</returns>
+	AudioChannel* AudioSystem::AcquireChannel(AudioClip& audioClip) {
+		// one pass collects the per-clip instance count, the quietest
+		// instance of this clip, and the quietest stealable voice overall
+		int instances = 0;
+		AudioChannel* quietestInstance = nullptr;
+		AudioChannel* quietestStealable = nullptr;
+		for (auto& channel : m_channels) {
+			if (!channel->IsPlaying()) continue;
+
+			if (channel->m_priority <= audioClip.GetPriority() &&
+				(!quietestStealable || channel->GetVolume() < quietestStealable->GetVolume())) {
+				quietestStealable = channel.get();
+			}
+
+			if (channel->m_clip != &audioClip) continue;
+			instances++;
+			if (!quietestInstance || channel->GetVolume() < quietestInstance->GetVolume()) {
+				quietestInstance = channel.get();
+			}
+		}
+
+		AudioChannel* channel = nullptr;
+		if (instances >= audioClip.GetMaxInstances() && quietestInstance) {
+			// at the cap - recycle the clip's own quietest voice so the
+			// volley replaces itself instead of flooding the pool
+			channel = quietestInstance;
+			channel->Stop();
+		}
+		else {
+			channel = GetFreeChannel();
+			if (channel == nullptr) {
+				if (quietestStealable == nullptr) {
+					// pool full of higher-priority voices - drop this play
+					LOG_CAT_DEBUG(Audio, "Voice pool full, dropped play of {}", audioClip.name);
+					return nullptr;
+				}
+				channel = quietestStealable;
+				channel->Stop();
+			}
+		}
+
+		// the queued Stop (if any) executes before the Play that follows,
+		// so claiming here and playing on the same channel is ordered
+		channel->m_active.store(true);
+		channel->m_clip = &audioClip;
+		channel->m_priority = audioClip.GetPriority();
+		channel->m_paused = false;
+
+		return channel;
+	}
+
+	/// <summary>
+	/// Claims a command slot with one compare-exchange and publishes it by
+	/// bumping the slot sequence (same Vyukov ring as the logger). A full
+	/// ring drops the command and counts it; the audio thread reports the
+	/// total when it next ticks.
+	/// </summary>
+	/// <param name="command">The command to queue</param>
+	/// <returns>True if the command was queued; false if it was dropped</returns>
+	bool AudioSystem::Enqueue(const Command& command) {
+		size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+		for (;;) {
+			CommandSlot& slot = m_commands[pos & (kCommandCapacity - 1)];
+			size_t sequence = slot.sequence.load(std::memory_order_acquire);
+			intptr_t difference = (intptr_t)sequence - (intptr_t)pos;
+
+			if (difference == 0) {
+				if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					slot.command = command;
+					slot.sequence.store(pos + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (difference < 0) {
+				// the audio thread hasn't freed this slot yet, the ring is full
+				m_droppedCommands++;
+				return false;
+			}
+			else {
+				pos = m_enqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Pops the next published command, audio thread only.
+	/// </summary>
+	/// <param name="command">Receives the dequeued command</param>
+	/// <returns>True if a command was dequeued; false if the ring is empty</returns>
+	bool AudioSystem::TryDequeue(Command& command) {
+		CommandSlot& slot = m_commands[m_dequeuePos & (kCommandCapacity - 1)];
+		size_t sequence = slot.sequence.load(std::memory_order_acquire);
+		if (sequence != m_dequeuePos + 1) return false;
+
+		command = slot.command;
+		// free the slot for the producer one lap ahead
+		slot.sequence.store(m_dequeuePos + kCommandCapacity, std::memory_order_release);
+		m_dequeuePos++;
+		return true;
+	}
+
+	/// <summary>
+	/// Releases a claimed channel whose play never started, making it
+	/// available to the pool again.
+	/// </summary>
+	/// <param name="channel">The channel to release</param>
+	void AudioSystem::ReleaseClaim(AudioChannel* channel) {
+		channel->m_playPending.store(false);
+		channel->m_active.store(false);
+	}
+
+	/// <summary>
+	/// Result check for commands against a voice's FMOD channel. Invalid
+	/// and stolen handles just mean the sound finished before the command
+	/// landed - the handle is cleared without the error log.
+	/// </summary>
+	/// <param name="channel">The channel the command targeted</param>
+	/// <param name="result">The FMOD_RESULT to check</param>
+	/// <returns>True if the operation succeeded; otherwise, false</returns>
+	bool AudioSystem::CheckChannelResult(AudioChannel* channel, FMOD_RESULT result) {
+		if (result == FMOD_ERR_INVALID_HANDLE || result == FMOD_ERR_CHANNEL_STOLEN) {
+			channel->m_channel = nullptr;
+			return false;
+		}
+
+		return CheckFMODResult(result);
+	}
+
+	/// <summary>
+	/// Starts a ready play: loop mode, playSound, then the channel's cached
+	/// volume and pitch - their commands may already have drained while the
+	/// play was parked on a still-opening clip. Audio thread only.
+	/// </summary>
+	/// <param name="command">The Play command to start</param>
+	void AudioSystem::StartPlay(const Command& command) {
+		AudioChannel* channel = command.channel;
+
+		// Set the sound to loop mode before playing, when requested
+		if (command.flag) CheckFMODResult(command.sound->setMode(FMOD_LOOP_NORMAL));
+
+		// Play the sound on the channel
+		// Parameters: sound object, channel group (0 = master), start paused (false), output channel pointer
+		FMOD_RESULT result = m_system->playSound(command.sound, 0, false, &channel->m_channel);
+		channel->m_playPending.store(false);
+		if (!CheckFMODResult(result)) {
+			channel->m_active.store(false);
+			return;
+		}
+
+		channel->m_virtual = false;
+		CheckFMODResult(channel->m_channel->setVolume(channel->GetVolume()));
+		CheckFMODResult(channel->m_channel->setPitch(channel->m_pitch));
+
+		// Set infinite looping (-1 means loop forever)
+		if (command.flag) CheckFMODResult(channel->m_channel->setLoopCount(-1));
+	}
+
+	/// <summary>
+	/// Re-polls plays parked on clips still opening asynchronously: starts
+	/// the ready ones, fails plays whose open errored, and drops expendable
+	/// one-shots past their deadline - by then the moment the sound
+	/// belonged to has passed. Audio thread only.
+	/// </summary>
+	void AudioSystem::UpdatePendingPlays() {
+		if (m_pendingPlays.empty()) return;
+
+		auto now = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < m_pendingPlays.size(); ) {
+			PendingPlay& pending = m_pendingPlays[i];
+			AudioChannel* channel = pending.command.channel;
+			AudioClip* clip = channel->m_clip;
+
+			if (clip && clip->IsReady()) {
+				StartPlay(pending.command);
+				m_pendingPlays.erase(m_pendingPlays.begin() + i);
+				continue;
+			}
+
+			FMOD_OPENSTATE state = FMOD_OPENSTATE_ERROR;
+			pending.command.sound->getOpenState(&state, nullptr, nullptr, nullptr);
+			if (state == FMOD_OPENSTATE_ERROR) {
+				LOG_CAT_ERROR(Audio, "Async open failed: {}", clip ? clip->name : std::string{});
+				ReleaseClaim(channel);
+				m_pendingPlays.erase(m_pendingPlays.begin() + i);
+				continue;
+			}
+
+			if (pending.hasDeadline && now >= pending.deadline) {
+				LOG_CAT_DEBUG(Audio, "Dropped play of {} (clip still loading past deadline)", clip ? clip->name : std::string{});
+				ReleaseClaim(channel);
+				m_pendingPlays.erase(m_pendingPlays.begin() + i);
+				continue;
+			}
+
+			i++;
+		}
+	}
+
+	/// <summary>
+	/// Executes one queued command against FMOD, audio thread only.
+	/// Parameter sets against a voice whose FMOD channel is already gone
+	/// are silently skipped - the sound finished before the command landed.
+	/// Plays against a clip whose async open is still in flight are parked
+	/// in the pending list.
+	/// </summary>
+	/// <param name="command">The command to execute</param>
+	void AudioSystem::Execute(const Command& command) {
+		AudioChannel* channel = command.channel;
+		switch (command.type) {
+		case Command::Type::Play:
+		{
+			AudioClip* clip = channel->m_clip;
+			if (clip && !clip->IsReady()) {
+				FMOD_OPENSTATE state = FMOD_OPENSTATE_ERROR;
+				command.sound->getOpenState(&state, nullptr, nullptr, nullptr);
+				if (state == FMOD_OPENSTATE_ERROR) {
+					LOG_CAT_ERROR(Audio, "Async open failed: {}", clip->name);
+					ReleaseClaim(channel);
+					break;
+				}
+
+				// park the play until FMOD's async open finishes
+				PendingPlay pending{ command, {}, command.dropAfter > 0 };
+				if (pending.hasDeadline) {
+					pending.deadline = std::chrono::steady_clock::now() +
+						std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(command.dropAfter));
+				}
+				m_pendingPlays.push_back(pending);
+				break;
+			}
+
+			StartPlay(command);
+			break;
+		}
+		case Command::Type::Stop:
+			if (channel->m_channel) CheckChannelResult(channel, channel->m_channel->stop());
+			break;
+		case Command::Type::SetPaused:
+			if (channel->m_channel) CheckChannelResult(channel, channel->m_channel->setPaused(command.flag));
+			break;
+		case Command::Type::SetVolume:
+			if (channel->m_channel) CheckChannelResult(channel, channel->m_channel->setVolume(command.value));
+			break;
+		case Command::Type::SetPitch:
+			if (channel->m_channel) CheckChannelResult(channel, channel->m_channel->setPitch(command.value));
+			break;
+		case Command::Type::SetLoopCount:
+			if (channel->m_channel) CheckChannelResult(channel, channel->m_channel->setLoopCount(command.count));
+			break;
+		case Command::Type::SetMute:
+			if (channel->m_channel) {
+				if (CheckChannelResult(channel, channel->m_channel->setMute(command.flag))) {
+					channel->m_virtual = command.flag;
+				}
+			}
+			break;
+		case Command::Type::Set3DAttributes:
+			if (channel->m_channel) {
+				FMOD_VECTOR position{ command.position.x, command.position.y, command.position.z };
+				FMOD_VECTOR velocity{ command.velocity.x, command.velocity.y, command.velocity.z };
+				CheckChannelResult(channel, channel->m_channel->set3DAttributes(&position, &velocity));
+			}
+			break;
+		}
+	}
+
+	/// <summary>
+	/// The audio thread body. Every tick: drain the command queue, apply
+	/// the listener snapshot, retire finished voices, park or revive voices
+	/// by audibility, then run FMOD's update. A fixed tick keeps mixer
+	/// servicing regular no matter what the game frame does.
+	/// </summary>
+	void AudioSystem::AudioThreadLoop() {
+		constexpr auto kTick = std::chrono::milliseconds(10);
+
+		while (m_running.load()) {
+			auto tickStart = std::chrono::steady_clock::now();
+			{
+				PROFILE_SCOPE("AudioSystem::Tick");
+
+				Command command;
+				while (TryDequeue(command)) Execute(command);
+
+				uint64_t dropped = m_droppedCommands.exchange(0);
+				if (dropped) LOG_CAT_WARNING(Audio, "Audio command queue full, dropped {} commands", dropped);
+
+				// plays parked on clips still opening asynchronously
+				UpdatePendingPlays();
+
+				// the listener snapshot the main thread published last frame
+				ListenerAttributes listener;
+				{
+					std::scoped_lock lock(m_listenerMutex);
+					listener = m_publishedListener;
+				}
+				FMOD_VECTOR position{ listener.position.x, listener.position.y, listener.position.z };
+				FMOD_VECTOR velocity{ listener.velocity.x, listener.velocity.y, listener.velocity.z };
+				FMOD_VECTOR forward{ listener.forward.x, listener.forward.y, listener.forward.z };
+				FMOD_VECTOR up{ listener.up.x, listener.up.y, listener.up.z };
+				CheckFMODResult(m_system->set3DListenerAttributes(0, &position, &velocity, &forward, &up));
+
+				// retire finished voices, then the virtualization pass -
+				// park voices whose requested volume fell below audibility
+				// and revive the ones that came back. Parked voices stay
+				// muted rather than stopped, so their timeline keeps
+				// advancing and a revived loop is still in sync
+				constexpr float kAudibleVolume = 0.01f;
+				for (auto& channel : m_channels) {
+					if (!channel->m_active.load()) continue;
+					if (channel->m_playPending.load()) continue; // play still queued
+
+					if (!channel->PollPlaying()) {
+						channel->m_active.store(false);
+						continue;
+					}
+
+					bool audible = channel->GetVolume() >= kAudibleVolume;
+					if (channel->m_virtual == audible) {
+						CheckFMODResult(channel->m_channel->setMute(!audible));
+						channel->m_virtual = !audible;
+					}
+				}
+
+				CheckFMODResult(m_system->update());
+			}
+
+			std::unique_lock lock(m_wakeMutex);
+			m_wake.wait_until(lock, tickStart + kTick, [this] { return !m_running.load(); });
+		}
+
+		// drain whatever raced in during shutdown so queued stops still land,
+		// and abandon any plays still parked on unfinished opens
+		Command command;
+		while (TryDequeue(command)) Execute(command);
+		for (auto& pending : m_pendingPlays) ReleaseClaim(pending.command.channel);
+		m_pendingPlays.clear();
+	}
+
 	/// <summary>
 	/// Initializes the audio system using FMOD.
-	/// Creates the FMOD system object, initializes it with 32 virtual channels,
-	/// and prepares the channel pool for use.
+	/// Creates the FMOD system object, initializes it with 32 virtual
+	/// channels, prepares the channel pool and command ring, and starts the
+	/// audio thread.
 	/// </summary>
 	/// <returns>True if the audio system was successfully initialized; otherwise, false</returns>
 	bool AudioSystem::Initialize() {
@@ -42,60 +392,111 @@ namespace neu {
 		FMOD_RESULT result = FMOD::System_Create(&m_system);
 		if (!CheckFMODResult(result)) return false;
 
-		// Initialize FMOD with 32 virtual channels and normal initialization flags
+		// Initialize FMOD with 32 virtual channels; right-handed 3D to
+		// match the renderer's coordinate system
 		// extradriverdata is not needed for standard initialization
 		void* extradriverdata = nullptr;
-		result = m_system->init(32, FMOD_INIT_NORMAL, extradriverdata);
+		result = m_system->init(32, FMOD_INIT_3D_RIGHTHANDED, extradriverdata);
 		if (!CheckFMODResult(result)) return false;
 
 		// Initialize the channel pool
 		// Each channel is created as a unique_ptr for automatic memory management
 		for (auto& channel : m_channels) {
 			channel = std::make_unique<AudioChannel>();
+			channel->m_system = this;
 		}
 
+		// stamp every command slot with its index - a slot is claimable
+		// when its sequence equals the claim position, so leaving them
+		// zeroed makes every slot past the first read as permanently full
+		for (size_t i = 0; i < kCommandCapacity; i++) {
+			m_commands[i].sequence.store(i, std::memory_order_relaxed);
+		}
+
+		m_running.store(true);
+		m_thread = std::thread(&AudioSystem::AudioThreadLoop, this);
+
 		return true;
 	}
 
 	/// <summary>
-	/// Shuts down the audio system and releases associated resources.
+	/// Stops the audio thread, then shuts down the audio system and
+	/// releases associated resources.
 	/// This will stop all playing sounds and clean up FMOD's internal state.
 	/// </summary>
 	void AudioSystem::Shutdown() {
+		m_running.store(false);
+		m_wake.notify_all();
+		if (m_thread.joinable()) m_thread.join();
+
 		CheckFMODResult(m_system->release());
 	}
 
 	/// <summary>
-	/// Updates the audio system state by processing pending audio operations.
-	/// This should be called once per frame to handle streaming, callbacks,
-	/// and other time-dependent audio operations.
+	/// Main-thread per-frame sync point. Publishes the 3D listener snapshot
+	/// recorded by SetListener for the audio thread's next tick. FMOD's
+	/// update itself runs on the audio thread.
 	/// </summary>
 	void AudioSystem::Update() {
-		CheckFMODResult(m_system->update());
+		PROFILE_SCOPE("AudioSystem::Update");
+
+		std::scoped_lock lock(m_listenerMutex);
+		m_publishedListener = m_listener;
+	}
+
+	/// <summary>
+	/// Warms every clip listed in the manifest so gameplay-time fetches hit
+	/// the resource cache instead of disk. Streamed clips (sidecar .meta
+	/// "stream" flag) only open the file here, which is still the point -
+	/// the open happens on the load screen, not mid-frame.
+	/// </summary>
+	/// <param name="manifestFilename">Path to the JSON manifest listing clip filenames</param>
+	void AudioSystem::PreloadBank(const std::string& manifestFilename) {
+		serial::document_t document;
+		if (!serial::Load(manifestFilename, document)) {
+			LOG_CAT_WARNING(Audio, "Could not load audio bank manifest: {}", manifestFilename);
+			return;
+		}
+
+		if (!SERIAL_CONTAINS(document, clips)) {
+			LOG_CAT_WARNING(Audio, "Audio bank manifest has no \"clips\" array: {}", manifestFilename);
+			return;
+		}
+
+		// fetching through the resource manager loads and caches each clip,
+		// so later gameplay fetches return the cached sound
+		int count = 0;
+		for (auto& item : SERIAL_AT(document, clips).GetArray()) {
+			if (!item.IsString()) continue;
+			if (Resources().Get<AudioClip>(item.GetString(), *this)) count++;
+		}
+
+		LOG_CAT_INFO(Audio, "Preloaded {} audio clips from {}", count, manifestFilename);
 	}
 
 	/// <summary>
-	/// Plays an audio clip on an available channel from the pool.
-	/// If no channels are available, a warning is logged and nullptr is returned.
-	/// The sound starts playing immediately (not paused).
+	/// Plays an audio clip on an available channel from the pool. The
+	/// channel is claimed and returned immediately; the play itself is
+	/// queued and starts on the audio thread's next tick.
+	/// If no channel can be claimed, nullptr is returned.
 	/// </summary>
 	/// <param name="audioClip">The audio clip containing the sound to play</param>
 	/// <param name="volume">Initial volume (0.0 to 1.0), clamped in SetVolume</param>
 	/// <param name="Pitch">Pitch multiplier for pitch control (0 = use default pitch)</param>
 	/// <returns>Pointer to the AudioChannel playing the sound, or nullptr if playback failed</returns>
 	AudioChannel* AudioSystem::PlaySound(AudioClip& audioClip, float volume, float pitch) {
-		// Find an available channel from the pool
-		AudioChannel* channel = GetFreeChannel();
-		if (channel == nullptr) {
-			LOG_WARNING("No free channels to play sound");
+		// Acquire a channel through voice management (instance caps, steals)
+		AudioChannel* channel = AcquireChannel(audioClip);
+		if (channel == nullptr) return nullptr;
+
+		Command command{ Command::Type::Play, channel, audioClip.m_sound };
+		command.dropAfter = audioClip.GetDropAfter(); // one-shots are expendable if the clip is still opening
+		channel->m_playPending.store(true);
+		if (!Enqueue(command)) {
+			ReleaseClaim(channel);
 			return nullptr;
 		}
 
-		// Play the sound on the channel
-		// Parameters: sound object, channel group (0 = master), start paused (false), output channel pointer
-		FMOD_RESULT result = m_system->playSound(audioClip.m_sound, 0, false, &channel->m_channel);
-		if (!CheckFMODResult(result)) return nullptr;
-
 		// Apply the requested volume and frequency settings
 		channel->SetVolume(volume);
 		channel->SetPitch(pitch);
@@ -104,48 +505,34 @@ namespace neu {
 	}
 
 	/// <summary>
-	/// Plays an audio clip with infinite looping enabled.
-	/// If no channels are available, a warning is logged and nullptr is returned.
-	/// The sound starts playing immediately with loop count set to -1 (infinite).
-	/// </summary>
-	/// <param name="audioClip">The audio clip containing the sound to loop</param>
-	/// <param name="volume">Initial volume (0.0 to 1.0), clamped in SetVolume</param>
-	/// <param name="pitch">Pitch multiplier for pitch control (1 = use default pitch)</param>
-	/// <returns>Pointer to the AudioChannel playing the looped sound, or nullptr if playback failed</returns>
-	/// <summary>
-	/// Plays an audio clip with infinite looping enabled.
-	/// If no channels are available, a warning is logged and nullptr is returned.
-	/// The sound starts playing immediately with loop count set to -1 (infinite).
-	/// Sets the sound's loop mode to enable looping behavior.
+	/// Plays an audio clip with infinite looping enabled. The channel is
+	/// claimed and returned immediately; the play itself is queued and
+	/// starts on the audio thread's next tick with loop count set to -1
+	/// (infinite).
+	/// If no channel can be claimed, nullptr is returned.
 	/// </summary>
 	/// <param name="audioClip">The audio clip containing the sound to loop</param>
 	/// <param name="volume">Initial volume (0.0 to 1.0), clamped in SetVolume</param>
 	/// <param name="pitch">Pitch multiplier for pitch control (0 = use default pitch)</param>
 	/// <returns>Pointer to the AudioChannel playing the looped sound, or nullptr if playback failed</returns>
 	AudioChannel* AudioSystem::PlaySoundLoop(AudioClip& audioClip, float volume, float pitch) {
-		// Find an available channel from the pool
-		AudioChannel* channel = GetFreeChannel();
-		if (channel == nullptr) {
-			LOG_WARNING("No free channels to play sound");
+		// Acquire a channel through voice management (instance caps, steals)
+		AudioChannel* channel = AcquireChannel(audioClip);
+		if (channel == nullptr) return nullptr;
+
+		Command command{ Command::Type::Play, channel, audioClip.m_sound };
+		command.flag = true; // loop
+		// dropAfter stays 0 - a loop is persistent state, it always waits for the open
+		channel->m_playPending.store(true);
+		if (!Enqueue(command)) {
+			ReleaseClaim(channel);
 			return nullptr;
 		}
 
-		// Set the sound to loop mode before playing
-		FMOD_RESULT result = audioClip.m_sound->setMode(FMOD_LOOP_NORMAL);
-		if (!CheckFMODResult(result)) return nullptr;
-
-		// Play the sound on the channel
-		// Parameters: sound object, channel group (0 = master), start paused (false), output channel pointer
-		result = m_system->playSound(audioClip.m_sound, 0, false, &channel->m_channel);
-		if (!CheckFMODResult(result)) return nullptr;
-
 		// Apply the requested volume and pitch settings
 		channel->SetVolume(volume);
 		channel->SetPitch(pitch);
 
-		// Set infinite looping (-1 means loop forever)
-		channel->SetLoopCount(-1);
-
 		return channel;
 	}
-}
\ No newline at end of file
+}
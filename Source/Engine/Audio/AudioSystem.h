@@ -1,39 +1,89 @@
 #pragma once
 #include <fmod.hpp>
+#include <glm/glm.hpp>
 #include <string>
 #include <map>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
 
 namespace neu {
 	/// <summary>
 	/// Main audio system that manages FMOD initialization, audio playback, and channel management.
 	/// This class acts as the central hub for all audio operations in the engine.
 	/// It maintains a pool of 32 audio channels that can be reused for playing sounds.
+	/// FMOD's update loop runs on a dedicated audio thread at a fixed tick, so
+	/// FMOD-internal stalls never add to frame time and a main-thread hitch
+	/// doesn't starve the mixer. Gameplay-facing calls (play, stop, parameter
+	/// sets from AudioChannel) go through a lock-free command queue drained by
+	/// that thread.
 	/// </summary>
 	class AudioSystem {
 	public:
+		/// <summary>
+		/// 3D listener attributes for positional audio, snapshotted once per
+		/// game frame in Update and applied on the audio thread's next tick.
+		/// </summary>
+		struct ListenerAttributes {
+			glm::vec3 position{ 0 };
+			glm::vec3 velocity{ 0 };
+			glm::vec3 forward{ 0, 0, -1 };
+			glm::vec3 up{ 0, 1, 0 };
+		};
+
 		AudioSystem() = default;
 
 		/// <summary>
-		/// Initializes the FMOD audio system and prepares the channel pool.
+		/// Initializes the FMOD audio system, prepares the channel pool and
+		/// command queue, and starts the audio thread.
 		/// Must be called before any audio operations can be performed.
 		/// </summary>
 		/// <returns>True if initialization was successful; otherwise, false</returns>
 		bool Initialize();
 
 		/// <summary>
-		/// Shuts down the FMOD audio system and releases all resources.
-		/// Should be called during application cleanup.
+		/// Stops the audio thread, then shuts down the FMOD audio system and
+		/// releases all resources. Should be called during application cleanup.
 		/// </summary>
 		void Shutdown();
 
 		/// <summary>
-		/// Updates the audio system state. Should be called once per frame.
-		/// Processes FMOD's internal update loop for streaming, callbacks, and other time-based operations.
+		/// Main-thread per-frame sync point: publishes the 3D listener
+		/// snapshot for the audio thread to apply. FMOD's own update no
+		/// longer runs here - the audio thread ticks it independently.
 		/// </summary>
 		void Update();
 
 		/// <summary>
-		/// Plays an audio clip on an available channel.
+		/// Records the 3D listener attributes for this game frame. Cheap to
+		/// call; the value published to the audio thread is whatever was set
+		/// last when Update runs.
+		/// </summary>
+		/// <param name="listener">Listener position, velocity and orientation</param>
+		void SetListener(const ListenerAttributes& listener) { m_listener = listener; }
+
+		/// <summary>
+		/// The listener attributes recorded this frame - main thread only.
+		/// Emitter gathering reads the position for audible-range culling.
+		/// </summary>
+		/// <returns>The last listener attributes set</returns>
+		const ListenerAttributes& GetListener() const { return m_listener; }
+
+		/// <summary>
+		/// Warms every clip listed under "clips" in the manifest through the
+		/// resource manager, so gameplay-time Get&lt;AudioClip&gt; never touches
+		/// disk. Intended to run during scene load screens.
+		/// </summary>
+		/// <param name="manifestFilename">Path to the JSON manifest listing clip filenames</param>
+		void PreloadBank(const std::string& manifestFilename);
+
+		/// <summary>
+		/// Plays an audio clip on an available channel. The play itself is
+		/// queued to the audio thread; the returned channel is valid to use
+		/// immediately.
 		/// </summary>
 		/// <param name="audioClip">The audio clip to play</param>
 		/// <param name="volume">Volume level (0.0 to 1.0), default is 1.0 (full volume)</param>
@@ -52,11 +102,115 @@ namespace neu {
 
 	private:
 		/// <summary>
-		/// Finds and returns the first available (non-playing) channel from the pool.
+		/// One queued operation for the audio thread. Play carries the sound
+		/// and loop flag; the parameter sets carry their value in the field
+		/// matching their type.
+		/// </summary>
+		struct Command {
+			enum class Type { Play, Stop, SetPaused, SetVolume, SetPitch, SetLoopCount, SetMute, Set3DAttributes };
+
+			Type type{ Type::Stop };
+			class AudioChannel* channel{ nullptr };
+			FMOD::Sound* sound{ nullptr };	// Play only
+			float value{ 0 };				// volume / pitch
+			int count{ 0 };					// loop count
+			bool flag{ false };				// loop / paused / mute
+			float dropAfter{ 0 };			// Play only - seconds a still-opening clip may park the play (0 = wait)
+			glm::vec3 position{ 0 };		// Set3DAttributes only
+			glm::vec3 velocity{ 0 };		// Set3DAttributes only
+		};
+
+		/// <summary>
+		/// A play parked on a clip whose async open hasn't finished - the
+		/// audio tick re-polls readiness and starts or drops it.
+		/// </summary>
+		struct PendingPlay {
+			Command command;
+			std::chrono::steady_clock::time_point deadline;
+			bool hasDeadline{ false };
+		};
+
+		/// <summary>
+		/// Finds and returns the first available (unclaimed) channel from the pool.
 		/// </summary>
 		/// <returns>Pointer to a free AudioChannel, or nullptr if all channels are in use</returns>
 		AudioChannel* GetFreeChannel();
 
+		/// <summary>
+		/// Voice management front door for PlaySound/PlaySoundLoop. Enforces
+		/// the clip's max-instance cap by recycling its quietest playing
+		/// instance, and when the pool is exhausted steals the quietest
+		/// voice of equal or lower priority - a full volley of one-shots
+		/// never grows the mix beyond the pool.
+		/// </summary>
+		/// <param name="audioClip">The clip about to play, for caps and priority</param>
+		/// <returns>A channel ready to play on, or nullptr if every playing voice outranks the clip</returns>
+		AudioChannel* AcquireChannel(class AudioClip& audioClip);
+
+		/// <summary>
+		/// Claims a command slot with one compare-exchange and publishes it
+		/// by bumping the slot sequence. Callable from any thread. Drops the
+		/// command (counted, reported by the audio thread) when the ring is
+		/// full.
+		/// </summary>
+		/// <param name="command">The command to queue</param>
+		/// <returns>True if the command was queued; false if it was dropped</returns>
+		bool Enqueue(const Command& command);
+
+		/// <summary>
+		/// Pops the next published command, audio thread only.
+		/// </summary>
+		/// <param name="command">Receives the dequeued command</param>
+		/// <returns>True if a command was dequeued; false if the ring is empty</returns>
+		bool TryDequeue(Command& command);
+
+		/// <summary>
+		/// Executes one queued command against FMOD, audio thread only.
+		/// Plays against a clip whose async open is still in flight are
+		/// parked in the pending list instead of starting.
+		/// </summary>
+		/// <param name="command">The command to execute</param>
+		void Execute(const Command& command);
+
+		/// <summary>
+		/// Starts a ready play: sets loop mode, plays the sound, and applies
+		/// the channel's cached volume and pitch (their commands may have
+		/// drained while the play was parked). Audio thread only.
+		/// </summary>
+		/// <param name="command">The Play command to start</param>
+		void StartPlay(const Command& command);
+
+		/// <summary>
+		/// Re-polls plays parked on still-opening clips: starts the ready
+		/// ones, drops expendable ones past their deadline, and fails plays
+		/// whose open errored. Audio thread only.
+		/// </summary>
+		void UpdatePendingPlays();
+
+		/// <summary>
+		/// Releases a claimed channel whose play never started (drop, open
+		/// failure, queue overflow).
+		/// </summary>
+		/// <param name="channel">The channel to release</param>
+		static void ReleaseClaim(class AudioChannel* channel);
+
+		/// <summary>
+		/// Result check for commands against a voice's FMOD channel: an
+		/// invalid or stolen handle means the voice ended before the command
+		/// landed - the handle is cleared quietly instead of logged.
+		/// </summary>
+		/// <param name="channel">The channel the command targeted</param>
+		/// <param name="result">The FMOD_RESULT to check</param>
+		/// <returns>True if the operation succeeded; otherwise, false</returns>
+		static bool CheckChannelResult(class AudioChannel* channel, FMOD_RESULT result);
+
+		/// <summary>
+		/// The audio thread body: at a fixed tick, drains the command queue,
+		/// applies the listener snapshot, retires finished voices, runs the
+		/// virtualization pass, and ticks FMOD's update.
+		/// </summary>
+		void AudioThreadLoop();
+
 		/// <summary>
 		/// Checks if an FMOD operation was successful and logs an error if it failed.
 		/// </summary>
@@ -75,6 +229,35 @@ namespace neu {
 		// Pool of 32 reusable audio channels for efficient sound playback
 		// Using unique_ptr for automatic memory management
 		std::array<std::unique_ptr<AudioChannel>, 32> m_channels;
+
+		// bounded MPSC command ring (same Vyukov queue as the logger) - the
+		// sequence number equals the claim position when a slot is free to
+		// write and position + 1 when ready to read, so producers and the
+		// audio thread coordinate without a lock
+		static constexpr size_t kCommandCapacity = 256; // power of two for mask wrap
+		struct CommandSlot {
+			std::atomic<size_t> sequence{ 0 };
+			Command command;
+		};
+		std::array<CommandSlot, kCommandCapacity> m_commands;
+		std::atomic<size_t> m_enqueuePos{ 0 };
+		size_t m_dequeuePos = 0; // audio thread only
+		std::atomic<uint64_t> m_droppedCommands{ 0 };
+
+		// plays parked on clips still opening asynchronously - audio thread only
+		std::vector<PendingPlay> m_pendingPlays;
+
+		// listener snapshot: gameplay writes m_listener via SetListener
+		// (main thread only), Update publishes it under the mutex once per
+		// game frame, and the audio tick copies it out to apply
+		ListenerAttributes m_listener;
+		ListenerAttributes m_publishedListener;
+		std::mutex m_listenerMutex;
+
+		std::thread m_thread;
+		std::atomic<bool> m_running{ false };
+		std::mutex m_wakeMutex;
+		std::condition_variable m_wake;
 	};
 
-}
\ No newline at end of file
+}
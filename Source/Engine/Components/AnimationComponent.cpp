@@ -0,0 +1,68 @@
+#include "EnginePCH.h"
+
+namespace neu {
+	FACTORY_REGISTER(AnimationComponent)
+
+	void AnimationComponent::Update(float dt)
+	{
+		auto renderer = owner->GetComponent<ModelRenderer>();
+		if (!renderer || !renderer->model || !renderer->model->IsSkinned()) return;
+
+		Model* model = renderer->model.get();
+
+		// resolve the clip by name, once per name change
+		if (!m_clip || m_resolvedClip != clip) {
+			m_clip = model->FindClip(clip);
+			m_resolvedClip = clip;
+			m_time = 0;
+			m_sampler.Reset(m_clip);
+
+			if (!m_clip) {
+				LOG_CAT_WARNING(Renderer, "Model has no animation clip named \"{}\"", clip);
+
+				// hold the bind pose so the mesh doesn't collapse to the origin
+				m_palette.assign(model->GetSkeleton().joints.size(), glm::mat4{ 1 });
+				return;
+			}
+		}
+
+		if (playing) {
+			m_time += dt * speed;
+			if (m_clip->duration > 0) {
+				if (loop) m_time = std::fmod(m_time, m_clip->duration);
+				else m_time = math::clamp(m_time, 0.0f, m_clip->duration);
+			}
+		}
+
+		animation::SamplePalette(model->GetSkeleton(), m_sampler, m_time, m_palette);
+	}
+
+	void AnimationComponent::Play(const std::string& clipName)
+	{
+		clip = clipName;
+		playing = true;
+	}
+
+	void AnimationComponent::Read(const serial_data_t& value)
+	{
+		static const serial::FieldDescriptor kFields[] = {
+			SERIAL_FIELD(AnimationComponent, clip),
+			SERIAL_FIELD(AnimationComponent, speed),
+			SERIAL_FIELD(AnimationComponent, loop),
+			SERIAL_FIELD(AnimationComponent, playing),
+		};
+		serial::ReadFields(value, this, typeId, kFields, std::size(kFields));
+	}
+
+	void AnimationComponent::UpdateGUI()
+	{
+		char buffer[64];
+		strncpy_s(buffer, sizeof(buffer), clip.c_str(), _TRUNCATE);
+		if (ImGui::InputText("Clip", buffer, sizeof(buffer))) clip = buffer;
+
+		ImGui::DragFloat("Speed", &speed, 0.01f);
+		ImGui::Checkbox("Loop", &loop);
+		ImGui::Checkbox("Playing", &playing);
+		ImGui::Text("Time: %.2f", m_time);
+	}
+}
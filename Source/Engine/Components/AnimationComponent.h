@@ -0,0 +1,47 @@
+#pragma once
+
+namespace neu {
+	// samples an animation clip from the sibling ModelRenderer's skinned
+	// model into a joint palette each update - sampling is pure CPU work
+	// (safe on the job workers), the palette uploads at playback when the
+	// draw it belongs to plays back
+	class AnimationComponent : public Component
+	{
+	public:
+		CLASS_PROTOTYPE(AnimationComponent)
+
+		void Update(float dt) override;
+
+		void Read(const serial_data_t& value) override;
+
+		// switches to the named clip - unknown names stop playback at the
+		// bind pose and log once on the next update
+		void Play(const std::string& clipName);
+
+		// sampled palette for the scene to capture at record time - empty
+		// until the first update resolves a clip
+		bool HasPalette() const { return !m_palette.empty(); }
+		const std::vector<glm::mat4>& GetPalette() const { return m_palette; }
+
+		void UpdateGUI() override;
+
+	public:
+		std::string clip;		// startup clip name
+		float speed{ 1 };
+		bool loop{ true };
+		bool playing{ true };
+
+	private:
+		float m_time{ 0 };
+
+		// clip resolved from the model by name, re-resolved when the name
+		// changes (editor edits, Play calls)
+		const AnimationClip* m_clip{ nullptr };
+		std::string m_resolvedClip;
+
+		// per-instance linear-advance cursors into the clip's channels
+		animation::ClipSampler m_sampler;
+
+		std::vector<glm::mat4> m_palette;
+	};
+}
@@ -0,0 +1,131 @@
+#include "AudioEmitterComponent.h"
+
+namespace neu {
+	FACTORY_REGISTER(AudioEmitterComponent)
+	BATCH_UPDATE_REGISTER(AudioEmitterComponent)
+
+	bool AudioEmitterComponent::Start() {
+		if (playOnStart) Play();
+
+		return true;
+	}
+
+	void AudioEmitterComponent::Destroyed() {
+		Stop();
+	}
+
+	void AudioEmitterComponent::Reset() {
+		// Destroyed() stopped the voice when the actor was parked - a
+		// re-armed emitter behaves like a fresh spawn
+		m_hasLastPosition = false;
+		m_audible = true;
+		if (playOnStart) Play();
+	}
+
+	void AudioEmitterComponent::Update(float dt) {
+		// covered by the batch path
+	}
+
+	void AudioEmitterComponent::UpdateBatch(const std::vector<Component*>& components, float dt) {
+		// one flat gather over the typed slice - positions come from the
+		// scene's cached world matrices, and the listener is this frame's
+		// snapshot, so the loop is arithmetic until something needs FMOD
+		const glm::vec3 listener = GetEngine().GetAudio().GetListener().position;
+
+		for (auto component : components) {
+			auto emitter = static_cast<AudioEmitterComponent*>(component);
+			if (!emitter->active || !emitter->owner->active || emitter->owner->destroyed) continue;
+			if (!emitter->OwnsVoice()) continue;
+
+			glm::vec3 position = emitter->GetPosition();
+
+			// audible-range cull before any queued call - crossing the
+			// boundary zeroes or restores the requested volume, so the
+			// audio thread's virtualization pass parks the voice with its
+			// timeline running, or revives it in sync
+			float range = emitter->clip->GetMaxDistance();
+			glm::vec3 delta = position - listener;
+			bool audible = glm::dot(delta, delta) <= range * range;
+			if (audible != emitter->m_audible) {
+				emitter->m_channel->SetVolume(audible ? emitter->volume : 0.0f);
+				emitter->m_audible = audible;
+			}
+			if (!audible) continue;
+
+			// stationary emitters already submitted their attributes -
+			// only movers queue an update
+			if (emitter->m_hasLastPosition && position == emitter->m_lastPosition) continue;
+
+			glm::vec3 velocity{ 0 };
+			if (emitter->m_hasLastPosition && dt > 0) velocity = (position - emitter->m_lastPosition) / dt;
+			emitter->m_lastPosition = position;
+			emitter->m_hasLastPosition = true;
+
+			emitter->m_channel->Set3DAttributes(position, velocity);
+		}
+	}
+
+	void AudioEmitterComponent::Play() {
+		if (!clip) return;
+
+		auto& audio = GetEngine().GetAudio();
+		m_channel = loop ? audio.PlaySoundLoop(*clip, volume, pitch) : audio.PlaySound(*clip, volume, pitch);
+		if (!m_channel) return;
+
+		// seed the 3D attributes so the first audio tick doesn't mix the
+		// voice from the origin
+		glm::vec3 position = GetPosition();
+		m_channel->Set3DAttributes(position, glm::vec3{ 0 });
+		m_lastPosition = position;
+		m_hasLastPosition = true;
+		m_audible = true;
+	}
+
+	void AudioEmitterComponent::Stop() {
+		if (OwnsVoice()) m_channel->Stop();
+		m_channel = nullptr;
+	}
+
+	glm::vec3 AudioEmitterComponent::GetPosition() const {
+		return owner->scene ? glm::vec3(owner->scene->GetWorldMatrix(owner)[3]) : owner->transform.position;
+	}
+
+	bool AudioEmitterComponent::OwnsVoice() const {
+		// the pool may have stolen the channel for another sound - the
+		// clip identity check stops this emitter driving someone else's voice
+		return m_channel && m_channel->IsPlaying() && m_channel->GetClip() == clip.get();
+	}
+
+	void AudioEmitterComponent::Read(const serial_data_t& value) {
+		Object::Read(value);
+
+		std::string clipName;
+		SERIAL_READ_NAME(value, "clip", clipName);
+		if (!clipName.empty()) clip = Resources().Get<AudioClip>(clipName, GetEngine().GetAudio());
+
+		SERIAL_READ(value, volume);
+		SERIAL_READ(value, pitch);
+		SERIAL_READ(value, loop);
+		SERIAL_READ(value, playOnStart);
+	}
+
+	void AudioEmitterComponent::UpdateGUI() {
+		ImGui::Text("Clip: %s", clip ? clip->name.c_str() : "(none)");
+		if (ImGui::SliderFloat("Volume", &volume, 0.0f, 1.0f) && OwnsVoice() && m_audible) {
+			m_channel->SetVolume(volume);
+		}
+		if (ImGui::DragFloat("Pitch", &pitch, 0.01f, 0.0f, 4.0f) && OwnsVoice()) {
+			m_channel->SetPitch(pitch);
+		}
+		ImGui::Checkbox("Loop", &loop);
+		ImGui::SameLine();
+		ImGui::Checkbox("Play on start", &playOnStart);
+
+		if (OwnsVoice()) {
+			if (ImGui::Button("Stop")) Stop();
+		}
+		else if (ImGui::Button("Play")) {
+			Play();
+		}
+	}
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "Audio/AudioClip.h"
+
+namespace neu {
+
+	// Positional sound source placed on an actor. Voices play through the
+	// normal channel pool; per frame the registered batch update gathers
+	// every emitter's world position from the scene's cached transforms in
+	// one pass, culls by the clip's audible range against this frame's
+	// listener snapshot, and submits 3D attributes to the audio command
+	// queue only for audible emitters that actually moved - 500 placed
+	// emitters cost a linear gather plus a handful of queued updates.
+	class AudioEmitterComponent : public Component {
+	public:
+		CLASS_PROTOTYPE(AudioEmitterComponent)
+
+		// playOnStart acquires a channel from the shared pool - start in
+		// the serial phase
+		AudioEmitterComponent() { serialStart = true; }
+
+		bool Start() override;
+		void Destroyed() override;
+
+		// re-arm from the recycle pool - restarts the voice like a fresh
+		// spawn when playOnStart is set
+		void Reset() override;
+
+		void Update(float dt);
+
+		// batch path - gathers and submits every live emitter over the
+		// scene's typed registry slice in one call (registered via
+		// BATCH_UPDATE_REGISTER, so the per-actor loop skips this type)
+		static void UpdateBatch(const std::vector<Component*>& components, float dt);
+
+		void Read(const serial_data_t& value) override;
+		void UpdateGUI() override;
+
+		// starts (or restarts) the emitter's voice at the actor's position
+		void Play();
+
+		// stops the voice if this emitter still owns it
+		void Stop();
+
+	public:
+		res_t<AudioClip> clip;
+
+		float volume{ 1 };
+		float pitch{ 1 };
+		bool loop{ true };
+		bool playOnStart{ true };
+
+	private:
+		// current world position of the owning actor, from the scene's
+		// transform cache when mirrored there
+		glm::vec3 GetPosition() const;
+
+		// true while the channel still carries this emitter's voice - the
+		// pool may steal it for a higher-priority sound at any time
+		bool OwnsVoice() const;
+
+	private:
+		class AudioChannel* m_channel{ nullptr };
+
+		// last submitted position, for the moved check and velocity
+		glm::vec3 m_lastPosition{ 0 };
+		bool m_hasLastPosition{ false };
+
+		// inside the clip's audible range last gather - transitions zero or
+		// restore the requested volume so the virtualization pass parks and
+		// revives the voice
+		bool m_audible{ true };
+	};
+}
@@ -6,13 +6,35 @@ namespace neu {
 
 	void CameraComponent::Update(float dt)
 	{
-		view = (shadowCamera)
-			? glm::lookAt(owner->transform.position, owner->transform.position + owner->transform.Forward(), owner->transform.Up())
-			: glm::lookAt(owner->transform.position, owner->transform.position + owner->transform.Forward(), owner->transform.Up());
+		// rebuild only when something actually moved - the view depends on the
+		// owner transform, the projection on the authored parameters. Snapshot
+		// the inputs and compare by value (Transform has no change counter);
+		// for static cameras every frame after the first is a memcmp
+		CacheKey key{};
+		key.position = owner->transform.position;
+		key.rotation = owner->transform.rotationq;
+		key.projectionType = projectionType;
+		key.fov = fov;
+		key.aspect = aspect;
+		key.near = near;
+		key.far = far;
+		key.size = size;
+
+		if (m_cached && std::memcmp(&key, &m_cacheKey, sizeof(CacheKey)) == 0) return;
+		m_cacheKey = key;
+		m_cached = true;
+
+		view = glm::lookAt(owner->transform.position, owner->transform.position + owner->transform.Forward(), owner->transform.Up());
 
 		projection = (projectionType == ProjectionType::Perspective)
 			? glm::perspective(glm::radians(fov), aspect, near, far)
 			: glm::ortho(-size, size, -size, size, near, far);
+
+		// derived values the culling and shadow systems consume, computed once
+		// here instead of once per consumer
+		m_viewProjection = projection * view;
+		m_inverseView = glm::inverse(view);
+		m_frustum = Frustum::FromMatrix(m_viewProjection);
 	}
 
 	void CameraComponent::Clear() {
@@ -38,6 +60,13 @@ namespace neu {
 	void CameraComponent::SetLookAt(const glm::vec3& eye, const glm::vec3& center, const glm::vec3& up)
 	{
 		view = glm::lookAt(eye, center, up);
+
+		// the view no longer matches the owner transform - keep the derived
+		// values consistent and let the next Update() re-validate the cache
+		m_viewProjection = projection * view;
+		m_inverseView = glm::inverse(view);
+		m_frustum = Frustum::FromMatrix(m_viewProjection);
+		m_cached = false;
 	}
 
 	void CameraComponent::SetProgram(Program& program)
@@ -49,17 +78,22 @@ namespace neu {
 
 	void CameraComponent::Read(const serial_data_t& value)
 	{
-		SERIAL_READ(value, fov);
-		if (!SERIAL_READ(value, aspect)) aspect = GetEngine().GetRenderer().GetWidth() / (float)GetEngine().GetRenderer().GetHeight();
-		SERIAL_READ(value, near); 
-		SERIAL_READ(value, far);
-		SERIAL_READ(value, size);
+		// plain fields dispatch through the descriptor table in one pass;
+		// aspect stays on SERIAL_READ for its absent-value fallback
+		static const serial::FieldDescriptor kFields[] = {
+			SERIAL_FIELD(CameraComponent, fov),
+			SERIAL_FIELD(CameraComponent, near),
+			SERIAL_FIELD(CameraComponent, far),
+			SERIAL_FIELD(CameraComponent, size),
+			SERIAL_FIELD(CameraComponent, backgroundColor),
+			SERIAL_FIELD(CameraComponent, clearColorBuffer),
+			SERIAL_FIELD(CameraComponent, clearDepthBuffer),
+			SERIAL_FIELD(CameraComponent, shadowCamera),
+			SERIAL_FIELD(CameraComponent, cascades),
+		};
+		serial::ReadFields(value, this, typeId, kFields, std::size(kFields));
 
-		SERIAL_READ(value, backgroundColor);
-		SERIAL_READ(value, clearColorBuffer);
-		SERIAL_READ(value, clearDepthBuffer);
-
-		SERIAL_READ(value, shadowCamera);
+		if (!SERIAL_READ(value, aspect)) aspect = GetEngine().GetRenderer().GetWidth() / (float)GetEngine().GetRenderer().GetHeight();
 
 		std::string projectionTypeName;
 		SERIAL_READ_NAME(value, "projectionType", projectionTypeName);
@@ -10,6 +10,9 @@ namespace neu {
 	public:
 		CLASS_PROTOTYPE(CameraComponent)
 
+		// view matrices feed culling and audio every frame - opt out of
+		// update-rate LOD
+		CameraComponent() { fullRateUpdate = true; }
 
 		void Update(float dt) override;
 		void Clear();
@@ -22,6 +25,15 @@ namespace neu {
 		void Read(const serial_data_t& value) override;
 		void UpdateGUI() override;
 
+		// derived values cached by Update() alongside view/projection, rebuilt
+		// only when the camera actually changed - static cameras (shadow, UI)
+		// hand these out for free. Note: Scene retargets projection per shadow
+		// cascade without going through Update, cascade passes derive their
+		// own frusta
+		const glm::mat4& GetViewProjection() const { return m_viewProjection; }
+		const glm::mat4& GetInverseView() const { return m_inverseView; }
+		const Frustum& GetFrustum() const { return m_frustum; }
+
 	public:
 		glm::mat4 projection{ 1 };	
 		glm::mat4 view{ 1 };
@@ -29,6 +41,12 @@ namespace neu {
 		ProjectionType projectionType = ProjectionType::Perspective;
 		bool shadowCamera{ false };
 
+		// shadow cameras only: > 1 renders cascaded shadow maps - the scene
+		// fits this many view-frustum slices into the layers of the depth
+		// array outputTexture, ignoring the authored projection. 0/1 keeps
+		// the single-map path
+		int cascades{ 0 };
+
 		float fov = 70.0f;
 		float aspect = 0;
 		float near = 0.1f;
@@ -41,6 +59,29 @@ namespace neu {
 		glm::vec3 backgroundColor { 0,0,0 };
 
 		// Inherited via GUI
-		
+
+	private:
+		/// <summary>
+		/// Snapshot of every input the matrices are built from. Transform has
+		/// no change counter, so Update() compares this by value to decide
+		/// whether anything needs recomputing.
+		/// </summary>
+		struct CacheKey {
+			glm::vec3 position{ 0 };
+			glm::quat rotation{ glm::identity<glm::quat>() };
+			ProjectionType projectionType = ProjectionType::Perspective;
+			float fov = 0;
+			float aspect = 0;
+			float near = 0;
+			float far = 0;
+			float size = 0;
+		};
+
+		CacheKey m_cacheKey{};
+		bool m_cached{ false };
+
+		glm::mat4 m_viewProjection{ 1 };
+		glm::mat4 m_inverseView{ 1 };
+		Frustum m_frustum;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,88 @@
+#include "ColliderComponent.h"
+
+namespace neu {
+	FACTORY_REGISTER(ColliderComponent)
+
+	void ColliderComponent::Update(float dt) {
+	}
+
+	Bounds ColliderComponent::GetWorldBounds() const {
+		Bounds bounds;
+
+		switch (shape) {
+		case ShapeType::AABB:
+			// box centered on the owner, transformed corner by corner
+			bounds.Encapsulate(size * -0.5f);
+			bounds.Encapsulate(size * 0.5f);
+			bounds = bounds.Transformed(owner->transform.GetMatrix());
+			break;
+		case ShapeType::Sphere:
+		{
+			float worldRadius = GetWorldRadius();
+			bounds.Encapsulate(owner->transform.position - glm::vec3{ worldRadius });
+			bounds.Encapsulate(owner->transform.position + glm::vec3{ worldRadius });
+			break;
+		}
+		}
+
+		return bounds;
+	}
+
+	float ColliderComponent::GetWorldRadius() const {
+		const glm::vec3& scale = owner->transform.scale;
+		return radius * math::max(scale.x, math::max(scale.y, scale.z));
+	}
+
+	bool ColliderComponent::TestOverlap(const ColliderComponent& other) const {
+		// box/box - enclosing world AABBs
+		if (shape == ShapeType::AABB && other.shape == ShapeType::AABB) {
+			return GetWorldBounds().Intersects(other.GetWorldBounds());
+		}
+
+		// sphere/sphere - squared center distance against summed radii
+		if (shape == ShapeType::Sphere && other.shape == ShapeType::Sphere) {
+			glm::vec3 delta = other.owner->transform.position - owner->transform.position;
+			float radii = GetWorldRadius() + other.GetWorldRadius();
+			return glm::dot(delta, delta) <= radii * radii;
+		}
+
+		// sphere/box - closest point on the box against the sphere radius
+		const ColliderComponent& sphere = (shape == ShapeType::Sphere) ? *this : other;
+		const ColliderComponent& box = (shape == ShapeType::Sphere) ? other : *this;
+
+		Bounds bounds = box.GetWorldBounds();
+		glm::vec3 center = sphere.owner->transform.position;
+		glm::vec3 closest = glm::clamp(center, bounds.min, bounds.max);
+		glm::vec3 delta = closest - center;
+		float worldRadius = sphere.GetWorldRadius();
+
+		return glm::dot(delta, delta) <= worldRadius * worldRadius;
+	}
+
+	void ColliderComponent::Read(const serial_data_t& value) {
+		std::string shapeName;
+		SERIAL_READ_NAME(value, "shape", shapeName);
+		if (equalsIgnoreCase(shapeName, "aabb")) shape = ShapeType::AABB;
+		else if (equalsIgnoreCase(shapeName, "sphere")) shape = ShapeType::Sphere;
+
+		SERIAL_READ(value, size);
+		SERIAL_READ(value, radius);
+		SERIAL_READ(value, layer);
+		SERIAL_READ(value, mask);
+	}
+
+	void ColliderComponent::UpdateGUI() {
+		const char* shapes[] = { "AABB", "Sphere" };
+		ImGui::Combo("Shape", (int*)&shape, shapes, 2);
+
+		if (shape == ShapeType::AABB) {
+			ImGui::DragFloat3("Size", glm::value_ptr(size), 0.1f, 0.0f);
+		}
+		else {
+			ImGui::DragFloat("Radius", &radius, 0.1f, 0.0f);
+		}
+
+		ImGui::InputInt("Layer", &layer);
+		ImGui::InputInt("Mask", &mask);
+	}
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+namespace neu {
+	/// <summary>
+	/// Collision shape attached to an actor, consumed by CollisionSystem.
+	///
+	/// Supports an axis-aligned box or a sphere centered on the owner's
+	/// transform. The layer/mask pair filters which colliders interact:
+	/// layer is the bit this collider occupies, mask selects the layers it
+	/// responds to - a pair collides only if each collider's mask accepts
+	/// the other's layer.
+	/// </summary>
+	class ColliderComponent : public Component {
+	public:
+		enum ShapeType {
+			AABB,
+			Sphere
+		};
+	public:
+		CLASS_PROTOTYPE(ColliderComponent)
+
+		void Update(float dt) override;
+
+		void Read(const serial_data_t& value) override;
+		void UpdateGUI() override;
+
+		// world-space AABB enclosing the shape, used by the broadphase
+		// (rotated boxes widen to their enclosing axis-aligned box)
+		Bounds GetWorldBounds() const;
+
+		// exact shape-vs-shape test, used by the narrowphase on pairs that
+		// survive the broadphase
+		bool TestOverlap(const ColliderComponent& other) const;
+
+		// sphere radius scaled by the owner's largest axis scale
+		float GetWorldRadius() const;
+
+	public:
+		ShapeType shape = ShapeType::AABB;
+		glm::vec3 size{ 1, 1, 1 };	// box dimensions in local space
+		float radius{ 0.5f };		// sphere radius in local space
+
+		// collision filtering (see class comment)
+		int layer{ 1 };
+		int mask{ ~0 };
+	};
+}
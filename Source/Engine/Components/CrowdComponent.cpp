@@ -0,0 +1,309 @@
+#include "EnginePCH.h"
+#include "CrowdComponent.h"
+
+namespace neu {
+	FACTORY_REGISTER(CrowdComponent)
+
+	namespace {
+		// bone texture rides above the material's fixed units (0-6)
+		constexpr int kBoneMapUnit = 7;
+	}
+
+	CrowdComponent::~CrowdComponent()
+	{
+		if (m_paletteBuffer) glDeleteBuffers(1, &m_paletteBuffer);
+	}
+
+	void CrowdComponent::Update(float dt)
+	{
+		// playback time only - sampling and culling run against the pass
+		// context in Draw
+		m_time += dt;
+	}
+
+	void CrowdComponent::Draw(Renderer& renderer)
+	{
+		DrawCrowd(renderer, nullptr, nullptr);
+	}
+
+	void CrowdComponent::Draw(Renderer& renderer, const Frustum& frustum, const glm::vec3& viewPosition)
+	{
+		DrawCrowd(renderer, &frustum, &viewPosition);
+	}
+
+	void CrowdComponent::Initialize()
+	{
+		m_initialized = true;
+
+		// the bake is the one expensive step and survives rescatters - only
+		// count/placement parameters rebuild below
+		if (!m_animationTexture.IsCreated() && !m_animationTexture.Create(*model, bakeFps)) {
+			LOG_CAT_WARNING(Renderer, "Crowd model {} has no skinned clips to bake", model->name);
+			return;
+		}
+
+		m_instanceBuffer = StorageBuffer{};
+		m_instanceBuffer.Create(math::max(count, 1) * sizeof(InstanceData), 0);
+
+		m_skinned.clear();
+		m_skinned.resize(math::max(maxSkinned, 0));
+
+		Scatter();
+	}
+
+	void CrowdComponent::Scatter()
+	{
+		const auto& clips = model->GetClips();
+
+		m_instances.resize(math::max(count, 0));
+		for (auto& instance : m_instances) {
+			instance.position = {
+				random::getReal(-area.x * 0.5f, area.x * 0.5f),
+				0.0f,
+				random::getReal(-area.y * 0.5f, area.y * 0.5f)
+			};
+			instance.yaw = random::getReal(math::twoPi);
+			instance.scale = random::getReal(scaleRange.x, scaleRange.y);
+			instance.clip = random::getInt((int)clips.size());
+			instance.phase = random::getReal(math::max(clips[instance.clip].duration, 0.01f));
+			instance.tint = glm::mix(tintA, tintB, random::getReal<float>());
+		}
+
+		// placement indices just changed, promotions don't carry over
+		for (auto& slot : m_skinned) slot.instance = -1;
+	}
+
+	void CrowdComponent::DrawCrowd(Renderer& renderer, const Frustum* frustum, const glm::vec3* viewPosition)
+	{
+		if (!model || !material || !material->program) return;
+		if (!model->IsSkinned() || model->GetClips().empty()) return;
+
+		if (!m_initialized) Initialize();
+		if (!m_animationTexture.IsCreated()) return;
+
+		glm::mat4 world = owner->scene ? owner->scene->GetWorldMatrix(owner) : owner->transform.GetMatrix();
+
+		// cull once into scratch - the baked and promoted paths both read it
+		m_visible.clear();
+		const Bounds& modelBounds = model->GetBounds();
+		for (int index = 0; index < (int)m_instances.size(); index++) {
+			const Instance& instance = m_instances[index];
+			glm::mat4 matrix = world
+				* glm::translate(glm::mat4{ 1 }, instance.position)
+				* glm::rotate(glm::mat4{ 1 }, instance.yaw, glm::vec3{ 0, 1, 0 })
+				* glm::scale(glm::mat4{ 1 }, glm::vec3{ instance.scale });
+
+			if (frustum && !frustum->Intersects(modelBounds.Transformed(matrix))) continue;
+
+			glm::vec3 offset = viewPosition ? *viewPosition - glm::vec3(matrix[3]) : glm::vec3{ 0 };
+			m_visible.push_back({ index, matrix, glm::dot(offset, offset) });
+		}
+		if (m_visible.empty()) return;
+
+		// promote the nearest visible agents to real skinning - slots that
+		// keep their agent keep warm sampler cursors across frames
+		bool promote = viewPosition && skinnedMaterial && skinnedMaterial->program && !m_skinned.empty();
+		if (promote) {
+			frame_vector<int> nearSet;
+			float near2 = nearDistance * nearDistance;
+			for (int v = 0; v < (int)m_visible.size(); v++) {
+				if (m_visible[v].dist2 < near2) nearSet.push_back(v);
+			}
+			if (nearSet.size() > m_skinned.size()) {
+				std::partial_sort(nearSet.begin(), nearSet.begin() + m_skinned.size(), nearSet.end(),
+					[this](int a, int b) { return m_visible[a].dist2 < m_visible[b].dist2; });
+				nearSet.resize(m_skinned.size());
+			}
+
+			auto held = [&](int instance) {
+				for (int v : nearSet) {
+					if (m_visible[v].index == instance) return true;
+				}
+				return false;
+			};
+			for (auto& slot : m_skinned) {
+				if (slot.instance >= 0 && !held(slot.instance)) slot.instance = -1;
+			}
+
+			const auto& clips = model->GetClips();
+			const Skeleton& skeleton = model->GetSkeleton();
+			for (int v : nearSet) {
+				const Instance& instance = m_instances[m_visible[v].index];
+
+				SkinnedSlot* slot = nullptr;
+				for (auto& candidate : m_skinned) {
+					if (candidate.instance == m_visible[v].index) { slot = &candidate; break; }
+				}
+				if (!slot) {
+					for (auto& candidate : m_skinned) {
+						if (candidate.instance < 0) { slot = &candidate; break; }
+					}
+					if (!slot) continue;
+					slot->instance = m_visible[v].index;
+					slot->sampler.Reset(&clips[instance.clip]);
+				}
+
+				const AnimationClip& clip = clips[instance.clip];
+				float time = (clip.duration > 0) ? std::fmod(m_time + instance.phase, clip.duration) : 0.0f;
+				animation::SamplePalette(skeleton, slot->sampler, time, slot->palette);
+			}
+		}
+
+		// split the survivors: promoted agents draw individually below, the
+		// rest pack into this pass's instanced arrays
+		m_transforms.clear();
+		m_instanceData.clear();
+		frame_vector<int> skinnedDraws;
+		const auto& bakedClips = m_animationTexture.GetClips();
+		for (int v = 0; v < (int)m_visible.size(); v++) {
+			bool isPromoted = false;
+			if (promote) {
+				for (auto& slot : m_skinned) {
+					if (slot.instance == m_visible[v].index) { isPromoted = true; break; }
+				}
+			}
+			if (isPromoted) {
+				skinnedDraws.push_back(v);
+				continue;
+			}
+
+			const Instance& instance = m_instances[m_visible[v].index];
+			const auto& info = bakedClips[instance.clip];
+			m_transforms.push_back(m_visible[v].world);
+			m_instanceData.push_back({
+				{ (float)info.firstRow, (float)info.frameCount, info.fps, instance.phase * info.fps },
+				{ instance.tint, 0 }
+			});
+		}
+
+		// one instanced draw covers every baked agent - transforms through
+		// the shared instance-matrix attributes, animation params and tint
+		// through the SSBO, skinning from the bone texture
+		if (!m_transforms.empty()) {
+			material->Bind();
+			auto program = material->program;
+			program->SetUniform("u_time", m_time);
+			program->SetUniform("u_boneMap", kBoneMapUnit);
+			m_animationTexture.Bind(GL_TEXTURE0 + kBoneMapUnit);
+
+			m_instanceBuffer.Upload(m_instanceData.data(), m_instanceData.size() * sizeof(InstanceData));
+			model->SetInstanceData(m_transforms.data(), m_transforms.size());
+			model->DrawInstanced((GLsizei)m_transforms.size());
+		}
+
+		// promoted agents go through the regular skinned path - the palette
+		// SSBO orphans per draw, same scheme as the scene's shared palette
+		if (!skinnedDraws.empty()) {
+			skinnedMaterial->Bind();
+			auto program = skinnedMaterial->program;
+			for (int v : skinnedDraws) {
+				SkinnedSlot* slot = nullptr;
+				for (auto& candidate : m_skinned) {
+					if (candidate.instance == m_visible[v].index) { slot = &candidate; break; }
+				}
+				if (!slot || slot->palette.empty()) continue;
+
+				if (!m_paletteBuffer) glGenBuffers(1, &m_paletteBuffer);
+				glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_paletteBuffer);
+				glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(glm::mat4) * slot->palette.size(), slot->palette.data(), GL_DYNAMIC_DRAW);
+				glBindBufferBase(GL_SHADER_STORAGE_BUFFER, Program::skinPaletteBinding, m_paletteBuffer);
+				FrameStats::AddUpload(sizeof(glm::mat4) * slot->palette.size());
+
+				program->SetUniform("u_model", m_visible[v].world);
+				model->Draw(0, GL_TRIANGLES);
+			}
+		}
+	}
+
+	Bounds CrowdComponent::GetWorldBounds() const
+	{
+		glm::vec3 position = owner->scene ? glm::vec3(owner->scene->GetWorldMatrix(owner)[3]) : owner->transform.position;
+
+		// scatter extent padded by the model's own bounds at the largest
+		// instance scale - conservative, but crowds are ground-hugging so
+		// the slack is small
+		float pad = model ? glm::length(model->GetBounds().max - model->GetBounds().min) * 0.5f * scaleRange.y : 0.0f;
+		glm::vec3 extent{ area.x * 0.5f + pad, pad, area.y * 0.5f + pad };
+
+		Bounds bounds;
+		bounds.Encapsulate(position - extent);
+		bounds.Encapsulate(position + extent);
+		return bounds;
+	}
+
+	void CrowdComponent::Read(const serial_data_t& value)
+	{
+		Object::Read(value);
+
+		std::string name;
+		SERIAL_READ_NAME(value, "model", name);
+		model = Resources().Get<Model>(name);
+
+		name.clear();
+		SERIAL_READ_NAME(value, "material", name);
+		material = Resources().Get<Material>(name);
+
+		name.clear();
+		SERIAL_READ_NAME(value, "skinnedMaterial", name);
+		if (!name.empty()) skinnedMaterial = Resources().Get<Material>(name);
+
+		static const serial::FieldDescriptor kFields[] = {
+			SERIAL_FIELD(CrowdComponent, count),
+			SERIAL_FIELD(CrowdComponent, area),
+			SERIAL_FIELD(CrowdComponent, nearDistance),
+			SERIAL_FIELD(CrowdComponent, maxSkinned),
+			SERIAL_FIELD(CrowdComponent, bakeFps),
+			SERIAL_FIELD(CrowdComponent, scaleRange),
+			SERIAL_FIELD(CrowdComponent, tintA),
+			SERIAL_FIELD(CrowdComponent, tintB),
+		};
+		serial::ReadFields(value, this, typeId, kFields, std::size(kFields));
+	}
+
+	void CrowdComponent::WriteSnapshot(SnapshotWriter& writer)
+	{
+		// resource references travel by name - restore re-fetches through
+		// the resource manager; the scatter itself re-randomizes, which is
+		// the accepted cost of a checkpoint (crowds are set dressing)
+		writer.Write(model ? model->name : std::string{});
+		writer.Write(material ? material->name : std::string{});
+		writer.Write(skinnedMaterial ? skinnedMaterial->name : std::string{});
+	}
+
+	void CrowdComponent::ReadSnapshot(SnapshotReader& reader)
+	{
+		std::string modelName;
+		std::string materialName;
+		std::string skinnedName;
+		reader.Read(modelName);
+		reader.Read(materialName);
+		reader.Read(skinnedName);
+
+		if (!modelName.empty()) model = Resources().Get<Model>(modelName);
+		if (!materialName.empty()) material = Resources().Get<Material>(materialName);
+		if (!skinnedName.empty()) skinnedMaterial = Resources().Get<Material>(skinnedName);
+	}
+
+	void CrowdComponent::UpdateGUI()
+	{
+		ImGui::Text("Model: %s", model ? model->name.c_str() : "none");
+		ImGui::Text("Material: %s", material ? material->name.c_str() : "none");
+		ImGui::Text("Skinned material: %s", skinnedMaterial ? skinnedMaterial->name.c_str() : "none");
+		if (m_animationTexture.IsCreated()) {
+			ImGui::Text("Baked: %d joints, %zu clips @ %.0f fps", m_animationTexture.GetJointCount(), m_animationTexture.GetClips().size(), bakeFps);
+		}
+
+		ImGui::DragInt("Count", &count, 1, 0, 10000);
+		ImGui::DragFloat2("Area", &area.x, 0.5f, 0.0f, 1000.0f);
+		ImGui::DragFloat("Near distance", &nearDistance, 0.5f, 0.0f, 200.0f);
+		ImGui::DragInt("Max skinned", &maxSkinned, 1, 0, 64);
+		ImGui::DragFloat2("Scale range", &scaleRange.x, 0.01f, 0.1f, 10.0f);
+		ImGui::ColorEdit3("Tint A", &tintA.x);
+		ImGui::ColorEdit3("Tint B", &tintB.x);
+
+		// count and placement edits apply on rebuild; the bake is kept
+		if (ImGui::Button("Rescatter")) m_initialized = false;
+
+		ImGui::Separator();
+	}
+}
@@ -0,0 +1,115 @@
+#pragma once
+#include "RendererComponent.h"
+#include "Renderer/AnimationTexture.h"
+#include "Renderer/StorageBuffer.h"
+
+namespace neu {
+
+	// Background crowd: hundreds of animated characters from one skinned
+	// model, rendered as a single instanced draw. The model's clips bake
+	// once into a bone-matrix texture (AnimationTexture) and each instance
+	// carries a clip row range, playback phase and tint, so the crowd
+	// material's vertex shader skins from texture fetches - no per-draw
+	// palette uploads, no per-character draw calls.
+	//
+	// The instances nearest the camera promote to real CPU-sampled
+	// skinning through the optional skinned material, so foreground
+	// characters keep full interpolation quality while the rest ride the
+	// baked texture - the crowd's level-of-detail split. Promotion slots
+	// keep their sampler cursors while an instance stays near, so the
+	// linear key scan never restarts frame to frame.
+	//
+	// Per-instance world transforms ride the shared instance-matrix
+	// attributes (the same stream the Model+Material instanced batches
+	// use); clip row/frame count/fps/phase and tint sit in an SSBO on
+	// binding 0, indexed by gl_InstanceID. The bone texture binds on
+	// unit 7 as u_boneMap with u_time driving playback.
+	class CrowdComponent : public RendererComponent {
+	public:
+		CLASS_PROTOTYPE(CrowdComponent)
+
+		~CrowdComponent();
+
+		void Update(float dt) override;
+
+		// legacy entry point - no pass context, so every instance draws
+		// through the baked path with no culling or promotion
+		void Draw(Renderer& renderer) override;
+
+		// scene playback entry point: per-instance frustum culling plus
+		// near-agent promotion against the view position
+		void Draw(Renderer& renderer, const Frustum& frustum, const glm::vec3& viewPosition);
+
+		void Read(const serial_data_t& value) override;
+		void UpdateGUI() override;
+
+		void WriteSnapshot(SnapshotWriter& writer) override;
+		void ReadSnapshot(SnapshotReader& reader) override;
+
+		// scatter area grown by the model's own bounds, for pass culling
+		Bounds GetWorldBounds() const;
+
+	public:
+		res_t<Model> model;
+		res_t<Material> material;			// VAT program, skins from the bone texture
+		res_t<Material> skinnedMaterial;	// regular skinned program for promoted near agents
+
+		// crowd parameters, serialized
+		int count{ 100 };
+		glm::vec2 area{ 20, 20 };			// scatter extent around the owner, local XZ
+		float nearDistance{ 12 };			// instances closer than this may promote
+		int maxSkinned{ 8 };				// promotion cap per crowd
+		float bakeFps{ 30 };
+		glm::vec2 scaleRange{ 0.9f, 1.1f };
+		glm::vec3 tintA{ 1, 1, 1 };			// per-instance tint lerps between these
+		glm::vec3 tintB{ 1, 1, 1 };
+
+	private:
+		// matches the std430 layout the crowd material's vertex shader reads
+		struct InstanceData {
+			glm::vec4 anim;		// x first row, y frame count, z fps, w phase (frames)
+			glm::vec4 tint;		// rgb tint, w unused
+		};
+
+		struct Instance {
+			glm::vec3 position;	// local to the owner
+			float yaw;
+			float scale;
+			int clip;
+			float phase;		// playback offset, seconds
+			glm::vec3 tint;
+		};
+
+		// a promoted near agent - the slot tracks which instance it holds
+		// so an agent that stays near keeps warm sampler cursors
+		struct SkinnedSlot {
+			int instance{ -1 };
+			animation::ClipSampler sampler;
+			std::vector<glm::mat4> palette;
+		};
+
+		// instance that survived this pass's frustum cull
+		struct Visible {
+			int index;
+			glm::mat4 world;
+			float dist2;
+		};
+
+		void Initialize();
+		void Scatter();
+		void DrawCrowd(Renderer& renderer, const Frustum* frustum, const glm::vec3* viewPosition);
+
+		std::vector<Instance> m_instances;
+		AnimationTexture m_animationTexture;
+		StorageBuffer m_instanceBuffer;
+		std::vector<SkinnedSlot> m_skinned;
+		GLuint m_paletteBuffer{ 0 };
+		float m_time{ 0 };
+		bool m_initialized{ false };
+
+		// per-pass scratch, reused to keep playback allocation-free
+		std::vector<Visible> m_visible;
+		std::vector<glm::mat4> m_transforms;
+		std::vector<InstanceData> m_instanceData;
+	};
+}
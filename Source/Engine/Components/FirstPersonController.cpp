@@ -11,14 +11,29 @@ namespace neu {
 		pitch = euler.x;
 		yaw = euler.y;
 
+		// resolve action names to dense indices once - rebinding lives in
+		// the action map asset, not here
+		InputSystem& input = GetEngine().GetInput();
+		m_moveForward = input.GetActionIndex("move_forward");
+		m_moveBackward = input.GetActionIndex("move_backward");
+		m_moveLeft = input.GetActionIndex("move_left");
+		m_moveRight = input.GetActionIndex("move_right");
+		m_moveUp = input.GetActionIndex("move_up");
+		m_moveDown = input.GetActionIndex("move_down");
+		m_look = input.GetActionIndex("look");
+
 		return true;
 	}
 
 	void FirstPersonController::Update(float dt) {
+		// the frame's immutable input snapshot - safe to read from job
+		// system workers, and every query below is a bit test
+		const InputSystem::ActionSnapshot& input = GetEngine().GetInput().GetSnapshot();
+
 		// get camera rotation
-		if (GetEngine().GetInput().GetMouseButtonDown(InputSystem::MouseButton::Right))
+		if (input.GetDown(m_look))
 		{
-			glm::vec2 axis = GetEngine().GetInput().GetMouseDelta() * sensitivity;
+			glm::vec2 axis = input.mouseDelta * sensitivity;
 
 			yaw -= axis.x;
 			pitch -= axis.y;
@@ -31,12 +46,12 @@ namespace neu {
 		owner->transform.SetRotationQuat(q);
 
 		glm::vec3 direction{ 0 };
-		if (GetEngine().GetInput().GetKeyDown(SDL_SCANCODE_A)) direction -= owner->transform.Right();
-		if (GetEngine().GetInput().GetKeyDown(SDL_SCANCODE_D)) direction += owner->transform.Right();
-		if (GetEngine().GetInput().GetKeyDown(SDL_SCANCODE_E)) direction += owner->transform.Up();
-		if (GetEngine().GetInput().GetKeyDown(SDL_SCANCODE_Q)) direction -= owner->transform.Up();
-		if (GetEngine().GetInput().GetKeyDown(SDL_SCANCODE_W)) direction += owner->transform.Forward();
-		if (GetEngine().GetInput().GetKeyDown(SDL_SCANCODE_S)) direction -= owner->transform.Forward();;
+		if (input.GetDown(m_moveLeft)) direction -= owner->transform.Right();
+		if (input.GetDown(m_moveRight)) direction += owner->transform.Right();
+		if (input.GetDown(m_moveUp)) direction += owner->transform.Up();
+		if (input.GetDown(m_moveDown)) direction -= owner->transform.Up();
+		if (input.GetDown(m_moveForward)) direction += owner->transform.Forward();
+		if (input.GetDown(m_moveBackward)) direction -= owner->transform.Forward();
 
 		if (glm::length2(direction) > 0.0f) {
 			direction = glm::normalize(direction);
@@ -45,8 +60,11 @@ namespace neu {
 	}
 
 	void FirstPersonController::Read(const serial_data_t& value) {
-		SERIAL_READ(value, speed);
-		SERIAL_READ(value, sensitivity);
+		static const serial::FieldDescriptor kFields[] = {
+			SERIAL_FIELD(FirstPersonController, speed),
+			SERIAL_FIELD(FirstPersonController, sensitivity),
+		};
+		serial::ReadFields(value, this, typeId, kFields, std::size(kFields));
 	}
 
 	void FirstPersonController::UpdateGUI() {
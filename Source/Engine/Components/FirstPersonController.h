@@ -6,6 +6,9 @@ namespace neu {
 	public:
 		CLASS_PROTOTYPE(FirstPersonController)
 
+		// input response can't skip frames - opt out of update-rate LOD
+		FirstPersonController() { fullRateUpdate = true; }
+
 		bool Start() override;
 		void Update(float dt) override;
 
@@ -17,5 +20,16 @@ namespace neu {
 		float speed = 3; // movement speed
 		float yaw = 0;
 		float pitch = 0;
+
+	private:
+		// dense action indices resolved once at Start - Update reads the
+		// frame's immutable input snapshot by index, no name lookups
+		int m_moveForward{ -1 };
+		int m_moveBackward{ -1 };
+		int m_moveLeft{ -1 };
+		int m_moveRight{ -1 };
+		int m_moveUp{ -1 };
+		int m_moveDown{ -1 };
+		int m_look{ -1 };
 	};
 }
\ No newline at end of file
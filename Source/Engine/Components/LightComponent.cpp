@@ -21,6 +21,17 @@ namespace neu {
 		program.SetUniform(name + ".innerSpotAngle", glm::radians(innerSpotAngle));
 		program.SetUniform(name + ".shadowCaster", shadowCaster);
 	}
+	bool LightComponent::Affects(const Bounds& bounds) const
+	{
+		// directional lights reach everything; point and spot lights reach
+		// a range sphere around their position (the spot cone is widened to
+		// its bounding sphere, so the test is conservative, never wrong)
+		if (lightType == LightType::Directional) return true;
+
+		glm::vec3 closest = glm::clamp(owner->transform.position, bounds.min, bounds.max);
+		glm::vec3 delta = owner->transform.position - closest;
+		return glm::dot(delta, delta) <= range * range;
+	}
 	void LightComponent::Read(const serial_data_t& value)
 	{
 		std::string typeName;
@@ -29,12 +40,18 @@ namespace neu {
 		else if (equalsIgnoreCase(typeName, "directional")) lightType = LightType::Directional;
 		else if (equalsIgnoreCase(typeName, "spot")) lightType = LightType::Spot;
 
-		SERIAL_READ(value, color);
-		SERIAL_READ(value, intensity);
-		SERIAL_READ(value, range);
-		SERIAL_READ(value, outerSpotAngle);
-		SERIAL_READ(value, innerSpotAngle);
-		SERIAL_READ(value, shadowCaster);
+		// plain fields dispatch through the descriptor table in one pass
+		// over the document's members
+		static const serial::FieldDescriptor kFields[] = {
+			SERIAL_FIELD(LightComponent, color),
+			SERIAL_FIELD(LightComponent, intensity),
+			SERIAL_FIELD(LightComponent, range),
+			SERIAL_FIELD(LightComponent, outerSpotAngle),
+			SERIAL_FIELD(LightComponent, innerSpotAngle),
+			SERIAL_FIELD(LightComponent, shadowCaster),
+			SERIAL_FIELD(LightComponent, baked),
+		};
+		serial::ReadFields(value, this, typeId, kFields, std::size(kFields));
 	}
 	void LightComponent::UpdateGUI()
 	{
@@ -55,5 +72,6 @@ namespace neu {
 		}
 
 		ImGui::Checkbox("ShadowCaster", &shadowCaster);
+		ImGui::Checkbox("Baked", &baked);
 	}
 }
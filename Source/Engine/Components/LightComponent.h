@@ -15,6 +15,10 @@ namespace neu {
 		void Update(float dt) override;
 		void SetProgram(Program& program, const std::string& name, const glm::mat4& view);
 
+		// true when this light can contribute to geometry inside the world
+		// bounds - the reach test behind the per-draw light masks
+		bool Affects(const Bounds& bounds) const;
+
 		void Read(const serial_data_t& value) override;
 
 	public:
@@ -27,6 +31,10 @@ namespace neu {
 
 		bool shadowCaster{ false };
 
+		// baked lights contributed to a lightmap at cook time and are
+		// excluded from the runtime light set when the scene records
+		bool baked{ false };
+
 		// Inherited via GUI
 		void UpdateGUI() override;
 	};
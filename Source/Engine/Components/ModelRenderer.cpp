@@ -2,6 +2,15 @@
 #include "ModelRenderer.h"
 
 namespace neu {
+	namespace {
+		// screen-coverage thresholds: below kLodCoverage[i] a renderer at
+		// level i steps to a coarser one; the hysteresis factor widens the
+		// boundary into a dead band so a renderer straddling it can't
+		// flicker between levels
+		constexpr float kLodCoverage[] = { 0.2f, 0.08f, 0.03f };
+		constexpr float kLodHysteresis = 1.2f;
+	}
+
 	FACTORY_REGISTER(ModelRenderer)
 
 	void ModelRenderer::Update(float dt)
@@ -10,31 +19,95 @@ namespace neu {
 
 	void ModelRenderer::Draw(Renderer& renderer)
 	{
+		// instanced and static renderers are drawn in shared batches
+		if (instanced || isStatic) return;
+
 		if (material) {
 			material->Bind();
-			material->program->SetUniform("u_model", owner->transform.GetMatrix());
+			material->program->SetUniform("u_model", owner->scene ? owner->scene->GetWorldMatrix(owner) : owner->transform.GetMatrix());
 		}
-		glDepthMask(enableDepth);
-		glCullFace(cullFace);
+		GLState::SetDepthMask(enableDepth);
+		GLState::SetCullFace(cullFace);
 
 		if (model){
-			model->Draw(GL_TRIANGLES);
+			model->Draw(m_lod, GL_TRIANGLES);
 		}
-		
+
 	}
 
 	void ModelRenderer::DrawShadow(Renderer& renderer, Program& program)
 	{
-		program.SetUniform("u_model", owner->transform.GetMatrix());
-	
-		glDepthMask(enableDepth);
-		glCullFace(cullFace);
+		program.SetUniform("u_model", owner->scene ? owner->scene->GetWorldMatrix(owner) : owner->transform.GetMatrix());
+
+		GLState::SetDepthMask(enableDepth);
+		GLState::SetCullFace(cullFace);
 
 		if (model) {
-			model->Draw(GL_TRIANGLES);
+			model->Draw(m_lod, GL_TRIANGLES);
 		}
 	}
 
+	void ModelRenderer::Submit(DrawList& drawList, const glm::mat4& view, bool updateLod)
+	{
+		// instanced and static renderers are drawn in shared batches
+		if (instanced || isStatic) return;
+		if (!model) return;
+
+		uint32_t programId = 0;
+		uint32_t materialId = 0;
+		if (material) {
+			// fold the material pointer into 16 key bits - a collision only
+			// costs batching, playback binds from the record's actual material
+			materialId = (uint32_t)((uintptr_t)material.get() >> 4);
+			if (material->program) programId = (uint32_t)material->program->m_program;
+		}
+
+		float depth = -(view * glm::vec4(owner->transform.position, 1)).z;
+		if (updateLod) UpdateLod(depth);
+
+		drawList.Add(DrawList::MakeKey(programId, materialId, depth), this);
+	}
+
+	void ModelRenderer::UpdateLod(float viewDepth)
+	{
+		if (!model) return;
+
+		int maxLod = model->GetLodCount() - 1;
+		if (forcedLod >= 0) {
+			m_lod = math::min(forcedLod, maxLod);
+			return;
+		}
+
+		// approximate screen coverage - world bounds radius over view depth;
+		// capping the denominator at the radius pins close objects to LOD 0
+		Bounds bounds = GetWorldBounds();
+		float radius = glm::length(bounds.max - bounds.min) * 0.5f;
+		if (radius <= 0) return;
+
+		float coverage = radius / math::max(viewDepth, radius);
+
+		// the quality tier's LOD bias divides perceived coverage - lower
+		// tiers pull every transition closer without touching the chain
+		coverage /= math::max(Quality::GetLodBias(), 0.01f);
+
+		// step one level per frame, and only when coverage clears the
+		// boundary by the hysteresis margin - a renderer at rest never pops
+		maxLod = math::min(maxLod, (int)std::size(kLodCoverage));
+		m_lod = math::min(m_lod, maxLod);
+		if (m_lod < maxLod && coverage < kLodCoverage[m_lod] / kLodHysteresis) m_lod++;
+		else if (m_lod > 0 && coverage > kLodCoverage[m_lod - 1] * kLodHysteresis) m_lod--;
+	}
+
+	Bounds ModelRenderer::GetWorldBounds() const
+	{
+		if (!model) return Bounds{};
+
+		// cached world matrix once the owner is in a scene, direct compute
+		// before that (e.g. bounds queried during load)
+		glm::mat4 matrix = owner->scene ? owner->scene->GetWorldMatrix(owner) : owner->transform.GetMatrix();
+		return model->GetBounds().Transformed(matrix);
+	}
+
 	void ModelRenderer::Read(const serial_data_t& value)
 	{
 		Object::Read(value);
@@ -49,13 +122,39 @@ namespace neu {
 
 		material = Resources().Get<Material>(materialName);
 
-		SERIAL_READ(value, enableDepth);
+		static const serial::FieldDescriptor kFields[] = {
+			SERIAL_FIELD(ModelRenderer, enableDepth),
+			SERIAL_FIELD(ModelRenderer, instanced),
+			SERIAL_FIELD(ModelRenderer, isStatic),
+		};
+		serial::ReadFields(value, this, typeId, kFields, std::size(kFields));
 
 		std::string cullFaceName;
 		SERIAL_READ_NAME(value, "cullFace", cullFaceName);
 		if (equalsIgnoreCase(cullFaceName, "front")) cullFace = GL_FRONT;
 	}
 
+	void ModelRenderer::WriteSnapshot(SnapshotWriter& writer)
+	{
+		// resource references travel by name - restore re-fetches through
+		// the resource manager, which hands back the already-loaded instance
+		writer.Write(model ? model->name : std::string{});
+		writer.Write(material ? material->name : std::string{});
+		writer.Write(cullFace);
+	}
+
+	void ModelRenderer::ReadSnapshot(SnapshotReader& reader)
+	{
+		std::string modelName;
+		std::string materialName;
+		reader.Read(modelName);
+		reader.Read(materialName);
+		reader.Read(cullFace);
+
+		if (!modelName.empty()) model = Resources().Get<Model>(modelName);
+		if (!materialName.empty()) material = Resources().Get<Material>(materialName);
+	}
+
 	void ModelRenderer::UpdateGUI()
 	{
 		std::string text;
@@ -63,13 +162,21 @@ namespace neu {
 		
 		text = (model) ? model->name : "none";
 		ImGui::Text("Model: %s", text.c_str());
+		ImGui::Text("LOD: %d / %d", m_lod, model ? model->GetLodCount() - 1 : 0);
 		Editor::GetDialogResource<Model>(model, "ModelDialog", "Open model", "Model file (*.obj;*.fbx;*.glb){.obj,.fbx,.glb},.*");
 		
 
 
 		text = (material) ? material->name : "none";
 		ImGui::Text("Material: %s", text.c_str());
-		Editor::GetDialogResource<Material>(material, "MaterialDialog", "Open Material", "Material file (*.mat){.mat},.*");
+		// a material swap can change the program - keep the scene's
+		// incremental distinct-program set in step
+		Program* previousProgram = (material) ? material->program.get() : nullptr;
+		if (Editor::GetDialogResource<Material>(material, "MaterialDialog", "Open Material", "Material file (*.mat){.mat},.*") && owner->scene)
+		{
+			owner->scene->RemoveProgramRef(previousProgram);
+			owner->scene->AddProgramRef((material) ? material->program.get() : nullptr);
+		}
 		ImGui::Separator();
 
 	}
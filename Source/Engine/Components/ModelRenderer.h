@@ -13,11 +13,47 @@ namespace neu {
 		void Read(const serial_data_t& value) override;
 		void UpdateGUI() override;
 
+		// checkpoint capture of the resource references and the named enum
+		// the field table can't carry - model/material travel by name
+		void WriteSnapshot(SnapshotWriter& writer) override;
+		void ReadSnapshot(SnapshotReader& reader) override;
+
+		// model bounds transformed into world space by the owner's transform,
+		// used by Scene for frustum culling
+		Bounds GetWorldBounds() const;
+
+		// appends a sort-keyed draw record for this renderer - program and
+		// material bits group state, view-space depth orders front to back.
+		// updateLod steps the LOD selection from this view's depth; shadow
+		// passes submit with it off so they reuse the main camera's level
+		void Submit(DrawList& drawList, const glm::mat4& view, bool updateLod = true);
+
+		// detail level the playback draws this renderer's model at, chosen
+		// from screen coverage with hysteresis in UpdateLod
+		int GetLod() const { return m_lod; }
+		void UpdateLod(float viewDepth);
+
 	public:
 		res_t<Model> model;
 		res_t<Material> material;
 
 		bool enableDepth{ true };
 		GLint cullFace{ GL_BACK };
+
+		// instanced renderers are skipped by the per-actor draw and collected
+		// into shared Model+Material batches by Scene::DrawPass
+		bool instanced{ false };
+
+		// static (non-moving) renderers are merged per material into shared
+		// buffers by StaticBatcher and drawn with one indirect call - the
+		// material's program must read the instance matrix attribute
+		bool isStatic{ false };
+
+		// editor debug override - 0 or higher forces every renderer to that
+		// LOD level, -1 restores distance-based selection
+		inline static int forcedLod{ -1 };
+
+	private:
+		int m_lod{ 0 };
 	};
 }
\ No newline at end of file
@@ -0,0 +1,222 @@
+#include "EnginePCH.h"
+#include "ParticleSystemComponent.h"
+
+namespace neu {
+	FACTORY_REGISTER(ParticleSystemComponent)
+
+	ParticleSystemComponent::~ParticleSystemComponent()
+	{
+		if (m_vao) {
+			GLState::InvalidateVertexArray(m_vao);
+			glDeleteVertexArrays(1, &m_vao);
+		}
+	}
+
+	void ParticleSystemComponent::Update(float dt)
+	{
+		// simulation runs on the GL thread in Draw - the update just banks
+		// the frame's step (fixed-step mode may run several per draw)
+		m_dt += dt;
+	}
+
+	void ParticleSystemComponent::Draw(Renderer& renderer)
+	{
+		if (!material || !material->program) return;
+
+		if (!s_simProgramChecked) {
+			s_simProgramChecked = true;
+			s_simProgram = Resources().Get<Program>("Shaders/particle_sim.prog");
+			if (s_simProgram && !s_simProgram->IsCompute()) s_simProgram = nullptr;
+		}
+
+		if (!m_initialized) {
+			m_initialized = true;
+
+			// every slot starts dead (zero remaining life) and respawns as
+			// the emit budget allows
+			std::vector<Particle> seed(maxParticles, Particle{ glm::vec4{ 0 }, glm::vec4{ 0 } });
+			if (s_simProgram) {
+				// device-local state the simulation dispatch owns outright
+				m_particleBuffer.CreateStatic(seed.data(), maxParticles * sizeof(Particle), 0);
+			}
+			else {
+				m_particles = std::move(seed);
+				m_particleBuffer.Create(maxParticles * sizeof(Particle), 0);
+			}
+
+			// attribute-less draw - the vertex shader pulls everything from
+			// the particle buffer, but core GL still wants a VAO bound
+			if (!m_vao) glGenVertexArrays(1, &m_vao);
+		}
+
+		float dt = std::exchange(m_dt, 0.0f);
+		glm::vec3 position = owner->scene ? glm::vec3(owner->scene->GetWorldMatrix(owner)[3]) : owner->transform.position;
+
+		// whole-frame emit budget, the fraction carries to the next frame
+		// the quality tier's particle density scales every emitter's spawn
+		// rate; the buffers stay at authored capacity, slots just recycle
+		// slower on lower tiers
+		m_emitAccumulator += rate * Quality::GetParticleDensity() * dt;
+		int emitCount = (int)m_emitAccumulator;
+		m_emitAccumulator -= emitCount;
+
+		if (s_simProgram) {
+			s_simProgram->Use();
+			s_simProgram->SetUniform("u_dt", dt);
+			s_simProgram->SetUniform("u_particleCount", maxParticles);
+			s_simProgram->SetUniform("u_emitCount", emitCount);
+
+			// the emit window walks the buffer as a ring - advancing the
+			// cursor by each frame's budget means the window always covers
+			// the oldest slots, so the shader respawns exactly the budget
+			// without any cross-thread counting
+			s_simProgram->SetUniform("u_emitBase", m_emitBase);
+			if (maxParticles > 0) m_emitBase = (m_emitBase + emitCount) % maxParticles;
+
+			s_simProgram->SetUniform("u_position", position);
+			s_simProgram->SetUniform("u_direction", owner->transform.Forward());
+			s_simProgram->SetUniform("u_spread", spread);
+			s_simProgram->SetUniform("u_speed", speed);
+			s_simProgram->SetUniform("u_lifetime", lifetime);
+			s_simProgram->SetUniform("u_gravity", gravity);
+			s_simProgram->SetUniform("u_seed", random::getReal<float>());
+
+			m_particleBuffer.Bind();
+			s_simProgram->Dispatch(maxParticles);
+
+			// the stepped state must land before the draw's vertex pull
+			Program::BarrierStorage();
+		}
+		else {
+			Simulate(dt, emitCount, position);
+		}
+
+		// one instanced draw - per-particle quads expand in the vertex
+		// shader, fading size/color/alpha over each particle's age
+		material->Bind();
+		auto program = material->program;
+		program->SetUniform("u_startSize", startSize);
+		program->SetUniform("u_endSize", endSize);
+		program->SetUniform("u_startColor", startColor);
+		program->SetUniform("u_endColor", endColor);
+		program->SetUniform("u_startAlpha", startAlpha);
+		program->SetUniform("u_endAlpha", endAlpha);
+
+		m_particleBuffer.Bind();
+
+		// blended over the shaded result with depth writes off, same as the
+		// transparent queue - dead slots render zero-sized and cost nothing
+		GLState::SetBlend(true);
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		GLState::SetDepthMask(false);
+
+		GLState::BindVertexArray(m_vao);
+		glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, maxParticles);
+
+		GLState::SetDepthMask(true);
+		GLState::SetBlend(false);
+	}
+
+	void ParticleSystemComponent::Simulate(float dt, int emitCount, const glm::vec3& position)
+	{
+		// integrate every slot in one flat pass - dead slots integrate too,
+		// which keeps the loop branchless and lets the compiler vectorize
+		for (auto& particle : m_particles) {
+			particle.position.w -= dt;
+			particle.velocity.x += gravity.x * dt;
+			particle.velocity.y += gravity.y * dt;
+			particle.velocity.z += gravity.z * dt;
+			particle.position.x += particle.velocity.x * dt;
+			particle.position.y += particle.velocity.y * dt;
+			particle.position.z += particle.velocity.z * dt;
+		}
+
+		// respawn expired slots up to the frame's budget
+		if (emitCount > 0) {
+			// draw the burst's randomness in one batch up front - scatter
+			// xyz per spawn plus a speed jitter, from frame-arena scratch
+			frame_vector<float> scatterDraws(emitCount * 3);
+			frame_vector<float> speedDraws(emitCount);
+			random::fill(scatterDraws.data(), scatterDraws.size(), -1.0f, 1.0f);
+			random::fill(speedDraws.data(), speedDraws.size(), 0.5f, 1.0f);
+
+			glm::vec3 direction = owner->transform.Forward();
+			int spawned = 0;
+			for (auto& particle : m_particles) {
+				if (particle.position.w > 0) continue;
+
+				// random direction blended toward the emitter's forward by
+				// the spread cone
+				glm::vec3 scatter{
+					scatterDraws[spawned * 3 + 0],
+					scatterDraws[spawned * 3 + 1],
+					scatterDraws[spawned * 3 + 2]
+				};
+				float length = glm::length(scatter);
+				if (length > 0) scatter /= length;
+
+				glm::vec3 launch = glm::normalize(glm::mix(direction, scatter, spread));
+				particle.position = glm::vec4(position, lifetime);
+				particle.velocity = glm::vec4(launch * speed * speedDraws[spawned], lifetime);
+
+				if (++spawned == emitCount) break;
+			}
+		}
+
+		m_particleBuffer.Upload(m_particles.data(), m_particles.size() * sizeof(Particle));
+	}
+
+	Bounds ParticleSystemComponent::GetWorldBounds() const
+	{
+		glm::vec3 position = owner->scene ? glm::vec3(owner->scene->GetWorldMatrix(owner)[3]) : owner->transform.position;
+
+		// furthest a particle can drift: launch distance plus gravity fall
+		// over a full lifetime, padded by the largest quad size
+		float drift = speed * lifetime + 0.5f * glm::length(gravity) * lifetime * lifetime + math::max(startSize, endSize);
+
+		Bounds bounds;
+		bounds.Encapsulate(position - glm::vec3{ drift });
+		bounds.Encapsulate(position + glm::vec3{ drift });
+		return bounds;
+	}
+
+	void ParticleSystemComponent::Read(const serial_data_t& value)
+	{
+		Object::Read(value);
+
+		std::string materialName;
+		SERIAL_READ_NAME(value, "material", materialName);
+		material = Resources().Get<Material>(materialName);
+
+		SERIAL_READ(value, maxParticles);
+		SERIAL_READ(value, rate);
+		SERIAL_READ(value, lifetime);
+		SERIAL_READ(value, speed);
+		SERIAL_READ(value, spread);
+		SERIAL_READ(value, gravity);
+		SERIAL_READ(value, startSize);
+		SERIAL_READ(value, endSize);
+		SERIAL_READ(value, startColor);
+		SERIAL_READ(value, endColor);
+		SERIAL_READ(value, startAlpha);
+		SERIAL_READ(value, endAlpha);
+	}
+
+	void ParticleSystemComponent::UpdateGUI()
+	{
+		ImGui::Text("Material: %s", material ? material->name.c_str() : "none");
+		ImGui::Text("Simulation: %s (%d particles)", s_simProgram ? "GPU" : "CPU", maxParticles);
+		ImGui::DragFloat("Rate", &rate, 1.0f, 0.0f, 100000.0f);
+		ImGui::DragFloat("Lifetime", &lifetime, 0.1f, 0.1f, 60.0f);
+		ImGui::DragFloat("Speed", &speed, 0.1f, 0.0f, 100.0f);
+		ImGui::SliderFloat("Spread", &spread, 0.0f, 1.0f);
+		ImGui::DragFloat3("Gravity", &gravity.x, 0.1f);
+		ImGui::DragFloat("Start size", &startSize, 0.01f, 0.0f, 10.0f);
+		ImGui::DragFloat("End size", &endSize, 0.01f, 0.0f, 10.0f);
+		ImGui::ColorEdit3("Start color", &startColor.x);
+		ImGui::ColorEdit3("End color", &endColor.x);
+		ImGui::SliderFloat("Start alpha", &startAlpha, 0.0f, 1.0f);
+		ImGui::SliderFloat("End alpha", &endAlpha, 0.0f, 1.0f);
+		ImGui::Separator();
+	}
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include "RendererComponent.h"
+#include "Renderer/StorageBuffer.h"
+
+namespace neu {
+
+	// GPU-simulated particle emitter: one compute dispatch steps every
+	// particle and one instanced draw renders them, so particle count never
+	// touches the actor update loop or the draw call budget.
+	//
+	// Particle state (position/life, velocity/lifetime) lives in an SSBO on
+	// binding 0. The shared simulation program ("Shaders/particle_sim.prog")
+	// integrates live slots and respawns up to the frame's emit budget from
+	// the emitter uniforms; the material's vertex shader pulls a camera-
+	// facing quad per instance from the same buffer and fades size/color
+	// over each particle's age (soft depth fade is the material shader's
+	// concern). Without the simulation asset a CPU fallback steps the same
+	// state in one flat pass over contiguous data - branch-light arithmetic
+	// the compiler vectorizes - and streams it through the persistent-
+	// mapped ring.
+	class ParticleSystemComponent : public RendererComponent {
+	public:
+		CLASS_PROTOTYPE(ParticleSystemComponent)
+
+		~ParticleSystemComponent();
+
+		void Update(float dt) override;
+		void Draw(Renderer& renderer) override;
+		void Read(const serial_data_t& value) override;
+		void UpdateGUI() override;
+
+		// conservative emitter bounds for frustum culling - the spawn point
+		// grown by the furthest a particle can drift over its lifetime
+		Bounds GetWorldBounds() const;
+
+	public:
+		res_t<Material> material;
+
+		// emitter parameters, serialized
+		int maxParticles{ 1024 };
+		float rate{ 100 };				// particles spawned per second
+		float lifetime{ 2 };
+		float speed{ 3 };
+		float spread{ 0.25f };			// direction cone, 0 = tight beam, 1 = sphere
+		glm::vec3 gravity{ 0, -9.8f, 0 };
+		float startSize{ 0.1f };
+		float endSize{ 0 };
+		glm::vec3 startColor{ 1, 1, 1 };
+		glm::vec3 endColor{ 1, 1, 1 };
+		float startAlpha{ 1 };
+		float endAlpha{ 0 };
+
+	private:
+		// matches the std430 layout the simulation and material shaders read
+		struct Particle {
+			glm::vec4 position;		// xyz position, w remaining life
+			glm::vec4 velocity;		// xyz velocity, w total lifetime
+		};
+
+		// CPU fallback: integrate, respawn the frame's emit budget, stream
+		void Simulate(float dt, int emitCount, const glm::vec3& position);
+
+		// particle state - the GPU path keeps it device-local, the fallback
+		// mirrors it here and uploads each frame
+		StorageBuffer m_particleBuffer;
+		std::vector<Particle> m_particles;
+
+		GLuint m_vao{ 0 };
+		float m_dt{ 0 };				// banked update time, consumed by Draw
+		float m_emitAccumulator{ 0 };
+		int m_emitBase{ 0 };			// GPU emit ring cursor, see Draw
+		bool m_initialized{ false };
+
+		// simulation program shared by every emitter, fetched once - null
+		// (missing asset) selects the CPU fallback
+		inline static res_t<Program> s_simProgram;
+		inline static bool s_simProgramChecked{ false };
+	};
+}
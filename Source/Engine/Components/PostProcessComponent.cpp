@@ -17,11 +17,44 @@ namespace neu {
 
 	void PostProcessComponent::Read(const serial_data_t& value) {
 		Object::Read(value);
+
+		// ordered effect chain - each entry names its fullscreen program and
+		// may opt into half-resolution execution
+		if (SERIAL_CONTAINS(value, effects)) {
+			for (auto& effectValue : SERIAL_AT(value, effects).GetArray()) {
+				Effect effect;
+				SERIAL_READ_NAME(effectValue, "name", effect.name);
+				SERIAL_READ_NAME(effectValue, "enabled", effect.enabled);
+				SERIAL_READ_NAME(effectValue, "halfResolution", effect.halfResolution);
+
+				std::string programName;
+				SERIAL_READ_NAME(effectValue, "program", programName);
+				if (!programName.empty()) effect.program = Resources().Get<Program>(programName);
+				if (effect.name.empty()) effect.name = programName;
+
+				effects.push_back(std::move(effect));
+			}
+		}
+
+		// no declared chain - a single pass through the stock program keeps
+		// older scenes rendering
+		if (effects.empty()) {
+			Effect effect;
+			effect.name = "postprocess";
+			effect.program = Resources().Get<Program>("Shaders/postprocess.prog");
+			effects.push_back(std::move(effect));
+		}
 	}
 
 	void PostProcessComponent::UpdateGUI() {
 		ImGui::Text("Post Process");
 
+		// per-effect enables for the chain
+		for (auto& effect : effects) {
+			ImGui::Checkbox(effect.name.c_str(), &effect.enabled);
+		}
+		ImGui::Separator();
+
 		auto toggle = [&](Parameters flag, const char* label) {
 			bool enabled = (static_cast<uint32_t>(parameters) & static_cast<uint32_t>(flag)) != 0;
 			if (ImGui::Checkbox(label, &enabled)) {
@@ -13,6 +13,19 @@ namespace neu {
 			Distort		= (1 << 5)
 		};
 
+		/// <summary>
+		/// One entry in the ordered effect chain, executed by the renderer's
+		/// PostProcessPipeline. Each effect runs its own fullscreen program
+		/// over the previous effect's output; expensive effects (blurs) can
+		/// opt into half-resolution execution.
+		/// </summary>
+		struct Effect {
+			std::string name;
+			res_t<Program> program;
+			bool enabled{ true };
+			bool halfResolution{ false };
+		};
+
 	public:
 		CLASS_PROTOTYPE(PostProcessComponent)
 
@@ -23,6 +36,10 @@ namespace neu {
 		void UpdateGUI() override;
 
 	public:
+		// ordered effect chain, from serialized data - defaults to a single
+		// pass through the stock postprocess program when none is declared
+		std::vector<Effect> effects;
+
 		Parameters parameters = Parameters::None;
 		glm::vec3 colorTint{ 1,1,1 };
 		float blend{ 1.0f };
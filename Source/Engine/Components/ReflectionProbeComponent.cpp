@@ -0,0 +1,133 @@
+#include "EnginePCH.h"
+
+namespace neu {
+	// pooled probe capture target - cubemap color plane, shared depth
+	// renderbuffer and a framebuffer kept for the target's whole pooled
+	// lifetime, same scheme as RenderTargetPool. Probes hold their target
+	// until destroyed, then it goes back for the next probe of that size
+	struct ProbeTarget {
+		GLuint cubemap{ 0 };
+		GLuint depth{ 0 };
+		GLuint fbo{ 0 };
+		int size{ 0 };
+		bool acquired{ false };
+	};
+
+	namespace {
+		std::vector<std::unique_ptr<ProbeTarget>> probeTargets;
+
+		ProbeTarget* AcquireProbeTarget(int size) {
+			for (auto& target : probeTargets) {
+				if (!target->acquired && target->size == size) {
+					target->acquired = true;
+					return target.get();
+				}
+			}
+
+			auto target = std::make_unique<ProbeTarget>();
+			target->size = size;
+			target->acquired = true;
+
+			glGenTextures(1, &target->cubemap);
+			GLState::BindTexture(GL_TEXTURE_CUBE_MAP, target->cubemap);
+			for (int face = 0; face < 6; face++) {
+				glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, GL_RGB8, size, size, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+			}
+			glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+			glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+			glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+
+			glGenRenderbuffers(1, &target->depth);
+			glBindRenderbuffer(GL_RENDERBUFFER, target->depth);
+			glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size, size);
+			glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+			glGenFramebuffers(1, &target->fbo);
+			glBindFramebuffer(GL_FRAMEBUFFER, target->fbo);
+			glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, target->depth);
+			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+			probeTargets.push_back(std::move(target));
+			return probeTargets.back().get();
+		}
+
+		void ReleaseProbeTarget(ProbeTarget* target) {
+			if (target) target->acquired = false;
+		}
+	}
+
+	FACTORY_REGISTER(ReflectionProbeComponent)
+
+	ReflectionProbeComponent::~ReflectionProbeComponent() {
+		ReleaseProbeTarget(m_target);
+	}
+
+	GLuint ReflectionProbeComponent::GetCubeMap() const {
+		return (m_captured && m_target) ? m_target->cubemap : 0;
+	}
+
+	bool ReflectionProbeComponent::BeginCaptureFace(int face) {
+		// a resolution edit re-acquires at the new size
+		if (m_target && m_target->size != resolution) {
+			ReleaseProbeTarget(m_target);
+			m_target = nullptr;
+		}
+		if (!m_target) m_target = AcquireProbeTarget(resolution);
+		if (!m_target) return false;
+
+		glBindFramebuffer(GL_FRAMEBUFFER, m_target->fbo);
+		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, m_target->cubemap, 0);
+		glViewport(0, 0, m_target->size, m_target->size);
+
+		GLState::SetDepthMask(true);
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+		return true;
+	}
+
+	void ReflectionProbeComponent::EndCapture() {
+		if (!m_target) return;
+
+		// GPU prefilter: build the mip chain over the captured faces, so
+		// roughness-indexed textureLod reads get progressively blurrier
+		// environments without any CPU readback
+		GLState::BindTexture(GL_TEXTURE_CUBE_MAP, m_target->cubemap);
+		glGenerateMipmap(GL_TEXTURE_CUBE_MAP);
+
+		m_captured = true;
+	}
+
+	glm::mat4 ReflectionProbeComponent::GetFaceView(int face) const {
+		// standard cube capture rig: forward/up pairs per GL face order
+		static const glm::vec3 forward[] = {
+			{  1,  0,  0 }, { -1,  0,  0 },
+			{  0,  1,  0 }, {  0, -1,  0 },
+			{  0,  0,  1 }, {  0,  0, -1 }
+		};
+		static const glm::vec3 up[] = {
+			{ 0, -1,  0 }, { 0, -1,  0 },
+			{ 0,  0,  1 }, { 0,  0, -1 },
+			{ 0, -1,  0 }, { 0, -1,  0 }
+		};
+
+		glm::vec3 position = owner ? owner->transform.position : glm::vec3{ 0 };
+		return glm::lookAt(position, position + forward[face], up[face]);
+	}
+
+	void ReflectionProbeComponent::Read(const serial_data_t& value) {
+		static const serial::FieldDescriptor kFields[] = {
+			SERIAL_FIELD(ReflectionProbeComponent, resolution),
+			SERIAL_FIELD(ReflectionProbeComponent, radius),
+		};
+		serial::ReadFields(value, this, typeId, kFields, std::size(kFields));
+	}
+
+	void ReflectionProbeComponent::UpdateGUI() {
+		ImGui::Text("Captured: %s", m_captured ? "yes" : "pending");
+		if (ImGui::DragInt("Resolution", &resolution, 1.0f, 16, 1024)) Invalidate();
+		ImGui::DragFloat("Radius", &radius, 0.1f, 0.0f);
+		if (ImGui::Button("Recapture")) Invalidate();
+	}
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+namespace neu {
+	struct ProbeTarget;
+
+	/// <summary>
+	/// Placed reflection capture point.
+	///
+	/// The scene renders the six faces of a probe once - on load, or again
+	/// after Invalidate() - into a pooled cubemap target through the normal
+	/// record/playback path, then prefilters the result on the GPU. Model
+	/// renderers whose material samples a cube map bind the nearest captured
+	/// probe in place of the authored map at playback, so reflections match
+	/// the surroundings at a one-time capture cost instead of a per-frame
+	/// re-render.
+	/// </summary>
+	class ReflectionProbeComponent : public Component {
+	public:
+		CLASS_PROTOTYPE(ReflectionProbeComponent)
+
+		ReflectionProbeComponent() = default;
+		// the pooled target and capture state stay with the original - a
+		// clone captures fresh at its own position
+		ReflectionProbeComponent(const ReflectionProbeComponent& other) :
+			Component{ other },
+			resolution{ other.resolution },
+			radius{ other.radius }
+		{}
+		~ReflectionProbeComponent();
+
+		void Update(float dt) override {}
+
+		void Read(const serial_data_t& value) override;
+		void UpdateGUI() override;
+
+		bool IsCaptured() const { return m_captured; }
+
+		/// <summary>
+		/// Queues a re-capture - the scene re-renders the probe on an
+		/// upcoming frame; the old capture keeps serving until then.
+		/// </summary>
+		void Invalidate() { m_captured = false; }
+
+		/// <summary>
+		/// The captured cube texture, 0 until the first capture lands.
+		/// </summary>
+		GLuint GetCubeMap() const;
+
+		/// <summary>
+		/// Binds the pooled target's framebuffer at the given face, acquiring
+		/// the target on first use. The scene plays the face's pass back
+		/// between this and EndCapture().
+		/// </summary>
+		/// <param name="face">Cube face index, +X -X +Y -Y +Z -Z order</param>
+		/// <returns>false when no pooled target could be acquired</returns>
+		bool BeginCaptureFace(int face);
+
+		/// <summary>
+		/// Finishes a capture: prefilters the faces into the mip chain on
+		/// the GPU and marks the probe captured.
+		/// </summary>
+		void EndCapture();
+
+		/// <summary>
+		/// View matrix looking out of the probe through the given face.
+		/// </summary>
+		glm::mat4 GetFaceView(int face) const;
+
+	public:
+		int resolution{ 128 };
+
+		// world-space influence radius - renderers outside it ignore the probe
+		float radius{ 25 };
+
+	private:
+		ProbeTarget* m_target{ nullptr };
+		bool m_captured{ false };
+	};
+}
@@ -2,14 +2,32 @@
 
 namespace neu {
 	FACTORY_REGISTER(RotationComponent)
+	BATCH_UPDATE_REGISTER(RotationComponent)
 
 	void RotationComponent::Update(float dt) {
 		glm::quat q = owner->transform.rotationq * glm::quat{ glm::radians(rotate * dt) };
 		owner->transform.SetRotationQuat(q);
 	}
 
+	void RotationComponent::UpdateBatch(const std::vector<Component*>& components, float dt) {
+		// one flat pass, no virtual dispatch - the instances come from
+		// ComponentPool slabs, so this walks mostly-contiguous memory. The
+		// active/destroyed checks the per-actor loop would have made move
+		// in here
+		for (auto component : components) {
+			auto rotation = static_cast<RotationComponent*>(component);
+			if (!rotation->active || !rotation->owner->active || rotation->owner->destroyed) continue;
+
+			Transform& transform = rotation->owner->transform;
+			transform.SetRotationQuat(transform.rotationq * glm::quat{ glm::radians(rotation->rotate * dt) });
+		}
+	}
+
 	void RotationComponent::Read(const serial_data_t& value) {
-		SERIAL_READ(value, rotate);
+		static const serial::FieldDescriptor kFields[] = {
+			SERIAL_FIELD(RotationComponent, rotate),
+		};
+		serial::ReadFields(value, this, typeId, kFields, std::size(kFields));
 	}
 
 	void RotationComponent::UpdateGUI() {
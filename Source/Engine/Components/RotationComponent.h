@@ -7,6 +7,11 @@ namespace neu {
 
 		void Update(float dt);
 
+		// batch path - updates every live instance over the scene's typed
+		// registry slice in one call (registered via BATCH_UPDATE_REGISTER,
+		// so the per-actor loop skips instances of this type)
+		static void UpdateBatch(const std::vector<Component*>& components, float dt);
+
 		void Read(const serial_data_t& value) override;
 		void UpdateGUI() override;
 
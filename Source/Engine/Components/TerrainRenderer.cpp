@@ -0,0 +1,89 @@
+#include "EnginePCH.h"
+#include "TerrainRenderer.h"
+
+namespace neu {
+	FACTORY_REGISTER(TerrainRenderer)
+
+	void TerrainRenderer::Draw(Renderer& renderer, const Frustum& frustum, const glm::vec3& viewPosition)
+	{
+		if (!terrain) return;
+
+		glm::mat4 world = owner->scene ? owner->scene->GetWorldMatrix(owner) : owner->transform.GetMatrix();
+		terrain->Draw(world, frustum, viewPosition);
+	}
+
+	bool TerrainRenderer::GetHeight(const glm::vec3& worldPosition, float& height) const
+	{
+		if (!terrain) return false;
+
+		// query in terrain-local space, lift the result back to world
+		glm::mat4 world = owner->scene ? owner->scene->GetWorldMatrix(owner) : owner->transform.GetMatrix();
+		glm::vec3 local = glm::vec3(glm::inverse(world) * glm::vec4{ worldPosition, 1 });
+
+		float localHeight;
+		if (!terrain->GetHeight(local.x, local.z, localHeight)) return false;
+
+		height = (world * glm::vec4{ local.x, localHeight, local.z, 1 }).y;
+		return true;
+	}
+
+	bool TerrainRenderer::GetNormal(const glm::vec3& worldPosition, glm::vec3& normal) const
+	{
+		if (!terrain) return false;
+
+		glm::mat4 world = owner->scene ? owner->scene->GetWorldMatrix(owner) : owner->transform.GetMatrix();
+		glm::vec3 local = glm::vec3(glm::inverse(world) * glm::vec4{ worldPosition, 1 });
+
+		glm::vec3 localNormal;
+		if (!terrain->GetNormal(local.x, local.z, localNormal)) return false;
+
+		normal = glm::normalize(glm::vec3(glm::transpose(glm::inverse(world)) * glm::vec4{ localNormal, 0 }));
+		return true;
+	}
+
+	Bounds TerrainRenderer::GetWorldBounds() const
+	{
+		glm::mat4 world = owner->scene ? owner->scene->GetWorldMatrix(owner) : owner->transform.GetMatrix();
+
+		Bounds local;
+		if (terrain) {
+			float half = terrain->GetSize() * 0.5f;
+			local.Encapsulate(glm::vec3{ -half, 0, -half });
+			local.Encapsulate(glm::vec3{ half, terrain->GetHeightScale(), half });
+		}
+		return local.Transformed(world);
+	}
+
+	void TerrainRenderer::Read(const serial_data_t& value)
+	{
+		Object::Read(value);
+
+		std::string terrainName;
+		SERIAL_READ_NAME(value, "terrain", terrainName);
+		terrain = Resources().Get<Terrain>(terrainName);
+	}
+
+	void TerrainRenderer::WriteSnapshot(SnapshotWriter& writer)
+	{
+		// the resource travels by name - the heightfield and chunk cache
+		// belong to the shared Terrain, not the checkpoint
+		writer.Write(terrain ? terrain->name : std::string{});
+	}
+
+	void TerrainRenderer::ReadSnapshot(SnapshotReader& reader)
+	{
+		std::string terrainName;
+		reader.Read(terrainName);
+		if (!terrainName.empty()) terrain = Resources().Get<Terrain>(terrainName);
+	}
+
+	void TerrainRenderer::UpdateGUI()
+	{
+		ImGui::Text("Terrain: %s", terrain ? terrain->name.c_str() : "none");
+		if (terrain) {
+			ImGui::Text("Heightfield: %s", terrain->IsReady() ? "resident" : "streaming");
+			ImGui::Text("Chunks: %zu (%zu KB)", terrain->GetChunkCount(), terrain->GetChunkBytes() / 1024);
+		}
+		ImGui::Separator();
+	}
+}
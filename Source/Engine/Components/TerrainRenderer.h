@@ -0,0 +1,42 @@
+#pragma once
+#include "RendererComponent.h"
+#include "Renderer/Terrain.h"
+
+namespace neu {
+
+	// Places a Terrain resource in the scene. The terrain centers on the
+	// owner's transform; scene playback calls Draw per pass, where the
+	// terrain selects its quadtree node set against that pass's camera and
+	// streams chunk meshes to match (see Terrain).
+	//
+	// Gameplay queries ground height and slope through GetHeight/GetNormal
+	// - bilinear heightfield samples, never mesh triangles, so they work
+	// at full precision even where the rendered chunk is a coarse LOD.
+	class TerrainRenderer : public RendererComponent {
+	public:
+		CLASS_PROTOTYPE(TerrainRenderer)
+
+		// legacy entry point - terrain needs a pass camera, nothing to do
+		void Draw(Renderer& renderer) override {}
+
+		// scene playback entry point
+		void Draw(Renderer& renderer, const Frustum& frustum, const glm::vec3& viewPosition);
+
+		void Read(const serial_data_t& value) override;
+		void UpdateGUI() override;
+
+		void WriteSnapshot(SnapshotWriter& writer) override;
+		void ReadSnapshot(SnapshotReader& reader) override;
+
+		// ground height/normal under a world position - false until the
+		// heightfield has streamed in or outside the terrain
+		bool GetHeight(const glm::vec3& worldPosition, float& height) const;
+		bool GetNormal(const glm::vec3& worldPosition, glm::vec3& normal) const;
+
+		// full terrain extent, for pass-level culling
+		Bounds GetWorldBounds() const;
+
+	public:
+		res_t<Terrain> terrain;
+	};
+}
@@ -2,36 +2,57 @@
 #include "Logger.h"
 
 /// <summary>
-/// Debug assertion macros for runtime condition checking and debugging.
-/// 
+/// Tiered assertion macros for runtime condition checking and debugging.
+///
 /// These macros provide a way to validate assumptions during development and catch
-/// programming errors early. Assertions are only active in debug builds and are
-/// completely removed in release builds for optimal performance.
-/// 
-/// Key features:
-/// - Debug-only execution (no performance impact in release)
-/// - Detailed error logging with condition and optional message
-/// - Immediate program termination on failure
-/// - Source code condition display using stringification
-/// 
+/// programming errors early. Which checks run - and what a failure does - is
+/// selected per build configuration through NEU_DIAGNOSTIC_LEVEL:
+///
+/// Level 2 (Debug, _DEBUG):
+/// - ASSERT and ASSERT_SLOW both evaluate; a failure logs and halts
+/// - The failure branches are [[unlikely]]-annotated so the checks stay
+///   off the hot path's straight-line code
+///
+/// Level 1 (Telemetry, NEU_TELEMETRY - the QA configuration):
+/// - ASSERT evaluates; a failure reports through the logger and execution
+///   continues, so QA sessions surface violations without dying on them.
+///   Each site reports once - a failing per-frame check doesn't flood the log
+/// - ASSERT_SLOW compiles out entirely; the hot loops it guards (pool
+///   handle generation checks, BVH invariants, job accounting) run at
+///   full release speed
+///
+/// Level 0 (Release):
+/// - Everything compiles out to ((void)0), zero cost in shipping builds
+///
 /// Usage guidelines:
-/// - Use for checking preconditions, postconditions, and invariants
-/// - Don't use for user input validation or recoverable errors
-/// - Conditions should have no side effects (since they're removed in release)
+/// - Use ASSERT for preconditions, postconditions, and invariants worth
+///   hearing about from a QA build
+/// - Use ASSERT_SLOW for checks inside per-element/per-frame hot loops
+///   that are only affordable in debug
+/// - Don't use either for user input validation or recoverable errors
+/// - Conditions must have no side effects (they're removed in release)
 /// </summary>
 
-#ifdef _DEBUG
+#if defined(_DEBUG)
+    #define NEU_DIAGNOSTIC_LEVEL 2
+#elif defined(NEU_TELEMETRY)
+    #define NEU_DIAGNOSTIC_LEVEL 1
+#else
+    #define NEU_DIAGNOSTIC_LEVEL 0
+#endif
+
+#if NEU_DIAGNOSTIC_LEVEL >= 2
     /// <summary>
     /// Debug assertion macro that checks a condition and terminates if false.
-    /// 
+    ///
     /// In debug builds, this macro:
     /// 1. Evaluates the given condition
     /// 2. If false, logs an error with the condition text
     /// 3. Immediately terminates the program with std::abort()
-    /// 
+    ///
     /// The do-while(0) construct ensures the macro behaves like a single statement
     /// and works correctly with if-else statements without braces.
-    /// 
+    ///
     /// Example usage:
     ///   ASSERT(ptr != nullptr);
     ///   ASSERT(index < array.size());
@@ -40,7 +61,7 @@
     /// <param name="condition">The condition to check - should be an expression that evaluates to bool</param>
 #define ASSERT(condition) \
         do { \
-            if (!(condition)) { \
+            if (!(condition)) [[unlikely]] { \
                 LOG_ERROR("ASSERTION FAILED: '{}'", #condition); \
                 std::abort(); \
             } \
@@ -48,14 +69,14 @@
 
     /// <summary>
     /// Debug assertion macro with custom error message.
-    /// 
+    ///
     /// Similar to ASSERT() but allows providing additional context through a custom message.
     /// This is particularly useful for complex conditions or when you want to provide
     /// guidance about what went wrong or how to fix it.
-    /// 
+    ///
     /// The macro logs both the failed condition and the custom message, making
     /// debugging easier by providing more context about the failure.
-    /// 
+    ///
     /// Example usage:
     ///   ASSERT_MSG(file.is_open(), "Failed to open configuration file");
     ///   ASSERT_MSG(player_count > 0, "Game started with no players");
@@ -65,20 +86,89 @@
     /// <param name="msg">Custom error message providing additional context about the failure</param>
 #define ASSERT_MSG(condition, msg) \
         do { \
-            if (!(condition)) { \
+            if (!(condition)) [[unlikely]] { \
                 LOG_ERROR("ASSERTION FAILED: '{}' - {}", #condition, msg); \
                 std::abort(); \
             } \
         } while(0)
 
+    /// <summary>
+    /// Hot-path assertion, active only at full diagnostic level.
+    ///
+    /// Behaves exactly like ASSERT in debug builds, but compiles out of the
+    /// telemetry configuration as well as release - place these inside
+    /// per-element loops (pool slot validation, BVH node invariants, job
+    /// counter accounting) where even a predicted-not-taken branch per
+    /// iteration is unwelcome outside debug.
+    /// </summary>
+    /// <param name="condition">The condition to check - should be an expression that evaluates to bool</param>
+#define ASSERT_SLOW(condition)          ASSERT(condition)
+
+    /// <summary>
+    /// Hot-path assertion with custom error message - see ASSERT_SLOW.
+    /// </summary>
+    /// <param name="condition">The condition to check - should be an expression that evaluates to bool</param>
+    /// <param name="msg">Custom error message providing additional context about the failure</param>
+#define ASSERT_SLOW_MSG(condition, msg) ASSERT_MSG(condition, msg)
+
+#elif NEU_DIAGNOSTIC_LEVEL == 1
+    /// <summary>
+    /// Telemetry build version of ASSERT - reports without halting.
+    ///
+    /// The condition still evaluates, but a failure logs through the normal
+    /// logger and execution continues, so a QA session records the violation
+    /// instead of ending at it. Each site reports its first failure only -
+    /// the static flag keeps a per-frame check that starts failing from
+    /// flooding the log with identical lines.
+    /// </summary>
+    /// <param name="condition">The condition to check - should be an expression that evaluates to bool</param>
+#define ASSERT(condition) \
+        do { \
+            if (!(condition)) [[unlikely]] { \
+                static bool reported_ = false; \
+                if (!reported_) { \
+                    reported_ = true; \
+                    LOG_ERROR("ASSERTION FAILED (continuing): '{}'", #condition); \
+                } \
+            } \
+        } while(0)
+
+    /// <summary>
+    /// Telemetry build version of ASSERT_MSG - reports without halting,
+    /// first failure per site only. See ASSERT above.
+    /// </summary>
+    /// <param name="condition">The condition to check - should be an expression that evaluates to bool</param>
+    /// <param name="msg">Custom error message providing additional context about the failure</param>
+#define ASSERT_MSG(condition, msg) \
+        do { \
+            if (!(condition)) [[unlikely]] { \
+                static bool reported_ = false; \
+                if (!reported_) { \
+                    reported_ = true; \
+                    LOG_ERROR("ASSERTION FAILED (continuing): '{}' - {}", #condition, msg); \
+                } \
+            } \
+        } while(0)
+
+    /// <summary>
+    /// Telemetry build version of ASSERT_SLOW - compiled out entirely so
+    /// the hot loops it guards run at full release speed.
+    /// </summary>
+    /// <param name="condition">Ignored in telemetry builds</param>
+#define ASSERT_SLOW(condition)          ((void)0)
+
+/// <param name="condition">Ignored in telemetry builds</param>
+/// <param name="msg">Ignored in telemetry builds</param>
+#define ASSERT_SLOW_MSG(condition, msg) ((void)0)
+
 #else
     /// <summary>
     /// Release build version of ASSERT - completely removed for performance.
-    /// 
+    ///
     /// In release builds, this macro expands to ((void)0), which is a no-op
     /// that gets optimized away by the compiler. This ensures zero performance
     /// impact in production builds while maintaining the same syntax.
-    /// 
+    ///
     /// The (void)0 cast prevents "unused variable" warnings if the condition
     /// contains variables that are only used in assertions.
     /// </summary>
@@ -87,7 +177,7 @@
 
 /// <summary>
 /// Release build version of ASSERT_MSG - completely removed for performance.
-/// 
+///
 /// Like ASSERT, this expands to a no-op in release builds, ensuring that
 /// both the condition evaluation and message formatting are eliminated
 /// for optimal performance.
@@ -95,32 +185,42 @@
 /// <param name="condition">Ignored in release builds</param>
 /// <param name="msg">Ignored in release builds</param>
 #define ASSERT_MSG(condition, msg) ((void)0)
+
+/// <param name="condition">Ignored in release builds</param>
+#define ASSERT_SLOW(condition) ((void)0)
+
+/// <param name="condition">Ignored in release builds</param>
+/// <param name="msg">Ignored in release builds</param>
+#define ASSERT_SLOW_MSG(condition, msg) ((void)0)
 #endif
 
 /// <summary>
 /// Implementation Notes:
-/// 
+///
 /// 1. Macro Design:
 ///    - Uses do-while(0) idiom for statement-like behavior
 ///    - Prevents issues with if-else statements without braces
 ///    - Ensures macro expansion is treated as single statement
-/// 
+///
 /// 2. Condition Stringification:
 ///    - #condition converts the condition to a string literal
 ///    - Allows logging the exact code that failed
 ///    - Helpful for debugging without looking at source
-/// 
+///
 /// 3. Build Configuration:
-///    - _DEBUG is defined by Visual Studio in debug builds
-///    - Assertions are completely removed in release builds
-///    - No runtime overhead in production code
-/// 
+///    - _DEBUG (defined by Visual Studio in debug builds) selects level 2
+///    - NEU_TELEMETRY (defined by the Telemetry solution configuration,
+///      the default QA target) selects level 1 on top of NDEBUG
+///    - Plain release builds select level 0, all checks removed
+///
 /// 4. Error Handling:
-///    - Uses std::abort() for immediate termination
-///    - Generates core dump on supported systems
-///    - Stops execution at the exact point of failure
-/// 
+///    - Level 2 uses std::abort() for immediate termination,
+///      generating a core dump on supported systems
+///    - Level 1 logs and continues, once per site
+///
 /// 5. Thread Safety:
 ///    - LOG_ERROR calls should be thread-safe (depends on logger implementation)
 ///    - std::abort() is thread-safe and terminates entire process
-/// </summary>
\ No newline at end of file
+///    - The level 1 once-flag is intentionally unsynchronized - a race
+///      costs at worst one duplicate log line
+/// </summary>
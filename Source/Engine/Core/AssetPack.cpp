@@ -0,0 +1,369 @@
+#include "AssetPack.h"
+#include "Compression.h"
+#include "File.h"
+#include "Logger.h"
+
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace neu::file {
+    namespace {
+        // pack container: header, hashed-path index, then payloads aligned
+        // so mapped slices can be consumed in place
+        // version 2: entries carry the decompressed size, payloads may be
+        // LZ-compressed block containers (see Compression.h)
+        constexpr uint32_t kPackMagic = 0x4b41504e;   // "NPAK"
+        constexpr uint32_t kPackVersion = 2;
+        constexpr size_t kPackAlignment = 64;
+
+        struct PackHeader {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t entryCount;
+            uint32_t _pad;
+        };
+
+        struct PackEntry {
+            uint64_t hash;      // HashPath of the entry's relative path
+            uint64_t offset;    // payload offset from the start of the file
+            uint64_t size;      // stored payload size in bytes
+            uint64_t rawSize;   // decompressed size; equal to size when stored raw
+        };
+
+        constexpr size_t AlignUp(size_t value, size_t alignment) {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        // mounted packs, searched newest mount first by FindPacked
+        std::vector<std::unique_ptr<AssetPack>> s_packs;
+    }
+
+    uint64_t HashPath(const std::string& path) {
+        // case-insensitive FNV-1a over the path with separators normalized
+        // to forward slashes, so "Shaders\\lit.vert" and "shaders/lit.vert"
+        // key the same entry
+        uint64_t hash = 14695981039346656037ull;
+        for (char c : path) {
+            if (c == '\\') c = '/';
+            hash ^= static_cast<uint64_t>(static_cast<uint8_t>(std::tolower(static_cast<unsigned char>(c))));
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    bool AssetPack::Mount(const std::string& path) {
+        Unmount();
+
+#ifdef _WIN32
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            LOG_ERROR("Could not open pack: {}", path);
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) {
+            CloseHandle(file);
+            return false;
+        }
+
+        const uint8_t* data = (const uint8_t*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!data) {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        m_file = file;
+        m_mapping = mapping;
+        m_data = data;
+        m_size = (size_t)fileSize.QuadPart;
+#else
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            LOG_ERROR("Could not open pack: {}", path);
+            return false;
+        }
+
+        struct stat status;
+        if (fstat(fd, &status) != 0 || status.st_size == 0) {
+            close(fd);
+            return false;
+        }
+
+        const uint8_t* data = (const uint8_t*)mmap(nullptr, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            close(fd);
+            return false;
+        }
+
+        m_fd = fd;
+        m_data = data;
+        m_size = (size_t)status.st_size;
+#endif
+        m_path = path;
+
+        // read and validate the index
+        PackHeader header;
+        if (m_size < sizeof(PackHeader)) {
+            Unmount();
+            return false;
+        }
+        std::memcpy(&header, m_data, sizeof(PackHeader));
+        if (header.magic != kPackMagic || header.version != kPackVersion) {
+            LOG_WARNING("Pack has wrong magic/version: {}", path);
+            Unmount();
+            return false;
+        }
+        if (sizeof(PackHeader) + header.entryCount * sizeof(PackEntry) > m_size) {
+            Unmount();
+            return false;
+        }
+
+        const PackEntry* entries = (const PackEntry*)(m_data + sizeof(PackHeader));
+        m_index.reserve(header.entryCount);
+        for (uint32_t i = 0; i < header.entryCount; i++) {
+            // reject entries pointing outside the mapping
+            if (entries[i].offset + entries[i].size > m_size) {
+                LOG_WARNING("Pack entry out of bounds: {}", path);
+                Unmount();
+                return false;
+            }
+            m_index[entries[i].hash] = Entry{ entries[i].offset, entries[i].size, entries[i].rawSize };
+        }
+
+        // entries sharing a payload offset are cook-time dedup aliases
+        // (byte-identical source files stored once) - map every member of
+        // a shared group to one canonical path hash so the resource cache
+        // can collapse duplicate paths onto a single loaded instance. The
+        // lowest hash is canonical, so the choice is stable across index
+        // order and between direct and aliased loads
+        std::unordered_map<uint64_t, std::pair<uint64_t, uint32_t>> groups; // offset -> (min hash, count)
+        for (uint32_t i = 0; i < header.entryCount; i++) {
+            auto [group, inserted] = groups.try_emplace(entries[i].offset, std::make_pair(entries[i].hash, 1u));
+            if (!inserted) {
+                group->second.first = std::min(group->second.first, entries[i].hash);
+                group->second.second++;
+            }
+        }
+        for (uint32_t i = 0; i < header.entryCount; i++) {
+            auto& group = groups[entries[i].offset];
+            if (group.second > 1) m_aliases[entries[i].hash] = group.first;
+        }
+
+        LOG_INFO("Mounted pack {} ({} entries)", path, m_index.size());
+        return true;
+    }
+
+    void AssetPack::Unmount() {
+#ifdef _WIN32
+        if (m_data) UnmapViewOfFile(m_data);
+        if (m_mapping) CloseHandle((HANDLE)m_mapping);
+        if (m_file) CloseHandle((HANDLE)m_file);
+        m_file = nullptr;
+        m_mapping = nullptr;
+#else
+        if (m_data) munmap((void*)m_data, m_size);
+        if (m_fd >= 0) close(m_fd);
+        m_fd = -1;
+#endif
+        m_data = nullptr;
+        m_size = 0;
+        m_index.clear();
+        m_aliases.clear();
+        m_path.clear();
+    }
+
+    const uint8_t* AssetPack::Find(const std::string& path, size_t& size, size_t& rawSize) const {
+        auto iter = m_index.find(HashPath(path));
+        if (iter == m_index.end()) return nullptr;
+
+        size = (size_t)iter->second.size;
+        rawSize = (size_t)iter->second.rawSize;
+        return m_data + iter->second.offset;
+    }
+
+    uint64_t AssetPack::ResolveAlias(uint64_t pathHash) const {
+        auto iter = m_aliases.find(pathHash);
+        return iter != m_aliases.end() ? iter->second : 0;
+    }
+
+    bool MountPack(const std::string& path) {
+        auto pack = std::make_unique<AssetPack>();
+        if (!pack->Mount(path)) return false;
+
+        s_packs.push_back(std::move(pack));
+        return true;
+    }
+
+    void UnmountPacks() {
+        s_packs.clear();
+    }
+
+    const uint8_t* FindPacked(const std::string& path, size_t& size, size_t& rawSize) {
+        // newest mount first, so patch packs shadow earlier ones
+        for (auto iter = s_packs.rbegin(); iter != s_packs.rend(); ++iter) {
+            const uint8_t* data = (*iter)->Find(path, size, rawSize);
+            if (data) return data;
+        }
+        return nullptr;
+    }
+
+    uint64_t ResolvePackedAlias(const std::string& path) {
+        uint64_t hash = HashPath(path);
+        for (auto iter = s_packs.rbegin(); iter != s_packs.rend(); ++iter) {
+            uint64_t canonical = (*iter)->ResolveAlias(hash);
+            if (canonical) return canonical;
+        }
+        return 0;
+    }
+
+    bool BuildPack(const std::string& directory, const std::string& packPath) {
+        namespace fs = std::filesystem;
+
+        // collect every regular file under the directory, keyed by the
+        // relative path the game will ask for
+        struct Pending {
+            std::string relativePath;
+            fs::path sourcePath;
+            uint64_t size;
+            size_t blob;        // index of the unique payload this path maps to
+        };
+        std::vector<Pending> files;
+
+        std::error_code ec;
+        for (auto& entry : fs::recursive_directory_iterator(directory, ec)) {
+            if (!entry.is_regular_file()) continue;
+            // never pack a pack
+            if (entry.path().extension() == ".npak") continue;
+
+            std::string relativePath = fs::relative(entry.path(), directory, ec).generic_string();
+            if (ec) continue;
+
+            files.push_back({ relativePath, entry.path(), (uint64_t)entry.file_size(), 0 });
+        }
+        if (ec || files.empty()) {
+            LOG_ERROR("Could not build pack from: {}", directory);
+            return false;
+        }
+
+        // content-hash every payload so byte-identical files (assets
+        // duplicated across folders) store one blob, with each duplicate
+        // path becoming an index alias onto it. Payloads are read twice -
+        // hash pass here, write pass below - keeping peak memory at one
+        // file instead of the whole pack
+        struct Blob {
+            fs::path sourcePath;
+            uint64_t size;          // raw (decompressed) size
+            uint64_t offset;
+            uint64_t storedSize;    // size on disk, after the codec choice
+        };
+        std::vector<Blob> blobs;
+        std::unordered_map<uint64_t, size_t> blobsByHash;
+
+        std::vector<uint8_t> buffer;
+        for (auto& file : files) {
+            if (!ReadBinaryFile(file.sourcePath.string(), buffer)) {
+                LOG_ERROR("Could not read pack source: {}", file.sourcePath.string());
+                return false;
+            }
+
+            // FNV-1a seeded with the size, so a file sharing another's
+            // prefix hash can't collide with it
+            uint64_t hash = 14695981039346656037ull ^ file.size;
+            for (uint8_t byte : buffer) {
+                hash ^= byte;
+                hash *= 1099511628211ull;
+            }
+
+            auto [blob, inserted] = blobsByHash.try_emplace(hash, blobs.size());
+            if (inserted) blobs.push_back({ file.sourcePath, file.size, 0, 0 });
+            file.blob = blob->second;
+        }
+
+        std::ofstream pack(packPath, std::ios::binary);
+        if (!pack.is_open()) {
+            LOG_ERROR("Could not write pack: {}", packPath);
+            return false;
+        }
+
+        // placeholder index first - offsets and stored sizes are known only
+        // after each blob's codec choice, so the index is rewritten at the end
+        PackHeader header{ kPackMagic, kPackVersion, (uint32_t)files.size(), 0 };
+        std::vector<PackEntry> entries(files.size());
+        pack.write((const char*)&header, sizeof(header));
+        pack.write((const char*)entries.data(), entries.size() * sizeof(PackEntry));
+
+        // stream each unique payload into place, aligned for in-place use.
+        // The codec choice is per entry: compress when it pays, store raw
+        // otherwise - formats with their own compression (PNG, Ogg) stay
+        // raw and keep the zero-copy mapped path at load
+        std::vector<uint8_t> compressed;
+        uint64_t written = sizeof(PackHeader) + entries.size() * sizeof(PackEntry);
+        uint64_t rawBytes = 0;
+        for (auto& blob : blobs) {
+            blob.offset = AlignUp(written, kPackAlignment);
+            while (written < blob.offset) {
+                pack.put('\0');
+                written++;
+            }
+
+            if (!ReadBinaryFile(blob.sourcePath.string(), buffer)) {
+                LOG_ERROR("Could not read pack source: {}", blob.sourcePath.string());
+                return false;
+            }
+
+            const uint8_t* payload = buffer.data();
+            blob.storedSize = buffer.size();
+            if (compress::CompressEntry(buffer.data(), buffer.size(), compressed)) {
+                payload = compressed.data();
+                blob.storedSize = compressed.size();
+            }
+
+            pack.write((const char*)payload, blob.storedSize);
+            written += blob.storedSize;
+            rawBytes += blob.size;
+        }
+
+        // every path's entry points at its blob, so duplicates share an
+        // offset the mount-side alias detection keys on
+        for (size_t i = 0; i < files.size(); i++) {
+            const Blob& blob = blobs[files[i].blob];
+            entries[i] = PackEntry{ HashPath(files[i].relativePath), blob.offset, blob.storedSize, blob.size };
+        }
+
+        pack.seekp(sizeof(PackHeader));
+        pack.write((const char*)entries.data(), entries.size() * sizeof(PackEntry));
+
+        if (!pack.good()) {
+            LOG_ERROR("Could not write pack: {}", packPath);
+            return false;
+        }
+
+        LOG_INFO("Built pack {} ({} entries, {} deduplicated, {} -> {} MB)", packPath,
+            entries.size(), entries.size() - blobs.size(),
+            rawBytes / (1024 * 1024), written / (1024 * 1024));
+        return true;
+    }
+}
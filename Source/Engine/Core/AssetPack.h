@@ -0,0 +1,148 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace neu::file {
+    /// <summary>
+    /// A single mounted asset pack: one archive file holding many small
+    /// assets behind a hashed-path index, memory-mapped so lookups are
+    /// pointer slices into the mapping with no per-file open/seek/read.
+    ///
+    /// Packs exist for seek-bound load times - a level touching hundreds of
+    /// loose files pays one open per file on disk, while a pack is a single
+    /// sequential file the OS pages in on demand. Loose files always take
+    /// priority over packed entries (see the read functions in File.h), so
+    /// development edits work without repacking.
+    /// </summary>
+    class AssetPack {
+    public:
+        AssetPack() = default;
+        ~AssetPack() { Unmount(); }
+
+        // owns a platform mapping handle, the pack can't be copied
+        AssetPack(const AssetPack&) = delete;
+        AssetPack& operator=(const AssetPack&) = delete;
+
+        /// <summary>
+        /// Maps the pack file and reads its index. The mapping stays open
+        /// until Unmount() or destruction.
+        /// </summary>
+        /// <param name="path">Path to the pack file</param>
+        /// <returns>True if the pack was mapped and its index read</returns>
+        bool Mount(const std::string& path);
+
+        /// <summary>
+        /// Releases the mapping and the index. Any pointers previously
+        /// returned by Find() are invalid afterwards.
+        /// </summary>
+        void Unmount();
+
+        /// <summary>
+        /// Looks up a packed entry by (normalized, case-insensitive) path.
+        /// Entries with rawSize != size are compressed block containers
+        /// (see Compression.h) and must be decompressed before use; equal
+        /// sizes mean the bytes are the asset, consumable in place.
+        /// </summary>
+        /// <param name="path">Asset path as the game refers to it</param>
+        /// <param name="size">Receives the stored entry size in bytes</param>
+        /// <param name="rawSize">Receives the decompressed size in bytes</param>
+        /// <returns>Pointer into the mapping, or nullptr if not packed</returns>
+        const uint8_t* Find(const std::string& path, size_t& size, size_t& rawSize) const;
+
+        /// <summary>
+        /// Resolves a path hash to the canonical hash of its payload when
+        /// the payload is shared by several entries (cook-time dedup of
+        /// byte-identical files). The canonical hash is the same whichever
+        /// alias is asked, so callers can use it as a shared cache key.
+        /// </summary>
+        /// <param name="pathHash">HashPath of the path to resolve</param>
+        /// <returns>Canonical hash of the shared payload, or 0 if the path is not aliased</returns>
+        uint64_t ResolveAlias(uint64_t pathHash) const;
+
+        const std::string& GetPath() const { return m_path; }
+
+    private:
+        /// <summary>
+        /// Index entry - payload location within the mapping.
+        /// </summary>
+        struct Entry {
+            uint64_t offset;
+            uint64_t size;      // stored size
+            uint64_t rawSize;   // decompressed size; equal to size when raw
+        };
+
+        std::string m_path;
+        std::unordered_map<uint64_t, Entry> m_index;
+
+        // path hash -> canonical hash for entries whose payload is shared
+        // by several paths; built at mount from shared payload offsets
+        std::unordered_map<uint64_t, uint64_t> m_aliases;
+
+        // mapped view of the whole pack file
+        const uint8_t* m_data{ nullptr };
+        size_t m_size{ 0 };
+
+        // platform mapping handles
+#ifdef _WIN32
+        void* m_file{ nullptr };
+        void* m_mapping{ nullptr };
+#else
+        int m_fd{ -1 };
+#endif
+    };
+
+    /// <summary>
+    /// Mounts a pack so the file read functions can serve its entries.
+    /// Later mounts are searched first, so a patch pack can shadow entries
+    /// of an earlier one.
+    /// </summary>
+    /// <param name="path">Path to the pack file</param>
+    /// <returns>True if the pack mounted successfully</returns>
+    bool MountPack(const std::string& path);
+
+    /// <summary>
+    /// Unmounts every mounted pack.
+    /// </summary>
+    void UnmountPacks();
+
+    /// <summary>
+    /// Searches mounted packs (newest mount first) for a packed entry.
+    /// Compressed entries (rawSize != size) must be decompressed before
+    /// use - the file read functions handle this transparently.
+    /// </summary>
+    /// <param name="path">Asset path as the game refers to it</param>
+    /// <param name="size">Receives the stored entry size in bytes</param>
+    /// <param name="rawSize">Receives the decompressed size in bytes</param>
+    /// <returns>Pointer into the pack mapping, or nullptr if no pack has it</returns>
+    const uint8_t* FindPacked(const std::string& path, size_t& size, size_t& rawSize);
+
+    /// <summary>
+    /// Searches mounted packs (newest mount first) for a dedup alias of the
+    /// path - duplicate source files cook to one blob with several index
+    /// entries, and the ResourceManager keys aliased paths by the canonical
+    /// hash so they share one cached resource.
+    /// </summary>
+    /// <param name="path">Asset path as the game refers to it</param>
+    /// <returns>Canonical hash of the shared payload, or 0 if not aliased</returns>
+    uint64_t ResolvePackedAlias(const std::string& path);
+
+    /// <summary>
+    /// Builds a pack from every file under a directory (recursively),
+    /// keyed by path relative to that directory. Entries are aligned so
+    /// mapped slices can be consumed in place. Existing pack files in the
+    /// directory are skipped.
+    /// </summary>
+    /// <param name="directory">Root directory to pack</param>
+    /// <param name="packPath">Output pack file path</param>
+    /// <returns>True if the pack was written</returns>
+    bool BuildPack(const std::string& directory, const std::string& packPath);
+
+    /// <summary>
+    /// Case-insensitive FNV-1a hash of a path normalized to forward
+    /// slashes - the key packed entries are indexed by.
+    /// </summary>
+    /// <param name="path">Path to hash</param>
+    /// <returns>64-bit hash of the normalized path</returns>
+    uint64_t HashPath(const std::string& path);
+}
@@ -0,0 +1,248 @@
+#include "Compression.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace neu::compress {
+    namespace {
+        // LZ4 block format constants - matches can't start closer than
+        // kMinMatch to the end and the final kLastLiterals bytes are
+        // always emitted as literals, so decode never reads past the end
+        constexpr size_t kMinMatch = 4;
+        constexpr size_t kLastLiterals = 5;
+        constexpr size_t kMaxOffset = 65535;
+
+        // match-finder hash table - 8K entries of block-local positions
+        constexpr int kHashBits = 13;
+
+        uint32_t Hash(uint32_t value) {
+            return (value * 2654435761u) >> (32 - kHashBits);
+        }
+
+        uint32_t Read32(const uint8_t* data) {
+            uint32_t value;
+            std::memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        // writes a length field: 4 bits in the token, then runs of 255
+        bool WriteLength(size_t length, uint8_t*& out, const uint8_t* outEnd) {
+            while (length >= 255) {
+                if (out >= outEnd) return false;
+                *out++ = 255;
+                length -= 255;
+            }
+            if (out >= outEnd) return false;
+            *out++ = (uint8_t)length;
+            return true;
+        }
+
+        // container block header - top bit marks a block stored raw, the
+        // rest is the stored size (blocks are at most kBlockSize)
+        constexpr uint32_t kBlockRaw = 0x80000000u;
+        constexpr uint32_t kBlockSizeMask = 0x7fffffffu;
+    }
+
+    size_t CompressBlock(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity) {
+        uint8_t* out = dst;
+        const uint8_t* outEnd = dst + dstCapacity;
+
+        const uint8_t* anchor = src;    // first unemitted literal
+        size_t position = 0;
+
+        // matches must leave the tail literals and a full 4-byte read
+        size_t matchLimit = srcSize > kLastLiterals + kMinMatch ? srcSize - kLastLiterals - kMinMatch : 0;
+
+        int32_t table[1 << kHashBits];
+        for (auto& entry : table) entry = -1;
+
+        while (position < matchLimit) {
+            uint32_t sequence = Read32(src + position);
+            uint32_t slot = Hash(sequence);
+            int32_t candidate = table[slot];
+            table[slot] = (int32_t)position;
+
+            if (candidate < 0 || position - candidate > kMaxOffset || Read32(src + candidate) != sequence) {
+                position++;
+                continue;
+            }
+
+            // extend the match forward past the guaranteed 4 bytes
+            size_t matchLength = kMinMatch;
+            size_t matchEnd = srcSize - kLastLiterals;
+            while (position + matchLength < matchEnd && src[candidate + matchLength] == src[position + matchLength]) {
+                matchLength++;
+            }
+
+            size_t literalLength = (src + position) - anchor;
+
+            // token, extended lengths, literals, then the match offset
+            if (out >= outEnd) return 0;
+            uint8_t* token = out++;
+            *token = (uint8_t)((literalLength < 15 ? literalLength : 15) << 4);
+            if (literalLength >= 15 && !WriteLength(literalLength - 15, out, outEnd)) return 0;
+
+            if (out + literalLength + 2 > outEnd) return 0;
+            std::memcpy(out, anchor, literalLength);
+            out += literalLength;
+
+            size_t offset = position - candidate;
+            *out++ = (uint8_t)(offset & 0xff);
+            *out++ = (uint8_t)(offset >> 8);
+
+            size_t extra = matchLength - kMinMatch;
+            *token |= (uint8_t)(extra < 15 ? extra : 15);
+            if (extra >= 15 && !WriteLength(extra - 15, out, outEnd)) return 0;
+
+            position += matchLength;
+            anchor = src + position;
+        }
+
+        // trailing literals, no match after them
+        size_t literalLength = (src + srcSize) - anchor;
+        if (out >= outEnd) return 0;
+        uint8_t* token = out++;
+        *token = (uint8_t)((literalLength < 15 ? literalLength : 15) << 4);
+        if (literalLength >= 15 && !WriteLength(literalLength - 15, out, outEnd)) return 0;
+        if (out + literalLength > outEnd) return 0;
+        std::memcpy(out, anchor, literalLength);
+        out += literalLength;
+
+        return out - dst;
+    }
+
+    bool DecompressBlock(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize) {
+        const uint8_t* in = src;
+        const uint8_t* inEnd = src + srcSize;
+        uint8_t* out = dst;
+        uint8_t* outEnd = dst + dstSize;
+
+        while (in < inEnd) {
+            uint8_t token = *in++;
+
+            size_t literalLength = token >> 4;
+            if (literalLength == 15) {
+                uint8_t run;
+                do {
+                    if (in >= inEnd) return false;
+                    run = *in++;
+                    literalLength += run;
+                } while (run == 255);
+            }
+            if (in + literalLength > inEnd || out + literalLength > outEnd) return false;
+            std::memcpy(out, in, literalLength);
+            in += literalLength;
+            out += literalLength;
+
+            // the final sequence is literals only
+            if (in == inEnd) break;
+
+            if (in + 2 > inEnd) return false;
+            size_t offset = in[0] | ((size_t)in[1] << 8);
+            in += 2;
+            if (offset == 0 || offset > (size_t)(out - dst)) return false;
+
+            size_t matchLength = token & 15;
+            if (matchLength == 15) {
+                uint8_t run;
+                do {
+                    if (in >= inEnd) return false;
+                    run = *in++;
+                    matchLength += run;
+                } while (run == 255);
+            }
+            matchLength += kMinMatch;
+            if (out + matchLength > outEnd) return false;
+
+            // byte copy - matches may overlap their own output (run encoding)
+            const uint8_t* match = out - offset;
+            for (size_t i = 0; i < matchLength; i++) out[i] = match[i];
+            out += matchLength;
+        }
+
+        return out == outEnd;
+    }
+
+    bool CompressEntry(const uint8_t* src, size_t srcSize, std::vector<uint8_t>& out) {
+        out.clear();
+        if (srcSize == 0) return false;
+
+        std::vector<uint8_t> scratch(kBlockSize);
+
+        for (size_t offset = 0; offset < srcSize; offset += kBlockSize) {
+            size_t blockSize = std::min(kBlockSize, srcSize - offset);
+
+            // a block must strictly shrink or it stores raw
+            size_t stored = CompressBlock(src + offset, blockSize, scratch.data(), blockSize - 1);
+
+            uint32_t header = stored ? (uint32_t)stored : (kBlockRaw | (uint32_t)blockSize);
+            const uint8_t* payload = stored ? scratch.data() : src + offset;
+            size_t payloadSize = stored ? stored : blockSize;
+
+            size_t position = out.size();
+            out.resize(position + sizeof(header) + payloadSize);
+            std::memcpy(out.data() + position, &header, sizeof(header));
+            std::memcpy(out.data() + position + sizeof(header), payload, payloadSize);
+        }
+
+        // whole-entry threshold - content that barely shrinks (formats
+        // with their own compression) stays raw and keeps the zero-copy
+        // mapped path
+        return out.size() < srcSize - srcSize / 16;
+    }
+
+    bool DecompressEntry(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t rawSize) {
+        return DecompressEntryRange(src, srcSize, rawSize, 0, rawSize, dst);
+    }
+
+    bool DecompressEntryRange(const uint8_t* src, size_t srcSize, size_t rawSize, size_t offset, size_t count, uint8_t* dst) {
+        if (offset + count > rawSize) return false;
+
+        const uint8_t* in = src;
+        const uint8_t* inEnd = src + srcSize;
+        size_t rawOffset = 0;       // decompressed position of the current block
+        size_t produced = 0;
+
+        std::vector<uint8_t> scratch;
+
+        while (produced < count) {
+            if (in + sizeof(uint32_t) > inEnd || rawOffset >= rawSize) return false;
+
+            uint32_t header;
+            std::memcpy(&header, in, sizeof(header));
+            in += sizeof(header);
+
+            size_t stored = header & kBlockSizeMask;
+            size_t blockRaw = std::min(kBlockSize, rawSize - rawOffset);
+            if (in + stored > inEnd) return false;
+
+            if (rawOffset + blockRaw <= offset) {
+                // entirely before the range - skip by stored size, no decode
+                in += stored;
+                rawOffset += blockRaw;
+                continue;
+            }
+
+            // decode the block, raw blocks slice straight from the container
+            const uint8_t* block;
+            if (header & kBlockRaw) {
+                if (stored != blockRaw) return false;
+                block = in;
+            }
+            else {
+                scratch.resize(blockRaw);
+                if (!DecompressBlock(in, stored, scratch.data(), blockRaw)) return false;
+                block = scratch.data();
+            }
+            in += stored;
+
+            size_t from = offset + produced - rawOffset;
+            size_t take = std::min(blockRaw - from, count - produced);
+            std::memcpy(dst + produced, block + from, take);
+            produced += take;
+            rawOffset += blockRaw;
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// Byte-oriented LZ77 compression used by the asset pack for cooked
+/// payloads. The block format is LZ4-compatible (token of literal/match
+/// lengths, two-byte match offsets, minimum match of four), chosen for
+/// decompression speed - decode is a straight copy loop, fast enough to
+/// run on the I/O worker threads without becoming the bottleneck the
+/// disk read used to be.
+///
+/// Entries are containers of independently-compressed 64 KB blocks, so
+/// region reads (texture mip streaming) skip whole blocks without
+/// decoding them and decompression can stream chunk by chunk while the
+/// mapped pack pages in behind it.
+/// </summary>
+namespace neu::compress {
+    /// <summary>
+    /// Raw bytes covered by one block of an entry container. Region
+    /// decompression rounds to this granularity internally.
+    /// </summary>
+    constexpr size_t kBlockSize = 64 * 1024;
+
+    /// <summary>
+    /// Compresses one block. Greedy hash-table match finder - cook-time
+    /// speed matters less than decode speed, but packing a level should
+    /// still take seconds, not minutes.
+    /// </summary>
+    /// <param name="src">Bytes to compress</param>
+    /// <param name="srcSize">Number of bytes to compress (at most kBlockSize)</param>
+    /// <param name="dst">Destination buffer</param>
+    /// <param name="dstCapacity">Destination capacity - acts as the "worth it" threshold</param>
+    /// <returns>Compressed size, or 0 if the data does not fit dstCapacity</returns>
+    size_t CompressBlock(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity);
+
+    /// <summary>
+    /// Decompresses one block produced by CompressBlock.
+    /// </summary>
+    /// <param name="src">Compressed bytes</param>
+    /// <param name="srcSize">Compressed size in bytes</param>
+    /// <param name="dst">Destination buffer</param>
+    /// <param name="dstSize">Exact decompressed size expected</param>
+    /// <returns>True if the block decoded to exactly dstSize bytes</returns>
+    bool DecompressBlock(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize);
+
+    /// <summary>
+    /// Compresses a payload into a container of independent kBlockSize
+    /// blocks. Blocks that do not shrink are stored raw inside the
+    /// container; if the whole container saves less than 1/16th of the
+    /// input (already-compressed content like PNG or Ogg), the entry is
+    /// not worth compressing and false is returned.
+    /// </summary>
+    /// <param name="src">Bytes to compress</param>
+    /// <param name="srcSize">Number of bytes to compress</param>
+    /// <param name="out">Receives the container bytes</param>
+    /// <returns>True if the container is worth storing over the raw bytes</returns>
+    bool CompressEntry(const uint8_t* src, size_t srcSize, std::vector<uint8_t>& out);
+
+    /// <summary>
+    /// Decompresses a whole entry container.
+    /// </summary>
+    /// <param name="src">Container bytes</param>
+    /// <param name="srcSize">Container size in bytes</param>
+    /// <param name="dst">Destination buffer</param>
+    /// <param name="rawSize">Exact decompressed size expected</param>
+    /// <returns>True if the container decoded to exactly rawSize bytes</returns>
+    bool DecompressEntry(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t rawSize);
+
+    /// <summary>
+    /// Decompresses a byte range of an entry container, decoding only the
+    /// blocks the range touches - blocks before it are skipped by their
+    /// stored size without decoding.
+    /// </summary>
+    /// <param name="src">Container bytes</param>
+    /// <param name="srcSize">Container size in bytes</param>
+    /// <param name="rawSize">Decompressed size of the whole entry</param>
+    /// <param name="offset">Byte offset of the range within the decompressed entry</param>
+    /// <param name="count">Number of decompressed bytes to produce</param>
+    /// <param name="dst">Destination buffer for count bytes</param>
+    /// <returns>True if the range was decoded</returns>
+    bool DecompressEntryRange(const uint8_t* src, size_t srcSize, size_t rawSize, size_t offset, size_t count, uint8_t* dst);
+}
@@ -0,0 +1,13 @@
+#include "Factory.h"
+
+namespace neu {
+	// Explicit instantiation definitions matching the extern template
+	// declarations at the end of Factory.h. Actor creation (scene
+	// instantiation, spawn paths) and Component creation (actor
+	// deserialization) are the only specializations hot enough to matter -
+	// game-specific types keep instantiating at their own call sites.
+	template std::unique_ptr<Actor> Factory::Create<Actor>(const std::string&);
+	template std::unique_ptr<Actor> Factory::Create<Actor>(Factory::type_id_t);
+	template std::unique_ptr<Component> Factory::Create<Component>(const std::string&);
+	template std::unique_ptr<Component> Factory::Create<Component>(Factory::type_id_t);
+}
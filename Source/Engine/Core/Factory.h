@@ -4,9 +4,12 @@
 #include "Singleton.h"
 #include "Logger.h"
 
-#include <map>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 /// <summary>
 /// Convenience macro for automatic factory registration of a class.
@@ -36,6 +39,24 @@ public:                             \
 Register##classname register_instance;
 
 namespace neu {
+	/// <summary>
+	/// 64-bit FNV-1a hash of a registered class name, lowercased while
+	/// hashing so lookups stay case-insensitive like the string keys they
+	/// replaced. Constexpr, so call sites with literal names can resolve
+	/// the hash at compile time.
+	/// </summary>
+	/// <param name="name">The class name to hash</param>
+	/// <returns>64-bit hash of the lowercased name</returns>
+	constexpr uint64_t HashClassName(std::string_view name) {
+		uint64_t hash = 14695981039346656037ull;
+		for (char c : name) {
+			char ch = (c >= 'A' && c <= 'Z') ? (c - 'A' + 'a') : c;
+			hash ^= (uint64_t)(unsigned char)ch;
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
 	/// <summary>
 	/// Abstract base class for object creators in the Factory pattern.
 	/// This class defines the interface that all concrete creators must implement.
@@ -56,6 +77,14 @@ namespace neu {
 		/// </summary>
 		/// <returns>A unique pointer to a newly created Object instance</returns>
 		virtual std::unique_ptr<Object> Create() = 0;
+
+		/// <summary>
+		/// The template object this creator clones, if it has one. Lets spawn
+		/// fast paths copy-construct straight from the prototype instead of
+		/// going through a heap-allocated Clone().
+		/// </summary>
+		/// <returns>The stored prototype, or nullptr for constructor-based creators</returns>
+		virtual Object* GetPrototype() { return nullptr; }
 	};
 
 	/// <summary>
@@ -74,7 +103,15 @@ namespace neu {
 		/// </summary>
 		/// <returns>A unique pointer to the newly created T instance, cast to Object base type</returns>
 		std::unique_ptr<Object> Create() override {
-			return std::make_unique<T>();
+			auto object = std::make_unique<T>();
+
+			// Stamp component instances with their class type id so Scene can
+			// bucket them into typed registries without RTTI
+			if constexpr (std::derived_from<T, Component>) {
+				object->typeId = ComponentType::Id<T>();
+			}
+
+			return object;
 		}
 	};
 
@@ -112,6 +149,12 @@ namespace neu {
 			return m_prototype->Clone();
 		}
 
+		/// <summary>
+		/// Exposes the stored prototype for copy-construct spawn fast paths.
+		/// </summary>
+		/// <returns>The prototype instance (never modified after registration)</returns>
+		Object* GetPrototype() override { return m_prototype.get(); }
+
 	private:
 		/// <summary>
 		/// The prototype instance used as a template for cloning.
@@ -137,6 +180,14 @@ namespace neu {
 	/// </summary>
 	class Factory : public Singleton<Factory> {
 	public:
+		/// <summary>
+		/// Dense creator index assigned at registration. Resolving a name to
+		/// its id once (GetTypeId) lets hot creation loops call Create(id)
+		/// and skip the per-call string lowering and map traversal.
+		/// </summary>
+		using type_id_t = size_t;
+		static constexpr type_id_t kInvalidTypeId = (type_id_t)-1;
+
 		/// <summary>
 		/// Registers a class for creation using its default constructor.
 		/// Creates a Creator&lt;T&gt; instance and associates it with the given name.
@@ -178,23 +229,107 @@ namespace neu {
 			requires std::derived_from<T, Object>
 		std::unique_ptr<T> Create(const std::string& name);
 
+		/// <summary>
+		/// Creates an instance of the class registered under the given id.
+		/// This is the hot-path overload: no string lowering, no map lookup,
+		/// just an index into the dense creator table. Resolve the id once
+		/// per file/loop with GetTypeId and reuse it per creation.
+		/// </summary>
+		/// <typeparam name="T">The expected type of the created object, defaults to Object</typeparam>
+		/// <param name="id">Creator id resolved through GetTypeId</param>
+		/// <returns>A unique pointer to the created object of type T, or nullptr if creation failed</returns>
+		template<typename T = Object>
+			requires std::derived_from<T, Object>
+		std::unique_ptr<T> Create(type_id_t id);
+
+		/// <summary>
+		/// Resolves a registered name to its dense creator id. The name is
+		/// hashed case-insensitively on the fly - no lowercase temporary -
+		/// so this is one probe; pay it once and reuse the id in hot loops.
+		/// </summary>
+		/// <param name="name">The string identifier of the registered class</param>
+		/// <returns>The creator id, or kInvalidTypeId if the name is not registered</returns>
+		type_id_t GetTypeId(const std::string& name) {
+			auto it = m_nameToId.find(HashClassName(name));
+			return (it != m_nameToId.end()) ? it->second : kInvalidTypeId;
+		}
+
+		/// <summary>
+		/// Resolves a component class's dense ComponentType id back to its
+		/// creator id. The binary checkpoint restore path rebuilds components
+		/// from the type ids stamped on the captured instances, with no class
+		/// name in the blob.
+		/// </summary>
+		/// <param name="componentType">ComponentType id of a registered component class</param>
+		/// <returns>The creator id, or kInvalidTypeId if the class never registered</returns>
+		type_id_t GetComponentCreator(component_type_t componentType) {
+			return (componentType >= 0 && componentType < (component_type_t)m_componentCreators.size()) ?
+				m_componentCreators[componentType] : kInvalidTypeId;
+		}
+
+		/// <summary>
+		/// Returns the prototype registered under the given name, if the name
+		/// was registered through RegisterPrototype(). Spawn fast paths use
+		/// this to copy-construct directly into pooled storage instead of
+		/// cloning through a heap-allocated intermediate.
+		/// </summary>
+		/// <typeparam name="T">The expected type of the prototype, defaults to Object</typeparam>
+		/// <param name="name">The string identifier of the prototype</param>
+		/// <returns>The prototype instance, or nullptr if not found or not a prototype</returns>
+		template<typename T = Object>
+			requires std::derived_from<T, Object>
+		T* GetPrototype(const std::string& name);
+
 		/// <summary>
 		/// Removes all registered creators from the factory.
 		/// This clears the entire registry, effectively unregistering all classes.
 		/// Useful for cleanup or resetting the factory state.
 		/// </summary>
-		void RemoveAll() { m_registry.clear(); }
+		void RemoveAll() {
+			m_nameToId.clear();
+			m_creators.clear();
+		}
 
 	private:
 		/// <summary>
-		/// Internal registry mapping string names to creator instances.
-		/// Key: Lowercase class name for case-insensitive lookup
-		/// Value: Unique pointer to creator that can instantiate the associated class
-		/// 
-		/// The map stores creators as base CreatorBase pointers, providing type erasure
-		/// while maintaining the ability to create objects of any registered type.
+		/// Assigns (or reuses) the dense id for a name hash and stores the
+		/// creator in the id-indexed table. Re-registering a name (e.g.
+		/// replacing a prototype) keeps its id so resolved ids never go stale.
 		/// </summary>
-		std::map<std::string, std::unique_ptr<CreatorBase>> m_registry;
+		type_id_t StoreCreator(uint64_t key, std::unique_ptr<CreatorBase> creator) {
+			auto it = m_nameToId.find(key);
+			type_id_t id;
+			if (it != m_nameToId.end()) {
+				id = it->second;
+			}
+			else {
+				id = m_creators.size();
+				m_creators.emplace_back();
+				m_nameToId[key] = id;
+			}
+			m_creators[id] = std::move(creator);
+			return id;
+		}
+
+		/// <summary>
+		/// Internal registry: name hashes resolve once to dense ids, creators
+		/// live in an id-indexed table so the creation hot path is an array
+		/// index. Key: case-insensitive 64-bit hash of the class name (see
+		/// HashClassName) - no string storage, no string compares.
+		///
+		/// Creators are stored as base CreatorBase pointers, providing type
+		/// erasure while maintaining the ability to create objects of any
+		/// registered type.
+		/// </summary>
+		std::unordered_map<uint64_t, type_id_t> m_nameToId;
+		std::vector<std::unique_ptr<CreatorBase>> m_creators;
+
+		/// <summary>
+		/// ComponentType id to creator id, filled in by Register() for
+		/// component classes - the reverse of the typeId stamp Creator puts
+		/// on every instance. Dense ids index directly.
+		/// </summary>
+		std::vector<type_id_t> m_componentCreators;
 	};
 
 	/// <summary>
@@ -204,12 +339,21 @@ namespace neu {
 	template<typename T>
 		requires std::derived_from<T, Object>
 	inline void Factory::Register(const std::string& name) {
-		// Convert name to lowercase for case-insensitive storage and lookup
-		std::string key = toLower(name);
-
-		// Create and store a new Creator instance for type T
+		// Create and store a new Creator instance for type T under the
+		// case-insensitive name hash
 		// The Creator will use T's default constructor for object creation
-		m_registry[key] = std::make_unique<Creator<T>>();
+		type_id_t id = StoreCreator(HashClassName(name), std::make_unique<Creator<T>>());
+
+		// Assign the component type id at registration time so ids are stable
+		// and ComponentType::Count() covers every registered class, and map
+		// it back to the creator id for checkpoint restore
+		if constexpr (std::derived_from<T, Component>) {
+			component_type_t componentType = ComponentType::Id<T>();
+			if (componentType >= (component_type_t)m_componentCreators.size()) {
+				m_componentCreators.resize(componentType + 1, kInvalidTypeId);
+			}
+			m_componentCreators[componentType] = id;
+		}
 
 		// Log successful registration for debugging
 		LOG_INFO("{} added to factory.", name);
@@ -223,12 +367,10 @@ namespace neu {
 		requires std::derived_from<T, Object>
 	inline void Factory::RegisterPrototype(const std::string& name, std::unique_ptr<T> prototype)
 	{
-		// Convert name to lowercase for case-insensitive storage and lookup
-		std::string key = toLower(name);
-
 		// Create and store a PrototypeCreator with the provided prototype
+		// under the case-insensitive name hash
 		// Future Create() calls will clone this prototype instance
-		m_registry[key] = std::make_unique<PrototypeCreator<T>>(std::move(prototype));
+		StoreCreator(HashClassName(name), std::make_unique<PrototypeCreator<T>>(std::move(prototype)));
 
 		// Log successful prototype registration
 		LOG_INFO("{} prototype added to factory.", name);
@@ -241,35 +383,66 @@ namespace neu {
 	template<typename T>
 		requires std::derived_from<T, Object>
 	inline std::unique_ptr<T> Factory::Create(const std::string& name) {
-		// Convert name to lowercase for case-insensitive lookup
-		std::string key = toLower(name);
-
-		// Search for creator in registry
-		auto it = m_registry.find(key);
-		if (it != m_registry.end()) {
-			// Creator found - attempt object creation
-			auto object = it->second->Create();
-
-			// Attempt to cast to requested type T
-			T* derived = dynamic_cast<T*>(object.get());
-			if (derived) {
-				// Cast successful - transfer ownership to typed unique_ptr
-				object.release();  // Release from base unique_ptr
-				return std::unique_ptr<T>(derived);  // Create typed unique_ptr
-			}
-
-			// Cast failed - type mismatch between registered and requested type
-			LOG_ERROR("Type mismatch of factory object: {}", name);
-		}
-		else {
+		// Resolve the name to its dense id, then take the id path
+		type_id_t id = GetTypeId(name);
+		if (id == kInvalidTypeId) {
 			// Creator not found in registry
 			LOG_ERROR("Could not create factory object: {}", name);
+			return nullptr;
 		}
 
+		return Create<T>(id);
+	}
+
+	/// <summary>
+	/// Template implementation for creation by dense id.
+	/// The hot path: creator lookup is an array index, no strings involved.
+	/// </summary>
+	template<typename T>
+		requires std::derived_from<T, Object>
+	inline std::unique_ptr<T> Factory::Create(type_id_t id) {
+		if (id >= m_creators.size() || !m_creators[id]) {
+			LOG_ERROR("Invalid factory type id: {}", id);
+			return nullptr;
+		}
+
+		// Creator found - attempt object creation
+		auto object = m_creators[id]->Create();
+
+		// every creation already is an Object - skip the RTTI check entirely
+		if constexpr (std::is_same_v<T, Object>) {
+			return object;
+		}
+
+		// Attempt to cast to requested type T
+		T* derived = dynamic_cast<T*>(object.get());
+		if (derived) {
+			// Cast successful - transfer ownership to typed unique_ptr
+			object.release();  // Release from base unique_ptr
+			return std::unique_ptr<T>(derived);  // Create typed unique_ptr
+		}
+
+		// Cast failed - type mismatch between registered and requested type
+		LOG_ERROR("Type mismatch of factory object id: {}", id);
+
 		// Return nullptr on any failure (not found or type mismatch)
 		return nullptr;
 	}
 
+	/// <summary>
+	/// Template implementation for prototype lookup.
+	/// Constructor-based creators report no prototype, so callers fall back
+	/// to the regular Create() path.
+	/// </summary>
+	template<typename T>
+		requires std::derived_from<T, Object>
+	inline T* Factory::GetPrototype(const std::string& name) {
+		type_id_t id = GetTypeId(name);
+		if (id == kInvalidTypeId) return nullptr;
+
+		return dynamic_cast<T*>(m_creators[id]->GetPrototype());
+	}
+
 	/// <summary>
 	/// Convenience function for creating Actor instances with default transform.
 	/// This is a wrapper around Factory::Create() specifically for Actor-derived types.
@@ -321,4 +494,13 @@ namespace neu {
 		instance->transform = transform;
 		return instance;
 	}
+
+	// compile throughput: the creation specializations scene instantiation
+	// and component deserialization hit everywhere instantiate once in
+	// Factory.cpp - these declarations keep includers from compiling the
+	// Create bodies themselves
+	extern template std::unique_ptr<Actor> Factory::Create<Actor>(const std::string&);
+	extern template std::unique_ptr<Actor> Factory::Create<Actor>(Factory::type_id_t);
+	extern template std::unique_ptr<Component> Factory::Create<Component>(const std::string&);
+	extern template std::unique_ptr<Component> Factory::Create<Component>(Factory::type_id_t);
 }
\ No newline at end of file
@@ -1,6 +1,16 @@
 #include "File.h"
+#include "AssetPack.h"
+#include "Compression.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <mutex>
 #include <sstream>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 #include <cstdint>
 
@@ -74,9 +84,43 @@ namespace neu::file {
         std::error_code ec;
         // Check existence using error_code version to avoid exceptions
         bool result = std::filesystem::exists(path, ec);
+        if (!ec && result) return true;
 
-        // Return true only if no error occurred AND the path exists
-        return !ec && result;
+        // not on disk - a mounted pack may still serve it
+        size_t size, rawSize;
+        return FindPacked(path, size, rawSize) != nullptr;
+    }
+
+    /// <summary>
+    /// Retrieves the last modification time of a file as an opaque tick count.
+    /// Only meaningful for comparison against other values from this function.
+    /// </summary>
+    /// <param name="path">The path to the file to query</param>
+    /// <returns>The modification time in filesystem clock ticks, or 0 on error</returns>
+    uint64_t GetModifiedTime(const std::string& path) {
+        std::error_code ec;
+        // Use error_code version to avoid exceptions on missing files
+        auto time = std::filesystem::last_write_time(path, ec);
+        if (ec) return 0;
+
+        return (uint64_t)time.time_since_epoch().count();
+    }
+
+    /// <summary>
+    /// Retrieves the size of a file in bytes, pack-transparently.
+    /// </summary>
+    /// <param name="path">The path to the file to query</param>
+    /// <returns>The file size in bytes, or 0 on error</returns>
+    uint64_t GetSize(const std::string& path) {
+        std::error_code ec;
+        uint64_t size = (uint64_t)std::filesystem::file_size(path, ec);
+        if (!ec) return size;
+
+        // not on disk - a mounted pack may still serve it
+        size_t packedSize, rawSize;
+        if (FindPacked(path, packedSize, rawSize)) return rawSize;
+
+        return 0;
     }
 
     /// <summary>
@@ -142,8 +186,21 @@ namespace neu::file {
     /// <returns>True if the file was successfully read; false otherwise.</returns>
     bool ReadTextFile(const std::string& path, std::string& content) {
         // Open file in text mode (default)
+        // Loose files take priority over packed entries so development
+        // edits work without repacking
         std::ifstream file(path);
         if (!file.is_open()) {
+            // not on disk - serve from a mounted pack mapping
+            size_t size, rawSize;
+            const uint8_t* data = FindPacked(path, size, rawSize);
+            if (data) {
+                if (rawSize == size) {
+                    content.assign((const char*)data, size);
+                    return true;
+                }
+                content.resize(rawSize);
+                return compress::DecompressEntry(data, size, (uint8_t*)content.data(), rawSize);
+            }
             return false; // File doesn't exist or cannot be opened
         }
 
@@ -189,8 +246,23 @@ namespace neu::file {
     /// <returns>True if the file was successfully read; false otherwise.</returns>
     bool ReadBinaryFile(const std::string& path, std::vector<uint8_t>& data) {
         // Open file in binary mode to preserve all bytes
+        // Loose files take priority over packed entries
         std::ifstream file(path, std::ios::binary);
         if (!file.is_open()) {
+            // not on disk - serve from a mounted pack mapping. Compressed
+            // entries decode right here, which for async loads is the I/O
+            // worker thread - decompression overlaps the mapping paging in
+            // instead of adding main-thread time
+            size_t packedSize, rawSize;
+            const uint8_t* packed = FindPacked(path, packedSize, rawSize);
+            if (packed) {
+                if (rawSize == packedSize) {
+                    data.assign(packed, packed + packedSize);
+                    return true;
+                }
+                data.resize(rawSize);
+                return compress::DecompressEntry(packed, packedSize, data.data(), rawSize);
+            }
             return false; // File doesn't exist or cannot be opened
         }
 
@@ -215,6 +287,60 @@ namespace neu::file {
         return file.good();
     }
 
+    /// <summary>
+    /// Reads a byte range from a binary file without loading the whole file.
+    /// Validates the range against the file size before reading, so a
+    /// truncated asset fails cleanly instead of returning short data.
+    /// </summary>
+    /// <param name="path">The path to the binary file to read.</param>
+    /// <param name="offset">Byte offset of the start of the range.</param>
+    /// <param name="size">Number of bytes to read.</param>
+    /// <param name="data">A reference to a vector that will be resized and filled with the range's contents.</param>
+    /// <returns>True if the range was successfully read; false otherwise.</returns>
+    bool ReadBinaryFileRegion(const std::string& path, size_t offset, size_t size, std::vector<uint8_t>& data) {
+        // Open file in binary mode to preserve all bytes
+        // Loose files take priority over packed entries
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            // not on disk - slice the region straight out of a mounted
+            // pack mapping, no open/seek at all. Compressed entries decode
+            // only the 64 KB blocks the range touches, skipping the rest
+            size_t packedSize, rawSize;
+            const uint8_t* packed = FindPacked(path, packedSize, rawSize);
+            if (packed) {
+                if (offset + size > rawSize) return false;
+                if (rawSize == packedSize) {
+                    data.assign(packed + offset, packed + offset + size);
+                    return true;
+                }
+                data.resize(size);
+                return compress::DecompressEntryRange(packed, packedSize, rawSize, offset, size, data.data());
+            }
+            return false; // File doesn't exist or cannot be opened
+        }
+
+        // Get file size by seeking to end
+        file.seekg(0, std::ios::end);
+        size_t fileSize = file.tellg();
+
+        // Reject ranges that extend past the end of the file
+        if (!file.good() || offset + size > fileSize) {
+            return false;
+        }
+
+        // Seek to the start of the requested range
+        file.seekg(offset, std::ios::beg);
+
+        // Resize vector to accommodate the range
+        data.resize(size);
+
+        // Read the range into vector's data buffer
+        file.read(reinterpret_cast<char*>(data.data()), size);
+
+        // Verify read was successful
+        return file.good();
+    }
+
     /// <summary>
     /// Writes binary data to a file at the specified path.
     /// Creates/overwrites file in binary mode, preserving all bytes exactly as provided.
@@ -236,4 +362,268 @@ namespace neu::file {
         // Return success status (file automatically closed by destructor)
         return file.good();
     }
+
+    namespace {
+        /// <summary>
+        /// One queued asynchronous read. Whole-file reads have region false;
+        /// region reads carry their byte range and are the coalescing
+        /// candidates. Cancellation only suppresses the callback - the read
+        /// itself may already be running on an I/O thread.
+        /// </summary>
+        struct ReadRequest {
+            ReadHandle handle{ kInvalidRead };
+            std::string path;
+            size_t offset{ 0 };
+            size_t size{ 0 };
+            bool region{ false };
+            ReadPriority priority{ ReadPriority::Blocking };
+            ReadCallback onComplete;
+            std::vector<uint8_t> data;
+            bool success{ false };
+            std::atomic<bool> cancelled{ false };
+        };
+
+        // region requests within this many bytes of each other on the same
+        // file travel as one spanning read - adjacent pack entries (and
+        // their small alignment gaps) cost one seek instead of one each
+        constexpr size_t kCoalesceGap = 64 * 1024;
+
+        std::mutex g_ioMutex;
+        std::condition_variable g_ioCondition;
+        std::deque<std::shared_ptr<ReadRequest>> g_ioPending[(int)ReadPriority::Count];
+        std::deque<std::shared_ptr<ReadRequest>> g_ioCompleted;
+        std::unordered_map<ReadHandle, std::shared_ptr<ReadRequest>> g_ioRequests;
+        std::vector<std::thread> g_ioThreads;
+        std::atomic<bool> g_ioRunning{ false };
+        std::atomic<uint32_t> g_ioNextHandle{ 1 };
+
+        /// <summary>
+        /// Pops the next request, Blocking queue first. Caller holds the lock.
+        /// </summary>
+        std::shared_ptr<ReadRequest> PopPending() {
+            for (auto& queue : g_ioPending) {
+                if (!queue.empty()) {
+                    auto request = queue.front();
+                    queue.pop_front();
+                    return request;
+                }
+            }
+            return nullptr;
+        }
+
+        /// <summary>
+        /// Pulls every pending region request on the same file whose range
+        /// lies within the coalescing gap of the batch's span, extending the
+        /// span as members join. Caller holds the lock.
+        /// </summary>
+        void GatherCoalescable(std::vector<std::shared_ptr<ReadRequest>>& batch, size_t& spanBegin, size_t& spanEnd) {
+            bool grew = true;
+            while (grew) {
+                grew = false;
+                for (auto& queue : g_ioPending) {
+                    for (auto iter = queue.begin(); iter != queue.end();) {
+                        auto& candidate = *iter;
+                        bool adjacent = candidate->region && candidate->path == batch[0]->path &&
+                            candidate->offset <= spanEnd + kCoalesceGap &&
+                            candidate->offset + candidate->size + kCoalesceGap >= spanBegin;
+                        if (!adjacent) { ++iter; continue; }
+
+                        spanBegin = std::min(spanBegin, candidate->offset);
+                        spanEnd = std::max(spanEnd, candidate->offset + candidate->size);
+                        batch.push_back(candidate);
+                        iter = queue.erase(iter);
+                        grew = true;
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Services one request (or one coalesced batch) on an I/O thread
+        /// and moves the results to the completion queue.
+        /// </summary>
+        void ServiceRead(std::shared_ptr<ReadRequest> request) {
+            std::vector<std::shared_ptr<ReadRequest>> batch{ request };
+            size_t spanBegin = request->offset;
+            size_t spanEnd = request->offset + request->size;
+
+            if (request->region) {
+                std::scoped_lock lock(g_ioMutex);
+                GatherCoalescable(batch, spanBegin, spanEnd);
+            }
+
+            if (batch.size() > 1) {
+                // one spanning read, sliced per request
+                std::vector<uint8_t> span;
+                if (ReadBinaryFileRegion(request->path, spanBegin, spanEnd - spanBegin, span)) {
+                    for (auto& member : batch) {
+                        member->data.assign(
+                            span.begin() + (member->offset - spanBegin),
+                            span.begin() + (member->offset - spanBegin) + member->size);
+                        member->success = true;
+                    }
+                }
+                else {
+                    // one bad range shouldn't fail its neighbours - fall
+                    // back to individual reads
+                    for (auto& member : batch) {
+                        member->success = ReadBinaryFileRegion(member->path, member->offset, member->size, member->data);
+                    }
+                }
+            }
+            else if (request->region) {
+                request->success = ReadBinaryFileRegion(request->path, request->offset, request->size, request->data);
+            }
+            else {
+                request->success = ReadBinaryFile(request->path, request->data);
+            }
+
+            std::scoped_lock lock(g_ioMutex);
+            for (auto& member : batch) {
+                g_ioCompleted.push_back(member);
+            }
+        }
+
+        /// <summary>
+        /// I/O thread loop: each thread keeps one request in flight, so the
+        /// pool's thread count is the disk queue depth.
+        /// </summary>
+        void IOLoop() {
+            while (g_ioRunning) {
+                std::shared_ptr<ReadRequest> request;
+                {
+                    std::unique_lock lock(g_ioMutex);
+                    g_ioCondition.wait(lock, []() {
+                        return !g_ioPending[0].empty() || !g_ioPending[1].empty() || !g_ioRunning;
+                    });
+                    if (!g_ioRunning) break;
+
+                    request = PopPending();
+                }
+                if (!request) continue;
+
+                // a cancelled request skips the disk entirely but still
+                // passes through completion so its handle is released
+                if (!request->cancelled) {
+                    ServiceRead(std::move(request));
+                }
+                else {
+                    std::scoped_lock lock(g_ioMutex);
+                    g_ioCompleted.push_back(std::move(request));
+                }
+            }
+        }
+
+        /// <summary>
+        /// Queues a request, or services it inline when the pool isn't
+        /// running (startup, tools) - completion still arrives via the pump
+        /// so the callback contract never changes.
+        /// </summary>
+        ReadHandle Enqueue(std::shared_ptr<ReadRequest> request) {
+            request->handle = g_ioNextHandle.fetch_add(1, std::memory_order_relaxed);
+
+            if (!g_ioRunning) {
+                request->success = request->region
+                    ? ReadBinaryFileRegion(request->path, request->offset, request->size, request->data)
+                    : ReadBinaryFile(request->path, request->data);
+                std::scoped_lock lock(g_ioMutex);
+                g_ioRequests[request->handle] = request;
+                g_ioCompleted.push_back(request);
+                return request->handle;
+            }
+
+            {
+                std::scoped_lock lock(g_ioMutex);
+                g_ioRequests[request->handle] = request;
+                g_ioPending[(int)request->priority].push_back(request);
+            }
+            g_ioCondition.notify_one();
+            return request->handle;
+        }
+    }
+
+    void StartAsyncIO(int queueDepth) {
+        if (g_ioRunning) return;
+
+        g_ioRunning = true;
+        for (int i = 0; i < queueDepth; i++) {
+            g_ioThreads.emplace_back(IOLoop);
+        }
+    }
+
+    void StopAsyncIO() {
+        if (!g_ioRunning.exchange(false)) return;
+
+        g_ioCondition.notify_all();
+        for (auto& thread : g_ioThreads) {
+            if (thread.joinable()) thread.join();
+        }
+        g_ioThreads.clear();
+
+        // queued and finished requests are dropped without callbacks - the
+        // systems that would consume them are tearing down too
+        std::scoped_lock lock(g_ioMutex);
+        for (auto& queue : g_ioPending) queue.clear();
+        g_ioCompleted.clear();
+        g_ioRequests.clear();
+    }
+
+    ReadHandle ReadAsync(const std::string& path, ReadPriority priority, ReadCallback onComplete) {
+        auto request = std::make_shared<ReadRequest>();
+        request->path = path;
+        request->priority = priority;
+        request->onComplete = std::move(onComplete);
+        return Enqueue(std::move(request));
+    }
+
+    ReadHandle ReadRegionAsync(const std::string& path, size_t offset, size_t size, ReadPriority priority, ReadCallback onComplete) {
+        auto request = std::make_shared<ReadRequest>();
+        request->path = path;
+        request->offset = offset;
+        request->size = size;
+        request->region = true;
+        request->priority = priority;
+        request->onComplete = std::move(onComplete);
+        return Enqueue(std::move(request));
+    }
+
+    void CancelRead(ReadHandle handle) {
+        std::scoped_lock lock(g_ioMutex);
+        auto iter = g_ioRequests.find(handle);
+        if (iter != g_ioRequests.end()) {
+            iter->second->cancelled = true;
+        }
+    }
+
+    void PumpReadCompletions(float budgetSeconds) {
+        auto start = std::chrono::steady_clock::now();
+
+        while (true) {
+            std::shared_ptr<ReadRequest> request;
+            {
+                std::scoped_lock lock(g_ioMutex);
+                if (g_ioCompleted.empty()) break;
+
+                request = g_ioCompleted.front();
+                g_ioCompleted.pop_front();
+                g_ioRequests.erase(request->handle);
+            }
+
+            if (!request->cancelled && request->onComplete) {
+                request->onComplete(request->success, request->data);
+            }
+
+            // spread remaining completions across future frames once over
+            // budget, same policy as ResourceManager::Update
+            std::chrono::duration<float> elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed.count() >= budgetSeconds) break;
+        }
+    }
+
+    size_t GetPendingReadCount() {
+        std::scoped_lock lock(g_ioMutex);
+        size_t count = 0;
+        for (auto& queue : g_ioPending) count += queue.size();
+        return count;
+    }
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include <filesystem>
+#include <functional>
 #include <string>
 #include <vector>
 #include <cstdint>
@@ -68,6 +69,26 @@ namespace neu::file {
     /// <returns>True if the file or directory exists and is accessible, false otherwise</returns>
     bool Exists(const std::string& path);
 
+    /// <summary>
+    /// Retrieves the last modification time of a file as an opaque tick count.
+    /// The value is only meaningful for comparison against other values from
+    /// this function (e.g. checking whether a cooked file is older than its
+    /// source). Uses error-safe filesystem operations to avoid exceptions.
+    /// </summary>
+    /// <param name="path">The path to the file to query</param>
+    /// <returns>The modification time in filesystem clock ticks, or 0 if the file does not exist or an error occurs</returns>
+    uint64_t GetModifiedTime(const std::string& path);
+
+    /// <summary>
+    /// Retrieves the size of a file in bytes. Like the read functions this
+    /// is pack-transparent: a file served from a mounted pack reports its
+    /// uncompressed size. Uses error-safe filesystem operations to avoid
+    /// exceptions.
+    /// </summary>
+    /// <param name="path">The path to the file to query</param>
+    /// <returns>The file size in bytes, or 0 if the file does not exist or an error occurs</returns>
+    uint64_t GetSize(const std::string& path);
+
     /// <summary>
     /// Retrieves a list of regular files in the specified directory.
     /// This function performs a non-recursive directory scan, returning only files
@@ -123,6 +144,18 @@ namespace neu::file {
     /// <returns>True if the file was successfully opened and read, false if the file doesn't exist, cannot be accessed, or read errors occur</returns>
     bool ReadBinaryFile(const std::string& path, std::vector<uint8_t>& data);
 
+    /// <summary>
+    /// Reads a byte range from a binary file without loading the whole file.
+    /// Used by streaming systems that pull individual chunks (such as texture
+    /// mip levels) out of large cooked assets on demand.
+    /// </summary>
+    /// <param name="path">The path to the binary file to read</param>
+    /// <param name="offset">Byte offset of the start of the range</param>
+    /// <param name="size">Number of bytes to read</param>
+    /// <param name="data">A reference to a vector that will be resized and filled with the range's contents</param>
+    /// <returns>True if the range was successfully read, false if the file doesn't exist or the range extends past the end of the file</returns>
+    bool ReadBinaryFileRegion(const std::string& path, size_t offset, size_t size, std::vector<uint8_t>& data);
+
     /// <summary>
     /// Writes binary data to a file at the specified path.
     /// Creates a new file or completely overwrites an existing file with the provided binary data.
@@ -133,4 +166,97 @@ namespace neu::file {
     /// <param name="data">The binary data to write to the file</param>
     /// <returns>True if the file was successfully created and written, false if the path is invalid or write access is denied</returns>
     bool WriteBinaryFile(const std::string& path, const std::vector<uint8_t>& data);
+
+    /// <summary>
+    /// Priority class of an asynchronous read. Blocking reads (a load the
+    /// frame is actually waiting on) always dispatch before Streaming reads
+    /// (speculative work like texture mip streaming), so a burst of
+    /// streaming traffic can't delay a load the player is staring at.
+    /// </summary>
+    enum class ReadPriority : uint8_t {
+        Blocking,
+        Streaming,
+
+        Count
+    };
+
+    /// <summary>
+    /// Identifies an in-flight asynchronous read for cancellation.
+    /// 0 is never a valid handle.
+    /// </summary>
+    using ReadHandle = uint32_t;
+    constexpr ReadHandle kInvalidRead = 0;
+
+    /// <summary>
+    /// Completion callback for asynchronous reads, invoked on the main
+    /// thread from PumpReadCompletions. The data vector belongs to the
+    /// request and may be moved from.
+    /// </summary>
+    using ReadCallback = std::function<void(bool success, std::vector<uint8_t>& data)>;
+
+    /// <summary>
+    /// Starts the asynchronous read service with the given queue depth -
+    /// the number of requests kept in flight against the OS at once, one
+    /// per I/O thread. Depth above one lets the OS scheduler reorder seeks
+    /// instead of serving strictly one request at a time.
+    /// </summary>
+    /// <param name="queueDepth">Concurrent in-flight reads (and I/O threads)</param>
+    void StartAsyncIO(int queueDepth = 8);
+
+    /// <summary>
+    /// Stops the asynchronous read service, joining the I/O threads and
+    /// dropping any queued requests without invoking their callbacks.
+    /// </summary>
+    void StopAsyncIO();
+
+    /// <summary>
+    /// Queues an asynchronous whole-file read. The read runs on an I/O
+    /// thread (or synchronously if the service isn't running) and the
+    /// callback is delivered on the main thread by PumpReadCompletions.
+    /// </summary>
+    /// <param name="path">The path to the binary file to read</param>
+    /// <param name="priority">Dispatch class - Blocking reads go first</param>
+    /// <param name="onComplete">Invoked on the main thread with the result</param>
+    /// <returns>Handle identifying the request, usable with CancelRead</returns>
+    ReadHandle ReadAsync(const std::string& path, ReadPriority priority, ReadCallback onComplete);
+
+    /// <summary>
+    /// Queues an asynchronous byte-range read, the async counterpart of
+    /// ReadBinaryFileRegion. Pending requests for nearby ranges of the same
+    /// file are coalesced into one spanning read and sliced per request, so
+    /// adjacent pack-file entries cost one seek instead of one each.
+    /// </summary>
+    /// <param name="path">The path to the binary file to read</param>
+    /// <param name="offset">Byte offset of the start of the range</param>
+    /// <param name="size">Number of bytes to read</param>
+    /// <param name="priority">Dispatch class - Blocking reads go first</param>
+    /// <param name="onComplete">Invoked on the main thread with the result</param>
+    /// <returns>Handle identifying the request, usable with CancelRead</returns>
+    ReadHandle ReadRegionAsync(const std::string& path, size_t offset, size_t size, ReadPriority priority, ReadCallback onComplete);
+
+    /// <summary>
+    /// Cancels an in-flight read. The callback will not be invoked; the
+    /// read itself may still complete on its I/O thread and be discarded.
+    /// Safe to call with a handle that already completed.
+    /// </summary>
+    /// <param name="handle">Handle returned by ReadAsync or ReadRegionAsync</param>
+    void CancelRead(ReadHandle handle);
+
+    /// <summary>
+    /// Delivers finished reads' callbacks on the calling (main) thread
+    /// under a time budget, mirroring ResourceManager::Update - called once
+    /// per frame by Engine::Update so uploads and parses triggered by
+    /// completions spread across frames instead of spiking one.
+    /// </summary>
+    /// <param name="budgetSeconds">Maximum time to spend delivering completions</param>
+    void PumpReadCompletions(float budgetSeconds = 0.002f);
+
+    /// <summary>
+    /// Number of queued asynchronous reads not yet dispatched to an I/O
+    /// thread, across both priority classes. A sustained non-zero depth
+    /// means disk is the streaming bottleneck; the telemetry service
+    /// publishes it for exactly that diagnosis.
+    /// </summary>
+    /// <returns>Reads waiting for an I/O thread</returns>
+    size_t GetPendingReadCount();
 }
\ No newline at end of file
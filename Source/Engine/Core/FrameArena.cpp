@@ -0,0 +1,64 @@
+#include "FrameArena.h"
+#include "Logger.h"
+#include "MemoryTracker.h"
+#include "Math/Math.h"
+
+namespace neu {
+
+	bool FrameArena::Initialize(size_t capacity)
+	{
+		s_buffer = (uint8_t*)::operator new(capacity, std::align_val_t{ alignof(std::max_align_t) });
+		MemoryTracker::Track(MemTag::Core, s_buffer, capacity);
+		s_capacity = capacity;
+		s_offset.store(0, std::memory_order_relaxed);
+		s_highWater = 0;
+
+		return true;
+	}
+
+	void FrameArena::Shutdown()
+	{
+		if (s_buffer) {
+			MemoryTracker::Untrack(MemTag::Core, s_buffer, s_capacity);
+			::operator delete(s_buffer, std::align_val_t{ alignof(std::max_align_t) });
+			s_buffer = nullptr;
+			s_capacity = 0;
+		}
+	}
+
+	void* FrameArena::Allocate(size_t size, size_t alignment)
+	{
+		if (s_buffer) {
+			size_t offset = s_offset.load(std::memory_order_relaxed);
+			for (;;) {
+				size_t aligned = (offset + alignment - 1) & ~(alignment - 1);
+				size_t end = aligned + size;
+				if (end > s_capacity) break;
+
+				if (s_offset.compare_exchange_weak(offset, end, std::memory_order_relaxed)) {
+					return s_buffer + aligned;
+				}
+			}
+
+			// exhausted - warn once so the capacity gets revisited, then
+			// degrade to heap allocations for the rest of the run
+			static bool warned = false;
+			if (!warned) {
+				warned = true;
+				LOG_WARNING("Frame arena exhausted ({} bytes), falling back to heap", s_capacity);
+			}
+		}
+
+		// fallback allocations are accounted individually - arena memory is
+		// covered by the backing block tracked at Initialize
+		void* pointer = ::operator new(size, std::align_val_t{ alignment });
+		MemoryTracker::Track(MemTag::Core, pointer, size);
+		return pointer;
+	}
+
+	void FrameArena::Reset()
+	{
+		s_highWater = math::max(s_highWater, s_offset.load(std::memory_order_relaxed));
+		s_offset.store(0, std::memory_order_relaxed);
+	}
+}
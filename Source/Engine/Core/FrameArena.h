@@ -0,0 +1,115 @@
+#pragma once
+#include "MemoryTracker.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <new>
+#include <vector>
+
+namespace neu {
+
+	/// <summary>
+	/// Linear allocator for per-frame transient memory.
+	///
+	/// Allocation is a single atomic bump of an offset into one large block,
+	/// and nothing is ever freed individually - Engine::Update resets the
+	/// offset once per frame, returning the whole block at zero cost. Use it
+	/// (through FrameAllocator / frame_vector / frame_map) for containers
+	/// that live no longer than the frame that built them, such as the
+	/// component slices and draw batches in Scene::Update/Draw; steady-state
+	/// frames then touch the global heap not at all.
+	///
+	/// If the arena runs out (or hasn't been initialized yet) allocations
+	/// fall back to the global heap, so overflow degrades performance rather
+	/// than correctness.
+	/// </summary>
+	class FrameArena {
+	public:
+		static constexpr size_t kDefaultCapacity = 8 * 1024 * 1024;
+
+		/// <summary>
+		/// Allocates the backing block. Called from Engine::Initialize.
+		/// </summary>
+		static bool Initialize(size_t capacity = kDefaultCapacity);
+
+		/// <summary>
+		/// Frees the backing block. Called from Engine::Shutdown.
+		/// </summary>
+		static void Shutdown();
+
+		/// <summary>
+		/// Bumps the offset and returns a block of at least size bytes with
+		/// the requested alignment. Falls back to the global heap when the
+		/// arena is exhausted or not yet initialized.
+		/// </summary>
+		static void* Allocate(size_t size, size_t alignment);
+
+		/// <summary>
+		/// Returns true if the pointer came from the arena block (as opposed
+		/// to a heap fallback allocation).
+		/// </summary>
+		static bool Owns(const void* pointer) {
+			const uint8_t* p = (const uint8_t*)pointer;
+			return s_buffer && p >= s_buffer && p < s_buffer + s_capacity;
+		}
+
+		/// <summary>
+		/// Returns the whole block in one step. Called once per frame from
+		/// Engine::Update; anything allocated last frame is now invalid.
+		/// </summary>
+		static void Reset();
+
+		/// <summary>
+		/// Bytes allocated so far this frame.
+		/// </summary>
+		static size_t GetUsed() { return s_offset.load(std::memory_order_relaxed); }
+
+		/// <summary>
+		/// Largest per-frame usage seen, for sizing the arena.
+		/// </summary>
+		static size_t GetHighWater() { return s_highWater; }
+
+	private:
+		inline static uint8_t* s_buffer{ nullptr };
+		inline static size_t s_capacity{ 0 };
+		inline static std::atomic<size_t> s_offset{ 0 };
+		inline static size_t s_highWater{ 0 };
+	};
+
+	/// <summary>
+	/// STL-compatible allocator adapter over the frame arena. Deallocation
+	/// is a no-op for arena memory (the frame reset reclaims it wholesale)
+	/// and only releases heap fallback allocations.
+	/// </summary>
+	/// <typeparam name="T">Element type allocated by the adapter</typeparam>
+	template<typename T>
+	class FrameAllocator {
+	public:
+		using value_type = T;
+
+		FrameAllocator() = default;
+		template<typename U> FrameAllocator(const FrameAllocator<U>&) {}
+
+		T* allocate(size_t count) {
+			return (T*)FrameArena::Allocate(count * sizeof(T), alignof(T));
+		}
+
+		void deallocate(T* pointer, size_t count) {
+			if (!FrameArena::Owns(pointer)) {
+				MemoryTracker::Untrack(MemTag::Core, pointer, count * sizeof(T));
+				::operator delete(pointer, std::align_val_t{ alignof(T) });
+			}
+		}
+
+		template<typename U> bool operator==(const FrameAllocator<U>&) const { return true; }
+		template<typename U> bool operator!=(const FrameAllocator<U>&) const { return false; }
+	};
+
+	// container aliases for frame-lifetime scratch data
+	template<typename T>
+	using frame_vector = std::vector<T, FrameAllocator<T>>;
+
+	template<typename K, typename V, typename C = std::less<K>>
+	using frame_map = std::map<K, V, C, FrameAllocator<std::pair<const K, V>>>;
+}
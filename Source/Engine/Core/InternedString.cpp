@@ -0,0 +1,53 @@
+#include "InternedString.h"
+#include <cctype>
+#include <mutex>
+#include <unordered_set>
+
+namespace neu {
+	namespace {
+		// case-insensitive FNV-1a, same scheme the resource cache and event
+		// ids use - transparent so lookups hash a string_view directly
+		struct CaseInsensitiveHash {
+			using is_transparent = void;
+			size_t operator()(std::string_view text) const {
+				uint64_t hash = 14695981039346656037ull;
+				for (char c : text) {
+					hash ^= static_cast<uint64_t>(std::tolower(static_cast<unsigned char>(c)));
+					hash *= 1099511628211ull;
+				}
+				return static_cast<size_t>(hash);
+			}
+		};
+
+		struct CaseInsensitiveEqual {
+			using is_transparent = void;
+			bool operator()(std::string_view a, std::string_view b) const {
+				if (a.size() != b.size()) return false;
+				for (size_t i = 0; i < a.size(); i++) {
+					if (std::tolower(static_cast<unsigned char>(a[i])) !=
+						std::tolower(static_cast<unsigned char>(b[i]))) return false;
+				}
+				return true;
+			}
+		};
+	}
+
+	bool InternedString::operator==(std::string_view text) const {
+		return CaseInsensitiveEqual{}(*m_text, text);
+	}
+
+	const std::string* InternedString::Intern(std::string_view text) {
+		if (text.empty()) return &s_empty;
+
+		// node-based set, so entry addresses stay stable as the table grows.
+		// The mutex covers loads interning from the resource workers; the
+		// steady state (text already present) is a hash and one lookup
+		static std::mutex mutex;
+		static std::unordered_set<std::string, CaseInsensitiveHash, CaseInsensitiveEqual> table;
+
+		std::lock_guard lock(mutex);
+		auto iter = table.find(text);
+		if (iter == table.end()) iter = table.emplace(text).first;
+		return &*iter;
+	}
+}
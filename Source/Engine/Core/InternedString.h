@@ -0,0 +1,79 @@
+#pragma once
+#include <format>
+#include <string>
+#include <string_view>
+
+namespace neu {
+	/// <summary>
+	/// Interned identifier string. Every distinct text is stored once in a
+	/// global table and an InternedString is just a pointer into it, so
+	/// copies are trivial and equality is a single pointer compare instead
+	/// of a character walk. Identity is case-insensitive (matching the
+	/// engine's name/tag/resource-id conventions), with the first-seen
+	/// casing kept for display. Table entries are never freed, which is the
+	/// right trade for identifiers - the set of distinct names a game uses
+	/// is small and stable.
+	///
+	/// Interning costs one hash of the text (no allocation when the text is
+	/// already in the table), so construct once and hold the result rather
+	/// than interning inside a per-frame loop.
+	/// </summary>
+	class InternedString {
+	public:
+		InternedString() = default;
+		InternedString(const char* text) : m_text{ Intern(text) } {}
+		InternedString(const std::string& text) : m_text{ Intern(text) } {}
+		InternedString(std::string_view text) : m_text{ Intern(text) } {}
+
+		const std::string& str() const { return *m_text; }
+		const char* c_str() const { return m_text->c_str(); }
+		bool empty() const { return m_text->empty(); }
+		size_t size() const { return m_text->size(); }
+
+		operator const std::string& () const { return *m_text; }
+
+		// O(1) - equal identifiers share one table entry, so this is the
+		// case-insensitive comparison the string-based queries used to do
+		bool operator==(const InternedString& other) const { return m_text == other.m_text; }
+
+		// comparisons against raw text (not interned), case-insensitive.
+		// The char*/string forms exist so literals pick text comparison
+		// over an implicit intern of the operand
+		bool operator==(std::string_view text) const;
+		bool operator==(const char* text) const { return *this == std::string_view{ text }; }
+		bool operator==(const std::string& text) const { return *this == std::string_view{ text }; }
+
+		// table entry pointer, the identity std::hash hashes
+		const std::string* data() const { return m_text; }
+
+	private:
+		static const std::string* Intern(std::string_view text);
+
+		// empty string shared by default-constructed instances, so m_text
+		// is always dereferenceable
+		inline static const std::string s_empty;
+
+		const std::string* m_text{ &s_empty };
+	};
+}
+
+/// <summary>
+/// Identity hash - interning already collapsed equal text to one entry.
+/// </summary>
+template<>
+struct std::hash<neu::InternedString> {
+	size_t operator()(const neu::InternedString& text) const {
+		return std::hash<const void*>{}(text.data());
+	}
+};
+
+/// <summary>
+/// std::format support, so interned names drop into the LOG_* macros like
+/// the plain strings they replaced.
+/// </summary>
+template<>
+struct std::formatter<neu::InternedString> : std::formatter<std::string> {
+	auto format(const neu::InternedString& text, std::format_context& ctx) const {
+		return std::formatter<std::string>::format(text.str(), ctx);
+	}
+};
@@ -0,0 +1,259 @@
+#include "JobSystem.h"
+#include "Logger.h"
+#include "../Math/Math.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+namespace neu {
+    /// <summary>
+    /// Physical core count from the OS topology, cached after the first
+    /// query. On SMT machines this is half (or less) of the logical count -
+    /// sizing workers by logical threads puts two workers on one core's
+    /// execution resources and fights the driver's threads for the rest.
+    /// </summary>
+    int JobSystem::GetPhysicalCoreCount() {
+        static int count = []() {
+#ifdef _WIN32
+            DWORD length = 0;
+            GetLogicalProcessorInformation(nullptr, &length);
+            if (length > 0) {
+                std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> info(length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+                if (GetLogicalProcessorInformation(info.data(), &length)) {
+                    int cores = 0;
+                    for (auto& entry : info) {
+                        if (entry.Relationship == RelationProcessorCore) cores++;
+                    }
+                    if (cores > 0) return cores;
+                }
+            }
+#endif
+            // topology query unavailable - the logical count oversubscribes
+            // SMT cores but keeps every core fed
+            return math::max(1, (int)std::thread::hardware_concurrency());
+        }();
+        return count;
+    }
+
+    /// <summary>
+    /// Pins a worker to the logical processors of one physical core. The
+    /// mask assumes the OS enumerates a core's SMT siblings contiguously,
+    /// which holds on the platforms we ship on; it's a hint either way -
+    /// a wrong mask costs locality, not correctness.
+    /// </summary>
+    void JobSystem::PinToPhysicalCore([[maybe_unused]] std::thread& thread, [[maybe_unused]] int core) {
+#ifdef _WIN32
+        int logical = math::max(1, (int)std::thread::hardware_concurrency());
+        int perCore = math::max(1, logical / GetPhysicalCoreCount());
+        if (core * perCore >= logical) return;
+
+        DWORD_PTR mask = ((DWORD_PTR(1) << perCore) - 1) << (core * perCore);
+        SetThreadAffinityMask(thread.native_handle(), mask);
+#endif
+    }
+
+    /// <summary>
+    /// Starts the worker threads and their queues. The default count leaves
+    /// two physical cores free: one for the main thread and one as headroom
+    /// for the GL driver's and the audio mixer's internal threads - those
+    /// run every frame whether we budget for them or not, and starving them
+    /// shows up as unexplained main-thread stalls. Workers are pinned to
+    /// physical cores 1..N; core 0 (main thread) and the last core
+    /// (headroom) stay unpinned.
+    /// </summary>
+    bool JobSystem::Initialize(int workerCount, bool pinWorkers) {
+        int physicalCores = GetPhysicalCoreCount();
+        if (workerCount <= 0) {
+            workerCount = math::max(1, physicalCores - 2);
+        }
+
+        m_running = true;
+
+        for (int i = 0; i < workerCount; i++) {
+            m_queues.push_back(std::make_unique<WorkerQueue>());
+        }
+        for (int i = 0; i < workerCount; i++) {
+            m_workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+
+            // hint worker i onto physical core i + 1, skipping core 0 where
+            // the main thread lives; only when the machine has the cores to
+            // spare - pinning two workers to one core is worse than none
+            if (pinWorkers && workerCount + 1 < physicalCores) {
+                PinToPhysicalCore(m_workers.back(), i + 1);
+            }
+        }
+
+        LOG_INFO("Job system started with {} workers ({} physical cores).", workerCount, physicalCores);
+
+        return true;
+    }
+
+    /// <summary>
+    /// Stops and joins all worker threads.
+    /// </summary>
+    void JobSystem::Shutdown() {
+        // flip the flag and notify under the wake mutex, same reason as
+        // Submit - an unlocked notify_all can race a worker into a wait it
+        // never leaves, hanging the join below
+        {
+            std::lock_guard<std::mutex> lock(m_wakeMutex);
+            m_running = false;
+            m_wakeCondition.notify_all();
+        }
+
+        for (auto& worker : m_workers) {
+            if (worker.joinable()) worker.join();
+        }
+
+        m_workers.clear();
+        m_queues.clear();
+        m_pendingJobs = 0;
+    }
+
+    /// <summary>
+    /// Queues a job round-robin on one of the worker queues and wakes a
+    /// worker. Background jobs land on a separate deque that PopJob only
+    /// reaches once every frame-critical queue in the system is empty.
+    /// </summary>
+    void JobSystem::Submit(job_t job, JobPriority priority) {
+        // no workers - run inline so jobs never silently pile up
+        if (m_queues.empty()) {
+            job();
+            return;
+        }
+
+        size_t index = m_nextQueue++ % m_queues.size();
+        {
+            std::lock_guard<std::mutex> lock(m_queues[index]->mutex);
+            if (priority == JobPriority::Background) m_queues[index]->backgroundJobs.push_back(std::move(job));
+            else m_queues[index]->jobs.push_back(std::move(job));
+        }
+
+        m_pendingJobs++;
+
+        // notify under the wake mutex so the bump can't slip between a
+        // worker's predicate check and its wait - notifying unlocked loses
+        // the wakeup and the job sits until the next submit
+        {
+            std::lock_guard<std::mutex> lock(m_wakeMutex);
+            m_wakeCondition.notify_one();
+        }
+    }
+
+    /// <summary>
+    /// Partitions [0, count) into batches and runs them across the workers,
+    /// with the calling thread stealing jobs until every batch is done.
+    /// </summary>
+    void JobSystem::ParallelFor(size_t count, size_t batchSize, const std::function<void(size_t)>& function) {
+        if (count == 0) return;
+        if (batchSize == 0) batchSize = 1;
+
+        // not worth the scheduling overhead - run serially
+        if (m_workers.empty() || count <= batchSize) {
+            for (size_t i = 0; i < count; i++) function(i);
+            return;
+        }
+
+        size_t batchCount = (count + batchSize - 1) / batchSize;
+        std::atomic<size_t> batchesLeft{ batchCount };
+
+        for (size_t batch = 0; batch < batchCount; batch++) {
+            size_t start = batch * batchSize;
+            size_t end = math::min(start + batchSize, count);
+
+            // function and batchesLeft outlive the jobs - ParallelFor does
+            // not return until batchesLeft reaches zero
+            Submit([&function, &batchesLeft, start, end]() {
+                for (size_t i = start; i < end; i++) function(i);
+                batchesLeft--;
+            });
+        }
+
+        // help drain the queues instead of blocking, stealing batches the
+        // workers haven't picked up yet
+        job_t job;
+        while (batchesLeft > 0) {
+            if (PopJob(-1, job)) {
+                job();
+            }
+            else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    /// <summary>
+    /// Worker thread main loop - run jobs while any are pending, sleep on the
+    /// wake condition otherwise.
+    /// </summary>
+    void JobSystem::WorkerLoop(int workerIndex) {
+        while (m_running) {
+            job_t job;
+            if (PopJob(workerIndex, job)) {
+                job();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_wakeMutex);
+            m_wakeCondition.wait(lock, [this] { return !m_running || m_pendingJobs > 0; });
+        }
+    }
+
+    /// <summary>
+    /// Pops a job from the worker's own queue (back, LIFO) or steals from
+    /// another queue (front, FIFO) when the local queue is empty. Every
+    /// frame-critical queue in the system is tried before any background
+    /// deque - a streaming burst never runs ahead of work the frame waits on.
+    /// </summary>
+    bool JobSystem::PopJob(int workerIndex, job_t& job) {
+        // local queue first - jobs submitted here are most likely cache-warm
+        if (workerIndex >= 0) {
+            auto& queue = *m_queues[workerIndex];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.jobs.empty()) {
+                job = std::move(queue.jobs.back());
+                queue.jobs.pop_back();
+                m_pendingJobs--;
+                ASSERT_SLOW(m_pendingJobs >= 0);
+                return true;
+            }
+        }
+
+        // steal from the other queues, starting after our own
+        for (size_t i = 0; i < m_queues.size(); i++) {
+            size_t index = (workerIndex + 1 + i) % m_queues.size();
+            if ((int)index == workerIndex) continue;
+
+            auto& queue = *m_queues[index];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.jobs.empty()) {
+                job = std::move(queue.jobs.front());
+                queue.jobs.pop_front();
+                m_pendingJobs--;
+                ASSERT_SLOW(m_pendingJobs >= 0);
+                return true;
+            }
+        }
+
+        // no frame-critical work anywhere - drain the background deques,
+        // local first, with the same steal order
+        for (size_t i = 0; i < m_queues.size(); i++) {
+            size_t index = ((size_t)math::max(workerIndex, 0) + i) % m_queues.size();
+
+            auto& queue = *m_queues[index];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.backgroundJobs.empty()) {
+                job = std::move(queue.backgroundJobs.front());
+                queue.backgroundJobs.pop_front();
+                m_pendingJobs--;
+                ASSERT_SLOW(m_pendingJobs >= 0);
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
@@ -0,0 +1,130 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace neu {
+    /// <summary>
+    /// Scheduling class for submitted jobs. FrameCritical work gates the
+    /// frame (actor update batches, draw recording) and is always drained
+    /// first; Background work (streaming, decode bursts) only runs on
+    /// workers with no frame-critical job available, so a burst of it can
+    /// never delay the work the frame is waiting on.
+    /// </summary>
+    enum class JobPriority {
+        FrameCritical,
+        Background
+    };
+
+    /// <summary>
+    /// Work-stealing job system for spreading frame work across cores.
+    ///
+    /// Each worker thread owns a double-ended queue. Workers pop jobs from
+    /// the back of their own queue (LIFO, cache-warm) and steal from the
+    /// front of other workers' queues (FIFO) when their own runs dry.
+    /// Submitted jobs are distributed round-robin across the queues.
+    ///
+    /// Worker configuration is topology-aware: the default count is
+    /// physical cores minus two, leaving one core for the main thread and
+    /// one as headroom for the GL driver's and the audio mixer's internal
+    /// threads, which otherwise get preempted and stall the frame from
+    /// outside the profiler's view. Workers are pinned to physical cores
+    /// as a hint; the main thread and the headroom core stay unpinned.
+    ///
+    /// The system is initialized by Engine::Initialize alongside the other
+    /// subsystems. ParallelFor is the main entry point for frame work such
+    /// as Scene's batched actor update - the calling thread participates in
+    /// execution and the call returns once every batch has completed.
+    /// </summary>
+    class JobSystem {
+    public:
+        using job_t = std::function<void()>;
+
+    public:
+        /// <summary>
+        /// Starts the worker threads.
+        /// </summary>
+        /// <param name="workerCount">Number of workers, 0 uses physical cores minus two (main thread + driver/audio headroom)</param>
+        /// <param name="pinWorkers">Pin each worker to its own physical core; disable when an external affinity manager owns placement</param>
+        /// <returns>True on success</returns>
+        bool Initialize(int workerCount = 0, bool pinWorkers = true);
+
+        /// <summary>
+        /// Stops and joins all worker threads. Pending jobs are discarded.
+        /// </summary>
+        void Shutdown();
+
+        /// <summary>
+        /// Queues a fire-and-forget job on one of the worker queues.
+        /// </summary>
+        /// <param name="job">Callable to execute on a worker thread</param>
+        /// <param name="priority">Scheduling class - Background jobs only run when no frame-critical job is available</param>
+        void Submit(job_t job, JobPriority priority = JobPriority::FrameCritical);
+
+        /// <summary>
+        /// Runs function(index) for every index in [0, count), partitioned
+        /// into batches executed across the workers. The calling thread helps
+        /// drain jobs and the call blocks until every batch has finished.
+        ///
+        /// Falls back to a serial loop when there are no workers or the range
+        /// fits inside a single batch.
+        /// </summary>
+        /// <param name="count">Number of iterations</param>
+        /// <param name="batchSize">Iterations per job, sized so a batch stays cache-friendly</param>
+        /// <param name="function">Callable invoked with each index</param>
+        void ParallelFor(size_t count, size_t batchSize, const std::function<void(size_t)>& function);
+
+        int GetWorkerCount() const { return (int)m_workers.size(); }
+
+        /// <summary>
+        /// Jobs submitted but not yet executed, across every queue. A
+        /// point-in-time reading for the telemetry feed and the editor -
+        /// workers are draining it concurrently.
+        /// </summary>
+        /// <returns>Pending job count at the moment of the call</returns>
+        int GetPendingJobCount() const { return m_pendingJobs.load(std::memory_order_relaxed); }
+
+        /// <summary>
+        /// Physical core count, seen through the OS topology where available.
+        /// Falls back to the logical count when the query fails - better to
+        /// oversubscribe slightly than to run single-threaded.
+        /// </summary>
+        static int GetPhysicalCoreCount();
+
+    private:
+        // per-worker job queues, back is the owner's end, front is the steal
+        // end; the background deque is only touched once every frame-critical
+        // queue in the system is empty
+        struct WorkerQueue {
+            std::deque<job_t> jobs;
+            std::deque<job_t> backgroundJobs;
+            std::mutex mutex;
+        };
+
+        void WorkerLoop(int workerIndex);
+
+        // pin a worker to the logical processors of one physical core - an
+        // affinity hint, compiled out on platforms without the API
+        static void PinToPhysicalCore(std::thread& thread, int core);
+
+        // pop from the worker's own queue, stealing from the others on a miss.
+        // workerIndex of -1 (the main thread inside ParallelFor) only steals
+        bool PopJob(int workerIndex, job_t& job);
+
+    private:
+        std::vector<std::thread> m_workers;
+        std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+
+        std::atomic<bool> m_running{ false };
+        std::atomic<size_t> m_nextQueue{ 0 };
+        std::atomic<int> m_pendingJobs{ 0 };
+
+        std::mutex m_wakeMutex;
+        std::condition_variable m_wakeCondition;
+    };
+}
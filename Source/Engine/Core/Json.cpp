@@ -2,31 +2,295 @@
 #include "File.h"
 #include "Logger.h"
 
-#include <rapidjson/istreamwrapper.h>
 #include <iostream>
+#include <cstring>
+#include <unordered_map>
 
 namespace neu::serial
 {
+    namespace {
+        // cooked document container: header, deduplicated string table,
+        // then the node stream (documents flattened in pre-order)
+        constexpr uint32_t kCookedMagic = 0x4e43534e;   // "NSCN"
+        constexpr uint32_t kCookedVersion = 1;
+        const char* kCookedExtension = ".nscn";
+
+        struct CookedHeader {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t stringBytes;   // string table size following the header
+        };
+
+        // node record tags - numbers are stored pre-converted so loading
+        // skips the text-to-number work of a JSON parse entirely
+        enum class NodeType : uint8_t {
+            Null,
+            False,
+            True,
+            Int,        // int64_t payload
+            Double,     // double payload
+            String,     // uint32_t table offset + uint32_t length
+            Array,      // uint32_t count, then count child nodes
+            Object      // uint32_t count, then count (key, child) pairs
+        };
+
+        template <typename T>
+        void Append(std::vector<uint8_t>& buffer, const T& data) {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&data);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        // adds a string to the table, reusing the existing entry when the
+        // same text appears again (member keys repeat across every actor)
+        uint32_t AddString(const char* str, uint32_t length,
+            std::vector<uint8_t>& table, std::unordered_map<std::string, uint32_t>& lookup) {
+            std::string key(str, length);
+            auto iter = lookup.find(key);
+            if (iter != lookup.end()) return iter->second;
+
+            uint32_t offset = (uint32_t)table.size();
+            table.insert(table.end(), str, str + length);
+            table.push_back('\0');
+            lookup.emplace(std::move(key), offset);
+
+            return offset;
+        }
+
+        void WriteNode(const value_t& value, std::vector<uint8_t>& nodes,
+            std::vector<uint8_t>& table, std::unordered_map<std::string, uint32_t>& lookup) {
+            switch (value.GetType()) {
+            case rapidjson::kNullType:
+                Append(nodes, NodeType::Null);
+                break;
+
+            case rapidjson::kFalseType:
+                Append(nodes, NodeType::False);
+                break;
+
+            case rapidjson::kTrueType:
+                Append(nodes, NodeType::True);
+                break;
+
+            case rapidjson::kNumberType:
+                if (value.IsInt64()) {
+                    Append(nodes, NodeType::Int);
+                    Append(nodes, value.GetInt64());
+                }
+                else if (value.IsUint64()) {
+                    Append(nodes, NodeType::Int);
+                    Append(nodes, (int64_t)value.GetUint64());
+                }
+                else {
+                    Append(nodes, NodeType::Double);
+                    Append(nodes, value.GetDouble());
+                }
+                break;
+
+            case rapidjson::kStringType:
+                Append(nodes, NodeType::String);
+                Append(nodes, AddString(value.GetString(), value.GetStringLength(), table, lookup));
+                Append(nodes, value.GetStringLength());
+                break;
+
+            case rapidjson::kArrayType:
+                Append(nodes, NodeType::Array);
+                Append(nodes, (uint32_t)value.Size());
+                for (auto& element : value.GetArray()) {
+                    WriteNode(element, nodes, table, lookup);
+                }
+                break;
+
+            case rapidjson::kObjectType:
+                Append(nodes, NodeType::Object);
+                Append(nodes, (uint32_t)value.MemberCount());
+                for (auto& member : value.GetObject()) {
+                    Append(nodes, AddString(member.name.GetString(), member.name.GetStringLength(), table, lookup));
+                    Append(nodes, member.name.GetStringLength());
+                    WriteNode(member.value, nodes, table, lookup);
+                }
+                break;
+            }
+        }
+
+        // bounds-checked read cursor over the node stream - a truncated or
+        // corrupt file fails the load instead of walking off the buffer
+        struct Cursor {
+            const uint8_t* data{ nullptr };
+            size_t size{ 0 };
+            size_t offset{ 0 };
+
+            template <typename T>
+            bool Read(T& out) {
+                if (offset + sizeof(T) > size) return false;
+                std::memcpy(&out, data + offset, sizeof(T));
+                offset += sizeof(T);
+                return true;
+            }
+        };
+
+        bool ReadNode(Cursor& cursor, const char* strings, uint32_t stringBytes,
+            value_t& out, document_t::AllocatorType& allocator) {
+            NodeType type;
+            if (!cursor.Read(type)) return false;
+
+            switch (type) {
+            case NodeType::Null:
+                out.SetNull();
+                return true;
+
+            case NodeType::False:
+                out.SetBool(false);
+                return true;
+
+            case NodeType::True:
+                out.SetBool(true);
+                return true;
+
+            case NodeType::Int: {
+                int64_t data;
+                if (!cursor.Read(data)) return false;
+                out.SetInt64(data);
+                return true;
+            }
+
+            case NodeType::Double: {
+                double data;
+                if (!cursor.Read(data)) return false;
+                out.SetDouble(data);
+                return true;
+            }
+
+            case NodeType::String: {
+                uint32_t offset, length;
+                if (!cursor.Read(offset) || !cursor.Read(length)) return false;
+                if ((size_t)offset + length > stringBytes) return false;
+                out.SetString(strings + offset, length, allocator);
+                return true;
+            }
+
+            case NodeType::Array: {
+                uint32_t count;
+                if (!cursor.Read(count)) return false;
+                out.SetArray();
+                out.Reserve(count, allocator);
+                for (uint32_t i = 0; i < count; i++) {
+                    value_t element;
+                    if (!ReadNode(cursor, strings, stringBytes, element, allocator)) return false;
+                    out.PushBack(element, allocator);
+                }
+                return true;
+            }
+
+            case NodeType::Object: {
+                uint32_t count;
+                if (!cursor.Read(count)) return false;
+                out.SetObject();
+                out.MemberReserve(count, allocator);
+                for (uint32_t i = 0; i < count; i++) {
+                    uint32_t offset, length;
+                    if (!cursor.Read(offset) || !cursor.Read(length)) return false;
+                    if ((size_t)offset + length > stringBytes) return false;
+
+                    value_t key(strings + offset, length, allocator);
+                    value_t element;
+                    if (!ReadNode(cursor, strings, stringBytes, element, allocator)) return false;
+                    out.AddMember(key, element, allocator);
+                }
+                return true;
+            }
+
+            default:
+                return false;
+            }
+        }
+    }
+
     bool Load(const std::string& filename, document_t& document) {
+        // prefer the cooked sibling when it is up to date - the binary
+        // image loads in a linear pass instead of a text parse
+        std::string cookedName = filename + kCookedExtension;
+        uint64_t sourceTime = file::GetModifiedTime(filename);
+        uint64_t cookedTime = file::GetModifiedTime(cookedName);
+        if (cookedTime != 0 && cookedTime >= sourceTime) {
+            if (LoadCooked(cookedName, document)) return true;
+            LOG_WARNING("Could not load cooked file, falling back to Json: {}.", cookedName);
+        }
+
         // read the file into a string
-        std::string buffer;
-        if (!file::ReadTextFile(filename, buffer)) {
+        std::string text;
+        if (!file::ReadTextFile(filename, text)) {
             LOG_ERROR("Could not read file: {}.", filename);
             return false;
         }
 
-        // convert the string into a json stream
-        std::stringstream stream(buffer);
-        rapidjson::IStreamWrapper istream(stream);
+        // parse in place over a buffer owned by the document's allocator -
+        // string values reference the buffer instead of being copied out,
+        // and the buffer lives exactly as long as the document does
+        char* buffer = (char*)document.GetAllocator().Malloc(text.size() + 1);
+        std::memcpy(buffer, text.c_str(), text.size() + 1);
+        document.ParseInsitu(buffer);
 
-        // set the json document from the stream
-        document.ParseStream(istream);
         // check if the parse was successful
         if (!document.IsObject()) {
             LOG_ERROR("Could not parse Json: {}.", filename);
             return false;
         }
 
+        // rebuild the stale or missing cooked image from this parse so the
+        // next run takes the fast path - the Json stays the edited source
+        if (sourceTime != 0) SaveCooked(document, cookedName);
+
+        return true;
+    }
+
+    bool SaveCooked(const document_t& document, const std::string& filename) {
+        std::vector<uint8_t> table;
+        std::vector<uint8_t> nodes;
+        std::unordered_map<std::string, uint32_t> lookup;
+
+        WriteNode(document, nodes, table, lookup);
+
+        CookedHeader header{ kCookedMagic, kCookedVersion, (uint32_t)table.size() };
+
+        std::vector<uint8_t> buffer;
+        buffer.reserve(sizeof(CookedHeader) + table.size() + nodes.size());
+        Append(buffer, header);
+        buffer.insert(buffer.end(), table.begin(), table.end());
+        buffer.insert(buffer.end(), nodes.begin(), nodes.end());
+
+        if (!file::WriteBinaryFile(filename, buffer)) {
+            LOG_WARNING("Could not write cooked file: {}.", filename);
+            return false;
+        }
+
+        return true;
+    }
+
+    bool LoadCooked(const std::string& filename, document_t& document) {
+        std::vector<uint8_t> buffer;
+        if (!file::ReadBinaryFile(filename, buffer)) {
+            LOG_ERROR("Could not read cooked file: {}.", filename);
+            return false;
+        }
+
+        CookedHeader header;
+        if (buffer.size() < sizeof(CookedHeader)) return false;
+        std::memcpy(&header, buffer.data(), sizeof(CookedHeader));
+        if (header.magic != kCookedMagic || header.version != kCookedVersion) {
+            LOG_WARNING("Cooked file has wrong magic/version: {}.", filename);
+            return false;
+        }
+        if (sizeof(CookedHeader) + header.stringBytes > buffer.size()) return false;
+
+        const char* strings = (const char*)buffer.data() + sizeof(CookedHeader);
+        Cursor cursor{ buffer.data(), buffer.size(), sizeof(CookedHeader) + header.stringBytes };
+
+        if (!ReadNode(cursor, strings, header.stringBytes, document, document.GetAllocator()) ||
+            !document.IsObject()) {
+            LOG_ERROR("Could not read cooked file: {}.", filename);
+            return false;
+        }
+
         return true;
     }
 
@@ -69,6 +333,19 @@ namespace neu::serial
         return true;
     }
 
+    bool Read(const value_t& value, const std::string& name, InternedString& data, bool required)
+    {
+        if (!value.HasMember(name.c_str()) || !value[name.c_str()].IsString()) {
+            if (required) LOG_ERROR("Could not read Json value (string): {}.", name);
+            return false;
+        }
+
+        // intern at load, so every later comparison is a pointer compare
+        data = InternedString{ value[name.c_str()].GetString() };
+
+        return true;
+    }
+
     bool Read(const value_t& value, const std::string& name, bool& data, bool required) {
         // check if the value has the "<name>" and the correct data type
         if (!value.HasMember(name.c_str()) || !value[name.c_str()].IsBool())
@@ -154,4 +431,88 @@ namespace neu::serial
 
         return true;
     }
+
+    namespace {
+        // array-of-floats payload shared by the vector field types
+        bool ReadFloatArray(const value_t& value, float* out, rapidjson::SizeType count) {
+            if (!value.IsArray() || value.Size() != count) return false;
+
+            for (rapidjson::SizeType i = 0; i < count; i++) {
+                if (!value[i].IsNumber()) return false;
+                out[i] = value[i].GetFloat();
+            }
+
+            return true;
+        }
+    }
+
+    bool ReadFields(const value_t& value, void* object, const FieldDescriptor* fields, size_t count) {
+        if (!value.IsObject()) return false;
+
+        uint8_t* base = static_cast<uint8_t*>(object);
+
+        // one pass over the members that are actually present - each
+        // dispatches by hash into the table instead of the table probing
+        // the document field by field
+        for (auto& member : value.GetObject()) {
+            uint32_t hash = HashFieldName(member.name.GetString(), member.name.GetStringLength());
+
+            const FieldDescriptor* field = nullptr;
+            for (size_t i = 0; i < count; i++) {
+                if (fields[i].nameHash == hash) {
+                    field = &fields[i];
+                    break;
+                }
+            }
+            // unknown members are fine - custom-handled fields and
+            // forward-compatible additions land here
+            if (!field) continue;
+
+            void* data = base + field->offset;
+            bool ok = true;
+            switch (field->type) {
+            case FieldType::Bool:
+                if ((ok = member.value.IsBool())) *static_cast<bool*>(data) = member.value.GetBool();
+                break;
+
+            case FieldType::Int:
+                if ((ok = member.value.IsInt())) *static_cast<int*>(data) = member.value.GetInt();
+                break;
+
+            case FieldType::Float:
+                if ((ok = member.value.IsNumber())) *static_cast<float*>(data) = member.value.GetFloat();
+                break;
+
+            case FieldType::String:
+                if ((ok = member.value.IsString())) *static_cast<std::string*>(data) = member.value.GetString();
+                break;
+
+            case FieldType::Interned:
+                // intern at load, so every later comparison is a pointer compare
+                if ((ok = member.value.IsString())) *static_cast<InternedString*>(data) = InternedString{ member.value.GetString() };
+                break;
+
+            case FieldType::Vec2:
+                ok = ReadFloatArray(member.value, &(*static_cast<glm::vec2*>(data))[0], 2);
+                break;
+
+            case FieldType::Vec3:
+                ok = ReadFloatArray(member.value, &(*static_cast<glm::vec3*>(data))[0], 3);
+                break;
+            }
+
+            if (!ok) LOG_ERROR("Could not read Json value: {}.", member.name.GetString());
+        }
+
+        return true;
+    }
+
+    bool ReadFields(const value_t& value, void* object, int typeId, const FieldDescriptor* fields, size_t count) {
+        // registration is idempotent and the table is a function-local
+        // static at the call site, so repeat reads just restore the same
+        // pointer
+        FieldTables::Register(typeId, fields, count);
+
+        return ReadFields(value, object, fields, count);
+    }
 }
@@ -1,10 +1,13 @@
 #pragma once
+#include "InternedString.h"
 #include "Math/Vector2.h"
 #include "Math/Vector3.h"
 #include "glm/glm.hpp"
 
 #include <rapidjson/document.h>
+#include <cstddef>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #define SERIAL_READ(value, data)			neu::serial::Read(value, #data, data)
@@ -19,11 +22,136 @@ namespace neu::serial {
 
 	bool Load(const std::string& filename, document_t& document);
 
+	// Cooked binary serialization - a parsed document flattened into a
+	// versioned binary image (string table + node records) that loads with
+	// a linear binary read instead of a text parse. Load() prefers an
+	// up-to-date "<filename>.nscn" sibling and rebuilds a stale or missing
+	// one after parsing, so the JSON stays the editable source of truth.
+	bool SaveCooked(const document_t& document, const std::string& filename);
+	bool LoadCooked(const std::string& filename, document_t& document);
+
 	bool Read(const value_t& value, const std::string& name, bool& data, bool required = false);
 	bool Read(const value_t& value, const std::string& name, int& data, bool required = false);
 	bool Read(const value_t& value, const std::string& name, float& data, bool required = false);
 	bool Read(const value_t& value, const std::string& name, std::string& data, bool required = false);
+	bool Read(const value_t& value, const std::string& name, InternedString& data, bool required = false);
 	bool Read(const value_t& value, const std::string& name, glm::vec2& data, bool required = false);
 	bool Read(const value_t& value, const std::string& name, glm::vec3& data, bool required = false);
 	bool Read(const value_t& value, const std::string& name, std::vector<int>& data, bool required = false);
+
+	// --- field descriptor tables ----------------------------------------
+	// A serializable type can declare its plain fields once in a static
+	// descriptor table (name hash, byte offset, type); ReadFields() then
+	// walks the JSON object's members a single time, dispatching each by
+	// hash into the table. This replaces a HasMember string compare per
+	// field per object, and gives the cooked format and the editor one
+	// shared map of a type's fields. Fields with custom handling (named
+	// enums, resource references) stay on the Read() overloads.
+
+	enum class FieldType : uint8_t {
+		Bool,
+		Int,
+		Float,
+		String,
+		Interned,
+		Vec2,
+		Vec3,
+	};
+
+	/// <summary>
+	/// FNV-1a over a member key - constexpr so descriptor tables hash at
+	/// compile time. Case-sensitive, matching rapidjson member lookup.
+	/// </summary>
+	constexpr uint32_t HashFieldName(const char* name, size_t length) {
+		uint32_t hash = 2166136261u;
+		for (size_t i = 0; i < length; i++) {
+			hash ^= (uint32_t)(unsigned char)name[i];
+			hash *= 16777619u;
+		}
+		return hash;
+	}
+
+	constexpr uint32_t HashFieldName(std::string_view name) {
+		return HashFieldName(name.data(), name.size());
+	}
+
+	// maps a member's C++ type to its descriptor tag, so SERIAL_FIELD can't
+	// record a type that disagrees with the struct
+	template <typename T> constexpr FieldType FieldTypeOf() = delete;
+	template <> constexpr FieldType FieldTypeOf<bool>() { return FieldType::Bool; }
+	template <> constexpr FieldType FieldTypeOf<int>() { return FieldType::Int; }
+	template <> constexpr FieldType FieldTypeOf<float>() { return FieldType::Float; }
+	template <> constexpr FieldType FieldTypeOf<std::string>() { return FieldType::String; }
+	template <> constexpr FieldType FieldTypeOf<InternedString>() { return FieldType::Interned; }
+	template <> constexpr FieldType FieldTypeOf<glm::vec2>() { return FieldType::Vec2; }
+	template <> constexpr FieldType FieldTypeOf<glm::vec3>() { return FieldType::Vec3; }
+
+	// one serializable field of a type - tables are built once per type and
+	// reused for every instance
+	struct FieldDescriptor {
+		uint32_t nameHash;	// HashFieldName of the JSON key
+		uint16_t offset;	// byte offset from the object base
+		FieldType type;
+	};
+
+	/// <summary>
+	/// Reads every table field present in the value with one pass over the
+	/// object's members. Unknown members are skipped and absent fields keep
+	/// their defaults, matching SERIAL_READ semantics. Type-mismatched
+	/// members are logged and skipped.
+	/// </summary>
+	/// <param name="value">JSON object to read from</param>
+	/// <param name="object">Instance the offsets are relative to</param>
+	/// <param name="fields">The type's field descriptor table</param>
+	/// <param name="count">Number of descriptors in the table</param>
+	/// <returns>true if value is an object</returns>
+	bool ReadFields(const value_t& value, void* object, const FieldDescriptor* fields, size_t count);
+
+	/// <summary>
+	/// Central registry of field descriptor tables, keyed by the dense
+	/// component type id the table describes. Populated as a side effect of
+	/// the typed ReadFields overload below, so any component type that has
+	/// deserialized at least once is visible to systems that want to walk a
+	/// type's fields without JSON in hand (the binary scene checkpoint) -
+	/// no separate registration step, and the table of record stays the one
+	/// in the component's Read().
+	/// </summary>
+	class FieldTables {
+	public:
+		static void Register(int typeId, const FieldDescriptor* fields, size_t count) {
+			if (typeId < 0) return;
+			if (typeId >= (int)s_tables.size()) s_tables.resize(typeId + 1);
+			s_tables[typeId] = { fields, count };
+		}
+
+		/// <returns>The type's table, or nullptr (count 0) if the type never registered one</returns>
+		static const FieldDescriptor* Get(int typeId, size_t& count) {
+			if (typeId < 0 || typeId >= (int)s_tables.size()) {
+				count = 0;
+				return nullptr;
+			}
+			count = s_tables[typeId].count;
+			return s_tables[typeId].fields;
+		}
+
+	private:
+		struct Table {
+			const FieldDescriptor* fields{ nullptr };
+			size_t count{ 0 };
+		};
+
+		inline static std::vector<Table> s_tables;
+	};
+
+	/// <summary>
+	/// ReadFields plus registration: records the table under the caller's
+	/// component type id before reading. Component Read() methods pass
+	/// their typeId here so the checkpoint system sees every table in use.
+	/// </summary>
+	bool ReadFields(const value_t& value, void* object, int typeId, const FieldDescriptor* fields, size_t count);
 }
+
+// declares one row of a field descriptor table - the hash, offset and type
+// all derive from the member itself
+#define SERIAL_FIELD(T, member) \
+	neu::serial::FieldDescriptor{ neu::serial::HashFieldName(#member), (uint16_t)offsetof(T, member), neu::serial::FieldTypeOf<decltype(T::member)>() }
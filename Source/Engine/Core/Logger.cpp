@@ -0,0 +1,310 @@
+#include "Logger.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+namespace neu {
+	const char* LogCategoryName(LogCategory category) {
+		switch (category) {
+		case LogCategory::General:		return "general";
+		case LogCategory::Renderer:		return "renderer";
+		case LogCategory::Resources:	return "resources";
+		case LogCategory::Audio:		return "audio";
+		case LogCategory::Scene:		return "scene";
+		case LogCategory::Content:		return "content";
+		default:						return "unknown";
+		}
+	}
+
+	namespace {
+		/// <summary>
+		/// One queued log message. The user text is already formatted (the
+		/// arguments can't outlive the call site) but the prefix, color and
+		/// filename decoration are deferred to the writer thread.
+		/// </summary>
+		struct LogRecord {
+			LogCategory category{ LogCategory::General };
+			LogLevel level{ LogLevel::None };
+			const char* file{ "" };
+			int line{ 0 };
+			std::string message;
+		};
+
+		// ring capacity, must be a power of two so indices wrap with a mask
+		constexpr size_t kQueueCapacity = 1024;
+
+		/// <summary>
+		/// Slot of the bounded MPSC ring (Vyukov bounded queue). The sequence
+		/// number tells producers and the consumer whose turn the slot is
+		/// without any lock: it equals the claim position when free to write
+		/// and position + 1 when ready to read.
+		/// </summary>
+		struct Slot {
+			std::atomic<size_t> sequence{ 0 };
+			LogRecord record;
+		};
+
+		std::array<Slot, kQueueCapacity> g_queue;
+		std::atomic<size_t> g_enqueuePos{ 0 };
+		size_t g_dequeuePos = 0; // writer thread only
+		std::atomic<uint64_t> g_dropped{ 0 };
+
+		std::thread g_writer;
+		std::atomic<bool> g_running{ false };
+		std::once_flag g_startFlag;
+		std::mutex g_wakeMutex;
+		std::condition_variable g_wake;
+
+		/// <summary>
+		/// Per-call-site rate limiting: a small open-addressed table keyed
+		/// on the site's (__FILE__ pointer, line). String literals make the
+		/// file pointer a stable key, so no hashing of the path is needed.
+		/// Each site gets a one-second window; counts past the limit are
+		/// suppressed and reported when the window rolls.
+		/// </summary>
+		struct SiteState {
+			const char* file{ nullptr };
+			int line{ 0 };
+			uint32_t count{ 0 };
+			uint64_t window{ 0 };
+		};
+
+		constexpr size_t kSiteCapacity = 256; // power of two for mask wrap
+		std::array<SiteState, kSiteCapacity> g_sites;
+		std::mutex g_siteMutex;
+
+		/// <summary>
+		/// Recent decorated messages retained for the editor console panel -
+		/// the writer thread appends, the editor copies a snapshot.
+		/// </summary>
+		constexpr size_t kConsoleCapacity = 512;
+		std::deque<Logger::ConsoleEntry> g_console;
+		std::mutex g_consoleMutex;
+
+		/// <summary>
+		/// Claims a slot with one compare-exchange and publishes the record
+		/// by bumping the slot sequence. Returns false when the ring is full.
+		/// </summary>
+		bool TryEnqueue(LogRecord&& record) {
+			size_t pos = g_enqueuePos.load(std::memory_order_relaxed);
+			for (;;) {
+				Slot& slot = g_queue[pos & (kQueueCapacity - 1)];
+				size_t sequence = slot.sequence.load(std::memory_order_acquire);
+				intptr_t difference = (intptr_t)sequence - (intptr_t)pos;
+
+				if (difference == 0) {
+					if (g_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+						slot.record = std::move(record);
+						slot.sequence.store(pos + 1, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (difference < 0) {
+					// consumer hasn't freed this slot yet, the ring is full
+					return false;
+				}
+				else {
+					pos = g_enqueuePos.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Pops the next published record, writer thread only.
+		/// </summary>
+		bool TryDequeue(LogRecord& record) {
+			Slot& slot = g_queue[g_dequeuePos & (kQueueCapacity - 1)];
+			size_t sequence = slot.sequence.load(std::memory_order_acquire);
+			if (sequence != g_dequeuePos + 1) return false;
+
+			record = std::move(slot.record);
+			// free the slot for the producer one lap ahead
+			slot.sequence.store(g_dequeuePos + kQueueCapacity, std::memory_order_release);
+			g_dequeuePos++;
+			return true;
+		}
+
+		/// <summary>
+		/// Decorates and writes one record - the work the calling thread no
+		/// longer pays for. Same output format as the old synchronous path.
+		/// </summary>
+		void WriteRecord(const LogRecord& record) {
+			std::string prefix;
+			std::string color;
+
+			switch (record.level) {
+			case LogLevel::Info:
+				prefix = "[INFO] ";
+				color = "\033[32m"; // Green - positive/neutral information
+				break;
+			case LogLevel::Warning:
+				prefix = "[WARNING] ";
+				color = "\033[33m"; // Yellow - caution/attention needed
+				break;
+			case LogLevel::Error:
+				prefix = "[ERROR] ";
+				color = "\033[31m"; // Red - problems/failures
+				break;
+			case LogLevel::Debug:
+				prefix = "[DEBUG] ";
+				color = "\033[36m"; // Cyan - diagnostic information
+				break;
+			default:
+				prefix = "[UNKNOWN] ";
+				color = "\033[0m"; // Reset - fallback for invalid levels
+				break;
+			}
+
+			// the General channel keeps the original output shape; tagged
+			// channels show their category so filtering by eye stays easy
+			std::string category;
+			if (record.category != LogCategory::General) {
+				category = std::format("[{}] ", LogCategoryName(record.category));
+			}
+
+			// Extract just the filename from the full path for cleaner output
+			std::string filename = file::GetFilename(record.file);
+
+			// ANSI reset code to return terminal to default colors
+			const std::string reset = "\033[0m";
+
+			std::string output = std::format("{}{}{}[{}:{}] {}{}\n",
+				color, prefix, category, filename, record.line, record.message, reset);
+
+			std::cerr << output;
+
+			// retain the line for the editor console, oldest dropped first
+			std::scoped_lock lock(g_consoleMutex);
+			if (g_console.size() >= kConsoleCapacity) g_console.pop_front();
+			g_console.push_back({ record.category, record.level,
+				std::format("[{}:{}] {}", filename, record.line, record.message) });
+		}
+
+		/// <summary>
+		/// Writer thread loop: drains the ring, reports dropped messages and
+		/// sleeps until woken or a short timeout passes.
+		/// </summary>
+		void WriterLoop() {
+			LogRecord record;
+			for (;;) {
+				while (TryDequeue(record)) WriteRecord(record);
+
+				uint64_t dropped = g_dropped.exchange(0);
+				if (dropped) {
+					std::cerr << std::format("\033[33m[WARNING] logger dropped {} messages\033[0m\n", dropped);
+				}
+
+				if (!g_running.load()) {
+					// drain whatever raced in during shutdown, then stop
+					while (TryDequeue(record)) WriteRecord(record);
+					break;
+				}
+
+				std::unique_lock lock(g_wakeMutex);
+				g_wake.wait_for(lock, 10ms);
+			}
+		}
+
+		void StartWriter() {
+			// stamp every slot with its index - a slot is claimable when its
+			// sequence equals the claim position, so leaving them zeroed
+			// makes every slot past the first read as permanently full.
+			// Producers synchronize with this through the call_once in Log
+			for (size_t i = 0; i < kQueueCapacity; i++) {
+				g_queue[i].sequence.store(i, std::memory_order_relaxed);
+			}
+
+			g_running.store(true);
+			g_writer = std::thread(WriterLoop);
+		}
+	}
+
+	bool Logger::ShouldLog(LogCategory category, LogLevel level, const char* file, int line) {
+		// level masks first - the global switch, then the category's
+		if ((s_enabledLevels & level) == LogLevel::None) return false;
+		if ((s_categoryLevels[(int)category] & level) == LogLevel::None) return false;
+
+		// rate limiting - errors always get through, repeats of anything
+		// else are capped per call site per second
+		if (s_rateLimit <= 0 || level == LogLevel::Error) return true;
+
+		uint64_t now = (uint64_t)std::chrono::duration_cast<std::chrono::seconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+
+		uint32_t suppressed = 0;
+		bool allowed = true;
+		{
+			std::scoped_lock lock(g_siteMutex);
+
+			// __FILE__ is a string literal, so the pointer itself keys the
+			// site; probe a few slots and give up gracefully on a full table
+			size_t hash = ((uintptr_t)file >> 4) ^ (size_t)line;
+			for (size_t probe = 0; probe < 8; probe++) {
+				SiteState& site = g_sites[(hash + probe) & (kSiteCapacity - 1)];
+				if (site.file && (site.file != file || site.line != line)) continue;
+
+				if (site.file == nullptr) {
+					site.file = file;
+					site.line = line;
+					site.window = now;
+				}
+				else if (site.window != now) {
+					// window rolled - report what the old window swallowed
+					if (site.count > (uint32_t)s_rateLimit) suppressed = site.count - s_rateLimit;
+					site.count = 0;
+					site.window = now;
+				}
+
+				site.count++;
+				allowed = site.count <= (uint32_t)s_rateLimit;
+				break;
+			}
+		}
+
+		if (suppressed) {
+			Log(category, level, file, line,
+				std::format("(rate limited: {} repeats suppressed)", suppressed));
+		}
+		return allowed;
+	}
+
+	void Logger::Log(LogCategory category, LogLevel level, const char* file, int line, std::string message) {
+		LogRecord record{ category, level, file, line, std::move(message) };
+
+		// after shutdown (or before the writer ever starts during static
+		// teardown) fall back to a synchronous write
+		std::call_once(g_startFlag, StartWriter);
+		if (!g_running.load()) {
+			WriteRecord(record);
+			return;
+		}
+
+		if (!TryEnqueue(std::move(record))) {
+			g_dropped++;
+			return;
+		}
+		g_wake.notify_one();
+	}
+
+	std::vector<Logger::ConsoleEntry> Logger::GetConsoleEntries() {
+		std::scoped_lock lock(g_consoleMutex);
+		return { g_console.begin(), g_console.end() };
+	}
+
+	void Logger::ClearConsole() {
+		std::scoped_lock lock(g_consoleMutex);
+		g_console.clear();
+	}
+
+	void Logger::Shutdown() {
+		if (!g_running.exchange(false)) return;
+		g_wake.notify_one();
+		if (g_writer.joinable()) g_writer.join();
+	}
+}
@@ -3,65 +3,171 @@
 #include <string>
 #include <iostream>
 #include <format>
+#include <vector>
+
+// severity ordering for the per-category compile-time minimums below -
+// plain numbers so they can be compared in the category macros and
+// overridden from the build settings
+#define NEU_LOG_LEVEL_DEBUG   0
+#define NEU_LOG_LEVEL_INFO    1
+#define NEU_LOG_LEVEL_WARNING 2
+#define NEU_LOG_LEVEL_ERROR   3
+#define NEU_LOG_LEVEL_NONE    4
+
+// debug builds (and NEU_LOG_ALL) keep every severity; otherwise info and
+// debug messages vanish from the binary - the same gate the LOG_INFO and
+// LOG_DEBUG macros always had, now applied per category
+#if defined(_DEBUG) || defined(NEU_LOG_ALL)
+#define NEU_LOG_MIN_DEFAULT NEU_LOG_LEVEL_DEBUG
+#else
+#define NEU_LOG_MIN_DEFAULT NEU_LOG_LEVEL_WARNING
+#endif
+
+// per-category compile-time minimum severity. A call site below its
+// category's minimum compiles to nothing - no formatting, no call, no
+// string in the binary. Override per build when one category's chatter
+// drowns the rest, e.g. NEU_LOG_MIN_RESOURCES=NEU_LOG_LEVEL_WARNING
+// silences resource-load info spam without touching any call site
+#ifndef NEU_LOG_MIN_GENERAL
+#define NEU_LOG_MIN_GENERAL NEU_LOG_MIN_DEFAULT
+#endif
+#ifndef NEU_LOG_MIN_RENDERER
+#define NEU_LOG_MIN_RENDERER NEU_LOG_MIN_DEFAULT
+#endif
+#ifndef NEU_LOG_MIN_RESOURCES
+#define NEU_LOG_MIN_RESOURCES NEU_LOG_MIN_DEFAULT
+#endif
+#ifndef NEU_LOG_MIN_AUDIO
+#define NEU_LOG_MIN_AUDIO NEU_LOG_MIN_DEFAULT
+#endif
+#ifndef NEU_LOG_MIN_SCENE
+#define NEU_LOG_MIN_SCENE NEU_LOG_MIN_DEFAULT
+#endif
+
+/// <summary>
+/// Category-qualified logging macros. The category names a LogCategory
+/// enumerator (Renderer, Resources, Audio, Scene - General is what the
+/// plain LOG_ macros use). The if constexpr reads the category's
+/// compile-time minimum, so a filtered call site leaves no code behind,
+/// and surviving sites run the runtime category filter and rate limiter
+/// before paying for formatting.
+///
+/// Example usage:
+///   LOG_CAT_INFO(Resources, "loaded {} ({} KB)", name, size >> 10);
+///   LOG_CAT_WARNING(Renderer, "texture {} missing, using default", file);
+/// </summary>
+/// <param name="category">LogCategory enumerator naming the channel</param>
+/// <param name="fmt">Format string compatible with std::format</param>
+/// <param name="...">Optional arguments for format string placeholders</param>
+#define LOG_CAT_INFO(category, fmt, ...) \
+	do { \
+		if constexpr (NEU_LOG_MIN_##category##_VALUE <= NEU_LOG_LEVEL_INFO) \
+			neu::Logger::Info(neu::LogCategory::category, __FILE__, __LINE__, fmt __VA_OPT__(,) __VA_ARGS__); \
+	} while (0)
+
+#define LOG_CAT_WARNING(category, fmt, ...) \
+	do { \
+		if constexpr (NEU_LOG_MIN_##category##_VALUE <= NEU_LOG_LEVEL_WARNING) \
+			neu::Logger::Warning(neu::LogCategory::category, __FILE__, __LINE__, fmt __VA_OPT__(,) __VA_ARGS__); \
+	} while (0)
+
+#define LOG_CAT_ERROR(category, fmt, ...) \
+	do { \
+		if constexpr (NEU_LOG_MIN_##category##_VALUE <= NEU_LOG_LEVEL_ERROR) \
+			neu::Logger::Error(neu::LogCategory::category, __FILE__, __LINE__, fmt __VA_OPT__(,) __VA_ARGS__); \
+	} while (0)
+
+#define LOG_CAT_DEBUG(category, fmt, ...) \
+	do { \
+		if constexpr (NEU_LOG_MIN_##category##_VALUE <= NEU_LOG_LEVEL_DEBUG) \
+			neu::Logger::Debug(neu::LogCategory::category, __FILE__, __LINE__, fmt __VA_OPT__(,) __VA_ARGS__); \
+	} while (0)
+
+// maps each enumerator spelling to its threshold macro so call sites pass
+// the enumerator name, not a shouting macro suffix
+#define NEU_LOG_MIN_General_VALUE	NEU_LOG_MIN_GENERAL
+#define NEU_LOG_MIN_Renderer_VALUE	NEU_LOG_MIN_RENDERER
+#define NEU_LOG_MIN_Resources_VALUE	NEU_LOG_MIN_RESOURCES
+#define NEU_LOG_MIN_Audio_VALUE		NEU_LOG_MIN_AUDIO
+#define NEU_LOG_MIN_Scene_VALUE		NEU_LOG_MIN_SCENE
 
 /// <summary>
-/// Convenience macro for logging informational messages.
-/// Automatically captures the current file and line number for context.
+/// Convenience macro for logging informational messages on the General
+/// channel. Automatically captures the current file and line number.
 /// Uses C++20 std::format for type-safe, printf-style formatting.
-/// 
+/// Compiled out of non-debug builds so shipping code pays nothing for it.
+///
 /// Example usage:
 ///   LOG_INFO("Player spawned at position ({}, {})", x, y);
 ///   LOG_INFO("System initialized successfully");
 /// </summary>
 /// <param name="fmt">Format string compatible with std::format</param>
 /// <param name="...">Optional arguments for format string placeholders</param>
-#define LOG_INFO(fmt, ...) \
-	neu::Logger::Info(__FILE__, __LINE__, fmt __VA_OPT__(,) __VA_ARGS__)
+#define LOG_INFO(fmt, ...) LOG_CAT_INFO(General, fmt __VA_OPT__(,) __VA_ARGS__)
 
 /// <summary>
-/// Convenience macro for logging warning messages.
+/// Convenience macro for logging warning messages on the General channel.
 /// Used for non-critical issues that should be noted but don't prevent execution.
 /// Automatically captures the current file and line number for debugging context.
-/// 
+///
 /// Example usage:
 ///   LOG_WARNING("Low memory warning: {}MB remaining", freeMemoryMB);
 ///   LOG_WARNING("Deprecated function called: {}", functionName);
 /// </summary>
 /// <param name="fmt">Format string compatible with std::format</param>
 /// <param name="...">Optional arguments for format string placeholders</param>
-#define LOG_WARNING(fmt, ...) \
-	neu::Logger::Warning(__FILE__, __LINE__, fmt __VA_OPT__(,) __VA_ARGS__)
+#define LOG_WARNING(fmt, ...) LOG_CAT_WARNING(General, fmt __VA_OPT__(,) __VA_ARGS__)
 
 /// <summary>
-/// Convenience macro for logging error messages.
+/// Convenience macro for logging error messages on the General channel.
 /// Used for critical issues, failures, and exceptions that require attention.
 /// Automatically captures the current file and line number for debugging.
-/// 
+///
 /// Example usage:
 ///   LOG_ERROR("Failed to load texture: {}", filename);
 ///   LOG_ERROR("Network connection timeout after {}ms", timeoutMs);
 /// </summary>
 /// <param name="fmt">Format string compatible with std::format</param>
 /// <param name="...">Optional arguments for format string placeholders</param>
-#define LOG_ERROR(fmt, ...) \
-	neu::Logger::Error(__FILE__, __LINE__, fmt __VA_OPT__(,) __VA_ARGS__)
+#define LOG_ERROR(fmt, ...) LOG_CAT_ERROR(General, fmt __VA_OPT__(,) __VA_ARGS__)
 
 /// <summary>
-/// Convenience macro for logging debug messages.
+/// Convenience macro for logging debug messages on the General channel.
 /// Used for detailed diagnostic information during development and troubleshooting.
 /// Can be selectively enabled/disabled without affecting other log levels.
-/// 
+/// Compiled out of non-debug builds so shipping code pays nothing for it.
+///
 /// Example usage:
 ///   LOG_DEBUG("Entering function: {} with parameter {}", __func__, param);
 ///   LOG_DEBUG("State transition: {} -> {}", oldState, newState);
 /// </summary>
 /// <param name="fmt">Format string compatible with std::format</param>
 /// <param name="...">Optional arguments for format string placeholders</param>
-#define LOG_DEBUG(fmt, ...) \
-	neu::Logger::Debug(__FILE__, __LINE__, fmt __VA_OPT__(,) __VA_ARGS__)
+#define LOG_DEBUG(fmt, ...) LOG_CAT_DEBUG(General, fmt __VA_OPT__(,) __VA_ARGS__)
 
 namespace neu {
 
+	/// <summary>
+	/// Named log channels, declared at the LOG_CAT_ macro sites. Each
+	/// category carries its own compile-time minimum (the NEU_LOG_MIN_
+	/// defines above), a runtime level mask for the editor console filters,
+	/// and its own rate-limit accounting - so streaming-heavy resource
+	/// chatter can be silenced without losing renderer warnings. Names for
+	/// display come from LogCategoryName().
+	/// </summary>
+	enum class LogCategory : uint8_t {
+		General,	// the plain LOG_ macros - untagged engine and game code
+		Renderer,	// GL objects, shaders, materials, textures, models
+		Resources,	// resource cache loads, streaming, hot reload
+		Audio,		// FMOD initialization and playback
+		Scene,		// actor lifetime, scene loading
+		Content,	// cook-time content validation and budget reports
+
+		Count
+	};
+
+	const char* LogCategoryName(LogCategory category);
+
 	/// <summary>
 	/// Enumeration defining different logging levels with bitmask support.
 	/// Uses bit flags to allow selective enabling/disabling of log categories.
@@ -116,19 +222,32 @@ namespace neu {
 
 	/// <summary>
 	/// Static logging utility class providing centralized message logging with multiple severity levels.
-	/// 
+	///
 	/// Key features:
 	/// - Multiple log levels with selective enabling/disabling
 	/// - Automatic file name and line number capture for debugging context
 	/// - ANSI color coding for different message types (terminal support)
 	/// - C++20 std::format integration for type-safe formatting
-	/// - Thread-safe logging to standard error stream
+	/// - Asynchronous backend: callers enqueue into a bounded lock-free ring
+	///   buffer and a dedicated writer thread decorates and writes the
+	///   messages, so a burst of logging never stalls the frame
 	/// - Macro-based interface for convenient usage
-	/// 
+	///
 	/// The logger uses a static design pattern, providing global access without requiring
 	/// instance management. All methods are static and thread-safe for concurrent logging.
 	/// </summary>
 	class Logger {
+	public:
+		/// <summary>
+		/// One decorated message kept for the editor console: category and
+		/// level for filtering and coloring, text already formatted.
+		/// </summary>
+		struct ConsoleEntry {
+			LogCategory category{ LogCategory::General };
+			LogLevel level{ LogLevel::None };
+			std::string message;
+		};
+
 	public:
 		/// <summary>
 		/// Sets which log levels are enabled for output.
@@ -146,69 +265,78 @@ namespace neu {
 		}
 
 		/// <summary>
-		/// Core logging function that handles message formatting and output.
-		/// This is the central function called by all specific log level methods.
-		/// 
-		/// Process:
-		/// 1. Check if the log level is enabled (early exit for performance)
-		/// 2. Determine appropriate prefix and ANSI color code based on level
-		/// 3. Extract filename from full file path for cleaner output
-		/// 4. Format the complete message with color codes and context
-		/// 5. Output to standard error stream
-		/// 
-		/// The function uses ANSI escape codes for terminal coloring, which work
-		/// on most modern terminals and development environments.
+		/// Sets the runtime level mask for one category - the editor console
+		/// filter checkboxes drive this. Unlike the compile-time minimums, a
+		/// masked category's call sites still exist but return before
+		/// formatting, so toggling costs nothing to undo.
 		/// </summary>
+		/// <param name="category">The category to filter</param>
+		/// <param name="levels">Bitmask of LogLevel flags to keep for this category</param>
+		static void SetCategoryLevels(LogCategory category, LogLevel levels) {
+			s_categoryLevels[(int)category] = levels;
+		}
+		static LogLevel GetCategoryLevels(LogCategory category) {
+			return s_categoryLevels[(int)category];
+		}
+
+		/// <summary>
+		/// Sets how many messages one call site may emit per second before
+		/// further repeats are suppressed (a summary line reports the
+		/// suppressed count when the window rolls). 0 disables limiting;
+		/// errors are never suppressed.
+		/// </summary>
+		/// <param name="perSecond">Messages allowed per call site per second</param>
+		static void SetRateLimit(int perSecond) { s_rateLimit = perSecond; }
+		static int GetRateLimit() { return s_rateLimit; }
+
+		/// <summary>
+		/// Cheap pre-format filter run by the level methods: the global and
+		/// per-category level masks plus the per-call-site rate limiter. A
+		/// filtered message never reaches std::format, which is the point -
+		/// resource-load spam shouldn't cost formatting nobody reads.
+		/// </summary>
+		/// <param name="category">The message's category</param>
+		/// <param name="level">The message's severity level</param>
+		/// <param name="file">Call site file (__FILE__), keys the rate limiter</param>
+		/// <param name="line">Call site line (__LINE__), keys the rate limiter</param>
+		/// <returns>True if the message should be formatted and logged</returns>
+		static bool ShouldLog(LogCategory category, LogLevel level, const char* file, int line);
+
+		/// <summary>
+		/// Core logging function called by all specific log level methods.
+		///
+		/// The calling thread only enqueues the record into a bounded MPSC
+		/// ring buffer (filtering already happened in ShouldLog) - the
+		/// prefix, color and filename decoration plus the stream write are
+		/// deferred to the dedicated writer thread, so logging from the
+		/// frame costs one slot claim instead of a formatted stderr write.
+		/// If the ring is full the record is dropped and the writer reports
+		/// the drop count.
+		/// </summary>
+		/// <param name="category">The category channel of this log message</param>
 		/// <param name="level">The severity level of this log message</param>
 		/// <param name="file">Full file path where the log call originated (__FILE__ macro)</param>
 		/// <param name="line">Line number where the log call originated (__LINE__ macro)</param>
 		/// <param name="message">The formatted message content to log</param>
-		static void Log(LogLevel level, const char* file, int line, const std::string& message) {
-
-			// Early exit if this log level is disabled (performance optimization)
-			if ((s_enabledLevels & level) == LogLevel::None) return;
-
-			std::string prefix;
-			std::string color;
-
-			// Determine display properties based on log level
-			switch (level) {
-			case LogLevel::Info:
-				prefix = "[INFO] ";
-				color = "\033[32m"; // Green - positive/neutral information
-				break;
-			case LogLevel::Warning:
-				prefix = "[WARNING] ";
-				color = "\033[33m"; // Yellow - caution/attention needed
-				break;
-			case LogLevel::Error:
-				prefix = "[ERROR] ";
-				color = "\033[31m"; // Red - problems/failures
-				break;
-			case LogLevel::Debug:
-				prefix = "[DEBUG] ";
-				color = "\033[36m"; // Cyan - diagnostic information
-				break;
-			default:
-				prefix = "[UNKNOWN] ";
-				color = "\033[0m"; // Reset - fallback for invalid levels
-				break;
-			}
-
-			// Extract just the filename from the full path for cleaner output
-			// This reduces clutter in log messages while maintaining useful context
-			std::string filename = file::GetFilename(file);
-
-			// ANSI reset code to return terminal to default colors
-			const std::string reset = "\033[0m";
-
-			// Format the complete log message with color, prefix, location, and content
-			std::string output = std::format("{}{}[{}:{}] {}{}\n",
-				color, prefix, filename, line, message, reset);
-
-			// Output to stderr for immediate visibility and proper stream separation
-			std::cerr << output;
-		}
+		static void Log(LogCategory category, LogLevel level, const char* file, int line, std::string message);
+
+		/// <summary>
+		/// Copies the recent message ring for the editor console panel.
+		/// </summary>
+		/// <returns>The retained messages, oldest first</returns>
+		static std::vector<ConsoleEntry> GetConsoleEntries();
+
+		/// <summary>
+		/// Empties the editor console's message ring.
+		/// </summary>
+		static void ClearConsole();
+
+		/// <summary>
+		/// Flushes any queued messages and stops the writer thread.
+		/// Called at the end of Engine::Shutdown; logging after this point
+		/// falls back to synchronous writes.
+		/// </summary>
+		static void Shutdown();
 
 		/// <summary>
 		/// Logs an informational message using C++20 format string syntax.
@@ -216,13 +344,15 @@ namespace neu {
 		/// Automatically forwards all arguments to std::format for efficient formatting.
 		/// </summary>
 		/// <typeparam name="Args">Variadic template parameter pack for format arguments</typeparam>
+		/// <param name="category">Category channel (automatically provided by the macro)</param>
 		/// <param name="file">Source file name (automatically provided by LOG_INFO macro)</param>
 		/// <param name="line">Source line number (automatically provided by LOG_INFO macro)</param>
 		/// <param name="fmt">Compile-time validated format string</param>
 		/// <param name="args">Arguments for format string placeholders (perfect forwarded)</param>
 		template<typename... Args>
-		static void Info(const char* file, int line, std::format_string<Args...> fmt, Args&&... args) {
-			Log(LogLevel::Info, file, line, std::format(fmt, std::forward<Args>(args)...));
+		static void Info(LogCategory category, const char* file, int line, std::format_string<Args...> fmt, Args&&... args) {
+			if (!ShouldLog(category, LogLevel::Info, file, line)) return;
+			Log(category, LogLevel::Info, file, line, std::format(fmt, std::forward<Args>(args)...));
 		}
 
 		/// <summary>
@@ -231,13 +361,15 @@ namespace neu {
 		/// Used for critical issues, failures, and exceptions that require immediate attention.
 		/// </summary>
 		/// <typeparam name="Args">Variadic template parameter pack for format arguments</typeparam>
+		/// <param name="category">Category channel (automatically provided by the macro)</param>
 		/// <param name="file">Source file name (automatically provided by LOG_ERROR macro)</param>
 		/// <param name="line">Source line number (automatically provided by LOG_ERROR macro)</param>
 		/// <param name="fmt">Compile-time validated format string</param>
 		/// <param name="args">Arguments for format string placeholders (perfect forwarded)</param>
 		template<typename... Args>
-		static void Error(const char* file, int line, std::format_string<Args...> fmt, Args&&... args) {
-			Log(LogLevel::Error, file, line, std::format(fmt, std::forward<Args>(args)...));
+		static void Error(LogCategory category, const char* file, int line, std::format_string<Args...> fmt, Args&&... args) {
+			if (!ShouldLog(category, LogLevel::Error, file, line)) return;
+			Log(category, LogLevel::Error, file, line, std::format(fmt, std::forward<Args>(args)...));
 		}
 
 		/// <summary>
@@ -246,13 +378,15 @@ namespace neu {
 		/// Used for non-critical issues that should be noted but don't prevent execution.
 		/// </summary>
 		/// <typeparam name="Args">Variadic template parameter pack for format arguments</typeparam>
+		/// <param name="category">Category channel (automatically provided by the macro)</param>
 		/// <param name="file">Source file name (automatically provided by LOG_WARNING macro)</param>
 		/// <param name="line">Source line number (automatically provided by LOG_WARNING macro)</param>
 		/// <param name="fmt">Compile-time validated format string</param>
 		/// <param name="args">Arguments for format string placeholders (perfect forwarded)</param>
 		template<typename... Args>
-		static void Warning(const char* file, int line, std::format_string<Args...> fmt, Args&&... args) {
-			Log(LogLevel::Warning, file, line, std::format(fmt, std::forward<Args>(args)...));
+		static void Warning(LogCategory category, const char* file, int line, std::format_string<Args...> fmt, Args&&... args) {
+			if (!ShouldLog(category, LogLevel::Warning, file, line)) return;
+			Log(category, LogLevel::Warning, file, line, std::format(fmt, std::forward<Args>(args)...));
 		}
 
 		/// <summary>
@@ -261,13 +395,15 @@ namespace neu {
 		/// Used for detailed diagnostic information during development and troubleshooting.
 		/// </summary>
 		/// <typeparam name="Args">Variadic template parameter pack for format arguments</typeparam>
+		/// <param name="category">Category channel (automatically provided by the macro)</param>
 		/// <param name="file">Source file name (automatically provided by LOG_DEBUG macro)</param>
 		/// <param name="line">Source line number (automatically provided by LOG_DEBUG macro)</param>
 		/// <param name="fmt">Compile-time validated format string</param>
 		/// <param name="args">Arguments for format string placeholders (perfect forwarded)</param>
 		template<typename... Args>
-		static void Debug(const char* file, int line, std::format_string<Args...> fmt, Args&&... args) {
-			Log(LogLevel::Debug, file, line, std::format(fmt, std::forward<Args>(args)...));
+		static void Debug(LogCategory category, const char* file, int line, std::format_string<Args...> fmt, Args&&... args) {
+			if (!ShouldLog(category, LogLevel::Debug, file, line)) return;
+			Log(category, LogLevel::Debug, file, line, std::format(fmt, std::forward<Args>(args)...));
 		}
 
 	private:
@@ -275,10 +411,25 @@ namespace neu {
 		/// Static member storing the currently enabled log levels.
 		/// Initialized to LogLevel::All by default, enabling all logging on startup.
 		/// Modified through SetEnabledLevels() for runtime log level control.
-		/// 
+		///
 		/// This static storage ensures consistent logging configuration across
 		/// the entire application without requiring logger instance management.
 		/// </summary>
 		inline static LogLevel s_enabledLevels = LogLevel::All;
+
+		/// <summary>
+		/// Runtime level mask per category, all enabled by default - the
+		/// editor console filters narrow these without a rebuild.
+		/// </summary>
+		inline static LogLevel s_categoryLevels[(int)LogCategory::Count]{
+			LogLevel::All, LogLevel::All, LogLevel::All, LogLevel::All, LogLevel::All
+		};
+
+		/// <summary>
+		/// Messages one call site may emit per second before repeats are
+		/// suppressed - the Material::Load warning firing every frame turns
+		/// into a handful of lines plus a suppressed count. 0 disables.
+		/// </summary>
+		inline static int s_rateLimit = 8;
 	};
 }
\ No newline at end of file
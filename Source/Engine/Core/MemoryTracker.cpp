@@ -0,0 +1,155 @@
+#include "MemoryTracker.h"
+#include "Logger.h"
+
+#ifdef NEU_MEM_TRACKING_ENABLED
+
+#if defined(_DEBUG) && defined(_WIN32)
+#include <Windows.h>
+#include <format>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#endif
+
+namespace neu {
+	const char* MemTagName(MemTag tag) {
+		switch (tag) {
+		case MemTag::Core:		return "core";
+		case MemTag::Scene:		return "scene";
+		case MemTag::Renderer:	return "renderer";
+		case MemTag::Resources:	return "resources";
+		case MemTag::Audio:		return "audio";
+		default:				return "unknown";
+		}
+	}
+
+#if defined(_DEBUG) && defined(_WIN32)
+	namespace {
+		// captured allocating callstacks for live allocations, keyed by
+		// pointer - debug-only and opt-in, so a plain mutex is fine here
+		constexpr int kCallstackDepth = 12;
+		struct Callstack { void* frames[kCallstackDepth]; uint16_t count; };
+
+		std::mutex s_callstackMutex;
+		std::unordered_map<const void*, Callstack> s_callstacks;
+		bool s_capture = false;
+	}
+#endif
+
+	void MemoryTracker::Track(MemTag tag, const void* pointer, size_t size) {
+		Tag& stats = s_tags[(int)tag];
+		uint64_t live = stats.liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+		stats.liveCount.fetch_add(1, std::memory_order_relaxed);
+		stats.totalCount.fetch_add(1, std::memory_order_relaxed);
+
+		// racy max update - a lost race understates the peak by one
+		// allocation at worst, acceptable for accounting
+		uint64_t peak = stats.peakBytes.load(std::memory_order_relaxed);
+		while (live > peak && !stats.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+
+#if defined(_DEBUG) && defined(_WIN32)
+		if (s_capture && pointer) {
+			Callstack stack;
+			stack.count = CaptureStackBackTrace(1, kCallstackDepth, stack.frames, nullptr);
+
+			std::lock_guard<std::mutex> lock(s_callstackMutex);
+			s_callstacks[pointer] = stack;
+		}
+#endif
+	}
+
+	void MemoryTracker::Untrack(MemTag tag, const void* pointer, size_t size) {
+		Tag& stats = s_tags[(int)tag];
+		stats.liveBytes.fetch_sub(size, std::memory_order_relaxed);
+		stats.liveCount.fetch_sub(1, std::memory_order_relaxed);
+
+#if defined(_DEBUG) && defined(_WIN32)
+		if (pointer) {
+			std::lock_guard<std::mutex> lock(s_callstackMutex);
+			s_callstacks.erase(pointer);
+		}
+#endif
+	}
+
+	void MemoryTracker::Sample(MemTag tag, size_t liveBytes) {
+		Tag& stats = s_tags[(int)tag];
+		stats.liveBytes.store(liveBytes, std::memory_order_relaxed);
+
+		uint64_t peak = stats.peakBytes.load(std::memory_order_relaxed);
+		while (liveBytes > peak && !stats.peakBytes.compare_exchange_weak(peak, liveBytes, std::memory_order_relaxed)) {}
+	}
+
+	MemoryTracker::TagStats MemoryTracker::GetStats(MemTag tag) {
+		const Tag& stats = s_tags[(int)tag];
+		return {
+			stats.liveBytes.load(std::memory_order_relaxed),
+			stats.peakBytes.load(std::memory_order_relaxed),
+			stats.liveCount.load(std::memory_order_relaxed),
+			stats.totalCount.load(std::memory_order_relaxed)
+		};
+	}
+
+	uint64_t MemoryTracker::GetTotalLiveBytes() {
+		uint64_t total = 0;
+		for (int tag = 0; tag < (int)MemTag::Count; tag++) {
+			total += s_tags[tag].liveBytes.load(std::memory_order_relaxed);
+		}
+		return total;
+	}
+
+	void MemoryTracker::Dump() {
+		LOG_INFO("Memory by subsystem:");
+		for (int tag = 0; tag < (int)MemTag::Count; tag++) {
+			TagStats stats = GetStats((MemTag)tag);
+			LOG_INFO("  {:>10}: {:>8} KB live / {:>8} KB peak ({} blocks live, {} total)",
+				MemTagName((MemTag)tag),
+				stats.liveBytes >> 10, stats.peakBytes >> 10,
+				stats.liveCount, stats.totalCount);
+		}
+
+#if defined(_DEBUG) && defined(_WIN32)
+		std::lock_guard<std::mutex> lock(s_callstackMutex);
+		if (!s_callstacks.empty()) {
+			LOG_INFO("Live allocation callstacks ({}):", s_callstacks.size());
+			for (auto& [pointer, stack] : s_callstacks) {
+				std::string line;
+				for (uint16_t frame = 0; frame < stack.count; frame++) {
+					line += std::format("{}{:#x}", frame ? " " : "", (uintptr_t)stack.frames[frame]);
+				}
+				LOG_INFO("  {}: {}", pointer, line);
+			}
+		}
+#endif
+	}
+
+	void MemoryTracker::SetCaptureCallstacks(bool capture) {
+#if defined(_DEBUG) && defined(_WIN32)
+		s_capture = capture;
+		if (!capture) {
+			std::lock_guard<std::mutex> lock(s_callstackMutex);
+			s_callstacks.clear();
+		}
+#else
+		(void)capture;
+#endif
+	}
+
+	bool MemoryTracker::GetCaptureCallstacks() {
+#if defined(_DEBUG) && defined(_WIN32)
+		return s_capture;
+#else
+		return false;
+#endif
+	}
+}
+
+#else
+
+namespace neu {
+	const char* MemTagName(MemTag tag) {
+		(void)tag;
+		return "untracked";
+	}
+}
+
+#endif
@@ -0,0 +1,143 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Per-subsystem allocation accounting. Compiled into debug builds; define
+// NEU_MEM_TRACKING to keep it in optimized builds (profiling sessions,
+// benchmark runs). When compiled out every call collapses to an empty
+// inline, same pattern as the frame stats counters.
+#if defined(_DEBUG) || defined(NEU_MEM_TRACKING)
+#define NEU_MEM_TRACKING_ENABLED
+#endif
+
+#ifdef NEU_MEM_TRACKING_ENABLED
+#include <atomic>
+#endif
+
+namespace neu {
+	/// <summary>
+	/// Subsystem tag an allocation is accounted against. Keep in sync with
+	/// MemTagName().
+	/// </summary>
+	enum class MemTag : uint8_t {
+		Core,		// frame arena, job system, engine-side containers
+		Scene,		// actor pool blocks, component pool slabs
+		Renderer,	// renderer-side CPU buffers
+		Resources,	// resource cache (sampled from ResourceManager)
+		Audio,		// FMOD (sampled from the runtime's own counters)
+
+		Count
+	};
+
+	const char* MemTagName(MemTag tag);
+
+	/// <summary>
+	/// Live/peak byte and count accounting per subsystem tag.
+	///
+	/// Block allocators (ActorPool, ComponentPool, FrameArena) call
+	/// Track/Untrack around their raw allocations; subsystems with their own
+	/// accounting (the resource cache, FMOD) are mirrored in once per frame
+	/// via Sample so every tag reads from one place. The editor memory panel
+	/// shows the table live and the benchmark harness samples and dumps it.
+	///
+	/// Counters are relaxed atomics - Track/Untrack are called from worker
+	/// threads (heap fallbacks in the frame allocator), and per-tag totals
+	/// don't need cross-tag consistency.
+	/// </summary>
+	class MemoryTracker {
+	public:
+		struct TagStats {
+			uint64_t liveBytes{ 0 };
+			uint64_t peakBytes{ 0 };
+			uint32_t liveCount{ 0 };
+			uint64_t totalCount{ 0 };	// allocations ever, for churn spotting
+		};
+
+#ifdef NEU_MEM_TRACKING_ENABLED
+		/// <summary>
+		/// Accounts an allocation against the tag. In debug builds, also
+		/// captures the allocating callstack when capture is switched on.
+		/// </summary>
+		static void Track(MemTag tag, const void* pointer, size_t size);
+
+		/// <summary>
+		/// Releases an allocation from the tag's accounting. The size must
+		/// match the Track call.
+		/// </summary>
+		static void Untrack(MemTag tag, const void* pointer, size_t size);
+
+		/// <summary>
+		/// Overwrites a tag's live bytes from an external accounting source
+		/// (resource cache total, FMOD's counters), keeping its peak. For
+		/// tags whose owner already tracks itself - don't mix with
+		/// Track/Untrack on the same tag.
+		/// </summary>
+		static void Sample(MemTag tag, size_t liveBytes);
+
+		static TagStats GetStats(MemTag tag);
+		static uint64_t GetTotalLiveBytes();
+
+		/// <summary>
+		/// Logs one line per tag (live/peak/counts). Called by the benchmark
+		/// harness after a run; available anywhere for leak hunting.
+		/// </summary>
+		static void Dump();
+
+		/// <summary>
+		/// Debug builds only: toggles callstack capture on Track. Captured
+		/// stacks are logged (raw return addresses) by Dump for allocations
+		/// still live. No-op in non-debug builds.
+		/// </summary>
+		static void SetCaptureCallstacks(bool capture);
+		static bool GetCaptureCallstacks();
+
+	private:
+		struct Tag {
+			std::atomic<uint64_t> liveBytes{ 0 };
+			std::atomic<uint64_t> peakBytes{ 0 };
+			std::atomic<uint32_t> liveCount{ 0 };
+			std::atomic<uint64_t> totalCount{ 0 };
+		};
+
+		inline static Tag s_tags[(int)MemTag::Count];
+#else
+		static void Track(MemTag, const void*, size_t) {}
+		static void Untrack(MemTag, const void*, size_t) {}
+		static void Sample(MemTag, size_t) {}
+		static TagStats GetStats(MemTag) { return {}; }
+		static uint64_t GetTotalLiveBytes() { return 0; }
+		static void Dump() {}
+		static void SetCaptureCallstacks(bool) {}
+		static bool GetCaptureCallstacks() { return false; }
+#endif
+	};
+
+	/// <summary>
+	/// STL-compatible allocator that accounts through MemoryTracker.
+	/// Drop into a container's allocator slot to put it on the memory
+	/// panel: std::vector&lt;T, TrackedAllocator&lt;T, MemTag::Scene&gt;&gt;.
+	/// </summary>
+	template<typename T, MemTag tag>
+	class TrackedAllocator {
+	public:
+		using value_type = T;
+
+		TrackedAllocator() = default;
+		template<typename U>
+		TrackedAllocator(const TrackedAllocator<U, tag>&) {}
+
+		T* allocate(size_t count) {
+			T* pointer = static_cast<T*>(::operator new(count * sizeof(T)));
+			MemoryTracker::Track(tag, pointer, count * sizeof(T));
+			return pointer;
+		}
+
+		void deallocate(T* pointer, size_t count) {
+			MemoryTracker::Untrack(tag, pointer, count * sizeof(T));
+			::operator delete(pointer);
+		}
+
+		template<typename U>
+		bool operator==(const TrackedAllocator<U, tag>&) const { return true; }
+	};
+}
@@ -0,0 +1,105 @@
+#include "Profiler.h"
+#include "Logger.h"
+#include <algorithm>
+#include <atomic>
+#include <format>
+#include <fstream>
+
+namespace neu {
+	namespace {
+		std::atomic<uint32_t> g_nextThreadId{ 0 };
+	}
+
+	uint64_t Profiler::Now()
+	{
+		static const auto start = std::chrono::steady_clock::now();
+		return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	Profiler::ThreadState& Profiler::GetThreadState()
+	{
+		// the state outlives the thread so EndFrame can still harvest samples
+		// recorded just before a worker exits
+		thread_local ThreadState* state = []() {
+			ThreadState* threadState = new ThreadState;
+			threadState->id = g_nextThreadId++;
+
+			std::lock_guard lock(s_threadsMutex);
+			s_threads.push_back(threadState);
+
+			return threadState;
+		}();
+
+		return *state;
+	}
+
+	void Profiler::BeginScope(const char* name)
+	{
+		ThreadState& state = GetThreadState();
+
+		Sample sample;
+		sample.name = name;
+		sample.begin = Now();
+		sample.depth = (int)state.open.size();
+		sample.threadId = state.id;
+
+		state.open.push_back(sample);
+	}
+
+	void Profiler::EndScope()
+	{
+		ThreadState& state = GetThreadState();
+		if (state.open.empty()) return;
+
+		Sample sample = state.open.back();
+		state.open.pop_back();
+		sample.end = Now();
+
+		std::lock_guard lock(state.mutex);
+		state.samples.push_back(sample);
+	}
+
+	void Profiler::EndFrame()
+	{
+		s_frameBegin = s_frameEnd;
+		s_frameEnd = Now();
+
+		s_frameSamples.clear();
+
+		std::lock_guard threadsLock(s_threadsMutex);
+		for (ThreadState* state : s_threads) {
+			std::lock_guard lock(state->mutex);
+			s_frameSamples.insert(s_frameSamples.end(), state->samples.begin(), state->samples.end());
+			state->samples.clear();
+		}
+
+		// order by thread then begin time so nested samples follow their parents
+		std::sort(s_frameSamples.begin(), s_frameSamples.end(),
+			[](const Sample& a, const Sample& b) {
+				if (a.threadId != b.threadId) return a.threadId < b.threadId;
+				return a.begin < b.begin;
+			});
+	}
+
+	bool Profiler::DumpTrace(const std::string& filename)
+	{
+		std::ofstream stream(filename);
+		if (!stream.is_open()) {
+			LOG_ERROR("Could not write trace file: {}", filename);
+			return false;
+		}
+
+		stream << "{\"traceEvents\":[";
+		bool first = true;
+		for (const Sample& sample : s_frameSamples) {
+			if (!first) stream << ",";
+			first = false;
+			stream << std::format("{{\"name\":\"{}\",\"ph\":\"X\",\"ts\":{},\"dur\":{},\"pid\":0,\"tid\":{}}}",
+				sample.name, sample.begin, sample.end - sample.begin, sample.threadId);
+		}
+		stream << "]}";
+
+		LOG_INFO("Wrote trace file: {}", filename);
+		return true;
+	}
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#define PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_IMPL(a, b)
+
+/// <summary>
+/// Convenience macro for timing the enclosing scope.
+/// Creates a named RAII timer that records a hierarchical sample from the
+/// point of declaration to the end of the scope. Samples nest - a scope
+/// opened inside another scope records one level deeper, which is what the
+/// editor flame view and the Chrome trace dump use to rebuild the call tree.
+///
+/// Example usage:
+///   void Scene::Update(float dt) {
+///       PROFILE_SCOPE("Scene::Update");
+///       ...
+///   }
+/// </summary>
+/// <param name="name">Scope name shown in the profiler, must be a string literal</param>
+#define PROFILE_SCOPE(name) \
+	neu::Profiler::ScopeTimer PROFILE_CONCAT(profileScope_, __LINE__)(name)
+
+namespace neu {
+
+	/// <summary>
+	/// Hierarchical CPU frame profiler.
+	///
+	/// Each thread records begin/end timestamps into its own thread-local
+	/// sample buffer, so instrumented code never contends on a shared lock in
+	/// the hot path. Once per frame Engine::Update calls EndFrame, which
+	/// harvests every thread's completed samples into a single frame snapshot
+	/// for the editor flame view. DumpTrace writes that snapshot in the Chrome
+	/// trace-event format (open chrome://tracing or https://ui.perfetto.dev)
+	/// for offline analysis.
+	/// </summary>
+	class Profiler {
+	public:
+		/// <summary>
+		/// One completed scope: name, begin/end timestamps in microseconds
+		/// since profiler start, nesting depth and the recording thread.
+		/// </summary>
+		struct Sample {
+			const char* name{ nullptr };
+			uint64_t begin{ 0 };
+			uint64_t end{ 0 };
+			int depth{ 0 };
+			uint32_t threadId{ 0 };
+		};
+
+		/// <summary>
+		/// RAII timer created by PROFILE_SCOPE, begins a sample on
+		/// construction and completes it on destruction.
+		/// </summary>
+		class ScopeTimer {
+		public:
+			ScopeTimer(const char* name) { Profiler::BeginScope(name); }
+			~ScopeTimer() { Profiler::EndScope(); }
+		};
+
+	public:
+		static void BeginScope(const char* name);
+		static void EndScope();
+
+		/// <summary>
+		/// Harvests every thread's completed samples into the frame snapshot
+		/// and starts a new frame. Called once per frame from Engine::Update.
+		/// </summary>
+		static void EndFrame();
+
+		/// <summary>
+		/// Writes the last frame snapshot as a Chrome trace-event JSON file.
+		/// </summary>
+		/// <param name="filename">Path of the trace file to write</param>
+		/// <returns>True if the file was written; otherwise, false</returns>
+		static bool DumpTrace(const std::string& filename);
+
+		/// <summary>
+		/// Gets the samples harvested by the last EndFrame, sorted by thread
+		/// then begin time so nested samples follow their parents.
+		/// </summary>
+		static const std::vector<Sample>& GetFrameSamples() { return s_frameSamples; }
+
+		/// <summary>
+		/// Gets the duration of the last completed frame in milliseconds.
+		/// </summary>
+		static float GetFrameMs() { return (s_frameEnd - s_frameBegin) * 0.001f; }
+
+		/// <summary>
+		/// Gets the current time in microseconds since profiler start.
+		/// </summary>
+		static uint64_t Now();
+
+	private:
+		/// <summary>
+		/// Per-thread recording state: the stack of open scopes and the
+		/// buffer of completed samples awaiting harvest. The mutex only
+		/// guards the handoff to EndFrame, never scope begin.
+		/// </summary>
+		struct ThreadState {
+			std::vector<Sample> open;
+			std::vector<Sample> samples;
+			std::mutex mutex;
+			uint32_t id{ 0 };
+		};
+
+		static ThreadState& GetThreadState();
+
+		inline static std::vector<ThreadState*> s_threads;
+		inline static std::mutex s_threadsMutex;
+
+		inline static std::vector<Sample> s_frameSamples;
+		inline static uint64_t s_frameBegin{ 0 };
+		inline static uint64_t s_frameEnd{ 0 };
+	};
+}
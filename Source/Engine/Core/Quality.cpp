@@ -0,0 +1,161 @@
+#include "Quality.h"
+#include "File.h"
+#include "StringHelper.h"
+#include "Json.h"
+#include "Logger.h"
+#include "../Math/Math.h"
+#include "../Renderer/Renderer.h"
+#include "../Renderer/SamplerCache.h"
+#include "../Renderer/TextureStreamer.h"
+#include "../Renderer/GPUProfiler.h"
+#include <cstdlib>
+
+namespace neu {
+    namespace {
+        constexpr const char* kTiersFile = "quality.json";
+        constexpr const char* kSelectionFile = "quality.sel";
+
+        // auto-detect window: skip the warmup frames where shader compiles
+        // and first-use uploads pollute the timings, then average one second
+        constexpr int kDetectSkipFrames = 60;
+        constexpr int kDetectSampleFrames = 60;
+        constexpr float kDetectTargetMs = 1000.0f / 60.0f;
+
+        AAMode ParseAAMode(const std::string& name) {
+            if (equalsIgnoreCase(name, "msaa2x")) return AAMode::MSAA2x;
+            if (equalsIgnoreCase(name, "msaa4x")) return AAMode::MSAA4x;
+            if (equalsIgnoreCase(name, "msaa8x")) return AAMode::MSAA8x;
+            if (equalsIgnoreCase(name, "fxaa")) return AAMode::FXAA;
+            return AAMode::None;
+        }
+
+        TargetFormat ParseTargetFormat(const std::string& name) {
+            if (equalsIgnoreCase(name, "r11g11b10f")) return TargetFormat::R11G11B10F;
+            if (equalsIgnoreCase(name, "rgb10a2")) return TargetFormat::RGB10A2;
+            if (equalsIgnoreCase(name, "rgba16f")) return TargetFormat::RGBA16F;
+            return TargetFormat::RGBA8;
+        }
+    }
+
+    void Quality::LoadTiers() {
+        // built-in presets - a project without a quality.json still gets a
+        // coherent spread, and an authored file replaces them wholesale
+        s_tiers = {
+            { "Low", true, 0.5f, 0.85f, "fxaa", "rgba8", 2, 2.0f, 512, 0.5f, false, 2 },
+            { "Medium", true, 0.7f, 1.0f, "fxaa", "rgba8", 3, 1.5f, 1024, 0.75f, true, 4 },
+            { "High", false, 1.0f, 1.0f, "msaa4x", "r11g11b10f", 4, 1.0f, 0, 1.0f, true, 16 },
+        };
+
+        if (!file::Exists(kTiersFile)) return;
+
+        serial::document_t document;
+        if (!serial::Load(kTiersFile, document)) {
+            LOG_WARNING("Could not parse {} - using built-in quality tiers", kTiersFile);
+            return;
+        }
+        if (!document.HasMember("tiers") || !document["tiers"].IsArray()) {
+            LOG_WARNING("{} declares no tiers array - using built-in quality tiers", kTiersFile);
+            return;
+        }
+
+        std::vector<Tier> builtIn = std::move(s_tiers);
+        s_tiers.clear();
+        for (auto& tierValue : document["tiers"].GetArray()) {
+            Tier tier;
+            SERIAL_READ_NAME(tierValue, "name", tier.name);
+            SERIAL_READ_NAME(tierValue, "dynamicResolution", tier.dynamicResolution);
+            SERIAL_READ_NAME(tierValue, "renderScaleMin", tier.renderScaleMin);
+            SERIAL_READ_NAME(tierValue, "renderScaleMax", tier.renderScaleMax);
+            SERIAL_READ_NAME(tierValue, "antiAliasing", tier.antiAliasing);
+            SERIAL_READ_NAME(tierValue, "sceneColorFormat", tier.sceneColorFormat);
+            SERIAL_READ_NAME(tierValue, "maxShadowCascades", tier.maxShadowCascades);
+            SERIAL_READ_NAME(tierValue, "lodBias", tier.lodBias);
+            SERIAL_READ_NAME(tierValue, "streamingBudgetMB", tier.streamingBudgetMB);
+            SERIAL_READ_NAME(tierValue, "particleDensity", tier.particleDensity);
+            SERIAL_READ_NAME(tierValue, "postProcess", tier.postProcess);
+            SERIAL_READ_NAME(tierValue, "anisotropy", tier.anisotropy);
+            s_tiers.push_back(std::move(tier));
+        }
+
+        if (s_tiers.empty()) s_tiers = std::move(builtIn);
+    }
+
+    void Quality::Initialize(Renderer& renderer) {
+        LoadTiers();
+
+        // restore the saved selection; none saved is the first launch - run
+        // the game on the middle tier while the auto-detect samples real
+        // frames, then lock in whatever the measured cost supports
+        std::string saved;
+        if (file::ReadTextFile(kSelectionFile, saved)) {
+            int index = math::clamp(std::atoi(saved.c_str()), 0, (int)s_tiers.size() - 1);
+            SetTier(index, renderer);
+            return;
+        }
+
+        s_tierIndex = (int)s_tiers.size() / 2;
+        s_current = s_tiers[s_tierIndex];
+        Apply(s_current, renderer);
+        s_detecting = true;
+        LOG_INFO("quality: first launch, auto-detecting on tier '{}'", s_current.name);
+    }
+
+    void Quality::Update(Renderer& renderer) {
+        if (!s_detecting) return;
+
+        float gpuMs = GPUProfiler::GetFrameMs();
+        if (gpuMs <= 0) return; // queries not harvested yet
+
+        if (++s_detectFrames <= kDetectSkipFrames) return;
+        s_detectMs += gpuMs;
+        if (s_detectFrames < kDetectSkipFrames + kDetectSampleFrames) return;
+
+        // measured at the middle tier: frames already near the budget drop
+        // to the bottom tier, comfortable headroom earns the top one
+        float averageMs = s_detectMs / kDetectSampleFrames;
+        int tier = (int)s_tiers.size() - 1;
+        if (averageMs > kDetectTargetMs * 0.9f) tier = 0;
+        else if (averageMs > kDetectTargetMs * 0.6f) tier = (int)s_tiers.size() / 2;
+
+        s_detecting = false;
+        LOG_INFO("quality: measured {:.2f} ms GPU frames, selected tier '{}'", averageMs, s_tiers[tier].name);
+        SetTier(tier, renderer);
+    }
+
+    void Quality::SetTier(int index, Renderer& renderer) {
+        if (index < 0 || index >= (int)s_tiers.size()) return;
+
+        s_detecting = false;
+        s_tierIndex = index;
+        s_current = s_tiers[index];
+        Apply(s_current, renderer);
+
+        file::WriteTextFile(kSelectionFile, std::to_string(index));
+        LOG_INFO("quality: tier '{}' applied", s_current.name);
+    }
+
+    void Quality::Apply(const Tier& tier, Renderer& renderer) {
+        renderer.SetDynamicResolutionRange(tier.renderScaleMin, tier.renderScaleMax);
+        renderer.SetDynamicResolution(tier.dynamicResolution);
+        renderer.SetAntiAliasing(ParseAAMode(tier.antiAliasing));
+        renderer.SetSceneColorFormat(ParseTargetFormat(tier.sceneColorFormat));
+
+        // a declared budget pins the streamer; 0 keeps the VRAM-headroom
+        // auto budget, which already adapts to the card
+        TextureStreamer& streamer = TextureStreamer::Instance();
+        if (tier.streamingBudgetMB > 0) {
+            streamer.SetAutoBudget(false);
+            streamer.SetBudget((size_t)tier.streamingBudgetMB << 20);
+        }
+        else {
+            streamer.SetAutoBudget(true);
+        }
+
+        // anisotropy lives on the shared samplers, so a tier change is a
+        // handful of sampler updates, never a sweep over resident textures
+        SamplerCache::Instance().SetMaxAnisotropy((float)tier.anisotropy);
+
+        // the cascade cap, LOD bias, particle density and post-process
+        // toggle are read from s_current by their systems each frame
+    }
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <string>
+#include <vector>
+
+namespace neu {
+    /// <summary>
+    /// Quality tier presets scaling the performance systems together.
+    ///
+    /// A tier jointly sets every runtime performance knob - dynamic
+    /// resolution and its scale bounds, the anti-aliasing mode, the scene
+    /// color format, the shadow cascade cap, the LOD bias, the texture
+    /// streaming budget, particle density and the post-process toggle - so
+    /// min-spec and recommended-spec machines ship one content set with
+    /// coherent per-tier cost instead of knobs tuned one at a time.
+    ///
+    /// Tiers come from an optional quality.json next to the executable;
+    /// without one, built-in Low/Medium/High presets apply. Each tier is an
+    /// object, absent fields keep the tier defaults:
+    ///   {
+    ///     "tiers": [
+    ///       { "name": "Low", "dynamicResolution": true,
+    ///         "renderScaleMin": 0.5, "renderScaleMax": 0.85,
+    ///         "antiAliasing": "fxaa", "sceneColorFormat": "rgba8",
+    ///         "maxShadowCascades": 2, "lodBias": 2.0,
+    ///         "streamingBudgetMB": 512, "particleDensity": 0.5,
+    ///         "postProcess": false, "anisotropy": 2 }
+    ///     ]
+    ///   }
+    ///
+    /// The selected tier index persists in quality.sel. On first launch
+    /// (no selection saved), the middle tier applies while the first
+    /// seconds of GPU frame times are sampled, then the measured cost
+    /// picks and saves a tier - the benchmark is the game itself, not a
+    /// synthetic scene. SetTier switches at runtime; everything a tier
+    /// touches takes effect the next frame.
+    /// </summary>
+    class Quality {
+    public:
+        struct Tier {
+            std::string name = "Custom";
+            bool dynamicResolution = false;
+            float renderScaleMin = 0.7f;        // dynamic resolution bounds
+            float renderScaleMax = 1.0f;
+            std::string antiAliasing = "none";  // none, msaa2x, msaa4x, msaa8x, fxaa
+            std::string sceneColorFormat = "rgba8"; // rgba8, r11g11b10f, rgb10a2, rgba16f
+            int maxShadowCascades = 4;          // caps the authored cascade count
+            float lodBias = 1.0f;               // divides perceived coverage - 2 drops LODs one level sooner
+            int streamingBudgetMB = 0;          // 0 keeps the VRAM-headroom auto budget
+            float particleDensity = 1.0f;       // scales every emitter's spawn rate
+            bool postProcess = true;            // disables the post-process chain entirely
+            int anisotropy = 8;                 // shared-sampler anisotropic filtering level
+        };
+
+        /// <summary>
+        /// Loads quality.json (or the built-in presets), restores the saved
+        /// tier selection and applies it. No selection saved yet starts the
+        /// first-launch auto-detect on the middle tier.
+        /// </summary>
+        static void Initialize(class Renderer& renderer);
+
+        /// <summary>
+        /// Steps the first-launch auto-detect: samples the harvested GPU
+        /// frame time, and once enough frames are in, picks a tier from the
+        /// measured cost and saves the selection. No-op after that.
+        /// </summary>
+        static void Update(class Renderer& renderer);
+
+        /// <summary>
+        /// Applies the tier's settings to the renderer and streamer and
+        /// saves the selection. Safe to call mid-frame - every knob a tier
+        /// touches takes effect the next frame.
+        /// </summary>
+        static void SetTier(int index, class Renderer& renderer);
+        static int GetTierIndex() { return s_tierIndex; }
+        static const std::vector<Tier>& GetTiers() { return s_tiers; }
+
+        // per-frame consumers - neutral values until Initialize runs
+        static float GetLodBias() { return s_current.lodBias; }
+        static float GetParticleDensity() { return s_current.particleDensity; }
+        static int GetMaxShadowCascades() { return s_current.maxShadowCascades; }
+        static bool IsPostProcessEnabled() { return s_current.postProcess; }
+
+    private:
+        static void LoadTiers();
+        static void Apply(const Tier& tier, class Renderer& renderer);
+
+        inline static std::vector<Tier> s_tiers;
+        inline static Tier s_current{};
+        inline static int s_tierIndex = -1;
+
+        // first-launch auto-detect state
+        inline static bool s_detecting = false;
+        inline static int s_detectFrames = 0;
+        inline static float s_detectMs = 0;
+    };
+}
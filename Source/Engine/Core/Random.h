@@ -1,37 +1,121 @@
-﻿#pragma once
+#pragma once
 #include "Math/Vector2.h"
 #include "Math/Math.h"
 
-#include <cstdlib>
+#include <atomic>
+#include <cstdint>
 #include <random>
 
 /// <summary>
 /// Random number generation utilities namespace providing convenient functions
-/// for generating various types of random values using modern C++ random facilities.
-/// All functions use a shared Mersenne Twister generator for consistency and quality.
+/// for generating various types of random values.
+///
+/// Randomness comes from per-thread PCG32 streams rather than one shared
+/// generator: job system workers draw from their own stream with no contention
+/// and no cross-thread coupling, and every stream is derived deterministically
+/// from the engine seed plus a per-thread stream id. Reseeding through seed()
+/// therefore reproduces the same sequences on every thread, which the replay
+/// mode depends on - as long as threads first touch randomness in the same
+/// order, which holds for workers created at engine initialization.
+///
+/// The getInt/getReal/getBool facade keeps its original shape; bulk users
+/// (particle spawns, scatter placement) should prefer the fill() batch
+/// functions, which draw a whole span in one tight, vectorizable loop.
 /// </summary>
 namespace neu::random {
     /// <summary>
-    /// Returns a reference to the shared Mersenne Twister random number generator.
-    /// The generator is initialized once using a hardware random device for seeding.
-    /// This provides high-quality random numbers with a long period suitable for most applications.
+    /// PCG32 generator (O'Neill's pcg32_random_r): 64-bit LCG state with an
+    /// output permutation, one multiply-add per draw. Small enough to live in
+    /// thread-local storage and fast enough to call per particle; distinct
+    /// stream ids select provably non-overlapping sequences from one seed.
     /// </summary>
-    /// <returns>Reference to the static mt19937 generator instance</returns>
-    inline std::mt19937& generator() {
-        // Hardware-based random device for seeding (when available)
-        static std::random_device rd;
-        // Mersenne Twister generator, seeded once on first access
-        static std::mt19937 gen(rd());
-        return gen;
+    struct pcg32 {
+        uint64_t state{ 0 };
+        uint64_t increment{ 1 };
+
+        /// <summary>
+        /// Initializes the generator from a seed value and stream id. The
+        /// same (seed, stream) pair always produces the same sequence.
+        /// </summary>
+        void seed(uint64_t value, uint64_t stream) {
+            state = 0;
+            increment = (stream << 1u) | 1u;
+            next();
+            state += value;
+            next();
+        }
+
+        /// <summary>
+        /// Advances the generator and returns 32 uniformly distributed bits.
+        /// </summary>
+        uint32_t next() {
+            uint64_t old = state;
+            state = old * 6364136223846793005ULL + increment;
+
+            // xorshift the high bits down, then rotate by the top 5 bits -
+            // the permutation that gives PCG its statistical quality
+            uint32_t xorshifted = (uint32_t)(((old >> 18u) ^ old) >> 27u);
+            uint32_t rot = (uint32_t)(old >> 59u);
+            return (xorshifted >> rot) | (xorshifted << ((0u - rot) & 31u));
+        }
+
+        /// <summary>
+        /// Returns a uniform float in [0, 1) built from the top 24 bits of
+        /// one draw - every representable value is exact, no division.
+        /// </summary>
+        float nextFloat() {
+            return (next() >> 8) * 0x1.0p-24f;
+        }
+    };
+
+    // engine-wide seed and reseed epoch - threads notice an epoch bump and
+    // rebuild their stream lazily on next use, so seed() takes effect
+    // everywhere without touching other threads' storage
+    inline std::atomic<uint64_t> s_seed{ 0 };
+    inline std::atomic<uint32_t> s_epoch{ 1 };
+    inline std::atomic<uint32_t> s_nextStream{ 0 };
+
+    /// <summary>
+    /// Returns the calling thread's generator, creating it on first use.
+    /// Each thread gets a unique stream id in first-touch order and seeds
+    /// from the engine seed, so sequences are deterministic per thread and
+    /// never shared across threads.
+    /// </summary>
+    /// <returns>Reference to the calling thread's PCG32 stream</returns>
+    inline pcg32& stream() {
+        // default seed is hardware entropy, captured once - replay runs
+        // overwrite it up front through seed()
+        static const bool initialized = [] {
+            uint64_t expected = 0;
+            std::random_device rd;
+            s_seed.compare_exchange_strong(expected, ((uint64_t)rd() << 32) | rd());
+            return true;
+        }();
+        (void)initialized;
+
+        thread_local pcg32 generator;
+        thread_local uint32_t streamId = s_nextStream.fetch_add(1, std::memory_order_relaxed);
+        thread_local uint32_t epoch = 0;
+
+        uint32_t current = s_epoch.load(std::memory_order_acquire);
+        if (epoch != current) {
+            generator.seed(s_seed.load(std::memory_order_acquire), streamId);
+            epoch = current;
+        }
+
+        return generator;
     }
 
     /// <summary>
     /// Seeds the random number generator with a specific value.
-    /// Useful for reproducible random sequences in testing, debugging, or deterministic simulations.
+    /// Useful for reproducible random sequences in testing, debugging, or
+    /// deterministic simulations - every thread's stream restarts from the
+    /// new seed (keeping its stream id) the next time it draws.
     /// </summary>
-    /// <param name="value">The seed value to initialize the generator with</param>
+    /// <param name="value">The seed value to initialize the generators with</param>
     inline void seed(unsigned int value) {
-        generator().seed(value);
+        s_seed.store(value, std::memory_order_release);
+        s_epoch.fetch_add(1, std::memory_order_release);
     }
 
     /// <summary>
@@ -42,9 +126,11 @@ namespace neu::random {
     /// <param name="max">The maximum value (inclusive)</param>
     /// <returns>A random integer between min and max (both inclusive)</returns>
     inline int getInt(int min, int max) {
-        // Uniform distribution ensures each value in range has equal probability
-        std::uniform_int_distribution<> dist(min, max);
-        return dist(generator());
+        // multiply-shift maps one draw onto the range without modulo bias
+        // worth caring about at game scale
+        uint32_t range = (uint32_t)(max - min) + 1;
+        if (range == 0) return min + (int)stream().next();
+        return min + (int)(((uint64_t)stream().next() * range) >> 32);
     }
 
     /// <summary>
@@ -58,14 +144,11 @@ namespace neu::random {
     }
 
     /// <summary>
-    /// Generates a random integer using the full range of the distribution.
-    /// Returns values across the entire range supported by the uniform_int_distribution.
+    /// Generates a random non-negative integer using the generator's full output.
     /// </summary>
-    /// <returns>A random integer from the full distribution range</returns>
+    /// <returns>A random integer in [0, INT_MAX]</returns>
     inline int getInt() {
-        // Static distribution to avoid recreation overhead
-        static std::uniform_int_distribution<> dist;
-        return dist(generator());
+        return (int)(stream().next() >> 1);
     }
 
     /// <summary>
@@ -78,9 +161,7 @@ namespace neu::random {
     /// <returns>A random real number of type T in the range [min, max)</returns>
     template <typename T = float>
     inline T getReal(T min, T max) {
-        // Uniform real distribution for floating-point values
-        std::uniform_real_distribution<T> dist(min, max);
-        return dist(generator());
+        return min + (T)stream().nextFloat() * (max - min);
     }
 
     /// <summary>
@@ -104,20 +185,49 @@ namespace neu::random {
     /// <returns>A random real number of type T in the range [0, 1).</returns>
     template <typename T = float>
     inline T getReal() {
-        // Static distribution to avoid recreation overhead
-        static std::uniform_real_distribution<T> dist(static_cast<T>(0), static_cast<T>(1));
-        return dist(generator());
+        return (T)stream().nextFloat();
     }
 
     /// <summary>
     /// Generates a random boolean value with 50% probability for true/false.
-    /// Uses Bernoulli distribution for proper statistical properties.
     /// </summary>
     /// <returns>A random boolean value (true or false with equal probability)</returns>
     inline bool getBool() {
-        // Bernoulli distribution with p=0.5 for fair coin flip
-        static std::bernoulli_distribution dist(0.5);
-        return dist(generator());
+        return (stream().next() & 1) != 0;
+    }
+
+    /// <summary>
+    /// Fills a span of floats with uniform values in [min, max) from the
+    /// calling thread's stream. One generator advance per element and no
+    /// per-call distribution setup, so the loop vectorizes - prefer this
+    /// over per-element getReal() when drawing dozens of values at once
+    /// (particle spawn bursts, scatter placement).
+    /// </summary>
+    /// <param name="values">Destination array to fill</param>
+    /// <param name="count">Number of values to generate</param>
+    /// <param name="min">The minimum value (inclusive)</param>
+    /// <param name="max">The maximum value (exclusive)</param>
+    inline void fill(float* values, size_t count, float min = 0, float max = 1) {
+        pcg32& generator = stream();
+        float scale = (max - min) * 0x1.0p-24f;
+        for (size_t i = 0; i < count; i++) {
+            values[i] = min + (generator.next() >> 8) * scale;
+        }
+    }
+
+    /// <summary>
+    /// Fills a span of 2D vectors with uniformly distributed points on the
+    /// unit circle, batch counterpart of onUnitCircle(). Uses the table
+    /// sine/cosine - random directions don't need library precision.
+    /// </summary>
+    /// <param name="values">Destination array to fill</param>
+    /// <param name="count">Number of unit vectors to generate</param>
+    inline void fill(vec2* values, size_t count) {
+        pcg32& generator = stream();
+        for (size_t i = 0; i < count; i++) {
+            float radians = generator.nextFloat() * math::twoPi;
+            values[i] = vec2{ math::FastCos(radians), math::FastSin(radians) };
+        }
     }
 
     /// <summary>
@@ -134,4 +244,4 @@ namespace neu::random {
         // cos(θ) gives x-component, sin(θ) gives y-component
         return vec2{ math::cosf(radians), math::sinf(radians) };
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,293 @@
+#pragma once
+#include "Assert.h"
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace neu {
+
+	/// <summary>
+	/// Vector with inline storage for its first N elements.
+	///
+	/// Small, predictably-sized containers (an actor's components, a model's
+	/// submesh buffers) pay a heap allocation per instance with std::vector
+	/// even though they almost never outgrow a handful of entries. A
+	/// small_vector keeps up to N elements in the object itself and only
+	/// touches the heap past that, so the common case allocates nothing and
+	/// the elements sit next to the fields that use them.
+	///
+	/// Covers the vector surface the engine actually uses (push/emplace,
+	/// iteration, indexing, clear); spills grow geometrically like
+	/// std::vector. Moving a spilled small_vector steals the heap block;
+	/// moving an inline one moves elements, so iterators never survive a
+	/// move either way.
+	/// </summary>
+	/// <typeparam name="T">Element type</typeparam>
+	/// <typeparam name="N">Elements stored inline before spilling to the heap</typeparam>
+	template<typename T, size_t N>
+	class small_vector {
+	public:
+		using value_type = T;
+		using iterator = T*;
+		using const_iterator = const T*;
+
+		small_vector() = default;
+
+		small_vector(const small_vector& other) {
+			reserve(other.m_size);
+			for (size_t i = 0; i < other.m_size; i++) {
+				new (m_data + i) T(other.m_data[i]);
+			}
+			m_size = other.m_size;
+		}
+
+		small_vector(small_vector&& other) noexcept {
+			TakeFrom(other);
+		}
+
+		~small_vector() {
+			clear();
+			if (m_data != InlineData()) {
+				::operator delete(m_data, std::align_val_t{ alignof(T) });
+			}
+		}
+
+		small_vector& operator=(const small_vector& other) {
+			if (this == &other) return *this;
+
+			clear();
+			reserve(other.m_size);
+			for (size_t i = 0; i < other.m_size; i++) {
+				new (m_data + i) T(other.m_data[i]);
+			}
+			m_size = other.m_size;
+			return *this;
+		}
+
+		small_vector& operator=(small_vector&& other) noexcept {
+			if (this == &other) return *this;
+
+			clear();
+			if (m_data != InlineData()) {
+				::operator delete(m_data, std::align_val_t{ alignof(T) });
+				m_data = InlineData();
+				m_capacity = N;
+			}
+			TakeFrom(other);
+			return *this;
+		}
+
+		void push_back(const T& value) { emplace_back(value); }
+		void push_back(T&& value) { emplace_back(std::move(value)); }
+
+		template<typename... Args>
+		T& emplace_back(Args&&... args) {
+			if (m_size == m_capacity) Grow(m_capacity * 2);
+			T* element = new (m_data + m_size) T(std::forward<Args>(args)...);
+			m_size++;
+			return *element;
+		}
+
+		void pop_back() {
+			m_size--;
+			m_data[m_size].~T();
+		}
+
+		void clear() {
+			for (size_t i = m_size; i > 0; i--) m_data[i - 1].~T();
+			m_size = 0;
+		}
+
+		void reserve(size_t capacity) {
+			if (capacity > m_capacity) Grow(capacity);
+		}
+
+		void resize(size_t size) {
+			reserve(size);
+			while (m_size > size) pop_back();
+			while (m_size < size) new (m_data + m_size++) T();
+		}
+
+		T* erase(T* position) {
+			for (T* element = position; element + 1 != end(); element++) {
+				*element = std::move(element[1]);
+			}
+			pop_back();
+			return position;
+		}
+
+		size_t size() const { return m_size; }
+		size_t capacity() const { return m_capacity; }
+		bool empty() const { return m_size == 0; }
+
+		T* data() { return m_data; }
+		const T* data() const { return m_data; }
+
+		T* begin() { return m_data; }
+		T* end() { return m_data + m_size; }
+		const T* begin() const { return m_data; }
+		const T* end() const { return m_data + m_size; }
+
+		T& operator[](size_t index) { return m_data[index]; }
+		const T& operator[](size_t index) const { return m_data[index]; }
+
+		T& front() { return m_data[0]; }
+		const T& front() const { return m_data[0]; }
+		T& back() { return m_data[m_size - 1]; }
+		const T& back() const { return m_data[m_size - 1]; }
+
+	private:
+		T* InlineData() { return reinterpret_cast<T*>(m_inline); }
+
+		void Grow(size_t capacity) {
+			T* data = (T*)::operator new(capacity * sizeof(T), std::align_val_t{ alignof(T) });
+			for (size_t i = 0; i < m_size; i++) {
+				new (data + i) T(std::move(m_data[i]));
+				m_data[i].~T();
+			}
+
+			if (m_data != InlineData()) {
+				::operator delete(m_data, std::align_val_t{ alignof(T) });
+			}
+			m_data = data;
+			m_capacity = capacity;
+		}
+
+		// steal other's heap block when it spilled, move elements into the
+		// inline buffer when it didn't; other is left empty either way
+		void TakeFrom(small_vector& other) {
+			if (other.m_data != other.InlineData()) {
+				m_data = other.m_data;
+				m_size = other.m_size;
+				m_capacity = other.m_capacity;
+				other.m_data = other.InlineData();
+				other.m_capacity = N;
+			}
+			else {
+				for (size_t i = 0; i < other.m_size; i++) {
+					new (m_data + i) T(std::move(other.m_data[i]));
+					other.m_data[i].~T();
+				}
+				m_size = other.m_size;
+			}
+			other.m_size = 0;
+		}
+
+		alignas(T) unsigned char m_inline[N * sizeof(T)];
+		T* m_data{ InlineData() };
+		size_t m_size{ 0 };
+		size_t m_capacity{ N };
+	};
+
+	/// <summary>
+	/// Vector with a hard capacity of N, stored entirely inline.
+	///
+	/// For containers whose size is bounded by design (a submesh's LOD
+	/// chain, per-pass cascade lists) - no heap, no growth, and pushing past
+	/// the cap asserts in debug builds, catching the broken invariant at the
+	/// push instead of as a reallocation the design says can't happen.
+	/// </summary>
+	/// <typeparam name="T">Element type</typeparam>
+	/// <typeparam name="N">Hard element capacity</typeparam>
+	template<typename T, size_t N>
+	class fixed_vector {
+	public:
+		using value_type = T;
+		using iterator = T*;
+		using const_iterator = const T*;
+
+		fixed_vector() = default;
+
+		fixed_vector(const fixed_vector& other) {
+			for (size_t i = 0; i < other.m_size; i++) {
+				new (Data() + i) T(other.Data()[i]);
+			}
+			m_size = other.m_size;
+		}
+
+		fixed_vector(fixed_vector&& other) noexcept {
+			for (size_t i = 0; i < other.m_size; i++) {
+				new (Data() + i) T(std::move(other.Data()[i]));
+				other.Data()[i].~T();
+			}
+			m_size = other.m_size;
+			other.m_size = 0;
+		}
+
+		~fixed_vector() { clear(); }
+
+		fixed_vector& operator=(const fixed_vector& other) {
+			if (this == &other) return *this;
+
+			clear();
+			for (size_t i = 0; i < other.m_size; i++) {
+				new (Data() + i) T(other.Data()[i]);
+			}
+			m_size = other.m_size;
+			return *this;
+		}
+
+		fixed_vector& operator=(fixed_vector&& other) noexcept {
+			if (this == &other) return *this;
+
+			clear();
+			for (size_t i = 0; i < other.m_size; i++) {
+				new (Data() + i) T(std::move(other.Data()[i]));
+				other.Data()[i].~T();
+			}
+			m_size = other.m_size;
+			other.m_size = 0;
+			return *this;
+		}
+
+		void push_back(const T& value) { emplace_back(value); }
+		void push_back(T&& value) { emplace_back(std::move(value)); }
+
+		template<typename... Args>
+		T& emplace_back(Args&&... args) {
+			ASSERT_MSG(m_size < N, "fixed_vector capacity exceeded");
+			T* element = new (Data() + m_size) T(std::forward<Args>(args)...);
+			m_size++;
+			return *element;
+		}
+
+		void pop_back() {
+			m_size--;
+			Data()[m_size].~T();
+		}
+
+		void clear() {
+			for (size_t i = m_size; i > 0; i--) Data()[i - 1].~T();
+			m_size = 0;
+		}
+
+		size_t size() const { return m_size; }
+		static constexpr size_t capacity() { return N; }
+		bool empty() const { return m_size == 0; }
+		bool full() const { return m_size == N; }
+
+		T* data() { return Data(); }
+		const T* data() const { return Data(); }
+
+		T* begin() { return Data(); }
+		T* end() { return Data() + m_size; }
+		const T* begin() const { return Data(); }
+		const T* end() const { return Data() + m_size; }
+
+		T& operator[](size_t index) { return Data()[index]; }
+		const T& operator[](size_t index) const { return Data()[index]; }
+
+		T& front() { return Data()[0]; }
+		const T& front() const { return Data()[0]; }
+		T& back() { return Data()[m_size - 1]; }
+		const T& back() const { return Data()[m_size - 1]; }
+
+	private:
+		T* Data() { return reinterpret_cast<T*>(m_storage); }
+		const T* Data() const { return reinterpret_cast<const T*>(m_storage); }
+
+		alignas(T) unsigned char m_storage[N * sizeof(T)];
+		size_t m_size{ 0 };
+	};
+}
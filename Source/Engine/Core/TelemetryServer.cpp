@@ -0,0 +1,299 @@
+#include "TelemetryServer.h"
+#include "File.h"
+#include "JobSystem.h"
+#include "Logger.h"
+#include "MemoryTracker.h"
+#include "Profiler.h"
+#include "Time.h"
+#include "../Engine.h"
+#include "../Renderer/FrameStats.h"
+#include "../Renderer/UploadScheduler.h"
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+#ifdef _WIN32
+#include <WinSock2.h>
+#pragma comment(lib, "Ws2_32.lib")
+#endif
+
+namespace neu {
+	namespace {
+		// fixed-layout stats section of every packet, little-endian as
+		// written. Extend at the end only and bump kVersion - the viewer
+		// keys its parsing off the version field
+#pragma pack(push, 1)
+		struct StatsBlock {
+			uint64_t packetIndex;
+			float timeSeconds;
+
+			// frame pacing
+			float frameMs;
+			float p50Ms;
+			float p95Ms;
+			float p99Ms;
+			float onePercentLowMs;
+			uint32_t hitchCount;
+
+			// frame statistics service
+			uint32_t drawCalls;
+			uint32_t triangles;
+			uint32_t programBinds;
+			uint32_t materialBinds;
+			uint32_t textureBinds;
+			uint32_t stateChanges;
+			uint64_t uploadBytes;
+
+			// queue depths - a sustained non-zero reading names the
+			// bottleneck (workers, disk, or the upload budget)
+			uint32_t pendingJobs;
+			uint32_t pendingReads;
+			uint32_t queuedUploads;
+			uint64_t queuedUploadBytes;
+
+			// memory tags, live/peak per MemTag plus the total
+			uint64_t tagLiveBytes[(int)MemTag::Count];
+			uint64_t tagPeakBytes[(int)MemTag::Count];
+			uint64_t totalLiveBytes;
+		};
+
+		struct PacketHeader {
+			uint32_t magic;
+			uint16_t version;
+			uint16_t size;	// total packet bytes including this header
+		};
+#pragma pack(pop)
+
+		// 32-bit FNV-1a for scope names - the wire format sends hashes and
+		// announces each hash's string once per connection
+		uint32_t HashName(const char* name) {
+			uint32_t hash = 2166136261u;
+			for (const char* c = name; *c; c++) {
+				hash ^= (uint8_t)*c;
+				hash *= 16777619u;
+			}
+			return hash;
+		}
+
+		void Append(std::vector<uint8_t>& buffer, const void* data, size_t size) {
+			const uint8_t* bytes = (const uint8_t*)data;
+			buffer.insert(buffer.end(), bytes, bytes + size);
+		}
+	}
+
+#ifdef _WIN32
+	bool TelemetryServer::Start(uint16_t port, float publishHz) {
+		if (m_running) return true;
+
+		WSADATA wsaData;
+		if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
+			LOG_WARNING("TelemetryServer: WSAStartup failed");
+			return false;
+		}
+
+		SOCKET listenSocket = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+		if (listenSocket == INVALID_SOCKET) {
+			LOG_WARNING("TelemetryServer: socket creation failed ({})", WSAGetLastError());
+			WSACleanup();
+			return false;
+		}
+
+		// soak boxes restart the engine between runs - don't let the old
+		// socket's TIME_WAIT hold the port hostage
+		BOOL reuse = TRUE;
+		setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, (const char*)&reuse, sizeof(reuse));
+
+		sockaddr_in address{};
+		address.sin_family = AF_INET;
+		address.sin_addr.s_addr = INADDR_ANY;
+		address.sin_port = htons(port);
+		if (bind(listenSocket, (sockaddr*)&address, sizeof(address)) == SOCKET_ERROR ||
+			listen(listenSocket, SOMAXCONN) == SOCKET_ERROR) {
+			LOG_WARNING("TelemetryServer: bind/listen on port {} failed ({})", port, WSAGetLastError());
+			closesocket(listenSocket);
+			WSACleanup();
+			return false;
+		}
+
+		// everything below runs on the main thread - accepts and sends must
+		// never block the frame
+		u_long nonBlocking = 1;
+		ioctlsocket(listenSocket, FIONBIO, &nonBlocking);
+
+		m_listenSocket = (uintptr_t)listenSocket;
+		m_running = true;
+		SetPublishHz(publishHz);
+		m_accumulated = 0;
+
+		LOG_INFO("TelemetryServer: listening on port {} at {} Hz", port, publishHz);
+		return true;
+	}
+
+	void TelemetryServer::Stop() {
+		if (!m_running) return;
+
+		for (auto& client : m_clients) closesocket((SOCKET)client.socket);
+		m_clients.clear();
+
+		closesocket((SOCKET)m_listenSocket);
+		m_listenSocket = 0;
+		m_running = false;
+		WSACleanup();
+	}
+
+	void TelemetryServer::Update(float dt) {
+		if (!m_running) return;
+
+		AcceptClients();
+
+		m_accumulated += dt;
+		if (m_accumulated < m_interval) return;
+		m_accumulated = 0;
+
+		// no one listening - skip the snapshot entirely, the server then
+		// costs one failed accept per frame
+		if (m_clients.empty()) return;
+
+		BuildStatsBlock();
+		for (size_t i = 0; i < m_clients.size(); ) {
+			SendPacket(m_clients[i]);
+			// SendPacket zeroes the socket on a dead/stalled connection
+			if (m_clients[i].socket == 0) {
+				m_clients[i] = std::move(m_clients.back());
+				m_clients.pop_back();
+			}
+			else {
+				i++;
+			}
+		}
+		m_packetIndex++;
+	}
+
+	void TelemetryServer::AcceptClients() {
+		while (true) {
+			SOCKET client = accept((SOCKET)m_listenSocket, nullptr, nullptr);
+			if (client == INVALID_SOCKET) break;	// WSAEWOULDBLOCK - no one waiting
+
+			u_long nonBlocking = 1;
+			ioctlsocket(client, FIONBIO, &nonBlocking);
+
+			// telemetry packets are small and latency matters more than
+			// throughput on a dashboard feed
+			BOOL noDelay = TRUE;
+			setsockopt(client, IPPROTO_TCP, TCP_NODELAY, (const char*)&noDelay, sizeof(noDelay));
+
+			m_clients.push_back({ (uintptr_t)client, {} });
+			LOG_INFO("TelemetryServer: viewer connected ({} total)", m_clients.size());
+		}
+	}
+
+	void TelemetryServer::BuildStatsBlock() {
+		StatsBlock stats{};
+		stats.packetIndex = m_packetIndex;
+
+		Engine& engine = GetEngine();
+		stats.timeSeconds = engine.GetTime().GetTime();
+
+		stats.frameMs = Profiler::GetFrameMs();
+		Time::FrameTimings timings = engine.GetTime().GetFrameTimings();
+		stats.p50Ms = timings.p50;
+		stats.p95Ms = timings.p95;
+		stats.p99Ms = timings.p99;
+		stats.onePercentLowMs = timings.onePercentLowMs;
+		stats.hitchCount = (uint32_t)engine.GetTime().GetHitchCount();
+
+		const FrameStats::Frame& frame = FrameStats::GetFrame();
+		stats.drawCalls = frame.drawCalls;
+		stats.triangles = frame.triangles;
+		stats.programBinds = frame.programBinds;
+		stats.materialBinds = frame.materialBinds;
+		stats.textureBinds = frame.textureBinds;
+		stats.stateChanges = frame.stateChanges;
+		stats.uploadBytes = frame.uploadBytes;
+
+		stats.pendingJobs = (uint32_t)std::max(engine.GetJobSystem().GetPendingJobCount(), 0);
+		stats.pendingReads = (uint32_t)file::GetPendingReadCount();
+		stats.queuedUploads = (uint32_t)UploadScheduler::Instance().GetQueuedCount();
+		stats.queuedUploadBytes = UploadScheduler::Instance().GetQueuedBytes();
+
+		for (int tag = 0; tag < (int)MemTag::Count; tag++) {
+			MemoryTracker::TagStats tagStats = MemoryTracker::GetStats((MemTag)tag);
+			stats.tagLiveBytes[tag] = tagStats.liveBytes;
+			stats.tagPeakBytes[tag] = tagStats.peakBytes;
+		}
+		stats.totalLiveBytes = MemoryTracker::GetTotalLiveBytes();
+
+		m_statsBlock.clear();
+		Append(m_statsBlock, &stats, sizeof(stats));
+
+		// profiler aggregates: total inclusive time per scope name over the
+		// last harvested frame, largest first, capped at kMaxScopes
+		std::unordered_map<const char*, uint64_t> totals;
+		for (const Profiler::Sample& sample : Profiler::GetFrameSamples()) {
+			totals[sample.name] += sample.end - sample.begin;
+		}
+
+		m_packetScopes.clear();
+		std::vector<std::pair<const char*, uint64_t>> sorted(totals.begin(), totals.end());
+		std::sort(sorted.begin(), sorted.end(),
+			[](const auto& a, const auto& b) { return a.second > b.second; });
+		if (sorted.size() > kMaxScopes) sorted.resize(kMaxScopes);
+
+		uint8_t scopeCount = (uint8_t)sorted.size();
+		Append(m_statsBlock, &scopeCount, sizeof(scopeCount));
+		for (auto& [name, totalUs] : sorted) {
+			uint32_t hash = HashName(name);
+			uint32_t total32 = (uint32_t)std::min<uint64_t>(totalUs, UINT32_MAX);
+			Append(m_statsBlock, &hash, sizeof(hash));
+			Append(m_statsBlock, &total32, sizeof(total32));
+			m_packetScopes.push_back({ hash, name });
+		}
+	}
+
+	void TelemetryServer::SendPacket(Client& client) {
+		m_sendBuffer.clear();
+
+		PacketHeader header{ kMagic, kVersion, 0 };
+		Append(m_sendBuffer, &header, sizeof(header));
+		Append(m_sendBuffer, m_statsBlock.data(), m_statsBlock.size());
+
+		// announce scope-name strings this client hasn't seen - each name
+		// crosses the wire once per connection, after that it's a hash
+		uint8_t nameCount = 0;
+		size_t nameCountOffset = m_sendBuffer.size();
+		Append(m_sendBuffer, &nameCount, sizeof(nameCount));
+		for (const ScopeEntry& scope : m_packetScopes) {
+			if (client.sentNames.contains(scope.hash)) continue;
+			client.sentNames.insert(scope.hash);
+
+			uint8_t length = (uint8_t)std::min<size_t>(strlen(scope.name), 255);
+			Append(m_sendBuffer, &scope.hash, sizeof(scope.hash));
+			Append(m_sendBuffer, &length, sizeof(length));
+			Append(m_sendBuffer, scope.name, length);
+			nameCount++;
+		}
+		m_sendBuffer[nameCountOffset] = nameCount;
+
+		((PacketHeader*)m_sendBuffer.data())->size = (uint16_t)m_sendBuffer.size();
+
+		// one non-blocking send per packet; a viewer too stalled to take a
+		// whole packet (or gone entirely) is dropped, never waited on
+		int sent = send((SOCKET)client.socket, (const char*)m_sendBuffer.data(), (int)m_sendBuffer.size(), 0);
+		if (sent != (int)m_sendBuffer.size()) {
+			closesocket((SOCKET)client.socket);
+			client.socket = 0;
+			LOG_INFO("TelemetryServer: viewer disconnected");
+		}
+	}
+
+#else
+	// no socket backend on this platform - the API stays callable so call
+	// sites don't need their own guards
+	bool TelemetryServer::Start(uint16_t, float) { return false; }
+	void TelemetryServer::Stop() {}
+	void TelemetryServer::Update(float) {}
+	void TelemetryServer::AcceptClients() {}
+	void TelemetryServer::BuildStatsBlock() {}
+	void TelemetryServer::SendPacket(Client&) {}
+#endif
+}
@@ -0,0 +1,102 @@
+#pragma once
+#include "Singleton.h"
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+namespace neu {
+	/// <summary>
+	/// Publishes the engine's performance counters over a local TCP socket
+	/// in a compact binary protocol, so an external viewer can graph frame
+	/// times, profiler aggregates, memory tags and streaming queue depths
+	/// live - the overnight soak boxes stream into one dashboard instead of
+	/// needing someone at each machine watching the editor overlay.
+	///
+	/// The server listens on a local port and accepts any number of
+	/// viewers. At the configured publish rate it snapshots the frame
+	/// statistics service, Time's percentiles, the memory tracker tags, the
+	/// job/read/upload queue depths and the profiler's per-scope totals
+	/// into one packet and sends it to every connected client. Scope names
+	/// travel as 32-bit hashes; the string for each hash is appended once
+	/// per connection, the first time that client sees it.
+	///
+	/// All socket work is non-blocking on the main thread: accepts and
+	/// sends cost microseconds, and a stalled viewer is dropped rather
+	/// than ever blocking the frame. Telemetry builds (NEU_TELEMETRY)
+	/// start the server automatically; other builds start it explicitly.
+	/// See Tools/telemetry_viewer.py for the matching viewer/recorder.
+	/// </summary>
+	class TelemetryServer : public Singleton<TelemetryServer> {
+	public:
+		static constexpr uint16_t kDefaultPort = 7711;
+
+		// packet header: magic, protocol version, total packet bytes
+		static constexpr uint32_t kMagic = 0x4C45544E;	// "NTEL" in the stream
+		static constexpr uint16_t kVersion = 1;
+
+		// profiler scopes included per packet, largest totals first
+		static constexpr size_t kMaxScopes = 16;
+
+		/// <summary>
+		/// Starts listening. Safe to call when already running (no-op).
+		/// </summary>
+		/// <param name="port">TCP port to listen on</param>
+		/// <param name="publishHz">Packets per second sent to each viewer</param>
+		/// <returns>True if the listen socket came up</returns>
+		bool Start(uint16_t port = kDefaultPort, float publishHz = 10.0f);
+
+		/// <summary>
+		/// Closes every client connection and the listen socket.
+		/// </summary>
+		void Stop();
+
+		bool IsRunning() const { return m_running; }
+		int GetClientCount() const { return (int)m_clients.size(); }
+
+		/// <param name="publishHz">Packets per second sent to each viewer</param>
+		void SetPublishHz(float publishHz) { m_interval = (publishHz > 0) ? 1.0f / publishHz : 0.1f; }
+
+		/// <summary>
+		/// Accepts new viewers and, when the publish interval has elapsed,
+		/// snapshots the counters and sends a packet to every client.
+		/// Called once per frame by Engine::Update; off-interval calls only
+		/// accumulate time.
+		/// </summary>
+		/// <param name="dt">Frame delta time in seconds</param>
+		void Update(float dt);
+
+	private:
+		friend class Singleton<TelemetryServer>;
+		TelemetryServer() = default;
+
+		// one connected viewer and the scope-name hashes already sent to it
+		struct Client {
+			uintptr_t socket;
+			std::unordered_set<uint32_t> sentNames;
+		};
+
+		void AcceptClients();
+		void BuildStatsBlock();
+		void SendPacket(Client& client);
+
+		bool m_running{ false };
+		uintptr_t m_listenSocket{ 0 };
+		std::vector<Client> m_clients;
+
+		float m_interval{ 0.1f };
+		float m_accumulated{ 0 };
+		uint64_t m_packetIndex{ 0 };
+
+		// shared per-publish stats block; per-client name records and the
+		// header are appended into m_sendBuffer around it
+		std::vector<uint8_t> m_statsBlock;
+		std::vector<uint8_t> m_sendBuffer;
+
+		// scopes included in the current stats block, for name records
+		struct ScopeEntry {
+			uint32_t hash;
+			const char* name;
+		};
+		std::vector<ScopeEntry> m_packetScopes;
+	};
+}
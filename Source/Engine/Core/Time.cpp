@@ -1,4 +1,5 @@
 #include "Time.h"
+#include <algorithm>
 
 namespace neu {
     /// <summary>
@@ -11,16 +12,90 @@ namespace neu {
         // Capture the current high-resolution time point
         clock::time_point now = clock::now();
 
-        // Calculate total elapsed time since start/reset
-        // Convert from chrono duration to float seconds
-        m_time = std::chrono::duration<float>(now - m_startTime).count();
-
-        // Calculate time elapsed since last frame
-        // This gives us the unscaled delta time in seconds
-        m_deltaTime = std::chrono::duration<float>(now - m_frameTime).count();
+        // Wall-clock time since last frame always gets measured - it feeds
+        // the frame history and hitch detection below even when the
+        // simulation runs on a fixed step
+        m_wallDelta = std::chrono::duration<float>(now - m_frameTime).count();
 
         // Update frame time for next delta calculation
         // Store current time as the reference point for the next frame
         m_frameTime = now;
+
+        if (m_deterministicDelta > 0) {
+            // determinism mode: simulated time advances by exactly the
+            // configured step per frame, so replay runs are identical no
+            // matter how fast the machine executes them
+            m_deltaTime = m_deterministicDelta;
+            m_time += m_deterministicDelta;
+        }
+        else {
+            // Calculate total elapsed time since start/reset
+            // Convert from chrono duration to float seconds
+            m_time = std::chrono::duration<float>(now - m_startTime).count();
+
+            // Calculate time elapsed since last frame
+            // This gives us the unscaled delta time in seconds
+            m_deltaTime = m_wallDelta;
+        }
+
+        // the first delta spans engine initialization, not a rendered frame -
+        // letting it into the history would poison the percentiles and fire
+        // a phantom hitch on every launch
+        if (m_firstTick) {
+            m_firstTick = false;
+            return;
+        }
+
+        // record the frame into the history ring - wall clock, so the
+        // profiling numbers stay real in determinism mode
+        float frameMs = m_wallDelta * 1000.0f;
+        m_frameHistory[m_historyIndex] = frameMs;
+        m_historyIndex = (m_historyIndex + 1) % kFrameHistory;
+        m_historyCount = math::min(m_historyCount + 1, kFrameHistory);
+
+        // hitch detection: Engine::Update calls Profiler::EndFrame just
+        // before Tick, so the harvested samples are exactly the frame whose
+        // duration tripped the threshold - copy them while they're still the
+        // current snapshot and the slow frame arrives with its own flame view
+        if (frameMs > m_hitchThresholdMs) {
+            m_hitchCount++;
+            m_lastHitch.frameMs = frameMs;
+            m_lastHitch.time = m_time;
+            m_lastHitch.samples = Profiler::GetFrameSamples();
+
+            LOG_WARNING("hitch: {:.1f} ms frame at {:.1f} s ({} samples captured)",
+                frameMs, m_time, m_lastHitch.samples.size());
+        }
+    }
+
+    /// <summary>
+    /// Computes the frame-time distribution over the history window. The
+    /// ring is copied and sorted here - at kFrameHistory entries that's
+    /// editor-panel cost, not per-frame gameplay cost.
+    /// </summary>
+    Time::FrameTimings Time::GetFrameTimings() const
+    {
+        FrameTimings timings;
+        int count = m_historyCount;
+        if (count == 0) return timings;
+
+        // the ring's order doesn't matter for a distribution - copy the
+        // filled portion regardless of where the write index sits
+        float sorted[kFrameHistory];
+        std::copy(m_frameHistory, m_frameHistory + count, sorted);
+        std::sort(sorted, sorted + count);
+
+        timings.p50 = sorted[(count - 1) * 50 / 100];
+        timings.p95 = sorted[(count - 1) * 95 / 100];
+        timings.p99 = sorted[(count - 1) * 99 / 100];
+
+        // 1% low: the average of the slowest 1% of frames (at least one),
+        // reported as a frame time - the editor converts to fps for display
+        int lows = math::max(count / 100, 1);
+        float sum = 0;
+        for (int i = count - lows; i < count; i++) sum += sorted[i];
+        timings.onePercentLowMs = sum / lows;
+
+        return timings;
     }
 }
\ No newline at end of file
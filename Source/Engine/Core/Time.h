@@ -1,12 +1,20 @@
 #pragma once
+#include "Profiler.h"
 #include "Math/Math.h"
 #include <chrono>
+#include <vector>
 
 namespace neu {
     /// <summary>
     /// A high-precision timing utility class for tracking elapsed time and frame deltas.
     /// This class provides functionality for measuring time intervals, calculating delta times
     /// between frames, and applying time scaling effects.
+    ///
+    /// Tick() also records every frame's duration into a ring buffer so frame
+    /// pacing can be quantified rather than eyeballed: GetFrameTimings()
+    /// reports p50/p95/p99 and the 1% low over the window, and frames past
+    /// the hitch threshold snapshot the profiler tree for the offending frame
+    /// so a playtest stutter arrives with its culprit attached.
     /// </summary>
     class Time {
     private:
@@ -15,6 +23,37 @@ namespace neu {
         /// </summary>
         using clock = std::chrono::high_resolution_clock;
 
+    public:
+        /// <summary>
+        /// Number of frames the history ring holds - a few seconds at 60 fps,
+        /// enough samples for the 1% low to mean something.
+        /// </summary>
+        static constexpr int kFrameHistory = 256;
+
+        /// <summary>
+        /// Frame-time distribution over the history window, all in milliseconds.
+        /// The percentiles expose pacing the average hides - a smooth 16 ms
+        /// average can still carry a 90 ms p99. The 1% low is the average of
+        /// the slowest 1% of frames, the number benchmark reviews quote.
+        /// </summary>
+        struct FrameTimings {
+            float p50{ 0 };
+            float p95{ 0 };
+            float p99{ 0 };
+            float onePercentLowMs{ 0 };
+        };
+
+        /// <summary>
+        /// One detected hitch: the frame's duration, when it happened, and a
+        /// copy of the profiler samples for that frame - the flame view of
+        /// the slow frame itself, not whatever frame the editor is open on.
+        /// </summary>
+        struct HitchRecord {
+            float frameMs{ 0 };
+            float time{ 0 };
+            std::vector<Profiler::Sample> samples;
+        };
+
     public:
         /// <summary>
         /// Default constructor that initializes the timer with current time as start point.
@@ -58,12 +97,82 @@ namespace neu {
         /// <param name="timeScale">The scaling factor to apply to delta time (default: 1.0)</param>
         void SetTimeScale(float timeScale) { m_timeScale = timeScale; }
 
+        /// <summary>
+        /// Enables determinism mode: every Tick advances total time and delta
+        /// time by exactly this step, regardless of wall clock. Two runs over
+        /// the same content then simulate identical time, which replay and
+        /// perf A/B comparisons depend on. The frame history and hitch
+        /// detection keep measuring real wall-clock durations, so profiling
+        /// stays honest while the simulation is fixed.
+        /// </summary>
+        /// <param name="delta">Simulated seconds per Tick, 0 restores wall-clock timing</param>
+        void SetDeterministicDelta(float delta) { m_deterministicDelta = delta; }
+
+        /// <summary>
+        /// The deterministic per-Tick step, 0 when running off the wall clock.
+        /// </summary>
+        /// <returns>Simulated seconds per Tick, or 0</returns>
+        float GetDeterministicDelta() const { return m_deterministicDelta; }
+
+        /// <summary>
+        /// Gets the duration of the last frame in milliseconds, unscaled and
+        /// uncapped - the real wall-clock cost, unlike GetDeltaTime(), and
+        /// still wall clock in determinism mode.
+        /// </summary>
+        /// <returns>Last frame's duration in milliseconds</returns>
+        float GetLastFrameMs() const { return m_wallDelta * 1000.0f; }
+
+        /// <summary>
+        /// Computes the frame-time percentiles and 1% low over the history
+        /// window. Sorts a copy of the ring, so call it for display rather
+        /// than per frame in gameplay code.
+        /// </summary>
+        /// <returns>Percentiles and 1% low in milliseconds, zeros before the first frame</returns>
+        FrameTimings GetFrameTimings() const;
+
+        /// <summary>
+        /// Gets the frame-time history ring in milliseconds for the editor
+        /// plot, oldest entry at GetFrameHistoryIndex().
+        /// </summary>
+        const float* GetFrameHistory() const { return m_frameHistory; }
+        int GetFrameHistoryIndex() const { return m_historyIndex; }
+
+        /// <summary>
+        /// Sets the frame duration above which a frame counts as a hitch and
+        /// snapshots its profiler tree (default: 50 ms).
+        /// </summary>
+        /// <param name="ms">Hitch threshold in milliseconds</param>
+        void SetHitchThresholdMs(float ms) { m_hitchThresholdMs = ms; }
+        float GetHitchThresholdMs() const { return m_hitchThresholdMs; }
+
+        /// <summary>
+        /// Gets the number of hitches detected since startup.
+        /// </summary>
+        int GetHitchCount() const { return m_hitchCount; }
+
+        /// <summary>
+        /// Gets the most recent hitch with its captured profiler samples.
+        /// Only meaningful when GetHitchCount() is non-zero.
+        /// </summary>
+        const HitchRecord& GetLastHitch() const { return m_lastHitch; }
+
     private:
         /// <summary>
         /// Total elapsed time since timer creation or last reset (in seconds)
         /// </summary>
         float m_time = 0;
 
+        /// <summary>
+        /// Fixed simulated step for determinism mode, 0 = wall clock
+        /// </summary>
+        float m_deterministicDelta = 0;
+
+        /// <summary>
+        /// Wall-clock duration of the last frame (in seconds) - feeds the
+        /// frame history and hitch detection even in determinism mode
+        /// </summary>
+        float m_wallDelta = 0;
+
         /// <summary>
         /// Time elapsed since the last Tick() call (in seconds, unscaled)
         /// </summary>
@@ -88,5 +197,27 @@ namespace neu {
         /// Time point from the previous frame, used for delta time calculations
         /// </summary>
         clock::time_point m_frameTime;
+
+        /// <summary>
+        /// Frame-time ring buffer in milliseconds and the slot the next frame
+        /// lands in; count tracks fill-up so percentiles ignore empty slots
+        /// </summary>
+        float m_frameHistory[kFrameHistory]{};
+        int m_historyIndex = 0;
+        int m_historyCount = 0;
+
+        /// <summary>
+        /// The first Tick() spans engine initialization, not a frame - it is
+        /// excluded from the history and the hitch detector
+        /// </summary>
+        bool m_firstTick = true;
+
+        /// <summary>
+        /// Hitch detection state: threshold, running count and the last
+        /// captured hitch with its profiler snapshot
+        /// </summary>
+        float m_hitchThresholdMs = 50.0f;
+        int m_hitchCount = 0;
+        HitchRecord m_lastHitch;
     };
 }
\ No newline at end of file
@@ -0,0 +1,67 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+
+namespace neu {
+    /// <summary>
+    /// Compile-time type identity without RTTI.
+    ///
+    /// TypeName extracts the type's spelling from the compiler's function
+    /// signature macro and TypeHash folds it through FNV-1a, both in
+    /// constant expressions - a type's 64-bit hash is a literal at the use
+    /// site, so type identity checks reduce to integer compares. The
+    /// spelling (and therefore the hash) is compiler-specific; hashes are
+    /// process-local identity keys, never serialized.
+    /// </summary>
+    /// <typeparam name="T">The type to name</typeparam>
+    /// <returns>The type's spelling inside this compiler's signature</returns>
+    template<typename T>
+    constexpr std::string_view TypeName() {
+#if defined(_MSC_VER)
+        // "... __cdecl neu::TypeName<class neu::Actor>(void)"
+        std::string_view signature = __FUNCSIG__;
+        std::string_view prefix = "TypeName<";
+        std::string_view suffix = ">(void)";
+
+        size_t start = signature.find(prefix);
+        if (start == std::string_view::npos) return signature;
+        start += prefix.size();
+
+        size_t end = signature.rfind(suffix);
+        if (end == std::string_view::npos || end <= start) return signature;
+
+        return signature.substr(start, end - start);
+#else
+        // "... neu::TypeName() [with T = neu::Actor]" (gcc) or
+        // "... neu::TypeName() [T = neu::Actor]" (clang)
+        std::string_view signature = __PRETTY_FUNCTION__;
+        std::string_view prefix = "T = ";
+
+        size_t start = signature.find(prefix);
+        if (start == std::string_view::npos) return signature;
+        start += prefix.size();
+
+        size_t end = signature.find_first_of(";]", start);
+        if (end == std::string_view::npos) return signature;
+
+        return signature.substr(start, end - start);
+#endif
+    }
+
+    /// <summary>
+    /// 64-bit FNV-1a hash of TypeName, evaluable at compile time. Same
+    /// constants as the engine's other identity hashes (event ids, resource
+    /// keys), but case-sensitive - type spellings are exact.
+    /// </summary>
+    /// <typeparam name="T">The type to hash</typeparam>
+    /// <returns>Compile-time 64-bit hash of the type's name</returns>
+    template<typename T>
+    constexpr uint64_t TypeHash() {
+        uint64_t hash = 14695981039346656037ull;
+        for (char c : TypeName<T>()) {
+            hash ^= (uint64_t)(unsigned char)c;
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+}
@@ -2,31 +2,123 @@
 #include "Renderer/Renderer.h"
 #include "Input/InputSystem.h"
 #include "Audio/AudioSystem.h"
+#include "Core/JobSystem.h"
+#include "Physics/CollisionSystem.h"
 
 namespace neu {
 
     /// <summary>
-    /// Initializes all engine subsystems in dependency order.
-    /// Sets up the core systems required for a functional game engine.
+    /// Initializes all engine subsystems, overlapping the independent ones.
+    /// The job system comes up first so audio (FMOD init alone costs a few
+    /// hundred milliseconds) and the resource/file worker pools initialize
+    /// on workers while the main thread creates the window and GL context -
+    /// time-to-first-frame approaches the longest phase instead of the sum
+    /// of all of them. Every phase is timed into the startup timeline,
+    /// logged here and viewable in the editor's profiler panel.
     /// </summary>
-    bool Engine::Initialize() {
-        // Initialize the rendering system first as other systems may depend on it
+    bool Engine::Initialize(bool headless) {
+        auto initStart = std::chrono::steady_clock::now();
+        m_startupTimeline.clear();
+
+        // phase recorder - async phases complete on job workers, so the
+        // timeline pushes are serialized under a mutex. Everything kicked
+        // async is joined before Initialize returns, so the stack captures
+        // below are safe
+        std::mutex timelineMutex;
+        auto msSince = [initStart] {
+            return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - initStart).count();
+        };
+        auto recordPhase = [&](const char* name, bool async, auto&& work) {
+            float start = msSince();
+            work();
+            std::scoped_lock lock(timelineMutex);
+            m_startupTimeline.push_back({ name, start, msSince() - start, async });
+        };
+
+        // Reserve the per-frame transient arena before any system that might
+        // allocate from it runs
+        recordPhase("frame arena", false, [] { FrameArena::Initialize(); });
+
+        // The work-stealing job system starts first so the independent
+        // subsystems below can initialize on its workers
+        m_jobs = std::make_unique<neu::JobSystem>();
+        recordPhase("job system", false, [this] { m_jobs->Initialize(); });
+
+        // Kick the subsystems with no window or GL dependency onto workers
+        std::atomic<int> pendingInit{ 0 };
+
+        // Audio system - FMOD init is the single most expensive phase and
+        // touches nothing the main thread is doing
+        m_audio = std::make_unique<neu::AudioSystem>();
+        pendingInit++;
+        m_jobs->Submit([&] {
+            recordPhase("audio", true, [this] { m_audio->Initialize(); });
+            pendingInit--;
+        });
+
+        // Resource worker pool and the async file read service - both just
+        // spawn threads, and the session preload below needs them running
+        pendingInit++;
+        m_jobs->Submit([&] {
+            recordPhase("resource workers + async io", true, [] {
+                Resources().StartWorkers();
+                file::StartAsyncIO();
+            });
+            pendingInit--;
+        });
+
+        // Meanwhile on the main thread: the rendering system and the main
+        // application window. Headless (benchmark) runs keep the same
+        // resolution so draw cost is comparable, but never show the window
+        // and run without vsync
         m_renderer = std::make_unique<neu::Renderer>();
-        m_renderer->Initialize();
+        recordPhase("renderer + window + GL context", false, [&] {
+            m_renderer->Initialize();
+            m_renderer->CreateWindow("Computer Graphics", 1920, 1080, false, headless);
+        });
 
-        // Create the main application window with default settings
-        // Window title: "Computer Graphics", Resolution: 1280x1024, Windowed mode
-        m_renderer->CreateWindow("Computer Graphics", 1920, 1080, false);
+        // Quality tier presets - restores the saved tier (or starts the
+        // first-launch auto-detect) and applies it to the renderer and
+        // streamer before any scene loads
+        recordPhase("quality tiers", false, [this] { Quality::Initialize(*m_renderer); });
 
-        // Initialize input system for handling user interactions
-        // Must be initialized after renderer as it may need window context
+        // Input system - needs the renderer's SDL init, and the data-driven
+        // action bindings components resolve at Start ride along
         m_input = std::make_unique<neu::InputSystem>();
-        m_input->Initialize();
+        recordPhase("input", false, [this] {
+            m_input->Initialize();
+            m_input->LoadActionMap("actions.json");
+        });
 
-        // Initialize audio system for sound playback capabilities
-        // Independent of other systems, can be initialized last
-        m_audio = std::make_unique<neu::AudioSystem>();
-        m_audio->Initialize();
+        // Collision system handling broadphase detection and OnCollision
+        // dispatch for the active scene
+        m_collision = std::make_unique<neu::CollisionSystem>();
+        recordPhase("collision", false, [this] { m_collision->Initialize(); });
+
+        // Join the worker phases before anything can touch audio or the
+        // resource pool. With a healthy overlap this wait is near zero -
+        // when it isn't, the timeline shows which phase ran long
+        recordPhase("wait for async init", false, [&] {
+            while (pendingInit.load()) std::this_thread::yield();
+        });
+
+        // Replay last session's load order as one warming sweep, so first-use
+        // loads hit cached data instead of cold scattered reads
+        recordPhase("session preload", false, [] { Resources().PreloadSessionManifest(); });
+
+#ifdef NEU_TELEMETRY
+        // QA builds publish their counters unattended - the overnight soak
+        // boxes stream into the dashboard without anyone opting in per run.
+        // Other builds call TelemetryServer::Start explicitly when wanted
+        TelemetryServer::Instance().Start();
+#endif
+
+        // the startup timeline report - per-phase timings against the
+        // 2-second time-to-interactive budget
+        for (auto& phase : m_startupTimeline) {
+            LOG_INFO("startup: {:>8.2f} ms  {}{}", phase.durationMs, phase.name, phase.async ? " [worker]" : "");
+        }
+        LOG_INFO("startup: total {:.2f} ms to end of Initialize", msSince());
 
         // Return true indicating successful initialization
         // In a more robust implementation, this would check each system's
@@ -39,10 +131,41 @@ namespace neu {
     /// Shuts down systems in reverse order of initialization to respect dependencies.
     /// </summary>
     void Engine::Shutdown() {
+        // Close the telemetry feed before anything it samples goes away
+        TelemetryServer::Instance().Stop();
+
+        // Stop the job system first so no parallel work runs while the
+        // remaining systems tear down
+        m_jobs->Shutdown();
+
+        // Stop the async file reads before the systems consuming their
+        // completions tear down
+        file::StopAsyncIO();
+
+        // Stop the resource worker pool before clearing the cache so no
+        // worker touches resources during teardown
+        Resources().StopWorkers();
+
+        // Record what this session loaded, in order, so the next run can
+        // preload it all during startup
+        Resources().WriteSessionManifest();
+
         // Clear all cached resources to prevent memory leaks
         // This releases textures, sounds, models, and other loaded assets
         Resources().RemoveAll();
 
+        // Release the shared texture arrays material maps were packed into
+        TextureArrayCache::Instance().Clear();
+
+        // Release the pooled render targets while the GL context is current
+        RenderTargetPool::Instance().Clear();
+
+        // Release the shared sampler objects materials bound from
+        SamplerCache::Instance().Clear();
+
+        // Drop the batched flipbook quads and their instance stream
+        FlipbookBatcher::Instance().Clear();
+
         // Clear factory registry to remove all registered object creators
         // Prevents dangling pointers and ensures clean factory state
         Factory::Instance().RemoveAll();
@@ -54,6 +177,9 @@ namespace neu {
         // Shutdown engine systems in reverse initialization order
         // This ensures dependencies are properly handled during cleanup
 
+        // Shutdown the collision system (holds no per-frame state)
+        m_collision->Shutdown();
+
         // Shutdown audio system first (least dependent on other systems)
         m_audio->Shutdown();
 
@@ -66,6 +192,14 @@ namespace neu {
 
         if (m_scene) m_scene->Destroyed();
 
+        // Release the frame arena - any stray late allocation falls back to
+        // the heap rather than touching freed memory
+        FrameArena::Shutdown();
+
+        // Flush queued log messages and stop the writer thread last so every
+        // system above can still log during its own teardown
+        Logger::Shutdown();
+
         // unique_ptr destructors will automatically clean up allocated memory
         // when the Engine instance is destroyed
     }
@@ -75,6 +209,20 @@ namespace neu {
     /// Maintains consistent update order for predictable system behavior.
     /// </summary>
     void Engine::Update() {
+        // Close out the previous profiler frame (Update through Draw) and
+        // harvest every thread's samples for the editor flame view
+        Profiler::EndFrame();
+
+        // Last frame's transient allocations (component slices, draw
+        // batches) all die here in one step
+        FrameArena::Reset();
+
+        // Drop last frame's debug lines and labels before systems submit
+        // new ones (compiles out in shipping builds)
+        DebugDraw::Instance().Clear();
+
+        PROFILE_SCOPE("Engine::Update");
+
         // Update timing system first to provide accurate delta time
         // This calculates the time elapsed since the last frame
         // All other systems depend on this timing information
@@ -85,21 +233,134 @@ namespace neu {
         // Must happen early in the update cycle for responsive input handling
         m_input->Update();
 
+        // Focus-aware throttling: pace an unfocused window to a background
+        // cap and a minimized one lower still. The pacing sleep sits in
+        // Present on this thread, so job system workers, async reads and
+        // texture streaming keep making progress while the window idles
+        float throttle = 0;
+        if (m_input->IsWindowMinimized()) throttle = m_minimizedFrameRate;
+        else if (!m_input->HasWindowFocus()) throttle = m_unfocusedFrameRate;
+        m_renderer->SetThrottleFrameRate(throttle);
+
         // Update audio system to process sound effects and music
         // This handles audio streaming, 3D positional audio updates,
         // and removes finished sound effects from memory
         m_audio->Update();
 
+        // Finalize pending async resource loads on the main (GL) thread
+        // under a per-frame time budget to avoid load hitches
+        Resources().Update();
+
+        // Deliver finished async file reads to their requesters under the
+        // same kind of budget (texture mip completions land here)
+        file::PumpReadCompletions();
+
+        // Play back queued streaming uploads against the frame's byte and
+        // time allowance - completions above queue their GL work here
+        // instead of uploading immediately
+        UploadScheduler::Instance().Drain();
+
+#ifdef NEU_MEM_TRACKING_ENABLED
+        // mirror the externally-accounted pools into the memory tracker so
+        // the panel and benchmark dump read every subsystem from one place
+        MemoryTracker::Sample(MemTag::Resources, Resources().GetMemoryUsed());
+
+        int audioBytes = 0;
+        FMOD::Memory_GetStats(&audioBytes, nullptr, false);
+        MemoryTracker::Sample(MemTag::Audio, (size_t)audioBytes);
+#endif
+
+        // Poll loaded assets for on-disk edits and reload them in place
+        // (developer iteration path - a sweep only runs every interval)
+        HotReload::Instance().Update(m_time.GetDeltaTime());
+
+        // First-launch quality auto-detect - samples harvested GPU frame
+        // times for the opening seconds, then locks in a tier and saves it
+        Quality::Update(*m_renderer);
+
+        // Advance every batched flipbook quad's playback in one pass -
+        // quad owners only touch placement, never frame timing
+        FlipbookBatcher::Instance().Update(m_time.GetDeltaTime());
+
+        // Wake and resume coroutine tasks whose delays, events or loads
+        // completed - the batch runs here, before the scene update, so a
+        // woken task's effects land in this frame's simulation
+        TaskScheduler::Instance().Update(m_time.GetDeltaTime());
+
+        // Run budgeted incremental work - heavy computations sliced with
+        // co_await YieldWork advance inside a fixed per-frame budget here,
+        // so influence maps and generation steps never spike one frame
+        WorkScheduler::Instance().Update(m_time.GetDeltaTime());
+
         // Note: Game-specific update logic (entities, physics, AI, etc.)
         // would typically happen here in derived classes or through
         // additional systems managed by the engine
 
 
-        if (m_scene) m_scene->Update(m_time.GetDeltaTime());
+        if (m_fixedDelta > 0) {
+            // Fixed-step mode: bank the frame's delta and run whole
+            // simulation steps at a constant rate. Collision runs per step
+            // so callbacks always see transforms from the step they overlap
+            // in, same as the variable path
+            m_accumulator += m_time.GetDeltaTime();
+
+            // cap banked time so a hitchy frame can't snowball into an
+            // ever-growing pile of catch-up steps (the death spiral)
+            m_accumulator = math::min(m_accumulator, m_fixedDelta * m_maxSubsteps);
+
+            while (m_accumulator >= m_fixedDelta) {
+                if (m_scene) {
+                    m_scene->Update(m_fixedDelta);
+                    m_collision->Update(*m_scene);
+                }
+                m_accumulator -= m_fixedDelta;
+            }
+
+            // the leftover fraction of a step becomes the render blend
+            // factor - Scene::Draw interpolates transforms between the
+            // previous and current step instead of snapping at the step rate
+            if (m_scene) m_scene->SetRenderAlpha(m_accumulator / m_fixedDelta);
+        }
+        else {
+            if (m_scene) m_scene->Update(m_time.GetDeltaTime());
+
+            // Detect collider overlaps and dispatch OnCollision callbacks at a
+            // fixed point after the scene update, so callbacks see post-update
+            // transforms and run before queued events dispatch
+            if (m_scene) m_collision->Update(*m_scene);
+
+            // variable-step draws present the simulation state directly
+            if (m_scene) m_scene->SetRenderAlpha(1);
+        }
+
+        // Re-sample the driver memory report (throttled internally) so the
+        // streaming budget below already reflects this frame's headroom
+        GPUMemory::Update();
+
+        // Re-score texture mip residency against the camera - disk reads
+        // queue through the resource worker pool, and the uploads land in a
+        // later frame's Resources().Update() budget
+        if (m_scene) TextureStreamer::Instance().Update(*m_scene);
+
+        // Publish the frame's counters to any connected telemetry viewers
+        // (no-op when the server isn't running or no one is connected)
+        TelemetryServer::Instance().Update(m_time.GetDeltaTime());
+
+        // Drain the deferred event queue after the scene update so events
+        // fired during actor updates (including from job system workers)
+        // dispatch this frame at a single, well-defined point
+        EventManager::Instance().DispatchQueued();
+
+        // with the scene fully settled for this frame, record the draw
+        // submission on a worker - the command lists build while the main
+        // thread finishes its frame work, and Draw() waits then plays back
+        if (m_scene) m_scene->RecordDrawAsync();
     }
 
     void Engine::Draw()
     {
+        PROFILE_SCOPE("Engine::Draw");
+
         if (m_scene) m_scene->Draw(*m_renderer);
     }
 }
\ No newline at end of file
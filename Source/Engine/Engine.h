@@ -3,11 +3,15 @@
 #include "Core/Singleton.h"
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace neu {
     class Renderer;
     class AudioSystem;
     class InputSystem;
+    class JobSystem;
+    class CollisionSystem;
 
     /// <summary>
     /// Core engine class that manages all major subsystems and provides the main application framework.
@@ -44,19 +48,22 @@ namespace neu {
     class Engine : public Singleton<Engine> {
     public:
         /// <summary>
-        /// Initializes all engine subsystems in the correct dependency order.
-        /// 
+        /// Initializes all engine subsystems, overlapping the independent ones.
+        ///
         /// Initialization sequence:
-        /// 1. Creates and initializes the rendering system with default window
-        /// 2. Sets up the input system for user interaction handling
-        /// 3. Initializes the audio system for sound playback
-        /// 
+        /// 1. Starts the job system, then kicks audio and the resource/file
+        ///    worker pools onto its workers
+        /// 2. Meanwhile creates the rendering system, window and GL context
+        ///    on the main thread, followed by input and collision
+        /// 3. Joins the worker phases, then replays the session preload
+        ///
         /// The method ensures that dependencies between systems are respected
         /// and that all systems are properly configured before returning.
-        /// If any system fails to initialize, the entire initialization fails.
+        /// Every phase is timed into the startup timeline (GetStartupTimeline).
         /// </summary>
+        /// <param name="headless">If true, the window is created hidden with vsync off - used by the benchmark harness for offscreen scene replay</param>
         /// <returns>True if all systems initialized successfully, false if any system failed</returns>
-        bool Initialize();
+        bool Initialize(bool headless = false);
 
         /// <summary>
         /// Shuts down all engine systems and releases resources in reverse initialization order.
@@ -123,6 +130,21 @@ namespace neu {
         /// <returns>Reference to the active InputSystem instance</returns>
         InputSystem& GetInput() { return *m_input; }
 
+        /// <summary>
+        /// Provides access to the work-stealing job system for parallel frame work.
+        /// Used by Scene for batched actor updates and available to any system
+        /// that wants to spread work across cores.
+        /// </summary>
+        /// <returns>Reference to the active JobSystem instance</returns>
+        JobSystem& GetJobSystem() { return *m_jobs; }
+
+        /// <summary>
+        /// Provides access to the collision system handling broadphase overlap
+        /// detection and OnCollision dispatch for the active scene's colliders.
+        /// </summary>
+        /// <returns>Reference to the active CollisionSystem instance</returns>
+        CollisionSystem& GetCollision() { return *m_collision; }
+
         /// <summary>
         /// Provides access to the timing system for frame-rate independent operations.
         /// The time system provides delta time, total elapsed time, and time scaling functionality.
@@ -131,6 +153,70 @@ namespace neu {
         /// <returns>Reference to the engine's Time system</returns>
         Time& GetTime() { return m_time; }
 
+        /// <summary>
+        /// One phase of engine startup for the timeline report: when it
+        /// began relative to the start of Initialize and how long it took.
+        /// Async phases ran on a job system worker, overlapped with the
+        /// main-thread phases (their start/duration windows overlap).
+        /// </summary>
+        struct StartupPhase {
+            std::string name;
+            float startMs{ 0 };
+            float durationMs{ 0 };
+            bool async{ false };
+        };
+
+        /// <summary>
+        /// Per-phase startup timings recorded by Initialize, in completion
+        /// order. Logged at the end of Initialize and displayed in the
+        /// editor's profiler panel; stable once Initialize returns.
+        /// </summary>
+        /// <returns>The recorded startup phases</returns>
+        const std::vector<StartupPhase>& GetStartupTimeline() const { return m_startupTimeline; }
+
+        /// <summary>
+        /// Enables accumulator-driven fixed-step simulation updates.
+        ///
+        /// Frame delta time feeds an accumulator and the scene is stepped at
+        /// a constant rate (possibly zero or several times per frame), so
+        /// gameplay behaves identically at 60 and 144 Hz and a hitchy frame
+        /// can't feed one giant delta into movement code. The leftover
+        /// accumulator fraction is handed to the scene as the render blend
+        /// factor, and Scene::Draw interpolates transforms between the
+        /// previous and current step so motion stays smooth at any refresh
+        /// rate. Catch-up work per frame is capped at maxSubsteps - beyond
+        /// that, excess time is dropped rather than spiraling.
+        /// </summary>
+        /// <param name="rate">Simulation steps per second, 0 restores variable-step updates</param>
+        /// <param name="maxSubsteps">Maximum catch-up steps run in a single frame</param>
+        void SetFixedTimeStep(float rate, int maxSubsteps = 4) {
+            m_fixedDelta = (rate > 0) ? 1.0f / rate : 0.0f;
+            m_maxSubsteps = maxSubsteps;
+            m_accumulator = 0;
+        }
+
+        /// <summary>
+        /// Frame-rate caps applied while the window is unfocused or
+        /// minimized, driven by the SDL focus events InputSystem tracks
+        /// (0 disables that cap). The pacing sleep sits in Present on the
+        /// main thread, so job system workers, async file reads and
+        /// texture streaming keep making progress while the window idles -
+        /// load work completes in the background. Time's max-delta clamp
+        /// keeps the resulting large frame deltas from kicking the
+        /// simulation.
+        /// </summary>
+        /// <param name="fps">Frames per second while unfocused, 0 = uncapped</param>
+        void SetUnfocusedFrameRate(float fps) { m_unfocusedFrameRate = fps; }
+        float GetUnfocusedFrameRate() const { return m_unfocusedFrameRate; }
+
+        /// <summary>
+        /// The cap while minimized - lower still, since nothing presented
+        /// is visible. 0 disables the cap.
+        /// </summary>
+        /// <param name="fps">Frames per second while minimized, 0 = uncapped</param>
+        void SetMinimizedFrameRate(float fps) { m_minimizedFrameRate = fps; }
+        float GetMinimizedFrameRate() const { return m_minimizedFrameRate; }
+
 
         void SetScene(std::unique_ptr<Scene> scene) { m_scene = std::move(scene); }
 
@@ -177,6 +263,41 @@ namespace neu {
         /// </summary>
         std::unique_ptr<InputSystem> m_input;
 
+        /// <summary>
+        /// Work-stealing job system spreading frame work across worker threads.
+        /// Initialized alongside the other subsystems and shut down before them
+        /// so no jobs run during subsystem teardown.
+        /// </summary>
+        std::unique_ptr<JobSystem> m_jobs;
+
+        /// <summary>
+        /// Collision system running broadphase detection over the scene's
+        /// ColliderComponents and dispatching OnCollision callbacks at a
+        /// fixed point after the scene update each frame.
+        /// </summary>
+        std::unique_ptr<CollisionSystem> m_collision;
+
+        /// <summary>
+        /// Fixed-step simulation state. A fixedDelta of 0 (the default)
+        /// keeps the original variable-step path; otherwise Update() steps
+        /// the scene whenever the accumulator holds a full step, capped at
+        /// maxSubsteps of catch-up per frame.
+        /// </summary>
+        float m_fixedDelta{ 0 };
+        float m_accumulator{ 0 };
+        int m_maxSubsteps{ 4 };
+
+        /// <summary>
+        /// Focus-aware throttling caps, applied as the renderer's throttle
+        /// frame rate each Update from the input system's window state.
+        /// </summary>
+        float m_unfocusedFrameRate{ 10 };
+        float m_minimizedFrameRate{ 2 };
+
+        /// <summary>
+        /// Startup timeline recorded by Initialize - see GetStartupTimeline.
+        /// </summary>
+        std::vector<StartupPhase> m_startupTimeline;
 
         std::unique_ptr<Scene> m_scene;
     };
@@ -2,33 +2,57 @@
 
 // core
 #include "Core/Assert.h"
+#include "Core/AssetPack.h"
+#include "Core/Compression.h"
 #include "Core/Factory.h"
 #include "Core/File.h"
+#include "Core/FrameArena.h"
+#include "Core/JobSystem.h"
 #include "Core/Json.h"
 #include "Core/Logger.h"
+#include "Core/MemoryTracker.h"
+#include "Core/Profiler.h"
+#include "Core/Quality.h"
 #include "Core/Random.h"
 #include "Core/Singleton.h"
+#include "Core/SmallVector.h"
 #include "Core/StringHelper.h"
+#include "Core/TelemetryServer.h"
 #include "Core/Time.h"
+#include "Core/TypeId.h"
 
 // framework
 #include "Framework/Object.h"
+#include "Framework/Snapshot.h"
 #include "Framework/Actor.h"
+#include "Framework/ActorPool.h"
+#include "Framework/SceneBVH.h"
+#include "Framework/SceneCheckpoint.h"
+#include "Framework/TimerWheel.h"
+#include "Framework/Task.h"
+#include "Framework/TransformCache.h"
+#include "Framework/ZoneGraph.h"
 #include "Framework/Scene.h"
 
 // math
 #include "Math/Math.h"
+#include "Math/BatchMath.h"
 #include "Math/Transform.h"
 #include "Math/Vector2.h"
 #include "Math/Vector3.h"
 #include "Math/Rect.h"
+#include "Math/Bounds.h"
+#include "Math/Frustum.h"
 
 // resources
 #include "Resources/Resource.h"
 #include "Resources/ResourceManager.h"
+#include "Resources/ContentBudgets.h"
+#include "Resources/HotReload.h"
 
 // event manager
 #include "Event/Event.h"
+#include "Event/EventChannel.h"
 #include "Event/EventManager.h"
 #include "Event/Observer.h"
 
@@ -36,21 +60,48 @@
 #include "Input/InputSystem.h"
 
 // audio
+#include "Audio/AudioCook.h"
 #include "Audio/AudioClip.h"
 #include "Audio/AudioChannel.h"
 #include "Audio/AudioSystem.h"
 
 // renderer
 #include "Renderer/Renderer.h"
+#include "Renderer/GLState.h"
+#include "Renderer/GLDebug.h"
+#include "Renderer/BindlessTexture.h"
+#include "Renderer/GPUMemory.h"
+#include "Renderer/GPUProfiler.h"
+#include "Renderer/FrameStats.h"
+#include "Renderer/HiZBuffer.h"
+#include "Renderer/SamplerCache.h"
 #include "Renderer/Texture.h"
+#include "Renderer/TextureStreamer.h"
+#include "Renderer/UploadScheduler.h"
+#include "Renderer/TextureArrayCache.h"
 #include "Renderer/CubeMap.h"
 #include "Renderer/TextureAnimation.h"
+#include "Renderer/Font.h"
+#include "Renderer/Text.h"
 #include "Renderer/Shader.h"
 #include "Renderer/Program.h"
+#include "Renderer/UniformBuffer.h"
+#include "Renderer/StorageBuffer.h"
+#include "Renderer/BufferArena.h"
 #include "Renderer/VertexBuffer.h"
+#include "Renderer/Animation.h"
+#include "Renderer/AnimationTexture.h"
 #include "Renderer/Model.h"
 #include "Renderer/Material.h"
+#include "Renderer/Terrain.h"
+#include "Renderer/DrawList.h"
+#include "Renderer/StaticBatcher.h"
+#include "Renderer/FlipbookBatcher.h"
+#include "Renderer/SpriteBatch.h"
+#include "Renderer/DebugDraw.h"
 #include "Renderer/RenderTexture.h"
+#include "Renderer/RenderTargetPool.h"
+#include "Renderer/RenderGraph.h"
 
 //componenets
 #include "Components/ModelRenderer.h"
@@ -58,6 +109,13 @@
 #include "Components/LightComponent.h"
 #include "Components/FirstPersonController.h"
 #include "Components/PostProcessComponent.h"
+#include "Components/ParticleSystemComponent.h"
+#include "Components/CrowdComponent.h"
+#include "Components/TerrainRenderer.h"
+#include "Components/ColliderComponent.h"
+#include "Components/ReflectionProbeComponent.h"
+#include "Components/AnimationComponent.h"
+#include "Components/AudioEmitterComponent.h"
 
 // GUI
 #include "GUI/GUI.h"
@@ -65,6 +123,25 @@
 
 // physics
 #include "Physics/Collidable.h"
+#include "Physics/CollisionSystem.h"
+
+// ai
+#include "AI/NavMesh.h"
+#include "AI/NavMeshQuery.h"
+
+// compile throughput: the resource lookups nearly every translation unit
+// makes by plain name instantiate once in ResourceManager.cpp - these
+// declarations keep includers from compiling the template bodies themselves
+namespace neu {
+	extern template res_t<Texture> ResourceManager::Get<Texture>(const std::string&);
+	extern template res_t<Texture> ResourceManager::GetWithID<Texture>(const std::string&, const std::string&);
+	extern template res_t<Program> ResourceManager::Get<Program>(const std::string&);
+	extern template res_t<Program> ResourceManager::GetWithID<Program>(const std::string&, const std::string&);
+	extern template res_t<Material> ResourceManager::Get<Material>(const std::string&);
+	extern template res_t<Material> ResourceManager::GetWithID<Material>(const std::string&, const std::string&);
+	extern template res_t<Model> ResourceManager::Get<Model>(const std::string&);
+	extern template res_t<Model> ResourceManager::GetWithID<Model>(const std::string&, const std::string&);
+}
 
 // third-party library
 #include <fmod.hpp>
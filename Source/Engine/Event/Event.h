@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <variant>
 
@@ -37,40 +38,35 @@ namespace neu {
     /// Example Usage:
     /// ```cpp
     /// // Creating different types of events
-    /// Event playerDamage("player_damage", 25);           // int data
-    /// Event speedBoost("speed_boost", 1.5f);             // float data
-    /// Event gameOver("game_over", true);                 // bool data
-    /// Event levelName("level_loaded", std::string("Forest")); // string data
-    /// Event playerPos("player_moved", vec2{100, 200});   // vec2 data
-    /// Event explosion("explosion", vec3{10, 5, 0});      // vec3 data
-    /// 
+    /// Event playerDamage(EVENT_ID(player_damage), 25);           // int data
+    /// Event speedBoost(EVENT_ID(speed_boost), 1.5f);             // float data
+    /// Event gameOver(EVENT_ID(game_over), true);                 // bool data
+    /// Event levelName(EVENT_ID(level_loaded), std::string("Forest")); // string data
+    /// Event playerPos(EVENT_ID(player_moved), vec2{100, 200});   // vec2 data
+    /// Event explosion(EVENT_ID(explosion), vec3{10, 5, 0});      // vec3 data
+    ///
     /// // Sending events through event system
-    /// EventManager::Instance().Send(playerDamage);
+    /// EventManager::Instance().Notify(playerDamage);
     /// ```
     /// </summary>
     struct Event {
         /// <summary>
         /// Type alias for event identifiers.
-        /// 
-        /// Uses std::string to provide human-readable, descriptive event names that are
-        /// easy to debug and understand. String-based IDs offer several advantages:
-        /// - Self-documenting: Event names clearly indicate their purpose
-        /// - Flexible: No need for centralized ID registration or enum management
-        /// - Debuggable: Easy to trace events in logs and debugging sessions
-        /// - Extensible: New event types can be added without coordination
-        /// 
-        /// Naming Conventions:
-        /// - Use lowercase with underscores: "player_died", "level_complete"
-        /// - Be descriptive and specific: "enemy_health_changed" vs "health_changed"
-        /// - Include context when needed: "ui_button_clicked", "physics_collision"
-        /// - Consider namespacing: "audio.music_started", "input.key_pressed"
-        /// 
-        /// Performance Note:
-        /// String comparisons are used for event matching, which is slower than integer
-        /// comparisons but provides better maintainability. For performance-critical
-        /// systems, consider using string hashing or switching to integer-based IDs.
+        ///
+        /// Event ids are 64-bit FNV-1a hashes of the event name, computed at
+        /// compile time by the ADD_OBSERVER/EVENT_NOTIFY macros (see EVENT_ID
+        /// in EventManager.h). Dispatch compares integers instead of strings,
+        /// and observer lookup is a single unordered_map probe.
+        ///
+        /// Naming Conventions (for the names the macros hash):
+        /// - Use lowercase with underscores: player_died, level_complete
+        /// - Be descriptive and specific: enemy_health_changed vs health_changed
+        /// - Include context when needed: ui_button_clicked, physics_collision
+        ///
+        /// The hash lowercases the name first so casing differences map to
+        /// the same id, matching the old case-insensitive string keys.
         /// </summary>
-        using id_t = std::string;
+        using id_t = uint64_t;
 
         /// <summary>
         /// Type alias for event data using std::variant for type-safe polymorphic data.
@@ -114,24 +110,20 @@ namespace neu {
         using data_t = std::variant<int, float, bool, std::string, vec2, vec3>;
 
         /// <summary>
-        /// String identifier uniquely identifying the type of event.
-        /// 
+        /// Hashed identifier uniquely identifying the type of event.
+        ///
         /// This field determines what kind of event this is and how it should be processed.
         /// Event handlers typically use this ID to filter and route events to appropriate
-        /// processing logic.
-        /// 
-        /// The ID should be descriptive and follow consistent naming conventions across
-        /// the engine. It serves as both a routing mechanism and documentation of the
-        /// event's purpose.
-        /// 
-        /// Examples:
-        /// - "player_health_changed": Player's health was modified
-        /// - "level_complete": Current level has been completed
-        /// - "audio_music_finished": Background music track ended
-        /// - "input_key_pressed": A keyboard key was pressed
-        /// - "physics_collision_enter": Two objects started colliding
+        /// processing logic, comparing against EVENT_ID(name) constants.
+        ///
+        /// Examples (of the names the macros hash):
+        /// - player_health_changed: Player's health was modified
+        /// - level_complete: Current level has been completed
+        /// - audio_music_finished: Background music track ended
+        /// - input_key_pressed: A keyboard key was pressed
+        /// - physics_collision_enter: Two objects started colliding
         /// </summary>
-        id_t id;
+        id_t id{ 0 };
 
         /// <summary>
         /// Variant data payload containing the event's associated information.
@@ -184,12 +176,44 @@ namespace neu {
         /// event owns its data and can be safely passed around without worrying
         /// about dangling references or lifetime issues.
         /// </summary>
-        /// <param name="id">String identifier specifying the type of event</param>
+        /// <summary>
+        /// Default constructor producing an empty event, used by the
+        /// EventManager queue storage which holds events inline.
+        /// </summary>
+        Event() = default;
+
+        /// <param name="id">Hashed identifier specifying the type of event</param>
         /// <param name="data">Data payload of any supported variant type</param>
-        Event(const id_t& id, data_t data) :
+        Event(id_t id, data_t data) :
             id{ id },
             data{ data }
         {
         }
     };
+
+    // the EventManager queue copies events inline into a contiguous buffer,
+    // so the payload must stay small-buffer sized - everything in the
+    // variant is inline except long strings, which spill through
+    // std::string's own heap allocation
+    static_assert(sizeof(Event) <= 64, "Event payload must stay small enough for inline queue storage");
+
+    /// <summary>
+    /// FNV-1a 64-bit hash of an event name, usable at compile time.
+    ///
+    /// The name is lowercased while hashing so event ids remain
+    /// case-insensitive like the string keys they replaced. Use the EVENT_ID
+    /// macro rather than calling this directly - it forces constant
+    /// evaluation so no hashing happens at runtime.
+    /// </summary>
+    /// <param name="name">Null-terminated event name</param>
+    /// <returns>64-bit hash of the lowercased name</returns>
+    constexpr Event::id_t HashEventName(const char* name) {
+        uint64_t hash = 14695981039346656037ull;
+        for (const char* c = name; *c != '\0'; ++c) {
+            char ch = (*c >= 'A' && *c <= 'Z') ? (*c - 'A' + 'a') : *c;
+            hash ^= (uint64_t)(unsigned char)ch;
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
 }
\ No newline at end of file
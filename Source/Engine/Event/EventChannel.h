@@ -0,0 +1,194 @@
+#pragma once
+#include "Core/Singleton.h"
+#include <cstddef>
+#include <vector>
+
+namespace neu {
+    /// <summary>
+    /// Statically-typed event channel for high-frequency engine-internal
+    /// events.
+    ///
+    /// The string-keyed EventManager pays an id probe, a variant payload
+    /// and a virtual OnNotify per delivery - fine for data-driven gameplay
+    /// events, too much for events fired thousands of times per frame
+    /// (collision enter/exit, transform and visibility changes). A channel
+    /// is resolved entirely at compile time: one channel per payload type
+    /// T, subscribers stored contiguously as (context, function pointer)
+    /// pairs, and Publish is a plain loop over that array with no hashing,
+    /// no variant and no virtual dispatch.
+    ///
+    /// Delivery is synchronous and immediate on the publishing thread -
+    /// there is no queue and no frame-sync merge, so channels are for
+    /// engine-internal plumbing where the publisher controls the call
+    /// site. Gameplay-facing events that need deferred, re-entrancy-safe
+    /// delivery stay on the EventManager. Subscribing or releasing a
+    /// subscription from inside a handler is not supported; defer it.
+    ///
+    /// Usage:
+    /// ```cpp
+    /// struct CollisionEnterEvent { Actor* actorA; Actor* actorB; };
+    ///
+    /// // subscriber - instance->OnEvent(const CollisionEnterEvent&)
+    /// m_subscription = EventChannel<CollisionEnterEvent>::Instance().Subscribe(this);
+    ///
+    /// // publisher - a span of events reaches each subscriber in one pass
+    /// EventChannel<CollisionEnterEvent>::Instance().Publish(events.data(), events.size());
+    /// ```
+    /// </summary>
+    /// <typeparam name="T">Plain payload struct delivered by value-reference</typeparam>
+    template <typename T>
+    class EventChannel : public Singleton<EventChannel<T>> {
+    public:
+        using handler_t = void(*)(void* context, const T& event);
+        using batch_handler_t = void(*)(void* context, const T* events, size_t count);
+
+        /// <summary>
+        /// RAII handle to one channel subscription, mirroring
+        /// EventSubscription: the channel entry keeps a back-pointer to the
+        /// handle and re-points it across moves and swap-removes, so
+        /// release is one O(1) swap-remove in the subscriber array.
+        /// </summary>
+        class Subscription {
+        public:
+            Subscription() = default;
+            ~Subscription() { Release(); }
+
+            // the channel entry points back at this handle, so handles
+            // move (re-pointing the entry) but never copy
+            Subscription(const Subscription&) = delete;
+            Subscription& operator=(const Subscription&) = delete;
+
+            Subscription(Subscription&& other) noexcept :
+                m_channel{ other.m_channel },
+                m_slot{ other.m_slot }
+            {
+                other.m_channel = nullptr;
+                if (m_channel) m_channel->Repoint(*this);
+            }
+
+            Subscription& operator=(Subscription&& other) noexcept {
+                if (this != &other) {
+                    Release();
+                    m_channel = other.m_channel;
+                    m_slot = other.m_slot;
+                    other.m_channel = nullptr;
+                    if (m_channel) m_channel->Repoint(*this);
+                }
+                return *this;
+            }
+
+            /// <summary>
+            /// Unsubscribes now - one swap-remove in the channel's
+            /// subscriber array. Safe on an empty or released handle.
+            /// </summary>
+            void Release() {
+                if (m_channel) m_channel->Unsubscribe(*this);
+                m_channel = nullptr;
+            }
+
+            bool IsActive() const { return m_channel != nullptr; }
+
+        private:
+            friend class EventChannel;
+
+            EventChannel* m_channel{ nullptr };
+            size_t m_slot{ 0 };
+        };
+
+        /// <summary>
+        /// Registers a handler and returns the RAII handle owning the
+        /// subscription. The optional batch handler receives whole spans
+        /// from the span Publish overload - without one, span publication
+        /// falls back to one handler call per event.
+        /// </summary>
+        /// <param name="context">Opaque pointer passed back to the handler</param>
+        /// <param name="handler">Called once per published event</param>
+        /// <param name="batchHandler">Optional span handler for batch publication</param>
+        /// <returns>Move-only handle releasing the subscription when destroyed</returns>
+        Subscription Subscribe(void* context, handler_t handler, batch_handler_t batchHandler = nullptr) {
+            Subscription subscription;
+            subscription.m_channel = this;
+            subscription.m_slot = m_entries.size();
+            m_entries.push_back({ context, handler, batchHandler, &subscription });
+            return subscription;
+        }
+
+        /// <summary>
+        /// Convenience overload binding instance->OnEvent(const T&) - the
+        /// captureless lambda decays to a plain function pointer, so the
+        /// dispatch cost is identical to the raw overload.
+        /// </summary>
+        /// <param name="instance">Object whose OnEvent receives the events</param>
+        /// <returns>Move-only handle releasing the subscription when destroyed</returns>
+        template <typename C>
+        Subscription Subscribe(C* instance) {
+            return Subscribe(instance, [](void* context, const T& event) {
+                static_cast<C*>(context)->OnEvent(event);
+            });
+        }
+
+        /// <summary>
+        /// Delivers one event to every subscriber, in place, on the calling
+        /// thread.
+        /// </summary>
+        /// <param name="event">The event to deliver</param>
+        void Publish(const T& event) {
+            for (auto& entry : m_entries) {
+                entry.handler(entry.context, event);
+            }
+        }
+
+        /// <summary>
+        /// Delivers a contiguous span of events: subscribers with a batch
+        /// handler get the whole span in one call, the rest get one call
+        /// per event. The span is only valid for the duration of the call.
+        /// </summary>
+        /// <param name="events">Pointer to the first event</param>
+        /// <param name="count">Number of events in the span</param>
+        void Publish(const T* events, size_t count) {
+            if (count == 0) return;
+            for (auto& entry : m_entries) {
+                if (entry.batchHandler) {
+                    entry.batchHandler(entry.context, events, count);
+                }
+                else {
+                    for (size_t i = 0; i < count; i++) {
+                        entry.handler(entry.context, events[i]);
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// True when anyone is listening - publishers gathering payloads
+        /// check this first so an unobserved channel costs one branch.
+        /// </summary>
+        bool HasSubscribers() const { return !m_entries.empty(); }
+        size_t GetSubscriberCount() const { return m_entries.size(); }
+
+    private:
+        /// <summary>
+        /// One subscriber slot plus the back-pointer to its RAII handle -
+        /// how a swap-removed neighbour's handle learns its new slot.
+        /// </summary>
+        struct Entry {
+            void* context;
+            handler_t handler;
+            batch_handler_t batchHandler;
+            Subscription* handle;
+        };
+
+        void Unsubscribe(Subscription& handle) {
+            size_t slot = handle.m_slot;
+            if (slot != m_entries.size() - 1) {
+                m_entries[slot] = m_entries.back();
+                if (m_entries[slot].handle) m_entries[slot].handle->m_slot = slot;
+            }
+            m_entries.pop_back();
+        }
+
+        void Repoint(Subscription& handle) { m_entries[handle.m_slot].handle = &handle; }
+
+        std::vector<Entry> m_entries;
+    };
+}
@@ -1,126 +1,271 @@
 #include "EnginePCH.h"
-#include "Core/StringHelper.h"
 
 namespace neu {
     /// <summary>
     /// Registers an observer to receive notifications for a specific event type.
-    /// 
-    /// This method adds the observer to the subscription list for the given event ID.
-    /// The event ID is converted to lowercase to ensure case-insensitive event handling,
-    /// preventing registration/notification mismatches due to inconsistent casing.
-    /// 
-    /// Implementation details:
-    /// - Uses map's operator[] which creates an entry if it doesn't exist
-    /// - Stores observer as a pointer for efficient copying and storage
-    /// - Allows duplicate registrations (same observer can register multiple times for same event)
-    /// - Registration is immediate and takes effect for the next event dispatch
-    /// 
-    /// Memory management:
-    /// - The observer object must remain valid until it's unregistered
-    /// - EventManager does not take ownership of the observer
-    /// - No validation is performed on the observer reference
+    ///
+    /// The id is a precomputed 64-bit hash (see EVENT_ID), so registration is a
+    /// single unordered_map probe with no string work. The subscription's RAII
+    /// handle parks on the observer itself, so destroying the observer releases
+    /// the registration in O(1).
     /// </summary>
-    /// <param name="id">String identifier for the event type (converted to lowercase internally)</param>
+    /// <param name="id">Hashed identifier for the event type</param>
     /// <param name="observer">Reference to the observer that will receive notifications</param>
-    void EventManager::AddObserver(const Event::id_t& id, IObserver& observer) {
-        // Convert event ID to lowercase for case-insensitive event handling
-        // This ensures "PlayerDied", "playerdied", and "PLAYERDIED" all map to the same event
-        // operator[] creates a new list if the event type doesn't exist
-        m_observers[toLower(id)].push_back(&observer);
+    void EventManager::AddObserver(Event::id_t id, IObserver& observer) {
+        observer.StoreSubscription(Subscribe(id, observer));
     }
 
     /// <summary>
-    /// Removes an observer from all event subscriptions and cleans up empty event type entries.
-    /// 
-    /// This method performs a complete unregistration of the observer across all event types.
-    /// It uses an iterator-based approach to safely remove empty event type entries during
-    /// iteration, preventing memory bloat from unused event type mappings.
-    /// 
-    /// Algorithm:
-    /// 1. Iterate through all event type mappings
-    /// 2. For each event type, remove all instances of the observer
-    /// 3. If the observer list becomes empty, remove the entire event type entry
-    /// 4. Use careful iterator management to handle container modification during iteration
-    /// 
-    /// Performance characteristics:
-    /// - O(n * m) where n = number of event types, m = average observers per type
-    /// - std::erase_if provides efficient removal with single pass through each list
-    /// - Empty event type cleanup prevents map from growing indefinitely
-    /// 
-    /// The cleanup is important because without it, the map would accumulate empty
-    /// entries over time, consuming memory and slightly degrading lookup performance.
+    /// Registers an observer for one event type and returns the owning handle.
+    ///
+    /// The handle records the slot the entry landed in; the entry records the
+    /// handle's address. Either side moving keeps the pair consistent - the
+    /// handle's move constructor re-points the entry, and Unsubscribe's
+    /// swap-remove re-slots the neighbour's handle - so release is always one
+    /// exact O(1) swap-remove, never a search.
+    /// </summary>
+    /// <param name="id">Hashed identifier for the event type</param>
+    /// <param name="observer">Reference to the observer that will receive notifications</param>
+    /// <returns>Move-only handle releasing the subscription when destroyed</returns>
+    EventSubscription EventManager::Subscribe(Event::id_t id, IObserver& observer) {
+        // operator[] creates a new vector if the event type doesn't exist
+        auto& entries = m_observers[id];
+
+        EventSubscription handle;
+        handle.m_id = id;
+        handle.m_slot = entries.size();
+
+        // the back-pointer follows the handle through every move, so it
+        // lands on whatever object the caller ends up holding
+        entries.push_back({ &observer, &handle });
+        return handle;
+    }
+
+    /// <summary>
+    /// Removes an observer from every subscription stored on it.
+    ///
+    /// Each stored handle releases its exact (event, slot) entry with one
+    /// swap-remove - O(1) per subscription. Destroying a wave of subscribed
+    /// actors costs their subscription count, not a sweep across every
+    /// event's observer list. Handles held outside the observer are their
+    /// holder's to release.
     /// </summary>
     /// <param name="observer">Reference to the observer to remove from all subscriptions</param>
     void EventManager::RemoveObserver(IObserver& observer) {
-        // Iterate through all event types with manual iterator control
-        // This allows safe removal of map entries during iteration
-        for (auto it = m_observers.begin(); it != m_observers.end();) {
-            // Get reference to the observer list for this event type
-            auto& observers = it->second;
-
-            // Remove all instances of this observer from the current event type
-            // std::erase_if efficiently removes matching elements in a single pass
-            // Lambda captures observer by reference and compares pointer addresses
-            std::erase_if(observers, [&observer](auto obs) {
-                return obs == &observer;
-                });
-
-            // Clean up empty event type entries to prevent memory bloat
-            // If no observers remain for this event type, remove the entire entry
-            if (observers.empty()) {
-                // erase() returns iterator to the next element
-                it = m_observers.erase(it);
-            }
-            else {
-                // Only increment iterator if we didn't erase the current element
-                ++it;
+        observer.RemoveAllSubscriptions();
+    }
+
+    /// <summary>
+    /// Releases the handle's recorded registry entry with one swap-remove.
+    ///
+    /// The back element overwrites the vacated slot and its handle is
+    /// re-pointed to the new position, so every live handle stays exact.
+    /// Empty event lists are erased to keep the map from growing
+    /// indefinitely.
+    /// </summary>
+    /// <param name="handle">The subscription being released</param>
+    void EventManager::Unsubscribe(EventSubscription& handle) {
+        auto it = m_observers.find(handle.m_id);
+        if (it == m_observers.end()) return;    // RemoveAll already dropped the list
+
+        // swap-remove the recorded slot; the entry moved into it learns its
+        // new position through its own back-pointer
+        auto& entries = it->second;
+        entries[handle.m_slot] = entries.back();
+        entries.pop_back();
+        if (handle.m_slot < entries.size() && entries[handle.m_slot].handle) {
+            entries[handle.m_slot].handle->m_slot = handle.m_slot;
+        }
+
+        if (entries.empty()) m_observers.erase(it);
+    }
+
+    /// <summary>
+    /// Re-points the registry entry at the handle's new address after the
+    /// handle object moved (return from Subscribe, vector growth inside
+    /// StoreSubscription, move assignment).
+    /// </summary>
+    /// <param name="handle">The subscription at its new address</param>
+    void EventManager::Repoint(EventSubscription& handle) {
+        auto it = m_observers.find(handle.m_id);
+        if (it == m_observers.end()) return;
+        it->second[handle.m_slot].handle = &handle;
+    }
+
+    /// <summary>
+    /// Clears every subscription, deactivating outstanding handles in place
+    /// first so a handle released after the wipe doesn't swap-remove a slot
+    /// that a new registration has since claimed.
+    /// </summary>
+    void EventManager::RemoveAll() {
+        for (auto& [id, entries] : m_observers) {
+            for (auto& entry : entries) {
+                if (entry.handle) entry.handle->m_id = 0;
             }
         }
+        m_observers.clear();
+    }
+
+    EventSubscription::EventSubscription(EventSubscription&& other) noexcept :
+        m_id{ other.m_id },
+        m_slot{ other.m_slot }
+    {
+        other.m_id = 0;
+        if (m_id) EventManager::Instance().Repoint(*this);
+    }
+
+    EventSubscription& EventSubscription::operator=(EventSubscription&& other) noexcept {
+        if (this != &other) {
+            Release();
+            m_id = other.m_id;
+            m_slot = other.m_slot;
+            other.m_id = 0;
+            if (m_id) EventManager::Instance().Repoint(*this);
+        }
+        return *this;
+    }
+
+    void EventSubscription::Release() {
+        if (m_id == 0) return;
+        EventManager::Instance().Unsubscribe(*this);
+        m_id = 0;
     }
 
     /// <summary>
     /// Dispatches an event to all observers registered for its event type.
-    /// 
+    ///
     /// This method implements synchronous event delivery, immediately notifying all
-    /// registered observers for the given event type. The event ID is converted to
-    /// lowercase to match the case-insensitive registration system.
-    /// 
+    /// registered observers for the given event type. Lookup is a single hash
+    /// probe on the event's precomputed id and dispatch walks a contiguous
+    /// vector of observer pointers.
+    ///
     /// Dispatch behavior:
     /// - Events with no registered observers are silently ignored (this is normal)
-    /// - All observers are notified in registration order (list iteration order)
+    /// - Observer order is not guaranteed (swap-remove reorders on unregistration)
     /// - Notification is synchronous - all observers are called before method returns
     /// - Observer exceptions may propagate and stop further notifications
-    /// 
+    ///
     /// Performance:
-    /// - O(log n + m) where n = number of event types, m = observers for this event
-    /// - Map lookup is O(log n) for event type
-    /// - Observer notification is O(m) for direct function calls
+    /// - O(1) map probe + O(m) direct calls where m = observers for this event
+    /// - No string hashing or comparison, the id was hashed at compile time
     /// - No dynamic memory allocation during dispatch
-    /// 
-    /// Error handling:
-    /// - Events with unrecognized IDs are silently ignored (no error condition)
-    /// - Observer exceptions are not caught (may interrupt dispatch to remaining observers)
-    /// - Invalid observer pointers would cause undefined behavior
     /// </summary>
     /// <param name="event">The event to dispatch, containing ID and data payload</param>
     void EventManager::Notify(const Event& event) {
-        // Look up observers for this event type using case-insensitive comparison
-        auto it = m_observers.find(toLower(event.id));
+        // Look up observers for this event's precomputed id
+        auto it = m_observers.find(event.id);
 
         // Only proceed if we have registered observers for this event type
         if (it != m_observers.end()) {
-            // Get reference to the list of observers for this event type
-            auto& observers = it->second;
-
-            // Notify each observer in registration order
-            // Uses range-based for loop for clean, efficient iteration
-            for (auto observer : observers) {
+            // Notify each observer over the contiguous entry array
+            for (auto& entry : it->second) {
                 // Call the observer's notification method with the event
                 // Note: If observer throws an exception, remaining observers won't be notified
-                observer->OnNotify(event);
+                entry.observer->OnNotify(event);
             }
         }
         // Events with no observers are silently ignored - this is expected behavior
         // Many events may be sent speculatively or for optional features
     }
+
+    /// <summary>
+    /// Resolves the calling thread's staging queue, registering a fresh one
+    /// on the thread's first Enqueue. The registry mutex is taken only on
+    /// that first call - every later Enqueue goes straight through the
+    /// cached thread_local pointer.
+    /// </summary>
+    /// <returns>The calling thread's staging queue</returns>
+    EventManager::ThreadQueue& EventManager::GetThreadQueue() {
+        if (!t_queue) {
+            std::lock_guard<std::mutex> lock(m_registryMutex);
+            m_threadQueues.push_back(std::make_unique<ThreadQueue>());
+            t_queue = m_threadQueues.back().get();
+        }
+        return *t_queue;
+    }
+
+    /// <summary>
+    /// Appends an event to the calling thread's staging buffer.
+    ///
+    /// Single-producer by construction - only the owning thread writes the
+    /// buffer - so the append is a plain array store followed by a release
+    /// on the counter that publishes the event to the merge. No lock, no
+    /// atomic read-modify-write: job system workers raising events in
+    /// parallel never touch each other's cache lines. A full buffer drops
+    /// the event with a warning rather than blocking or allocating.
+    /// </summary>
+    /// <param name="event">The event to queue</param>
+    void EventManager::Enqueue(const Event& event) {
+        ThreadQueue& queue = GetThreadQueue();
+
+        size_t count = queue.count.load(std::memory_order_relaxed);
+        if (count == kThreadQueueCapacity) {
+            LOG_WARNING("Event staging buffer full, dropping event {}", event.id);
+            return;
+        }
+
+        queue.events[count] = event;
+        queue.count.store(count + 1, std::memory_order_release);
+    }
+
+    /// <summary>
+    /// Merges every thread's staging buffer into the dispatch buffer, then
+    /// dispatches the frame's events.
+    ///
+    /// Runs at the frame sync point where the workers are parked, so the
+    /// merge never overlaps a producer: the acquire on each counter pairs
+    /// with the producer's release and makes the staged events visible,
+    /// and resetting the counter hands the buffer back empty. Events a
+    /// thread staged dispatch in that thread's firing order; observers
+    /// enqueueing follow-up events land in the (already merged) buffers
+    /// and dispatch next frame, never recursively.
+    ///
+    /// Consecutive events with the same id are grouped into one span and
+    /// delivered through OnNotifyBatch - a burst of identical events
+    /// (damage ticks, particle triggers) costs each observer one virtual
+    /// call and one map probe instead of one per event.
+    /// </summary>
+    void EventManager::DispatchQueued() {
+        // merge the staged events thread by thread - the registry lock only
+        // guards the queue list against a racing first-time registration
+        size_t count = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_registryMutex);
+
+            for (auto& queue : m_threadQueues) {
+                size_t staged = queue->count.load(std::memory_order_acquire);
+                if (staged == 0) continue;
+
+                size_t take = math::min(staged, kQueueCapacity - count);
+                if (take < staged) {
+                    LOG_WARNING("Event dispatch buffer full, dropping {} events", staged - take);
+                }
+
+                for (size_t i = 0; i < take; i++) {
+                    m_dispatchBuffer[count++] = std::move(queue->events[i]);
+                }
+                queue->count.store(0, std::memory_order_release);
+            }
+        }
+
+        // dispatch in order, one OnNotifyBatch call per observer per run of
+        // the same id - the dispatch buffer is contiguous, so the run is
+        // passed as a plain span. the default OnNotifyBatch forwards each
+        // event to OnNotify, preserving single-event semantics for
+        // observers that don't override it
+        for (size_t i = 0; i < count;) {
+            Event::id_t id = m_dispatchBuffer[i].id;
+            size_t runEnd = i + 1;
+            while (runEnd < count && m_dispatchBuffer[runEnd].id == id) runEnd++;
+
+            auto it = m_observers.find(id);
+            if (it != m_observers.end()) {
+                for (auto& entry : it->second) {
+                    entry.observer->OnNotifyBatch(&m_dispatchBuffer[i], runEnd - i);
+                }
+            }
+
+            i = runEnd;
+        }
+    }
 }
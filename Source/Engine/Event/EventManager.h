@@ -2,8 +2,27 @@
 #include "Event.h"
 #include "Observer.h"
 #include "Core/Singleton.h"
-#include <map>
-#include <list>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+/// <summary>
+/// Converts an event name into its 64-bit FNV-1a id at compile time.
+///
+/// The integral_constant detour forces the hash to be evaluated during
+/// compilation, so the macro expands to a plain integer constant - no string
+/// is hashed or compared at runtime. Use this both at the notify/observe
+/// macro sites and inside OnNotify handlers:
+/// ```cpp
+/// if (event.id == EVENT_ID(player_health_changed)) { ... }
+/// ```
+/// </summary>
+/// <param name="event_id">The event name (without quotes) to hash</param>
+#define EVENT_ID(event_id)					(std::integral_constant<neu::Event::id_t, neu::HashEventName(#event_id)>::value)
 
 /// <summary>
 /// Convenience macro for registering an observer to receive notifications for a specific event type.
@@ -12,10 +31,13 @@
 /// and passing the current object as the observer. It's designed to be called from within classes
 /// that implement IObserver.
 /// 
-/// The macro expands to: neu::EventManager::Instance().AddObserver("event_id", *this)
-/// 
+/// The subscription comes back as an RAII handle recording its exact
+/// (event, slot) registry location, stored on the observer itself - when the
+/// observer is destroyed each handle releases with one O(1) swap-remove
+/// instead of a registry-wide sweep.
+///
 /// Usage: Place this macro in the constructor or initialization method of observer classes.
-/// 
+///
 /// Example:
 /// ```cpp
 /// class HealthBar : public IObserver {
@@ -26,15 +48,15 @@
 ///     }
 /// };
 /// ```
-/// 
+///
 /// Benefits:
 /// - Reduces boilerplate code for observer registration
-/// - Automatic string conversion prevents typos in event IDs
+/// - Compile-time hashing prevents typos from costing runtime string work
 /// - Consistent registration pattern across the codebase
 /// - Self-documenting: clearly shows which events a class observes
 /// </summary>
 /// <param name="event_id">The event identifier (without quotes) to register for</param>
-#define ADD_OBSERVER(event_id)				neu::EventManager::Instance().AddObserver(#event_id, *this)
+#define ADD_OBSERVER(event_id)				StoreSubscription(neu::EventManager::Instance().Subscribe(EVENT_ID(event_id), *this))
 
 /// <summary>
 /// Convenience macro for unregistering an observer from all event notifications.
@@ -43,8 +65,10 @@
 /// It's typically called automatically from the IObserver destructor but can also be used
 /// for manual unregistration when an observer should stop receiving events before destruction.
 /// 
-/// The macro expands to: neu::EventManager::Instance().RemoveObserver(*this)
-/// 
+/// The macro expands to: neu::EventManager::Instance().RemoveObserver(*this),
+/// which releases every subscription handle stored on the observer - one O(1)
+/// swap-remove per subscription rather than a sweep over every event's list.
+///
 /// Usage examples:
 /// ```cpp
 /// class GameState : public IObserver {
@@ -72,7 +96,14 @@
 /// dispatches it to all registered observers. The event ID is automatically converted
 /// to a string, and the data can be any type supported by the Event::data_t variant.
 /// 
-/// The macro expands to: neu::EventManager::Instance().Notify({ "event_id", data })
+/// The macro expands to: neu::EventManager::Instance().Enqueue({ EVENT_ID(event_id), data })
+///
+/// Events are staged into a per-thread write buffer - no lock, no contention -
+/// and dispatched in order by Engine::Update at a defined pipeline point, so
+/// firing an event from inside an observer or an actor update never re-enters
+/// observer code mid-iteration. Safe to call from job system workers. Call
+/// Notify() directly for the rare case that needs immediate synchronous
+/// delivery.
 /// 
 /// Usage examples:
 /// ```cpp
@@ -85,13 +116,13 @@
 /// 
 /// Benefits:
 /// - Concise syntax for event dispatch with data
-/// - Automatic string conversion for event IDs
+/// - Compile-time hashed event IDs, no per-dispatch string work
 /// - Type-safe data handling through variant system
-/// - Immediate event delivery to all registered observers
+/// - Frame-coherent delivery at a defined pipeline point
 /// </summary>
 /// <param name="event_id">The event identifier (without quotes) to send</param>
 /// <param name="data">The data payload to include with the event</param>
-#define EVENT_NOTIFY_DATA(event_id, data)	neu::EventManager::Instance().Notify({ #event_id, data })
+#define EVENT_NOTIFY_DATA(event_id, data)	neu::EventManager::Instance().Enqueue({ EVENT_ID(event_id), data })
 
 /// <summary>
 /// Convenience macro for sending simple notification events without specific data.
@@ -100,7 +131,7 @@
 /// It's useful for events that represent state changes or triggers that don't require
 /// additional data beyond the fact that they occurred.
 /// 
-/// The macro expands to: neu::EventManager::Instance().Notify({ "event_id", true })
+/// The macro expands to: neu::EventManager::Instance().Enqueue({ EVENT_ID(event_id), true })
 /// 
 /// Usage examples:
 /// ```cpp
@@ -117,7 +148,7 @@
 /// - Simple boolean flags or status updates
 /// </summary>
 /// <param name="event_id">The event identifier (without quotes) to send</param>
-#define EVENT_NOTIFY(event_id)				neu::EventManager::Instance().Notify({ #event_id, true })
+#define EVENT_NOTIFY(event_id)				neu::EventManager::Instance().Enqueue({ EVENT_ID(event_id), true })
 
 namespace neu {
     /// <summary>
@@ -183,63 +214,68 @@ namespace neu {
         /// - The same observer can register for multiple event types
         /// - Duplicate registrations for the same event type are allowed (may result in multiple notifications)
         /// - Registration is immediate and affects the next event dispatch
-        /// 
+        ///
         /// Memory Management:
         /// - Observers are stored as pointers for efficiency
         /// - The EventManager does not take ownership of observer objects
-        /// - Observers must unregister themselves before destruction (handled automatically by IObserver destructor)
-        /// 
+        /// - The subscription handle parks on the observer (StoreSubscription)
+        ///   and releases automatically when the observer is destroyed
+        ///
         /// Usage examples:
         /// ```cpp
         /// // Manual registration (typically done via ADD_OBSERVER macro)
-        /// EventManager::Instance().AddObserver("player_health_changed", healthBar);
-        /// EventManager::Instance().AddObserver("player_health_changed", achievementTracker);
-        /// 
+        /// EventManager::Instance().AddObserver(EVENT_ID(player_health_changed), healthBar);
+        ///
         /// // Using convenience macro (preferred)
         /// ADD_OBSERVER(player_health_changed);
         /// ```
-        /// 
-        /// Error Handling:
-        /// - No validation is performed on event IDs (any string is accepted)
-        /// - Observer references must remain valid until unregistration
-        /// - Consider using RAII patterns to ensure proper cleanup
         /// </summary>
-        /// <param name="id">String identifier for the event type to observe</param>
+        /// <param name="id">Hashed identifier for the event type to observe (see EVENT_ID)</param>
         /// <param name="observer">Reference to the observer object that will receive notifications</param>
-        void AddObserver(const Event::id_t& id, IObserver& observer);
+        void AddObserver(Event::id_t id, IObserver& observer);
 
         /// <summary>
-        /// Removes an observer from all event subscriptions.
-        /// 
-        /// This method searches through all event subscription lists and removes the
-        /// specified observer from each one. This is a complete unregistration that
-        /// ensures the observer will no longer receive any event notifications.
-        /// 
-        /// Removal Process:
-        /// - Iterates through all event type subscription lists
-        /// - Removes the observer from any lists where it's found
+        /// Registers an observer for one event type and returns the RAII
+        /// handle owning the subscription.
+        ///
+        /// The handle records the exact (event, slot) location the observer
+        /// landed in; releasing it - explicitly or by destruction - is a
+        /// single swap-remove in that one event's list. The registry keeps
+        /// a back-pointer to the handle and follows it through moves, so
+        /// the recorded slot stays exact as handles change address and as
+        /// neighbouring entries swap-remove around it.
+        ///
+        /// Most code wants ADD_OBSERVER, which stores the handle on the
+        /// observer for automatic release. Hold the handle yourself to
+        /// scope a subscription tighter than the observer's lifetime.
+        /// </summary>
+        /// <param name="id">Hashed identifier for the event type to observe (see EVENT_ID)</param>
+        /// <param name="observer">Reference to the observer object that will receive notifications</param>
+        /// <returns>Move-only handle releasing the subscription when destroyed</returns>
+        EventSubscription Subscribe(Event::id_t id, IObserver& observer);
+
+        /// <summary>
+        /// Removes an observer from every subscription stored on it.
+        ///
+        /// Each subscription handle the observer holds (stored by
+        /// ADD_OBSERVER / AddObserver) releases its exact (event, slot)
+        /// registry entry with one swap-remove - O(1) per subscription,
+        /// never a sweep over the whole registry. Subscriptions whose
+        /// handles live outside the observer are their holder's to release.
+        ///
         /// - Safe to call even if the observer wasn't registered
         /// - Safe to call multiple times with the same observer
-        /// 
-        /// Performance Considerations:
-        /// - O(n*m) complexity where n = number of event types, m = average observers per type
-        /// - Called automatically by IObserver destructor
-        /// - Consider manual removal for observers with long lifetimes that temporarily don't need events
-        /// 
+        /// - Happens automatically when the observer is destroyed
+        ///
         /// Usage examples:
         /// ```cpp
         /// // Manual removal (typically done via REMOVE_OBSERVER macro)
         /// EventManager::Instance().RemoveObserver(myObserver);
-        /// 
+        ///
         /// // Using convenience macro (preferred)
         /// REMOVE_OBSERVER;
-        /// 
-        /// // Automatic removal in IObserver destructor
-        /// ~MyObserver() {
-        ///     // REMOVE_OBSERVER is called automatically
-        /// }
         /// ```
-        /// 
+        ///
         /// Thread Safety:
         /// If events can be dispatched while observers are being removed,
         /// additional synchronization may be required to prevent iterator
@@ -297,6 +333,44 @@ namespace neu {
         /// <param name="event">The event to dispatch to registered observers</param>
         void Notify(const Event& event);
 
+        /// <summary>
+        /// Appends an event to the calling thread's staging buffer for
+        /// deferred dispatch.
+        ///
+        /// The event is copied inline into a per-thread fixed-capacity
+        /// buffer - no heap allocation, no lock, no contention between job
+        /// system workers raising gameplay events in parallel. The buffers
+        /// merge into the dispatch queue when DispatchQueued() runs. This
+        /// is the path the EVENT_NOTIFY macros use.
+        ///
+        /// Deferred delivery guarantees:
+        /// - Observers never run re-entrantly inside the code that fired the event
+        /// - Events fired during Actor::Update (including from job system
+        ///   workers) dispatch later the same frame
+        /// - Events from one thread dispatch in the order that thread fired
+        ///   them; ordering across threads follows the merge, which was
+        ///   never better defined under the old shared queue either
+        /// - Events enqueued during dispatch are delivered the following frame
+        /// - If the thread's buffer is full the event is dropped with a warning
+        /// </summary>
+        /// <param name="event">The event to queue for dispatch</param>
+        void Enqueue(const Event& event);
+
+        /// <summary>
+        /// Merges every thread's staging buffer into the dispatch queue and
+        /// dispatches the events in order.
+        ///
+        /// Called once per frame by Engine::Update after the scene update -
+        /// a frame sync point where the workers are parked - so gameplay
+        /// events land the same frame they were fired. The merge is the
+        /// only reader of the staging buffers and must not overlap
+        /// producers, which the pipeline position guarantees. Consecutive
+        /// events with the same id are grouped into one contiguous span and
+        /// delivered via IObserver::OnNotifyBatch - one virtual call per
+        /// observer per run instead of one per event.
+        /// </summary>
+        void DispatchQueued();
+
         /// <summary>
         /// Removes all observers from the event system.
         /// 
@@ -317,51 +391,108 @@ namespace neu {
         /// 
         /// After calling this method:
         /// - All event subscriptions are cleared
+        /// - Outstanding subscription handles are deactivated in place, so
+        ///   their later release doesn't touch slots reused by new
+        ///   registrations
         /// - New observer registrations work normally
         /// - Events sent will have no observers (silent operation)
         /// - Observer objects themselves are not affected (just unsubscribed)
         /// </summary>
-        void RemoveAll() { m_observers.clear(); }
+        void RemoveAll();
 
     private:
+        // subscription handles reach into the registry for their O(1)
+        // release and slot re-pointing
+        friend class EventSubscription;
+
+        /// <summary>
+        /// Releases the handle's recorded (event, slot) entry with one
+        /// swap-remove. The entry moved into the vacated slot learns its
+        /// new position through its own handle back-pointer.
+        /// </summary>
+        /// <param name="handle">The subscription being released</param>
+        void Unsubscribe(EventSubscription& handle);
+
+        /// <summary>
+        /// Re-points the registry entry's handle back-pointer after the
+        /// handle object itself moved.
+        /// </summary>
+        /// <param name="handle">The subscription at its new address</param>
+        void Repoint(EventSubscription& handle);
+        /// <summary>
+        /// One registry slot: the observer to notify plus a back-pointer to
+        /// the RAII handle owning the subscription. The back-pointer is how
+        /// a swap-removed neighbour's handle learns its new slot, and how
+        /// RemoveAll deactivates outstanding handles in place.
+        /// </summary>
+        struct Entry {
+            IObserver* observer;
+            EventSubscription* handle;
+        };
+
         /// <summary>
         /// Internal storage for observer subscriptions organized by event type.
-        /// 
-        /// This map provides efficient lookup of observers by event ID while allowing
-        /// multiple observers per event type. The data structure choice reflects the
-        /// expected usage patterns:
-        /// 
-        /// Key Design Decisions:
-        /// - std::map: Provides O(log n) lookup by event ID with sorted storage
-        /// - std::list: Allows efficient insertion/removal of observers without iterator invalidation
-        /// - IObserver*: Stores pointers for efficient copying and minimal memory overhead
-        /// 
-        /// Structure: Event ID -> List of Observer Pointers
-        /// - Each event type maps to a list of interested observers
+        ///
+        /// Structure: Hashed Event ID -> Vector of subscription entries
+        /// - Each event type maps to a contiguous array of interested observers
         /// - Multiple observers can subscribe to the same event type
-        /// - Observer order within lists is based on registration order
-        /// 
-        /// Memory Characteristics:
-        /// - Map grows with the number of unique event types used
-        /// - Lists grow with the number of observers per event type
-        /// - Minimal memory overhead (just pointers, no object copying)
-        /// - Automatic cleanup when observers are removed
-        /// 
+        ///
+        /// Key Design Decisions:
+        /// - std::unordered_map: O(1) lookup on the precomputed 64-bit id
+        /// - std::vector: Contiguous iteration during dispatch, the hot path
+        /// - Handles record their exact (event, slot) location, so
+        ///   unregistration is one swap-remove - O(1) - at the cost of
+        ///   observer order, which was never guaranteed
+        ///
         /// Performance Implications:
-        /// - Event dispatch: O(log n + m) where n = event types, m = observers for specific type
-        /// - Observer addition: O(log n + 1) for map lookup and list insertion
-        /// - Observer removal: O(n * m) for complete removal across all event types
-        /// 
+        /// - Event dispatch: O(1) probe + linear scan over a contiguous array
+        /// - Observer addition: O(1) amortized
+        /// - Observer removal: O(1) per subscription via its handle - a wave
+        ///   of destroyed observers costs their subscription count, not
+        ///   events x observers
+        ///
         /// Thread Safety:
         /// The current implementation is not inherently thread-safe. Concurrent
         /// access to this data structure may require additional synchronization
         /// mechanisms depending on usage patterns.
-        /// 
-        /// Alternative Designs:
-        /// - std::unordered_map: Faster lookup but higher memory overhead
-        /// - std::vector: Faster iteration but slower insertion/removal
-        /// - Custom event ID types: Integer IDs for faster comparison
         /// </summary>
-        std::map<Event::id_t, std::list<IObserver*>> m_observers;
+        std::unordered_map<Event::id_t, std::vector<Entry>> m_observers;
+
+        /// <summary>
+        /// Per-thread event staging, merged single-threaded at the frame
+        /// sync point.
+        ///
+        /// Each producing thread owns one ThreadQueue: only the owner
+        /// writes events and advances count, so Enqueue is a plain array
+        /// store plus a release on the counter - no lock, no CAS, no
+        /// contention between parallel actor updates. DispatchQueued() (the
+        /// sole reader, at a point where the workers are parked) acquires
+        /// each counter, moves the staged events into the dispatch buffer
+        /// and resets the counter. Events are stored inline; the variant
+        /// payload lives in the array with no per-event heap allocation.
+        ///
+        /// The registry mutex guards only the queue list itself - taken
+        /// once per thread on its first Enqueue and once per frame by the
+        /// merge, never on the per-event path. Queues are owned here so a
+        /// buffer outlives its thread; events a finished thread staged
+        /// still merge.
+        /// </summary>
+        static constexpr size_t kQueueCapacity = 4096;        // merged dispatch buffer
+        static constexpr size_t kThreadQueueCapacity = 1024;  // staged per thread per frame
+
+        struct alignas(64) ThreadQueue {
+            std::array<Event, kThreadQueueCapacity> events;
+            std::atomic<size_t> count{ 0 };
+        };
+
+        // resolves the calling thread's queue, registering one on first use
+        ThreadQueue& GetThreadQueue();
+
+        inline static thread_local ThreadQueue* t_queue{ nullptr };
+
+        std::mutex m_registryMutex;
+        std::vector<std::unique_ptr<ThreadQueue>> m_threadQueues;
+
+        std::array<Event, kQueueCapacity> m_dispatchBuffer;
     };
 }
\ No newline at end of file
@@ -1,7 +1,9 @@
 #include "Observer.h"
 
 namespace neu {
-	IObserver::~IObserver() {
-		REMOVE_OBSERVER;
-	}
-}
\ No newline at end of file
+	// the subscriptions stored on the observer release themselves as
+	// m_subscriptions is destroyed - each one an O(1) swap-remove in its
+	// event's list, so destroying a wave of subscribed actors no longer
+	// sweeps the whole registry
+	IObserver::~IObserver() = default;
+}
@@ -1,6 +1,53 @@
 #pragma once
+#include "Event.h"
+#include <vector>
 
 namespace neu {
+    /// <summary>
+    /// RAII handle to one (event id, observer) subscription.
+    ///
+    /// EventManager::Subscribe records the exact slot the observer landed
+    /// in, so releasing the handle is a single swap-remove in that one
+    /// event's list - O(1) - instead of the registry-wide sweep observer
+    /// removal used to pay. The registry entry keeps a back-pointer to the
+    /// handle and re-points it whenever either side moves, so the recorded
+    /// slot stays exact across vector growth and swap-removes.
+    ///
+    /// ADD_OBSERVER stores its handle on the observer itself (see
+    /// IObserver::StoreSubscription), which is all most code needs. Hold a
+    /// handle directly to scope a subscription tighter than the observer's
+    /// lifetime - e.g. drop it while paused, resubscribe on resume.
+    /// </summary>
+    class EventSubscription {
+    public:
+        EventSubscription() = default;
+        ~EventSubscription() { Release(); }
+
+        // the registry entry points back at this handle, so handles move
+        // (re-pointing the entry) but never copy
+        EventSubscription(const EventSubscription&) = delete;
+        EventSubscription& operator=(const EventSubscription&) = delete;
+        EventSubscription(EventSubscription&& other) noexcept;
+        EventSubscription& operator=(EventSubscription&& other) noexcept;
+
+        /// <summary>
+        /// Unsubscribes now - one swap-remove in the event's observer list.
+        /// Safe to call on an empty or already released handle.
+        /// </summary>
+        void Release();
+
+        /// <summary>
+        /// True while the handle still holds a live subscription.
+        /// </summary>
+        bool IsActive() const { return m_id != 0; }
+
+    private:
+        friend class EventManager;
+
+        Event::id_t m_id{ 0 };   // 0 marks an inactive handle
+        size_t m_slot{ 0 };      // index into the event's observer list
+    };
+
     /// <summary>
     /// Abstract interface implementing the Observer pattern for event-driven notifications.
     /// 
@@ -45,7 +92,7 @@ namespace neu {
     /// class HealthBar : public IObserver {
     /// public:
     ///     void OnNotify(const Event& event) override {
-    ///         if (event.id == "player_health_changed") {
+    ///         if (event.id == EVENT_ID(player_health_changed)) {
     ///             if (std::holds_alternative&lt;int&gt;(event.data)) {
     ///                 int newHealth = std::get&lt;int&gt;(event.data);
     ///                 UpdateHealthDisplay(newHealth);
@@ -72,18 +119,10 @@ namespace neu {
         /// particularly important in observer systems where observers may be managed
         /// through IObserver pointers for polymorphic behavior.
         /// 
-        /// The destructor also provides an opportunity for observers to automatically
-        /// unregister themselves from event managers during cleanup, preventing
-        /// dangling pointer issues and ensuring clean shutdown.
-        /// 
-        /// Best Practice:
-        /// Derived classes should use their destructors to unregister from any
-        /// event managers they're subscribed to, ensuring proper cleanup:
-        /// ```cpp
-        /// ~MyObserver() {
-        ///     EventManager::Instance().Unregister(this);
-        /// }
-        /// ```
+        /// Cleanup is automatic: the subscriptions stored on the observer
+        /// (see StoreSubscription) are destroyed with it, and each handle
+        /// releases its exact registry slot in O(1) - no registry sweep, no
+        /// dangling observer pointers left behind.
         /// </summary>
         virtual ~IObserver();
 
@@ -118,7 +157,7 @@ namespace neu {
         /// ```cpp
         /// // Simple event filtering
         /// void AudioManager::OnNotify(const Event& event) override {
-        ///     if (event.id == "play_sound") {
+        ///     if (event.id == EVENT_ID(play_sound)) {
         ///         if (std::holds_alternative&lt;std::string&gt;(event.data)) {
         ///             std::string soundName = std::get&lt;std::string&gt;(event.data);
         ///             PlaySound(soundName);
@@ -128,11 +167,11 @@ namespace neu {
         /// 
         /// // Multiple event type handling
         /// void GameUI::OnNotify(const Event& event) override {
-        ///     if (event.id == "player_health_changed") {
+        ///     if (event.id == EVENT_ID(player_health_changed)) {
         ///         UpdateHealthBar(std::get&lt;int&gt;(event.data));
-        ///     } else if (event.id == "player_score_changed") {
+        ///     } else if (event.id == EVENT_ID(player_score_changed)) {
         ///         UpdateScoreDisplay(std::get&lt;int&gt;(event.data));
-        ///     } else if (event.id == "game_paused") {
+        ///     } else if (event.id == EVENT_ID(game_paused)) {
         ///         ShowPauseMenu(std::get&lt;bool&gt;(event.data));
         ///     }
         /// }
@@ -168,5 +207,51 @@ namespace neu {
         /// information rather than storing the event reference.
         /// </param>
         virtual void OnNotify(const Event& event) = 0;
+
+        /// <summary>
+        /// Called with a contiguous run of queued events sharing one id.
+        ///
+        /// DispatchQueued groups the frame's events by consecutive id and
+        /// delivers each run in a single call, so a burst of 500 hit events
+        /// reaches an observer as one span instead of 500 virtual calls.
+        ///
+        /// The default implementation forwards each event to OnNotify, so
+        /// existing observers work unchanged. High-volume consumers (damage
+        /// numbers, particle triggers) override this and process the span in
+        /// one pass. The span is only valid for the duration of the call -
+        /// copy anything needed later.
+        /// </summary>
+        /// <param name="events">Pointer to the first event of the run</param>
+        /// <param name="count">Number of events in the run, all with the same id</param>
+        virtual void OnNotifyBatch(const Event* events, size_t count) {
+            for (size_t i = 0; i < count; i++) OnNotify(events[i]);
+        }
+
+        /// <summary>
+        /// Takes ownership of a subscription handle so it releases with the
+        /// observer. ADD_OBSERVER parks its handle here; destroying the
+        /// observer then releases each subscription with one O(1)
+        /// swap-remove instead of sweeping the whole registry.
+        /// </summary>
+        /// <param name="subscription">The handle to tie to this observer's lifetime</param>
+        void StoreSubscription(EventSubscription&& subscription) {
+            m_subscriptions.push_back(std::move(subscription));
+        }
+
+        /// <summary>
+        /// Releases every subscription stored on this observer - the
+        /// REMOVE_OBSERVER path. Handles held elsewhere are unaffected and
+        /// remain their holder's to release.
+        /// </summary>
+        void RemoveAllSubscriptions() { m_subscriptions.clear(); }
+
+    private:
+        /// <summary>
+        /// Subscriptions tied to this observer's lifetime, stored by
+        /// ADD_OBSERVER / EventManager::AddObserver. Destroying the
+        /// observer destroys the handles, each releasing its exact
+        /// (event, slot) registry entry in O(1).
+        /// </summary>
+        std::vector<EventSubscription> m_subscriptions;
     };
 }
\ No newline at end of file
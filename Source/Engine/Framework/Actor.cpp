@@ -1,6 +1,7 @@
 #include "Actor.h"
 #include "Renderer/Renderer.h"
 #include "Components/RendererComponent.h"
+#include "Components/ModelRenderer.h"
 
 namespace neu {
 	// Register Actor class with the Factory system
@@ -20,15 +21,20 @@ namespace neu {
 	Object{ other },              // Copy base Object properties (name, active)
 	tag{ other.tag },             // Copy tag for grouping
 	lifespan{ other.lifespan },   // Copy lifespan setting
-	transform{ other.transform }  // Copy spatial information
+	isStatic{ other.isStatic },   // Copy update partition flag
+	canSleep{ other.canSleep },   // Copy sleep opt-out
+	fullRateUpdate{ other.fullRateUpdate }, // Copy update-rate LOD opt-out
+	transform{ other.transform }, // Copy spatial information
+	parentName{ other.parentName }, // Copy parent binding (handle re-resolves at Start)
+	spawnPrototype{ other.spawnPrototype } // Copy recycle pool routing
 	{
 		// Deep copy all components from the source actor
 		// Each component must be cloned individually to avoid shared ownership
 		for (auto& component : other.m_components) {
-			// Clone the component using its virtual Clone() method
-			// dynamic_cast ensures we get a Component pointer
-			// release() transfers ownership from the returned unique_ptr
-			auto clone = std::unique_ptr<Component>(dynamic_cast<Component*>(component->Clone().release()));
+			// Clone the component using its virtual Clone() method - a
+			// Component's Clone() always produces a Component (typeId and
+			// all), so the downcast is static and skips per-spawn RTTI
+			auto clone = std::unique_ptr<Component>(static_cast<Component*>(component->Clone().release()));
 
 			// Add the cloned component to this actor
 			// This sets up the owner relationship and adds to m_components
@@ -36,24 +42,112 @@ namespace neu {
 		}
 	}
 
+	/// <summary>
+	/// Move constructor - relocates an actor into new storage.
+	///
+	/// Used by ActorPool when Scene::AddActor moves a factory-created actor
+	/// into its pooled slot. Components are moved (not cloned), so their
+	/// owner back-references still point at the moved-from actor and must be
+	/// re-pointed at the new address.
+	/// </summary>
+	Actor::Actor(Actor&& other) :
+	Object{ other },                           // Copy base Object properties (name, active)
+	tag{ std::move(other.tag) },
+	destroyed{ other.destroyed },
+	recycled{ other.recycled },
+	persistent{ other.persistent },
+	lifespan{ other.lifespan },
+	isStatic{ other.isStatic },
+	canSleep{ other.canSleep },
+	fullRateUpdate{ other.fullRateUpdate },
+	scene{ other.scene },
+	transform{ other.transform },
+	parent{ other.parent },
+	parentName{ std::move(other.parentName) },
+	spawnPrototype{ std::move(other.spawnPrototype) },
+	m_components{ std::move(other.m_components) },
+	m_renderers{ std::move(other.m_renderers) }
+	{
+		// The moved components still point at the old actor - re-own them.
+		// The renderer cache moves with them - its pointers target the
+		// heap-allocated components, which didn't move
+		for (auto& component : m_components) {
+			component->owner = this;
+		}
+	}
+
 	/// <summary>
 	/// Initializes the actor and all its components.
-	/// 
+	///
 	/// Called by Scene after the actor is fully constructed and added to the scene.
 	/// This ensures all actors exist before any initialization code runs, allowing
 	/// components to safely query the scene for other actors during startup.
 	/// </summary>
 	bool Actor::Start() {
+		// Resolve the transform parent by name now that every scene actor
+		// exists - the handle stays valid until the parent is destroyed
+		if (!parentName.empty() && scene) {
+			parent = scene->GetActorHandleByName(parentName);
+			if (!parent.IsValid()) LOG_WARNING("Actor '{}' parent '{}' not found", name, parentName);
+		}
+
+		// Schedule the serialized lifespan on the scene's timer wheel - the
+		// wheel marks the actor destroyed at expiry, so no per-frame
+		// countdown runs in Update
+		if (lifespan > 0) SetLifespan(lifespan);
+
 		// Initialize all components attached to this actor
-		// Components may set up references, load resources, or initialize state
+		// Components may set up references, load resources, or initialize
+		// state. A component that opted out of update-rate LOD pins the
+		// whole actor to full rate
 		for (auto& component : m_components) {
 			component->Start();
+			if (component->fullRateUpdate) fullRateUpdate = true;
 		}
 
 		// Return success - could be extended to handle initialization failures
 		return true;
 	}
 
+	/// <summary>
+	/// Classifies the actor for the scene's batch startup: parent-name
+	/// resolution wants scene order, a lifespan schedules on the shared
+	/// timer wheel, and a serialStart component declares side effects -
+	/// any of those keeps the actor in the serial phase. Everything else
+	/// (resource Gets, local state) is safe from a job thread.
+	/// </summary>
+	bool Actor::CanStartParallel() const {
+		if (!parentName.empty()) return false;
+		if (lifespan > 0) return false;
+
+		for (auto& component : m_components) {
+			if (component->serialStart) return false;
+		}
+		return true;
+	}
+
+	/// <summary>
+	/// Re-arms the actor after Scene::Instantiate pulls it from the
+	/// recycle pool - the cheap counterpart of Start() for an actor whose
+	/// components already ran their first Start. See the header for the
+	/// contract with Component::Reset.
+	/// </summary>
+	void Actor::Reset() {
+		destroyed = false;
+		recycled = false;
+		sleeping = false;
+		idleFrames = 0;
+		bankedUpdateDt = 0;
+
+		// same lifespan scheduling Start performs - a re-armed projectile
+		// gets a fresh expiration
+		if (lifespan > 0) SetLifespan(lifespan);
+
+		for (auto& component : m_components) {
+			component->Reset();
+		}
+	}
+
 	/// <summary>
 	/// Cleanup method called before actor destruction.
 	/// 
@@ -62,11 +156,20 @@ namespace neu {
 	/// final cleanup operations before memory is freed.
 	/// </summary>
 	void Actor::Destroyed() {
+		// Drop any pending lifespan expiration - firing against this slot
+		// after reuse would resolve to a stale handle anyway, cancelling
+		// just keeps the wheel tidy
+		if (scene) scene->GetTimers().Cancel(lifespanTimer);
+
 		// Notify each component of impending destruction
 		// Components should release any resources they're holding
 		for (auto& component : m_components) {
 			component->Destroyed();
 		}
+
+		// Pull the components out of the scene's typed registries so
+		// scene-wide queries never see components of a removed actor
+		UnregisterComponents();
 	}
 
 	/// <summary>
@@ -82,35 +185,27 @@ namespace neu {
 		// Prevents updates on actors pending removal
 		if (destroyed) return;
 
-		// Automatic lifespan management
-		// When lifespan reaches zero, actor marks itself for destruction
-		if (lifespan > 0) {
-			// Decrement remaining lifetime
-			lifespan -= dt;
-
-			// Check if lifespan has expired
-			if (lifespan <= 0) {
-				// Mark for destruction - Scene will remove on next update
-				destroyed = true;
-				return; // Skip component updates for destroyed actor
-			}
-		}
+		// (lifespan expiry is handled by the scene's timer wheel, which
+		// marks the actor destroyed when its registration comes due)
 
 		// Update all active components
 		// Each component implements its own Update logic
 		for (auto& component : m_components) {
 			// Only update components that are currently active
-			// Inactive components remain attached but don't process
-			if (component->active) component->Update(dt);
+			// Inactive components remain attached but don't process.
+			// Batch-registered types are skipped here - Scene updates every
+			// instance of those types in one call after the actor loop
+			if (component->active && !BatchUpdate::IsBatched(component->typeId)) component->Update(dt);
 		}
 	}
 
 	/// <summary>
 	/// Renders the actor by drawing all active renderer components.
-	/// 
-	/// Iterates through components looking for RendererComponent types and
-	/// delegates drawing to them. Only active components are rendered, and
-	/// destroyed actors skip rendering entirely.
+	///
+	/// Iterates the renderer cache built as components attached - the type
+	/// test happened once in AddComponent, not per component per frame.
+	/// Only active renderers draw, and destroyed actors skip rendering
+	/// entirely.
 	/// </summary>
 	void Actor::Draw(Renderer& renderer)
 	{
@@ -118,22 +213,52 @@ namespace neu {
 		// No need to render actors pending removal
 		if (destroyed) return;
 
-		// Iterate through all components looking for renderable ones
-		for (auto& component : m_components) {
-			// Only process active components
-			if (component->active) {
-				// Attempt to cast to RendererComponent
-				// Not all components are renderable (e.g., physics, audio, logic)
-				auto rendererComponent = dynamic_cast<RendererComponent*>(component.get());
-
-				// If this component is a renderer, draw it
-				if (rendererComponent) {
-					rendererComponent->Draw(renderer);
-				}
+		// exactly the drawable components, cached at attach
+		for (auto rendererComponent : m_renderers) {
+			if (rendererComponent->active) {
+				rendererComponent->Draw(renderer);
 			}
 		}
 	}
 
+	void Actor::SetLifespan(float seconds) {
+		lifespan = seconds;
+		if (!scene) return;	// pre-scene assignment - scheduled at Start
+
+		// replace any pending expiration; the callback resolves through the
+		// generational handle, so a slot reused before expiry is a no-op
+		scene->GetTimers().Cancel(lifespanTimer);
+		if (seconds <= 0) return;
+
+		Scene* owningScene = scene;
+		ActorHandle self = handle;
+		lifespanTimer = owningScene->GetTimers().Schedule(seconds, [owningScene, self]() {
+			if (Actor* actor = owningScene->GetActor(self)) actor->destroyed = true;
+		});
+	}
+
+	/// <summary>
+	/// World-space bounds enclosing every renderer component's bounds.
+	///
+	/// Used by the scene BVH to keep a leaf per actor - actors with nothing
+	/// renderable get a point bound at their position so proximity queries
+	/// still find them.
+	/// </summary>
+	Bounds Actor::GetBounds()
+	{
+		Bounds bounds;
+
+		// union the world-space bounds of every model renderer
+		for (auto component : GetComponents<ModelRenderer>()) {
+			bounds.Encapsulate(component->GetWorldBounds());
+		}
+
+		// no renderable bounds - collapse to the actor's position
+		if (!bounds.valid) bounds.Encapsulate(transform.position);
+
+		return bounds;
+	}
+
 	void Actor::UpdateGUI()
 	{
 		ImGui::Text("Name: %s", name.c_str());
@@ -165,11 +290,48 @@ namespace neu {
 		// Components use this to access actor properties (transform, scene, etc.)
 		component->owner = this;
 
+		// Components added after the actor joined a scene enter the typed
+		// registries immediately (load-time components are registered in
+		// bulk by Scene::AddActor)
+		if (scene) scene->RegisterComponent(component.get());
+
+		// Cache renderer components as they attach - the one-time cast here
+		// lets Draw() iterate exactly the drawables with no type tests
+		if (auto rendererComponent = dynamic_cast<RendererComponent*>(component.get())) {
+			m_renderers.push_back(rendererComponent);
+		}
+
 		// Transfer ownership to the actor's component container
 		// std::move is required to transfer unique_ptr ownership
 		m_components.push_back(std::move(component));
 	}
 
+	/// <summary>
+	/// Enters all components into the scene's typed registries.
+	/// Called by Scene::AddActor once the scene back-reference is set.
+	/// </summary>
+	void Actor::RegisterComponents()
+	{
+		if (!scene) return;
+
+		for (auto& component : m_components) {
+			scene->RegisterComponent(component.get());
+		}
+	}
+
+	/// <summary>
+	/// Removes all components from the scene's typed registries.
+	/// Called from Destroyed() on every actor removal path.
+	/// </summary>
+	void Actor::UnregisterComponents()
+	{
+		if (!scene) return;
+
+		for (auto& component : m_components) {
+			scene->UnregisterComponent(component.get());
+		}
+	}
+
 	/// <summary>
 	/// Deserializes actor data from configuration files.
 	/// 
@@ -187,6 +349,14 @@ namespace neu {
 		SERIAL_READ(value, tag);        // Grouping identifier
 		SERIAL_READ(value, lifespan);   // Automatic lifetime (0 = infinite)
 		SERIAL_READ(value, persistent); // Scene transition persistence flag
+		SERIAL_READ(value, parentName); // Transform parent (resolved at Start)
+
+		// Update partition flags - "static" keeps the actor out of the
+		// update loop entirely, canSleep opts out of idle sleeping,
+		// fullRateUpdate opts out of update-rate LOD
+		SERIAL_READ_NAME(value, "static", isStatic);
+		SERIAL_READ(value, canSleep);
+		SERIAL_READ(value, fullRateUpdate);
 
 		// Load transform data if present
 		// Transform is optional in serialized data
@@ -1,13 +1,33 @@
 #pragma once
 #include "Object.h"
 #include "Component.h"
+#include "TimerWheel.h"
+#include "Core/FrameArena.h"
+#include "Core/SmallVector.h"
 #include "Renderer/Texture.h"
+#include "Math/Bounds.h"
 #include "Math/Transform.h"
 #include <string>
 #include <memory>
 #include <vector>
 
 namespace neu {
+	/// <summary>
+	/// Generational handle to a pooled actor (slot index + generation).
+	///
+	/// The scene's ActorPool bumps a slot's generation every time the slot is
+	/// freed, so a handle held across frames goes stale instead of dangling
+	/// when the slot is reused by a new spawn. Resolve through
+	/// Scene::GetActor(), which returns nullptr for stale handles.
+	/// </summary>
+	struct ActorHandle {
+		uint32_t index{ 0 };
+		uint32_t generation{ 0 };
+
+		bool IsValid() const { return generation != 0; }
+		bool operator==(const ActorHandle&) const = default;
+	};
+
 	/// <summary>
 	/// Base class for all game objects in the scene.
 	/// 
@@ -27,29 +47,105 @@ namespace neu {
 	/// </summary>
 	class Actor : public Object {
 	public:
-		// String identifier for grouping related actors
+		// Interned identifier for grouping related actors - tag queries
+		// compare table pointers instead of strings
 		// Used by Scene::GetActorsByTag() for flexible queries
-		std::string tag;
+		InternedString tag;
 
 		// Destruction flag checked by Scene during update loop
 		// When true, actor will be removed and Destroyed() will be called
 		bool destroyed{ false };
 
+		// Set alongside destroyed by Scene::Recycle - the cleanup phase
+		// parks the actor in the per-prototype recycle pool instead of
+		// releasing it, and the next Instantiate of the same prototype
+		// re-arms it through Reset() with no component clone
+		bool recycled{ false };
+
 		// Persistence flag for scene transitions
 		// If true, actor survives Scene::RemoveAllActors(false)
 		// Useful for player objects, UI, or cross-level entities
 		bool persistent{ false };
 
 		// Automatic lifetime management in seconds
-		// When > 0, decrements each frame and sets destroyed=true at zero
+		// When > 0 at Start, the scene's timer wheel marks the actor
+		// destroyed after that long - no per-frame countdown. Change it at
+		// runtime through SetLifespan(), which reschedules the timer
 		// Useful for temporary effects, projectiles, particles
 		float lifespan{ 0 };
 
+		// Pending lifespan expiration on the scene's timer wheel - stale
+		// when no lifespan is scheduled. Managed by Start/SetLifespan
+		TimerWheel::TimerHandle lifespanTimer;
+
+		// Static actors ("static" in scene JSON) never enter the scene's
+		// update partition - props and decor skip the per-frame walk
+		// entirely. Mutating a static actor's transform promotes it back to
+		// dynamic (the transform cache sync detects the change)
+		bool isStatic{ false };
+
+		// Opt-out for the scene's sleep mechanism ("actor_sleeping"
+		// setting): actors whose Update reacts to external state that never
+		// touches the transform (input, events) should clear this, or an
+		// idle stretch parks them with nothing to wake them
+		bool canSleep{ true };
+
+		// Sleeping actors skip Update until their transform changes from
+		// outside. Managed by Scene - set after the transform has idled for
+		// a while, cleared by any transform change
+		bool sleeping{ false };
+
+		// Frames the transform has been idle, drives the sleep decision.
+		// Managed by Scene
+		int idleFrames{ 0 };
+
+		// Whether the actor currently has an entry in the scene's dynamic
+		// update partition. Managed by Scene - guards against duplicate
+		// entries when an actor is woken or promoted
+		bool inUpdateList{ false };
+
+		// Update-rate LOD opt-out ("update_rate_lod" scenes): actors that
+		// must tick every frame regardless of camera distance keep this set.
+		// Actor::Start also raises it when any attached component opts out
+		bool fullRateUpdate{ false };
+
+		// Time banked while the update-rate LOD skipped this actor - the
+		// next Update receives the accumulated dt, so a quarter-rate actor
+		// integrates the same simulated time as a full-rate one.
+		// Managed by Scene
+		float bankedUpdateDt{ 0 };
+
+		// Scene frame this actor last landed in a camera's visible set -
+		// off-screen actors drop one extra update-rate band. Stamped by the
+		// draw recording, read by the next frame's update partition sweep
+		uint64_t lastVisibleFrame{ 0 };
+
 		// Back-reference to containing scene (non-owning pointer)
 		// Allows actors to query other actors and access scene-level systems
 		// Set by Scene::AddActor(), nullptr before actor is added to scene
 		class Scene* scene{ nullptr };
 
+		// Generational pool handle stamped by the scene's ActorPool
+		// Store this (not a raw Actor*) to reference an actor across frames -
+		// Scene::GetActor() returns nullptr once the slot has been reused
+		ActorHandle handle;
+
+		// Transform parent - when valid, this actor's world matrix composes
+		// through the parent's (resolved each frame by the scene's
+		// TransformCache), so attachments ride their parent for free.
+		// A stale handle (destroyed parent) detaches the actor to a root
+		ActorHandle parent;
+
+		// Parent actor name from serialized data, resolved to the handle
+		// once at Start when every scene actor exists
+		std::string parentName;
+
+		// Prototype name this actor was instantiated from - routes
+		// Scene::Recycle to the matching recycle pool. Stamped by
+		// Scene::Instantiate; empty for scene-authored actors, which
+		// always destroy outright
+		std::string spawnPrototype;
+
 		// Spatial information: position, rotation, scale
 		// Used by components for rendering, physics, collision detection
 		Transform transform;
@@ -69,6 +165,10 @@ namespace neu {
 		// Components are cloned to ensure independent copies
 		Actor(const Actor& other);
 
+		// Move constructor - used by ActorPool to relocate an actor into its
+		// pooled slot; re-owners the moved components to the new address
+		Actor(Actor&& other);
+
 		// Prototype pattern implementation macro
 		// Expands to: virtual std::unique_ptr<Object> Clone() { return std::make_unique<Actor>(*this); }
 		// Enables polymorphic cloning of actors for prototype-based instantiation
@@ -80,6 +180,22 @@ namespace neu {
 		// Called by Scene after all actors are loaded
 		virtual bool Start() override;
 
+		// True when Start() touches no shared state and may run on a job
+		// thread during batch startup - false for actors with a named
+		// parent, a lifespan (shared timer wheel), or any component that
+		// declares serialStart
+		bool CanStartParallel() const;
+
+		/// <summary>
+		/// Re-arms the actor after it leaves the scene's recycle pool:
+		/// clears the destruction flags, rewinds the banked update time,
+		/// reschedules the serialized lifespan and calls Reset() on every
+		/// component. Start() is not re-run - the components keep the
+		/// references their first Start established, and the scene restores
+		/// the registry entries itself.
+		/// </summary>
+		void Reset();
+
 		// Override from Object base class
 		// Cleanup method called before actor destruction
 		// Notifies all components to release resources
@@ -91,16 +207,41 @@ namespace neu {
 		void Read(const serial_data_t& value) override;
 
 		// Updates actor logic and all active components
-		// Handles lifespan countdown and delegates to components
 		// Virtual to allow derived actors to override behavior
 		virtual void Update(float dt);
 
+		/// <summary>
+		/// Sets (or clears, with seconds <= 0) the actor's lifespan at
+		/// runtime. Cancels any pending expiration and schedules a new one
+		/// on the scene's timer wheel - the serialized lifespan is scheduled
+		/// automatically at Start.
+		/// </summary>
+		/// <param name="seconds">Seconds until the actor is destroyed</param>
+		void SetLifespan(float seconds);
+
 		// Renders actor by drawing all active RendererComponents
-		// Delegates to components for actual drawing operations
+		// Iterates the renderer cache built at attach - no type tests
 		// Virtual to allow derived actors to override behavior
 		virtual void Draw(class Renderer& renderer);
 
+		/// <summary>
+		/// True when the actor has at least one renderer component. Lets
+		/// submission code skip actors with nothing renderable without
+		/// virtual-calling into Draw().
+		/// </summary>
+		bool HasRenderers() const { return !m_renderers.empty(); }
+
 		void UpdateGUI() override;
+
+		/// <summary>
+		/// World-space bounds enclosing every renderer component's bounds.
+		///
+		/// Actors with nothing renderable collapse to a point at their
+		/// position, so spatial queries (the scene BVH) still find them.
+		/// </summary>
+		/// <returns>World-space AABB of the actor</returns>
+		Bounds GetBounds();
+
 		/// <summary>
 		/// Adds a component to the actor.
 		/// 
@@ -111,6 +252,16 @@ namespace neu {
 		/// <param name="component">Unique pointer to component (ownership transferred)</param>
 		void AddComponent(std::unique_ptr<Component> component);
 
+		/// <summary>
+		/// Enters/removes all components in the scene's typed registries.
+		///
+		/// RegisterComponents() is called by Scene::AddActor once the scene
+		/// back-reference is set; UnregisterComponents() runs from Destroyed()
+		/// so registries never hold pointers to removed actors' components.
+		/// </summary>
+		void RegisterComponents();
+		void UnregisterComponents();
+
 		/// <summary>
 		/// Checks if the actor has a component of the specified type.
 		/// 
@@ -150,13 +301,25 @@ namespace neu {
 		/// <returns>Vector of pointers to all matching components</returns>
 		template<typename T>
 			requires std::derived_from<T, Component>
-		std::vector<T*> GetComponents();
+		frame_vector<T*> GetComponents();
 
 	protected:
+		// the checkpoint capture walks the component list directly to
+		// flatten each component into its blob
+		friend class SceneCheckpoint;
+
 		// Container for all components attached to this actor
 		// Uses unique_ptr for automatic memory management
 		// Protected to allow derived classes to access components directly
-		std::vector<std::unique_ptr<Component>> m_components;
+		// Inline storage covers the typical 2-6 components, so spawning an
+		// actor doesn't allocate for the component list
+		small_vector<std::unique_ptr<Component>, 6> m_components;
+
+		// Renderer components cached as they attach, so the draw path
+		// iterates exactly the drawables instead of casting every component
+		// per frame. Components are only removed wholesale with the actor,
+		// so the cache lives and dies with m_components.
+		small_vector<class RendererComponent*, 4> m_renderers;
 	};
 
 	/// <summary>
@@ -187,10 +350,17 @@ namespace neu {
 		requires std::derived_from<T, Component>
 	inline T* Actor::GetComponent()
 	{
+		component_type_t typeId = ComponentType::Id<T>();
+
 		// Iterate through all components
 		for (auto& component : m_components) {
-			// Attempt to cast to requested type
-			// dynamic_cast returns nullptr if component is not of type T
+			// Exact type match through the registered type id - the common
+			// case, resolved with no RTTI
+			if (component->typeId != invalidComponentType && component->typeId == typeId) {
+				return static_cast<T*>(component.get());
+			}
+
+			// Base-class queries (e.g. RendererComponent) still need the cast
 			auto result = dynamic_cast<T*>(component.get());
 
 			// If cast succeeded, return immediately (first match)
@@ -210,14 +380,23 @@ namespace neu {
 	/// </summary>
 	template<typename T>
 		requires std::derived_from<T, Component>
-	inline std::vector<T*> Actor::GetComponents()
+	inline frame_vector<T*> Actor::GetComponents()
 	{
-		// Container to hold all matching components
-		std::vector<T*> results;
+		// Container to hold all matching components, allocated from the
+		// frame arena so per-frame queries never touch the heap
+		frame_vector<T*> results;
+
+		component_type_t typeId = ComponentType::Id<T>();
 
 		// Iterate through all components
 		for (auto& component : m_components) {
-			// Attempt to cast to requested type
+			// Exact type match through the registered type id, no RTTI
+			if (component->typeId != invalidComponentType && component->typeId == typeId) {
+				results.push_back(static_cast<T*>(component.get()));
+				continue;
+			}
+
+			// Attempt to cast to requested type (base-class queries)
 			auto result = dynamic_cast<T*>(component.get());
 
 			// If cast succeeded, add to results and continue searching
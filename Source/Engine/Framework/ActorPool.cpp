@@ -0,0 +1,99 @@
+#include "ActorPool.h"
+#include "Core/MemoryTracker.h"
+
+namespace neu {
+
+	uint32_t ActorPool::AcquireSlot()
+	{
+		uint32_t index;
+		if (!m_freeList.empty()) {
+			index = m_freeList.back();
+			m_freeList.pop_back();
+		}
+		else {
+			if (m_capacity % kBlockSize == 0) {
+				m_blocks.push_back(std::make_unique<Slot[]>(kBlockSize));
+				MemoryTracker::Track(MemTag::Scene, m_blocks.back().get(), kBlockSize * sizeof(Slot));
+			}
+			index = m_capacity++;
+		}
+
+		return index;
+	}
+
+	Actor* ActorPool::Create(Actor&& actor)
+	{
+		uint32_t index = AcquireSlot();
+
+		Slot* slot = GetSlot(index);
+		Actor* pooled = new (slot->storage) Actor(std::move(actor));
+		slot->alive = true;
+
+		pooled->handle = ActorHandle{ index, slot->generation };
+		m_count++;
+
+		return pooled;
+	}
+
+	Actor* ActorPool::Create(const Actor& actor)
+	{
+		uint32_t index = AcquireSlot();
+
+		Slot* slot = GetSlot(index);
+		// deep copy (clones every component) straight into pooled storage
+		Actor* pooled = new (slot->storage) Actor(actor);
+		slot->alive = true;
+
+		pooled->handle = ActorHandle{ index, slot->generation };
+		m_count++;
+
+		return pooled;
+	}
+
+	void ActorPool::Destroy(Actor* actor)
+	{
+		if (!actor) return;
+
+		uint32_t index = actor->handle.index;
+		Slot* slot = GetSlot(index);
+		ASSERT_SLOW_MSG(slot->alive && slot->generation == actor->handle.generation,
+			"ActorPool::Destroy on a dead or stale actor");
+
+		actor->~Actor();
+		slot->alive = false;
+		// outstanding handles to this slot no longer resolve
+		slot->generation++;
+
+		m_freeList.push_back(index);
+		m_count--;
+	}
+
+	Actor* ActorPool::Get(ActorHandle handle)
+	{
+		if (handle.index >= m_capacity) return nullptr;
+
+		Slot* slot = GetSlot(handle.index);
+		if (!slot->alive || slot->generation != handle.generation) return nullptr;
+
+		return (Actor*)slot->storage;
+	}
+
+	void ActorPool::Clear()
+	{
+		for (uint32_t index = 0; index < m_capacity; index++) {
+			Slot* slot = GetSlot(index);
+			if (slot->alive) {
+				((Actor*)slot->storage)->~Actor();
+				slot->alive = false;
+			}
+		}
+
+		for (auto& block : m_blocks) {
+			MemoryTracker::Untrack(MemTag::Scene, block.get(), kBlockSize * sizeof(Slot));
+		}
+		m_blocks.clear();
+		m_freeList.clear();
+		m_capacity = 0;
+		m_count = 0;
+	}
+}
@@ -0,0 +1,135 @@
+#pragma once
+#include "Actor.h"
+#include <memory>
+#include <vector>
+
+namespace neu {
+	/// <summary>
+	/// Fixed-block pool that owns every actor in a scene.
+	///
+	/// Actors live in 256-slot blocks allocated as needed, so spawning reuses
+	/// a free-list slot instead of hitting the heap and the update loop walks
+	/// live actors in index order through contiguous memory. Blocks are never
+	/// reallocated, so actor addresses are stable for the actor's lifetime.
+	///
+	/// Destroying an actor pushes its slot on the free list and bumps the
+	/// slot generation, which invalidates every ActorHandle still pointing at
+	/// it - handles (resolved through Get) are the safe way to reference an
+	/// actor across frames, raw pointers are only safe within one.
+	/// </summary>
+	class ActorPool {
+	public:
+		static constexpr size_t kBlockSize = 256;
+
+		ActorPool() = default;
+		~ActorPool() { Clear(); }
+
+		// slots hold raw actor storage, the pool can't be copied
+		ActorPool(const ActorPool&) = delete;
+		ActorPool& operator=(const ActorPool&) = delete;
+
+		/// <summary>
+		/// Moves the actor into a pooled slot (free-list first) and stamps
+		/// its generational handle.
+		/// </summary>
+		/// <param name="actor">Actor to relocate into the pool</param>
+		/// <returns>Pointer to the pooled actor</returns>
+		Actor* Create(Actor&& actor);
+
+		/// <summary>
+		/// Copy-constructs the actor into a pooled slot (free-list first) and
+		/// stamps its generational handle. Used by the prototype spawn fast
+		/// path to clone straight into pooled storage with no intermediate
+		/// heap actor.
+		/// </summary>
+		/// <param name="actor">Actor to deep-copy into the pool</param>
+		/// <returns>Pointer to the pooled copy</returns>
+		Actor* Create(const Actor& actor);
+
+		/// <summary>
+		/// Destroys a pooled actor and recycles its slot. Bumps the slot
+		/// generation so outstanding handles to the actor go stale.
+		/// </summary>
+		/// <param name="actor">Pooled actor to destroy</param>
+		void Destroy(Actor* actor);
+
+		/// <summary>
+		/// Resolves a handle to the live actor it references.
+		/// </summary>
+		/// <param name="handle">Handle stamped by Create</param>
+		/// <returns>The actor, or nullptr if the slot was freed or reused</returns>
+		Actor* Get(ActorHandle handle);
+
+		/// <summary>
+		/// Destroys every live actor and releases the blocks.
+		/// </summary>
+		void Clear();
+
+		size_t Count() const { return m_count; }
+
+		/// <summary>
+		/// Live actor in a slot by raw index, nullptr for free slots. Lets
+		/// incremental passes (the checkpoint capture) resume a pool walk
+		/// across frames by index - an iterator can't be held over a pool
+		/// that spawns and destroys between slices.
+		/// </summary>
+		Actor* GetAt(uint32_t index) {
+			return (index < m_capacity && GetSlot(index)->alive) ? (Actor*)GetSlot(index)->storage : nullptr;
+		}
+
+		uint32_t GetCapacity() const { return m_capacity; }
+
+		/// <summary>
+		/// Forward iterator over live actors in slot (index) order, yielding
+		/// Actor* - lets range-for walk the pool like a container of pointers.
+		/// </summary>
+		class iterator {
+		public:
+			iterator(ActorPool* pool, uint32_t index) :
+				m_pool{ pool },
+				m_index{ index }
+			{
+				Skip();
+			}
+
+			Actor* operator*() const { return (Actor*)m_pool->GetSlot(m_index)->storage; }
+			iterator& operator++() { m_index++; Skip(); return *this; }
+			bool operator==(const iterator& other) const { return m_index == other.m_index; }
+			bool operator!=(const iterator& other) const { return m_index != other.m_index; }
+
+		private:
+			// advance past free slots
+			void Skip() {
+				while (m_index < m_pool->m_capacity && !m_pool->GetSlot(m_index)->alive) m_index++;
+			}
+
+			ActorPool* m_pool;
+			uint32_t m_index;
+		};
+
+		iterator begin() { return iterator{ this, 0 }; }
+		iterator end() { return iterator{ this, m_capacity }; }
+
+	private:
+		/// <summary>
+		/// Raw storage for one actor plus the liveness/generation bookkeeping.
+		/// </summary>
+		struct Slot {
+			alignas(Actor) uint8_t storage[sizeof(Actor)];
+			uint32_t generation{ 1 };
+			bool alive{ false };
+		};
+
+		Slot* GetSlot(uint32_t index) { return &m_blocks[index / kBlockSize][index % kBlockSize]; }
+
+		// pops a free-list slot or grows the pool by a block, shared by both
+		// Create overloads
+		uint32_t AcquireSlot();
+
+		// fixed-size blocks, addresses stay stable as the pool grows
+		std::vector<std::unique_ptr<Slot[]>> m_blocks;
+		std::vector<uint32_t> m_freeList;
+		uint32_t m_capacity{ 0 };
+		size_t m_count{ 0 };
+	};
+}
@@ -1,7 +1,112 @@
 #pragma once
 #include "Object.h"
+#include "ComponentPool.h"
+#include "Core/TypeId.h"
+#include <unordered_map>
 
 namespace neu {
+    /// <summary>
+    /// Sequential type id assigned to each concrete component class when it
+    /// registers with the Factory. Scene uses these ids to bucket components
+    /// into typed registries so type queries need no RTTI.
+    /// </summary>
+    using component_type_t = int;
+    constexpr component_type_t invalidComponentType = -1;
+
+    class ComponentType {
+    public:
+        /// <summary>
+        /// Compile-time 64-bit hash of component class T's name - a literal
+        /// at the use site, usable in constant expressions.
+        /// </summary>
+        template<typename T>
+        static constexpr uint64_t Hash() { return TypeHash<T>(); }
+
+        /// <summary>
+        /// Returns the dense type id for component class T. The id is bound
+        /// to the type's compile-time hash on first use and cached in the
+        /// function-local static, so repeat calls are a guarded load.
+        /// </summary>
+        template<typename T>
+        static component_type_t Id() {
+            static const component_type_t id = Assign(Hash<T>());
+            return id;
+        }
+
+        /// <summary>
+        /// Resolves a type hash to its dense id - invalidComponentType if
+        /// the type never took an id.
+        /// </summary>
+        static component_type_t FromHash(uint64_t hash) {
+            auto& registry = Registry();
+            auto iter = registry.find(hash);
+            return (iter != registry.end()) ? iter->second : invalidComponentType;
+        }
+
+        /// <summary>
+        /// Number of component type ids assigned so far.
+        /// </summary>
+        static int Count() { return s_count; }
+
+    private:
+        /// <summary>
+        /// Binds the next sequential id to a type hash, reusing an id the
+        /// hash already holds so ids stay dense and stable.
+        /// </summary>
+        static component_type_t Assign(uint64_t hash) {
+            auto& registry = Registry();
+            auto iter = registry.find(hash);
+            if (iter != registry.end()) return iter->second;
+
+            component_type_t id = s_count++;
+            registry[hash] = id;
+            return id;
+        }
+
+        // function-local so the registry exists before any static-init-time
+        // Assign call, regardless of translation unit order
+        static std::unordered_map<uint64_t, component_type_t>& Registry() {
+            static std::unordered_map<uint64_t, component_type_t> registry;
+            return registry;
+        }
+
+        inline static component_type_t s_count = 0;
+    };
+
+    /// <summary>
+    /// Opt-in batch update for trivial behaviors.
+    ///
+    /// A component class registers one function that updates every live
+    /// instance of its type in a single call over the scene's typed registry
+    /// slice - one indirect call per type per frame instead of one virtual
+    /// Update per instance, walking pointers into the ComponentPool slabs the
+    /// instances were carved from. Actor::Update skips registered types; the
+    /// batch function owns the active/destroyed checks the per-actor path
+    /// would have done. Register with BATCH_UPDATE_REGISTER next to the
+    /// class's FACTORY_REGISTER.
+    /// </summary>
+    class BatchUpdate {
+    public:
+        using batch_update_t = void(*)(const std::vector<class Component*>& components, float dt);
+
+        static void Register(component_type_t typeId, batch_update_t update) {
+            if (typeId >= (component_type_t)s_updates.size()) s_updates.resize(typeId + 1, nullptr);
+            s_updates[typeId] = update;
+        }
+
+        // hot check on the actor update path - a bounds test and a load
+        static bool IsBatched(component_type_t typeId) {
+            return typeId >= 0 && typeId < (component_type_t)s_updates.size() && s_updates[typeId] != nullptr;
+        }
+
+        static batch_update_t Get(component_type_t typeId) {
+            return (typeId >= 0 && typeId < (component_type_t)s_updates.size()) ? s_updates[typeId] : nullptr;
+        }
+
+    private:
+        inline static std::vector<batch_update_t> s_updates;
+    };
+
     /// <summary>
     /// Abstract base class for all components in the Entity-Component-System (ECS) architecture.
     /// 
@@ -82,6 +187,31 @@ namespace neu {
         /// </summary>
         class Actor* owner{ nullptr };
 
+        /// <summary>
+        /// Type id of the concrete component class, stamped by the Factory
+        /// creator at construction and preserved through Clone(). Used by
+        /// Scene's typed component registries in place of dynamic_cast.
+        /// </summary>
+        component_type_t typeId{ invalidComponentType };
+
+        /// <summary>
+        /// Opt-out from the scene's update-rate LOD ("update_rate_lod"):
+        /// a component that must tick every frame regardless of camera
+        /// distance (input response, network state) sets this in its
+        /// constructor, and the owning actor is never rate-reduced.
+        /// Actor::Start folds it into the actor's fullRateUpdate flag.
+        /// </summary>
+        bool fullRateUpdate{ false };
+
+        /// <summary>
+        /// Opt-out from the scene's parallel Start() phase: a component
+        /// whose Start touches shared state - spawns actors, schedules
+        /// timers, registers with a single-threaded system - sets this in
+        /// its constructor, and the owning actor starts in the serial
+        /// in-order phase after the parallel batch.
+        /// </summary>
+        bool serialStart{ false };
+
     public:
         /// <summary>
         /// Default constructor for component initialization.
@@ -95,7 +225,43 @@ namespace neu {
         /// after the component is properly attached and the game world is ready.
         /// </summary>
         Component() = default;
-        
+
+        /// <summary>
+        /// Components allocate from ComponentPool's size-class slabs rather
+        /// than the global heap, so components created together sit adjacent
+        /// in memory and the actor update loop walks contiguous slabs instead
+        /// of chasing one scattered heap block per component. Inherited by
+        /// every derived component; the sized delete receives the dynamic
+        /// type's size through the virtual destructor, selecting the matching
+        /// size class. Oversized components fall back to the heap inside the
+        /// pool, so unique_ptr ownership works unchanged either way.
+        /// </summary>
+        static void* operator new(size_t size) { return ComponentPool::Allocate(size); }
+        static void operator delete(void* pointer, size_t size) { ComponentPool::Free(pointer, size); }
+
+        /// <summary>
+        /// Binary checkpoint hooks for state the field descriptor table
+        /// can't carry - resource references (written by name, re-fetched
+        /// through the resource manager on restore), named enums, anything
+        /// with custom Read() handling. Plain fields registered through the
+        /// descriptor table are captured automatically; the defaults carry
+        /// nothing. The two must stay symmetric - the reader has no framing
+        /// around this section.
+        /// </summary>
+        virtual void WriteSnapshot(class SnapshotWriter& writer) {}
+        virtual void ReadSnapshot(class SnapshotReader& reader) {}
+
+        /// <summary>
+        /// Restores the component to its just-spawned state when the owning
+        /// actor is re-armed from the scene's recycle pool (Scene::Recycle).
+        /// Start() is not re-run on re-arm and registry entries are restored
+        /// by the scene, so Reset only rewinds mutable gameplay state -
+        /// timers, velocities, accumulated damage. The default carries
+        /// nothing; components with per-life state override this.
+        /// </summary>
+        virtual void Reset() {}
+
+
         /// <summary>
         /// Pure virtual update method called every frame while the component is active.
         /// 
@@ -159,4 +325,21 @@ namespace neu {
         /// </param>
         virtual void Update(float dt) = 0;
     };
-}
\ No newline at end of file
+}
+
+/// <summary>
+/// Registers classname's static UpdateBatch with the batch update registry
+/// at program startup, same pattern as FACTORY_REGISTER. The class must
+/// declare:
+///   static void UpdateBatch(const std::vector<Component*>& components, float dt);
+/// Place next to the class's FACTORY_REGISTER in its translation unit.
+/// </summary>
+/// <param name="classname">The component class to register (without quotes)</param>
+#define BATCH_UPDATE_REGISTER(classname) \
+class BatchRegister##classname {         \
+public:                                  \
+	BatchRegister##classname() {         \
+		neu::BatchUpdate::Register(neu::ComponentType::Id<classname>(), &classname::UpdateBatch); \
+	}                                    \
+};                                       \
+BatchRegister##classname batch_register_instance;
\ No newline at end of file
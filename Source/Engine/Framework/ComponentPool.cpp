@@ -0,0 +1,63 @@
+#include "ComponentPool.h"
+#include "Core/MemoryTracker.h"
+#include <new>
+
+namespace neu {
+	ComponentPool::Bin* ComponentPool::GetBin(size_t size)
+	{
+		for (int i = 0; i < kBinCount; i++) {
+			if (size <= kSlotSizes[i]) return &s_bins[i];
+		}
+		return nullptr;
+	}
+
+	void* ComponentPool::Allocate(size_t size)
+	{
+		Bin* bin = GetBin(size);
+		if (!bin) {
+			// oversized component - plain heap allocation
+			s_fallbackCount++;
+			void* pointer = ::operator new(size);
+			MemoryTracker::Track(MemTag::Scene, pointer, size);
+			return pointer;
+		}
+
+		if (!bin->freeList) {
+			// carve a fresh slab into slots, threaded onto the free list in
+			// address order so a burst of creations (scene load, prototype
+			// spawns) fills the slab front to back
+			size_t slotSize = kSlotSizes[bin - s_bins];
+			auto slab = std::make_unique<uint8_t[]>(kSlabSize);
+			for (size_t i = kSlabSize / slotSize; i > 0; i--) {
+				FreeSlot* slot = (FreeSlot*)(slab.get() + (i - 1) * slotSize);
+				slot->next = bin->freeList;
+				bin->freeList = slot;
+			}
+			MemoryTracker::Track(MemTag::Scene, slab.get(), kSlabSize);
+			bin->slabs.push_back(std::move(slab));
+		}
+
+		FreeSlot* slot = bin->freeList;
+		bin->freeList = slot->next;
+		s_pooledCount++;
+		return slot;
+	}
+
+	void ComponentPool::Free(void* pointer, size_t size)
+	{
+		if (!pointer) return;
+
+		Bin* bin = GetBin(size);
+		if (!bin) {
+			s_fallbackCount--;
+			MemoryTracker::Untrack(MemTag::Scene, pointer, size);
+			::operator delete(pointer);
+			return;
+		}
+
+		FreeSlot* slot = (FreeSlot*)pointer;
+		slot->next = bin->freeList;
+		bin->freeList = slot;
+		s_pooledCount--;
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace neu {
+	/// <summary>
+	/// Slab allocator behind Component's class-level operator new/delete.
+	///
+	/// Components are small polymorphic objects created through the Factory
+	/// and owned by unique_ptr, and their addresses must stay stable - the
+	/// scene's typed registries and every component's owner back-reference
+	/// hold raw pointers, and pooled actors relocate when Scene::AddActor
+	/// moves them into their slot. So rather than storing components inline
+	/// in the actor, allocations come from size-class slabs: components
+	/// created together land next to each other, so the actor update loop
+	/// walks mostly-contiguous slab memory instead of one scattered heap
+	/// block per component. Components larger than the biggest size class
+	/// fall back to the global heap.
+	///
+	/// Single-threaded by design - components are created and destroyed on
+	/// the main thread (scene load, deferred command drain), never from
+	/// workers.
+	/// </summary>
+	class ComponentPool {
+	public:
+		// size classes - cover every stock component with room to spare;
+		// larger custom components take the heap fallback
+		static constexpr size_t kSlotSizes[] = { 64, 128, 256, 512 };
+		static constexpr int kBinCount = 4;
+
+		// slab granularity - each bin grows by whole slabs, carved into slots
+		static constexpr size_t kSlabSize = 64 * 1024;
+
+		/// <summary>
+		/// Returns a slot from the matching size class, carving a new slab
+		/// when the bin's free list is empty. Oversized requests go to the
+		/// global heap.
+		/// </summary>
+		static void* Allocate(size_t size);
+
+		/// <summary>
+		/// Returns a slot to its size class's free list. The size selects the
+		/// bin, so it must match the Allocate call - Component's sized
+		/// operator delete receives the dynamic type's size through the
+		/// virtual destructor.
+		/// </summary>
+		static void Free(void* pointer, size_t size);
+
+		// live allocation counts, pooled vs heap fallback
+		static int GetPooledCount() { return s_pooledCount; }
+		static int GetFallbackCount() { return s_fallbackCount; }
+
+	private:
+		// intrusive free list threaded through unused slots
+		struct FreeSlot { FreeSlot* next; };
+
+		struct Bin {
+			std::vector<std::unique_ptr<uint8_t[]>> slabs;
+			FreeSlot* freeList{ nullptr };
+		};
+
+		static Bin* GetBin(size_t size);
+
+		inline static Bin s_bins[kBinCount];
+		inline static int s_pooledCount{ 0 };
+		inline static int s_fallbackCount{ 0 };
+	};
+}
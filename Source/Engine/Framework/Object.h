@@ -2,6 +2,7 @@
 // Object.h
 // ============================================================================
 #pragma once
+#include "Core/InternedString.h"
 #include "Core/Serializable.h"
 #include "GUI/GUI.h"
 #include <string>
@@ -98,8 +99,13 @@ namespace neu {
         /// - Avoid special characters that might interfere with file systems or parsing
         /// 
         /// Examples: "MainCamera", "PlayerCharacter", "Background_Layer1", "EnemySpawner"
+        ///
+        /// Interned: equal names share one global table entry, so name
+        /// comparisons (scene lookups, queries) are pointer compares and
+        /// copying a name never allocates. Identity is case-insensitive,
+        /// matching the engine's lookup conventions.
         /// </summary>
-        std::string name;
+        InternedString name;
 
         /// <summary>
         /// Boolean flag indicating whether the object is currently active/enabled.
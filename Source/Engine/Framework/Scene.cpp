@@ -1,7 +1,63 @@
 #include "Scene.h"
 #include "Renderer/Renderer.h"
+#include "Engine.h"
+#include "Core/JobSystem.h"
+#include <unordered_set>
 
 namespace neu {
+    namespace {
+        // actors per job in the parallel update phase, sized so a batch's
+        // actor/component data stays cache-friendly on one worker
+        constexpr size_t kUpdateBatchSize = 64;
+
+        // main-thread time spent per frame instantiating actors from an
+        // async scene load - component Read() creates GL resources, so the
+        // work can't leave this thread, only spread across frames
+        constexpr float kLoadBudgetSeconds = 0.002f;
+
+        // sub-scenes unload at radius * margin so a camera hovering at the
+        // boundary doesn't thrash loads
+        constexpr float kUnloadMargin = 1.25f;
+
+        // frames a dynamic actor's transform must idle before it sleeps
+        // (when the scene opted into "actor_sleeping")
+        constexpr int kSleepIdleFrames = 60;
+
+        // update-rate LOD distance bands (when the scene opted into
+        // "update_rate_lod"): full rate inside the first band, then every
+        // 2nd, 4th and 8th frame. Rendered actors no camera saw last frame
+        // drop one extra band
+        constexpr float kUpdateLodBands[3] = { 25.0f, 50.0f, 100.0f };
+        constexpr int kUpdateLodIntervals[4] = { 1, 2, 4, 8 };
+
+        // FNV-1a over raw bytes - used to fingerprint the recorded camera /
+        // light / shadow uniform inputs so playback can skip re-uploading
+        // values that haven't changed since the last frame
+        uint64_t HashBytes(const void* data, size_t size, uint64_t hash = 14695981039346656037ull) {
+            auto bytes = static_cast<const uint8_t*>(data);
+            for (size_t i = 0; i < size; i++) {
+                hash ^= bytes[i];
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        // shared skinning palette SSBO, orphaned and refilled per skinned
+        // draw - playback is single-threaded on the GL context, so every
+        // skinned command in the frame can reuse the one buffer
+        GLuint skinPaletteBuffer = 0;
+
+        void UploadSkinPalette(const glm::mat4* palette, int count) {
+            if (!skinPaletteBuffer) glGenBuffers(1, &skinPaletteBuffer);
+
+            glBindBuffer(GL_SHADER_STORAGE_BUFFER, skinPaletteBuffer);
+            glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(glm::mat4) * count, palette, GL_DYNAMIC_DRAW);
+            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, Program::skinPaletteBinding, skinPaletteBuffer);
+
+            FrameStats::AddUpload(sizeof(glm::mat4) * count);
+        }
+    }
+
     /// <summary>
     /// Updates all actors in the scene by advancing their state based on the elapsed time.
     /// 
@@ -26,39 +82,291 @@ namespace neu {
     /// </summary>
     /// <param name="dt">The time elapsed since the last update, in seconds.</param>
     void Scene::Update(float dt) {
-        // PHASE 1: Update all active actors
-        // Loop through every actor in the scene container
-        for (auto& actor : m_actors) {
-            // Check the active flag before processing
-            // This allows actors to be temporarily disabled without removal
-            if (actor->active) {
-                // Delegate to the actor's own Update implementation
-                // dt allows for frame-rate independent movement and timing
-                actor->Update(dt);
+        PROFILE_SCOPE("Scene::Update");
+
+        // staggers the update-rate LOD buckets and timestamps visibility
+        m_frame++;
+
+        // Drain any in-flight async load and drive camera-keyed sub-scene
+        // streaming first, so actors spawned this frame get their Start()
+        // and first Update() together
+        UpdateAsyncLoad();
+        UpdateSubScenes();
+
+        // fire due timers before the actor loop - lifespan expirations mark
+        // actors destroyed here, so this frame's update skips them and the
+        // cleanup phase below collects them
+        m_timers.Update(dt);
+
+        // PHASE 1: Update the dynamic partition. Static and sleeping actors
+        // have no entry here at all, so a mostly-static level walks only
+        // the actors that actually simulate. While the flag is up, AddActor
+        // and Instantiate record into the spawn queue instead of mutating
+        // the pool under this iteration
+        m_updating = true;
+
+        // Resolve and compact the partition in one pass: destroyed actors'
+        // handles have gone stale, and actors flagged static or put to sleep
+        // since the last sweep drop their entry here. The survivors land in
+        // a contiguous snapshot both update modes iterate
+        // update-rate LOD keys on the main camera's position, resolved once
+        // before the sweep
+        glm::vec3 viewpoint{ 0 };
+        bool rateLod = false;
+        if (m_updateRateLod) {
+            for (auto camera : GetActorComponents<CameraComponent>()) {
+                if (camera->shadowCamera) continue;
+                viewpoint = glm::vec3(GetWorldMatrix(camera->owner)[3]);
+                rateLod = true;
+                break;
             }
         }
 
+        frame_vector<Actor*> actors;
+        actors.reserve(m_dynamicActors.size());
+        size_t keep = 0;
+        for (auto handle : m_dynamicActors) {
+            Actor* actor = m_actors.Get(handle);
+            if (!actor || actor->isStatic || actor->sleeping) {
+                if (actor) actor->inUpdateList = false;
+                continue;
+            }
+            m_dynamicActors[keep++] = handle;
+            if (!actor->active) continue;
+
+            // bank the frame's dt unconditionally, then tick only on the
+            // actor's bucket phase - the banked time rides along until the
+            // actor's next turn, so skipped frames don't change simulation
+            // outcomes. handle.index staggers a bucket's actors so no frame
+            // pays a whole band at once
+            actor->bankedUpdateDt += dt;
+            if (rateLod && !actor->fullRateUpdate) {
+                int band = 0;
+                float distance = glm::distance(actor->transform.position, viewpoint);
+                while (band < (int)std::size(kUpdateLodBands) && distance > kUpdateLodBands[band]) band++;
+
+                // rendered but unseen by every camera last frame - one band
+                // further out. Actors with nothing renderable have no
+                // visibility signal and keep their distance band
+                if (band > 0 && actor->HasRenderers() && actor->lastVisibleFrame + 1 != m_frame) {
+                    band = math::min(band + 1, (int)std::size(kUpdateLodBands));
+                }
+
+                if ((m_frame + actor->handle.index) % kUpdateLodIntervals[band]) continue;
+            }
+            actors.push_back(actor);
+        }
+        m_dynamicActors.resize(keep);
+
+        if (m_parallelUpdate) {
+            // The job system hands each worker a cache-friendly batch of the
+            // snapshot. Spawns and destroys are recorded and applied after
+            // the loop; other shared-state side effects must go through
+            // Defer()
+            GetEngine().GetJobSystem().ParallelFor(actors.size(), kUpdateBatchSize,
+                [&actors](size_t index) {
+                    // each actor consumes its banked time - plain dt for
+                    // full-rate actors, the accumulated gap for rate-reduced
+                    // ones
+                    Actor* actor = actors[index];
+                    float banked = actor->bankedUpdateDt;
+                    actor->bankedUpdateDt = 0;
+                    actor->Update(banked);
+                });
+        }
+        else {
+            for (auto actor : actors) {
+                // Delegate to the actor's own Update implementation with its
+                // banked time - frame-rate independent, and unchanged by
+                // update-rate LOD skips
+                float banked = actor->bankedUpdateDt;
+                actor->bankedUpdateDt = 0;
+                actor->Update(banked);
+            }
+        }
+
+        // PHASE 1b: batch-updated component types. Types registered with
+        // BATCH_UPDATE_REGISTER were skipped by the actor loop above; each
+        // gets one call over its typed registry slice, so trivial behaviors
+        // pay one indirect call per type instead of a virtual Update per
+        // instance. Runs after the actor loop so expired lifespans are
+        // already marked and the batch functions can skip destroyed owners
+        for (component_type_t typeId = 0; typeId < (component_type_t)m_componentsByType.size(); typeId++) {
+            auto update = BatchUpdate::Get(typeId);
+            if (!update || m_componentsByType[typeId].empty()) continue;
+            update(m_componentsByType[typeId], dt);
+        }
+
+        m_updating = false;
+
+        // Commit actors spawned during the update loop in one batch, before
+        // cleanup so a spawn-and-destroy in the same frame still gets its
+        // Destroyed() callback
+        ApplySpawns();
+
+        // Run remaining commands deferred during the update phase (events,
+        // cross-actor mutations), single-threaded and before cleanup
+        std::vector<std::function<void()>> commands;
+        {
+            std::lock_guard<std::mutex> lock(m_deferredMutex);
+            commands.swap(m_deferredCommands);
+        }
+        for (auto& command : commands) {
+            command();
+        }
+
         // PHASE 2: Cleanup destroyed actors
-        // Call Destroyed() on actors before removing them to allow cleanup
-        // Then use std::erase_if for efficient removal (C++20 feature)
-        std::erase_if(m_actors, [](auto& actor) {
-            // Check if this actor should be removed
-            if (actor->destroyed) {
-                // Call Destroyed() to give the actor a chance to clean up
-                // (release resources, notify other systems, etc.)
-                actor->Destroyed();
-                // Return true to remove this actor from the container
-                return true;
-            }
-            // Actor is not destroyed, keep it in the scene
-            return false;
-            });
+        // Collect first so pool slots aren't recycled mid-iteration, then
+        // call Destroyed() for cleanup and release each slot to the free list
+        frame_vector<Actor*> destroyedActors;
+        for (auto actor : m_actors) {
+            if (actor->destroyed) destroyedActors.push_back(actor);
+        }
+        for (auto actor : destroyedActors) {
+            // Call Destroyed() to give the actor a chance to clean up
+            // (release resources, notify other systems, etc.)
+            actor->Destroyed();
+            UnindexActor(actor);
+
+            // Recycled actors park in the per-prototype free pool instead
+            // of releasing - the move carries the components (and their
+            // resource references) out of the slot, so the next
+            // Instantiate of this prototype skips the clone entirely. The
+            // slot itself is freed either way, bumping the generation so
+            // held handles go stale like any destroy
+            if (actor->recycled && !actor->spawnPrototype.empty()) {
+                m_recyclePools[actor->spawnPrototype].push_back(std::make_unique<Actor>(std::move(*actor)));
+            }
+            m_actors.Destroy(actor);
+        }
+
+        // advance any in-flight checkpoint capture a budgeted slice - after
+        // cleanup, so destroyed actors never enter the snapshot
+        if (m_checkpoint.IsCapturing()) m_checkpoint.UpdateCapture(m_actors);
+
+        // PHASE 3: recompute world matrices for actors whose transform
+        // changed, then sync the spatial structure against the surviving
+        // actors - the BVH (and the draw pass after it) read the cached
+        // matrices, so the order matters
+        m_transformCache.Update(m_actors);
+
+        // wake/promote/sleep against the fresh per-slot change info, before
+        // Interpolate reuses the cache's scratch
+        UpdatePartition();
+
+        m_bvh.Update(m_actors);
+
+        // refresh actor-to-zone assignments from the fresh BVH (no-op for
+        // scenes without authored zones)
+        m_zones.Update(m_bvh);
+
+        // resolve the frame's batched raycasts against the fresh BVH -
+        // submissions made during the actor update spread across cores here
+        ResolveRayQueries();
+
+        // 3D audio listener follows the first non-shadow camera - one
+        // snapshot per frame off the fresh world matrices, published to the
+        // audio thread by AudioSystem::Update
+        for (auto camera : GetActorComponents<CameraComponent>()) {
+            if (camera->shadowCamera) continue;
+
+            AudioSystem::ListenerAttributes listener;
+            listener.position = glm::vec3(GetWorldMatrix(camera->owner)[3]);
+            glm::mat4 inverseView = camera->GetInverseView();
+            listener.forward = -glm::normalize(glm::vec3(inverseView[2]));
+            listener.up = glm::normalize(glm::vec3(inverseView[1]));
+            if (dt > 0) listener.velocity = (listener.position - m_listenerPosition) / dt;
+            m_listenerPosition = listener.position;
+
+            GetEngine().GetAudio().SetListener(listener);
+            break;
+        }
+    }
+
+    void Scene::UpdatePartition() {
+        PROFILE_SCOPE("Scene::UpdatePartition");
+
+        m_staticCount = 0;
+        m_sleepingCount = 0;
+
+        // one flat flag pass - no virtual calls, just the cache's per-slot
+        // change byte. Sleep/wake decisions key on the world matrix, so a
+        // child riding a moving parent stays awake with it
+        for (auto actor : m_actors) {
+            if (actor->destroyed) continue;
+
+            if (m_transformCache.ChangedThisStep(actor)) {
+                actor->idleFrames = 0;
+
+                // something moved this actor from outside its own Update -
+                // wake it (or re-promote a static) back into the partition
+                if (actor->isStatic || actor->sleeping) {
+                    actor->isStatic = false;
+                    actor->sleeping = false;
+                    if (!actor->inUpdateList) {
+                        m_dynamicActors.push_back(actor->handle);
+                        actor->inUpdateList = true;
+                    }
+                }
+                continue;
+            }
+
+            if (actor->isStatic) {
+                m_staticCount++;
+                continue;
+            }
+            if (actor->sleeping) {
+                m_sleepingCount++;
+                continue;
+            }
+
+            // idle dynamic actor - park it once it has sat still long
+            // enough. canSleep opts out actors driven by state that never
+            // touches the transform; lifespans keep running while asleep,
+            // the timer wheel fires them without the actor updating
+            if (m_actorSleeping && actor->canSleep &&
+                ++actor->idleFrames >= kSleepIdleFrames) {
+                actor->sleeping = true;
+                m_sleepingCount++;
+            }
+        }
     }
 
     void Scene::UpdateGUI()
     {
         ImGui::ColorEdit3("Ambient", glm::value_ptr(m_ambientLight));
         ImGui::Checkbox("Post Process", &m_postprocess);
+        ImGui::Checkbox("Parallel Update", &m_parallelUpdate);
+        ImGui::Checkbox("Actor Sleeping", &m_actorSleeping);
+        ImGui::Text("Partition: %u dynamic / %u sleeping / %u static",
+            (uint32_t)m_dynamicActors.size(), (uint32_t)m_sleepingCount, (uint32_t)m_staticCount);
+        ImGui::Text("Timers pending: %u", (uint32_t)m_timers.GetPendingCount());
+    }
+
+    /// <summary>
+    /// Queues a command to run single-threaded after the update phase.
+    /// Safe to call from actor updates running on worker threads.
+    /// </summary>
+    /// <param name="command">Callable executed on the main thread</param>
+    void Scene::Defer(std::function<void()> command) {
+        std::lock_guard<std::mutex> lock(m_deferredMutex);
+        m_deferredCommands.push_back(std::move(command));
+    }
+
+    /// <summary>
+    /// Commits the spawns recorded during the update loop in one batch.
+    /// Runs with the update flag down, so a Start() here that spawns again
+    /// takes the immediate path into the pool.
+    /// </summary>
+    void Scene::ApplySpawns() {
+        std::vector<SpawnCommand> spawns;
+        {
+            std::lock_guard<std::mutex> lock(m_spawnMutex);
+            spawns.swap(m_spawnQueue);
+        }
+        for (auto& spawn : spawns) {
+            CommitActor(std::move(spawn.actor), spawn.start);
+        }
     }
 
     /// <summary>
@@ -84,109 +392,1267 @@ namespace neu {
     /// </summary>
     /// <param name="renderer">The renderer used to draw the actors.</param>
     void Scene::Draw(Renderer& renderer) {
+        PROFILE_SCOPE("Scene::Draw");
+
+        // take this frame's recorded command queue - wait out a record job
+        // kicked through RecordDrawAsync, or record inline right here on
+        // the synchronous path
+        WaitForRecord();
+
+        if (m_renderQueue.passes.empty()) {
+            LOG_CAT_WARNING(Scene, "No active camera was found in scene.");
+            return;
+        }
+
+        m_uniformUploadsIssued = 0;
+        m_uniformUploadsSkipped = 0;
+
+        // pending reflection probe captures render before this frame's
+        // passes - a probe invalidated last frame serves fresh pixels to
+        // the next record
+        CaptureReflectionProbes(renderer);
+
+        // distribute the recorded shadow matrices to every program before
+        // the passes sample the shadow map - skipped per program when
+        // neither the matrices nor the program set has changed. Cascaded
+        // mode adds the per-cascade crop matrices and split distances the
+        // shaders select between
+        if (m_renderQueue.hasShadowCamera) {
+            uint64_t shadowHash = HashBytes(&m_renderQueue.shadowVP, sizeof(m_renderQueue.shadowVP));
+            if (m_renderQueue.cascadeCount > 0) {
+                shadowHash = HashBytes(m_renderQueue.cascadeVP, sizeof(glm::mat4) * m_renderQueue.cascadeCount, shadowHash);
+                shadowHash = HashBytes(m_renderQueue.cascadeSplits, sizeof(float) * m_renderQueue.cascadeCount, shadowHash);
+            }
+
+            // cache the "u_cascade_*[N]" names so per-frame distribution
+            // doesn't rebuild strings, same as the light uniform names
+            static std::vector<std::string> cascadeVPNames;
+            static std::vector<std::string> cascadeSplitNames;
+            while ((int)cascadeVPNames.size() < m_renderQueue.cascadeCount) {
+                cascadeVPNames.push_back("u_cascade_vp[" + std::to_string(cascadeVPNames.size()) + "]");
+                cascadeSplitNames.push_back("u_cascade_splits[" + std::to_string(cascadeSplitNames.size()) + "]");
+            }
+
+            for (auto& program : m_renderQueue.programs) {
+                auto& state = m_programUniformState[program];
+                if (state.shadow == shadowHash) {
+                    m_uniformUploadsSkipped++;
+                    continue;
+                }
+
+                program->Use();
+                program->SetUniform("u_shadow_vp", m_renderQueue.shadowVP);
+                if (m_renderQueue.cascadeCount > 0) {
+                    program->SetUniform("u_cascade_count", m_renderQueue.cascadeCount);
+                    for (int i = 0; i < m_renderQueue.cascadeCount; i++) {
+                        program->SetUniform(cascadeVPNames[i], m_renderQueue.cascadeVP[i]);
+                        program->SetUniform(cascadeSplitNames[i], m_renderQueue.cascadeSplits[i]);
+                    }
+                }
+                state.shadow = shadowHash;
+                m_uniformUploadsIssued++;
+            }
+        }
+
+        // declare this frame's passes into the render graph: one pass per
+        // recorded render pass (cascades import their array layer), plus
+        // the post-process chain after each camera that wants one. The
+        // graph brackets every pass with the right framebuffer bind,
+        // viewport and profiler scope, and aliases the post-process
+        // transients onto pooled targets
+        m_renderGraph.Reset();
+        bool hiZCaptured = false;
+        for (auto& pass : m_renderQueue.passes) {
+            auto camera = pass.camera;
+            PostProcessComponent* postprocessComponent = camera->owner->GetComponent<PostProcessComponent>();
+            bool renderToTexture = camera->outputTexture && (!postprocessComponent || (postprocessComponent && m_postprocess));
+
+            RenderGraph::target_t output = RenderGraph::backbuffer;
+            if (renderToTexture) output = m_renderGraph.ImportTarget(camera->outputTexture.get(), pass.cascade);
+
+            // dynamic resolution: backbuffer-bound cameras render into a
+            // scaled transient instead, upscaled below in one linear blit -
+            // the GUI drawn after Scene::Draw stays native. Cameras with
+            // authored output textures keep their authored size
+            float resolutionScale = renderer.GetResolutionScale();
+            bool scaledOutput = !renderToTexture && !camera->shadowCamera && renderer.IsDynamicResolutionEnabled() && resolutionScale < 1.0f;
+
+            // anti-aliasing on the scene color target: MSAA renders the
+            // draw pass multisampled and resolves explicitly below; FXAA
+            // needs the scene color in a sampleable texture, so it forces
+            // the offscreen path even at native resolution. Cameras with
+            // authored output textures keep their authored targets
+            int msaaSamples = (!renderToTexture && !camera->shadowCamera) ? renderer.GetMSAASamples() : 0;
+            bool fxaaEnabled = !renderToTexture && !camera->shadowCamera && renderer.GetAntiAliasing() == AAMode::FXAA;
+
+            int sceneWidth = scaledOutput ? math::max((int)(renderer.GetWidth() * resolutionScale), 1) : renderer.GetWidth();
+            int sceneHeight = scaledOutput ? math::max((int)(renderer.GetHeight() * resolutionScale), 1) : renderer.GetHeight();
+
+            if (scaledOutput || msaaSamples > 1 || fxaaEnabled) {
+                RenderTargetDesc desc;
+                desc.width = sceneWidth;
+                desc.height = sceneHeight;
+                desc.depth = true;
+                desc.samples = math::max(msaaSamples, 1);
+                desc.format = renderer.GetSceneColorFormat();
+                output = m_renderGraph.CreateTarget(desc);
+            }
+
+            m_renderGraph.AddPass(camera->shadowCamera ? "Shadow Pass" : "Draw Pass", {}, output,
+                [this, &renderer, &pass, camera, renderToTexture]() {
+                    // shadow passes seed their depth from the cached static
+                    // map inside PlaybackPass instead of clearing
+                    if (!(camera->shadowCamera && renderToTexture)) camera->Clear();
+                    PlaybackPass(renderer, pass);
+                });
+
+            // explicit MSAA resolve: blit color and depth into a same-size
+            // single-sample transient (resolve blits require matching
+            // rectangles), so everything downstream - HiZ capture, FXAA,
+            // upscale, the GUI's view of the backbuffer - reads resolved
+            // pixels and never touches the multisampled target
+            if (msaaSamples > 1) {
+                RenderTargetDesc desc;
+                desc.width = sceneWidth;
+                desc.height = sceneHeight;
+                desc.depth = true;
+                desc.format = renderer.GetSceneColorFormat();
+                RenderGraph::target_t resolved = m_renderGraph.CreateTarget(desc);
+                RenderGraph::target_t multisampled = output;
+
+                m_renderGraph.AddPass("MSAA Resolve", { multisampled }, resolved,
+                    [this, multisampled, resolved]() {
+                        RenderTexture* source = m_renderGraph.GetTexture(multisampled);
+                        RenderTexture* target = m_renderGraph.GetTexture(resolved);
+                        glBindFramebuffer(GL_READ_FRAMEBUFFER, source->m_fbo);
+                        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, target->m_fbo);
+                        // depth resolves alongside color for the HiZ capture;
+                        // depth blits must use nearest filtering
+                        glBlitFramebuffer(
+                            0, 0, source->GetSize().x, source->GetSize().y,
+                            0, 0, target->GetSize().x, target->GetSize().y,
+                            GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+                        glBindFramebuffer(GL_FRAMEBUFFER, target->m_fbo);
+                    });
+
+                output = resolved;
+            }
+
+            // capture the first scene camera's depth for next frame's
+            // occlusion tests - reading the output keeps a transient
+            // target alive through the capture
+            if (m_hiZ.IsEnabled() && !camera->shadowCamera && !hiZCaptured) {
+                hiZCaptured = true;
+                m_hiZCamera = camera;
+                glm::mat4 viewProjection = pass.cameraData.projection * pass.cameraData.view;
+
+                std::vector<RenderGraph::target_t> reads;
+                if (output != RenderGraph::backbuffer) reads.push_back(output);
+                m_renderGraph.AddPass("HiZ Capture", std::move(reads), RenderGraph::backbuffer,
+                    [this, &renderer, output, viewProjection]() {
+                        RenderTexture* source = m_renderGraph.GetTexture(output);
+                        glm::ivec2 size = source ? source->GetSize() : glm::ivec2{ renderer.GetWidth(), renderer.GetHeight() };
+                        m_hiZ.Capture(source ? source->m_fbo : 0, size, viewProjection);
+                    });
+            }
+
+            // FXAA runs at render resolution - cheaper when dynamic
+            // resolution is scaling down, and the upscale blit below then
+            // smooths over its output. Without a scale it writes the
+            // backbuffer directly
+            if (fxaaEnabled) {
+                RenderGraph::target_t antialiased = RenderGraph::backbuffer;
+                if (scaledOutput) {
+                    RenderTargetDesc desc;
+                    desc.width = sceneWidth;
+                    desc.height = sceneHeight;
+                    desc.format = renderer.GetSceneColorFormat();
+                    antialiased = m_renderGraph.CreateTarget(desc);
+                }
+                m_postProcessPipeline.BuildFXAA(m_renderGraph, output, antialiased);
+                output = antialiased;
+            }
+
+            if (scaledOutput) {
+                m_renderGraph.AddPass("Upscale", { output }, RenderGraph::backbuffer,
+                    [this, &renderer, output]() {
+                        RenderTexture* source = m_renderGraph.GetTexture(output);
+                        glBindFramebuffer(GL_READ_FRAMEBUFFER, source->m_fbo);
+                        glBlitFramebuffer(
+                            0, 0, source->GetSize().x, source->GetSize().y,
+                            0, 0, renderer.GetWidth(), renderer.GetHeight(),
+                            GL_COLOR_BUFFER_BIT, GL_LINEAR);
+                        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+                    });
+            }
+
+            if (renderToTexture && postprocessComponent) {
+                m_postProcessPipeline.Build(m_renderGraph, renderer, output, *postprocessComponent);
+            }
+        }
+
+        m_renderGraph.Execute(renderer);
+
+        // play back this frame's debug lines and labels over the finished
+        // scene - at most one depth-tested and one overlay draw, and the
+        // whole facility compiles out in shipping builds
+        for (auto& pass : m_renderQueue.passes) {
+            if (pass.camera->shadowCamera) continue;
+            DebugDraw::Instance().Flush(renderer, pass.cameraData.projection * pass.cameraData.view);
+            break;
+        }
+   }
+
+    /// <summary>
+    /// Records this frame's draw submission into the render queue. The
+    /// whole phase is GL-free - culling, sort-key build, radix sort and
+    /// world-matrix capture - so it can run on a job system worker while
+    /// the main thread does other frame work; Draw() plays the queue back
+    /// with thin GL calls on the context thread.
+    /// </summary>
+    void Scene::RecordDraw() {
+        PROFILE_SCOPE("Scene::RecordDraw");
+
+        m_renderQueue.Clear();
+
+        // blend previous/current simulation state into render matrices when
+        // the engine runs fixed-step updates - every world matrix captured
+        // below sees the interpolated state
+        m_transformCache.Interpolate(m_renderAlpha);
+
+        //light
+        auto lights = GetActorComponents<LightComponent>();
+
+        // baked lights already contributed to the lightmaps at cook time -
+        // dropping them here keeps them out of every runtime path (cluster
+        // binning, light blocks, shadow selection), so they cost nothing
+        std::erase_if(lights, [](auto light) { return light->baked; });
+
+        //camera
+        auto cameras = GetActorComponents<CameraComponent>();
+        if (cameras.empty()) return;
+
+        // distinct programs - maintained incrementally as renderers register
+        // and materials swap, so static scenes pay a flag check here instead
+        // of an actor walk. Inactive renderers keep their program listed;
+        // a listed-but-undrawn program only costs its few uniform uploads
+        if (m_programListDirty) {
+            m_programList.clear();
+            m_programList.reserve(m_programRefs.size());
+            for (auto& [program, refs] : m_programRefs) m_programList.push_back(program);
+            m_programListDirty = false;
+        }
+
+        m_renderQueue.programs.assign(m_programList.begin(), m_programList.end());
+        m_renderQueue.lights.assign(lights.begin(), lights.end());
+
+        // fingerprint light reach independent of any camera - only the
+        // fields the per-draw mask tests read. Unchanged (the common case
+        // when lights hold still) means the static batcher's baked masks
+        // remain valid and playback skips the rebake
+        uint64_t lightStateHash = 0;
+        int lightCount = (int)lights.size();
+        lightStateHash = HashBytes(&lightCount, sizeof(lightCount), lightStateHash);
+        for (auto light : lights) {
+            lightStateHash = HashBytes(&light->owner->transform.position, sizeof(glm::vec3), lightStateHash);
+            lightStateHash = HashBytes(&light->range, sizeof(light->range), lightStateHash);
+            lightStateHash = HashBytes(&light->lightType, sizeof(light->lightType), lightStateHash);
+        }
+        if (lightStateHash != m_lightStateHash) {
+            m_lightStateHash = lightStateHash;
+            m_lightMasksDirty = true;
+        }
+
+        // capture the shadow view projection - Draw() distributes it to the
+        // programs at playback
+        glm::mat4 cascadeProjections[kMaxShadowCascades];
+        auto shadowCamera = std::find_if(cameras.begin(), cameras.end(),
+            [](auto camera) { return camera->shadowCamera; });
+        if (shadowCamera != cameras.end()) {
+            glm::mat4 biasMatrix(
+                0.5, 0.0, 0.0, 0.0,
+                0.0, 0.5, 0.0, 0.0,
+                0.0, 0.0, 0.5, 0.0,
+                0.5, 0.5, 0.5, 1.0
+            );
+
+            // cascaded mode fits one crop per view-frustum slice of the main
+            // camera; the single-map path keeps the authored projection
+            auto mainCamera = std::find_if(cameras.begin(), cameras.end(),
+                [](auto camera) { return !camera->shadowCamera; });
+            int cascadeCount = math::min((*shadowCamera)->cascades, kMaxShadowCascades);
+            // the quality tier caps the authored cascade count - dropped
+            // cascades shorten the shadow range rather than the resolution
+            cascadeCount = math::min(cascadeCount, math::max(Quality::GetMaxShadowCascades(), 1));
+
+            if (cascadeCount > 1 && mainCamera != cameras.end()) {
+                FitShadowCascades(**shadowCamera, **mainCamera, cascadeCount, biasMatrix, cascadeProjections);
+                m_renderQueue.shadowVP = m_renderQueue.cascadeVP[0];
+            }
+            else {
+                m_renderQueue.shadowVP = biasMatrix * (*shadowCamera)->projection * (*shadowCamera)->view;
+            }
+            m_renderQueue.hasShadowCamera = true;
+        }
+
+        // every pass's frustum is collected first so the BVH answers all of
+        // them in one shared multi-frustum traversal over the same tree
+        // snapshot - the shadow cascades are fitted around the main camera,
+        // so their queries overlap it heavily and share the descent instead
+        // of re-walking the scene once per pass
+        struct PendingPass {
+            CameraComponent* camera;
+            glm::mat4 projection;
+            int cascade;
+        };
+        frame_vector<PendingPass> pending;
+        for (auto& camera : cameras) {
+            // a cascaded shadow camera records one pass per cascade, each
+            // culled against its own crop - the camera's projection is
+            // retargeted per cascade so RecordPass captures matching block
+            // data and frustum
+            if (camera->shadowCamera && m_renderQueue.cascadeCount > 0) {
+                for (int i = 0; i < m_renderQueue.cascadeCount; i++) {
+                    pending.push_back({ camera, cascadeProjections[i], i });
+                }
+                continue;
+            }
+            pending.push_back({ camera, camera->projection, -1 });
+        }
+
+        frame_vector<Frustum> frusta;
+        for (auto& entry : pending) {
+            // non-cascade passes use the camera's authored projection, so the
+            // frustum the camera cached when it last changed is exact; cascade
+            // crops are per-pass and extract their own planes
+            frusta.push_back(entry.cascade < 0
+                ? entry.camera->GetFrustum()
+                : Frustum::FromMatrix(entry.projection * entry.camera->view));
+        }
+        auto visibleSets = m_bvh.QueryFrustums(frusta);
+
+        for (size_t i = 0; i < pending.size(); i++) {
+            auto& entry = pending[i];
+            entry.camera->projection = entry.projection;
+
+            RenderPass pass;
+            RecordPass(pass, lights, entry.camera, visibleSets[i]);
+            if (entry.cascade >= 0) pass.cascade = entry.cascade;
+            m_renderQueue.passes.push_back(std::move(pass));
+        }
+    }
+
+    void Scene::FitShadowCascades(CameraComponent& shadowCamera, CameraComponent& mainCamera,
+        int count, const glm::mat4& biasMatrix, glm::mat4* cascadeProjections)
+    {
+        // the light's view comes from the shadow camera's transform, same as
+        // the single-map path - only the projection is fit per cascade
+        const glm::mat4& lightView = shadowCamera.view;
+
+        // practical split scheme - blend logarithmic (resolution up close,
+        // where it shows) and uniform (stable far coverage) distances
+        const float lambda = 0.75f;
+        float near = mainCamera.near;
+        float far = mainCamera.far;
+
+        float sliceNear = near;
+        for (int i = 0; i < count; i++) {
+            float t = (i + 1) / (float)count;
+            float logSplit = near * std::pow(far / near, t);
+            float uniformSplit = near + (far - near) * t;
+            float sliceFar = lambda * logSplit + (1.0f - lambda) * uniformSplit;
+
+            // the slice's eight frustum corners, unprojected to world space
+            glm::mat4 sliceProjection = glm::perspective(glm::radians(mainCamera.fov), mainCamera.aspect, sliceNear, sliceFar);
+            glm::mat4 inverseVP = glm::inverse(sliceProjection * mainCamera.view);
+
+            glm::vec3 minBounds{ std::numeric_limits<float>::max() };
+            glm::vec3 maxBounds{ std::numeric_limits<float>::lowest() };
+            for (int corner = 0; corner < 8; corner++) {
+                glm::vec4 ndc{
+                    (corner & 1) ? 1.0f : -1.0f,
+                    (corner & 2) ? 1.0f : -1.0f,
+                    (corner & 4) ? 1.0f : -1.0f,
+                    1.0f };
+                glm::vec4 world = inverseVP * ndc;
+                world /= world.w;
+
+                // into light space, where the crop is an axis-aligned box
+                glm::vec3 light = glm::vec3(lightView * world);
+                minBounds = glm::min(minBounds, light);
+                maxBounds = glm::max(maxBounds, light);
+            }
+
+            // light space looks down -z; pull the near plane back by the
+            // slice's own depth extent so casters behind the slice still
+            // land in the map
+            float depth = maxBounds.z - minBounds.z;
+            glm::mat4 projection = glm::ortho(
+                minBounds.x, maxBounds.x,
+                minBounds.y, maxBounds.y,
+                -maxBounds.z - depth, -minBounds.z);
+
+            cascadeProjections[i] = projection;
+            m_renderQueue.cascadeVP[i] = biasMatrix * projection * lightView;
+            m_renderQueue.cascadeSplits[i] = sliceFar;
+
+            sliceNear = sliceFar;
+        }
+
+        m_renderQueue.cascadeCount = count;
+    }
+
+    void Scene::RecordPass(RenderPass& pass,
+        const frame_vector<LightComponent*>& lights,
+        CameraComponent* camera,
+        const frame_vector<Actor*>& visible)
+    {
+        pass.camera = camera;
+
+        // stamp visibility for the update-rate LOD - conservative across
+        // every pass's frustum, read by the next frame's partition sweep
+        for (auto actor : visible) actor->lastVisibleFrame = m_frame;
+
+        // shared camera/light block contents, uploaded once at playback
+        pass.cameraData.view = camera->view;
+        pass.cameraData.projection = camera->projection;
+        pass.cameraData.ambientLight = m_ambientLight;
+        pass.cameraData._pad0 = 0;
+
+        pass.lightData.numLights = math::min((int)lights.size(), kMaxBlockLights);
+        for (int i = 0; i < pass.lightData.numLights; i++) {
+            auto light = lights[i];
+            auto& data = pass.lightData.lights[i];
+
+            // light position/direction in view space, same as the legacy path
+            data.position = glm::vec3(camera->view * glm::vec4(light->owner->transform.position, 1));
+            data.direction = glm::normalize(glm::mat3(camera->view) * light->owner->transform.Forward());
+            data.color = light->color;
+            data.intensity = light->intensity;
+            data.range = light->range;
+            data.type = (int)light->lightType;
+            data.innerSpotAngle = glm::radians(light->innerSpotAngle);
+            data.outerSpotAngle = glm::radians(light->outerSpotAngle);
+            data.shadowCaster = light->shadowCaster;
+        }
+
+        // fingerprint the uniform inputs. The camera hash covers the block
+        // contents; the light hash folds in every light's source state (the
+        // legacy uniform path isn't capped at kMaxBlockLights) plus the view
+        // matrix, since the uploaded values are view-space
+        pass.cameraHash = HashBytes(&pass.cameraData, sizeof(pass.cameraData));
+
+        uint64_t lightHash = HashBytes(&camera->view, sizeof(camera->view));
+        int numLights = (int)lights.size();
+        lightHash = HashBytes(&numLights, sizeof(numLights), lightHash);
+        for (auto light : lights) {
+            lightHash = HashBytes(&light->owner->transform.position, sizeof(glm::vec3), lightHash);
+            lightHash = HashBytes(&light->owner->transform.rotationq, sizeof(glm::quat), lightHash);
+            lightHash = HashBytes(&light->color, sizeof(light->color), lightHash);
+            lightHash = HashBytes(&light->intensity, sizeof(light->intensity), lightHash);
+            lightHash = HashBytes(&light->range, sizeof(light->range), lightHash);
+            lightHash = HashBytes(&light->lightType, sizeof(light->lightType), lightHash);
+            lightHash = HashBytes(&light->innerSpotAngle, sizeof(light->innerSpotAngle), lightHash);
+            lightHash = HashBytes(&light->outerSpotAngle, sizeof(light->outerSpotAngle), lightHash);
+            lightHash = HashBytes(&light->shadowCaster, sizeof(light->shadowCaster), lightHash);
+        }
+        pass.lightHash = lightHash;
+
+        // cull against this camera's frustum, the shadow camera runs the same
+        // pass with its own (tighter) view-projection. The conservative
+        // visible set arrives from the shared multi-frustum BVH query in
+        // Draw(); its leaves are fattened, so survivors still get the exact
+        // per-component test below
+        pass.frustum = Frustum::FromMatrix(camera->projection * camera->view);
+
+        // occlusion tests only apply to the camera whose depth fed the
+        // HiZ pyramid - other cameras see a different view
+        bool occlusionCull = m_hiZ.IsEnabled() && camera == m_hiZCamera;
+
+        // interior levels: flood-fill the zones reachable from the camera
+        // through frustum-intersecting portals, then drop actors whose
+        // zones are all unreachable. Shadow cameras skip it - casters in
+        // an unreachable room still throw shadows into a reachable one
+        bool zoneCull = !m_zones.IsEmpty() && !camera->shadowCamera;
+        uint64_t visibleZones = zoneCull
+            ? m_zones.ComputeVisibleZones(camera->owner->transform.position, pass.frustum)
+            : ~0ull;
+
+        // build the frame's draw records - every visible ModelRenderer emits
+        // a 64-bit sort key (program | material | depth), then a radix sort
+        // groups the records so playback only changes GL state on transitions
+        m_drawList.Clear();
+        frame_vector<std::pair<float, ModelRenderer*>> transparents;
+        for (auto actor : visible) {
+            if (!actor->active) continue;
+
+            // every zone the actor touches is unreachable from the camera
+            if (zoneCull && m_zones.IsCulled(actor, visibleZones)) continue;
+
+            for (auto component : actor->GetComponents<ModelRenderer>()) {
+                if (!component->active || component->isStatic) continue;
+                if (!pass.frustum.Intersects(component->GetWorldBounds())) continue;
+
+                // behind last frame's depth everywhere on screen - skip
+                if (occlusionCull && m_hiZ.IsOccluded(component->GetWorldBounds())) continue;
+
+                // sky renderers are collected below, outside the culled set
+                if (component->material && component->material->sky) continue;
+
+                // transparent materials bypass the state-grouped sort - they
+                // must draw back to front across material boundaries
+                if (component->model && !component->instanced &&
+                    component->material && component->material->transparent) {
+                    float depth = -(camera->view * glm::vec4(actor->transform.position, 1)).z;
+                    if (!camera->shadowCamera) component->UpdateLod(depth);
+                    transparents.push_back({ depth, component });
+                    continue;
+                }
+
+                // shadow passes reuse the main camera's LOD selection so the
+                // shadow silhouette matches the drawn geometry
+                component->Submit(m_drawList, camera->view, !camera->shadowCamera);
+            }
+        }
+        m_drawList.Sort();
+
+        // sky draws come straight off the component registry, never culled -
+        // the sky cube's unit bounds say nothing about what it covers, its
+        // vertex shader pins it around the camera at the far plane
+        if (!camera->shadowCamera) {
+            for (auto component : GetActorComponents<ModelRenderer>()) {
+                if (!component->active || !component->owner->active) continue;
+                if (!component->model || !component->material || !component->material->sky) continue;
+
+                pass.skyDraws.push_back({
+                    component->material.get(),
+                    component->model.get(),
+                    GetWorldMatrix(component->owner),
+                    component->GetLod(),
+                    false,
+                    component->cullFace,
+                    0,
+                    ~0u,
+                    nullptr, 0 });
+            }
+        }
+
+        std::stable_sort(transparents.begin(), transparents.end(),
+            [](const auto& a, const auto& b) { return a.first > b.first; });
+
+        // captured reflection probes, resolved per renderer below - a draw
+        // whose material samples a cube map binds the nearest probe's
+        // capture in place of the authored map. Probe captures land a frame
+        // before any pass records against them
+        auto probes = GetActorComponents<ReflectionProbeComponent>();
+        std::erase_if(probes, [](auto probe) { return !probe->active || !probe->IsCaptured(); });
+        auto nearestProbe = [&probes](Material* material, const glm::vec3& position) -> GLuint {
+            if (probes.empty() || !material || !material->cubeMap) return 0;
+
+            GLuint result = 0;
+            float best = std::numeric_limits<float>::max();
+            for (auto probe : probes) {
+                float distance = glm::distance(position, probe->owner->transform.position);
+                if (distance <= probe->radius && distance < best) {
+                    best = distance;
+                    result = probe->GetCubeMap();
+                }
+            }
+            return result;
+        };
+
+        // resolve the sorted records into self-contained commands - the
+        // world matrix is captured here so playback reads no scene state
+        // skinned draws capture a pointer into their AnimationComponent's
+        // sampled palette - the component only rewrites it during update,
+        // which this record runs after
+        auto skinPalette = [](ModelRenderer* drawRenderer) -> const std::vector<glm::mat4>* {
+            auto animation = drawRenderer->owner->GetComponent<AnimationComponent>();
+            return (animation && animation->HasPalette()) ? &animation->GetPalette() : nullptr;
+        };
+
+        // per-draw light mask - bit i clears when light i can't reach the
+        // draw's bounds, so the fragment loop skips it outright. Tested
+        // against current bounds every record, which keeps moving objects
+        // correct for a few sphere-box tests per draw; shadow passes are
+        // depth-only and skip the tests
+        auto lightMaskFor = [&lights, camera](ModelRenderer* drawRenderer) -> uint32_t {
+            if (camera->shadowCamera) return ~0u;
+
+            uint32_t mask = ~0u;
+            Bounds bounds = drawRenderer->GetWorldBounds();
+            int count = math::min((int)lights.size(), 32);
+            for (int i = 0; i < count; i++) {
+                if (!lights[i]->Affects(bounds)) mask &= ~(1u << i);
+            }
+            return mask;
+        };
+
+        pass.draws.reserve(m_drawList.GetRecords().size());
+        for (auto& record : m_drawList.GetRecords()) {
+            auto drawRenderer = record.renderer;
+            auto palette = skinPalette(drawRenderer);
+
+            pass.draws.push_back({
+                drawRenderer->material.get(),
+                drawRenderer->model.get(),
+                GetWorldMatrix(drawRenderer->owner),
+                drawRenderer->GetLod(),
+                drawRenderer->enableDepth,
+                drawRenderer->cullFace,
+                nearestProbe(drawRenderer->material.get(), drawRenderer->owner->transform.position),
+                lightMaskFor(drawRenderer),
+                palette ? palette->data() : nullptr,
+                palette ? (int)palette->size() : 0 });
+        }
+
+        // transparents resolve into their own queue in back-to-front order
+        pass.transparentDraws.reserve(transparents.size());
+        for (auto& [depth, drawRenderer] : transparents) {
+            auto palette = skinPalette(drawRenderer);
+
+            pass.transparentDraws.push_back({
+                drawRenderer->material.get(),
+                drawRenderer->model.get(),
+                GetWorldMatrix(drawRenderer->owner),
+                drawRenderer->GetLod(),
+                drawRenderer->enableDepth,
+                drawRenderer->cullFace,
+                nearestProbe(drawRenderer->material.get(), drawRenderer->owner->transform.position),
+                lightMaskFor(drawRenderer),
+                palette ? palette->data() : nullptr,
+                palette ? (int)palette->size() : 0 });
+        }
+
+        // collect instanced renderers sharing the same Model+Material into
+        // batches - gathered in frame-arena memory, then the per-batch
+        // matrices move into the queue for playback
+        frame_map<std::pair<Model*, Material*>, frame_vector<glm::mat4>> batches;
+        for (auto actor : visible) {
+            if (!actor->active) continue;
+            if (zoneCull && m_zones.IsCulled(actor, visibleZones)) continue;
+
+            for (auto component : actor->GetComponents<ModelRenderer>()) {
+                if (!component->active || !component->instanced || component->isStatic) continue;
+                if (!component->model || !component->material) continue;
+                if (!pass.frustum.Intersects(component->GetWorldBounds())) continue;
+                if (occlusionCull && m_hiZ.IsOccluded(component->GetWorldBounds())) continue;
+
+                batches[{ component->model.get(), component->material.get() }].push_back(GetWorldMatrix(actor));
+            }
+        }
+
+        for (auto& [key, transforms] : batches) {
+            auto& [model, material] = key;
+
+            InstancedBatch batch;
+            batch.material = material;
+            batch.model = model;
+            batch.transforms.assign(transforms.begin(), transforms.end());
+            pass.batches.push_back(std::move(batch));
+        }
+
+        // bin the frame's lights into this camera's froxel grid - shaders on
+        // the clustered path fetch per-cluster light lists instead of walking
+        // a global array. Shadow passes don't shade, so they skip it
+        if (!camera->shadowCamera) LightClusters::Build(pass, lights, *camera);
+    }
+
+    void Scene::PlaybackPass(Renderer& renderer, RenderPass& pass)
+    {
+        PROFILE_SCOPE("Scene::PlaybackPass");
+
+        auto camera = pass.camera;
+
+        // upload the shared camera/light blocks once, every program linked
+        // against the fixed binding points reads them with no uniform calls.
+        // The buffers are shared across passes, so an upload is only skipped
+        // when this pass's data matches what the buffer currently holds
+        if (!m_cameraBuffer.IsCreated()) m_cameraBuffer.Create(sizeof(CameraBlockData), Program::cameraBlockBinding);
+        if (!m_lightBuffer.IsCreated()) m_lightBuffer.Create(sizeof(LightBlockData), Program::lightBlockBinding);
+
+        if (pass.cameraHash != m_lastCameraBlockHash) {
+            m_cameraBuffer.Upload(&pass.cameraData, sizeof(pass.cameraData));
+            m_lastCameraBlockHash = pass.cameraHash;
+            m_uniformUploadsIssued++;
+        }
+        else m_uniformUploadsSkipped++;
+
+        if (pass.lightHash != m_lastLightBlockHash) {
+            m_lightBuffer.Upload(&pass.lightData, sizeof(pass.lightData));
+            m_lastLightBlockHash = pass.lightHash;
+            m_uniformUploadsIssued++;
+        }
+        else m_uniformUploadsSkipped++;
+
+        // binned light set for this camera, bound as SSBOs - programs
+        // declaring the cluster blocks read these instead of the capped
+        // uniform arrays
+        if (!camera->shadowCamera && !pass.clusterLights.empty()) m_lightClusters.Upload(pass);
+
+        for (auto& program : m_renderQueue.programs) {
+            // program uniforms persist across frames, so each program
+            // remembers the hash behind its last set and skips the glUniform
+            // sequence when the camera/lights it saw are unchanged
+            auto& state = m_programUniformState[program];
+            bool cameraChanged = state.camera != pass.cameraHash;
+            bool lightsChanged = state.lights != pass.lightHash;
+            if (!cameraChanged && !lightsChanged) {
+                if (!program->HasCameraBlock() || !program->HasLightBlock()) m_uniformUploadsSkipped++;
+                continue;
+            }
+
+            program->Use();
+
+            if (cameraChanged) {
+                // cluster lookup inputs ride as plain uniforms for every
+                // program - the fragment's tile comes from gl_FragCoord over
+                // the target size, its slice from the camera depth range.
+                // Cheap no-ops for non-clustered programs
+                program->SetUniform("u_cluster_depth", glm::vec2{ camera->near, camera->far });
+                glm::ivec2 targetSize = camera->outputTexture ?
+                    camera->outputTexture->GetSize() :
+                    glm::ivec2{ renderer.GetWidth(), renderer.GetHeight() };
+                program->SetUniform("u_screen_size", glm::vec2{ targetSize });
+
+                // legacy per-uniform upload for programs without the shared
+                // camera block
+                if (!program->HasCameraBlock()) {
+                    program->SetUniform("u_ambient_light", pass.cameraData.ambientLight);
+                    camera->SetProgram(*program);
+                    m_uniformUploadsIssued++;
+                }
+
+                state.camera = pass.cameraHash;
+            }
+
+            bool setLights = lightsChanged && !program->HasLightBlock();
+            if (lightsChanged && !setLights) state.lights = pass.lightHash;
+            if (setLights) {
+                program->SetUniform("u_numLights", (int)(m_renderQueue.lights.size()));
+
+                //light set
+
+                // cache the "u_lights[N]" names so the hot loop doesn't rebuild
+                // strings with operator+ every program/frame
+                static std::vector<std::string> lightNames;
+                while (lightNames.size() < m_renderQueue.lights.size()) {
+                    lightNames.push_back("u_lights[" + std::to_string(lightNames.size()) + "]");
+                }
+
+                int index = 0;
+                for (auto light : m_renderQueue.lights) {
+                    light->SetProgram(*program, lightNames[index++], camera->view);
+
+                }
+                state.lights = pass.lightHash;
+                m_uniformUploadsIssued++;
+            }
+        }
+
+        // overdraw heatmap (editor toggle) - replay every recorded command
+        // additively with depth testing off, each layer adding a constant
+        // increment so pixel brightness reads as shade count. Dynamic draws
+        // only; instanced/static batches use their own vertex paths
+        if (m_overdrawView && !camera->shadowCamera) {
+            auto overdrawProgram = Resources().Get<Program>("Shaders/overdraw.prog");
+
+            // view/projection come from the shared camera block uploaded above
+            overdrawProgram->Use();
+
+            glDisable(GL_DEPTH_TEST);
+            GLState::SetBlend(true);
+            glBlendFunc(GL_ONE, GL_ONE);
+
+            for (auto& command : pass.draws) {
+                overdrawProgram->SetUniform("u_model", command.modelMatrix);
+                GLState::SetCullFace(command.cullFace);
+                command.model->Draw(command.lod, GL_TRIANGLES);
+            }
+            for (auto& command : pass.transparentDraws) {
+                overdrawProgram->SetUniform("u_model", command.modelMatrix);
+                GLState::SetCullFace(command.cullFace);
+                command.model->Draw(command.lod, GL_TRIANGLES);
+            }
+
+            GLState::SetBlend(false);
+            glEnable(GL_DEPTH_TEST);
+            return;
+        }
+
+        // shadow passes composite over a cached static-geometry depth map:
+        // the static world re-renders into the cache only when the shadow
+        // camera or the static set changes, every other frame starts from a
+        // depth blit of the cache and plays back just the dynamic objects
+        bool staticDepthCached = false;
+        if (camera->shadowCamera && camera->outputTexture) {
+            if (m_staticBatchesDirty) {
+                m_staticBatcher.Build(*this);
+                m_staticBatchesDirty = false;
+                m_staticBatchVersion++;
+                m_lightMasksDirty = true;
+            }
+
+            // the cache is keyed per cascade on the shadow camera block
+            // contents (the crop matrices land there) and the static batch
+            // build - either changing invalidates that layer
+            int layer = math::max(pass.cascade, 0);
+            uint64_t key = HashBytes(&pass.cameraData, sizeof(pass.cameraData));
+            key = HashBytes(&m_staticBatchVersion, sizeof(m_staticBatchVersion), key);
+
+            auto& shadowMap = *camera->outputTexture;
+            if (!m_staticShadowMap) {
+                m_staticShadowMap = std::make_unique<RenderTexture>();
+                if (shadowMap.GetLayers() > 1) m_staticShadowMap->CreateDepthArray(shadowMap.GetSize().x, shadowMap.GetSize().y, shadowMap.GetLayers());
+                else m_staticShadowMap->CreateDepth(shadowMap.GetSize().x, shadowMap.GetSize().y);
+            }
+
+            if (key != m_staticShadowKeys[layer]) {
+                m_staticShadowKeys[layer] = key;
+
+                m_staticShadowMap->BindFramebufferLayer(layer);
+                GLState::SetDepthMask(true);
+                glClear(GL_DEPTH_BUFFER_BIT);
+                m_staticBatcher.Draw(pass.frustum);
+
+                shadowMap.BindFramebufferLayer(layer);
+            }
+
+            // seed this frame's shadow depth from the cache in place of the
+            // per-pass clear, the dynamic draws below composite over it
+            shadowMap.BlitDepthFrom(*m_staticShadowMap);
+            staticDepthCached = true;
+        }
+
+        // optional depth-only pre-pass ("depth_prepass") - lays opaque depth
+        // down through a null fragment program reusing the same vertex
+        // streams, so the shaded pass below pays fragment cost once per
+        // pixel instead of once per overlapping surface
+        if (m_depthPrePass && !camera->shadowCamera && !pass.draws.empty()) {
+            auto depthProgram = Resources().Get<Program>("Shaders/depth.prog");
+
+            // view/projection come from the shared camera block uploaded above
+            depthProgram->Use();
+
+            glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+            GLState::SetDepthMask(true);
+            for (auto& command : pass.draws) {
+                if (!command.depthMask) continue;
+
+                depthProgram->SetUniform("u_model", command.modelMatrix);
+                GLState::SetCullFace(command.cullFace);
+                command.model->Draw(command.lod, GL_TRIANGLES);
+            }
+            glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+
+            // the shaded pass re-draws the same geometry at equal depth
+            glDepthFunc(GL_LEQUAL);
+        }
+
+        // playback - bind the material (program + textures) only when it
+        // changes between commands instead of once per actor; each material
+        // run is also a debug group, so captures show the draws batched the
+        // way the sort produced them
+        Material* lastMaterial = nullptr;
+        GLuint lastEnvironment = 0;
+        for (auto& command : pass.draws) {
+            if (command.material != lastMaterial) {
+                if (lastMaterial) GLDebug::PopGroup();
+                if (command.material) {
+                    GLDebug::PushGroup(command.material->name.c_str());
+                    command.material->Bind();
+                }
+                lastMaterial = command.material;
+
+                // the material bind restored its authored cube map
+                lastEnvironment = 0;
+            }
+            if (command.material && command.material->program) {
+                command.material->program->SetUniform("u_model", command.modelMatrix);
+                command.material->program->SetUniform("u_light_mask", (int)command.lightMask);
+            }
+
+            // nearest-probe override on the cube unit - the authored map
+            // rebinds when a probed run ends; GLState filters redundancy
+            if (command.environment != lastEnvironment) {
+                GLState::SetActiveTexture(GL_TEXTURE4);
+                GLState::BindTexture(GL_TEXTURE_CUBE_MAP, command.environment ? command.environment :
+                    ((command.material && command.material->cubeMap) ? command.material->cubeMap->m_texture : 0));
+                lastEnvironment = command.environment;
+            }
+
+            // skinned draws refresh the shared palette SSBO - the cost is
+            // one orphaned upload, the submission path is otherwise
+            // identical to a rigid draw
+            if (command.palette) UploadSkinPalette(command.palette, command.paletteCount);
+
+            GLState::SetDepthMask(command.depthMask);
+            GLState::SetCullFace(command.cullFace);
+
+            command.model->Draw(command.lod, GL_TRIANGLES);
+        }
+        if (lastMaterial) GLDebug::PopGroup();
+
+        // one instanced draw per recorded Model+Material batch
+        for (auto& batch : pass.batches) {
+            GLDebug::Scope group(batch.material->name.c_str());
+            batch.material->Bind();
+            batch.model->SetInstanceData(batch.transforms.data(), batch.transforms.size());
+            batch.model->DrawInstanced((GLsizei)batch.transforms.size());
+        }
+
+        // terrain and crowds draw with the opaques against this pass's
+        // camera - terrain selects its quadtree node set, each visible
+        // crowd is one baked instanced draw plus a few promoted near-agent
+        // skinned draws. Shadow passes skip both like particles
+        if (!camera->shadowCamera) {
+            glm::vec3 viewPosition = glm::vec3(glm::inverse(pass.cameraData.view)[3]);
+
+            for (auto terrain : GetActorComponents<TerrainRenderer>()) {
+                if (!pass.frustum.Intersects(terrain->GetWorldBounds())) continue;
+                terrain->Draw(renderer, pass.frustum, viewPosition);
+            }
+
+            for (auto crowd : GetActorComponents<CrowdComponent>()) {
+                if (!pass.frustum.Intersects(crowd->GetWorldBounds())) continue;
+                crowd->Draw(renderer, pass.frustum, viewPosition);
+            }
+        }
+
+        // static world playback - merged per material at load, culled per
+        // draw into the persistently-mapped command ring, one indirect call
+        // per material
+        if (m_staticBatchesDirty) {
+            m_staticBatcher.Build(*this);
+            m_staticBatchesDirty = false;
+            m_staticBatchVersion++;
+            m_lightMasksDirty = true;
+        }
+
+        // re-bake the per-draw light masks when the light set or the batch
+        // build changed - reach tests against bounds already sitting in the
+        // batcher, uploaded once as an immutable SSBO. In static lighting
+        // setups this runs exactly once at load
+        if (m_lightMasksDirty) {
+            m_staticBatcher.BakeLightMasks(m_renderQueue.lights);
+            m_lightMasksDirty = false;
+        }
+
+        if (!staticDepthCached) m_staticBatcher.Draw(pass.frustum);
+
+        // sky stage: after every opaque so covered pixels reject at the
+        // depth test instead of shading twice - the sky vertex shader pins
+        // its depth to the far plane, GL_LEQUAL lets it pass against the
+        // depth clear where nothing drew
+        if (!camera->shadowCamera && !pass.skyDraws.empty()) {
+            GLDebug::Scope group("Sky");
+            glDepthFunc(GL_LEQUAL);
+            GLState::SetDepthMask(false);
+
+            for (auto& command : pass.skyDraws) {
+                command.material->Bind();
+                if (command.material->program) {
+                    command.material->program->SetUniform("u_model", command.modelMatrix);
+                }
+                GLState::SetCullFace(command.cullFace);
+                command.model->Draw(command.lod, GL_TRIANGLES);
+            }
+
+            GLState::SetDepthMask(true);
+            if (!m_depthPrePass) glDepthFunc(GL_LESS);
+        }
+
+        // transparents draw last, back to front over the opaque result,
+        // alpha blending with depth writes off so they never occlude
+        if (!camera->shadowCamera && !pass.transparentDraws.empty()) {
+            GLState::SetBlend(true);
+            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+            GLState::SetDepthMask(false);
+
+            lastMaterial = nullptr;
+            lastEnvironment = 0;
+            for (auto& command : pass.transparentDraws) {
+                if (command.material != lastMaterial) {
+                    if (lastMaterial) GLDebug::PopGroup();
+                    if (command.material) {
+                        GLDebug::PushGroup(command.material->name.c_str());
+                        command.material->Bind();
+                    }
+                    lastMaterial = command.material;
+                    lastEnvironment = 0;
+                }
+                if (command.material && command.material->program) {
+                    command.material->program->SetUniform("u_model", command.modelMatrix);
+                    command.material->program->SetUniform("u_light_mask", (int)command.lightMask);
+                }
+
+                if (command.environment != lastEnvironment) {
+                    GLState::SetActiveTexture(GL_TEXTURE4);
+                    GLState::BindTexture(GL_TEXTURE_CUBE_MAP, command.environment ? command.environment :
+                        ((command.material && command.material->cubeMap) ? command.material->cubeMap->m_texture : 0));
+                    lastEnvironment = command.environment;
+                }
+
+                if (command.palette) UploadSkinPalette(command.palette, command.paletteCount);
+
+                GLState::SetCullFace(command.cullFace);
+                command.model->Draw(command.lod, GL_TRIANGLES);
+            }
+            if (lastMaterial) GLDebug::PopGroup();
+
+            GLState::SetBlend(false);
+            GLState::SetDepthMask(true);
+        }
+
+        // particle systems blend over the shaded result last - each visible
+        // emitter is one simulation dispatch and one instanced draw
+        if (!camera->shadowCamera) {
+            for (auto particles : GetActorComponents<ParticleSystemComponent>()) {
+                if (!pass.frustum.Intersects(particles->GetWorldBounds())) continue;
+                particles->Draw(renderer);
+            }
+        }
+    }
+
+    void Scene::CaptureReflectionProbes(Renderer& renderer) {
+        auto probes = GetActorComponents<ReflectionProbeComponent>();
+
+        ReflectionProbeComponent* pending = nullptr;
+        for (auto probe : probes) {
+            if (probe->active && !probe->IsCaptured()) {
+                pending = probe;
+                break;
+            }
+        }
+        if (!pending) return;
+
+        PROFILE_SCOPE("Scene::CaptureReflectionProbes");
+        GLDebug::Scope group("Reflection Probe Capture");
 
-        //light
         auto lights = GetActorComponents<LightComponent>();
+        std::erase_if(lights, [](auto light) { return light->baked; });
 
-        //camera
-        auto cameras = GetActorComponents<CameraComponent>();
+        // scratch capture rig - the probe's faces record and play back
+        // through the same path as authored cameras, so culling, sorting
+        // and the uniform block plumbing all apply unchanged
+        Actor rig;
+        rig.transform.position = pending->owner->transform.position;
 
-        if (cameras.empty()) {
-            LOG_WARNING("No active camera was found in scene.");
-            return;
+        CameraComponent camera;
+        camera.owner = &rig;
+        camera.fov = 90;
+        camera.aspect = 1;
+        camera.near = 0.1f;
+        camera.far = math::max(pending->radius * 4, 100.0f);
+        camera.projection = glm::perspective(glm::radians(camera.fov), camera.aspect, camera.near, camera.far);
+
+        // all six face frusta cull in one shared BVH traversal, same as the
+        // main passes
+        glm::mat4 views[6];
+        frame_vector<Frustum> frusta;
+        for (int face = 0; face < 6; face++) {
+            views[face] = pending->GetFaceView(face);
+            frusta.push_back(Frustum::FromMatrix(camera.projection * views[face]));
         }
+        auto visibleSets = m_bvh.QueryFrustums(frusta);
 
-        // get programs
-        std::set<Program*> programSet;
+        for (int face = 0; face < 6; face++) {
+            camera.view = views[face];
 
-        for (auto& actor : m_actors) {
-            auto model = actor->GetComponent<ModelRenderer>();
-            // Skip if there's no model component or the model is not active
-            if (!model || !model->active) {
-                continue;
-            }
-            if (model->material && model->material->program) {
-                programSet.insert(model->material->program.get());
-            }
+            RenderPass pass;
+            RecordPass(pass, lights, &camera, visibleSets[face]);
+
+            if (!pending->BeginCaptureFace(face)) return;
+            PlaybackPass(renderer, pass);
         }
+        pending->EndCapture();
 
-        std::vector<Program*> programs(programSet.begin(), programSet.end());
+        // back to the default target for the frame's own passes
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glViewport(0, 0, renderer.GetWidth(), renderer.GetHeight());
+    }
 
-        // set shadow view projection
-        auto shadowCamera = std::find_if(cameras.begin(), cameras.end(),
-            [](auto camera) { return camera->shadowCamera; });
-        if (*shadowCamera) {
-            glm::mat4 biasMatrix(
-                0.5, 0.0, 0.0, 0.0,
-                0.0, 0.5, 0.0, 0.0,
-                0.0, 0.0, 0.5, 0.0,
-                0.5, 0.5, 0.5, 1.0
-            );
-            glm::mat4 shadowvp = biasMatrix * (*shadowCamera)->projection * (*shadowCamera)->view;
-            for (auto& program : programs) {
-                program->Use();
-                program->SetUniform("u_shadow_vp", shadowvp);
+    /// <summary>
+    /// Kicks RecordDraw onto a job system worker. Recording only reads the
+    /// transform cache and BVH snapshots produced by Update(), so it can
+    /// overlap main-thread work that doesn't add or destroy actors (GUI,
+    /// event polling); Draw() waits for the job before playback.
+    /// </summary>
+    void Scene::RecordDrawAsync() {
+        // no workers - record inline when Draw consumes the queue
+        if (GetEngine().GetJobSystem().GetWorkerCount() == 0) return;
+
+        m_recordDone = false;
+        m_recordPending = true;
+
+        GetEngine().GetJobSystem().Submit([this]() {
+            RecordDraw();
+
+            {
+                std::lock_guard<std::mutex> lock(m_recordMutex);
+                m_recordDone = true;
             }
+            m_recordCondition.notify_one();
+        });
+    }
+
+    /// <summary>
+    /// Blocks until an in-flight async record finishes, or records inline
+    /// when none was kicked this frame.
+    /// </summary>
+    void Scene::WaitForRecord() {
+        if (!m_recordPending) {
+            RecordDraw();
+            return;
         }
 
-        for (auto& camera : cameras) {
-            PostProcessComponent* postprocessComponent = camera->owner->GetComponent<PostProcessComponent>();
-            bool renderToTexture = camera->outputTexture && (!postprocessComponent || (postprocessComponent && m_postprocess));
+        PROFILE_SCOPE("Scene::WaitForRecord");
+        std::unique_lock<std::mutex> lock(m_recordMutex);
+        m_recordCondition.wait(lock, [this]() { return m_recordDone; });
+        m_recordPending = false;
+    }
 
-            if (renderToTexture) {
-                camera->outputTexture->BindFramebuffer();
-                glViewport(0, 0, camera->outputTexture->GetSize().x, camera->outputTexture->GetSize().y);
-            }
-            camera->Clear();
+    void Scene::WarmupDraws() {
+        auto modelRenderers = GetActorComponents<ModelRenderer>();
+        if (modelRenderers.empty()) return;
+
+        // a 2x2 target with depth - the draws need a complete framebuffer
+        // with the states the real passes use, not visible output
+        if (!m_warmupTarget) {
+            m_warmupTarget = std::make_unique<RenderTexture>();
+            m_warmupTarget->Create(2, 2, true);
+        }
+        m_warmupTarget->BindFramebuffer();
+        glViewport(0, 0, 2, 2);
 
+        // one draw per unique program/vertex-format pair - duplicates across
+        // renderers and LODs collapse, uniform contents don't matter for
+        // specialization so whatever the material uploads is fine
+        std::unordered_set<uint64_t> warmed;
+        for (auto modelRenderer : modelRenderers) {
+            if (!modelRenderer->model || !modelRenderer->material || !modelRenderer->material->program) continue;
 
-            DrawPass(renderer, programs, lights, camera);
-            if (renderToTexture) {
-                camera->outputTexture->UnbindFramebuffer();
-                glViewport(0, 0, renderer.GetWidth(), renderer.GetHeight());
-            }
+            Program* program = modelRenderer->material->program.get();
+            bool bound = false;
 
-            if (renderToTexture && postprocessComponent) {
-                camera->Clear();
+            for (auto& vertexBuffer : modelRenderer->model->GetVertexBuffers()) {
+                if (!vertexBuffer) continue;
+
+                uint64_t key = (uint64_t)program->m_program * 1099511628211ull ^ vertexBuffer->GetFormatKey();
+                if (!warmed.insert(key).second) continue;
 
-                auto postProcessProgram = Resources().Get<Program>("Shaders/postprocess.prog");
-                postProcessProgram->Use();
-                postprocessComponent->Apply(*postProcessProgram);
-                camera->outputTexture->Bind();
-                auto actor = GetActorByName("postprocess");
-                actor->Draw(renderer);
+                // bind lazily - fully-duplicate renderers skip the material too
+                if (!bound) {
+                    modelRenderer->material->Bind();
+                    bound = true;
+                }
+                GLState::SetDepthMask(modelRenderer->enableDepth);
+                GLState::SetCullFace(modelRenderer->cullFace);
+                vertexBuffer->DrawWarmup();
             }
         }
-       
-   }
 
-    void Scene::DrawPass(Renderer& renderer, 
-        std::vector<Program*> programs, 
-        std::vector<LightComponent*> lights, 
-        CameraComponent* camera)
-    {
-        for (auto& program : programs) {
-            program->Use();
-            program->SetUniform("u_ambient_light", m_ambientLight);
-            program->SetUniform("u_numLights", (int)(lights.size()));
-            camera->SetProgram(*program);
+        m_warmupTarget->UnbindFramebuffer();
+
+        // the next real pass sets its own viewport; restore anyway so GUI
+        // drawn before it isn't clipped to the warmup target
+        auto& renderer = GetEngine().GetRenderer();
+        glViewport(0, 0, renderer.GetWidth(), renderer.GetHeight());
+
+        if (!warmed.empty()) {
+            LOG_CAT_INFO(Scene, "Warmed {} program/vertex-format combinations", warmed.size());
+        }
+    }
+
+    void Scene::ValidateContentBudgets(const std::string& sceneName) {
+        // skip the walk entirely when no budgets are declared
+        if (!ContentBudgets::IsEnabled()) return;
 
-            //light set
+        // distinct textures only - materials sharing a map charge it once,
+        // same as the GPU does
+        std::unordered_set<Texture*> textures;
+        size_t textureBytes = 0;
+        size_t drawEstimate = 0;
 
-            int index = 0;
-            for (auto light : lights) {
-                std::string lightName = "u_lights[" + std::to_string(index++) + "]";
-                light->SetProgram(*program, lightName, camera->view);
+        // distinct audio clips the same way - sizes are seeded from the
+        // (cooked) file at open and tightened once FMOD's async open
+        // finishes, and streamed clips charge nothing
+        std::unordered_set<AudioClip*> clips;
+        size_t audioBytes = 0;
 
+        for (auto emitter : GetActorComponents<AudioEmitterComponent>()) {
+            AudioClip* clip = emitter->clip.get();
+            if (clip && clips.insert(clip).second) {
+                audioBytes += clip->GetMemorySize();
             }
         }
 
-        // Iterate through all actors in the scene
-        for (auto& actor : m_actors) {
-            if (actor->active) {
-                actor->Draw(renderer);
+        for (auto modelRenderer : GetActorComponents<ModelRenderer>()) {
+            if (modelRenderer->model) drawEstimate += modelRenderer->model->GetVertexBuffers().size();
+
+            Material* material = modelRenderer->material.get();
+            if (!material) continue;
+
+            for (Texture* texture : { material->baseMap.get(), material->specularMap.get(),
+                material->emissiveMap.get(), material->normalMap.get(),
+                material->cubeMap.get(), material->lightMap.get() }) {
+                if (texture && textures.insert(texture).second) {
+                    textureBytes += texture->GetMemorySize();
+                }
             }
         }
+
+        ContentBudgets::ReportScene(sceneName, textureBytes, audioBytes, drawEstimate);
+    }
+
+    Scene::ray_query_t Scene::QueryRayBatch(const RayQuery& query) {
+        // submissions come from the parallel actor update - the lock only
+        // guards the append, resolution happens after the update joins
+        std::lock_guard<std::mutex> lock(m_rayQueryMutex);
+        m_rayQueries.push_back(query);
+        return (ray_query_t)(m_rayQueries.size() - 1);
+    }
+
+    frame_vector<Actor*> Scene::GetRayQueryResult(ray_query_t id) {
+        frame_vector<Actor*> actors;
+        if (id >= (ray_query_t)m_rayResults.size()) return actors;
+
+        // handles filter out actors destroyed since the batch resolved
+        actors.reserve(m_rayResults[id].size());
+        for (auto handle : m_rayResults[id]) {
+            if (Actor* actor = m_actors.Get(handle)) actors.push_back(actor);
+        }
+
+        return actors;
+    }
+
+    void Scene::ResolveRayQueries() {
+        // last frame's results are overwritten here - their polling window
+        // (the update phase just finished) is over
+        m_rayResults.assign(m_rayQueries.size(), {});
+        if (m_rayQueries.empty()) return;
+
+        PROFILE_SCOPE("Scene::ResolveRayQueries");
+
+        // each job walks the BVH for its rays; results store as handles so
+        // they stay safe to poll across the frame boundary
+        GetEngine().GetJobSystem().ParallelFor(m_rayQueries.size(), 8, [this](size_t index) {
+            const RayQuery& query = m_rayQueries[index];
+            auto hits = m_bvh.QueryRay(query.origin, query.direction, query.maxDistance);
+
+            auto& result = m_rayResults[index];
+            result.reserve(hits.size());
+            for (auto actor : hits) result.push_back(actor->handle);
+        });
+
+        // completion callbacks run on the main thread once the whole batch
+        // is resolved, with every hit actor still alive this frame
+        for (size_t index = 0; index < m_rayQueries.size(); index++) {
+            if (!m_rayQueries[index].callback) continue;
+            m_rayQueries[index].callback(GetRayQueryResult((ray_query_t)index));
+        }
+
+        m_rayQueries.clear();
     }
 
     /// <summary>
@@ -207,23 +1673,214 @@ namespace neu {
     /// </summary>
     /// <param name="actor">A unique pointer to the actor to be added. Ownership of the actor is transferred to the scene.</param>
     /// <param name="start">Whether to immediately call Start() on the actor for initialization</param>
-    void Scene::AddActor(std::unique_ptr<Actor> actor, bool start) {
+    /// <returns>Pointer to the pooled actor, stable until it is destroyed</returns>
+    Actor* Scene::AddActor(std::unique_ptr<Actor> actor, bool start) {
         // Validate that we're not trying to add a null pointer
         // ASSERT_MSG will help catch bugs during development
         ASSERT_MSG(actor, "Attempted to add null actor to scene");
 
+        // While the update loop iterates the pool, record the spawn instead
+        // of inserting under the iteration - the batch is applied right
+        // after the loop. The staged shell is handed back so the caller can
+        // keep configuring it; the scene back-reference is set now so that
+        // configuration can already reach the scene
+        if (m_updating) {
+            actor->scene = this;
+            Actor* staged = actor.get();
+
+            std::lock_guard<std::mutex> lock(m_spawnMutex);
+            m_spawnQueue.push_back({ std::move(actor), start });
+            return staged;
+        }
+
+        return CommitActor(std::move(actor), start);
+    }
+
+    /// <summary>
+    /// Commits an actor shell to the pool: the immediate half of AddActor,
+    /// also run per queued spawn by ApplySpawns().
+    /// </summary>
+    /// <param name="actor">Actor shell to move into pooled storage</param>
+    /// <param name="start">Whether to call Start() once the actor is wired in</param>
+    /// <returns>Pointer to the pooled actor, stable until it is destroyed</returns>
+    Actor* Scene::CommitActor(std::unique_ptr<Actor> actor, bool start) {
+        // Move the actor into a pool slot first - the heap-side shell from
+        // the factory dies here, the pooled copy is the live object and the
+        // pool stamps its generational handle
+        Actor* pooled = m_actors.Create(std::move(*actor));
+        actor.reset();
+
         // Establish back-reference from actor to scene
         // This allows actors to query the scene, find other actors, etc.
-        actor->scene = this;
+        pooled->scene = this;
+
+        // Enter the actor's components into the typed registries now that
+        // the scene back-reference exists
+        pooled->RegisterComponents();
+
+        // Enter the stamped handle into the name/tag lookup indices
+        IndexActor(pooled);
+
+        // Enter the dynamic update partition - static actors stay out and
+        // are never visited by the update loop
+        if (!pooled->isStatic) {
+            m_dynamicActors.push_back(pooled->handle);
+            pooled->inUpdateList = true;
+        }
 
         // Optionally initialize the actor immediately
-        // During batch loading, we skip Start() and call it later for all actors
-        if (start) actor->Start();
+        // During batch loading, we skip Start() and call it later for all
+        // actors. A re-armed recycle-pool actor gets Reset() instead -
+        // its components already ran their first Start
+        if (pooled->recycled) pooled->Reset();
+        else if (start) pooled->Start();
+
+        return pooled;
+    }
+
+    /// <summary>
+    /// Spawns an actor from a registered prototype on the fast path.
+    ///
+    /// The regular spawn route (Factory::Create + AddActor) clones the
+    /// prototype into a heap-allocated shell and then moves it into a pool
+    /// slot. Here the prototype copy-constructs directly into the slot, so
+    /// a spawn costs one deep copy - no intermediate actor, no move, no
+    /// shell deallocation. Wave spawners hitting this every frame only pay
+    /// for the component clones themselves.
+    /// </summary>
+    /// <param name="name">Name of the registered prototype to spawn</param>
+    /// <returns>Pointer to the spawned actor, or nullptr on failure</returns>
+    Actor* Scene::Instantiate(const std::string& name) {
+        // a parked actor of this prototype beats any clone path
+        if (Actor* recycledActor = SpawnFromRecyclePool(name, nullptr)) return recycledActor;
+
+        Actor* prototype = Factory::Instance().GetPrototype<Actor>(name);
+        if (!prototype || m_updating) {
+            // not registered as a prototype (or mid-update, where the copy
+            // can't land in the pool yet) - take the factory + AddActor
+            // path, which records into the spawn queue during update
+            auto actor = Factory::Instance().Create<Actor>(name);
+            if (!actor) return nullptr;
+            actor->spawnPrototype = name;
+            return AddActor(std::move(actor));
+        }
+
+        // deep copy straight into pooled storage
+        Actor* pooled = m_actors.Create(*prototype);
+        pooled->scene = this;
+        pooled->spawnPrototype = name;
+        pooled->RegisterComponents();
+        IndexActor(pooled);
+        if (!pooled->isStatic) {
+            m_dynamicActors.push_back(pooled->handle);
+            pooled->inUpdateList = true;
+        }
+        pooled->Start();
+
+        return pooled;
+    }
+
+    /// <summary>
+    /// Spawns an actor from a registered prototype with the given transform
+    /// applied before Start() runs.
+    /// </summary>
+    /// <param name="name">Name of the registered prototype to spawn</param>
+    /// <param name="transform">Transform for the spawned actor</param>
+    /// <returns>Pointer to the spawned actor, or nullptr on failure</returns>
+    Actor* Scene::Instantiate(const std::string& name, const Transform& transform) {
+        // a parked actor of this prototype beats any clone path
+        if (Actor* recycledActor = SpawnFromRecyclePool(name, &transform)) return recycledActor;
+
+        Actor* prototype = Factory::Instance().GetPrototype<Actor>(name);
+        if (!prototype || m_updating) {
+            auto actor = Factory::Instance().Create<Actor>(name);
+            if (!actor) return nullptr;
+            actor->transform = transform;
+            actor->spawnPrototype = name;
+            return AddActor(std::move(actor));
+        }
+
+        Actor* pooled = m_actors.Create(*prototype);
+        pooled->scene = this;
+        pooled->transform = transform;
+        pooled->spawnPrototype = name;
+        pooled->RegisterComponents();
+        IndexActor(pooled);
+        if (!pooled->isStatic) {
+            m_dynamicActors.push_back(pooled->handle);
+            pooled->inUpdateList = true;
+        }
+        pooled->Start();
 
-        // Transfer ownership to the scene's container
-        // std::move is required to transfer unique_ptr ownership
-        // push_back adds to the end of the list
-        m_actors.push_back(std::move(actor));
+        return pooled;
+    }
+
+    /// <summary>
+    /// Pulls a parked actor from the prototype's recycle pool and re-arms
+    /// it - the fast half of Instantiate. Outside the update phase the
+    /// actor moves straight into a pool slot, re-enters the registries and
+    /// indices, and Reset() rewinds its components; mid-update the re-arm
+    /// is staged through the spawn queue like any other spawn, with the
+    /// recycled flag routing CommitActor to Reset() instead of Start().
+    /// </summary>
+    /// <param name="name">Prototype name being instantiated</param>
+    /// <param name="transform">Optional transform applied before Reset()</param>
+    /// <returns>The re-armed (or staged) actor, or nullptr when the pool has none</returns>
+    Actor* Scene::SpawnFromRecyclePool(const std::string& name, const Transform* transform) {
+        if (m_updating) {
+            // worker threads race each other for the pool's last entry -
+            // the spawn mutex already serializes this path's tail, so take
+            // it for the whole operation
+            std::lock_guard<std::mutex> lock(m_spawnMutex);
+
+            auto iter = m_recyclePools.find(name);
+            if (iter == m_recyclePools.end() || iter->second.empty()) return nullptr;
+
+            auto actor = std::move(iter->second.back());
+            iter->second.pop_back();
+            if (transform) actor->transform = *transform;
+            actor->scene = this;
+
+            Actor* staged = actor.get();
+            m_spawnQueue.push_back({ std::move(actor), false });
+            return staged;
+        }
+
+        auto iter = m_recyclePools.find(name);
+        if (iter == m_recyclePools.end() || iter->second.empty()) return nullptr;
+
+        auto actor = std::move(iter->second.back());
+        iter->second.pop_back();
+        if (transform) actor->transform = *transform;
+
+        // same wiring as CommitActor, with Reset() in place of Start()
+        Actor* pooled = m_actors.Create(std::move(*actor));
+        pooled->scene = this;
+        pooled->RegisterComponents();
+        IndexActor(pooled);
+        if (!pooled->isStatic) {
+            m_dynamicActors.push_back(pooled->handle);
+            pooled->inUpdateList = true;
+        }
+        pooled->Reset();
+
+        return pooled;
+    }
+
+    /// <summary>
+    /// Returns an instantiated actor to its prototype's recycle pool
+    /// instead of destroying it. Flag-only like Destroy - the cleanup
+    /// phase runs Destroyed() and releases the slot, then parks the actor
+    /// object for the next Instantiate of the same prototype. Actors
+    /// without a spawn prototype destroy outright.
+    /// </summary>
+    /// <param name="actor">Actor to recycle (null is ignored)</param>
+    void Scene::Recycle(Actor* actor) {
+        if (!actor) return;
+
+        // nothing to pool against - a plain destroy
+        if (!actor->spawnPrototype.empty()) actor->recycled = true;
+        actor->destroyed = true;
     }
 
     /// <summary>
@@ -236,7 +1893,7 @@ namespace neu {
     /// Removal logic:
     /// - Non-persistent actors are always removed
     /// - Persistent actors are only removed if force=true
-    /// - Uses iterator-based removal for safe container modification
+    /// - Collects victims first, then destroys through the pool
     /// 
     /// Common use cases:
     /// - Scene transitions where some objects should carry over
@@ -245,51 +1902,267 @@ namespace neu {
     /// </summary>
     /// <param name="force">If true, removes all actors regardless of persistence; if false, preserves persistent actors</param>
     void Scene::RemoveAllActors(bool force) {
-        // Use manual iterator loop for conditional removal
-        // std::erase_if can't be used here due to complex removal logic
-        for (auto iter = m_actors.begin(); iter != m_actors.end(); ) {
+        // Collect first so pool slots aren't recycled mid-iteration
+        frame_vector<Actor*> removed;
+        for (auto actor : m_actors) {
             // Determine if this actor should be removed
             // Remove if: not persistent OR force removal is requested
-            if (!(*iter)->persistent || force) {
-                // Call Destroyed() on the actor before removing it
-                // This allows the actor to clean up resources, save state, etc.
-                (*iter)->Destroyed();
+            if (!actor->persistent || force) removed.push_back(actor);
+        }
+
+        for (auto actor : removed) {
+            // Call Destroyed() on the actor before removing it
+            // This allows the actor to clean up resources, save state, etc.
+            actor->Destroyed();
+            UnindexActor(actor);
+            m_actors.Destroy(actor);
+        }
+
+        // parked recycle-pool actors belong to the outgoing content set -
+        // scene transitions drop them with everything else
+        m_recyclePools.clear();
+    }
 
-                // erase() invalidates current iterator but returns next valid iterator
-                // This allows us to continue iteration safely
-                iter = m_actors.erase(iter);
+    /// <summary>
+    /// Enters an actor's handle into the name and tag indices.
+    ///
+    /// Keyed by the actor's interned name/tag at add time; runtime renames
+    /// aren't re-indexed. Empty names and tags are skipped, so anonymous
+    /// actors cost the indices nothing.
+    /// </summary>
+    /// <param name="actor">Pooled actor whose handle has been stamped</param>
+    void Scene::IndexActor(Actor* actor) {
+        if (!actor->name.empty()) m_nameIndex[actor->name].push_back(actor->handle);
+        if (!actor->tag.empty()) m_tagIndex[actor->tag].push_back(actor->handle);
+    }
+
+    /// <summary>
+    /// Removes an actor's handle from the name and tag indices.
+    ///
+    /// Called on every destroy path before the pool slot is released.
+    /// Empties map entries are dropped so stale keys don't accumulate
+    /// across scene churn.
+    /// </summary>
+    /// <param name="actor">Actor about to be released back to the pool</param>
+    void Scene::UnindexActor(Actor* actor) {
+        if (!actor->name.empty()) {
+            auto iter = m_nameIndex.find(actor->name);
+            if (iter != m_nameIndex.end()) {
+                std::erase(iter->second, actor->handle);
+                if (iter->second.empty()) m_nameIndex.erase(iter);
             }
-            else {
-                // This actor survives - manually advance to next
-                // Don't use iter++ in the for loop due to conditional advancement
-                iter++;
+        }
+        if (!actor->tag.empty()) {
+            auto iter = m_tagIndex.find(actor->tag);
+            if (iter != m_tagIndex.end()) {
+                std::erase(iter->second, actor->handle);
+                if (iter->second.empty()) m_tagIndex.erase(iter);
             }
         }
     }
 
+    /// <summary>
+    /// Finds an actor by name and returns its generational handle.
+    ///
+    /// Unlike GetActorByName, the result stays safe to hold across frames -
+    /// resolve it through GetActor each time the actor is needed, and a
+    /// nullptr result means the actor has since been destroyed.
+    /// </summary>
+    /// <param name="name">Name to search for (case-insensitive)</param>
+    /// <returns>The actor's handle, or an invalid handle if not found</returns>
+    ActorHandle Scene::GetActorHandleByName(const InternedString& name) {
+        // one hash lookup against the name index instead of a scan
+        auto iter = m_nameIndex.find(name);
+        if (iter != m_nameIndex.end()) {
+            for (auto handle : iter->second) {
+                if (m_actors.Get(handle)) return handle;
+            }
+        }
+
+        return {};
+    }
+
+    /// <summary>
+    /// Adds a component to the typed registry for its class.
+    ///
+    /// Components without a type id (not created through the Factory) are
+    /// skipped - they still work through the actor-level queries, they just
+    /// don't appear in scene-wide component slices.
+    /// </summary>
+    /// <param name="component">Component entering the scene</param>
+    void Scene::RegisterComponent(Component* component) {
+        if (component->typeId == invalidComponentType) return;
+
+        // grow the registry to cover every type id assigned so far
+        if (component->typeId >= (component_type_t)m_componentsByType.size()) {
+            m_componentsByType.resize(ComponentType::Count());
+        }
+
+        m_componentsByType[component->typeId].push_back(component);
+
+        if (component->typeId == ComponentType::Id<ModelRenderer>()) {
+            auto model = static_cast<ModelRenderer*>(component);
+
+            // a static renderer entering the scene invalidates the merged
+            // static batches until the next draw rebuilds them
+            if (model->isStatic) m_staticBatchesDirty = true;
+
+            // take a reference on the renderer's program so the distinct
+            // set stays current without a per-frame actor walk
+            if (model->material) AddProgramRef(model->material->program.get());
+        }
+    }
+
+    /// <summary>
+    /// Removes a component from its typed registry.
+    /// </summary>
+    /// <param name="component">Component leaving the scene</param>
+    void Scene::UnregisterComponent(Component* component) {
+        if (component->typeId == invalidComponentType) return;
+        if (component->typeId >= (component_type_t)m_componentsByType.size()) return;
+
+        std::erase(m_componentsByType[component->typeId], component);
+
+        if (component->typeId == ComponentType::Id<ModelRenderer>()) {
+            auto model = static_cast<ModelRenderer*>(component);
+
+            if (model->isStatic) m_staticBatchesDirty = true;
+            if (model->material) RemoveProgramRef(model->material->program.get());
+        }
+    }
+
+    /// <summary>
+    /// Takes a reference on a program in the scene's distinct-program set.
+    /// Called when a ModelRenderer registers and when the editor swaps a
+    /// material; the cached list rebuilds lazily on the next Record().
+    /// </summary>
+    /// <param name="program">Program gaining a renderer (null is ignored)</param>
+    void Scene::AddProgramRef(Program* program) {
+        if (!program) return;
+
+        if (++m_programRefs[program] == 1) m_programListDirty = true;
+    }
+
+    /// <summary>
+    /// Drops a reference on a program in the distinct-program set, removing
+    /// it from the cached list once no renderer uses it.
+    /// </summary>
+    /// <param name="program">Program losing a renderer (null is ignored)</param>
+    void Scene::RemoveProgramRef(Program* program) {
+        if (!program) return;
+
+        auto it = m_programRefs.find(program);
+        if (it == m_programRefs.end()) return;
+
+        if (--it->second == 0) {
+            m_programRefs.erase(it);
+            m_programListDirty = true;
+        }
+    }
+
     bool Scene::Start() {
         // Initialize all actors after the scene is fully constructed
         // This ensures all actors exist before any Start() methods run
         // allowing actors to safely find and reference other actors
-        for (auto& actor : m_actors) {
-            // Call each actor's initialization routine
-            actor->Start();
+        std::vector<Actor*> actors;
+        for (auto actor : m_actors) {
+            actors.push_back(actor);
         }
+        StartActors(actors);
 
         // Return success - could be extended to handle initialization failures
         return true;
     }
 
+    void Scene::StartActors(const std::vector<Actor*>& actors) {
+        PROFILE_SCOPE("Scene::StartActors");
+
+        // partition by declaration, preserving scene order within each
+        // phase - the common case (no parent, no lifespan, no serialStart
+        // component) lands in the parallel set
+        std::vector<Actor*> parallel;
+        std::vector<Actor*> serial;
+        parallel.reserve(actors.size());
+        for (auto actor : actors) {
+            if (actor->CanStartParallel()) parallel.push_back(actor);
+            else serial.push_back(actor);
+        }
+
+        // parallel phase: each Start touches only its own actor and the
+        // thread-safe resource cache, so batches need no Defer(). Spawning
+        // or timer scheduling from here would race - components doing that
+        // declare serialStart and land in the phase below
+        if (parallel.size() > 1) {
+            GetEngine().GetJobSystem().ParallelFor(parallel.size(), kUpdateBatchSize,
+                [&parallel](size_t index) {
+                    parallel[index]->Start();
+                });
+        }
+        else {
+            for (auto actor : parallel) actor->Start();
+        }
+
+        // serial phase: scene order, after every parallel actor exists and
+        // is initialized - parent-name resolution and lifespan scheduling
+        // see the finished batch
+        for (auto actor : serial) {
+            actor->Start();
+        }
+    }
+
     void Scene::Destroyed() {
+        // an async record job still reading scene state must finish before
+        // anything below tears that state down
+        if (m_recordPending) WaitForRecord();
+
         // Notify all actors that the scene is being destroyed
         // Gives actors a chance to clean up resources, save state, etc.
-        for (auto& actor : m_actors) {
+        for (auto actor : m_actors) {
             actor->Destroyed();
         }
 
-        // Clear the actor container
-        // unique_ptr ensures all actors are properly deleted
-        m_actors.clear();
+        // Clear the actor container - the pool destroys every live actor
+        // and releases its blocks - and drop the spatial structures with it
+        m_actors.Clear();
+        m_bvh.Clear();
+        m_zones.Clear();
+        m_transformCache.Clear();
+        m_nameIndex.clear();
+        m_tagIndex.clear();
+        m_dynamicActors.clear();
+        m_timers.Clear();
+
+        // drop spawns still staged in the queue - their shells free here
+        {
+            std::lock_guard<std::mutex> lock(m_spawnMutex);
+            m_spawnQueue.clear();
+        }
+
+        // parked recycle-pool actors already ran Destroyed() when they
+        // were parked - their destructors release here
+        m_recyclePools.clear();
+
+        // Actor::Destroyed() unregistered each component, clear the (now
+        // empty) registries as well
+        m_componentsByType.clear();
+
+        // release the merged static geometry with the actors it came from,
+        // and the static shadow depth cached from it
+        m_staticBatcher.Clear();
+        m_staticBatchesDirty = true;
+        m_staticShadowMap.reset();
+        for (auto& key : m_staticShadowKeys) key = 0;
+
+        // forget the per-program uniform fingerprints - the programs may be
+        // released with the scene, and a new scene must upload everything
+        m_programUniformState.clear();
+        m_lastCameraBlockHash = 0;
+        m_lastLightBlockHash = 0;
+
+        // drop queued loads and sub-scene bookkeeping - any parse still in
+        // flight finalizes into an AsyncLoad no longer referenced here
+        m_loads.clear();
+        m_subScenes.clear();
     }
 
     /// <summary>
@@ -310,20 +2183,26 @@ namespace neu {
     /// <param name="sceneName">Name/path of the scene file to load</param>
     /// <returns>True if the scene loaded successfully, false on any error</returns>
     bool Scene::Load(const std::string& sceneName) {
-        // Create a document to hold the parsed serialized data
-        neu::serial::document_t document;
-
-        // Attempt to load and parse the scene file
-        // Load() handles file I/O and JSON/serialization parsing
-        if (!neu::serial::Load(sceneName, document)) {
+        // Fetch the parsed scene document through the shared cache -
+        // repeat loads of the same file (restarts, sub-scenes) reuse the
+        // cached parse instead of re-reading and re-parsing the file
+        auto document = Resources().GetDocument(sceneName);
+        if (!document) {
             // Log error with scene name for debugging
-            LOG_ERROR("Could not load scene {}", sceneName);
+            LOG_CAT_ERROR(Scene, "Could not load scene {}", sceneName);
             return false; // Early return on failure
         }
 
         // Process the loaded document to populate the scene
         // Read() handles prototypes and actors sections
-        Read(document);
+        Read(*document);
+
+        // force driver pipeline specialization for every loaded material
+        // while we're still behind the load, not at first sight in-game
+        WarmupDraws();
+
+        // report the scene's aggregates against the declared budgets
+        ValidateContentBudgets(sceneName);
 
         // Scene loaded successfully
         return true;
@@ -350,8 +2229,11 @@ namespace neu {
         // Load base Object properties first (name, active, etc.)
         // This calls the parent class's Read() implementation
         // Object::Read(value);
-        SERIAL_READ_NAME(value, "ambient_light", m_ambientLight);
-        SERIAL_READ_NAME(value, "postprocess", m_ambientLight);
+        ReadSettings(value);
+
+        // Resolve the actor creator name once for the whole file - the
+        // per-actor loops below create by dense id, no string lookups
+        Factory::type_id_t actorTypeId = Factory::Instance().GetTypeId("Actor");
 
         // SECTION 1: Process prototype definitions
         // Check if the serialized data contains a "prototypes" section
@@ -360,7 +2242,7 @@ namespace neu {
             for (auto& actorValue : SERIAL_AT(value, prototypes).GetArray()) {
                 // Create a new base Actor instance via Factory
                 // This uses the Factory pattern for type-safe object creation
-                auto actor = Factory::Instance().Create<Actor>("Actor");
+                auto actor = Factory::Instance().Create<Actor>(actorTypeId);
 
                 // Load the actor's configuration from serialized data
                 // This populates all actor properties (transform, components, etc.)
@@ -382,7 +2264,7 @@ namespace neu {
             for (auto& actorValue : SERIAL_AT(value, actors).GetArray()) {
                 // Create a new Actor instance via Factory
                 // Actors may reference prototypes defined above
-                auto actor = Factory::Instance().Create<Actor>("Actor");
+                auto actor = Factory::Instance().Create<Actor>(actorTypeId);
 
                 // Load the actor's configuration from serialized data
                 actor->Read(actorValue);
@@ -395,5 +2277,227 @@ namespace neu {
         }
     }
 
+    /// <summary>
+    /// Reads scene-wide settings (lighting, update mode, sub-scene
+    /// declarations) from serialized data. Split out of Read() so async
+    /// loads can apply settings once before amortized actor creation.
+    /// </summary>
+    /// <param name="value">Serialized data containing scene configuration</param>
+    void Scene::ReadSettings(const serial_data_t& value) {
+        SERIAL_READ_NAME(value, "ambient_light", m_ambientLight);
+        SERIAL_READ_NAME(value, "postprocess", m_postprocess);
+        SERIAL_READ_NAME(value, "depth_prepass", m_depthPrePass);
+        SERIAL_READ_NAME(value, "parallel_update", m_parallelUpdate);
+        SERIAL_READ_NAME(value, "actor_sleeping", m_actorSleeping);
+        SERIAL_READ_NAME(value, "update_rate_lod", m_updateRateLod);
+
+        bool occlusionCulling = m_hiZ.IsEnabled();
+        SERIAL_READ_NAME(value, "occlusion_culling", occlusionCulling);
+        m_hiZ.SetEnabled(occlusionCulling);
+
+        // Sub-scene declarations - content streamed in and out around the
+        // camera by UpdateSubScenes() instead of loaded up front
+        if (SERIAL_CONTAINS(value, subscenes)) {
+            for (auto& subSceneValue : SERIAL_AT(value, subscenes).GetArray()) {
+                SubScene subScene;
+                SERIAL_READ_NAME(subSceneValue, "scene", subScene.sceneName);
+                SERIAL_READ_NAME(subSceneValue, "position", subScene.position);
+                SERIAL_READ_NAME(subSceneValue, "radius", subScene.radius);
+                m_subScenes.push_back(subScene);
+            }
+        }
+
+        // authored visibility zones and portals for interior levels - the
+        // draw traversal walks only zones reachable through on-screen
+        // portals (see ZoneGraph)
+        m_zones.Read(value);
+    }
+
+    /// <summary>
+    /// Starts loading a scene without blocking the frame.
+    ///
+    /// The file read and parse run on a resource worker thread; actor
+    /// instantiation stays on the main thread (component Read() creates
+    /// GL resources) but is spread across frames by UpdateAsyncLoad()
+    /// under a per-frame time budget. Loaded actors are started together
+    /// once the whole document has been processed, preserving the
+    /// batch-Start() semantics of the blocking Load().
+    /// </summary>
+    /// <param name="sceneName">Name/path of the scene file to load</param>
+    /// <param name="progress">Optional callback invoked with completion in [0, 1]</param>
+    /// <returns>True if the load was queued</returns>
+    bool Scene::LoadAsync(const std::string& sceneName, std::function<void(float)> progress) {
+        return LoadAsync(sceneName, std::move(progress), -1);
+    }
+
+    bool Scene::LoadAsync(const std::string& sceneName, std::function<void(float)> progress, int subScene) {
+        auto load = std::make_shared<AsyncLoad>();
+        load->sceneName = sceneName;
+        load->subScene = subScene;
+        load->progress = std::move(progress);
+
+        // file I/O and parse on a resource worker through the shared
+        // document cache (re-entering a streamed sub-scene reuses the
+        // cached parse), the finalize just flips the flag
+        // UpdateAsyncLoad() polls on the main thread
+        Resources().QueueWork(
+            [load, sceneName]() {
+                load->document = Resources().GetDocument(sceneName);
+                load->failed = !load->document;
+            },
+            [load]() {
+                load->parsed = true;
+            }
+        );
+
+        m_loads.push_back(std::move(load));
+        return true;
+    }
+
+    /// <summary>
+    /// Drains the front async load under the per-frame budget.
+    ///
+    /// Once the worker has parsed the document, prototypes and actors are
+    /// instantiated a few at a time until kLoadBudgetSeconds of main-thread
+    /// time is spent, then the load resumes next frame. Completed loads
+    /// Start() their actors as one batch so cross-actor lookups in Start()
+    /// see the full scene, matching the blocking Load() path.
+    /// </summary>
+    void Scene::UpdateAsyncLoad() {
+        if (m_loads.empty()) return;
+
+        AsyncLoad& load = *m_loads.front();
+        if (!load.parsed) return;
+
+        if (load.failed) {
+            LOG_CAT_ERROR(Scene, "Could not load scene {}", load.sceneName);
+            if (load.subScene >= 0) m_subScenes[load.subScene].loading = false;
+            m_loads.pop_front();
+            return;
+        }
+
+        const serial::document_t& document = *load.document;
+
+        // settings and totals apply once when the document first arrives -
+        // sub-scene documents contribute actors only, their settings would
+        // stomp the owning scene's
+        if (!load.applied) {
+            if (load.subScene < 0) ReadSettings(document);
+            if (SERIAL_CONTAINS(document, prototypes)) {
+                load.total += SERIAL_AT(document, prototypes).GetArray().Size();
+            }
+            if (SERIAL_CONTAINS(document, actors)) {
+                load.total += SERIAL_AT(document, actors).GetArray().Size();
+            }
+            load.applied = true;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        auto overBudget = [&start]() {
+            std::chrono::duration<float> elapsed = std::chrono::steady_clock::now() - start;
+            return elapsed.count() >= kLoadBudgetSeconds;
+        };
+
+        // actor creator name resolved once, created by dense id below
+        Factory::type_id_t actorTypeId = Factory::Instance().GetTypeId("Actor");
+
+        // prototypes first - actors below may be instantiated from them
+        if (SERIAL_CONTAINS(document, prototypes)) {
+            auto prototypes = SERIAL_AT(document, prototypes).GetArray();
+            while (load.nextPrototype < prototypes.Size() && !overBudget()) {
+                auto actor = Factory::Instance().Create<Actor>(actorTypeId);
+                actor->Read(prototypes[(rapidjson::SizeType)load.nextPrototype]);
+                std::string name = actor->name;
+                Factory::Instance().RegisterPrototype<Actor>(name, std::move(actor));
+                load.nextPrototype++;
+                load.processed++;
+            }
+        }
+
+        if (SERIAL_CONTAINS(document, actors)) {
+            auto actors = SERIAL_AT(document, actors).GetArray();
+            while (load.nextActor < actors.Size() && !overBudget()) {
+                auto actor = Factory::Instance().Create<Actor>(actorTypeId);
+                actor->Read(actors[(rapidjson::SizeType)load.nextActor]);
+
+                // deferred Start(), same as the blocking path - record the
+                // handle, pool slots are stable but pointers shouldn't be held
+                Actor* added = AddActor(std::move(actor), false);
+                load.spawned.push_back(added->handle);
+                load.nextActor++;
+                load.processed++;
+            }
+        }
+
+        if (load.progress && load.total > 0) {
+            load.progress((float)load.processed / (float)load.total);
+        }
+
+        if (load.processed < load.total) return;
+
+        // everything instantiated - start the batch together, parallel
+        // phase first (same partition as the blocking path)
+        std::vector<Actor*> spawned;
+        spawned.reserve(load.spawned.size());
+        for (auto handle : load.spawned) {
+            Actor* actor = GetActor(handle);
+            if (actor) spawned.push_back(actor);
+        }
+        StartActors(spawned);
+
+        if (load.subScene >= 0) {
+            SubScene& subScene = m_subScenes[load.subScene];
+            subScene.actors = std::move(load.spawned);
+            subScene.loaded = true;
+            subScene.loading = false;
+        }
+
+        // same driver specialization warmup as the blocking path - one extra
+        // frame of load screen beats a hitch the first time a new sub-scene
+        // material reaches the screen
+        WarmupDraws();
+
+        // the aggregate walk covers the whole scene, so after a sub-scene
+        // streams in the report reflects the new combined totals
+        ValidateContentBudgets(load.sceneName);
+
+        LOG_CAT_INFO(Scene, "Async loaded scene {} ({} actors)", load.sceneName, load.spawned.size());
+        m_loads.pop_front();
+    }
+
+    /// <summary>
+    /// Streams declared sub-scenes in and out around the active camera.
+    ///
+    /// A sub-scene loads asynchronously when the camera enters its radius
+    /// and unloads (actors marked destroyed for the cleanup phase) once the
+    /// camera leaves radius * kUnloadMargin - the hysteresis band keeps a
+    /// camera sitting on the boundary from thrashing loads.
+    /// </summary>
+    void Scene::UpdateSubScenes() {
+        if (m_subScenes.empty()) return;
+
+        auto cameras = GetActorComponents<CameraComponent>();
+        if (cameras.empty()) return;
+        glm::vec3 eye = cameras[0]->owner->transform.position;
+
+        for (int i = 0; i < (int)m_subScenes.size(); i++) {
+            SubScene& subScene = m_subScenes[i];
+            float distance = glm::distance(eye, subScene.position);
+
+            if (!subScene.loaded && !subScene.loading && distance < subScene.radius) {
+                subScene.loading = true;
+                LoadAsync(subScene.sceneName, {}, i);
+            }
+            else if (subScene.loaded && distance > subScene.radius * kUnloadMargin) {
+                for (auto handle : subScene.actors) {
+                    Actor* actor = GetActor(handle);
+                    if (actor) actor->destroyed = true;
+                }
+                subScene.actors.clear();
+                subScene.loaded = false;
+                LOG_CAT_INFO(Scene, "Unloaded sub-scene {}", subScene.sceneName);
+            }
+        }
+    }
 
 }
\ No newline at end of file
@@ -1,14 +1,37 @@
 #pragma once
 #include "Object.h"
+#include "ActorPool.h"
+#include "SceneBVH.h"
+#include "SceneCheckpoint.h"
+#include "TimerWheel.h"
+#include "TransformCache.h"
+#include "ZoneGraph.h"
+#include "Core/FrameArena.h"
+#include "Renderer/UniformBuffer.h"
+#include "Renderer/DrawList.h"
+#include "Renderer/HiZBuffer.h"
+#include "Renderer/PostProcessPipeline.h"
+#include "Renderer/RenderGraph.h"
+#include "Renderer/RenderQueue.h"
+#include "Renderer/RenderTexture.h"
+#include "Renderer/StaticBatcher.h"
 #include <string>
 #include <vector>
 #include <list>
+#include <deque>
 #include <memory>
+#include <functional>
+#include <unordered_map>
+#include <map>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 
 namespace neu {
     // Forward declaration to avoid circular dependency
     // Scene needs to know about Actor, but full definition not needed in header
     class Actor;
+    class Component;
 
     /// <summary>
     /// Container and manager for all actors within a game level or area.
@@ -98,6 +121,28 @@ namespace neu {
         /// <returns>True if the scene loaded successfully, false on any error</returns>
         bool Load(const std::string& sceneName);
 
+        /// <summary>
+        /// Loads a scene without freezing the frame loop.
+        ///
+        /// The file read and JSON parse run on a resource worker thread;
+        /// actor instantiation (whose component Read() calls create GL
+        /// resources) is drained on the main thread by Update() under a
+        /// per-frame time budget, and every actor spawned by the load is
+        /// started together once the last one exists - mirroring the
+        /// synchronous path. The optional progress callback receives the
+        /// 0..1 completion fraction each frame for loading screens.
+        /// </summary>
+        /// <param name="sceneName">Name/path of the scene file to load</param>
+        /// <param name="progress">Optional per-frame completion callback (0..1)</param>
+        /// <returns>True if the load was queued</returns>
+        bool LoadAsync(const std::string& sceneName, std::function<void(float)> progress = {});
+
+        /// <summary>
+        /// True while any async scene or sub-scene load is parsing or
+        /// instantiating.
+        /// </summary>
+        bool IsLoading() const { return !m_loads.empty(); }
+
         /// <summary>
         /// Deserializes scene data from serialized format.
         /// 
@@ -154,10 +199,38 @@ namespace neu {
         /// <param name="renderer">Renderer instance used for all drawing operations</param>
         void Draw(class Renderer& renderer);
 
-        void DrawPass(class Renderer& renderer,
-            std::vector<class Program*> programs,
-            std::vector<class LightComponent*> lights,
-            class CameraComponent* camera);
+        /// <summary>
+        /// Records this frame's draw submission into the render queue
+        /// without touching GL: transform interpolation, frustum culling,
+        /// sort-key build and radix sort, and world-matrix capture all
+        /// happen here. Draw() then plays the queue back with thin GL calls
+        /// on the context thread.
+        ///
+        /// Called implicitly by Draw() when no async record is in flight,
+        /// so callers that don't opt into RecordDrawAsync see no change.
+        /// </summary>
+        void RecordDraw();
+
+        /// <summary>
+        /// Kicks RecordDraw() onto a job system worker so command recording
+        /// overlaps main-thread work between the update and Draw() (GUI,
+        /// event polling). Draw() waits for the job before playback.
+        ///
+        /// Recording reads the transform cache and BVH snapshots produced
+        /// by Update() - work overlapping it must not add or destroy actors
+        /// or components.
+        /// </summary>
+        void RecordDrawAsync();
+
+        /// <summary>
+        /// Sets the blend factor between the previous and current simulation
+        /// step used when drawing. Set each frame by Engine when fixed-step
+        /// updates are enabled; 1 (the default) draws the current simulation
+        /// state directly.
+        /// </summary>
+        /// <param name="alpha">Fraction of a step elapsed since the last simulation update (0..1)</param>
+        void SetRenderAlpha(float alpha) { m_renderAlpha = alpha; }
+
 
         /// <summary>
         /// Adds an actor to the scene with optional immediate initialization.
@@ -174,10 +247,64 @@ namespace neu {
         /// Initialization control:
         /// - If start=true, the actor's Start() method is called immediately
         /// - If start=false, Start() must be called manually later (useful for batch operations)
+        ///
+        /// Mid-update spawning:
+        /// - Calls made while Update() iterates the actor pool (spawner
+        ///   components do this constantly) are recorded into the spawn
+        ///   queue and applied in one batch after the update loop, so the
+        ///   pool is never mutated mid-iteration - safe from the parallel
+        ///   update path without going through Defer()
+        /// - In that case the returned pointer is the staged actor, valid
+        ///   for configuration until the batch is applied later this frame;
+        ///   the actor's handle is not stamped until then
         /// </summary>
         /// <param name="actor">Unique pointer to the actor to add (ownership transferred)</param>
         /// <param name="start">Whether to immediately call Start() on the actor (default: true)</param>
-        void AddActor(std::unique_ptr<Actor> actor, bool start = true);
+        /// <returns>Pointer to the pooled actor (stable until the actor is destroyed), or the staged actor when called mid-update</returns>
+        Actor* AddActor(std::unique_ptr<Actor> actor, bool start = true);
+
+        /// <summary>
+        /// Spawns an actor from a registered prototype on the fast path:
+        /// the prototype is copy-constructed directly into a pool slot, so
+        /// spawning skips the heap-allocated clone and pool move that
+        /// Factory::Create + AddActor produce. Names not registered as
+        /// prototypes fall back to the regular factory path.
+        ///
+        /// Calls made while Update() iterates the actor pool spawn through
+        /// the scene's spawn queue instead (see AddActor) - the clone lands
+        /// in its pool slot, and Start() runs, when the batch is applied
+        /// after the update loop.
+        /// </summary>
+        /// <param name="name">Name of the registered prototype to spawn</param>
+        /// <returns>Pointer to the spawned actor, or nullptr on failure</returns>
+        Actor* Instantiate(const std::string& name);
+
+        /// <summary>
+        /// Spawns an actor from a registered prototype with the given
+        /// transform applied before Start() runs.
+        /// </summary>
+        /// <param name="name">Name of the registered prototype to spawn</param>
+        /// <param name="transform">Transform for the spawned actor</param>
+        /// <returns>Pointer to the spawned actor, or nullptr on failure</returns>
+        Actor* Instantiate(const std::string& name, const Transform& transform);
+
+        /// <summary>
+        /// Returns an instantiated actor to its prototype's recycle pool
+        /// instead of destroying it.
+        ///
+        /// The actor is flagged like Destroy and swept by the same cleanup
+        /// phase - Destroyed() runs, registries and indices release - but
+        /// the actor object itself (components, resource references,
+        /// renderer cache intact) parks in a per-prototype free pool. The
+        /// next Instantiate of that prototype moves it back into a pool
+        /// slot and calls Reset() instead of cloning the prototype and
+        /// re-running Start, so re-arming a pooled projectile costs a move
+        /// plus the components' Reset work. Actors without a spawn
+        /// prototype (scene-authored) just destroy. Safe from worker
+        /// threads like Destroy - it only flags.
+        /// </summary>
+        /// <param name="actor">Actor to recycle (null is ignored)</param>
+        void Recycle(Actor* actor);
 
         /// <summary>
         /// Removes actors from the scene based on their persistence settings.
@@ -234,7 +361,7 @@ namespace neu {
         /// matching actor found, or nullptr if no match exists or the cast fails.
         /// 
         /// Search behavior:
-        /// - Case-insensitive string comparison using equalsIgnoreCase()
+        /// - Case-insensitive via interned-name identity (pointer compare)
         /// - Returns first match found (search order is actor addition order)
         /// - Type safety ensured through dynamic_cast
         /// 
@@ -254,7 +381,45 @@ namespace neu {
         /// <returns>Pointer to the first matching actor of type T, or nullptr if not found</returns>
         template<typename T = Actor>
             requires std::derived_from<T, Actor>
-        T* GetActorByName(const std::string& name);
+        T* GetActorByName(const InternedString& name);
+
+        /// <summary>
+        /// Index-skipping variant for repeated lookups of the same actor.
+        ///
+        /// The caller holds a handle slot across frames; while it still
+        /// resolves to a live actor of the right type the name index isn't
+        /// touched at all. A stale handle (first call, or the actor was
+        /// destroyed - possibly respawned since) falls back to the index
+        /// and refills the slot.
+        /// </summary>
+        /// <typeparam name="T">Actor-derived type to cast the result to (defaults to Actor)</typeparam>
+        /// <param name="name">Name of the actor to search for (case-insensitive)</param>
+        /// <param name="cachedHandle">Caller-held cache slot, refilled when stale</param>
+        /// <returns>Pointer to the matching actor of type T, or nullptr if not found</returns>
+        template<typename T = Actor>
+            requires std::derived_from<T, Actor>
+        T* GetActorByName(const InternedString& name, ActorHandle& cachedHandle);
+
+        /// <summary>
+        /// Retrieves a generational handle to the first actor with the
+        /// specified name (case-insensitive).
+        ///
+        /// Actor pool slots are reused after destruction, so raw Actor*
+        /// results from the queries above are only safe within the frame
+        /// that fetched them. Gameplay code keeping a reference across
+        /// frames should hold this handle instead and resolve it through
+        /// GetActor() each use.
+        /// </summary>
+        /// <param name="name">Name of the actor to search for (case-insensitive)</param>
+        /// <returns>Handle to the actor, or an invalid handle if not found</returns>
+        ActorHandle GetActorHandleByName(const InternedString& name);
+
+        /// <summary>
+        /// Resolves a generational handle to the live actor it references.
+        /// </summary>
+        /// <param name="handle">Handle obtained from an actor or a handle query</param>
+        /// <returns>The actor, or nullptr if it was destroyed (even if the slot was reused)</returns>
+        Actor* GetActor(ActorHandle handle) { return m_actors.Get(handle); }
 
         /// <summary>
         /// Retrieves all actors with the specified tag, cast to the given type.
@@ -286,36 +451,612 @@ namespace neu {
         /// <returns>Vector of pointers to actors of type T with the specified tag</returns>
         template<typename T = Actor>
             requires std::derived_from<T, Actor>
-        std::vector<T*> GetActorsByTag(const std::string& tag);
+        std::vector<T*> GetActorsByTag(const InternedString& tag);
 
         template<typename T>
             requires std::derived_from<T, Component>
-        std::vector<T*>GetActorComponents();
+        frame_vector<T*> GetActorComponents();
+
+        /// <summary>
+        /// Spatial queries against the scene BVH.
+        ///
+        /// The BVH holds one fattened world AABB per live actor and is
+        /// synced once per frame in Update(), so queries during the update
+        /// phase see last frame's bounds. Results are conservative (fat
+        /// bounds) and frame-arena allocated - re-test for exact hits and
+        /// consume them within the frame.
+        /// </summary>
+        /// <param name="frustum">Frustum to test actor bounds against</param>
+        /// <returns>Actors whose bounds touch the frustum</returns>
+        frame_vector<Actor*> QueryFrustum(const Frustum& frustum) { return m_bvh.QueryFrustum(frustum); }
+
+        /// <param name="bounds">World-space box to test actor bounds against</param>
+        /// <returns>Actors whose bounds overlap the box</returns>
+        frame_vector<Actor*> QueryAABB(const Bounds& bounds) { return m_bvh.QueryAABB(bounds); }
+
+        /// <param name="origin">Ray origin in world space</param>
+        /// <param name="direction">Ray direction (normalized)</param>
+        /// <param name="maxDistance">Maximum hit distance along the ray</param>
+        /// <returns>Actors whose bounds the ray passes through</returns>
+        frame_vector<Actor*> QueryRay(const glm::vec3& origin, const glm::vec3& direction, float maxDistance) { return m_bvh.QueryRay(origin, direction, maxDistance); }
+
+        /// <summary>
+        /// One batched raycast request (see QueryRayBatch). The optional
+        /// callback runs on the main thread once the frame's batch resolves,
+        /// with the conservative hit list for this ray.
+        /// </summary>
+        struct RayQuery {
+            glm::vec3 origin{ 0 };
+            glm::vec3 direction{ 0, 0, -1 };    // normalized
+            float maxDistance{ 100 };
+            std::function<void(const frame_vector<Actor*>&)> callback;
+        };
+
+        using ray_query_t = uint32_t;
+
+        /// <summary>
+        /// Submits a ray into the frame's raycast batch instead of walking
+        /// the BVH at the call site. The batch resolves in parallel jobs at
+        /// the end of Update() against the freshly synced BVH - heavy ray
+        /// consumers (AI line of sight, ground snaps) submit during the
+        /// actor update and the rays spread across cores instead of
+        /// serializing one traversal per call.
+        ///
+        /// Results arrive through the query's callback the same frame, or
+        /// by polling GetRayQueryResult with the returned id during the
+        /// next frame's update. Safe to call from the parallel actor
+        /// update.
+        /// </summary>
+        /// <param name="query">Ray and optional completion callback</param>
+        /// <returns>Id for polling the result next frame</returns>
+        ray_query_t QueryRayBatch(const RayQuery& query);
+
+        /// <summary>
+        /// Hits for a ray submitted last frame, with actors destroyed since
+        /// then dropped (results are stored as generational handles).
+        /// Conservative like QueryRay - re-test for exact hits.
+        /// </summary>
+        /// <param name="id">Id returned by last frame's QueryRayBatch</param>
+        /// <returns>Actors whose bounds the ray passed through</returns>
+        frame_vector<Actor*> GetRayQueryResult(ray_query_t id);
+
+        /// <summary>
+        /// World matrix for an actor from the scene's transform cache.
+        ///
+        /// Recomputed by the batched kernel only for actors whose transform
+        /// changed this frame - prefer this over transform.GetMatrix() on
+        /// hot paths. Falls back to a direct compute for actors the cache
+        /// hasn't seen yet (e.g. during scene load).
+        /// </summary>
+        /// <param name="actor">Actor whose world matrix is wanted</param>
+        /// <returns>The actor's world matrix</returns>
+        glm::mat4 GetWorldMatrix(const Actor* actor) const { return m_transformCache.GetWorldMatrix(actor); }
+
+        /// <summary>
+        /// The scene's timer wheel - one-shot expirations advanced once per
+        /// update. Actor lifespans register here automatically; components
+        /// schedule their own countdowns instead of ticking a float in
+        /// Update. Callbacks fire on the main thread.
+        /// </summary>
+        TimerWheel& GetTimers() { return m_timers; }
+
+        /// <summary>
+        /// Binary checkpoint of the actor population. BeginCheckpoint starts
+        /// an incremental capture that Update() advances a time-sliced chunk
+        /// per frame; RestoreCheckpoint tears the population down and
+        /// rebuilds it from the last completed capture through the pooled
+        /// spawn path. In-memory and per-run only - see SceneCheckpoint.
+        /// </summary>
+        void BeginCheckpoint() { m_checkpoint.BeginCapture(m_actors); }
+        bool RestoreCheckpoint() { return m_checkpoint.Restore(*this); }
+        SceneCheckpoint& GetCheckpoint() { return m_checkpoint; }
+
+        /// <summary>
+        /// Adds/removes a component in the typed registries. Called by Actor
+        /// as components enter and leave the scene so GetActorComponents()
+        /// stays an O(1) slice fetch.
+        /// </summary>
+        void RegisterComponent(Component* component);
+        void UnregisterComponent(Component* component);
+
+        /// <summary>
+        /// Adds/removes a reference in the distinct-program set the render
+        /// queue draws from. Maintained incrementally as ModelRenderers
+        /// register and as the editor swaps materials, so Record() starts
+        /// from a ready list instead of walking every actor per frame.
+        /// </summary>
+        void AddProgramRef(Program* program);
+        void RemoveProgramRef(Program* program);
+
+    private:
+        /// <summary>
+        /// Scene-level settings shared by the synchronous and async load
+        /// paths (ambient light, flags, streamed sub-scene declarations).
+        /// </summary>
+        void ReadSettings(const serial_data_t& value);
+
+        /// <summary>
+        /// Resolves the frame's raycast batch against the freshly synced
+        /// BVH with parallel jobs, then runs completion callbacks on the
+        /// main thread. Called at the end of Update().
+        /// </summary>
+        void ResolveRayQueries();
+
+        /// <summary>
+        /// Internal LoadAsync with the owning sub-scene index (-1 for
+        /// whole-scene loads requested through the public overload).
+        /// </summary>
+        bool LoadAsync(const std::string& sceneName, std::function<void(float)> progress, int subScene);
+
+        /// <summary>
+        /// Drains the front async load: applies settings once the worker
+        /// finishes parsing, then instantiates prototypes and actors under
+        /// a per-frame time budget and starts the spawned actors together
+        /// when the load completes.
+        /// </summary>
+        void UpdateAsyncLoad();
+
+        /// <summary>
+        /// Streams declared sub-scenes in and out based on camera distance
+        /// from their anchors - loads queue through the async path, unloads
+        /// mark the sub-scene's actors destroyed for the cleanup phase.
+        /// </summary>
+        void UpdateSubScenes();
+
+        /// <summary>
+        /// Post-step partition sweep: wakes sleeping actors and re-promotes
+        /// statics whose world matrix changed (per the transform cache),
+        /// and puts idle dynamic actors to sleep when the scene opted in.
+        /// Runs right after the transform cache sync, inside the window
+        /// where its per-slot change scratch is valid.
+        /// </summary>
+        void UpdatePartition();
+
+        /// <summary>
+        /// Records one camera's pass into the queue: uniform block data,
+        /// culling, draw list sort and command capture. GL-free.
+        /// </summary>
+        void RecordPass(RenderPass& pass, const frame_vector<class LightComponent*>& lights, class CameraComponent* camera, const frame_vector<Actor*>& visible);
+
+        /// <summary>
+        /// Fits one shadow crop per cascade to the main camera's view
+        /// frustum: split distances from the practical (log/uniform blend)
+        /// scheme, each slice's corners bounded in light space into an
+        /// ortho projection. Fills the queue's cascade matrices and splits;
+        /// the raw (unbiased) projections feed per-cascade pass recording.
+        /// </summary>
+        void FitShadowCascades(class CameraComponent& shadowCamera, class CameraComponent& mainCamera,
+            int count, const glm::mat4& biasMatrix, glm::mat4* cascadeProjections);
+
+        /// <summary>
+        /// Plays one recorded pass back on the GL context thread: block
+        /// uploads, state binds on key transitions, and the draw calls.
+        /// </summary>
+        void PlaybackPass(class Renderer& renderer, RenderPass& pass);
+
+        /// <summary>
+        /// Renders pending reflection probe captures: six faces through the
+        /// normal record/playback path into the probe's pooled cubemap, then
+        /// the GPU prefilter. At most one probe per frame, so a scene full
+        /// of probes ramps in over a few frames instead of spiking one.
+        /// </summary>
+        void CaptureReflectionProbes(class Renderer& renderer);
+
+        /// <summary>
+        /// Blocks until an in-flight async record finishes, or records
+        /// inline when none was kicked this frame.
+        /// </summary>
+        void WaitForRecord();
+
+        /// <summary>
+        /// Issues one tiny off-screen draw per unique program/vertex-format
+        /// combination the loaded model renderers reference. The first draw
+        /// of a new combination triggers lazy driver pipeline specialization
+        /// (20-50 ms on some drivers), so both load paths pay that cost here,
+        /// behind the load screen, instead of the first frame each material
+        /// appears on screen. Program linking is already warmed separately by
+        /// Program::WarmUp - this covers the draw-time specialization on top.
+        /// </summary>
+        void WarmupDraws();
+
+        /// <summary>
+        /// Starts a batch of freshly loaded actors: the ones declaring no
+        /// cross-actor dependencies (see Actor::CanStartParallel) run on
+        /// parallel jobs - the thread-safe resource cache absorbs their
+        /// concurrent Gets - and the rest run serially afterwards in scene
+        /// order. Both load paths funnel their batches through here.
+        /// </summary>
+        /// <param name="actors">Actors to start, in scene order</param>
+        void StartActors(const std::vector<Actor*>& actors);
+
+        /// <summary>
+        /// Gathers the loaded scene's content aggregates (bytes across
+        /// distinct referenced textures, resident bytes across distinct
+        /// emitter audio clips, a submesh draw estimate) and
+        /// reports them against the declared per-scene budgets. Does
+        /// nothing when no budgets file is declared - see ContentBudgets.
+        /// </summary>
+        /// <param name="sceneName">Scene name for the report</param>
+        void ValidateContentBudgets(const std::string& sceneName);
+
+        /// <summary>
+        /// Enters/removes an actor's handle in the name and tag indices.
+        /// IndexActor runs on every add path once the pool has stamped the
+        /// handle; UnindexActor runs on every destroy path before the slot
+        /// is released. Empty names/tags are not indexed.
+        /// </summary>
+        void IndexActor(Actor* actor);
+        void UnindexActor(Actor* actor);
+
+    public:
+
+        /// <summary>
+        /// Queues a command to run on the main thread after the parallel
+        /// update phase, before destroyed-actor cleanup.
+        ///
+        /// Actor updates running on worker threads must route side effects
+        /// that mutate shared scene state (firing events, reparenting,
+        /// touching other actors' components) through this queue. Spawning
+        /// and destroying actors no longer need it - AddActor/Instantiate
+        /// record into the spawn queue during the update phase and Destroy()
+        /// just flags, both applied in batched phases after the loop.
+        /// </summary>
+        /// <param name="command">Callable executed single-threaded after the update phase</param>
+        void Defer(std::function<void()> command);
 
     private:
         friend class Editor;
         /// <summary>
         /// Container for all actors in the scene.
-        /// 
-        /// Uses std::list for efficient insertion and removal of actors during
-        /// gameplay. The list stores unique_ptr for automatic memory management
-        /// and clear ownership semantics.
-        /// 
-        /// Container choice rationale:
-        /// - std::list: Efficient insertion/removal without iterator invalidation
-        /// - unique_ptr: Clear ownership and automatic cleanup
-        /// - Stable iteration: Actors can be safely added/removed during iteration
-        /// 
-        /// Performance characteristics:
-        /// - Actor iteration: O(n) for update/draw operations
-        /// - Actor addition: O(1) insertion at end
-        /// - Actor removal: O(n) for search, O(1) for removal once found
+        ///
+        /// Fixed-block pool: spawning reuses a free-list slot instead of a
+        /// heap allocation, and the update loop walks live actors in index
+        /// order through contiguous blocks instead of chasing list nodes.
+        /// Slot addresses are stable for an actor's lifetime, but slots are
+        /// reused after destruction - hold an ActorHandle (resolved through
+        /// GetActor) to reference an actor across frames, not a raw pointer.
+        /// </summary>
+        ActorPool m_actors;
+
+        /// <summary>
+        /// Hash indices from interned name/tag to actor handles, maintained
+        /// on every add/destroy path so the by-name and by-tag queries are
+        /// one hash lookup instead of a scan over every actor. Values are
+        /// handle lists - tags are shared by design and names aren't
+        /// required to be unique. Keyed by the name/tag the actor carried
+        /// when it was added; runtime renames aren't re-indexed.
+        /// </summary>
+        std::unordered_map<InternedString, std::vector<ActorHandle>> m_nameIndex;
+        std::unordered_map<InternedString, std::vector<ActorHandle>> m_tagIndex;
+
+        /// <summary>
+        /// Dynamic BVH over actor bounds backing the Query* methods and the
+        /// frustum-culling pass. Synced incrementally once per frame in
+        /// Update() - stationary actors are free, movers refit, structural
+        /// changes rebuild.
         /// </summary>
-        std::list<std::unique_ptr<Actor>> m_actors;
+        SceneBVH m_bvh;
+
+        /// <summary>
+        /// Authored zone/portal visibility graph, read from the scene's
+        /// "zones"/"portals" sections. Empty (the common case) for outdoor
+        /// scenes - RecordPass only consults it when zones exist. Actor
+        /// assignments refresh in Update() right after the BVH sync.
+        /// </summary>
+        ZoneGraph m_zones;
+
+        /// <summary>
+        /// One-shot timers (actor lifespans, component countdowns) - only
+        /// due slots are touched as the wheel advances each update.
+        /// </summary>
+        TimerWheel m_timers;
+
+        /// <summary>
+        /// SoA mirror of actor transforms with cached world matrices,
+        /// recomputed by a batched kernel for dirty actors only - synced in
+        /// Update() just before the BVH so bounds use current matrices.
+        /// </summary>
+        TransformCache m_transformCache;
+
+        /// <summary>
+        /// Typed component registries indexed by component type id.
+        ///
+        /// Each slot holds a contiguous array of every live component of one
+        /// concrete type, kept in sync by Actor::AddComponent/Destroyed.
+        /// Replaces the per-query dynamic_cast walk over all actors that
+        /// dominated the frame profile.
+        /// </summary>
+        std::vector<std::vector<Component*>> m_componentsByType;
 
         glm::vec3 m_ambientLight{ 0.2f, 0.2f, 0.2f };
         bool m_postprocess{ false };
 
+        // last frame's 3D audio listener position, for deriving listener
+        // velocity in the per-frame snapshot
+        glm::vec3 m_listenerPosition{ 0 };
+
+        // lay opaque depth down through a null fragment program before the
+        // shaded pass, opted into per scene with "depth_prepass" (or the
+        // editor toggle) - overdraw-heavy scenes shade each pixel once
+        bool m_depthPrePass{ false };
+
+        // editor debug view - draws the frame additively with depth testing
+        // off so pixel brightness reads as the number of shaded layers
+        bool m_overdrawView{ false };
+
+        // fixed-step blend factor for this frame's draw, fed by Engine
+        float m_renderAlpha{ 1 };
+
+        /// <summary>
+        /// Parallel update mode, opted into per scene with "parallel_update".
+        ///
+        /// When enabled, active actors are partitioned into batches updated
+        /// across the engine job system workers. Scenes whose actor updates
+        /// mutate shared state directly should leave this off or move those
+        /// side effects into Defer().
+        /// </summary>
+        bool m_parallelUpdate{ false };
+
+        /// <summary>
+        /// Dynamic update partition - the only actors the update loop
+        /// visits. Static actors never enter; sleeping actors drop out and
+        /// re-enter when something moves them. Entries are generational
+        /// handles, so destroyed actors resolve to null and compact out at
+        /// the top of Update() with no removal bookkeeping on destroy paths.
+        /// </summary>
+        std::vector<ActorHandle> m_dynamicActors;
+
+        /// <summary>
+        /// Sleep mode, opted into per scene with "actor_sleeping".
+        ///
+        /// Dynamic actors whose transform idles for kSleepIdleFrames leave
+        /// the update partition until an outside transform change wakes them
+        /// (detected by the transform cache sync). Actors whose Update reacts
+        /// to state that never touches the transform should clear canSleep.
+        /// </summary>
+        bool m_actorSleeping{ false };
+
+        /// <summary>
+        /// Update-rate LOD, opted into per scene with "update_rate_lod".
+        ///
+        /// Dynamic actors tick every frame inside the first distance band
+        /// and every 2nd/4th/8th frame across the outer ones, one band
+        /// lower when no camera saw them last frame. Skipped frames bank
+        /// their dt so simulation outcomes don't drift; fullRateUpdate (on
+        /// the actor or any of its components) opts out.
+        /// </summary>
+        bool m_updateRateLod{ false };
+
+        // monotonically increasing Update() counter - staggers the
+        // update-rate buckets and timestamps per-actor visibility
+        uint64_t m_frame{ 0 };
+
+        /// <summary>
+        /// Binary checkpoint state - captures advance a budgeted slice per
+        /// Update() while one is in flight (see BeginCheckpoint).
+        /// </summary>
+        SceneCheckpoint m_checkpoint;
+
+        // last sweep's partition composition for the editor overlay
+        size_t m_staticCount{ 0 };
+        size_t m_sleepingCount{ 0 };
+
+        // commands queued from worker threads during the parallel update
+        // phase, drained single-threaded in Update()
+        std::vector<std::function<void()>> m_deferredCommands;
+        std::mutex m_deferredMutex;
+
+        /// <summary>
+        /// One spawn recorded during the update phase: the configured actor
+        /// shell and the start flag the AddActor caller passed. The shell
+        /// moves into its pool slot when the batch is applied.
+        /// </summary>
+        struct SpawnCommand {
+            std::unique_ptr<Actor> actor;
+            bool start{ true };
+        };
+
+        /// <summary>
+        /// Spawns requested while Update() iterates the actor pool, applied
+        /// in one batch by ApplySpawns() after the update loop. Structural
+        /// destroys are already batched the same way - actors flag
+        /// themselves destroyed and PHASE 2 sweeps them - so between the
+        /// two, the pool never changes shape mid-iteration and the parallel
+        /// update needs no lock around the actor list.
+        /// </summary>
+        std::vector<SpawnCommand> m_spawnQueue;
+        std::mutex m_spawnMutex;
+
+        // true while Update() iterates the pool - spawn calls record into
+        // m_spawnQueue instead of mutating the pool under the iteration
+        bool m_updating{ false };
+
+        /// <summary>
+        /// Recycled actors parked by prototype name, waiting for the next
+        /// Instantiate of the same prototype. Parking happens only in the
+        /// single-threaded cleanup phase; takes during the update phase go
+        /// under m_spawnMutex, the same lock the spawn queue already pays.
+        /// </summary>
+        std::unordered_map<std::string, std::vector<std::unique_ptr<Actor>>> m_recyclePools;
+
+        /// <summary>
+        /// Pulls a parked actor from the prototype's recycle pool and
+        /// re-arms it - the fast half of Instantiate. Returns nullptr when
+        /// the pool has none, sending the caller down the clone path.
+        /// During the update phase the re-arm is staged through the spawn
+        /// queue like any other mid-update spawn.
+        /// </summary>
+        /// <param name="name">Prototype name being instantiated</param>
+        /// <param name="transform">Optional transform applied before Reset()</param>
+        /// <returns>The re-armed (or staged) actor, or nullptr</returns>
+        Actor* SpawnFromRecyclePool(const std::string& name, const Transform* transform);
+
+        /// <summary>
+        /// Moves an actor shell into a pool slot and wires it into the
+        /// scene (back-reference, component registries, name/tag indices).
+        /// The immediate path taken by AddActor outside the update phase
+        /// and by ApplySpawns() for queued spawns.
+        /// </summary>
+        Actor* CommitActor(std::unique_ptr<Actor> actor, bool start);
+
+        /// <summary>
+        /// Drains the spawn queue, committing every staged actor to the
+        /// pool in one batch - new actors land in contiguous slots and get
+        /// their Start() together, and PHASE 3 picks their transforms and
+        /// bounds up in the same cache/BVH sync as everyone else's.
+        /// </summary>
+        void ApplySpawns();
+
+        // shared std140 blocks (camera + lights) uploaded once per pass and
+        // bound to fixed binding points that every linked program picks up
+        UniformBuffer m_cameraBuffer;
+        UniformBuffer m_lightBuffer;
+
+        // SSBO uploads for the per-pass binned light set read by shaders on
+        // the clustered forward path
+        LightClusters m_lightClusters;
+
+        // per-frame draw submission list, rebuilt and radix sorted each pass
+        // so playback binds program/material state only on key transitions
+        DrawList m_drawList;
+
+        // this frame's recorded draw submission, built by RecordDraw (on a
+        // worker when kicked through RecordDrawAsync) and played back by Draw
+        RenderQueue m_renderQueue;
+
+        // async record bookkeeping - pending is set when a record job is
+        // kicked, done/condition signal its completion to WaitForRecord
+        std::atomic<bool> m_recordPending{ false };
+        bool m_recordDone{ false };
+        std::mutex m_recordMutex;
+        std::condition_variable m_recordCondition;
+
+        // batched raycasts: queries accumulate during the actor update and
+        // resolve in parallel at the end of Update(); results persist one
+        // frame as generational handles for GetRayQueryResult
+        std::vector<RayQuery> m_rayQueries;
+        std::vector<std::vector<ActorHandle>> m_rayResults;
+        std::mutex m_rayQueryMutex;
+
+        /// <summary>
+        /// Per-program record of the content hashes behind the last legacy
+        /// uniform set (camera, lights, shadow matrix). Program uniforms
+        /// persist across frames, so when the recorded hash matches, the
+        /// whole glUniform sequence for that program is skipped - static
+        /// lights and a parked camera upload nothing.
+        /// </summary>
+        struct ProgramUniformState {
+            uint64_t camera{ 0 };
+            uint64_t lights{ 0 };
+            uint64_t shadow{ 0 };
+        };
+        std::unordered_map<Program*, ProgramUniformState> m_programUniformState;
+
+        // hashes of the block contents most recently written into the shared
+        // UBOs - a pass whose data matches skips the upload entirely
+        uint64_t m_lastCameraBlockHash{ 0 };
+        uint64_t m_lastLightBlockHash{ 0 };
+
+        // last completed frame's upload counters for the editor overlay
+        size_t m_uniformUploadsIssued{ 0 };
+        size_t m_uniformUploadsSkipped{ 0 };
+
+        // static geometry merged per material and drawn with one indirect
+        // call per batch - rebuilt at pass playback when static renderers
+        // enter or leave the scene
+        StaticBatcher m_staticBatcher;
+        bool m_staticBatchesDirty{ true };
+
+        // camera-independent fingerprint of light reach (position, range,
+        // type) - while it holds still the baked per-draw light masks stay
+        // valid, so static lighting setups bake exactly once at load
+        uint64_t m_lightStateHash{ 0 };
+        bool m_lightMasksDirty{ true };
+
+        // distinct programs referenced by the scene's renderers, refcounted
+        // so the per-frame list is a flag check instead of an actor walk
+        std::map<Program*, int> m_programRefs;
+        std::vector<Program*> m_programList;
+        bool m_programListDirty{ true };
+
+        // cached static-geometry shadow depth. The static world renders into
+        // this map only when the shadow view-projection or the static batch
+        // set changes; each frame's shadow pass blits the cached depth into
+        // the live shadow map and re-renders just the dynamic objects
+        std::unique_ptr<RenderTexture> m_staticShadowMap;
+        uint64_t m_staticShadowKeys[kMaxShadowCascades]{};
+        uint32_t m_staticBatchVersion{ 0 };
+
+        // tiny target the post-load warmup draws render into, created on
+        // first use and reused by later loads (see WarmupDraws)
+        std::unique_ptr<RenderTexture> m_warmupTarget;
+
+        // frame graph Draw() declares its passes into - handles pass
+        // culling, framebuffer binds/viewports and transient target
+        // aliasing; the physical target pool persists across frames
+        RenderGraph m_renderGraph;
+
+        // hierarchical-Z occlusion buffer, opted into per scene with
+        // "occlusion_culling" (or the editor toggle) - captured from the
+        // main camera's depth each Draw(), tested in RecordPass before
+        // draw submission
+        HiZBuffer m_hiZ;
+
+        // the camera whose depth fed the occlusion buffer - the occlusion
+        // test only applies to that camera's passes, other cameras see a
+        // different view
+        class CameraComponent* m_hiZCamera{ nullptr };
+
+        // declares a camera's post-process effect chain as graph passes
+        // over lifetime-aliased transient targets
+        PostProcessPipeline m_postProcessPipeline;
+
+        /// <summary>
+        /// One in-flight async scene load. The parse runs on a resource
+        /// worker into the shared state's document; instantiation progress
+        /// lives here so UpdateAsyncLoad can stop mid-array when the frame
+        /// budget runs out and resume next frame.
+        /// </summary>
+        struct AsyncLoad {
+            std::string sceneName;
+            int subScene{ -1 };                  // index into m_subScenes, -1 = whole scene
+            std::function<void(float)> progress;
+
+            // shared cached parse from ResourceManager::GetDocument
+            std::shared_ptr<const serial::document_t> document;
+            bool parsed{ false };                // set by the main-thread finalize
+            bool failed{ false };
+            bool applied{ false };               // settings/counts applied once
+
+            size_t nextPrototype{ 0 };
+            size_t nextActor{ 0 };
+            size_t processed{ 0 };
+            size_t total{ 0 };
+
+            // spawned unstarted, then started together at completion
+            std::vector<ActorHandle> spawned;
+        };
+
+        /// <summary>
+        /// A sub-scene streamed additively by camera distance: loaded when
+        /// the camera comes within radius of the anchor, unloaded again
+        /// past the hysteresis band.
+        /// </summary>
+        struct SubScene {
+            std::string sceneName;
+            glm::vec3 position{ 0 };
+            float radius{ 50 };
+            bool loaded{ false };
+            bool loading{ false };
+            std::vector<ActorHandle> actors;
+        };
+
+        // queued async loads, drained front first by UpdateAsyncLoad
+        std::deque<std::shared_ptr<AsyncLoad>> m_loads;
+
+        // sub-scenes declared in the scene file, managed by UpdateSubScenes
+        std::vector<SubScene> m_subScenes;
+
     };
 
     // ============================================================================
@@ -338,10 +1079,10 @@ namespace neu {
         std::vector<T*> results;
 
         // Iterate through all actors in the scene
-        for (auto& actor : m_actors) {
+        for (auto actor : m_actors) {
             // Attempt to cast the actor to the requested type
             // dynamic_cast returns nullptr if the cast fails (wrong type)
-            T* object = dynamic_cast<T*>(actor.get());
+            T* object = dynamic_cast<T*>(actor);
 
             // Check if the cast was successful
             if (object) {
@@ -367,30 +1108,40 @@ namespace neu {
     /// <returns>A pointer to the actor cast to type T if found and the cast is successful; otherwise, nullptr.</returns>
     template<typename T>
         requires std::derived_from<T, Actor>
-    inline T* Scene::GetActorByName(const std::string& name)
+    inline T* Scene::GetActorByName(const InternedString& name)
     {
-        // Iterate through all actors looking for name match
-        for (auto& actor : m_actors) {
-            // Perform case-insensitive name comparison
-            // equalsIgnoreCase is a utility function for string comparison
-            if (neu::equalsIgnoreCase(actor->name, name)) {
-                // Name matches - attempt to cast to the requested type
-                T* object = dynamic_cast<T*>(actor.get());
-
-                // Check if the cast was successful
-                if (object) {
-                    // Both name and type match - return this actor
-                    return object;
-                }
-                // If cast failed, continue searching in case there's another
-                // actor with the same name but different type
-            }
+        // one hash lookup replaces the scan over every actor
+        auto iter = m_nameIndex.find(name);
+        if (iter == m_nameIndex.end()) return nullptr;
+
+        for (auto handle : iter->second) {
+            // the index holds handles, so a resolve guards against slot
+            // reuse; the cast skips entries of the wrong type in case
+            // several actors share the name
+            T* object = dynamic_cast<T*>(m_actors.Get(handle));
+            if (object) return object;
         }
 
         // No matching actor found with correct name and type
         return nullptr;
     }
 
+    /// <summary>
+    /// Template implementation for the cached-handle lookup. The hot path
+    /// is one pool resolve and a cast - no hashing, no index.
+    /// </summary>
+    template<typename T>
+        requires std::derived_from<T, Actor>
+    inline T* Scene::GetActorByName(const InternedString& name, ActorHandle& cachedHandle)
+    {
+        if (T* actor = dynamic_cast<T*>(m_actors.Get(cachedHandle))) return actor;
+
+        // stale (or never filled) - fall back to the index and re-cache
+        T* actor = GetActorByName<T>(name);
+        cachedHandle = actor ? actor->handle : ActorHandle{};
+        return actor;
+    }
+
     /// <summary>
     /// Retrieves all actors in the scene with a tag matching the specified value and of the specified type.
     /// 
@@ -403,26 +1154,20 @@ namespace neu {
     /// <returns>A vector of pointers to actors of type T whose tag matches the specified tag.</returns>
     template<typename T>
         requires std::derived_from<T, Actor>
-    inline std::vector<T*> Scene::GetActorsByTag(const std::string& tag)
+    inline std::vector<T*> Scene::GetActorsByTag(const InternedString& tag)
     {
         // Container to hold matching actors
         std::vector<T*> results;
 
-        // Iterate through all actors in the scene
-        for (auto& actor : m_actors) {
-            // Check if actor's tag matches the requested tag (case-insensitive)
-            // equalsIgnoreCase provides user-friendly tag matching
-            if (neu::equalsIgnoreCase(actor->tag, tag)) {
-                // Tag matches - attempt to cast to the requested type
-                T* object = dynamic_cast<T*>(actor.get());
-
-                // Check if the cast was successful
-                if (object) {
-                    // Both tag and type match - add to results
-                    results.push_back(object);
-                }
-                // If cast fails, skip this actor (wrong type)
-            }
+        // one hash lookup fetches the tag's handle list
+        auto iter = m_tagIndex.find(tag);
+        if (iter == m_tagIndex.end()) return results;
+
+        results.reserve(iter->second.size());
+        for (auto handle : iter->second) {
+            // resolve through the pool and filter by type
+            T* object = dynamic_cast<T*>(m_actors.Get(handle));
+            if (object) results.push_back(object);
         }
 
         // Return vector of all actors with matching tag and type
@@ -430,17 +1175,20 @@ namespace neu {
     }
     template<typename T>
         requires std::derived_from<T, Component>
-    inline std::vector<T*> Scene::GetActorComponents()
+    inline frame_vector<T*> Scene::GetActorComponents()
     {
-        std::vector<T*> components;
+        // frame-arena scratch, valid until the next Engine::Update reset
+        frame_vector<T*> components;
 
-        for (auto& actor : m_actors)
-        {
-            if (!actor->active) continue;
+        // fetch the registry slice for this type - the slice only ever holds
+        // components of exactly type T, so no dynamic_cast is needed
+        component_type_t typeId = ComponentType::Id<T>();
+        if (typeId >= (component_type_t)m_componentsByType.size()) return components;
 
-            auto component = actor->GetComponent<T>();
-            if (component && component->active) {
-                components.push_back(component);
+        for (auto component : m_componentsByType[typeId])
+        {
+            if (component->active && component->owner->active) {
+                components.push_back(static_cast<T*>(component));
             }
         }
         return components;
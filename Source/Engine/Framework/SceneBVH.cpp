@@ -0,0 +1,334 @@
+#include "SceneBVH.h"
+#include "ActorPool.h"
+#include "Core/JobSystem.h"
+#include <algorithm>
+#include <bit>
+
+namespace neu {
+	namespace {
+		// leaf AABBs are fattened by this margin so small movements stay
+		// inside the leaf instead of dirtying the tree every frame
+		constexpr float kFatMargin = 0.5f;
+
+		// drift-triggered rebuilds run at most once per this many frames,
+		// refits keep the tree correct (if less tight) in between
+		constexpr int kRebuildInterval = 32;
+
+		// fraction of leaves that must drift before a rebuild is worth it
+		constexpr float kDriftRebuildRatio = 0.25f;
+
+		// fixed traversal stack, plenty for a median-split tree
+		constexpr int kMaxDepth = 64;
+	}
+
+	void SceneBVH::Update(ActorPool& actors) {
+		PROFILE_SCOPE("SceneBVH::Update");
+
+		m_frame++;
+
+		// PHASE 1: sync leaves with the live actors
+		int drifted = 0;
+		for (auto actor : actors) {
+			Bounds bounds = actor->GetBounds();
+
+			auto iter = m_leafIndex.find(actor);
+			if (iter == m_leafIndex.end()) {
+				// new actor - add a leaf, the tree shape has to change
+				Leaf leaf;
+				leaf.actor = actor;
+				leaf.fatBounds = bounds.Expanded(kFatMargin);
+				leaf.stamp = m_frame;
+
+				m_leafIndex[actor] = (int)m_leaves.size();
+				m_leaves.push_back(leaf);
+				m_structureDirty = true;
+				continue;
+			}
+
+			Leaf& leaf = m_leaves[iter->second];
+			leaf.stamp = m_frame;
+
+			// still inside the fat bounds - the common case, nothing to do
+			if (leaf.fatBounds.Contains(bounds)) continue;
+
+			// moved out - re-fatten around the new bounds and refit later
+			leaf.fatBounds = bounds.Expanded(kFatMargin);
+			drifted++;
+		}
+
+		// sweep leaves whose actor was destroyed this frame (swap-and-pop,
+		// fixing up the index of the leaf moved into the hole)
+		for (int index = 0; index < (int)m_leaves.size(); ) {
+			if (m_leaves[index].stamp == m_frame) {
+				index++;
+				continue;
+			}
+
+			m_leafIndex.erase(m_leaves[index].actor);
+			m_leaves[index] = m_leaves.back();
+			m_leaves.pop_back();
+			if (index < (int)m_leaves.size()) m_leafIndex[m_leaves[index].actor] = index;
+			m_structureDirty = true;
+		}
+
+		// PHASE 2: repair the tree
+		// Structural changes force a rebuild (a leaf outside the tree would
+		// be invisible to queries); pure movement refits unless enough of
+		// the scene drifted to justify rebuilding, at most once per interval
+		m_framesSinceRebuild++;
+
+		bool heavyDrift = drifted > (int)((float)m_leaves.size() * kDriftRebuildRatio);
+		if (m_structureDirty || (heavyDrift && m_framesSinceRebuild >= kRebuildInterval)) {
+			Rebuild();
+		}
+		else if (drifted > 0) {
+			Refit();
+		}
+	}
+
+	void SceneBVH::Rebuild() {
+		m_nodes.clear();
+		m_root = -1;
+		m_structureDirty = false;
+		m_framesSinceRebuild = 0;
+
+		if (m_leaves.empty()) return;
+
+		// build over an index array so partitioning never moves the leaves
+		std::vector<int> order(m_leaves.size());
+		for (int index = 0; index < (int)order.size(); index++) order[index] = index;
+
+		// a binary tree over N leaves has 2N-1 nodes
+		m_nodes.reserve(m_leaves.size() * 2);
+		m_root = BuildRange(order, 0, (int)order.size());
+	}
+
+	int SceneBVH::BuildRange(std::vector<int>& order, int first, int count) {
+		// claim the node up front so children always land after their parent
+		int nodeIndex = (int)m_nodes.size();
+		m_nodes.push_back({});
+
+		if (count == 1) {
+			Node& node = m_nodes[nodeIndex];
+			node.leaf = order[first];
+			node.bounds = m_leaves[order[first]].fatBounds;
+			return nodeIndex;
+		}
+
+		// split at the median along the widest axis of the leaf centers
+		Bounds centerBounds;
+		for (int index = first; index < first + count; index++) {
+			centerBounds.Encapsulate(m_leaves[order[index]].fatBounds.Center());
+		}
+
+		glm::vec3 size = centerBounds.Size();
+		int axis = 0;
+		if (size.y > size.x) axis = 1;
+		if (size.z > size[axis]) axis = 2;
+
+		int mid = first + count / 2;
+		std::nth_element(order.begin() + first, order.begin() + mid, order.begin() + first + count,
+			[this, axis](int a, int b) {
+				return m_leaves[a].fatBounds.Center()[axis] < m_leaves[b].fatBounds.Center()[axis];
+			});
+
+		int left = BuildRange(order, first, mid - first);
+		int right = BuildRange(order, mid, first + count - mid);
+
+		// re-fetch the node, the recursive push_backs may have reallocated
+		Node& node = m_nodes[nodeIndex];
+		node.left = left;
+		node.right = right;
+		node.bounds = m_nodes[left].bounds;
+		node.bounds.Encapsulate(m_nodes[right].bounds);
+
+		return nodeIndex;
+	}
+
+	void SceneBVH::Refit() {
+		// children always follow their parent in the node array, so walking
+		// backwards recomputes every bound bottom-up in a single pass
+		for (int index = (int)m_nodes.size() - 1; index >= 0; index--) {
+			Node& node = m_nodes[index];
+			if (node.leaf != -1) {
+				node.bounds = m_leaves[node.leaf].fatBounds;
+				continue;
+			}
+
+			// children land after their parent by construction - the
+			// backwards walk depends on it
+			ASSERT_SLOW(node.left > index && node.right > index);
+			node.bounds = m_nodes[node.left].bounds;
+			node.bounds.Encapsulate(m_nodes[node.right].bounds);
+		}
+	}
+
+	frame_vector<Actor*> SceneBVH::QueryFrustum(const Frustum& frustum) const {
+		frame_vector<Actor*> results;
+		if (m_root == -1) return results;
+
+		int stack[kMaxDepth];
+		int top = 0;
+		stack[top++] = m_root;
+
+		while (top > 0) {
+			const Node& node = m_nodes[stack[--top]];
+			if (!frustum.Intersects(node.bounds)) continue;
+
+			if (node.leaf != -1) {
+				results.push_back(m_leaves[node.leaf].actor);
+				continue;
+			}
+
+			stack[top++] = node.left;
+			stack[top++] = node.right;
+		}
+
+		return results;
+	}
+
+	frame_vector<frame_vector<Actor*>> SceneBVH::QueryFrustums(const frame_vector<Frustum>& frusta) const {
+		PROFILE_SCOPE("SceneBVH::QueryFrustums");
+
+		frame_vector<frame_vector<Actor*>> results;
+		for (size_t i = 0; i < frusta.size(); i++) results.emplace_back();
+		if (m_root == -1 || frusta.empty()) return results;
+
+		// each frustum owns one bit of the traversal mask - more frusta than
+		// bits never happens in practice, but degrade to per-frustum walks
+		// rather than dropping cameras
+		if (frusta.size() > 64) {
+			for (size_t i = 0; i < frusta.size(); i++) results[i] = QueryFrustum(frusta[i]);
+			return results;
+		}
+		uint64_t rootMask = (frusta.size() == 64) ? ~0ull : ((1ull << frusta.size()) - 1);
+
+		// carve the tree into subtrees a few levels down, one job each - a
+		// median-split tree is balanced, so the subtrees come out even
+		constexpr int kJobDepth = 5;	// up to 32 subtrees
+		std::vector<int> subtrees;
+		{
+			struct Entry { int node; int depth; };
+			Entry stack[kMaxDepth];
+			int top = 0;
+			stack[top++] = { m_root, 0 };
+
+			while (top > 0) {
+				Entry entry = stack[--top];
+				const Node& node = m_nodes[entry.node];
+				if (node.leaf != -1 || entry.depth == kJobDepth) {
+					subtrees.push_back(entry.node);
+					continue;
+				}
+				stack[top++] = { node.left, entry.depth + 1 };
+				stack[top++] = { node.right, entry.depth + 1 };
+			}
+		}
+
+		// per-job hit lists, merged below - workers may allocate from the
+		// frame arena concurrently (the bump is atomic) but never share a
+		// vector
+		std::vector<std::vector<frame_vector<Actor*>>> hits(subtrees.size());
+
+		GetEngine().GetJobSystem().ParallelFor(subtrees.size(), 1, [&](size_t jobIndex) {
+			auto& lists = hits[jobIndex];
+			lists.resize(frusta.size());
+
+			struct Entry { int node; uint64_t mask; };
+			Entry stack[kMaxDepth];
+			int top = 0;
+			stack[top++] = { subtrees[jobIndex], rootMask };
+
+			while (top > 0) {
+				Entry entry = stack[--top];
+				const Node& node = m_nodes[entry.node];
+
+				// drop the frusta this node's bounds miss - a subtree no
+				// camera sees is pruned once, not once per camera
+				uint64_t mask = 0;
+				for (uint64_t remaining = entry.mask; remaining; remaining &= remaining - 1) {
+					int frustum = std::countr_zero(remaining);
+					if (frusta[frustum].Intersects(node.bounds)) mask |= 1ull << frustum;
+				}
+				if (!mask) continue;
+
+				if (node.leaf != -1) {
+					Actor* actor = m_leaves[node.leaf].actor;
+					for (uint64_t remaining = mask; remaining; remaining &= remaining - 1) {
+						lists[std::countr_zero(remaining)].push_back(actor);
+					}
+					continue;
+				}
+
+				stack[top++] = { node.left, mask };
+				stack[top++] = { node.right, mask };
+			}
+		});
+
+		// merge in job order - the order actors land in doesn't matter, the
+		// draw list sorts the survivors anyway
+		for (auto& lists : hits) {
+			for (size_t frustum = 0; frustum < lists.size(); frustum++) {
+				results[frustum].insert(results[frustum].end(), lists[frustum].begin(), lists[frustum].end());
+			}
+		}
+
+		return results;
+	}
+
+	frame_vector<Actor*> SceneBVH::QueryAABB(const Bounds& bounds) const {
+		frame_vector<Actor*> results;
+		if (m_root == -1) return results;
+
+		int stack[kMaxDepth];
+		int top = 0;
+		stack[top++] = m_root;
+
+		while (top > 0) {
+			const Node& node = m_nodes[stack[--top]];
+			if (!bounds.Intersects(node.bounds)) continue;
+
+			if (node.leaf != -1) {
+				results.push_back(m_leaves[node.leaf].actor);
+				continue;
+			}
+
+			stack[top++] = node.left;
+			stack[top++] = node.right;
+		}
+
+		return results;
+	}
+
+	frame_vector<Actor*> SceneBVH::QueryRay(const glm::vec3& origin, const glm::vec3& direction, float maxDistance) const {
+		frame_vector<Actor*> results;
+		if (m_root == -1) return results;
+
+		int stack[kMaxDepth];
+		int top = 0;
+		stack[top++] = m_root;
+
+		while (top > 0) {
+			const Node& node = m_nodes[stack[--top]];
+			if (!node.bounds.IntersectsRay(origin, direction, maxDistance)) continue;
+
+			if (node.leaf != -1) {
+				results.push_back(m_leaves[node.leaf].actor);
+				continue;
+			}
+
+			stack[top++] = node.left;
+			stack[top++] = node.right;
+		}
+
+		return results;
+	}
+
+	void SceneBVH::Clear() {
+		m_leaves.clear();
+		m_leafIndex.clear();
+		m_nodes.clear();
+		m_root = -1;
+		m_structureDirty = false;
+	}
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include "Actor.h"
+#include "Core/FrameArena.h"
+#include "Math/Bounds.h"
+#include "Math/Frustum.h"
+#include <unordered_map>
+#include <vector>
+
+namespace neu {
+	class ActorPool;
+
+	/// <summary>
+	/// Dynamic bounding volume hierarchy over the scene's actors.
+	///
+	/// Every live actor owns a leaf holding a fattened world-space AABB; a
+	/// binary tree built by median split over leaf centers sits on top. Once
+	/// per frame Update() syncs leaves against the actor pool: actors still
+	/// inside their fat bounds cost a containment test, moved actors get new
+	/// fat bounds and the tree refits bottom-up, and structural changes
+	/// (spawn/remove) or enough accumulated drift trigger a full rebuild,
+	/// rate-limited so rebuild cost is amortized across frames.
+	///
+	/// Queries test the fattened leaf bounds, so results are conservative -
+	/// callers needing exact hits re-test the returned actors (the way the
+	/// frustum-culling pass re-tests per-component bounds).
+	/// </summary>
+	class SceneBVH {
+	public:
+		/// <summary>
+		/// Syncs leaves with the pool's live actors, then refits or rebuilds
+		/// the tree as needed. Called once per frame by Scene::Update.
+		/// </summary>
+		/// <param name="actors">The scene's actor pool</param>
+		void Update(ActorPool& actors);
+
+		// query results live in the frame arena - consume them this frame
+		frame_vector<Actor*> QueryFrustum(const Frustum& frustum) const;
+
+		/// <summary>
+		/// Computes one conservative visible set per frustum in a single
+		/// shared traversal. Subtrees a few levels down become jobs; each job
+		/// walks its subtree once, testing node bounds only against the
+		/// frusta still alive on its path, so overlapping frusta (the shadow
+		/// cascades are fitted around the main camera) share the descent
+		/// instead of re-walking the whole tree per camera.
+		/// </summary>
+		/// <param name="frusta">Frusta to cull against, at most 64</param>
+		/// <returns>Per-frustum actor lists, indexed like frusta</returns>
+		frame_vector<frame_vector<Actor*>> QueryFrustums(const frame_vector<Frustum>& frusta) const;
+		frame_vector<Actor*> QueryAABB(const Bounds& bounds) const;
+		frame_vector<Actor*> QueryRay(const glm::vec3& origin, const glm::vec3& direction, float maxDistance) const;
+
+		/// <summary>
+		/// Drops every leaf and node. Called when the scene is destroyed.
+		/// </summary>
+		void Clear();
+
+	private:
+		/// <summary>
+		/// Per-actor entry holding the fattened bounds and the stamp of the
+		/// last Update() that saw the actor alive (for removal sweeps).
+		/// </summary>
+		struct Leaf {
+			Actor* actor{ nullptr };
+			Bounds fatBounds;
+			uint64_t stamp{ 0 };
+		};
+
+		/// <summary>
+		/// Tree node - internal nodes reference two children, leaf nodes
+		/// reference a Leaf entry. Children are always stored after their
+		/// parent, so a reverse index walk refits every bound bottom-up.
+		/// </summary>
+		struct Node {
+			Bounds bounds;
+			int left{ -1 };
+			int right{ -1 };
+			int leaf{ -1 };
+		};
+
+		void Rebuild();
+		void Refit();
+		int BuildRange(std::vector<int>& order, int first, int count);
+
+		std::vector<Leaf> m_leaves;
+		std::unordered_map<Actor*, int> m_leafIndex;
+		std::vector<Node> m_nodes;
+		int m_root{ -1 };
+
+		uint64_t m_frame{ 0 };
+		int m_framesSinceRebuild{ 0 };
+		bool m_structureDirty{ false };
+	};
+}
@@ -0,0 +1,283 @@
+#include "SceneCheckpoint.h"
+#include "ActorPool.h"
+#include "Scene.h"
+#include "Core/Factory.h"
+#include "Core/Json.h"
+#include "Core/Logger.h"
+#include "Core/Profiler.h"
+#include <chrono>
+
+namespace neu {
+	namespace {
+		// capture slice per frame - the walk resumes next frame when the
+		// budget is spent, keeping the amortized cost well under the 1 ms
+		// the frame can absorb
+		constexpr float kCaptureBudgetSeconds = 0.0005f;
+
+		// actors captured between budget checks - a clock read per actor
+		// would cost more than most of the blobs
+		constexpr int kBudgetCheckInterval = 16;
+
+		// index + generation in one map key, so a reused slot never matches
+		// the actor that used to live there
+		uint64_t HandleKey(ActorHandle handle) {
+			return ((uint64_t)handle.index << 32) | handle.generation;
+		}
+
+		/// <summary>
+		/// Binary field payload through a descriptor table - the same
+		/// offsets JSON deserialization writes through, captured as raw
+		/// bytes in table order. Reader and writer iterate the identical
+		/// table, so table order is the framing.
+		/// </summary>
+		void WriteFields(SnapshotWriter& writer, void* object, const serial::FieldDescriptor* fields, size_t count) {
+			uint8_t* base = static_cast<uint8_t*>(object);
+			for (size_t i = 0; i < count; i++) {
+				void* data = base + fields[i].offset;
+				switch (fields[i].type) {
+				case serial::FieldType::Bool:		writer.Write(*static_cast<bool*>(data)); break;
+				case serial::FieldType::Int:		writer.Write(*static_cast<int*>(data)); break;
+				case serial::FieldType::Float:		writer.Write(*static_cast<float*>(data)); break;
+				case serial::FieldType::String:		writer.Write(*static_cast<std::string*>(data)); break;
+				case serial::FieldType::Interned:	writer.Write(static_cast<InternedString*>(data)->str()); break;
+				case serial::FieldType::Vec2:		writer.Write(*static_cast<glm::vec2*>(data)); break;
+				case serial::FieldType::Vec3:		writer.Write(*static_cast<glm::vec3*>(data)); break;
+				}
+			}
+		}
+
+		void ReadFields(SnapshotReader& reader, void* object, const serial::FieldDescriptor* fields, size_t count) {
+			uint8_t* base = static_cast<uint8_t*>(object);
+			for (size_t i = 0; i < count; i++) {
+				void* data = base + fields[i].offset;
+				switch (fields[i].type) {
+				case serial::FieldType::Bool:		reader.Read(*static_cast<bool*>(data)); break;
+				case serial::FieldType::Int:		reader.Read(*static_cast<int*>(data)); break;
+				case serial::FieldType::Float:		reader.Read(*static_cast<float*>(data)); break;
+				case serial::FieldType::String:		reader.Read(*static_cast<std::string*>(data)); break;
+				case serial::FieldType::Interned: {
+					std::string text;
+					reader.Read(text);
+					*static_cast<InternedString*>(data) = InternedString{ text };
+					break;
+				}
+				case serial::FieldType::Vec2:		reader.Read(*static_cast<glm::vec2*>(data)); break;
+				case serial::FieldType::Vec3:		reader.Read(*static_cast<glm::vec3*>(data)); break;
+				}
+			}
+		}
+	}
+
+	void SceneCheckpoint::BeginCapture(ActorPool& actors) {
+		// index the previous checkpoint's blobs for copy-on-write reuse -
+		// m_completed stays intact (and restorable) until the new walk
+		// finishes and swaps in
+		m_previousEntries.clear();
+		if (m_completed.complete) {
+			for (size_t i = 0; i < m_completed.entries.size(); i++) {
+				m_previousEntries[HandleKey(m_completed.entries[i].handle)] = i;
+			}
+		}
+
+		m_building.arena.clear();
+		m_building.entries.clear();
+		m_building.complete = false;
+		m_building.arena.reserve(m_completed.arena.size());
+		m_building.entries.reserve(actors.Count());
+
+		m_cursor = 0;
+		m_capturing = true;
+	}
+
+	void SceneCheckpoint::UpdateCapture(ActorPool& actors) {
+		PROFILE_SCOPE("SceneCheckpoint::UpdateCapture");
+
+		auto start = std::chrono::steady_clock::now();
+		int sinceCheck = 0;
+
+		while (m_cursor < actors.GetCapacity()) {
+			if (Actor* actor = actors.GetAt(m_cursor)) CaptureActor(actor, actors);
+			m_cursor++;
+
+			if (++sinceCheck >= kBudgetCheckInterval) {
+				sinceCheck = 0;
+				std::chrono::duration<float> elapsed = std::chrono::steady_clock::now() - start;
+				if (elapsed.count() >= kCaptureBudgetSeconds) return;	// resume next frame
+			}
+		}
+
+		// walk complete - this capture becomes the restorable checkpoint
+		// and the copy-on-write source for the next one
+		m_building.complete = true;
+		std::swap(m_completed, m_building);
+		m_previousEntries.clear();
+		m_capturing = false;
+
+		LOG_CAT_INFO(Scene, "Checkpoint captured: {} actors, {} KB",
+			m_completed.entries.size(), m_completed.arena.size() >> 10);
+	}
+
+	void SceneCheckpoint::CaptureActor(Actor* actor, ActorPool& pool) {
+		// destroyed-but-not-yet-collected actors don't belong in a restore
+		if (actor->destroyed) return;
+
+		Entry entry;
+		entry.handle = actor->handle;
+		entry.offset = (uint32_t)m_building.arena.size();
+
+		// sleeping and static actors haven't simulated since the last
+		// checkpoint - reuse their previous blob bytes instead of
+		// re-serializing. This is the copy-on-write half of the capture,
+		// and in a mostly-static level it covers nearly everything
+		auto previous = m_previousEntries.find(HandleKey(actor->handle));
+		if ((actor->sleeping || actor->isStatic) && previous != m_previousEntries.end()) {
+			const Entry& old = m_completed.entries[previous->second];
+			m_building.arena.insert(m_building.arena.end(),
+				m_completed.arena.begin() + old.offset,
+				m_completed.arena.begin() + old.offset + old.size);
+			entry.size = old.size;
+			m_building.entries.push_back(entry);
+			return;
+		}
+
+		SnapshotWriter writer{ m_building.arena };
+		WriteActor(writer, actor, pool);
+		entry.size = (uint32_t)(m_building.arena.size() - entry.offset);
+		m_building.entries.push_back(entry);
+	}
+
+	void SceneCheckpoint::WriteActor(SnapshotWriter& writer, Actor* actor, ActorPool& pool) {
+		writer.Write(actor->name.str());
+		writer.Write(actor->tag.str());
+
+		writer.Write(actor->active);
+		writer.Write(actor->persistent);
+		writer.Write(actor->isStatic);
+		writer.Write(actor->canSleep);
+		writer.Write(actor->fullRateUpdate);
+		writer.Write(actor->lifespan);
+
+		writer.Write(actor->transform.position);
+		writer.Write(actor->transform.rotationq);
+		writer.Write(actor->transform.scale);
+
+		// parents re-resolve by name at Start, like a scene load - a parent
+		// attached by handle at runtime is written through its current name
+		std::string parentName = actor->parentName;
+		if (parentName.empty()) {
+			if (Actor* parent = pool.Get(actor->parent)) parentName = parent->name.str();
+		}
+		writer.Write(parentName);
+
+		writer.Write((uint32_t)actor->m_components.size());
+		for (auto& component : actor->m_components) {
+			writer.Write(component->typeId);
+			writer.Write(component->active);
+
+			// field payload is size-prefixed, so restore can skip it
+			// wholesale if the type's table isn't registered there
+			size_t sizeOffset = writer.GetSize();
+			writer.Write((uint32_t)0);
+			size_t payloadStart = writer.GetSize();
+
+			size_t count = 0;
+			const serial::FieldDescriptor* fields = serial::FieldTables::Get(component->typeId, count);
+			if (fields) WriteFields(writer, component.get(), fields, count);
+			writer.Patch(sizeOffset, (uint32_t)(writer.GetSize() - payloadStart));
+
+			// resource references and custom-handled state
+			component->WriteSnapshot(writer);
+		}
+	}
+
+	bool SceneCheckpoint::ReadActor(SnapshotReader& reader, Actor& actor) {
+		std::string name;
+		std::string tag;
+		reader.Read(name);
+		reader.Read(tag);
+		actor.name = InternedString{ name };
+		actor.tag = InternedString{ tag };
+
+		reader.Read(actor.active);
+		reader.Read(actor.persistent);
+		reader.Read(actor.isStatic);
+		reader.Read(actor.canSleep);
+		reader.Read(actor.fullRateUpdate);
+		reader.Read(actor.lifespan);
+
+		reader.Read(actor.transform.position);
+		reader.Read(actor.transform.rotationq);
+		reader.Read(actor.transform.scale);
+
+		reader.Read(actor.parentName);
+
+		uint32_t componentCount = 0;
+		reader.Read(componentCount);
+		for (uint32_t i = 0; i < componentCount; i++) {
+			component_type_t typeId = invalidComponentType;
+			bool active = true;
+			reader.Read(typeId);
+			reader.Read(active);
+
+			// components rebuild by dense creator id - no class name in the
+			// blob, no string lookup per component
+			auto creator = Factory::Instance().GetComponentCreator(typeId);
+			auto component = (creator != Factory::kInvalidTypeId) ?
+				Factory::Instance().Create<Component>(creator) : nullptr;
+			if (!component) {
+				// the snapshot-hook payload after the fields has no framing,
+				// so an unknown type poisons the rest of the blob
+				LOG_CAT_WARNING(Scene, "Checkpoint actor '{}' has unknown component type {}", name, typeId);
+				return false;
+			}
+			component->active = active;
+
+			uint32_t fieldBytes = 0;
+			reader.Read(fieldBytes);
+			size_t fieldEnd = reader.GetOffset() + fieldBytes;
+
+			size_t count = 0;
+			const serial::FieldDescriptor* fields = serial::FieldTables::Get(typeId, count);
+			if (fields) ReadFields(reader, component.get(), fields, count);
+			reader.Seek(fieldEnd);
+
+			component->ReadSnapshot(reader);
+			actor.AddComponent(std::move(component));
+		}
+
+		return reader.IsValid();
+	}
+
+	bool SceneCheckpoint::Restore(Scene& scene) {
+		if (!m_completed.complete) return false;
+
+		PROFILE_SCOPE("SceneCheckpoint::Restore");
+
+		// an in-flight capture was walking the population we're about to
+		// tear down - abandon it, the completed checkpoint is the truth
+		m_capturing = false;
+
+		// everything captured comes back, so everything live goes -
+		// persistent actors are in the checkpoint like the rest
+		scene.RemoveAllActors(true);
+
+		// rebuild through the pooled spawn path with Start() deferred, so
+		// parent names resolve against the full restored population - the
+		// same shape as a scene load
+		std::vector<Actor*> restored;
+		restored.reserve(m_completed.entries.size());
+		for (auto& entry : m_completed.entries) {
+			SnapshotReader reader{ m_completed.arena.data() + entry.offset, entry.size };
+			auto actor = std::make_unique<Actor>();
+			if (!ReadActor(reader, *actor)) {
+				LOG_CAT_WARNING(Scene, "Checkpoint blob for actor '{}' did not replay cleanly", actor->name);
+				continue;
+			}
+			restored.push_back(scene.AddActor(std::move(actor), false));
+		}
+		for (auto actor : restored) actor->Start();
+
+		LOG_CAT_INFO(Scene, "Checkpoint restored: {} actors", restored.size());
+		return true;
+	}
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include "Actor.h"
+#include "Snapshot.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace neu {
+	class ActorPool;
+
+	/// <summary>
+	/// Binary checkpoint of a scene's actor population.
+	///
+	/// Round-tripping the scene through rapidjson would hitch for hundreds
+	/// of milliseconds, so checkpoints bypass text entirely: each actor is
+	/// flattened into a blob in one arena buffer - plain fields through the
+	/// component field descriptor tables (registered as a side effect of
+	/// deserialization, see serial::FieldTables), resource references and
+	/// named enums through the component snapshot hooks.
+	///
+	/// Capture is incremental: BeginCapture starts a walk over the pool and
+	/// each UpdateCapture call (once per frame from Scene::Update) captures
+	/// actors until a small time budget is spent, so no single frame pays
+	/// the full cost. Sleeping and static actors whose slot is unchanged
+	/// since the last completed checkpoint reuse their old blob bytes
+	/// without re-serializing - in a mostly-static level the steady-state
+	/// capture is mostly memcpy. Actors spawned behind the cursor or
+	/// destroyed mid-capture land in the next checkpoint, which is the
+	/// precision a capture spread over frames can honestly claim.
+	///
+	/// Restore tears the population down and rebuilds every captured actor
+	/// through the pooled spawn path - components recreated by dense
+	/// factory id, Start() run as one batch so parent names resolve against
+	/// the full population, exactly like a scene load.
+	///
+	/// Checkpoints are in-memory and per-run only: the blob format has no
+	/// versioning and component type ids are stable only within a session.
+	/// </summary>
+	class SceneCheckpoint {
+	public:
+		/// <summary>
+		/// Starts (or restarts) an incremental capture from slot 0. The
+		/// previous completed checkpoint stays restorable, and its blobs
+		/// back the copy-on-write reuse, until the new capture completes.
+		/// </summary>
+		void BeginCapture(ActorPool& actors);
+
+		/// <summary>
+		/// Advances an in-flight capture a budgeted slice - called once per
+		/// frame by Scene::Update after destroyed-actor cleanup, so removed
+		/// actors never enter the snapshot.
+		/// </summary>
+		void UpdateCapture(ActorPool& actors);
+
+		/// <summary>
+		/// Rebuilds the scene's actors from the last completed checkpoint.
+		/// Abandons any in-flight capture. Must not be called while the
+		/// scene update loop is iterating the pool.
+		/// </summary>
+		/// <returns>true if a completed checkpoint existed and was applied</returns>
+		bool Restore(class Scene& scene);
+
+		bool IsCapturing() const { return m_capturing; }
+		bool HasCheckpoint() const { return m_completed.complete; }
+
+		// arena size of the last completed checkpoint, for the editor readout
+		size_t GetBytes() const { return m_completed.arena.size(); }
+		size_t GetActorCount() const { return m_completed.entries.size(); }
+
+	private:
+		/// <summary>
+		/// One captured actor: its blob's extent in the arena, keyed by the
+		/// generational handle so the next capture can tell "same actor,
+		/// unchanged slot" from a reused slot.
+		/// </summary>
+		struct Entry {
+			ActorHandle handle;
+			uint32_t offset{ 0 };
+			uint32_t size{ 0 };
+		};
+
+		struct Snapshot {
+			std::vector<uint8_t> arena;
+			std::vector<Entry> entries;
+			bool complete{ false };
+		};
+
+		void CaptureActor(Actor* actor, ActorPool& pool);
+		static void WriteActor(SnapshotWriter& writer, Actor* actor, ActorPool& pool);
+		static bool ReadActor(SnapshotReader& reader, Actor& actor);
+
+		// last completed checkpoint (what Restore applies) and the capture
+		// being built - swapped when the building walk finishes
+		Snapshot m_completed;
+		Snapshot m_building;
+
+		// previous checkpoint's entries by handle, for copy-on-write reuse
+		std::unordered_map<uint64_t, size_t> m_previousEntries;
+
+		// pool slot the in-flight capture resumes from next frame
+		uint32_t m_cursor{ 0 };
+		bool m_capturing{ false };
+	};
+}
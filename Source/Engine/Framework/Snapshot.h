@@ -0,0 +1,104 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace neu {
+	/// <summary>
+	/// Appends plain values and strings to a growing byte buffer - the
+	/// binary checkpoint capture format. Deliberately trivial: checkpoint
+	/// blobs live for one run, never touch disk, and are replayed by
+	/// SnapshotReader in the same build, so there is no versioning, no
+	/// endianness handling and no schema - just bytes in declaration order.
+	/// </summary>
+	class SnapshotWriter {
+	public:
+		SnapshotWriter(std::vector<uint8_t>& buffer) :
+			m_buffer{ buffer }
+		{
+		}
+
+		template<typename T>
+			requires std::is_trivially_copyable_v<T>
+		void Write(const T& value) {
+			size_t offset = m_buffer.size();
+			m_buffer.resize(offset + sizeof(T));
+			std::memcpy(m_buffer.data() + offset, &value, sizeof(T));
+		}
+
+		// length-prefixed, so the reader never scans for terminators
+		void Write(const std::string& value) {
+			Write((uint32_t)value.size());
+			m_buffer.insert(m_buffer.end(), value.begin(), value.end());
+		}
+
+		size_t GetSize() const { return m_buffer.size(); }
+
+		/// <summary>
+		/// Overwrites a value written earlier at a known offset - used to
+		/// patch size fields whose payload length isn't known up front.
+		/// </summary>
+		template<typename T>
+			requires std::is_trivially_copyable_v<T>
+		void Patch(size_t offset, const T& value) {
+			std::memcpy(m_buffer.data() + offset, &value, sizeof(T));
+		}
+
+	private:
+		std::vector<uint8_t>& m_buffer;
+	};
+
+	/// <summary>
+	/// Replays a SnapshotWriter byte stream. Reads past the end clamp,
+	/// leave outputs untouched and latch the overrun flag - callers check
+	/// IsValid() once at the end of a blob instead of per read.
+	/// </summary>
+	class SnapshotReader {
+	public:
+		SnapshotReader(const uint8_t* data, size_t size) :
+			m_data{ data },
+			m_size{ size }
+		{
+		}
+
+		template<typename T>
+			requires std::is_trivially_copyable_v<T>
+		bool Read(T& value) {
+			if (m_offset + sizeof(T) > m_size) {
+				m_overrun = true;
+				return false;
+			}
+			std::memcpy(&value, m_data + m_offset, sizeof(T));
+			m_offset += sizeof(T);
+			return true;
+		}
+
+		bool Read(std::string& value) {
+			uint32_t length = 0;
+			if (!Read(length) || m_offset + length > m_size) {
+				m_overrun = true;
+				return false;
+			}
+			value.assign((const char*)(m_data + m_offset), length);
+			m_offset += length;
+			return true;
+		}
+
+		// cursor access, so size-prefixed sections can be skipped wholesale
+		size_t GetOffset() const { return m_offset; }
+		void Seek(size_t offset) {
+			if (offset > m_size) m_overrun = true;
+			else m_offset = offset;
+		}
+
+		bool IsValid() const { return !m_overrun; }
+
+	private:
+		const uint8_t* m_data{ nullptr };
+		size_t m_size{ 0 };
+		size_t m_offset{ 0 };
+		bool m_overrun{ false };
+	};
+}
@@ -0,0 +1,248 @@
+#include "Task.h"
+#include "Event/EventManager.h"
+#include "Core/Logger.h"
+#include "Core/Profiler.h"
+
+namespace neu {
+	void Task::promise_type::unhandled_exception() {
+		// tasks are gameplay glue - an escaped exception kills the task,
+		// not the frame
+		LOG_ERROR("unhandled exception escaped a Task, task abandoned");
+		m_done = true;
+	}
+
+	Task& Task::operator=(Task&& other) noexcept {
+		if (this != &other) {
+			Reset();
+			m_handle = other.m_handle;
+			other.m_handle = nullptr;
+		}
+		return *this;
+	}
+
+	void Task::Reset() {
+		if (!m_handle) return;
+
+		// pull the suspended coroutine off its wait list before freeing
+		// the frame - the scheduler must never resume a dead handle
+		if (!m_handle.promise().m_done) TaskScheduler::Instance().CancelWait(m_handle);
+
+		m_handle.destroy();
+		m_handle = nullptr;
+	}
+
+	void WaitSeconds::await_suspend(Task::handle_t handle) {
+		TaskScheduler::Instance().AddTimerWait(handle, seconds);
+	}
+
+	void NextFrame::await_suspend(Task::handle_t handle) {
+		TaskScheduler::Instance().AddReady(handle);
+	}
+
+	void WaitForEvent::await_suspend(Task::handle_t handle) {
+		handle.promise().m_eventId = id;
+		TaskScheduler::Instance().AddEventWait(handle, this);
+	}
+
+	void WaitUntil::await_suspend(Task::handle_t handle) {
+		TaskScheduler::Instance().AddPollWait(handle, condition);
+	}
+
+	void TaskScheduler::Update(float dt) {
+		// due delay timers push their handles into the ready list
+		m_timers.Update(dt);
+
+		// polled waits - swap-remove as conditions come true
+		for (size_t i = 0; i < m_pollWaits.size(); ) {
+			if (m_pollWaits[i].condition()) {
+				AddReady(m_pollWaits[i].handle);
+				m_pollWaits[i] = std::move(m_pollWaits.back());
+				m_pollWaits.pop_back();
+			}
+			else {
+				i++;
+			}
+		}
+
+		// resume this frame's batch. Only the entries present now run -
+		// tasks woken during the batch (a resumed task fired an event, or
+		// co_awaited NextFrame) land behind `count` and wait a frame. A
+		// resumed task may cancel another woken task mid-batch, so entries
+		// are nulled on cancel and skipped here
+		size_t count = m_ready.size();
+		for (size_t i = 0; i < count; i++) {
+			Task::handle_t handle = m_ready[i];
+			if (!handle) continue;
+
+			handle.promise().m_wait = Task::promise_type::Wait::None;
+			handle.resume();
+		}
+		m_ready.erase(m_ready.begin(), m_ready.begin() + count);
+	}
+
+	void TaskScheduler::OnNotify(const Event& event) {
+		auto iter = m_eventWaits.find(event.id);
+		if (iter == m_eventWaits.end()) return;
+
+		// wake every waiter, handing each its copy of the event - the
+		// awaiter lives in the suspended frame, valid until resume
+		for (auto& wait : iter->second) {
+			wait.awaiter->event = event;
+			AddReady(wait.handle);
+		}
+		m_eventWaitCount -= iter->second.size();
+		iter->second.clear();
+	}
+
+	void TaskScheduler::AddTimerWait(Task::handle_t handle, float seconds) {
+		handle.promise().m_wait = Task::promise_type::Wait::Timer;
+		handle.promise().m_timer = m_timers.Schedule(seconds, [this, handle] {
+			AddReady(handle);
+		});
+	}
+
+	void TaskScheduler::AddEventWait(Task::handle_t handle, WaitForEvent* awaiter) {
+		handle.promise().m_wait = Task::promise_type::Wait::Event;
+
+		// first wait on an id registers this scheduler as the observer;
+		// the map entry persists as the registration marker (the
+		// subscription handle parks on the scheduler and releases with it)
+		auto [iter, inserted] = m_eventWaits.try_emplace(awaiter->id);
+		if (inserted) EventManager::Instance().AddObserver(awaiter->id, *this);
+
+		iter->second.push_back({ handle, awaiter });
+		m_eventWaitCount++;
+	}
+
+	void TaskScheduler::AddPollWait(Task::handle_t handle, std::function<bool()> condition) {
+		handle.promise().m_wait = Task::promise_type::Wait::Poll;
+		m_pollWaits.push_back({ handle, std::move(condition) });
+	}
+
+	void TaskScheduler::AddReady(Task::handle_t handle) {
+		handle.promise().m_wait = Task::promise_type::Wait::Ready;
+		m_ready.push_back(handle);
+	}
+
+	void TaskScheduler::CancelWait(Task::handle_t handle) {
+		auto& promise = handle.promise();
+
+		switch (promise.m_wait) {
+		case Task::promise_type::Wait::Timer:
+			m_timers.Cancel(promise.m_timer);
+			break;
+
+		case Task::promise_type::Wait::Event: {
+			auto iter = m_eventWaits.find(promise.m_eventId);
+			if (iter != m_eventWaits.end()) {
+				std::erase_if(iter->second, [&](const EventWait& wait) {
+					if (wait.handle != handle) return false;
+					m_eventWaitCount--;
+					return true;
+				});
+			}
+			break;
+		}
+
+		case Task::promise_type::Wait::Poll:
+			std::erase_if(m_pollWaits, [&](const PollWait& wait) { return wait.handle == handle; });
+			break;
+
+		case Task::promise_type::Wait::Ready:
+			// woken but not yet resumed - null the slot so a batch in
+			// progress skips it (indices must stay stable mid-batch)
+			for (auto& ready : m_ready) {
+				if (ready == handle) ready = nullptr;
+			}
+			break;
+
+		case Task::promise_type::Wait::Work:
+			WorkScheduler::Instance().CancelWait(handle);
+			break;
+
+		case Task::promise_type::Wait::None:
+			break;
+		}
+
+		promise.m_wait = Task::promise_type::Wait::None;
+	}
+
+	void WorkScheduler::Update(float dt) {
+		if (GetPendingCount() == 0) return;
+
+		PROFILE_SCOPE("WorkScheduler::Update");
+
+		// age deadlines before building the run order
+		for (auto& queue : m_queues) {
+			for (auto& unit : queue) {
+				if (unit.hasDeadline) unit.deadline -= dt;
+			}
+		}
+
+		// take this frame's run order into a scratch list first - resumed
+		// coroutines re-enqueue through AddWork, which must not mutate a
+		// queue mid-iteration. Deadline-expired units go first regardless
+		// of priority, then High through Low in FIFO order
+		m_runList.clear();
+		for (auto& queue : m_queues) {
+			for (auto& unit : queue) {
+				if (unit.hasDeadline && unit.deadline <= 0) m_runList.push_back(unit);
+			}
+		}
+		for (auto& queue : m_queues) {
+			for (auto& unit : queue) {
+				if (!(unit.hasDeadline && unit.deadline <= 0)) m_runList.push_back(unit);
+			}
+			queue.clear();
+		}
+
+		m_sliceStart = Profiler::Now();
+		m_inSlice = true;
+
+		for (auto& unit : m_runList) {
+			if (!unit.handle) continue;	// cancelled mid-slice
+
+			// expired deadlines run even with the budget gone - the
+			// minimum-progress guarantee; everything else re-parks
+			// untouched once time is up
+			bool mustRun = unit.hasDeadline && unit.deadline <= 0;
+			if (!mustRun && IsBudgetSpent()) {
+				m_queues[(size_t)unit.priority].push_back(unit);
+				continue;
+			}
+
+			// the resume runs until the coroutine yields again (re-parking
+			// itself if over budget), finishes, or awaits something else
+			unit.handle.promise().m_wait = Task::promise_type::Wait::None;
+			unit.handle.resume();
+		}
+
+		m_runList.clear();
+		m_inSlice = false;
+	}
+
+	bool WorkScheduler::IsBudgetSpent() const {
+		// outside the slice heavy work always parks - a task body that
+		// starts synchronously moves to the budget on its first yield
+		if (!m_inSlice) return true;
+
+		return (Profiler::Now() - m_sliceStart) >= (uint64_t)(m_budgetSeconds * 1000000.0f);
+	}
+
+	void WorkScheduler::AddWork(Task::handle_t handle, WorkPriority priority, float deadlineSeconds) {
+		handle.promise().m_wait = Task::promise_type::Wait::Work;
+		m_queues[(size_t)priority].push_back({ handle, priority, deadlineSeconds, deadlineSeconds > 0 });
+	}
+
+	void WorkScheduler::CancelWait(Task::handle_t handle) {
+		for (auto& queue : m_queues) {
+			std::erase_if(queue, [&](const WorkUnit& unit) { return unit.handle == handle; });
+		}
+
+		// a slice in progress skips nulled entries - indices must stay
+		// stable while the run list is being drained
+		for (auto& unit : m_runList) {
+			if (unit.handle == handle) unit.handle = nullptr;
+		}
+	}
+}
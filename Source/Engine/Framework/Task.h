@@ -0,0 +1,409 @@
+#pragma once
+#include "TimerWheel.h"
+#include "Event/Event.h"
+#include "Event/Observer.h"
+#include "Core/Singleton.h"
+
+#include <chrono>
+#include <coroutine>
+#include <functional>
+#include <future>
+#include <unordered_map>
+#include <vector>
+
+namespace neu {
+	/// <summary>
+	/// Coroutine handle for multi-frame gameplay logic.
+	///
+	/// Gameplay sequences written as polled state machines pay an Update
+	/// call every frame while mostly waiting. A Task is the same sequence
+	/// written straight-line: the body runs until it co_awaits a delay, an
+	/// event or a future, suspends at zero per-frame cost, and resumes when
+	/// the wait completes. The TaskScheduler batches every resumption at
+	/// one point in Engine::Update, so task code always runs on the main
+	/// thread right before the scene update.
+	///
+	/// ```cpp
+	/// Task SpawnWave() {
+	///     co_await WaitSeconds{ 2.0f };
+	///     for (int i = 0; i < 5; i++) {
+	///         SpawnEnemy();
+	///         co_await WaitSeconds{ 0.5f };
+	///     }
+	///     Event event = co_await WaitForEvent{ EVENT_ID(wave_cleared) };
+	/// }
+	/// ```
+	///
+	/// The returned Task owns the coroutine: a component stores it as a
+	/// member and the wait is cancelled and the frame freed when the Task
+	/// is destroyed or reassigned, so a destroyed component can never be
+	/// resumed. Start a sequence simply by assigning: m_task = SpawnWave();
+	/// </summary>
+	class [[nodiscard]] Task {
+	public:
+		class promise_type;
+		using handle_t = std::coroutine_handle<promise_type>;
+
+		/// <summary>
+		/// Coroutine promise. Besides the usual machinery it records which
+		/// scheduler wait list the suspended coroutine sits on, so
+		/// cancellation can remove it from the right place.
+		/// </summary>
+		class promise_type {
+		public:
+			Task get_return_object() { return Task{ handle_t::from_promise(*this) }; }
+
+			// the body runs synchronously until its first co_await, so a
+			// task that can act immediately does - same frame it started
+			std::suspend_never initial_suspend() noexcept { return {}; }
+
+			// suspend at the end so the frame survives for IsDone queries;
+			// the owning Task destroys it
+			std::suspend_always final_suspend() noexcept { m_done = true; return {}; }
+
+			void return_void() {}
+			void unhandled_exception();
+
+			/// <summary>
+			/// Which scheduler list the suspended coroutine is parked on.
+			/// </summary>
+			enum class Wait : uint8_t {
+				None,   // running, or never suspended
+				Timer,  // in the scheduler's timer wheel
+				Event,  // on an event wait list
+				Poll,   // on the polled-condition list
+				Ready,  // woken, queued for the next resume batch
+				Work    // parked on the budgeted work scheduler
+			};
+
+			Wait m_wait{ Wait::None };
+			TimerWheel::TimerHandle m_timer;
+			Event::id_t m_eventId{ 0 };
+			bool m_done{ false };
+		};
+
+		Task() = default;
+		explicit Task(handle_t handle) : m_handle{ handle } {}
+
+		// move-only owner of the coroutine frame
+		Task(const Task&) = delete;
+		Task& operator=(const Task&) = delete;
+		Task(Task&& other) noexcept : m_handle{ other.m_handle } { other.m_handle = nullptr; }
+		Task& operator=(Task&& other) noexcept;
+
+		~Task() { Reset(); }
+
+		/// <summary>
+		/// Whether this Task holds a live coroutine (finished or not).
+		/// </summary>
+		bool IsValid() const { return m_handle != nullptr; }
+
+		/// <summary>
+		/// Whether the coroutine ran to completion. False while suspended
+		/// or when no coroutine is held.
+		/// </summary>
+		bool IsDone() const { return m_handle && m_handle.promise().m_done; }
+
+		/// <summary>
+		/// Cancels any pending wait and destroys the coroutine frame. A
+		/// suspended task simply never resumes - no cleanup code after the
+		/// pending co_await runs. Safe on an empty Task.
+		/// </summary>
+		void Reset();
+
+	private:
+		handle_t m_handle;
+	};
+
+	/// <summary>
+	/// Awaitable delay: co_await WaitSeconds{ 2.0f }. Schedules into the
+	/// task scheduler's timing wheel, so thousands of sleeping tasks cost
+	/// nothing per frame until their tick comes due. Zero and negative
+	/// delays resume on the next frame's batch.
+	/// </summary>
+	struct WaitSeconds {
+		float seconds{ 0 };
+
+		bool await_ready() const noexcept { return false; }
+		void await_suspend(Task::handle_t handle);
+		void await_resume() const noexcept {}
+	};
+
+	/// <summary>
+	/// Awaitable frame boundary: co_await NextFrame{}. Resumes in the next
+	/// frame's batch - the coroutine equivalent of returning from Update.
+	/// </summary>
+	struct NextFrame {
+		bool await_ready() const noexcept { return false; }
+		void await_suspend(Task::handle_t handle);
+		void await_resume() const noexcept {}
+	};
+
+	/// <summary>
+	/// Awaitable event: co_await WaitForEvent{ EVENT_ID(wave_cleared) }.
+	/// Parks on the scheduler's per-id wait list and resumes on the frame
+	/// the event dispatches, evaluating to a copy of the event. Costs
+	/// nothing while waiting - no observer code runs per frame.
+	/// </summary>
+	struct WaitForEvent {
+		Event::id_t id{ 0 };
+		Event event;	// written by the scheduler when the event fires
+
+		bool await_ready() const noexcept { return false; }
+		void await_suspend(Task::handle_t handle);
+		Event await_resume() const { return event; }
+	};
+
+	/// <summary>
+	/// Awaitable condition: co_await WaitUntil{ [&] { return door.open; } }.
+	/// The scheduler evaluates the condition once per frame - the fallback
+	/// for waits with no completion signal to hook. Prefer the timer,
+	/// event and future awaitables, which don't poll.
+	/// </summary>
+	struct WaitUntil {
+		std::function<bool()> condition;
+
+		bool await_ready() const { return condition && condition(); }
+		void await_suspend(Task::handle_t handle);
+		void await_resume() const noexcept {}
+	};
+
+	/// <summary>
+	/// Awaitable future, the resource-load bridge:
+	///     auto model = co_await WaitFor(Resources().GetAsync&lt;Model&gt;("m.nmdl"));
+	/// Suspends until the future resolves (checked once per frame with a
+	/// zero-timeout wait) and evaluates to the future's value. Loads that
+	/// already completed don't suspend at all.
+	/// </summary>
+	template<typename T>
+	struct FutureAwaiter {
+		std::shared_future<T> future;
+
+		bool await_ready() const {
+			return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+		}
+		void await_suspend(Task::handle_t handle);
+		T await_resume() const { return future.get(); }
+	};
+
+	template<typename T>
+	FutureAwaiter<T> WaitFor(std::shared_future<T> future) { return { std::move(future) }; }
+
+	/// <summary>
+	/// Wakes and resumes suspended tasks at one point in the frame.
+	///
+	/// Delays park in a timing wheel (only the due slot is touched per
+	/// tick), event waits park on per-id lists fed by the EventManager,
+	/// and future/condition waits sit on a polled list that only holds
+	/// tasks actually waiting on one. Wakes from any source queue into a
+	/// ready list, and Update() - called by Engine::Update right before
+	/// the scene update - resumes the batch on the main thread. A task
+	/// woken during the batch (by a resumed task's event, or NextFrame)
+	/// waits for the next frame, so resumption order stays deterministic.
+	/// </summary>
+	class TaskScheduler : public Singleton<TaskScheduler>, public IObserver {
+	public:
+		/// <summary>
+		/// Advances delay timers, polls conditions and futures, and
+		/// resumes every task woken since the last call. Called once per
+		/// frame by Engine::Update before the scene update.
+		/// </summary>
+		/// <param name="dt">Elapsed seconds since the last update</param>
+		void Update(float dt);
+
+		/// <summary>
+		/// Wakes tasks waiting on the event's id. Runs from the
+		/// EventManager's dispatch; the tasks resume in the next batch.
+		/// </summary>
+		void OnNotify(const Event& event) override;
+
+		// suspended tasks across all wait lists, for the editor overlay
+		size_t GetWaitingCount() const {
+			return m_timers.GetPendingCount() + m_eventWaitCount + m_pollWaits.size() + m_ready.size();
+		}
+
+		// registration entry points for the awaitables above
+		void AddTimerWait(Task::handle_t handle, float seconds);
+		void AddEventWait(Task::handle_t handle, WaitForEvent* awaiter);
+		void AddPollWait(Task::handle_t handle, std::function<bool()> condition);
+		void AddReady(Task::handle_t handle);
+
+		/// <summary>
+		/// Removes a suspended coroutine from whichever wait list holds it.
+		/// Called by Task::Reset before destroying the frame, so the
+		/// scheduler never resumes a dead handle.
+		/// </summary>
+		void CancelWait(Task::handle_t handle);
+
+	private:
+		friend class Singleton<TaskScheduler>;
+		TaskScheduler() = default;
+
+		// delay waits - same wheel the scene's timer service uses, so a
+		// frame's cost scales with the tasks actually due
+		TimerWheel m_timers;
+
+		// woken handles awaiting the next resume batch; entries cancelled
+		// mid-batch are nulled rather than erased so indices stay stable
+		std::vector<Task::handle_t> m_ready;
+
+		// event waits by id - the awaiter pointer receives the event copy.
+		// Map entries persist once created, marking ids this scheduler
+		// already observes with the EventManager
+		struct EventWait {
+			Task::handle_t handle;
+			WaitForEvent* awaiter;
+		};
+		std::unordered_map<Event::id_t, std::vector<EventWait>> m_eventWaits;
+		size_t m_eventWaitCount{ 0 };
+
+		// polled waits - conditions and futures with no wake signal
+		struct PollWait {
+			Task::handle_t handle;
+			std::function<bool()> condition;
+		};
+		std::vector<PollWait> m_pollWaits;
+	};
+
+	template<typename T>
+	inline void FutureAwaiter<T>::await_suspend(Task::handle_t handle) {
+		TaskScheduler::Instance().AddPollWait(handle, [future = future] {
+			return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+		});
+	}
+
+	/// <summary>
+	/// Priority of budgeted work - the scheduler drains High before Normal
+	/// before Low within each frame's budget.
+	/// </summary>
+	enum class WorkPriority : uint8_t {
+		High,
+		Normal,
+		Low
+	};
+
+	/// <summary>
+	/// Awaitable budget check for heavy, sliceable computations:
+	///
+	/// ```cpp
+	/// Task RebuildInfluenceMap() {
+	///     for (auto& cell : m_cells) {
+	///         IntegrateCell(cell);
+	///         co_await YieldWork{ WorkPriority::Low };
+	///     }
+	/// }
+	/// ```
+	///
+	/// Inside the work scheduler's slice with budget left, the co_await
+	/// continues inline at the cost of one clock read - no suspension.
+	/// When the budget is spent (or the coroutine is running outside the
+	/// slice, e.g. the frame it started), it parks on the work scheduler
+	/// and resumes in a later frame's budget - a multi-millisecond lump
+	/// becomes smooth amortized cost with no manual slicing.
+	///
+	/// deadlineSeconds > 0 caps starvation until the next slice: a unit
+	/// whose deadline expires is guaranteed one resume per frame even when
+	/// higher-priority work has consumed the whole budget. Each yield
+	/// starts a fresh deadline.
+	/// </summary>
+	struct YieldWork {
+		WorkPriority priority{ WorkPriority::Normal };
+		float deadlineSeconds{ 0 };		// 0 = starve freely
+
+		bool await_ready() const;
+		void await_suspend(Task::handle_t handle);
+		void await_resume() const noexcept {}
+	};
+
+	/// <summary>
+	/// Time-sliced executor for heavy gameplay computations.
+	///
+	/// Work is a plain Task whose body co_awaits YieldWork at sliceable
+	/// points; the scheduler resumes parked work inside a configurable
+	/// per-frame budget (measured with the profiler's clock), converting
+	/// one-frame spikes from influence map rebuilds, procedural generation
+	/// steps and the like into a bounded cost every frame. Three priority
+	/// queues drain in order, FIFO within each, and deadline-expired units
+	/// run first regardless of priority or remaining budget so nothing is
+	/// starved indefinitely. Runs from Engine::Update right after the
+	/// TaskScheduler batch, so sliced work still lands before the scene
+	/// update of the frame it runs in.
+	/// </summary>
+	class WorkScheduler : public Singleton<WorkScheduler> {
+	public:
+		/// <summary>
+		/// Runs parked work until the frame budget is spent. Called once
+		/// per frame by Engine::Update after the task resume batch.
+		/// </summary>
+		/// <param name="dt">Elapsed seconds since the last update, ages deadlines</param>
+		void Update(float dt);
+
+		/// <summary>
+		/// Per-frame work budget in seconds. The default (half a
+		/// millisecond) is sized for a 60 Hz frame with headroom to spare;
+		/// loading screens can raise it to burn through queued generation.
+		/// </summary>
+		void SetBudget(float seconds) { m_budgetSeconds = seconds; }
+		float GetBudget() const { return m_budgetSeconds; }
+
+		/// <summary>
+		/// True once the current slice has spent its budget - and always
+		/// true outside the slice, so heavy loops only ever advance inside
+		/// the scheduler's budget.
+		/// </summary>
+		bool IsBudgetSpent() const;
+
+		// parked work units across all priorities, for the editor overlay
+		size_t GetPendingCount() const {
+			return m_queues[0].size() + m_queues[1].size() + m_queues[2].size();
+		}
+
+		// registration entry point for the YieldWork awaitable
+		void AddWork(Task::handle_t handle, WorkPriority priority, float deadlineSeconds);
+
+		/// <summary>
+		/// Removes a parked coroutine from its priority queue (or nulls its
+		/// slot in a slice in progress). Routed through
+		/// TaskScheduler::CancelWait, so Task::Reset covers work waits too.
+		/// </summary>
+		void CancelWait(Task::handle_t handle);
+
+	private:
+		friend class Singleton<WorkScheduler>;
+		WorkScheduler() = default;
+
+		/// <summary>
+		/// One parked resumption point of a sliced computation.
+		/// </summary>
+		struct WorkUnit {
+			Task::handle_t handle;
+			WorkPriority priority{ WorkPriority::Normal };
+			float deadline{ 0 };		// seconds until guaranteed progress
+			bool hasDeadline{ false };
+		};
+
+		// FIFO per priority - resumed units re-enqueue behind work that
+		// hasn't run yet, so units in a band round-robin
+		std::vector<WorkUnit> m_queues[3];
+
+		// this frame's run order, drained by Update - a separate list
+		// because resumed coroutines re-enqueue into m_queues mid-slice.
+		// Cancelled entries are nulled, not erased
+		std::vector<WorkUnit> m_runList;
+
+		float m_budgetSeconds{ 0.0005f };
+
+		// profiler clock at the top of the current slice (microseconds)
+		uint64_t m_sliceStart{ 0 };
+		bool m_inSlice{ false };
+	};
+
+	inline bool YieldWork::await_ready() const {
+		// budget left - keep running inline, no suspension
+		return !WorkScheduler::Instance().IsBudgetSpent();
+	}
+
+	inline void YieldWork::await_suspend(Task::handle_t handle) {
+		WorkScheduler::Instance().AddWork(handle, priority, deadlineSeconds);
+	}
+}
@@ -0,0 +1,102 @@
+#include "TimerWheel.h"
+#include <cmath>
+
+namespace neu {
+
+	TimerWheel::TimerHandle TimerWheel::Schedule(float seconds, std::function<void()> callback) {
+		// quantize up so a timer never fires early; zero/negative delays
+		// land on the next tick
+		uint64_t ticks = (seconds > 0) ? (uint64_t)std::ceil(seconds / kTickSeconds) : 1;
+
+		// pop a recycled entry or grow the slab
+		uint32_t index;
+		if (!m_freeList.empty()) {
+			index = m_freeList.back();
+			m_freeList.pop_back();
+		}
+		else {
+			index = (uint32_t)m_timers.size();
+			m_timers.push_back({});
+		}
+
+		Timer& timer = m_timers[index];
+		timer.dueTick = m_tick + ticks;
+		timer.callback = std::move(callback);
+		timer.pending = true;
+
+		m_slots[timer.dueTick & (kSlotCount - 1)].push_back(index);
+		m_pendingCount++;
+
+		return { index, timer.generation };
+	}
+
+	void TimerWheel::Cancel(TimerHandle handle) {
+		if (!IsPending(handle)) return;
+
+		// mark dead and drop the callback now; the slot entry stays behind
+		// and is swept when its tick comes around - O(1) cancel, no search
+		Timer& timer = m_timers[handle.index];
+		timer.pending = false;
+		timer.callback = nullptr;
+		timer.generation++;
+		m_pendingCount--;
+	}
+
+	void TimerWheel::Update(float dt) {
+		m_accumulator += dt;
+
+		while (m_accumulator >= kTickSeconds) {
+			m_accumulator -= kTickSeconds;
+			m_tick++;
+
+			auto& slot = m_slots[m_tick & (kSlotCount - 1)];
+			if (slot.empty()) continue;
+
+			// split the slot: due timers move to the scratch list, timers
+			// parked for a later rotation (and cancelled leftovers) compact
+			// in place. Collecting first keeps the slot consistent while
+			// callbacks below schedule into it
+			m_due.clear();
+			size_t keep = 0;
+			for (uint32_t index : slot) {
+				Timer& timer = m_timers[index];
+				if (!timer.pending) {
+					// cancelled - recycle the entry here
+					m_freeList.push_back(index);
+					continue;
+				}
+				if (timer.dueTick != m_tick) {
+					slot[keep++] = index;
+					continue;
+				}
+				m_due.push_back(index);
+			}
+			slot.resize(keep);
+
+			for (uint32_t index : m_due) {
+				Timer& timer = m_timers[index];
+
+				// retire before invoking so the callback sees its own
+				// handle as stale and can schedule follow-ups freely
+				auto callback = std::move(timer.callback);
+				timer.pending = false;
+				timer.callback = nullptr;
+				timer.generation++;
+				m_freeList.push_back(index);
+				m_pendingCount--;
+
+				if (callback) callback();
+			}
+		}
+	}
+
+	void TimerWheel::Clear() {
+		for (auto& slot : m_slots) slot.clear();
+		m_timers.clear();
+		m_freeList.clear();
+		m_due.clear();
+		m_tick = 0;
+		m_accumulator = 0;
+		m_pendingCount = 0;
+	}
+}
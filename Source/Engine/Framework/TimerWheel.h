@@ -0,0 +1,115 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace neu {
+	/// <summary>
+	/// Hashed timing wheel for one-shot expirations.
+	///
+	/// Timers register once with a delay and a callback; Update() converts
+	/// elapsed time into fixed ticks and touches only the slot each tick
+	/// lands on, so a frame's cost scales with the timers actually due, not
+	/// the timers outstanding. Actor lifespans route through the scene's
+	/// wheel instead of a per-actor countdown in Update, and gameplay
+	/// components can schedule their own timers the same way.
+	///
+	/// Handles are generational (slot index + generation), matching the
+	/// actor pool's pattern - a handle to a fired or cancelled timer goes
+	/// stale instead of aliasing a reused entry. Callbacks run on the main
+	/// thread from Update() and may schedule or cancel timers freely.
+	/// </summary>
+	class TimerWheel {
+	public:
+		// wheel resolution - expirations quantize up to the next tick
+		static constexpr float kTickSeconds = 1.0f / 60.0f;
+
+		// slots on the wheel (power of two so the slot index is a mask);
+		// delays longer than a full rotation just stay parked in their slot
+		// across rotations until their due tick comes around
+		static constexpr uint64_t kSlotCount = 256;
+
+		/// <summary>
+		/// Generational handle to a scheduled timer. Stale once the timer
+		/// fires or is cancelled.
+		/// </summary>
+		struct TimerHandle {
+			uint32_t index{ 0xffffffff };
+			uint32_t generation{ 0 };
+
+			bool IsValid() const { return index != 0xffffffff; }
+			bool operator==(const TimerHandle&) const = default;
+		};
+
+		/// <summary>
+		/// Schedules a one-shot callback after the given delay. Zero and
+		/// negative delays fire on the next Update().
+		/// </summary>
+		/// <param name="seconds">Delay before the callback fires</param>
+		/// <param name="callback">Invoked once on the main thread at expiry</param>
+		/// <returns>Handle for Cancel()/IsPending()</returns>
+		TimerHandle Schedule(float seconds, std::function<void()> callback);
+
+		/// <summary>
+		/// Cancels a pending timer. Stale handles (fired, cancelled, or
+		/// never valid) are ignored, so callers can cancel unconditionally.
+		/// </summary>
+		/// <param name="handle">Handle returned by Schedule</param>
+		void Cancel(TimerHandle handle);
+
+		/// <summary>
+		/// Whether the timer is still scheduled and has not fired.
+		/// </summary>
+		/// <param name="handle">Handle returned by Schedule</param>
+		/// <returns>True while the timer is pending</returns>
+		bool IsPending(TimerHandle handle) const {
+			return handle.index < (uint32_t)m_timers.size() &&
+				m_timers[handle.index].generation == handle.generation &&
+				m_timers[handle.index].pending;
+		}
+
+		/// <summary>
+		/// Advances the wheel by the elapsed time and fires every timer
+		/// whose tick came due. Called once per simulation step.
+		/// </summary>
+		/// <param name="dt">Elapsed seconds since the last update</param>
+		void Update(float dt);
+
+		/// <summary>
+		/// Drops every pending timer without firing. Called when the scene
+		/// is destroyed.
+		/// </summary>
+		void Clear();
+
+		// outstanding timers, for the editor overlay
+		size_t GetPendingCount() const { return m_pendingCount; }
+
+	private:
+		/// <summary>
+		/// One scheduled timer - the absolute tick it fires on, its slot
+		/// membership generation, and the callback.
+		/// </summary>
+		struct Timer {
+			uint64_t dueTick{ 0 };
+			std::function<void()> callback;
+			uint32_t generation{ 1 };
+			bool pending{ false };
+		};
+
+		// timers live in a slab indexed by handle; freed entries recycle
+		// through the free list with a bumped generation
+		std::vector<Timer> m_timers;
+		std::vector<uint32_t> m_freeList;
+
+		// per-slot lists of timer indices, keyed by dueTick & (kSlotCount-1)
+		std::vector<uint32_t> m_slots[kSlotCount];
+
+		// scratch for the slot being processed, reused across ticks so
+		// firing doesn't allocate
+		std::vector<uint32_t> m_due;
+
+		uint64_t m_tick{ 0 };
+		float m_accumulator{ 0 };
+		size_t m_pendingCount{ 0 };
+	};
+}
@@ -0,0 +1,243 @@
+#include "TransformCache.h"
+#include "ActorPool.h"
+
+namespace neu {
+
+	void TransformCache::Update(ActorPool& actors) {
+		PROFILE_SCOPE("TransformCache::Update");
+
+		// a new simulation step supersedes any blended render state
+		m_interpolating = false;
+
+		// fold last step's motion into the previous-state snapshot so slots
+		// that stop moving render at rest instead of replaying the old step;
+		// slots that move again below snapshot this (pre-step) state as
+		// their interpolation start
+		for (uint32_t index : m_moved) {
+			m_prevPositions[index] = m_positions[index];
+			m_prevRotations[index] = m_rotations[index];
+			m_prevScales[index] = m_scales[index];
+		}
+		m_moved.clear();
+
+		// PHASE 1: diff each live actor's transform against the mirror and
+		// collect the slots that need a new world matrix
+		m_count = actors.Count();
+		m_fresh.assign(m_matrices.size(), 0);
+
+		for (auto actor : actors) {
+			uint32_t index = actor->handle.index;
+
+			// grow the mirror to cover every pool slot seen so far
+			if (index >= (uint32_t)m_matrices.size()) {
+				size_t size = index + 1;
+				m_positions.resize(size);
+				m_rotations.resize(size);
+				m_scales.resize(size);
+				m_matrices.resize(size);
+				m_locals.resize(size);
+				m_prevPositions.resize(size);
+				m_prevRotations.resize(size);
+				m_prevScales.resize(size);
+				m_generations.resize(size, 0);
+				m_parents.resize(size, kNoParent);
+				m_fresh.resize(size, 0);
+				m_orderDirty = true;
+			}
+
+			// re-resolve the parent handle each step - a destroyed (or
+			// never-set) parent resolves to null and detaches the slot
+			Actor* parentActor = actors.Get(actor->parent);
+			uint32_t parent = parentActor ? parentActor->handle.index : kNoParent;
+			if (m_parents[index] != parent) {
+				m_parents[index] = parent;
+				m_orderDirty = true;
+
+				// reparenting changes the world matrix even at rest
+				m_generations[index] = 0;
+			}
+
+			const Transform& transform = actor->transform;
+			glm::aligned_vec4 position{ transform.position, 1 };
+			glm::aligned_vec4 rotation{ transform.rotationq.x, transform.rotationq.y, transform.rotationq.z, transform.rotationq.w };
+			glm::aligned_vec4 scale{ transform.scale, 0 };
+
+			// unchanged slot from the same actor generation - skip it
+			if (m_generations[index] == actor->handle.generation &&
+				position == m_positions[index] &&
+				rotation == m_rotations[index] &&
+				scale == m_scales[index]) {
+				continue;
+			}
+
+			// a fresh or reused slot has no prior step to blend from -
+			// seed its previous state so it spawns in place rather than
+			// interpolating from the slot's old occupant
+			if (m_generations[index] != actor->handle.generation) {
+				m_prevPositions[index] = position;
+				m_prevRotations[index] = rotation;
+				m_prevScales[index] = scale;
+				m_fresh[index] = 1;
+			}
+
+			m_positions[index] = position;
+			m_rotations[index] = rotation;
+			m_scales[index] = scale;
+			m_generations[index] = actor->handle.generation;
+			m_moved.push_back(index);
+		}
+
+		// PHASE 2: batched kernel - compose translate * rotate * scale
+		// directly from the SoA arrays for every dirty slot. These are
+		// local matrices; roots adopt them as world matrices in phase 3
+		for (uint32_t index : m_moved) {
+			const glm::aligned_vec4& rotation = m_rotations[index];
+			glm::quat q{ rotation.w, rotation.x, rotation.y, rotation.z };
+
+			glm::aligned_mat4 matrix{ glm::mat4_cast(q) };
+			matrix[0] *= m_scales[index].x;
+			matrix[1] *= m_scales[index].y;
+			matrix[2] *= m_scales[index].z;
+			matrix[3] = m_positions[index];
+
+			m_locals[index] = matrix;
+		}
+
+		// rebuild the parents-first order when the hierarchy changed - sort
+		// mirrored slots by chain depth so every parent resolves before its
+		// children (a cycle is cut at the mirror size and logged)
+		if (m_orderDirty) {
+			m_orderDirty = false;
+
+			size_t size = m_matrices.size();
+			std::vector<uint32_t> depths(size, 0);
+			for (uint32_t index = 0; index < (uint32_t)size; index++) {
+				uint32_t depth = 0;
+				uint32_t walk = index;
+				while (m_parents[walk] != kNoParent && depth < (uint32_t)size) {
+					walk = m_parents[walk];
+					depth++;
+				}
+				if (depth == (uint32_t)size) LOG_WARNING("Transform parent cycle at slot {}", index);
+				depths[index] = depth;
+			}
+
+			m_order.resize(size);
+			for (uint32_t index = 0; index < (uint32_t)size; index++) m_order[index] = index;
+			std::stable_sort(m_order.begin(), m_order.end(),
+				[&depths](uint32_t a, uint32_t b) { return depths[a] < depths[b]; });
+		}
+
+		// PHASE 3: resolve world matrices in one linear pass over the
+		// parents-first order. A slot recomputes only when its own local
+		// changed or an ancestor's world did - static subtrees are skipped
+		m_worldChanged.assign(m_matrices.size(), 0);
+		for (uint32_t index : m_moved) m_worldChanged[index] = 1;
+
+		size_t resolved = 0;
+		for (uint32_t index : m_order) {
+			uint32_t parent = m_parents[index];
+			if (!m_worldChanged[index] && (parent == kNoParent || !m_worldChanged[parent])) continue;
+
+			m_worldChanged[index] = 1;
+			m_matrices[index] = (parent != kNoParent) ? m_matrices[parent] * m_locals[index] : m_locals[index];
+			resolved++;
+		}
+
+		m_dirtyCount = resolved;
+	}
+
+	void TransformCache::Interpolate(float alpha) {
+		// variable-step mode (alpha >= 1) and all-static steps render the
+		// simulation matrices directly
+		m_interpolating = alpha < 1.0f && !m_moved.empty();
+		if (!m_interpolating) return;
+
+		PROFILE_SCOPE("TransformCache::Interpolate");
+
+		// start from the current step's matrices - only the slots that
+		// actually moved last step (and their subtrees) are recomposed
+		// below, everything at rest rides the flat copy
+		m_renderMatrices = m_matrices;
+
+		// blend each moved slot's previous and current state into a local
+		// matrix - parked in the render array until the resolve pass below
+		// multiplies parented slots through their chain
+		m_worldChanged.assign(m_matrices.size(), 0);
+		for (uint32_t index : m_moved) {
+			glm::vec3 position = glm::mix(glm::vec3{ m_prevPositions[index] }, glm::vec3{ m_positions[index] }, alpha);
+			glm::vec3 scale = glm::mix(glm::vec3{ m_prevScales[index] }, glm::vec3{ m_scales[index] }, alpha);
+
+			const glm::aligned_vec4& r0 = m_prevRotations[index];
+			const glm::aligned_vec4& r1 = m_rotations[index];
+			glm::quat q = glm::slerp(glm::quat{ r0.w, r0.x, r0.y, r0.z }, glm::quat{ r1.w, r1.x, r1.y, r1.z }, alpha);
+
+			glm::aligned_mat4 matrix{ glm::mat4_cast(q) };
+			matrix[0] *= scale.x;
+			matrix[1] *= scale.y;
+			matrix[2] *= scale.z;
+			matrix[3] = glm::vec4{ position, 1 };
+
+			m_renderMatrices[index] = matrix;
+			m_worldChanged[index] = 1;
+		}
+
+		// resolve parented slots through the chain, parents first - a child
+		// at rest under a moving parent still rides the blended parent
+		// matrix, mirroring the dirty propagation in Update
+		for (uint32_t index : m_order) {
+			uint32_t parent = m_parents[index];
+			if (parent == kNoParent) continue;	// moved roots are already final
+
+			bool selfMoved = m_worldChanged[index] != 0;
+			if (!selfMoved && !m_worldChanged[parent]) continue;
+
+			// a moved slot's blended local is parked in the render array;
+			// an inherited one reuses its cached local (copy by value, the
+			// multiply overwrites the slot)
+			glm::aligned_mat4 local = selfMoved ? m_renderMatrices[index] : m_locals[index];
+			m_renderMatrices[index] = m_renderMatrices[parent] * local;
+			m_worldChanged[index] = 1;
+		}
+	}
+
+	glm::mat4 TransformCache::GetWorldMatrix(const Actor* actor) const {
+		uint32_t index = actor->handle.index;
+
+		// slot not mirrored (or reused since) - compute directly; happens
+		// for actors queried before their first Update, e.g. at load time.
+		// Parented actors resolve their chain on the first Update, until
+		// then this serves the local matrix
+		if (index >= (uint32_t)m_matrices.size() ||
+			m_generations[index] != actor->handle.generation) {
+			return actor->transform.GetMatrix();
+		}
+
+		// between fixed steps the draw path sees the blended matrices
+		if (m_interpolating) return m_renderMatrices[index];
+
+		return m_matrices[index];
+	}
+
+	void TransformCache::Clear() {
+		m_positions.clear();
+		m_rotations.clear();
+		m_scales.clear();
+		m_matrices.clear();
+		m_locals.clear();
+		m_parents.clear();
+		m_order.clear();
+		m_worldChanged.clear();
+		m_fresh.clear();
+		m_orderDirty = false;
+		m_prevPositions.clear();
+		m_prevRotations.clear();
+		m_prevScales.clear();
+		m_renderMatrices.clear();
+		m_generations.clear();
+		m_moved.clear();
+		m_interpolating = false;
+		m_dirtyCount = 0;
+		m_count = 0;
+	}
+}
@@ -0,0 +1,149 @@
+#pragma once
+#include "Actor.h"
+#include <glm/gtc/type_aligned.hpp>
+#include <vector>
+
+namespace neu {
+	class ActorPool;
+
+	/// <summary>
+	/// Contiguous SoA mirror of every actor's transform with cached world
+	/// matrices, indexed by pool slot so lookups are one array read.
+	///
+	/// Actor::transform stays the authoring interface - once per frame
+	/// Update() compares each live actor's position/rotation/scale against
+	/// the mirrored copy, and only changed (or newly spawned) slots enter
+	/// the dirty list. The batched kernel then recomputes just those world
+	/// matrices in a linear pass over SIMD-aligned arrays, replacing the
+	/// scattered per-actor GetMatrix() calls in the draw path.
+	///
+	/// Slot generations are mirrored too, so a slot reused by a new spawn
+	/// is always treated as dirty rather than inheriting the old matrix.
+	///
+	/// Transform parenting (Actor::parent) resolves here as well: local
+	/// matrices compose for dirty slots, then a single linear pass over a
+	/// parents-first order multiplies child locals through their parent's
+	/// world matrix. Dirtiness propagates down the chain, so a static
+	/// subtree under a static parent costs nothing per frame.
+	///
+	/// The previous simulation step's state is kept alongside the current
+	/// one, so when the engine runs fixed-step updates Interpolate() can
+	/// blend the two into render matrices - Scene::Draw then presents a
+	/// state between steps instead of snapping at the simulation rate.
+	/// </summary>
+	class TransformCache {
+	public:
+		/// <summary>
+		/// Syncs the mirror against the pool and recomputes dirty world
+		/// matrices. Called once per simulation step by Scene::Update before
+		/// the BVH sync so spatial bounds see current matrices. The state a
+		/// changed slot held before this step becomes its previous state for
+		/// interpolation.
+		/// </summary>
+		/// <param name="actors">The scene's actor pool</param>
+		void Update(ActorPool& actors);
+
+		/// <summary>
+		/// Blends previous and current step state into render matrices for
+		/// every slot that moved last step. Called by Scene::Draw with the
+		/// engine's fixed-step blend factor; alpha >= 1 (the variable-step
+		/// mode) skips the pass and GetWorldMatrix serves the simulation
+		/// matrices directly.
+		/// </summary>
+		/// <param name="alpha">Fraction of a step elapsed since the last simulation update (0..1)</param>
+		void Interpolate(float alpha);
+
+		/// <summary>
+		/// World matrix for an actor, from the cache when the actor's slot
+		/// is mirrored and current, computed directly otherwise (actors not
+		/// yet seen by Update, e.g. during scene load). Serves interpolated
+		/// render matrices while an Interpolate() pass is active.
+		/// </summary>
+		/// <param name="actor">Actor whose world matrix is wanted</param>
+		/// <returns>The actor's world matrix</returns>
+		glm::mat4 GetWorldMatrix(const Actor* actor) const;
+
+		/// <summary>
+		/// Whether the actor's world matrix changed during the last Update()
+		/// - its own transform moved or an ancestor's did. A slot's first
+		/// mirror after a spawn doesn't count: a freshly added actor hasn't
+		/// "moved", it just became known. Only valid between Update() and
+		/// the next Interpolate(), which reuses the scratch; Scene's
+		/// partition sweep runs inside that window.
+		/// </summary>
+		/// <param name="actor">Actor to test</param>
+		/// <returns>True if the actor's world matrix changed last step</returns>
+		bool ChangedThisStep(const Actor* actor) const {
+			uint32_t index = actor->handle.index;
+			if (index >= (uint32_t)m_worldChanged.size() ||
+				m_generations[index] != actor->handle.generation) {
+				return false;
+			}
+			return m_worldChanged[index] != 0 && m_fresh[index] == 0;
+		}
+
+		/// <summary>
+		/// Drops the mirror. Called when the scene is destroyed.
+		/// </summary>
+		void Clear();
+
+		// last frame's kernel stats for the editor overlay
+		size_t GetDirtyCount() const { return m_dirtyCount; }
+		size_t GetCount() const { return m_count; }
+
+	private:
+		// sentinel parent slot for unparented (root) actors
+		static constexpr uint32_t kNoParent = 0xffffffff;
+
+		// SoA transform mirror (position.w = 1, rotation = quat xyzw,
+		// scale.w = 0), aligned so the kernel pass vectorizes
+		std::vector<glm::aligned_vec4> m_positions;
+		std::vector<glm::aligned_vec4> m_rotations;
+		std::vector<glm::aligned_vec4> m_scales;
+		std::vector<glm::aligned_mat4> m_matrices;
+
+		// composed local TRS matrices - equal to the world matrix for roots,
+		// multiplied through the parent chain for parented slots
+		std::vector<glm::aligned_mat4> m_locals;
+
+		// parent slot per entry (kNoParent for roots), re-resolved from the
+		// actor's parent handle every step so destroyed parents detach
+		std::vector<uint32_t> m_parents;
+
+		// mirrored slots sorted parents-first (by hierarchy depth), rebuilt
+		// only when the mirror grows or a parent link changes
+		std::vector<uint32_t> m_order;
+		bool m_orderDirty{ false };
+
+		// scratch: slots whose world matrix changed this step (their own
+		// transform moved or an ancestor's did) - drives dirty propagation
+		std::vector<uint8_t> m_worldChanged;
+
+		// slots mirrored for the first time this step (fresh spawn or slot
+		// reuse) - excluded from ChangedThisStep so spawning isn't "moving"
+		std::vector<uint8_t> m_fresh;
+
+		// state from the step before the current one, blended against the
+		// current arrays by Interpolate - equal to current for slots at rest
+		std::vector<glm::aligned_vec4> m_prevPositions;
+		std::vector<glm::aligned_vec4> m_prevRotations;
+		std::vector<glm::aligned_vec4> m_prevScales;
+
+		// blended matrices written by Interpolate, valid while
+		// m_interpolating is set (cleared again by the next Update)
+		std::vector<glm::aligned_mat4> m_renderMatrices;
+
+		// pool slot generation each entry was mirrored from - a mismatch
+		// means the slot was reused and the entry is stale
+		std::vector<uint32_t> m_generations;
+
+		// slots the last Update changed - the only slots whose previous and
+		// current state differ, so the only ones Interpolate recomposes
+		std::vector<uint32_t> m_moved;
+
+		bool m_interpolating{ false };
+
+		size_t m_dirtyCount{ 0 };
+		size_t m_count{ 0 };
+	};
+}
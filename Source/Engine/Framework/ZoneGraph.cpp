@@ -0,0 +1,140 @@
+#include "ZoneGraph.h"
+
+namespace neu {
+	void ZoneGraph::Read(const serial_data_t& value) {
+		if (SERIAL_CONTAINS(value, zones)) {
+			for (auto& zoneValue : SERIAL_AT(value, zones).GetArray()) {
+				if (m_zones.size() >= kMaxZones) {
+					LOG_WARNING("zone graph limited to {} zones, extra zones dropped", kMaxZones);
+					break;
+				}
+
+				Zone zone;
+				SERIAL_READ_NAME(zoneValue, "name", zone.name);
+
+				glm::vec3 center{ 0 };
+				glm::vec3 size{ 0 };
+				SERIAL_READ_NAME(zoneValue, "center", center);
+				SERIAL_READ_NAME(zoneValue, "size", size);
+				zone.bounds.Encapsulate(center - size * 0.5f);
+				zone.bounds.Encapsulate(center + size * 0.5f);
+
+				m_zones.push_back(std::move(zone));
+			}
+		}
+
+		if (SERIAL_CONTAINS(value, portals)) {
+			for (auto& portalValue : SERIAL_AT(value, portals).GetArray()) {
+				Portal portal;
+
+				glm::vec3 center{ 0 };
+				glm::vec3 size{ 0 };
+				SERIAL_READ_NAME(portalValue, "center", center);
+				SERIAL_READ_NAME(portalValue, "size", size);
+				portal.bounds.Encapsulate(center - size * 0.5f);
+				portal.bounds.Encapsulate(center + size * 0.5f);
+
+				// the two zone names the portal joins
+				if (SERIAL_CONTAINS(portalValue, zones)) {
+					int slot = 0;
+					for (auto& zoneName : SERIAL_AT(portalValue, zones).GetArray()) {
+						if (slot < 2 && zoneName.IsString()) portal.zones[slot++] = FindZoneIndex(zoneName.GetString());
+					}
+				}
+
+				if (portal.zones[0] < 0 || portal.zones[1] < 0) {
+					LOG_WARNING("portal doesn't name two known zones, dropped");
+					continue;
+				}
+
+				m_portals.push_back(portal);
+			}
+		}
+	}
+
+	void ZoneGraph::Update(SceneBVH& bvh) {
+		m_culled = 0;
+		if (m_zones.empty()) return;
+
+		// one conservative box query per zone rebuilds every assignment -
+		// an actor straddling several zones carries every zone's bit, so
+		// it draws while any of them is reachable
+		m_actorZones.clear();
+		for (size_t i = 0; i < m_zones.size(); i++) {
+			for (auto actor : bvh.QueryAABB(m_zones[i].bounds)) {
+				m_actorZones[actor] |= 1ull << i;
+			}
+		}
+	}
+
+	uint64_t ZoneGraph::ComputeVisibleZones(const glm::vec3& eye, const Frustum& frustum) {
+		// seed with every zone containing the eye - overlapping zones at a
+		// doorway all count
+		uint64_t visible = 0;
+		for (size_t i = 0; i < m_zones.size(); i++) {
+			auto& bounds = m_zones[i].bounds;
+			if (eye.x >= bounds.min.x && eye.x <= bounds.max.x &&
+				eye.y >= bounds.min.y && eye.y <= bounds.max.y &&
+				eye.z >= bounds.min.z && eye.z <= bounds.max.z) {
+				visible |= 1ull << i;
+			}
+		}
+
+		// a camera outside every zone (cutscene flythrough, editor orbit)
+		// can't be traversed from - see everything rather than nothing
+		if (!visible) {
+			m_visibleCount = (int)m_zones.size();
+			return ~0ull;
+		}
+
+		// flood-fill across portals until the set stops growing. Crossing
+		// tests the portal box against the whole view frustum rather than a
+		// frustum narrowed through upstream portals, which errs visible -
+		// a room can only be reached through a doorway that is on screen
+		bool grew = true;
+		while (grew) {
+			grew = false;
+			for (auto& portal : m_portals) {
+				uint64_t sides = (1ull << portal.zones[0]) | (1ull << portal.zones[1]);
+				if (!(visible & sides) || (visible & sides) == sides) continue;
+				if (!frustum.Intersects(portal.bounds)) continue;
+
+				visible |= sides;
+				grew = true;
+			}
+		}
+
+		m_visibleCount = 0;
+		for (size_t i = 0; i < m_zones.size(); i++) {
+			if (visible & (1ull << i)) m_visibleCount++;
+		}
+		return visible;
+	}
+
+	bool ZoneGraph::IsCulled(const Actor* actor, uint64_t visibleZones) {
+		auto iter = m_actorZones.find(actor);
+
+		// unzoned actors (skyboxes, actors outside the authored rooms)
+		// always draw
+		if (iter == m_actorZones.end()) return false;
+
+		if (iter->second & visibleZones) return false;
+		m_culled++;
+		return true;
+	}
+
+	void ZoneGraph::Clear() {
+		m_zones.clear();
+		m_portals.clear();
+		m_actorZones.clear();
+		m_visibleCount = 0;
+		m_culled = 0;
+	}
+
+	int ZoneGraph::FindZoneIndex(const std::string& name) const {
+		for (size_t i = 0; i < m_zones.size(); i++) {
+			if (equalsIgnoreCase(m_zones[i].name, name)) return (int)i;
+		}
+		return -1;
+	}
+}
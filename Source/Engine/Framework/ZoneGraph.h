@@ -0,0 +1,101 @@
+#pragma once
+#include "Core/Serializable.h"
+#include "Math/Bounds.h"
+#include "Math/Frustum.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace neu {
+	class Actor;
+	class SceneBVH;
+
+	/// <summary>
+	/// Authored zone/portal visibility graph for interior levels.
+	///
+	/// The scene file declares box-shaped zones (rooms) and the portals
+	/// (doorways, windows) connecting them. Once per frame actors are
+	/// assigned to every zone their bounds touch through the scene BVH,
+	/// and pass recording flood-fills the zones reachable from the
+	/// camera's zone through portals that intersect the view frustum -
+	/// actors whose zones are all unreachable are dropped before any
+	/// per-component culling runs.
+	///
+	/// The graph is conservative at its edges so partially-zoned levels
+	/// degrade to plain frustum culling instead of dropping geometry: a
+	/// camera outside every zone sees everything, and actors outside
+	/// every zone always draw.
+	/// </summary>
+	class ZoneGraph {
+	public:
+		/// <summary>
+		/// Reads the "zones" and "portals" sections of a scene file. Each
+		/// zone is a named box (center/size); each portal is a box naming
+		/// the two zones it connects. Zones past kMaxZones and portals
+		/// referencing unknown zones are dropped with a warning.
+		/// </summary>
+		void Read(const serial_data_t& value);
+
+		/// <summary>
+		/// Reassigns actors to the zones their bounds touch, queried
+		/// through the scene BVH. Called once per frame by Scene::Update
+		/// after the BVH sync, so assignments track movers automatically.
+		/// </summary>
+		void Update(SceneBVH& bvh);
+
+		/// <summary>
+		/// Flood-fills the zones reachable from the zone containing the
+		/// eye, crossing a portal only while its box intersects the view
+		/// frustum. Returns one bit per zone; every bit is set when the
+		/// eye sits outside all zones.
+		/// </summary>
+		uint64_t ComputeVisibleZones(const glm::vec3& eye, const Frustum& frustum);
+
+		/// <summary>
+		/// True when the actor sits in at least one zone and none of its
+		/// zones are in the visible set. Unzoned actors never cull.
+		/// </summary>
+		bool IsCulled(const Actor* actor, uint64_t visibleZones);
+
+		bool IsEmpty() const { return m_zones.empty(); }
+
+		/// <summary>
+		/// Drops the zones, portals and assignments. Called when the scene
+		/// is destroyed.
+		/// </summary>
+		void Clear();
+
+		// last frame's traversal results for the editor overlay
+		int GetZoneCount() const { return (int)m_zones.size(); }
+		int GetVisibleCount() const { return m_visibleCount; }
+		int GetCulledCount() const { return m_culled; }
+
+	private:
+		int FindZoneIndex(const std::string& name) const;
+
+		// zone sets pack into a uint64_t bitmask, one bit per zone
+		static constexpr size_t kMaxZones = 64;
+
+		struct Zone {
+			std::string name;
+			Bounds bounds;
+		};
+
+		// the open area connecting two zones - visibility flows across it
+		// only while its box intersects the view frustum
+		struct Portal {
+			Bounds bounds;
+			int zones[2]{ -1, -1 };
+		};
+
+		std::vector<Zone> m_zones;
+		std::vector<Portal> m_portals;
+
+		// actor -> bitmask of the zones its bounds touch, rebuilt by
+		// Update() each frame
+		std::unordered_map<const Actor*, uint64_t> m_actorZones;
+
+		int m_visibleCount{ 0 };
+		int m_culled{ 0 };
+	};
+}
@@ -7,51 +7,391 @@ namespace neu {
         ImGui::NewFrame();
     }
 
+#if NEU_EDITOR_ENABLED
     void Editor::UpdateGUI(Scene& scene) {
         if (ImGui::IsKeyPressed(ImGuiKey_GraveAccent)) m_active = !m_active;
         if (!m_active) return;
 
         ImGui::PushStyleColor(ImGuiCol_Separator, ImVec4{ 1, 1, 0, 1 });
 
+        // each panel body only builds when the window is actually visible -
+        // a collapsed or fully occluded panel costs its Begin and nothing else
+
         // SCENE
-        ImGui::Begin("Scene");
-        scene.UpdateGUI();
-        ImGui::Separator();
-
-        // display all actors
-        int index = 0;
-        for (auto& actor : scene.m_actors)
-        {
-            bool done = false;
-            ImGui::PushID(index++);
-            if (ImGui::Selectable(actor->name.c_str(), actor.get() == m_selected))
-            {
-                m_selected = actor.get();
+        if (ImGui::Begin("Scene")) {
+            scene.UpdateGUI();
+            ImGui::Separator();
+
+            // state cache counters from the last completed frame
+            ImGui::Text("GL binds issued: %u / avoided: %u", GLState::GetBindsIssued(), GLState::GetBindsAvoided());
+
+            // frame counters - zeros when NEU_FRAME_STATS_ENABLED is off
+            auto& frameStats = FrameStats::GetFrame();
+            ImGui::Text("Draws: %u (%u tris) / programs: %u / materials: %u / texture binds: %u",
+                frameStats.drawCalls, frameStats.triangles, frameStats.programBinds, frameStats.materialBinds, frameStats.textureBinds);
+            ImGui::Text("Buffer uploads: %u KB", (uint32_t)(frameStats.uploadBytes >> 10));
+            ImGui::Text("Frame arena: %zu KB (peak %zu KB)", FrameArena::GetUsed() >> 10, FrameArena::GetHighWater() >> 10);
+            ImGui::Text("Component pool: %d pooled / %d heap", ComponentPool::GetPooledCount(), ComponentPool::GetFallbackCount());
+            ImGui::Text("World matrices recomputed: %zu / %zu", scene.m_transformCache.GetDirtyCount(), scene.m_transformCache.GetCount());
+            ImGui::Text("Texture streaming: %zu / %zu MB resident", TextureStreamer::Instance().GetResidentBytes() >> 20, TextureStreamer::Instance().GetBudget() >> 20);
+            ImGui::Text("Upload queue: %zu pending (%zu KB)", UploadScheduler::Instance().GetQueuedCount(), UploadScheduler::Instance().GetQueuedBytes() >> 10);
+            ImGui::Text("Tasks: %zu suspended", TaskScheduler::Instance().GetWaitingCount());
+
+            // budgeted incremental work - pending resumption points and the
+            // per-frame slice the scheduler spends on them
+            float workBudgetMs = WorkScheduler::Instance().GetBudget() * 1000.0f;
+            ImGui::Text("Work: %zu parked", WorkScheduler::Instance().GetPendingCount());
+            ImGui::SameLine();
+            ImGui::SetNextItemWidth(120);
+            if (ImGui::SliderFloat("Work budget (ms)", &workBudgetMs, 0.1f, 4.0f, "%.1f")) {
+                WorkScheduler::Instance().SetBudget(workBudgetMs * 0.001f);
+            }
+
+            // focus-aware throttling - show when active so a "slow" editor
+            // next to a DCC tool explains itself
+            float throttle = GetEngine().GetRenderer().GetThrottleFrameRate();
+            if (throttle > 0) ImGui::Text("Focus throttle: %.0f fps (%s)", throttle, GetEngine().GetInput().IsWindowMinimized() ? "minimized" : "unfocused");
+            ImGui::Text("Static batches: %zu (%zu draws, %zu culled)", scene.m_staticBatcher.GetBatchCount(), scene.m_staticBatcher.GetDrawCount(), scene.m_staticBatcher.GetDrawsCulled());
+            ImGui::Text("Uniform uploads issued: %zu / skipped: %zu", scene.m_uniformUploadsIssued, scene.m_uniformUploadsSkipped);
+            ImGui::Text("Texture arrays: %zu (%zu layers packed)", TextureArrayCache::Instance().GetArrayCount(), TextureArrayCache::Instance().GetLayersUsed());
+            ImGui::Text("Render graph: %zu passes / %zu pooled targets (%zu MB)", scene.m_renderGraph.GetPassCount(), RenderTargetPool::Instance().GetCount(), RenderTargetPool::Instance().GetBytes() >> 20);
+
+#ifdef NEU_MEM_TRACKING_ENABLED
+            // per-subsystem memory accounting - live vs peak shows which system
+            // is still holding what it grabbed during load
+            if (ImGui::TreeNode("Memory", "Memory: %zu MB live", MemoryTracker::GetTotalLiveBytes() >> 20)) {
+                for (int tag = 0; tag < (int)MemTag::Count; tag++) {
+                    auto stats = MemoryTracker::GetStats((MemTag)tag);
+                    ImGui::Text("%-10s %8llu KB live / %8llu KB peak (%u allocations)",
+                        MemTagName((MemTag)tag),
+                        (unsigned long long)(stats.liveBytes >> 10), (unsigned long long)(stats.peakBytes >> 10), stats.liveCount);
+                }
+                if (ImGui::Button("Dump to log")) MemoryTracker::Dump();
+#ifdef _DEBUG
+                bool callstacks = MemoryTracker::GetCaptureCallstacks();
+                if (ImGui::Checkbox("Capture callstacks", &callstacks)) MemoryTracker::SetCaptureCallstacks(callstacks);
+#endif
+                ImGui::TreePop();
+            }
+#endif
+
+            // engine-side GPU allocation accounting next to the driver's own
+            // report - when the two drift apart the driver is holding copies
+            // (or has started evicting to system memory)
+            if (ImGui::TreeNode("GPUMemory", "GPU memory: %zu MB tracked", (size_t)(GPUMemory::GetTotalBytes() >> 20))) {
+                for (int type = 0; type < (int)GPUMemory::Type::Count; type++) {
+                    ImGui::Text("%-12s %6zu MB", GPUMemory::TypeName((GPUMemory::Type)type), (size_t)(GPUMemory::GetBytes((GPUMemory::Type)type) >> 20));
+                }
+
+                auto& driver = GPUMemory::GetDriverInfo();
+                if (driver.available) {
+                    ImGui::Text("Driver: %zu MB free / %zu MB total", (size_t)(driver.freeBytes >> 20), (size_t)(driver.totalBytes >> 20));
+                    if (driver.evictionCount) {
+                        ImGui::Text("Evictions: %u (%zu MB in system memory)", driver.evictionCount, (size_t)(driver.evictedBytes >> 20));
+                    }
+                    if (GPUMemory::IsUnderPressure()) {
+                        ImGui::TextColored(ImVec4{ 1, 1, 0, 1 }, "VRAM pressure - streaming budget pulled back");
+                    }
+                }
+                else {
+                    ImGui::Text("Driver: no memory report (engine accounting only)");
+                }
+
+                bool autoBudget = TextureStreamer::Instance().IsAutoBudget();
+                if (ImGui::Checkbox("Auto streaming budget", &autoBudget)) TextureStreamer::Instance().SetAutoBudget(autoBudget);
+                ImGui::TreePop();
+            }
+
+            // present block times attribute slow frames (swap = GPU/display
+            // bound, pacing = frame cap bound); the controls drive the
+            // renderer's swap and latency settings live
+            auto& presentRenderer = GetEngine().GetRenderer();
+            ImGui::Text("Present: swap %.2f ms / latency %.2f ms / pacing %.2f ms",
+                presentRenderer.GetSwapBlockMs(), presentRenderer.GetLatencyWaitMs(), presentRenderer.GetPacingWaitMs());
+
+            // quality tier - one combo applies the preset's whole knob set
+            // (render scale, AA, scene color, cascades, LOD, streaming,
+            // particles, post) and saves the selection
+            auto& tiers = Quality::GetTiers();
+            std::string tierNames;
+            for (auto& tier : tiers) { tierNames += tier.name; tierNames += '\0'; }
+            int tierIndex = Quality::GetTierIndex();
+            ImGui::SetNextItemWidth(120);
+            if (ImGui::Combo("Quality tier", &tierIndex, tierNames.c_str())) Quality::SetTier(tierIndex, presentRenderer);
+
+            int vsync = (int)presentRenderer.GetVSync();
+            ImGui::SetNextItemWidth(120);
+            if (ImGui::Combo("VSync", &vsync, "Off\0On\0Adaptive\0")) presentRenderer.SetVSync((VSyncMode)vsync);
+
+            int framesInFlight = presentRenderer.GetMaxFramesInFlight();
+            ImGui::SetNextItemWidth(120);
+            if (ImGui::SliderInt("Frames in flight", &framesInFlight, 0, 3)) presentRenderer.SetMaxFramesInFlight(framesInFlight);
+
+            // anti-aliasing - MSAA renders the scene color multisampled with
+            // an explicit graph resolve; FXAA is the cheap post-process mode
+            int antiAliasing = (int)presentRenderer.GetAntiAliasing();
+            ImGui::SetNextItemWidth(120);
+            if (ImGui::Combo("Anti-aliasing", &antiAliasing, "Off\0MSAA 2x\0MSAA 4x\0MSAA 8x\0FXAA\0")) presentRenderer.SetAntiAliasing((AAMode)antiAliasing);
+
+            // scene color format - the HDR/bandwidth knob; R11G11B10F gives
+            // HDR range at RGBA8 bandwidth, RGBA16F doubles it
+            int sceneFormat = (int)presentRenderer.GetSceneColorFormat();
+            ImGui::SetNextItemWidth(120);
+            if (ImGui::Combo("Scene color", &sceneFormat, "RGBA8\0R11G11B10F\0RGB10A2\0RGBA16F\0")) presentRenderer.SetSceneColorFormat((TargetFormat)sceneFormat);
+
+            // dynamic resolution - scene color scales with the GPU frame time
+            // and upscales in the final blit; this GUI always stays native
+            bool dynamicResolution = presentRenderer.IsDynamicResolutionEnabled();
+            if (ImGui::Checkbox("Dynamic resolution", &dynamicResolution)) presentRenderer.SetDynamicResolution(dynamicResolution);
+            ImGui::SameLine();
+            ImGui::Text("(%d%%)", (int)(presentRenderer.GetResolutionScale() * 100));
+
+            // asset hot reload - polls loaded files for edits and reloads in place
+            bool hotReload = HotReload::Instance().IsEnabled();
+            if (ImGui::Checkbox("Hot reload", &hotReload)) HotReload::Instance().SetEnabled(hotReload);
+            ImGui::SameLine();
+            ImGui::Text("(%d reloads)", HotReload::Instance().GetReloadCount());
+
+            // LOD debug view - force every model renderer to one level, -1
+            // restores distance-based selection
+            ImGui::SetNextItemWidth(120);
+            ImGui::SliderInt("Force LOD", &ModelRenderer::forcedLod, -1, Model::kLodCount - 1);
+
+            // overdraw heatmap draws the frame additively so pixel brightness
+            // shows how many times each pixel was shaded; the depth pre-pass
+            // toggle shows the win live
+            ImGui::Checkbox("Overdraw view", &scene.m_overdrawView);
+            ImGui::SameLine();
+            ImGui::Checkbox("Depth pre-pass", &scene.m_depthPrePass);
+
+            // occlusion culling against last frame's depth pyramid - the
+            // counters show culled vs frustum-visible objects per record
+            bool occlusionCulling = scene.m_hiZ.IsEnabled();
+            if (ImGui::Checkbox("HiZ occlusion", &occlusionCulling)) scene.m_hiZ.SetEnabled(occlusionCulling);
+            ImGui::SameLine();
+            ImGui::Text("(%d / %d culled)", scene.m_hiZ.GetCulledCount(), scene.m_hiZ.GetTestedCount());
+
+            // zone/portal traversal results from the last recorded main pass -
+            // scenes without authored zones don't show the line
+            if (!scene.m_zones.IsEmpty()) {
+                ImGui::Text("Zones: %d / %d reachable (%d actors culled)",
+                    scene.m_zones.GetVisibleCount(), scene.m_zones.GetZoneCount(), scene.m_zones.GetCulledCount());
+            }
+            // binary checkpoint - capture spreads over frames, restore
+            // rebuilds the population from the last completed capture
+            if (ImGui::Button("Capture checkpoint")) scene.BeginCheckpoint();
+            ImGui::SameLine();
+            if (scene.m_checkpoint.IsCapturing()) {
+                ImGui::Text("(capturing...)");
+            }
+            else if (scene.m_checkpoint.HasCheckpoint()) {
+                // restore replaces every pooled actor - drop the selection
+                // before its pointer goes stale
+                if (ImGui::Button("Restore")) {
+                    scene.RestoreCheckpoint();
+                    m_selected = nullptr;
+                }
+                ImGui::SameLine();
+                ImGui::Text("(%zu actors, %zu KB)",
+                    scene.m_checkpoint.GetActorCount(), scene.m_checkpoint.GetBytes() >> 10);
+            }
+            else {
+                ImGui::Text("(none)");
+            }
+            ImGui::Separator();
+
+            // virtualized actor list - the pool only iterates forward, so
+            // gather the pointers once and let the clipper emit just the
+            // visible rows; 10k actors cost a pointer pass, not 10k widgets
+            std::vector<Actor*> actors;
+            for (auto actor : scene.m_actors) actors.push_back(actor);
+
+            ImGuiListClipper clipper;
+            clipper.Begin((int)actors.size());
+            while (clipper.Step()) {
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                    Actor* actor = actors[i];
+                    ImGui::PushID(i);
+                    if (ImGui::Selectable(actor->name.c_str(), actor == m_selected))
+                    {
+                        m_selected = actor;
+                    }
+                    ImGui::PopID();
+                }
             }
-            ImGui::PopID();
         }
         ImGui::End();
 
 
-        ImGui::Begin("Assets");
-        auto resources = Resources().GetByType();
-        index = 0;
-        for (auto resource : resources) {
-            ImGui::PushID(index++);
-            if (ImGui::Selectable(resource->name.c_str(), resource == m_selected))
-            {
-                m_selected = resource;
+        if (ImGui::Begin("Assets")) {
+            // accounted cache memory against the configured budget (0 = none)
+            ImGui::Text("Memory: %zu MB used / %zu MB budget", Resources().GetMemoryUsed() >> 20, Resources().GetBudget() >> 20);
+            ImGui::Separator();
+
+            // largest resident resources first, size and LRU stamp inline so
+            // eviction candidates are visible at a glance; the clipper keeps
+            // the label formatting to the rows on screen
+            auto resources = Resources().GetByType();
+            std::sort(resources.begin(), resources.end(),
+                [](Resource* a, Resource* b) { return a->GetMemorySize() > b->GetMemorySize(); });
+
+            ImGuiListClipper clipper;
+            clipper.Begin((int)resources.size());
+            while (clipper.Step()) {
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                    Resource* resource = resources[i];
+                    ImGui::PushID(i);
+                    size_t size = resource->GetMemorySize();
+                    std::string label = size
+                        ? std::format("{} ({} KB, use {})", resource->name, size >> 10, resource->lastUsed)
+                        : resource->name;
+                    if (ImGui::Selectable(label.c_str(), resource == m_selected))
+                    {
+                        m_selected = resource;
+                    }
+                    ImGui::PopID();
+                }
             }
-            ImGui::PopID();
         }
         ImGui::End();
 
 
         // INSPECTOR
-        ImGui::Begin("Inspector");
-        if (m_selected)
-        {
-            m_selected->UpdateGUI();
+        if (ImGui::Begin("Inspector")) {
+            if (m_selected)
+            {
+                m_selected->UpdateGUI();
+            }
+        }
+        ImGui::End();
+
+
+        // PROFILER
+        if (ImGui::Begin("Profiler")) {
+            // frame pacing from Time's history ring - the percentiles and 1% low
+            // quantify the stutters a bare average hides
+            auto& time = GetEngine().GetTime();
+            auto timings = time.GetFrameTimings();
+            ImGui::Text("Frame: %.2f ms (p50 %.2f / p95 %.2f / p99 %.2f / 1%% low %.1f fps)",
+                time.GetLastFrameMs(), timings.p50, timings.p95, timings.p99,
+                timings.onePercentLowMs > 0 ? 1000.0f / timings.onePercentLowMs : 0.0f);
+            ImGui::PlotLines("##frameTimes", time.GetFrameHistory(), Time::kFrameHistory, time.GetFrameHistoryIndex(), nullptr, 0.0f, FLT_MAX, ImVec2{ 0, 40 });
+
+            float hitchMs = time.GetHitchThresholdMs();
+            ImGui::SetNextItemWidth(120);
+            if (ImGui::SliderFloat("Hitch threshold", &hitchMs, 16.0f, 200.0f, "%.0f ms")) time.SetHitchThresholdMs(hitchMs);
+
+            // the last hitch's captured flame view - the profile of the slow
+            // frame itself, kept until the next hitch replaces it
+            if (time.GetHitchCount() > 0) {
+                auto& hitch = time.GetLastHitch();
+                if (ImGui::TreeNode("Hitch", "Last hitch: %.1f ms at %.1f s (%d total)", hitch.frameMs, hitch.time, time.GetHitchCount())) {
+                    uint32_t hitchThread = 0xffffffff;
+                    for (auto& sample : hitch.samples) {
+                        if (sample.threadId != hitchThread) {
+                            ImGui::Text("Thread %u", sample.threadId);
+                            hitchThread = sample.threadId;
+                        }
+
+                        float ms = (sample.end - sample.begin) * 0.001f;
+                        ImGui::SetCursorPosX(ImGui::GetCursorPosX() + sample.depth * 16.0f);
+                        ImGui::ProgressBar(ms / hitch.frameMs, ImVec2{ -FLT_MIN, 0 }, std::format("{} {:.2f} ms", sample.name, ms).c_str());
+                    }
+                    ImGui::TreePop();
+                }
+            }
+            ImGui::Separator();
+
+            for (auto& scope : GPUProfiler::GetScopes()) {
+                ImGui::Text("%s - GPU: %.2f ms / CPU: %.2f ms", scope.name.c_str(), scope.gpuMs, scope.cpuMs);
+                ImGui::PlotLines(("##" + scope.name).c_str(), scope.gpuHistory, (int)GPUProfiler::kHistory, scope.historyIndex, nullptr, 0.0f, FLT_MAX, ImVec2{ 0, 40 });
+                ImGui::Separator();
+            }
+
+            // draw-call history next to the timing scopes - a spike here usually
+            // explains a spike above
+            ImGui::Text("Draw calls: %u", FrameStats::GetFrame().drawCalls);
+            ImGui::PlotLines("##drawCalls", FrameStats::GetDrawHistory(), (int)FrameStats::kHistory, FrameStats::GetHistoryIndex(), nullptr, 0.0f, FLT_MAX, ImVec2{ 0, 40 });
+            ImGui::Separator();
+
+            // CPU flame view - samples indent by scope depth, bar length is the
+            // sample's share of the frame
+            ImGui::Text("CPU Frame: %.2f ms", Profiler::GetFrameMs());
+            if (ImGui::Button("Dump Trace")) Profiler::DumpTrace("trace.json");
+
+            float frameMs = math::max(Profiler::GetFrameMs(), 0.001f);
+            uint32_t lastThread = 0xffffffff;
+            for (auto& sample : Profiler::GetFrameSamples()) {
+                if (sample.threadId != lastThread) {
+                    ImGui::Text("Thread %u", sample.threadId);
+                    lastThread = sample.threadId;
+                }
+
+                float ms = (sample.end - sample.begin) * 0.001f;
+                ImGui::SetCursorPosX(ImGui::GetCursorPosX() + sample.depth * 16.0f);
+                ImGui::ProgressBar(ms / frameMs, ImVec2{ -FLT_MIN, 0 }, std::format("{} {:.2f} ms", sample.name, ms).c_str());
+            }
+
+            // startup timeline - the per-phase init timings Initialize
+            // recorded, bar length is the phase's share of total startup.
+            // Worker phases overlapped with the main-thread ones
+            auto& startup = GetEngine().GetStartupTimeline();
+            if (!startup.empty()) {
+                ImGui::Separator();
+                float startupMs = 0;
+                for (auto& phase : startup) startupMs = math::max(startupMs, phase.startMs + phase.durationMs);
+                if (ImGui::TreeNode("Startup", "Startup: %.0f ms", startupMs)) {
+                    for (auto& phase : startup) {
+                        ImGui::ProgressBar(phase.durationMs / startupMs, ImVec2{ -FLT_MIN, 0 },
+                            std::format("{}{} {:.1f} ms (at {:.1f})", phase.name, phase.async ? " [worker]" : "", phase.durationMs, phase.startMs).c_str());
+                    }
+                    ImGui::TreePop();
+                }
+            }
+        }
+        ImGui::End();
+
+
+        // CONSOLE
+        if (ImGui::Begin("Console")) {
+            // per-category filters - unchecking stops the category at the
+            // source (before formatting), not just in this view
+            for (int category = 0; category < (int)LogCategory::Count; category++) {
+                if (category) ImGui::SameLine();
+                bool enabled = Logger::GetCategoryLevels((LogCategory)category) != LogLevel::None;
+                if (ImGui::Checkbox(LogCategoryName((LogCategory)category), &enabled)) {
+                    Logger::SetCategoryLevels((LogCategory)category, enabled ? LogLevel::All : LogLevel::None);
+                }
+            }
+
+            int rateLimit = Logger::GetRateLimit();
+            ImGui::SetNextItemWidth(160);
+            if (ImGui::SliderInt("Rate limit", &rateLimit, 0, 32, rateLimit ? "%d / site / sec" : "off")) Logger::SetRateLimit(rateLimit);
+            ImGui::SameLine();
+            if (ImGui::Button("Clear")) Logger::ClearConsole();
+            ImGui::Separator();
+
+            ImGui::BeginChild("##console");
+            // uniform-height rows, so the clipper only emits the lines on
+            // screen instead of formatting the whole ring every frame
+            auto entries = Logger::GetConsoleEntries();
+            ImGuiListClipper clipper;
+            clipper.Begin((int)entries.size());
+            while (clipper.Step()) {
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                    auto& entry = entries[i];
+                    // same color coding as the terminal output
+                    ImVec4 color{ 1, 1, 1, 1 };
+                    if (entry.level == LogLevel::Warning) color = ImVec4{ 1, 1, 0, 1 };
+                    else if (entry.level == LogLevel::Error) color = ImVec4{ 1, 0.3f, 0.3f, 1 };
+                    else if (entry.level == LogLevel::Debug) color = ImVec4{ 0.6f, 0.6f, 0.6f, 1 };
+
+                    ImGui::TextColored(color, "[%s] %s", LogCategoryName(entry.category), entry.message.c_str());
+                }
+            }
+            // follow the tail unless the user scrolled up to read something
+            if (ImGui::GetScrollY() >= ImGui::GetScrollMaxY()) ImGui::SetScrollHereY(1.0f);
+            ImGui::EndChild();
         }
         ImGui::End();
 
@@ -63,4 +403,5 @@ namespace neu {
     {
         ImGui::Image((ImTextureID)texture.m_texture, ImVec2(width, height));
     }
-}
\ No newline at end of file
+#endif
+}
@@ -2,23 +2,47 @@
 #include "Resources/ResourceManager.h"
 #include <ImGuiFileDialog.h>
 
+// the editor compiles in for debug builds, or anywhere with NEU_EDITOR
+// defined (mirrors the NEU_DEBUG_DRAW override in DebugDraw.h) - shipping
+// builds get empty inlines instead of a hidden widget pass
+#if defined(_DEBUG) || defined(NEU_EDITOR)
+	#define NEU_EDITOR_ENABLED 1
+#else
+	#define NEU_EDITOR_ENABLED 0
+#endif
+
 namespace neu {
 	class Editor {
 	public:
+		// starts the ImGui frame - kept in shipping builds too, since the
+		// GUI backend (and the debug label draw list) expects a frame to
+		// exist regardless of whether any editor panel builds into it
 		void Begin();
+
+#if NEU_EDITOR_ENABLED
 		void UpdateGUI(class Scene& scene);
 
 		static void ShowTexture(class Texture& texture, float width, float height);
 
 		template<typename T>
 		static bool GetDialogResource(res_t<T>& resource, const std::string& dialogName, const std::string& title, const std::string& filetype);
+#else
+		// shipping builds: the panels and their per-frame widget cost
+		// compile away entirely instead of just hiding
+		void UpdateGUI(class Scene&) {}
 
+		static void ShowTexture(class Texture&, float, float) {}
+
+		template<typename T>
+		static bool GetDialogResource(res_t<T>&, const std::string&, const std::string&, const std::string&) { return false; }
+#endif
 
 	private:
 		bool m_active = true;
 		class GUI* m_selected = nullptr;
 	};
 
+#if NEU_EDITOR_ENABLED
 	template<typename T>
 	inline bool Editor::GetDialogResource(res_t<T>& resource, const std::string& dialogName, const std::string& title, const std::string& filetype)
 	{
@@ -43,4 +67,5 @@ namespace neu {
 
 		return true;
 	}
-}
\ No newline at end of file
+#endif
+}
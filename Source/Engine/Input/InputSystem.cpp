@@ -61,9 +61,95 @@ namespace neu {
         // - Clear any persistent input state
     }
 
+    /// <summary>
+    /// Coalesces one pumped SDL event into the pending accumulators.
+    ///
+    /// Motion and wheel events just add their deltas - hundreds of 1000 Hz
+    /// motion events collapse into two float adds each, and the summed
+    /// relative motion is exact where a position difference quantizes to
+    /// whole pixels and clamps at window edges. Key and button transitions
+    /// append timestamped edges so fixed-timestep simulation can order
+    /// inputs within the frame. Runs on the main thread during the event
+    /// pump, strictly before Update consumes the accumulators.
+    /// </summary>
+    /// <param name="event">The SDL event being pumped</param>
+    void InputSystem::ProcessEvent(const SDL_Event& event) {
+        switch (event.type) {
+        case SDL_EVENT_MOUSE_MOTION:
+            m_pendingMotion += glm::vec2{ event.motion.xrel, event.motion.yrel };
+            m_pendingHadMotion = true;
+            break;
+        case SDL_EVENT_MOUSE_WHEEL:
+            m_pendingWheel += glm::vec2{ event.wheel.x, event.wheel.y };
+            break;
+        case SDL_EVENT_KEY_DOWN:
+        case SDL_EVENT_KEY_UP:
+            // key repeats are not edges - the key never went up
+            if (event.key.repeat) break;
+            m_pendingEdges.push_back({
+                InputEdge::Device::Keyboard,
+                (uint16_t)event.key.scancode,
+                event.key.down,
+                event.common.timestamp * 1e-9 // nanoseconds to seconds
+            });
+            break;
+        case SDL_EVENT_MOUSE_BUTTON_DOWN:
+        case SDL_EVENT_MOUSE_BUTTON_UP:
+        {
+            uint16_t code;
+            if (event.button.button == SDL_BUTTON_LEFT) code = (uint16_t)MouseButton::Left;
+            else if (event.button.button == SDL_BUTTON_MIDDLE) code = (uint16_t)MouseButton::Middle;
+            else if (event.button.button == SDL_BUTTON_RIGHT) code = (uint16_t)MouseButton::Right;
+            else break;
+            m_pendingEdges.push_back({
+                InputEdge::Device::Mouse,
+                code,
+                event.button.down,
+                event.common.timestamp * 1e-9
+            });
+            break;
+        }
+        // window focus/minimized state feeds the engine's focus-aware
+        // frame throttling
+        case SDL_EVENT_WINDOW_FOCUS_GAINED:
+            m_windowFocused = true;
+            break;
+        case SDL_EVENT_WINDOW_FOCUS_LOST:
+            m_windowFocused = false;
+            break;
+        case SDL_EVENT_WINDOW_MINIMIZED:
+            m_windowMinimized = true;
+            break;
+        case SDL_EVENT_WINDOW_RESTORED:
+        case SDL_EVENT_WINDOW_MAXIMIZED:
+            m_windowMinimized = false;
+            break;
+        }
+    }
+
+    /// <summary>
+    /// Enables or disables relative mouse mode (raw input) on the engine
+    /// window. SDL hides the cursor, locks it to the window, and reports
+    /// unaccelerated hardware deltas through motion events - read them
+    /// through GetMouseRelativeDelta or the snapshot's mouseDelta.
+    /// </summary>
+    /// <param name="enabled">True to enter relative mode, false to restore the cursor</param>
+    void InputSystem::SetRelativeMouseMode(bool enabled) {
+        if (m_relativeMode == enabled) return;
+
+        SDL_Window* window = GetEngine().GetRenderer().GetWindow();
+        if (window == nullptr) return;
+
+        if (!SDL_SetWindowRelativeMouseMode(window, enabled)) {
+            LOG_WARNING("Could not set relative mouse mode: {}", SDL_GetError());
+            return;
+        }
+        m_relativeMode = enabled;
+    }
+
     /// <summary>
     /// Updates all input state for the current frame.
-    /// 
+    ///
     /// This is the main update method that must be called once per frame, typically
     /// early in the game loop before any input queries. The update process follows
     /// a specific order to ensure consistent state:
@@ -76,6 +162,8 @@ namespace neu {
     /// consistent results and that press/release detection works correctly.
     /// </summary>
     void InputSystem::Update() {
+        PROFILE_SCOPE("InputSystem::Update");
+
         // =====================================================================
         // KEYBOARD INPUT UPDATE
         // =====================================================================
@@ -120,5 +208,224 @@ namespace neu {
 
         // Test right mouse button (bit 2)
         m_mouseButtonState[(uint8_t)MouseButton::Right] = mouseButtonState & SDL_BUTTON_RMASK;
+
+        // =====================================================================
+        // COALESCED EVENT CONSUMPTION
+        // =====================================================================
+
+        // Move the pump accumulators into the frame-facing values and reset
+        // them for the next pump. When motion events were coalesced the
+        // frame delta is their exact sum; otherwise fall back to the
+        // position difference (identical for an idle mouse, and keeps
+        // GetMouseDelta working if events are not routed through
+        // ProcessEvent)
+        m_mouseRelativeDelta = m_pendingMotion;
+        m_pendingMotion = { 0, 0 };
+
+        m_wheelDelta = m_pendingWheel;
+        m_pendingWheel = { 0, 0 };
+
+        m_mouseDelta = m_pendingHadMotion ? m_mouseRelativeDelta : m_mousePosition - m_prevMousePosition;
+        m_pendingHadMotion = false;
+
+        m_edges.swap(m_pendingEdges);
+        m_pendingEdges.clear();
+
+        // =====================================================================
+        // ACTION SNAPSHOT
+        // =====================================================================
+
+        // Build this frame's action snapshot into the back buffer and flip.
+        // The previous snapshot stays untouched, so any reference actors
+        // took remains valid and press/release edges compare against it
+        ActionSnapshot& snapshot = m_snapshots[m_snapshotIndex ^ 1];
+        const ActionSnapshot& previous = m_snapshots[m_snapshotIndex];
+
+        snapshot.down = 0;
+        for (int i = 0; i < (int)m_actions.size(); i++) {
+            bool down = false;
+            for (int key : m_actions[i].keys) down |= m_keyboardState[key];
+            for (uint8_t button : m_actions[i].mouseButtons) down |= m_mouseButtonState[button];
+            if (down) snapshot.down |= 1ull << i;
+        }
+
+        snapshot.pressed = snapshot.down & ~previous.down;
+        snapshot.released = ~snapshot.down & previous.down;
+        snapshot.mousePosition = m_mousePosition;
+        snapshot.mouseDelta = m_mouseDelta;
+
+        m_snapshotIndex ^= 1;
+
+        // =====================================================================
+        // RECORDING / PLAYBACK
+        // =====================================================================
+
+        // Playback replaces the snapshot just built (and the mouse queries
+        // backing it) with the recorded frame; recording appends the built
+        // snapshot. Live SDL state was still sampled above, so dropping out
+        // of playback resumes seamlessly
+        if (m_playbackFile.is_open()) {
+            ActionSnapshot& live = m_snapshots[m_snapshotIndex];
+            if (m_playbackFile.read((char*)&live, sizeof(live))) {
+                m_mousePosition = live.mousePosition;
+                m_mouseDelta = live.mouseDelta;
+                m_mouseRelativeDelta = live.mouseDelta;
+            }
+            else {
+                LOG_INFO("Input playback finished");
+                StopPlayback();
+            }
+        }
+        else if (m_recordFile.is_open()) {
+            m_recordFile.write((const char*)&m_snapshots[m_snapshotIndex], sizeof(ActionSnapshot));
+        }
+    }
+
+    // recording header: magic, format version, snapshot size - a build whose
+    // snapshot layout changed refuses the file instead of replaying garbage
+    static constexpr uint32_t kInputRecordingMagic = 0x4E495230; // "NIR0"
+    static constexpr uint32_t kInputRecordingVersion = 1;
+
+    /// <summary>
+    /// Opens a recording file and writes the header. Any active playback
+    /// stops first - the two modes are exclusive.
+    /// </summary>
+    /// <param name="filename">Path the recording is written to</param>
+    /// <returns>True if the file was opened for recording</returns>
+    bool InputSystem::StartRecording(const std::string& filename) {
+        StopPlayback();
+        StopRecording();
+
+        m_recordFile.open(filename, std::ios::binary);
+        if (!m_recordFile.is_open()) {
+            LOG_WARNING("Could not open input recording for write: {}", filename);
+            return false;
+        }
+
+        uint32_t header[3]{ kInputRecordingMagic, kInputRecordingVersion, (uint32_t)sizeof(ActionSnapshot) };
+        m_recordFile.write((const char*)header, sizeof(header));
+
+        LOG_INFO("Recording input to {}", filename);
+        return true;
+    }
+
+    /// <summary>
+    /// Stops an active recording and closes the file.
+    /// </summary>
+    void InputSystem::StopRecording() {
+        if (m_recordFile.is_open()) m_recordFile.close();
+    }
+
+    /// <summary>
+    /// Opens a recorded input file, validates its header, and switches
+    /// Update to replaying its snapshots.
+    /// </summary>
+    /// <param name="filename">Path to a file written by StartRecording</param>
+    /// <returns>True if the file was opened and its header validated</returns>
+    bool InputSystem::StartPlayback(const std::string& filename) {
+        StopPlayback();
+        StopRecording();
+
+        m_playbackFile.open(filename, std::ios::binary);
+        if (!m_playbackFile.is_open()) {
+            LOG_WARNING("Could not open input recording: {}", filename);
+            return false;
+        }
+
+        uint32_t header[3]{};
+        m_playbackFile.read((char*)header, sizeof(header));
+        if (!m_playbackFile || header[0] != kInputRecordingMagic ||
+            header[1] != kInputRecordingVersion || header[2] != (uint32_t)sizeof(ActionSnapshot)) {
+            LOG_WARNING("Input recording {} has an incompatible header", filename);
+            m_playbackFile.close();
+            return false;
+        }
+
+        LOG_INFO("Replaying input from {}", filename);
+        return true;
+    }
+
+    /// <summary>
+    /// Stops active playback and returns to live input.
+    /// </summary>
+    void InputSystem::StopPlayback() {
+        if (m_playbackFile.is_open()) m_playbackFile.close();
+    }
+
+    /// <summary>
+    /// Loads action bindings from a JSON action map.
+    ///
+    /// Expected layout:
+    /// ```json
+    /// {
+    ///   "actions": [
+    ///     { "name": "move_forward", "keys": ["W", "Up"] },
+    ///     { "name": "look", "mouseButtons": ["right"] }
+    ///   ]
+    /// }
+    /// ```
+    /// Key names resolve through SDL_GetScancodeFromName, so bindings use
+    /// the same names SDL reports. Unknown keys and buttons are skipped
+    /// with a warning rather than failing the whole map.
+    /// </summary>
+    /// <param name="filename">Path to the JSON action map</param>
+    /// <returns>True if the map was loaded; otherwise, false</returns>
+    bool InputSystem::LoadActionMap(const std::string& filename) {
+        serial::document_t document;
+        if (!serial::Load(filename, document)) {
+            LOG_WARNING("Could not load action map: {}", filename);
+            return false;
+        }
+
+        if (!SERIAL_CONTAINS(document, actions)) {
+            LOG_WARNING("Action map has no \"actions\" array: {}", filename);
+            return false;
+        }
+
+        m_actions.clear();
+        m_actionLookup.clear();
+        m_snapshots = {};
+
+        for (auto& item : SERIAL_AT(document, actions).GetArray()) {
+            if ((int)m_actions.size() == kMaxActions) {
+                LOG_WARNING("Action map exceeds {} actions, ignoring the rest: {}", kMaxActions, filename);
+                break;
+            }
+
+            std::string name;
+            SERIAL_READ_NAME(item, "name", name);
+            if (name.empty()) continue;
+
+            ActionBinding binding;
+
+            if (item.HasMember("keys")) {
+                for (auto& key : item["keys"].GetArray()) {
+                    if (!key.IsString()) continue;
+                    SDL_Scancode scancode = SDL_GetScancodeFromName(key.GetString());
+                    if (scancode == SDL_SCANCODE_UNKNOWN) {
+                        LOG_WARNING("Unknown key \"{}\" for action {}", key.GetString(), name);
+                        continue;
+                    }
+                    binding.keys.push_back(scancode);
+                }
+            }
+
+            if (item.HasMember("mouseButtons")) {
+                for (auto& button : item["mouseButtons"].GetArray()) {
+                    if (!button.IsString()) continue;
+                    std::string buttonName = button.GetString();
+                    if (buttonName == "left") binding.mouseButtons.push_back((uint8_t)MouseButton::Left);
+                    else if (buttonName == "middle") binding.mouseButtons.push_back((uint8_t)MouseButton::Middle);
+                    else if (buttonName == "right") binding.mouseButtons.push_back((uint8_t)MouseButton::Right);
+                    else LOG_WARNING("Unknown mouse button \"{}\" for action {}", buttonName, name);
+                }
+            }
+
+            m_actionLookup[name] = (int)m_actions.size();
+            m_actions.push_back(std::move(binding));
+        }
+
+        LOG_INFO("Loaded {} actions from {}", m_actions.size(), filename);
+        return true;
     }
 }
\ No newline at end of file
@@ -4,6 +4,9 @@
 #include <SDL3/SDL.h>
 #include <vector>
 #include <array>
+#include <fstream>
+#include <string>
+#include <unordered_map>
 
 namespace neu {
     /// <summary>
@@ -91,23 +94,38 @@ namespace neu {
 
         /// <summary>
         /// Updates all input state for the current frame.
-        /// 
+        ///
         /// This method should be called once per frame, typically early in the
         /// game loop before any input queries are made. It performs the following:
-        /// 
+        ///
         /// 1. Saves current input states as previous frame states
         /// 2. Queries SDL for new keyboard state and copies to current state array
         /// 3. Queries SDL for mouse position and button states
         /// 4. Updates internal mouse button state flags based on SDL button masks
-        /// 
+        /// 5. Consumes the deltas and edge events coalesced by ProcessEvent
+        ///    since the last update
+        ///
         /// The update order ensures that input state remains consistent throughout
         /// the frame and that press/release detection works correctly.
-        /// 
+        ///
         /// Performance: This method performs fixed-cost operations regardless of
         /// how many keys/buttons are pressed, making it suitable for real-time use.
         /// </summary>
         void Update();
 
+        /// <summary>
+        /// Feeds one SDL event from the platform pump into the input system,
+        /// alongside ImGui's ProcessEvent. Motion and wheel events coalesce
+        /// into accumulated deltas - a 1000 Hz mouse queues hundreds of
+        /// motion events per frame, and summing their relative deltas here is
+        /// both cheaper than per-event handling downstream and more accurate
+        /// than differencing sampled positions (sub-pixel precision, no
+        /// clamping at window edges). Key and button transitions are recorded
+        /// as timestamped edge events for sub-frame ordering.
+        /// </summary>
+        /// <param name="event">The SDL event being pumped</param>
+        void ProcessEvent(const SDL_Event& event);
+
         // ========================================================================
         // KEYBOARD INPUT METHODS
         // ========================================================================
@@ -277,7 +295,201 @@ namespace neu {
         /// left/up relative to the previous frame.
         /// </summary>
         /// <returns>Vector2 containing the mouse movement delta (deltaX, deltaY) in pixels</returns>
-        glm::vec2 GetMouseDelta() const { return m_mousePosition - m_prevMousePosition; }
+        glm::vec2 GetMouseDelta() const { return m_mouseDelta; }
+
+        /// <summary>
+        /// Gets the mouse movement accumulated from relative motion events
+        /// this frame. Unlike the position difference this sums every motion
+        /// event's hardware delta, so it keeps sub-pixel precision, is not
+        /// clamped when the cursor hits a window edge, and keeps reporting
+        /// in relative mouse mode where the cursor position is frozen.
+        /// </summary>
+        /// <returns>Vector2 containing the accumulated relative motion this frame</returns>
+        const glm::vec2& GetMouseRelativeDelta() const { return m_mouseRelativeDelta; }
+
+        /// <summary>
+        /// Gets the scroll wheel movement accumulated this frame. Horizontal
+        /// scroll is x, vertical is y, in SDL's wheel units (positive y away
+        /// from the user). Multiple wheel events per frame sum.
+        /// </summary>
+        /// <returns>Vector2 containing the accumulated wheel delta this frame</returns>
+        const glm::vec2& GetMouseWheel() const { return m_wheelDelta; }
+
+        /// <summary>
+        /// Enables or disables relative mouse mode (raw input). While
+        /// enabled SDL hides the cursor, locks it to the window, and reports
+        /// unaccelerated relative motion - the mode for FPS-style mouse
+        /// look. Query movement through GetMouseRelativeDelta or the
+        /// snapshot's mouseDelta; the cursor position stops updating.
+        /// </summary>
+        /// <param name="enabled">True to enter relative mode, false to restore the cursor</param>
+        void SetRelativeMouseMode(bool enabled);
+
+        /// <summary>
+        /// Whether relative mouse mode is currently active.
+        /// </summary>
+        /// <returns>True if relative mouse mode is enabled</returns>
+        bool IsRelativeMouseMode() const { return m_relativeMode; }
+
+        // ========================================================================
+        // WINDOW STATE
+        // ========================================================================
+
+        /// <summary>
+        /// Whether the window currently holds input focus, tracked from the
+        /// SDL focus events fed through ProcessEvent. Together with
+        /// IsWindowMinimized this drives the engine's focus-aware frame
+        /// throttling.
+        /// </summary>
+        /// <returns>True while the window has input focus</returns>
+        bool HasWindowFocus() const { return m_windowFocused; }
+
+        /// <summary>
+        /// Whether the window is currently minimized, tracked from SDL
+        /// window events through ProcessEvent.
+        /// </summary>
+        /// <returns>True while the window is minimized</returns>
+        bool IsWindowMinimized() const { return m_windowMinimized; }
+
+        // ========================================================================
+        // EDGE EVENTS
+        // ========================================================================
+
+        /// <summary>
+        /// One key or mouse button transition with its sub-frame timestamp.
+        ///
+        /// Frame-latched press/release detection quantizes every input to
+        /// the frame boundary; the edge list preserves when within the
+        /// pumped interval each transition actually happened, so a
+        /// fixed-timestep simulation can assign inputs to the correct
+        /// sub-step and order same-frame press/release pairs.
+        /// </summary>
+        struct InputEdge {
+            /// <summary>Which device produced the edge</summary>
+            enum class Device : uint8_t { Keyboard, Mouse };
+
+            Device device{ Device::Keyboard };
+            uint16_t code{ 0 };     // SDL scancode, or MouseButton index for Device::Mouse
+            bool down{ false };     // true = press, false = release
+            double time{ 0 };       // seconds on SDL's clock (event timestamp)
+        };
+
+        /// <summary>
+        /// The key and button transitions pumped since the previous Update,
+        /// in arrival order with sub-frame timestamps. The list is rebuilt
+        /// every Update; take a copy to keep edges across frames.
+        /// </summary>
+        /// <returns>This frame's edge events, oldest first</returns>
+        const std::vector<InputEdge>& GetEdgeEvents() const { return m_edges; }
+
+        // ========================================================================
+        // RECORDING / PLAYBACK
+        // ========================================================================
+
+        /// <summary>
+        /// Starts recording each frame's action snapshot to a file. One
+        /// snapshot is appended per Update until StopRecording, capturing
+        /// everything gameplay reads through the snapshot - action bits,
+        /// mouse position and delta. Combined with a fixed random seed and
+        /// Time's deterministic delta, a recorded run replays bit-identical
+        /// gameplay for perf A/B comparisons across builds.
+        /// </summary>
+        /// <param name="filename">Path the recording is written to</param>
+        /// <returns>True if the file was opened for recording</returns>
+        bool StartRecording(const std::string& filename);
+
+        /// <summary>
+        /// Stops an active recording and closes the file. Safe to call when
+        /// not recording.
+        /// </summary>
+        void StopRecording();
+
+        /// <summary>
+        /// Starts replaying a recorded input file. While active, Update
+        /// replaces the live snapshot (and the mouse position/delta queries
+        /// backing it) with the next recorded frame; playback stops itself
+        /// when the recording runs out.
+        /// </summary>
+        /// <param name="filename">Path to a file written by StartRecording</param>
+        /// <returns>True if the file was opened and its header validated</returns>
+        bool StartPlayback(const std::string& filename);
+
+        /// <summary>
+        /// Stops active playback and returns to live input. Safe to call
+        /// when not playing.
+        /// </summary>
+        void StopPlayback();
+
+        /// <summary>
+        /// Whether a recording is currently being written.
+        /// </summary>
+        /// <returns>True while recording</returns>
+        bool IsRecording() const { return m_recordFile.is_open(); }
+
+        /// <summary>
+        /// Whether recorded input is currently overriding live input.
+        /// </summary>
+        /// <returns>True while playing back</returns>
+        bool IsPlayingBack() const { return m_playbackFile.is_open(); }
+
+        // ========================================================================
+        // ACTION MAP
+        // ========================================================================
+
+        /// <summary>
+        /// Maximum number of mapped actions - action state packs into 64-bit
+        /// masks so a snapshot copies and queries as plain integers.
+        /// </summary>
+        static constexpr int kMaxActions = 64;
+
+        /// <summary>
+        /// Immutable per-frame view of the mapped action state.
+        ///
+        /// Update() builds the next frame's snapshot into a back buffer and
+        /// flips, so the snapshot actors read never changes mid-frame - safe
+        /// to query lock-free from job system workers during the parallel
+        /// actor update. Query by the dense index from GetActionIndex().
+        /// </summary>
+        struct ActionSnapshot {
+            uint64_t down{ 0 };       // action is held this frame
+            uint64_t pressed{ 0 };    // action went down this frame
+            uint64_t released{ 0 };   // action went up this frame
+            glm::vec2 mousePosition{ 0, 0 };
+            glm::vec2 mouseDelta{ 0, 0 };
+
+            bool GetDown(int action) const { return action >= 0 && (down >> action) & 1; }
+            bool GetPressed(int action) const { return action >= 0 && (pressed >> action) & 1; }
+            bool GetReleased(int action) const { return action >= 0 && (released >> action) & 1; }
+        };
+
+        /// <summary>
+        /// Loads action bindings from a JSON document.
+        ///
+        /// Each entry under "actions" names an action and lists the keys
+        /// (SDL key names, e.g. "W", "Space") and mouse buttons ("left",
+        /// "middle", "right") bound to it. Actions resolve to dense indices
+        /// in file order, so rebinding is a data edit, not a recompile.
+        /// </summary>
+        /// <param name="filename">Path to the JSON action map</param>
+        /// <returns>True if the map was loaded; otherwise, false</returns>
+        bool LoadActionMap(const std::string& filename);
+
+        /// <summary>
+        /// Resolves an action name to its dense index. Resolve once at
+        /// component Start and query snapshots by index every frame.
+        /// </summary>
+        /// <param name="name">Action name from the action map</param>
+        /// <returns>Dense action index, or -1 if the action is not mapped</returns>
+        int GetActionIndex(const std::string& name) const {
+            auto it = m_actionLookup.find(name);
+            return (it != m_actionLookup.end()) ? it->second : -1;
+        }
+
+        /// <summary>
+        /// The current frame's action snapshot, immutable until the next
+        /// Update(). The reference stays valid for the whole frame.
+        /// </summary>
+        const ActionSnapshot& GetSnapshot() const { return m_snapshots[m_snapshotIndex]; }
 
     private:
         /// <summary>
@@ -355,5 +567,74 @@ namespace neu {
         /// button states before querying new input from SDL.
         /// </summary>
         std::array<bool, 3> m_prevMouseButtonState{ false, false, false };
+
+        /// <summary>
+        /// This frame's mouse delta as served by GetMouseDelta: the
+        /// coalesced relative motion when motion events were pumped, else
+        /// the position difference (both are zero for an idle mouse).
+        /// </summary>
+        glm::vec2 m_mouseDelta{ 0, 0 };
+
+        /// <summary>
+        /// Event accumulators filled by ProcessEvent during the pump and
+        /// consumed (moved to the frame-facing values, then reset) by the
+        /// next Update. Main thread only - the pump and Update never overlap.
+        /// </summary>
+        glm::vec2 m_pendingMotion{ 0, 0 };
+        glm::vec2 m_pendingWheel{ 0, 0 };
+        bool m_pendingHadMotion{ false };
+        std::vector<InputEdge> m_pendingEdges;
+
+        /// <summary>
+        /// Frame-facing values consumed from the accumulators: stable for
+        /// the whole frame, like the rest of the queried input state.
+        /// </summary>
+        glm::vec2 m_mouseRelativeDelta{ 0, 0 };
+        glm::vec2 m_wheelDelta{ 0, 0 };
+        std::vector<InputEdge> m_edges;
+
+        /// <summary>
+        /// Relative mouse mode (raw input) is active - see SetRelativeMouseMode.
+        /// </summary>
+        bool m_relativeMode{ false };
+
+        /// <summary>
+        /// Window focus and minimized state from the SDL window events.
+        /// Focus defaults true so frames pumped before the first focus
+        /// event run at full rate.
+        /// </summary>
+        bool m_windowFocused{ true };
+        bool m_windowMinimized{ false };
+
+        /// <summary>
+        /// Recording and playback streams - at most one of the two is open.
+        /// The format is a small header (magic, version, snapshot size)
+        /// followed by one raw ActionSnapshot per frame.
+        /// </summary>
+        std::ofstream m_recordFile;
+        std::ifstream m_playbackFile;
+
+        /// <summary>
+        /// Raw bindings for one action - any bound key or button down means
+        /// the action is down.
+        /// </summary>
+        struct ActionBinding {
+            std::vector<int> keys;              // SDL scancodes
+            std::vector<uint8_t> mouseButtons;  // MouseButton indices
+        };
+
+        /// <summary>
+        /// Action bindings indexed by dense action index (file order), with
+        /// the name lookup used once at resolve time.
+        /// </summary>
+        std::vector<ActionBinding> m_actions;
+        std::unordered_map<std::string, int> m_actionLookup;
+
+        /// <summary>
+        /// Double-buffered action snapshots - Update() writes the back
+        /// buffer and flips, so the front snapshot is immutable all frame.
+        /// </summary>
+        std::array<ActionSnapshot, 2> m_snapshots;
+        int m_snapshotIndex{ 0 };
     };
 }
\ No newline at end of file
@@ -0,0 +1,402 @@
+#pragma once
+#include "Vector2.h"
+#include "Vector3.h"
+#include "Core/FrameArena.h"
+
+#include <cstddef>
+
+// SSE2 is baseline on every x64 target the engine builds for, so the
+// kernels use it directly; the scalar paths keep other targets correct
+// (and are written so the compiler can vectorize them anyway). Wider AVX
+// variants are deliberately left out - the build doesn't enable /arch:AVX,
+// and SSE over SoA data already saturates memory bandwidth for these loops
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define NEU_BATCH_SSE2
+#endif
+
+namespace neu::math::batch {
+	/// <summary>
+	/// SoA scratch spans for batch kernels, allocated from the frame arena.
+	///
+	/// The engine stores points AoS (arrays of Vector2/Vector3/glm types),
+	/// which is right for per-object access but wrong for SIMD - each lane
+	/// wants a contiguous run of one component. Systems working on thousands
+	/// of points deinterleave into one of these for the duration of the
+	/// frame's pass, run the kernels, and let the frame reset reclaim the
+	/// memory.
+	/// </summary>
+	struct Soa2 {
+		float* x{ nullptr };
+		float* y{ nullptr };
+		size_t count{ 0 };
+
+		static Soa2 FromFrameArena(size_t count) {
+			return {
+				(float*)FrameArena::Allocate(count * sizeof(float), 16),
+				(float*)FrameArena::Allocate(count * sizeof(float), 16),
+				count
+			};
+		}
+	};
+
+	struct Soa3 {
+		float* x{ nullptr };
+		float* y{ nullptr };
+		float* z{ nullptr };
+		size_t count{ 0 };
+
+		static Soa3 FromFrameArena(size_t count) {
+			return {
+				(float*)FrameArena::Allocate(count * sizeof(float), 16),
+				(float*)FrameArena::Allocate(count * sizeof(float), 16),
+				(float*)FrameArena::Allocate(count * sizeof(float), 16),
+				count
+			};
+		}
+	};
+
+	/// <summary>
+	/// Splits AoS points into SoA component spans. Works for any vector
+	/// type with x/y (and z) members - the engine's Vector2/Vector3 and the
+	/// glm types alike.
+	/// </summary>
+	template<typename V>
+	inline void Deinterleave(const V* points, Soa2& out, size_t count) {
+		for (size_t i = 0; i < count; i++) {
+			out.x[i] = (float)points[i].x;
+			out.y[i] = (float)points[i].y;
+		}
+	}
+
+	template<typename V>
+	inline void Deinterleave(const V* points, Soa3& out, size_t count) {
+		for (size_t i = 0; i < count; i++) {
+			out.x[i] = (float)points[i].x;
+			out.y[i] = (float)points[i].y;
+			out.z[i] = (float)points[i].z;
+		}
+	}
+
+	/// <summary>
+	/// Packs SoA component spans back into AoS points, inverse of
+	/// Deinterleave().
+	/// </summary>
+	template<typename V>
+	inline void Interleave(const Soa2& in, V* points, size_t count) {
+		for (size_t i = 0; i < count; i++) {
+			points[i].x = in.x[i];
+			points[i].y = in.y[i];
+		}
+	}
+
+	template<typename V>
+	inline void Interleave(const Soa3& in, V* points, size_t count) {
+		for (size_t i = 0; i < count; i++) {
+			points[i].x = in.x[i];
+			points[i].y = in.y[i];
+			points[i].z = in.z[i];
+		}
+	}
+
+	/// <summary>
+	/// out[i] = a[i] + b[i] over one component span. Component-wise vector
+	/// addition is this kernel run once per SoA channel.
+	/// </summary>
+	inline void Add(const float* a, const float* b, float* out, size_t count) {
+		size_t i = 0;
+#ifdef NEU_BATCH_SSE2
+		for (; i + 4 <= count; i += 4) {
+			_mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+		}
+#endif
+		for (; i < count; i++) out[i] = a[i] + b[i];
+	}
+
+	/// <summary>
+	/// out[i] = a[i] * scale over one component span.
+	/// </summary>
+	inline void Scale(const float* a, float scale, float* out, size_t count) {
+		size_t i = 0;
+#ifdef NEU_BATCH_SSE2
+		__m128 s = _mm_set1_ps(scale);
+		for (; i + 4 <= count; i += 4) {
+			_mm_storeu_ps(out + i, _mm_mul_ps(_mm_loadu_ps(a + i), s));
+		}
+#endif
+		for (; i < count; i++) out[i] = a[i] * scale;
+	}
+
+	/// <summary>
+	/// out[i] += a[i] * scale over one component span - the integration
+	/// step (position += velocity * dt) as a kernel.
+	/// </summary>
+	inline void MulAdd(const float* a, float scale, float* out, size_t count) {
+		size_t i = 0;
+#ifdef NEU_BATCH_SSE2
+		__m128 s = _mm_set1_ps(scale);
+		for (; i + 4 <= count; i += 4) {
+			_mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(out + i), _mm_mul_ps(_mm_loadu_ps(a + i), s)));
+		}
+#endif
+		for (; i < count; i++) out[i] += a[i] * scale;
+	}
+
+	/// <summary>
+	/// out[i] = dot(a[i], b[i]) for 2D SoA spans.
+	/// </summary>
+	inline void Dot(const Soa2& a, const Soa2& b, float* out, size_t count) {
+		size_t i = 0;
+#ifdef NEU_BATCH_SSE2
+		for (; i + 4 <= count; i += 4) {
+			__m128 xx = _mm_mul_ps(_mm_loadu_ps(a.x + i), _mm_loadu_ps(b.x + i));
+			__m128 yy = _mm_mul_ps(_mm_loadu_ps(a.y + i), _mm_loadu_ps(b.y + i));
+			_mm_storeu_ps(out + i, _mm_add_ps(xx, yy));
+		}
+#endif
+		for (; i < count; i++) out[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i];
+	}
+
+	/// <summary>
+	/// out[i] = dot(a[i], b[i]) for 3D SoA spans.
+	/// </summary>
+	inline void Dot(const Soa3& a, const Soa3& b, float* out, size_t count) {
+		size_t i = 0;
+#ifdef NEU_BATCH_SSE2
+		for (; i + 4 <= count; i += 4) {
+			__m128 xx = _mm_mul_ps(_mm_loadu_ps(a.x + i), _mm_loadu_ps(b.x + i));
+			__m128 yy = _mm_mul_ps(_mm_loadu_ps(a.y + i), _mm_loadu_ps(b.y + i));
+			__m128 zz = _mm_mul_ps(_mm_loadu_ps(a.z + i), _mm_loadu_ps(b.z + i));
+			_mm_storeu_ps(out + i, _mm_add_ps(_mm_add_ps(xx, yy), zz));
+		}
+#endif
+		for (; i < count; i++) out[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i];
+	}
+
+	/// <summary>
+	/// out[i] = distance(a[i], b[i]) for 2D SoA spans.
+	/// </summary>
+	inline void Distance(const Soa2& a, const Soa2& b, float* out, size_t count) {
+		size_t i = 0;
+#ifdef NEU_BATCH_SSE2
+		for (; i + 4 <= count; i += 4) {
+			__m128 dx = _mm_sub_ps(_mm_loadu_ps(a.x + i), _mm_loadu_ps(b.x + i));
+			__m128 dy = _mm_sub_ps(_mm_loadu_ps(a.y + i), _mm_loadu_ps(b.y + i));
+			_mm_storeu_ps(out + i, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy))));
+		}
+#endif
+		for (; i < count; i++) {
+			float dx = a.x[i] - b.x[i];
+			float dy = a.y[i] - b.y[i];
+			out[i] = math::sqrtf(dx * dx + dy * dy);
+		}
+	}
+
+	/// <summary>
+	/// out[i] = distance(a[i], b[i]) for 3D SoA spans.
+	/// </summary>
+	inline void Distance(const Soa3& a, const Soa3& b, float* out, size_t count) {
+		size_t i = 0;
+#ifdef NEU_BATCH_SSE2
+		for (; i + 4 <= count; i += 4) {
+			__m128 dx = _mm_sub_ps(_mm_loadu_ps(a.x + i), _mm_loadu_ps(b.x + i));
+			__m128 dy = _mm_sub_ps(_mm_loadu_ps(a.y + i), _mm_loadu_ps(b.y + i));
+			__m128 dz = _mm_sub_ps(_mm_loadu_ps(a.z + i), _mm_loadu_ps(b.z + i));
+			__m128 d2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+			_mm_storeu_ps(out + i, _mm_sqrt_ps(d2));
+		}
+#endif
+		for (; i < count; i++) {
+			float dx = a.x[i] - b.x[i];
+			float dy = a.y[i] - b.y[i];
+			float dz = a.z[i] - b.z[i];
+			out[i] = math::sqrtf(dx * dx + dy * dy + dz * dz);
+		}
+	}
+
+	/// <summary>
+	/// out[i] = distance(point, b[i]) - the one-to-many form used for
+	/// camera-distance scoring passes.
+	/// </summary>
+	template<typename V>
+	inline void Distance(const V& point, const Soa3& b, float* out, size_t count) {
+		size_t i = 0;
+#ifdef NEU_BATCH_SSE2
+		__m128 px = _mm_set1_ps((float)point.x);
+		__m128 py = _mm_set1_ps((float)point.y);
+		__m128 pz = _mm_set1_ps((float)point.z);
+		for (; i + 4 <= count; i += 4) {
+			__m128 dx = _mm_sub_ps(px, _mm_loadu_ps(b.x + i));
+			__m128 dy = _mm_sub_ps(py, _mm_loadu_ps(b.y + i));
+			__m128 dz = _mm_sub_ps(pz, _mm_loadu_ps(b.z + i));
+			__m128 d2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+			_mm_storeu_ps(out + i, _mm_sqrt_ps(d2));
+		}
+#endif
+		for (; i < count; i++) {
+			float dx = point.x - b.x[i];
+			float dy = point.y - b.y[i];
+			float dz = point.z - b.z[i];
+			out[i] = math::sqrtf(dx * dx + dy * dy + dz * dz);
+		}
+	}
+
+	/// <summary>
+	/// out[i] = 1 when AABB pair i overlaps, else 0. Inputs are the min and
+	/// max corners of each side's box; the comparison is inclusive, matching
+	/// Bounds::Intersects().
+	/// </summary>
+	inline void OverlapAabb(const Soa3& minA, const Soa3& maxA, const Soa3& minB, const Soa3& maxB, uint8_t* out, size_t count) {
+		size_t i = 0;
+#ifdef NEU_BATCH_SSE2
+		for (; i + 4 <= count; i += 4) {
+			__m128 x = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(minA.x + i), _mm_loadu_ps(maxB.x + i)),
+				_mm_cmple_ps(_mm_loadu_ps(minB.x + i), _mm_loadu_ps(maxA.x + i)));
+			__m128 y = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(minA.y + i), _mm_loadu_ps(maxB.y + i)),
+				_mm_cmple_ps(_mm_loadu_ps(minB.y + i), _mm_loadu_ps(maxA.y + i)));
+			__m128 z = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(minA.z + i), _mm_loadu_ps(maxB.z + i)),
+				_mm_cmple_ps(_mm_loadu_ps(minB.z + i), _mm_loadu_ps(maxA.z + i)));
+
+			int mask = _mm_movemask_ps(_mm_and_ps(_mm_and_ps(x, y), z));
+			out[i + 0] = (mask >> 0) & 1;
+			out[i + 1] = (mask >> 1) & 1;
+			out[i + 2] = (mask >> 2) & 1;
+			out[i + 3] = (mask >> 3) & 1;
+		}
+#endif
+		for (; i < count; i++) {
+			out[i] =
+				minA.x[i] <= maxB.x[i] && minB.x[i] <= maxA.x[i] &&
+				minA.y[i] <= maxB.y[i] && minB.y[i] <= maxA.y[i] &&
+				minA.z[i] <= maxB.z[i] && minB.z[i] <= maxA.z[i];
+		}
+	}
+
+	/// <summary>
+	/// out[i] = 1 when sphere pair i overlaps, else 0. Inputs are the two
+	/// center spans and the per-pair summed radii; the test is squared
+	/// center distance against the squared radius sum.
+	/// </summary>
+	inline void OverlapSphere(const Soa3& a, const Soa3& b, const float* radiusSum, uint8_t* out, size_t count) {
+		size_t i = 0;
+#ifdef NEU_BATCH_SSE2
+		for (; i + 4 <= count; i += 4) {
+			__m128 dx = _mm_sub_ps(_mm_loadu_ps(a.x + i), _mm_loadu_ps(b.x + i));
+			__m128 dy = _mm_sub_ps(_mm_loadu_ps(a.y + i), _mm_loadu_ps(b.y + i));
+			__m128 dz = _mm_sub_ps(_mm_loadu_ps(a.z + i), _mm_loadu_ps(b.z + i));
+			__m128 d2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+
+			__m128 r = _mm_loadu_ps(radiusSum + i);
+			int mask = _mm_movemask_ps(_mm_cmple_ps(d2, _mm_mul_ps(r, r)));
+			out[i + 0] = (mask >> 0) & 1;
+			out[i + 1] = (mask >> 1) & 1;
+			out[i + 2] = (mask >> 2) & 1;
+			out[i + 3] = (mask >> 3) & 1;
+		}
+#endif
+		for (; i < count; i++) {
+			float dx = a.x[i] - b.x[i];
+			float dy = a.y[i] - b.y[i];
+			float dz = a.z[i] - b.z[i];
+			out[i] = dx * dx + dy * dy + dz * dz <= radiusSum[i] * radiusSum[i];
+		}
+	}
+
+	/// <summary>
+	/// out[i] = 1 when sphere i overlaps AABB i, else 0. The sphere center
+	/// clamps to the box to find the closest point, then squared distance
+	/// tests against the squared radius.
+	/// </summary>
+	inline void OverlapSphereAabb(const Soa3& center, const Soa3& boxMin, const Soa3& boxMax, const float* radius, uint8_t* out, size_t count) {
+		size_t i = 0;
+#ifdef NEU_BATCH_SSE2
+		for (; i + 4 <= count; i += 4) {
+			__m128 cx = _mm_loadu_ps(center.x + i);
+			__m128 cy = _mm_loadu_ps(center.y + i);
+			__m128 cz = _mm_loadu_ps(center.z + i);
+
+			__m128 dx = _mm_sub_ps(_mm_min_ps(_mm_max_ps(cx, _mm_loadu_ps(boxMin.x + i)), _mm_loadu_ps(boxMax.x + i)), cx);
+			__m128 dy = _mm_sub_ps(_mm_min_ps(_mm_max_ps(cy, _mm_loadu_ps(boxMin.y + i)), _mm_loadu_ps(boxMax.y + i)), cy);
+			__m128 dz = _mm_sub_ps(_mm_min_ps(_mm_max_ps(cz, _mm_loadu_ps(boxMin.z + i)), _mm_loadu_ps(boxMax.z + i)), cz);
+			__m128 d2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+
+			__m128 r = _mm_loadu_ps(radius + i);
+			int mask = _mm_movemask_ps(_mm_cmple_ps(d2, _mm_mul_ps(r, r)));
+			out[i + 0] = (mask >> 0) & 1;
+			out[i + 1] = (mask >> 1) & 1;
+			out[i + 2] = (mask >> 2) & 1;
+			out[i + 3] = (mask >> 3) & 1;
+		}
+#endif
+		for (; i < count; i++) {
+			float dx = math::clamp(center.x[i], boxMin.x[i], boxMax.x[i]) - center.x[i];
+			float dy = math::clamp(center.y[i], boxMin.y[i], boxMax.y[i]) - center.y[i];
+			float dz = math::clamp(center.z[i], boxMin.z[i], boxMax.z[i]) - center.z[i];
+			out[i] = dx * dx + dy * dy + dz * dz <= radius[i] * radius[i];
+		}
+	}
+
+	/// <summary>
+	/// Normalizes 2D SoA spans in place. Zero-length entries stay zero
+	/// instead of producing NaNs, matching Vector2::Normalized().
+	/// </summary>
+	inline void Normalize(Soa2& values, size_t count) {
+		size_t i = 0;
+#ifdef NEU_BATCH_SSE2
+		__m128 zero = _mm_setzero_ps();
+		for (; i + 4 <= count; i += 4) {
+			__m128 x = _mm_loadu_ps(values.x + i);
+			__m128 y = _mm_loadu_ps(values.y + i);
+			__m128 len2 = _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y));
+
+			// SSE2 has no blend - build the select from the > 0 mask so
+			// zero-length lanes divide by 1 and stay zero
+			__m128 mask = _mm_cmpgt_ps(len2, zero);
+			__m128 len = _mm_sqrt_ps(len2);
+			__m128 safe = _mm_or_ps(_mm_and_ps(mask, len), _mm_andnot_ps(mask, _mm_set1_ps(1.0f)));
+
+			_mm_storeu_ps(values.x + i, _mm_div_ps(x, safe));
+			_mm_storeu_ps(values.y + i, _mm_div_ps(y, safe));
+		}
+#endif
+		for (; i < count; i++) {
+			float len2 = values.x[i] * values.x[i] + values.y[i] * values.y[i];
+			if (len2 <= 0) continue;
+			float inv = 1.0f / math::sqrtf(len2);
+			values.x[i] *= inv;
+			values.y[i] *= inv;
+		}
+	}
+
+	/// <summary>
+	/// Normalizes 3D SoA spans in place. Zero-length entries stay zero.
+	/// </summary>
+	inline void Normalize(Soa3& values, size_t count) {
+		size_t i = 0;
+#ifdef NEU_BATCH_SSE2
+		__m128 zero = _mm_setzero_ps();
+		for (; i + 4 <= count; i += 4) {
+			__m128 x = _mm_loadu_ps(values.x + i);
+			__m128 y = _mm_loadu_ps(values.y + i);
+			__m128 z = _mm_loadu_ps(values.z + i);
+			__m128 len2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+
+			__m128 mask = _mm_cmpgt_ps(len2, zero);
+			__m128 len = _mm_sqrt_ps(len2);
+			__m128 safe = _mm_or_ps(_mm_and_ps(mask, len), _mm_andnot_ps(mask, _mm_set1_ps(1.0f)));
+
+			_mm_storeu_ps(values.x + i, _mm_div_ps(x, safe));
+			_mm_storeu_ps(values.y + i, _mm_div_ps(y, safe));
+			_mm_storeu_ps(values.z + i, _mm_div_ps(z, safe));
+		}
+#endif
+		for (; i < count; i++) {
+			float len2 = values.x[i] * values.x[i] + values.y[i] * values.y[i] + values.z[i] * values.z[i];
+			if (len2 <= 0) continue;
+			float inv = 1.0f / math::sqrtf(len2);
+			values.x[i] *= inv;
+			values.y[i] *= inv;
+			values.z[i] *= inv;
+		}
+	}
+}
@@ -0,0 +1,105 @@
+#pragma once
+#include <glm/glm.hpp>
+#include <utility>
+
+namespace neu {
+    /// <summary>
+    /// Axis-aligned bounding box used for culling and spatial queries.
+    /// Models compute a local-space bound at load time; renderer components
+    /// transform it into world space with the owning actor's matrix.
+    /// </summary>
+    struct Bounds {
+        glm::vec3 min{ 0, 0, 0 };
+        glm::vec3 max{ 0, 0, 0 };
+        bool valid{ false };
+
+        glm::vec3 Center() const { return (min + max) * 0.5f; }
+        glm::vec3 Size() const { return max - min; }
+
+        // grow the bounds to include a point
+        void Encapsulate(const glm::vec3& point) {
+            if (!valid) {
+                min = max = point;
+                valid = true;
+                return;
+            }
+            min = glm::min(min, point);
+            max = glm::max(max, point);
+        }
+
+        // grow the bounds to include another bounds
+        void Encapsulate(const Bounds& bounds) {
+            if (!bounds.valid) return;
+            Encapsulate(bounds.min);
+            Encapsulate(bounds.max);
+        }
+
+        // copy grown outward by a uniform margin on every axis
+        Bounds Expanded(float margin) const {
+            Bounds result = *this;
+            if (!valid) return result;
+            result.min -= glm::vec3{ margin };
+            result.max += glm::vec3{ margin };
+            return result;
+        }
+
+        // true if the other box lies entirely inside this one
+        bool Contains(const Bounds& bounds) const {
+            if (!valid || !bounds.valid) return false;
+            return bounds.min.x >= min.x && bounds.max.x <= max.x &&
+                bounds.min.y >= min.y && bounds.max.y <= max.y &&
+                bounds.min.z >= min.z && bounds.max.z <= max.z;
+        }
+
+        // true if the two boxes overlap (touching counts)
+        bool Intersects(const Bounds& bounds) const {
+            if (!valid || !bounds.valid) return false;
+            return bounds.min.x <= max.x && bounds.max.x >= min.x &&
+                bounds.min.y <= max.y && bounds.max.y >= min.y &&
+                bounds.min.z <= max.z && bounds.max.z >= min.z;
+        }
+
+        // slab test: true if the ray hits the box within maxDistance
+        bool IntersectsRay(const glm::vec3& origin, const glm::vec3& direction, float maxDistance) const {
+            if (!valid) return false;
+
+            float tmin = 0;
+            float tmax = maxDistance;
+            for (int i = 0; i < 3; i++) {
+                if (glm::abs(direction[i]) < 1e-8f) {
+                    // ray parallel to this slab, miss unless origin is inside it
+                    if (origin[i] < min[i] || origin[i] > max[i]) return false;
+                    continue;
+                }
+
+                float inv = 1.0f / direction[i];
+                float t0 = (min[i] - origin[i]) * inv;
+                float t1 = (max[i] - origin[i]) * inv;
+                if (t0 > t1) std::swap(t0, t1);
+
+                tmin = glm::max(tmin, t0);
+                tmax = glm::min(tmax, t1);
+                if (tmin > tmax) return false;
+            }
+
+            return true;
+        }
+
+        // world-space AABB of this box transformed by a matrix (8 corners)
+        Bounds Transformed(const glm::mat4& matrix) const {
+            Bounds result;
+            if (!valid) return result;
+
+            for (int i = 0; i < 8; i++) {
+                glm::vec3 corner{
+                    (i & 1) ? max.x : min.x,
+                    (i & 2) ? max.y : min.y,
+                    (i & 4) ? max.z : min.z
+                };
+                result.Encapsulate(glm::vec3(matrix * glm::vec4(corner, 1)));
+            }
+
+            return result;
+        }
+    };
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include "Bounds.h"
+#include <glm/glm.hpp>
+
+namespace neu {
+    /// <summary>
+    /// View frustum as six planes extracted from a view-projection matrix
+    /// (Gribb/Hartmann method). Used by Scene to cull renderer bounds before
+    /// issuing draws.
+    /// </summary>
+    struct Frustum {
+        // plane equations (xyz = normal, w = distance), pointing inward
+        glm::vec4 planes[6];
+
+        static Frustum FromMatrix(const glm::mat4& viewProjection) {
+            Frustum frustum;
+            const glm::mat4& m = viewProjection;
+
+            // rows of the matrix (glm is column-major, so index [col][row])
+            glm::vec4 row0{ m[0][0], m[1][0], m[2][0], m[3][0] };
+            glm::vec4 row1{ m[0][1], m[1][1], m[2][1], m[3][1] };
+            glm::vec4 row2{ m[0][2], m[1][2], m[2][2], m[3][2] };
+            glm::vec4 row3{ m[0][3], m[1][3], m[2][3], m[3][3] };
+
+            frustum.planes[0] = row3 + row0;  // left
+            frustum.planes[1] = row3 - row0;  // right
+            frustum.planes[2] = row3 + row1;  // bottom
+            frustum.planes[3] = row3 - row1;  // top
+            frustum.planes[4] = row3 + row2;  // near
+            frustum.planes[5] = row3 - row2;  // far
+
+            for (auto& plane : frustum.planes) {
+                float length = glm::length(glm::vec3(plane));
+                if (length > 0) plane /= length;
+            }
+
+            return frustum;
+        }
+
+        // true if the bounds touch or intersect the frustum (p-vertex test)
+        bool Intersects(const Bounds& bounds) const {
+            if (!bounds.valid) return true;
+
+            for (auto& plane : planes) {
+                // positive vertex: corner of the box furthest along the normal
+                glm::vec3 p{
+                    (plane.x >= 0) ? bounds.max.x : bounds.min.x,
+                    (plane.y >= 0) ? bounds.max.y : bounds.min.y,
+                    (plane.z >= 0) ? bounds.max.z : bounds.min.z
+                };
+
+                if (glm::dot(glm::vec3(plane), p) + plane.w < 0) return false;
+            }
+
+            return true;
+        }
+    };
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include <SDL3/SDL.h>
 #include <algorithm>
+#include <array>
 #include <cmath>
 
 namespace neu::math {
@@ -59,21 +60,88 @@ namespace neu::math {
 	/// <param name="v">The value whose sign is to be determined.</param>
 	/// <returns>Returns -1 if the value is negative, 1 if positive, and 0 if zero.</returns>
 	template<typename T>
-	inline T Sign(T v) {
+	constexpr T Sign(T v) {
 		return (v < 0) ? (T)-1 : (v > 0) ? (T)1 : (T)0;
 	}
 
-	template<std::floating_point T> 
-	inline T Lerp(T min, T max, T t) {
+	template<std::floating_point T>
+	constexpr T Lerp(T min, T max, T t) {
 		return min + (max - min) * t;
 	}
 
 	template<std::floating_point T>
-	inline T Remap(T min1, T max1, T min2, T max2, T value) {
+	constexpr T Remap(T min1, T max1, T min2, T max2, T value) {
 		T t = 0; // 0 to 1
 		return Lerp(min2, max2, t);
 	}
 
+	/// <summary>
+	/// Quarter-wave sine table resolution - 256 steps across [0, π/2] keeps
+	/// the interpolated error under ~2e-5, plenty for directions and motion.
+	/// </summary>
+	inline constexpr int kSinTableSize = 256;
+
+	namespace detail {
+		/// <summary>
+		/// Generates the quarter-wave sine table at compile time. std::sin
+		/// isn't constexpr, so entries come from the Taylor series - over
+		/// [0, π/2] ten terms converge well past float precision. The table
+		/// lands in rodata; nothing runs at startup.
+		/// </summary>
+		consteval std::array<float, kSinTableSize + 1> MakeSinTable() {
+			std::array<float, kSinTableSize + 1> table{};
+			for (int i = 0; i <= kSinTableSize; i++) {
+				double x = (3.1415926535897932384626433832795 * 0.5 * i) / kSinTableSize;
+				double term = x;
+				double sum = x;
+				for (int n = 1; n <= 10; n++) {
+					term *= -x * x / ((2.0 * n) * (2.0 * n + 1.0));
+					sum += term;
+				}
+				table[i] = (float)sum;
+			}
+			return table;
+		}
+
+		inline constexpr auto kSinTable = MakeSinTable();
+	}
+
+	/// <summary>
+	/// Table-based sine: quarter-wave lookup with linear interpolation,
+	/// mirrored across quadrants. Several times cheaper than the library
+	/// call and accurate to ~2e-5 - right for directions, orbits and other
+	/// motion math; use sinf where full precision matters.
+	/// </summary>
+	/// <param name="radians">The angle in radians (any range)</param>
+	/// <returns>Approximate sine of the angle</returns>
+	inline float FastSin(float radians) {
+		// reduce to quarter waves, wrapped into [0, 4)
+		float t = radians * (2.0f / pi);
+		t -= 4.0f * std::floor(t * 0.25f);
+
+		int quadrant = (int)t;
+		float fraction = t - quadrant;
+
+		// odd quadrants run the quarter wave backwards
+		float u = (quadrant & 1) ? 1.0f - fraction : fraction;
+
+		float scaled = u * kSinTableSize;
+		int index = std::min((int)scaled, kSinTableSize - 1);
+		float blend = scaled - index;
+
+		float value = Lerp(detail::kSinTable[index], detail::kSinTable[index + 1], blend);
+		return (quadrant >= 2) ? -value : value;
+	}
+
+	/// <summary>
+	/// Table-based cosine, phase-shifted FastSin.
+	/// </summary>
+	/// <param name="radians">The angle in radians (any range)</param>
+	/// <returns>Approximate cosine of the angle</returns>
+	inline float FastCos(float radians) {
+		return FastSin(radians + halfPi);
+	}
+
 	using std::min;
 	using std::max;
 	using std::clamp;
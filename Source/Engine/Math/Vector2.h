@@ -33,6 +33,8 @@ namespace neu {
     /// - Union allows zero-cost abstraction for different coordinate interpretations
     /// - Template specialization enables optimal code generation for different types
     /// - Methods marked const where appropriate to enable compiler optimizations
+    /// - Construction and arithmetic are constexpr, so named constants and derived
+    ///   values fold to compile-time data instead of startup computation
     /// </summary>
     /// <typeparam name="T">The numeric type for vector components (typically int, float, or double)</typeparam>
     template<typename T>
@@ -67,7 +69,7 @@ namespace neu {
         /// </summary>
         /// <param name="x">The x-component (horizontal) of the vector</param>
         /// <param name="y">The y-component (vertical) of the vector</param>
-        Vector2(T x, T y) : x{ x }, y{ y } {}
+        constexpr Vector2(T x, T y) : x{ x }, y{ y } {}
 
         /// <summary>
         /// Const array-style accessor for vector components.
@@ -104,7 +106,7 @@ namespace neu {
         /// </summary>
         /// <param name="v">The vector to add to this vector</param>
         /// <returns>A new vector representing the sum of the two vectors</returns>
-        Vector2 operator + (const Vector2& v) const { return Vector2{ x + v.x, y + v.y }; }
+        constexpr Vector2 operator + (const Vector2& v) const { return Vector2{ x + v.x, y + v.y }; }
 
         /// <summary>
         /// Vector subtraction operator.
@@ -113,7 +115,7 @@ namespace neu {
         /// </summary>
         /// <param name="v">The vector to subtract from this vector</param>
         /// <returns>A new vector representing the difference of the two vectors</returns>
-        Vector2 operator - (const Vector2& v) const { return Vector2{ x - v.x, y - v.y }; }
+        constexpr Vector2 operator - (const Vector2& v) const { return Vector2{ x - v.x, y - v.y }; }
 
         /// <summary>
         /// Vector multiplication operator (component-wise).
@@ -122,7 +124,7 @@ namespace neu {
         /// </summary>
         /// <param name="v">The vector to multiply with this vector</param>
         /// <returns>A new vector with components multiplied pairwise</returns>
-        Vector2 operator * (const Vector2& v) const { return Vector2{ x * v.x, y * v.y }; }
+        constexpr Vector2 operator * (const Vector2& v) const { return Vector2{ x * v.x, y * v.y }; }
 
         /// <summary>
         /// Vector division operator (component-wise).
@@ -132,7 +134,7 @@ namespace neu {
         /// </summary>
         /// <param name="v">The vector to divide this vector by</param>
         /// <returns>A new vector with components divided pairwise</returns>
-        Vector2 operator / (const Vector2& v) const { return Vector2{ x / v.x, y / v.y }; }
+        constexpr Vector2 operator / (const Vector2& v) const { return Vector2{ x / v.x, y / v.y }; }
 
         // ====================================================================
         // SCALAR ARITHMETIC OPERATORS
@@ -145,7 +147,7 @@ namespace neu {
         /// </summary>
         /// <param name="s">The scalar value to add to both components</param>
         /// <returns>A new vector with the scalar added to both components</returns>
-        Vector2 operator + (float s) const { return Vector2{ x + s, y + s }; }
+        constexpr Vector2 operator + (float s) const { return Vector2{ x + s, y + s }; }
 
         /// <summary>
         /// Scalar subtraction operator.
@@ -154,7 +156,7 @@ namespace neu {
         /// </summary>
         /// <param name="s">The scalar value to subtract from both components</param>
         /// <returns>A new vector with the scalar subtracted from both components</returns>
-        Vector2 operator - (float s) const { return Vector2{ x - s, y - s }; }
+        constexpr Vector2 operator - (float s) const { return Vector2{ x - s, y - s }; }
 
         /// <summary>
         /// Scalar multiplication operator.
@@ -164,7 +166,7 @@ namespace neu {
         /// </summary>
         /// <param name="s">The scalar value to multiply both components by</param>
         /// <returns>A new vector scaled by the scalar value</returns>
-        Vector2 operator * (float s) const { return Vector2{ x * s, y * s }; }
+        constexpr Vector2 operator * (float s) const { return Vector2{ x * s, y * s }; }
 
         /// <summary>
         /// Scalar division operator.
@@ -175,7 +177,7 @@ namespace neu {
         /// </summary>
         /// <param name="s">The scalar value to divide both components by</param>
         /// <returns>A new vector with both components divided by the scalar</returns>
-        Vector2 operator / (float s) const { return Vector2{ x / s, y / s }; }
+        constexpr Vector2 operator / (float s) const { return Vector2{ x / s, y / s }; }
 
         // ====================================================================
         // COMPOUND ASSIGNMENT OPERATORS (VECTOR)
@@ -188,7 +190,7 @@ namespace neu {
         /// </summary>
         /// <param name="v">The vector to add to this vector</param>
         /// <returns>Reference to this vector after the operation</returns>
-        Vector2& operator += (const Vector2& v) { x += v.x; y += v.y; return *this; }
+        constexpr Vector2& operator += (const Vector2& v) { x += v.x; y += v.y; return *this; }
 
         /// <summary>
         /// Vector subtraction assignment operator.
@@ -197,7 +199,7 @@ namespace neu {
         /// </summary>
         /// <param name="v">The vector to subtract from this vector</param>
         /// <returns>Reference to this vector after the operation</returns>
-        Vector2& operator -= (const Vector2& v) { x -= v.x; y -= v.y; return *this; }
+        constexpr Vector2& operator -= (const Vector2& v) { x -= v.x; y -= v.y; return *this; }
 
         /// <summary>
         /// Vector multiplication assignment operator.
@@ -206,7 +208,7 @@ namespace neu {
         /// </summary>
         /// <param name="v">The vector to multiply this vector by</param>
         /// <returns>Reference to this vector after the operation</returns>
-        Vector2& operator *= (const Vector2& v) { x *= v.x; y *= v.y; return *this; }
+        constexpr Vector2& operator *= (const Vector2& v) { x *= v.x; y *= v.y; return *this; }
 
         /// <summary>
         /// Vector division assignment operator.
@@ -215,7 +217,7 @@ namespace neu {
         /// </summary>
         /// <param name="v">The vector to divide this vector by</param>
         /// <returns>Reference to this vector after the operation</returns>
-        Vector2& operator /= (const Vector2& v) { x /= v.x; y /= v.y; return *this; }
+        constexpr Vector2& operator /= (const Vector2& v) { x /= v.x; y /= v.y; return *this; }
 
         // ====================================================================
         // COMPOUND ASSIGNMENT OPERATORS (SCALAR)
@@ -227,7 +229,7 @@ namespace neu {
         /// </summary>
         /// <param name="s">The scalar value to add to both components</param>
         /// <returns>Reference to this vector after the operation</returns>
-        Vector2& operator += (float s) { x += s; y += s; return *this; }
+        constexpr Vector2& operator += (float s) { x += s; y += s; return *this; }
 
         /// <summary>
         /// Scalar subtraction assignment operator.
@@ -235,7 +237,7 @@ namespace neu {
         /// </summary>
         /// <param name="s">The scalar value to subtract from both components</param>
         /// <returns>Reference to this vector after the operation</returns>
-        Vector2& operator -= (float s) { x -= s; y -= s; return *this; }
+        constexpr Vector2& operator -= (float s) { x -= s; y -= s; return *this; }
 
         /// <summary>
         /// Scalar multiplication assignment operator.
@@ -244,7 +246,7 @@ namespace neu {
         /// </summary>
         /// <param name="s">The scalar value to multiply both components by</param>
         /// <returns>Reference to this vector after the operation</returns>
-        Vector2& operator *= (float s) { x *= s; y *= s; return *this; }
+        constexpr Vector2& operator *= (float s) { x *= s; y *= s; return *this; }
 
         /// <summary>
         /// Scalar division assignment operator.
@@ -252,7 +254,7 @@ namespace neu {
         /// </summary>
         /// <param name="s">The scalar value to divide both components by</param>
         /// <returns>Reference to this vector after the operation</returns>
-        Vector2& operator /= (float s) { x /= s; y /= s; return *this; }
+        constexpr Vector2& operator /= (float s) { x /= s; y /= s; return *this; }
 
         // ====================================================================
         // VECTOR MATHEMATICS METHODS
@@ -274,7 +276,7 @@ namespace neu {
         /// - Physics calculations involving kinetic energy (proportional to velocity²)
         /// </summary>
         /// <returns>The squared magnitude of the vector</returns>
-        float LengthSqr() const { return (x * x) + (y * y); }
+        constexpr float LengthSqr() const { return (x * x) + (y * y); }
 
         /// <summary>
         /// Calculates the length (magnitude) of this vector.
@@ -396,7 +398,7 @@ namespace neu {
         /// <param name="a">The first vector</param>
         /// <param name="b">The second vector</param>
         /// <returns>The scalar dot product of the two vectors</returns>
-        static float Dot(const Vector2& a, const Vector2& b) {
+        static constexpr float Dot(const Vector2& a, const Vector2& b) {
             return a.x * b.x + a.y * b.y;
         }
 
@@ -424,7 +426,7 @@ namespace neu {
         /// <param name="a">The first vector</param>
         /// <param name="b">The second vector</param>
         /// <returns>The scalar cross product of the two vectors</returns>
-        static float Cross(const Vector2& a, const Vector2& b) {
+        static constexpr float Cross(const Vector2& a, const Vector2& b) {
             return a.x * b.y - a.y * b.x;
         }
 
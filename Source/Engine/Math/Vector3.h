@@ -35,6 +35,8 @@ namespace neu {
     /// - Template specialization enables optimal code generation for different types
     /// - Methods marked const where appropriate to enable compiler optimizations
     /// - Assertion-based bounds checking (removed in release builds for performance)
+    /// - Construction and arithmetic are constexpr, so named constants and derived
+    ///   values fold to compile-time data instead of startup computation
     /// </summary>
     /// <typeparam name="T">The numeric type for vector components (typically int, float, or double)</typeparam>
     template<typename T>
@@ -75,7 +77,7 @@ namespace neu {
         /// <param name="x">The x-component (horizontal/red) of the vector</param>
         /// <param name="y">The y-component (vertical/green) of the vector</param>
         /// <param name="z">The z-component (depth/blue) of the vector</param>
-        Vector3(T x, T y, T z) : x{ x }, y{ y }, z{ z } {}
+        constexpr Vector3(T x, T y, T z) : x{ x }, y{ y }, z{ z } {}
 
         /// <summary>
         /// Const array-style accessor for vector components with bounds checking.
@@ -119,7 +121,7 @@ namespace neu {
         /// </summary>
         /// <param name="v">The vector to add to this vector</param>
         /// <returns>A new vector representing the sum of the two vectors</returns>
-        Vector3 operator + (const Vector3& v) const { return Vector3{ x + v.x, y + v.y, z + v.z }; }
+        constexpr Vector3 operator + (const Vector3& v) const { return Vector3{ x + v.x, y + v.y, z + v.z }; }
 
         /// <summary>
         /// Vector subtraction operator.
@@ -135,7 +137,7 @@ namespace neu {
         /// </summary>
         /// <param name="v">The vector to subtract from this vector</param>
         /// <returns>A new vector representing the difference of the two vectors</returns>
-        Vector3 operator - (const Vector3& v) const { return Vector3{ x - v.x, y - v.y, z - v.z }; }
+        constexpr Vector3 operator - (const Vector3& v) const { return Vector3{ x - v.x, y - v.y, z - v.z }; }
 
         /// <summary>
         /// Vector multiplication operator (component-wise).
@@ -152,7 +154,7 @@ namespace neu {
         /// </summary>
         /// <param name="v">The vector to multiply with this vector</param>
         /// <returns>A new vector with components multiplied pairwise</returns>
-        Vector3 operator * (const Vector3& v) const { return Vector3{ x * v.x, y * v.y, z * v.z }; }
+        constexpr Vector3 operator * (const Vector3& v) const { return Vector3{ x * v.x, y * v.y, z * v.z }; }
 
         /// <summary>
         /// Vector division operator (component-wise).
@@ -170,7 +172,7 @@ namespace neu {
         /// </summary>
         /// <param name="v">The vector to divide this vector by</param>
         /// <returns>A new vector with components divided pairwise</returns>
-        Vector3 operator / (const Vector3& v) const { return Vector3{ x / v.x, y / v.y, z / v.z }; }
+        constexpr Vector3 operator / (const Vector3& v) const { return Vector3{ x / v.x, y / v.y, z / v.z }; }
 
         // ====================================================================
         // SCALAR ARITHMETIC OPERATORS
@@ -189,7 +191,7 @@ namespace neu {
         /// </summary>
         /// <param name="s">The scalar value to add to all components</param>
         /// <returns>A new vector with the scalar added to all components</returns>
-        Vector3 operator + (float s) const { return Vector3{ x + s, y + s, z + s }; }
+        constexpr Vector3 operator + (float s) const { return Vector3{ x + s, y + s, z + s }; }
 
         /// <summary>
         /// Scalar subtraction operator.
@@ -204,7 +206,7 @@ namespace neu {
         /// </summary>
         /// <param name="s">The scalar value to subtract from all components</param>
         /// <returns>A new vector with the scalar subtracted from all components</returns>
-        Vector3 operator - (float s) const { return Vector3{ x - s, y - s, z - s }; }
+        constexpr Vector3 operator - (float s) const { return Vector3{ x - s, y - s, z - s }; }
 
         /// <summary>
         /// Scalar multiplication operator.
@@ -221,7 +223,7 @@ namespace neu {
         /// </summary>
         /// <param name="s">The scalar value to multiply all components by</param>
         /// <returns>A new vector scaled by the scalar value</returns>
-        Vector3 operator * (float s) const { return Vector3{ x * s, y * s, z * s }; }
+        constexpr Vector3 operator * (float s) const { return Vector3{ x * s, y * s, z * s }; }
 
         /// <summary>
         /// Scalar division operator.
@@ -241,7 +243,7 @@ namespace neu {
         /// </summary>
         /// <param name="s">The scalar value to divide all components by</param>
         /// <returns>A new vector with all components divided by the scalar</returns>
-        Vector3 operator / (float s) const { return Vector3{ x / s, y / s, z / s }; }
+        constexpr Vector3 operator / (float s) const { return Vector3{ x / s, y / s, z / s }; }
 
         // ====================================================================
         // COMPOUND ASSIGNMENT OPERATORS (VECTOR)
@@ -254,7 +256,7 @@ namespace neu {
         /// </summary>
         /// <param name="v">The vector to add to this vector</param>
         /// <returns>Reference to this vector after the operation</returns>
-        Vector3& operator += (const Vector3& v) { x += v.x; y += v.y; z += v.z; return *this; }
+        constexpr Vector3& operator += (const Vector3& v) { x += v.x; y += v.y; z += v.z; return *this; }
 
         /// <summary>
         /// Vector subtraction assignment operator.
@@ -263,7 +265,7 @@ namespace neu {
         /// </summary>
         /// <param name="v">The vector to subtract from this vector</param>
         /// <returns>Reference to this vector after the operation</returns>
-        Vector3& operator -= (const Vector3& v) { x -= v.x; y -= v.y; z -= v.z; return *this; }
+        constexpr Vector3& operator -= (const Vector3& v) { x -= v.x; y -= v.y; z -= v.z; return *this; }
 
         /// <summary>
         /// Vector multiplication assignment operator.
@@ -272,7 +274,7 @@ namespace neu {
         /// </summary>
         /// <param name="v">The vector to multiply this vector by</param>
         /// <returns>Reference to this vector after the operation</returns>
-        Vector3& operator *= (const Vector3& v) { x *= v.x; y *= v.y; z *= v.z; return *this; }
+        constexpr Vector3& operator *= (const Vector3& v) { x *= v.x; y *= v.y; z *= v.z; return *this; }
 
         /// <summary>
         /// Vector division assignment operator.
@@ -281,7 +283,7 @@ namespace neu {
         /// </summary>
         /// <param name="v">The vector to divide this vector by</param>
         /// <returns>Reference to this vector after the operation</returns>
-        Vector3& operator /= (const Vector3& v) { x /= v.x; y /= v.y; z /= v.z; return *this; }
+        constexpr Vector3& operator /= (const Vector3& v) { x /= v.x; y /= v.y; z /= v.z; return *this; }
 
         // ====================================================================
         // COMPOUND ASSIGNMENT OPERATORS (SCALAR)
@@ -293,7 +295,7 @@ namespace neu {
         /// </summary>
         /// <param name="s">The scalar value to add to all components</param>
         /// <returns>Reference to this vector after the operation</returns>
-        Vector3& operator += (float s) { x += s; y += s; z += s; return *this; }
+        constexpr Vector3& operator += (float s) { x += s; y += s; z += s; return *this; }
 
         /// <summary>
         /// Scalar subtraction assignment operator.
@@ -301,7 +303,7 @@ namespace neu {
         /// </summary>
         /// <param name="s">The scalar value to subtract from all components</param>
         /// <returns>Reference to this vector after the operation</returns>
-        Vector3& operator -= (float s) { x -= s; y -= s; z -= s; return *this; }
+        constexpr Vector3& operator -= (float s) { x -= s; y -= s; z -= s; return *this; }
 
         /// <summary>
         /// Scalar multiplication assignment operator.
@@ -310,7 +312,7 @@ namespace neu {
         /// </summary>
         /// <param name="s">The scalar value to multiply all components by</param>
         /// <returns>Reference to this vector after the operation</returns>
-        Vector3& operator *= (float s) { x *= s; y *= s; z *= s; return *this; }
+        constexpr Vector3& operator *= (float s) { x *= s; y *= s; z *= s; return *this; }
 
         /// <summary>
         /// Scalar division assignment operator.
@@ -318,7 +320,7 @@ namespace neu {
         /// </summary>
         /// <param name="s">The scalar value to divide all components by</param>
         /// <returns>Reference to this vector after the operation</returns>
-        Vector3& operator /= (float s) { x /= s; y /= s; z /= s; return *this; }
+        constexpr Vector3& operator /= (float s) { x /= s; y /= s; z /= s; return *this; }
 
         // ====================================================================
         // VECTOR MATHEMATICS METHODS
@@ -342,7 +344,7 @@ namespace neu {
         /// - Sorting objects by distance without expensive square root calculations
         /// </summary>
         /// <returns>The squared magnitude of the 3D vector</returns>
-        float LengthSqr() const { return (x * x) + (y * y) + (z * z); }
+        constexpr float LengthSqr() const { return (x * x) + (y * y) + (z * z); }
 
         /// <summary>
         /// Calculates the length (magnitude) of this 3D vector.
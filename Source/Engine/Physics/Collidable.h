@@ -142,5 +142,22 @@ namespace neu {
         /// after the method returns if either object is destroyed during collision processing.
         /// </param>
         virtual void OnCollision(class Actor* other) = 0;
+
+        /// <summary>
+        /// Called on the first frame a pair overlaps. The collision system's
+        /// persistent pair manager tracks overlap state across frames, so
+        /// triggers and contact bookkeeping don't have to re-derive
+        /// enter/exit from the per-frame OnCollision() stream.
+        /// </summary>
+        /// <param name="other">The Actor this object began overlapping</param>
+        virtual void OnCollisionEnter(class Actor* other) {}
+
+        /// <summary>
+        /// Called on the first frame a previously overlapping pair no longer
+        /// overlaps. Not called when the other actor was destroyed - its
+        /// pair is dropped instead of dispatching into a dead object.
+        /// </summary>
+        /// <param name="other">The Actor this object stopped overlapping</param>
+        virtual void OnCollisionExit(class Actor* other) {}
     };
 }
\ No newline at end of file
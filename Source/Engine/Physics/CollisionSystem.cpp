@@ -0,0 +1,357 @@
+#include "CollisionSystem.h"
+#include "Collidable.h"
+#include "Event/EventChannel.h"
+#include "Framework/Scene.h"
+#include "Components/ColliderComponent.h"
+#include "Math/BatchMath.h"
+#include <algorithm>
+
+namespace neu {
+    namespace {
+        // floor on the hash cell size so tiny colliders don't explode the
+        // cell count
+        constexpr float kMinCellSize = 1.0f;
+
+        // packs integer cell coordinates into one map key (21 bits per axis)
+        uint64_t CellKey(int x, int y, int z) {
+            return ((uint64_t)(x & 0x1fffff) << 42) |
+                ((uint64_t)(y & 0x1fffff) << 21) |
+                (uint64_t)(z & 0x1fffff);
+        }
+    }
+
+    bool CollisionSystem::Initialize() {
+        return true;
+    }
+
+    void CollisionSystem::Shutdown() {
+    }
+
+    void CollisionSystem::Update(Scene& scene) {
+        PROFILE_SCOPE("CollisionSystem::Update");
+
+        // registry slice of every active collider on an active actor
+        auto colliders = scene.GetActorComponents<ColliderComponent>();
+        if (colliders.size() < 2) return;
+
+        // compute world bounds once per collider and size the hash cells
+        // from the average extent so a collider typically touches one cell
+        struct Entry {
+            ColliderComponent* collider;
+            Bounds bounds;
+        };
+        frame_vector<Entry> entries;
+        entries.reserve(colliders.size());
+
+        float extentSum = 0;
+        for (auto collider : colliders) {
+            Bounds bounds = collider->GetWorldBounds();
+            if (!bounds.valid) continue;
+
+            glm::vec3 size = bounds.Size();
+            extentSum += math::max(size.x, math::max(size.y, size.z));
+            entries.push_back({ collider, bounds });
+        }
+        if (entries.size() < 2) return;
+
+        // layer/mask, same-actor and exact AABB filter shared by both
+        // broadphases
+        auto acceptPair = [&entries](int a, int b) {
+            ColliderComponent* colliderA = entries[a].collider;
+            ColliderComponent* colliderB = entries[b].collider;
+
+            // both masks must accept the other collider's layer
+            if (!(colliderA->mask & colliderB->layer)) return false;
+            if (!(colliderB->mask & colliderA->layer)) return false;
+
+            // colliders on the same actor never collide
+            if (colliderA->owner == colliderB->owner) return false;
+
+            return entries[a].bounds.Intersects(entries[b].bounds);
+        };
+
+        frame_vector<std::pair<int, int>> pairs;
+
+        if (m_incremental) {
+            // INCREMENTAL BROADPHASE: sorted x-endpoint list maintained
+            // across frames. Most colliders barely move between frames, so
+            // refreshing the values and insertion-sorting the nearly-sorted
+            // list is close to O(n); the sweep then emits pairs whose x
+            // intervals overlap and acceptPair filters the rest
+
+            // enter colliders the sweep hasn't seen, reusing freed slots
+            frame_map<ColliderComponent*, int> entryLookup;
+            for (int index = 0; index < (int)entries.size(); index++) {
+                ColliderComponent* collider = entries[index].collider;
+                entryLookup[collider] = index;
+
+                if (m_sapSlots.contains(collider)) continue;
+
+                uint32_t slot;
+                if (!m_freeSlots.empty()) {
+                    slot = m_freeSlots.back();
+                    m_freeSlots.pop_back();
+                    m_sapColliders[slot] = collider;
+                }
+                else {
+                    slot = (uint32_t)m_sapColliders.size();
+                    m_sapColliders.push_back(collider);
+                }
+                m_sapSlots.emplace(collider, slot);
+
+                const Bounds& bounds = entries[index].bounds;
+                m_endpointsX.push_back({ bounds.min.x, slot, true });
+                m_endpointsX.push_back({ bounds.max.x, slot, false });
+            }
+
+            // drop colliders that left the scene (pointer compare only -
+            // the component may already be freed)
+            if (m_sapSlots.size() != entries.size()) {
+                std::erase_if(m_endpointsX, [&](const Endpoint& endpoint) {
+                    return !entryLookup.contains(m_sapColliders[endpoint.slot]);
+                });
+                for (auto it = m_sapSlots.begin(); it != m_sapSlots.end(); ) {
+                    if (!entryLookup.contains(it->first)) {
+                        m_sapColliders[it->second] = nullptr;
+                        m_freeSlots.push_back(it->second);
+                        it = m_sapSlots.erase(it);
+                    }
+                    else {
+                        ++it;
+                    }
+                }
+            }
+
+            // refresh endpoint values from this frame's bounds - the order
+            // barely changed, so insertion sort restores it with local swaps
+            for (auto& endpoint : m_endpointsX) {
+                const Bounds& bounds = entries[entryLookup[m_sapColliders[endpoint.slot]]].bounds;
+                endpoint.value = endpoint.isMin ? bounds.min.x : bounds.max.x;
+            }
+
+            for (size_t i = 1; i < m_endpointsX.size(); i++) {
+                Endpoint key = m_endpointsX[i];
+                size_t j = i;
+                while (j > 0 && m_endpointsX[j - 1].value > key.value) {
+                    m_endpointsX[j] = m_endpointsX[j - 1];
+                    j--;
+                }
+                m_endpointsX[j] = key;
+            }
+
+            // sweep: intervals open when another opens overlap on x
+            frame_vector<int> active;
+            for (auto& endpoint : m_endpointsX) {
+                int index = entryLookup[m_sapColliders[endpoint.slot]];
+                if (!endpoint.isMin) {
+                    std::erase(active, index);
+                    continue;
+                }
+
+                for (int other : active) {
+                    int a = math::min(index, other);
+                    int b = math::max(index, other);
+                    if (acceptPair(a, b)) pairs.push_back({ a, b });
+                }
+                active.push_back(index);
+            }
+        }
+        else {
+            float cellSize = math::max(kMinCellSize, 2.0f * extentSum / (float)entries.size());
+            float invCellSize = 1.0f / cellSize;
+
+            // BROADPHASE: bin every collider into the cells its bounds overlap
+            frame_map<uint64_t, frame_vector<int>> cells;
+            for (int index = 0; index < (int)entries.size(); index++) {
+                const Bounds& bounds = entries[index].bounds;
+                glm::ivec3 minCell{ glm::floor(bounds.min * invCellSize) };
+                glm::ivec3 maxCell{ glm::floor(bounds.max * invCellSize) };
+
+                for (int z = minCell.z; z <= maxCell.z; z++) {
+                    for (int y = minCell.y; y <= maxCell.y; y++) {
+                        for (int x = minCell.x; x <= maxCell.x; x++) {
+                            cells[CellKey(x, y, z)].push_back(index);
+                        }
+                    }
+                }
+            }
+
+            // collect candidate pairs cell by cell, sort+unique drops
+            // duplicates from pairs sharing several cells
+            for (auto& [key, bucket] : cells) {
+                for (size_t i = 0; i < bucket.size(); i++) {
+                    for (size_t j = i + 1; j < bucket.size(); j++) {
+                        int a = math::min(bucket[i], bucket[j]);
+                        int b = math::max(bucket[i], bucket[j]);
+                        if (acceptPair(a, b)) pairs.push_back({ a, b });
+                    }
+                }
+            }
+
+            std::sort(pairs.begin(), pairs.end());
+            pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+        }
+
+        // NARROWPHASE: exact shape tests on the surviving pairs, batched by
+        // shape combination through the SIMD kernels instead of one scalar
+        // TestOverlap call per pair
+        frame_vector<std::pair<Actor*, Actor*>> hits;
+        frame_vector<std::pair<int, int>> spherePairs;
+        frame_vector<std::pair<int, int>> mixedPairs;
+
+        for (auto& [a, b] : pairs) {
+            bool sphereA = entries[a].collider->shape == ColliderComponent::ShapeType::Sphere;
+            bool sphereB = entries[b].collider->shape == ColliderComponent::ShapeType::Sphere;
+
+            // box/box already passed the exact test - the broadphase
+            // compared the same enclosing world AABBs
+            if (!sphereA && !sphereB) {
+                hits.push_back({ entries[a].collider->owner, entries[b].collider->owner });
+            }
+            else if (sphereA && sphereB) {
+                spherePairs.push_back({ a, b });
+            }
+            else {
+                // normalized to (sphere, box) so the batch below reads one
+                // shape per side
+                mixedPairs.push_back(sphereA ? std::pair{ a, b } : std::pair{ b, a });
+            }
+        }
+
+        // sphere/sphere: centers and summed radii gathered into SoA spans,
+        // tested four pairs per iteration
+        if (!spherePairs.empty()) {
+            size_t count = spherePairs.size();
+            auto centerA = math::batch::Soa3::FromFrameArena(count);
+            auto centerB = math::batch::Soa3::FromFrameArena(count);
+            float* radiusSum = (float*)FrameArena::Allocate(count * sizeof(float), 16);
+            uint8_t* overlap = (uint8_t*)FrameArena::Allocate(count, 16);
+
+            for (size_t i = 0; i < count; i++) {
+                auto& [a, b] = spherePairs[i];
+                const glm::vec3& positionA = entries[a].collider->owner->transform.position;
+                const glm::vec3& positionB = entries[b].collider->owner->transform.position;
+
+                centerA.x[i] = positionA.x; centerA.y[i] = positionA.y; centerA.z[i] = positionA.z;
+                centerB.x[i] = positionB.x; centerB.y[i] = positionB.y; centerB.z[i] = positionB.z;
+                radiusSum[i] = entries[a].collider->GetWorldRadius() + entries[b].collider->GetWorldRadius();
+            }
+
+            math::batch::OverlapSphere(centerA, centerB, radiusSum, overlap, count);
+
+            for (size_t i = 0; i < count; i++) {
+                if (!overlap[i]) continue;
+                auto& [a, b] = spherePairs[i];
+                hits.push_back({ entries[a].collider->owner, entries[b].collider->owner });
+            }
+        }
+
+        // sphere/box: sphere centers against the boxes' world bounds,
+        // closest-point clamp in the kernel
+        if (!mixedPairs.empty()) {
+            size_t count = mixedPairs.size();
+            auto center = math::batch::Soa3::FromFrameArena(count);
+            auto boxMin = math::batch::Soa3::FromFrameArena(count);
+            auto boxMax = math::batch::Soa3::FromFrameArena(count);
+            float* radius = (float*)FrameArena::Allocate(count * sizeof(float), 16);
+            uint8_t* overlap = (uint8_t*)FrameArena::Allocate(count, 16);
+
+            for (size_t i = 0; i < count; i++) {
+                auto& [sphere, box] = mixedPairs[i];
+                const glm::vec3& position = entries[sphere].collider->owner->transform.position;
+                const Bounds& bounds = entries[box].bounds;
+
+                center.x[i] = position.x; center.y[i] = position.y; center.z[i] = position.z;
+                boxMin.x[i] = bounds.min.x; boxMin.y[i] = bounds.min.y; boxMin.z[i] = bounds.min.z;
+                boxMax.x[i] = bounds.max.x; boxMax.y[i] = bounds.max.y; boxMax.z[i] = bounds.max.z;
+                radius[i] = entries[sphere].collider->GetWorldRadius();
+            }
+
+            math::batch::OverlapSphereAabb(center, boxMin, boxMax, radius, overlap, count);
+
+            for (size_t i = 0; i < count; i++) {
+                if (!overlap[i]) continue;
+                auto& [sphere, box] = mixedPairs[i];
+                hits.push_back({ entries[sphere].collider->owner, entries[box].collider->owner });
+            }
+        }
+
+        // PAIR MANAGER: diff this frame's overlaps against the persistent
+        // pair set so gameplay gets began/ended events instead of deriving
+        // them from the per-frame stream. Pairs are keyed by packed
+        // generational handles - a destroyed actor's pairs just drop
+        // instead of dispatching an exit into a dead object
+        m_frame++;
+        auto packHandle = [](const ActorHandle& handle) {
+            return ((uint64_t)handle.index << 32) | handle.generation;
+        };
+
+        frame_vector<std::pair<Actor*, Actor*>> entered;
+        for (auto& [actorA, actorB] : hits) {
+            auto [low, high] = std::minmax(packHandle(actorA->handle), packHandle(actorB->handle));
+
+            auto [it, inserted] = m_pairs.try_emplace({ low, high });
+            it->second.lastFrame = m_frame;
+            it->second.frames = inserted ? 1 : it->second.frames + 1;
+            if (inserted) entered.push_back({ actorA, actorB });
+        }
+
+        frame_vector<std::pair<Actor*, Actor*>> exited;
+        for (auto it = m_pairs.begin(); it != m_pairs.end(); ) {
+            if (it->second.lastFrame == m_frame) {
+                ++it;
+                continue;
+            }
+
+            Actor* actorA = scene.GetActor({ (uint32_t)(it->first.first >> 32), (uint32_t)it->first.first });
+            Actor* actorB = scene.GetActor({ (uint32_t)(it->first.second >> 32), (uint32_t)it->first.second });
+            if (actorA && actorB) exited.push_back({ actorA, actorB });
+
+            it = m_pairs.erase(it);
+        }
+
+        // DISPATCH: all callbacks run after detection is complete, so a
+        // response destroying an actor can't invalidate the passes above -
+        // the destroyed flag just suppresses its remaining callbacks.
+        // Enters fire before the per-frame overlaps, exits last
+        auto dispatch = [](auto& pairsToDispatch, auto callback) {
+            for (auto& [actorA, actorB] : pairsToDispatch) {
+                if (actorA->destroyed || actorB->destroyed) continue;
+
+                if (auto collidable = dynamic_cast<ICollidable*>(actorA)) callback(collidable, actorB);
+                if (actorA->destroyed || actorB->destroyed) continue;
+                if (auto collidable = dynamic_cast<ICollidable*>(actorB)) callback(collidable, actorA);
+            }
+        };
+
+        dispatch(entered, [](ICollidable* collidable, Actor* other) { collidable->OnCollisionEnter(other); });
+        dispatch(hits, [](ICollidable* collidable, Actor* other) { collidable->OnCollision(other); });
+        dispatch(exited, [](ICollidable* collidable, Actor* other) { collidable->OnCollisionExit(other); });
+
+        // TYPED CHANNELS: the same enter/exit edges go out as spans on the
+        // compile-time channels - gathered only when someone subscribed, so
+        // an unobserved channel costs one branch per frame. Destroyed
+        // actors are filtered like the callback path above
+        auto& enterChannel = EventChannel<CollisionEnterEvent>::Instance();
+        if (enterChannel.HasSubscribers() && !entered.empty()) {
+            frame_vector<CollisionEnterEvent> events;
+            events.reserve(entered.size());
+            for (auto& [actorA, actorB] : entered) {
+                if (actorA->destroyed || actorB->destroyed) continue;
+                events.push_back({ actorA, actorB });
+            }
+            enterChannel.Publish(events.data(), events.size());
+        }
+
+        auto& exitChannel = EventChannel<CollisionExitEvent>::Instance();
+        if (exitChannel.HasSubscribers() && !exited.empty()) {
+            frame_vector<CollisionExitEvent> events;
+            events.reserve(exited.size());
+            for (auto& [actorA, actorB] : exited) {
+                if (actorA->destroyed || actorB->destroyed) continue;
+                events.push_back({ actorA, actorB });
+            }
+            exitChannel.Publish(events.data(), events.size());
+        }
+    }
+}
@@ -0,0 +1,103 @@
+#pragma once
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace neu {
+    class Scene;
+
+    /// <summary>
+    /// Typed channel payloads for the pair manager's enter/exit edges.
+    /// Published as spans through EventChannel after callback dispatch,
+    /// and only gathered when the channel has subscribers - engine systems
+    /// that want every edge (audio impacts, decals) subscribe here instead
+    /// of implementing ICollidable on an actor.
+    /// </summary>
+    struct CollisionEnterEvent {
+        class Actor* actorA;
+        class Actor* actorB;
+    };
+
+    struct CollisionExitEvent {
+        class Actor* actorA;
+        class Actor* actorB;
+    };
+
+    /// <summary>
+    /// Engine module that detects overlaps between ColliderComponents and
+    /// dispatches ICollidable::OnCollision callbacks.
+    ///
+    /// Each frame the system bins collider world bounds into a spatial hash
+    /// (cell size derived from the average collider extent), collects
+    /// candidate pairs per cell with layer/mask filtering, narrows them with
+    /// exact shape tests batched through the SIMD overlap kernels (SoA
+    /// gather per shape combination), and only then dispatches every callback in one
+    /// batch - so collision responses can spawn or destroy actors without
+    /// invalidating the detection pass. All per-frame storage lives in the
+    /// frame arena.
+    /// </summary>
+    class CollisionSystem {
+    public:
+        CollisionSystem() = default;
+
+        /// <summary>
+        /// Prepares the collision system. No resources are held between
+        /// frames, so this only reports readiness.
+        /// </summary>
+        /// <returns>True if initialization was successful</returns>
+        bool Initialize();
+
+        /// <summary>
+        /// Shuts down the collision system.
+        /// </summary>
+        void Shutdown();
+
+        /// <summary>
+        /// Runs broadphase, narrowphase and callback dispatch over the
+        /// scene's colliders. Called once per frame by Engine::Update after
+        /// the scene update so callbacks see post-update transforms.
+        /// </summary>
+        /// <param name="scene">Scene whose colliders are tested</param>
+        void Update(Scene& scene);
+
+        /// <summary>
+        /// Selects the incremental sweep-and-prune broadphase instead of the
+        /// rebuilt-per-frame spatial hash. The sweep keeps its sorted
+        /// endpoint list across frames and re-sorts locally on movement, so
+        /// temporally coherent scenes (most actors barely moving) pay close
+        /// to O(n) instead of rebuilding the hash.
+        /// </summary>
+        void SetIncrementalBroadphase(bool incremental) { m_incremental = incremental; }
+        bool IsIncrementalBroadphase() const { return m_incremental; }
+
+    private:
+        // one end of a collider's x interval in the persistent sweep list
+        struct Endpoint {
+            float value{ 0 };
+            uint32_t slot{ 0 };     // index into m_sapColliders
+            bool isMin{ false };
+        };
+
+        // persistent overlap state for one actor pair
+        struct PairState {
+            uint64_t lastFrame{ 0 };    // frame stamp of the most recent overlap
+            uint32_t frames{ 0 };       // consecutive frames the pair has overlapped
+        };
+
+        bool m_incremental{ false };
+
+        // sweep-and-prune state carried across frames: collider slots, the
+        // sorted x-endpoint list and recycled slot indices
+        std::vector<class ColliderComponent*> m_sapColliders;
+        std::unordered_map<class ColliderComponent*, uint32_t> m_sapSlots;
+        std::vector<Endpoint> m_endpointsX;
+        std::vector<uint32_t> m_freeSlots;
+
+        // pair manager: overlapping pairs keyed by packed generational actor
+        // handles, diffed each frame to emit enter/exit callbacks
+        std::map<std::pair<uint64_t, uint64_t>, PairState> m_pairs;
+        uint64_t m_frame{ 0 };
+    };
+}
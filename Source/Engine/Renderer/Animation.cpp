@@ -0,0 +1,223 @@
+#include "EnginePCH.h"
+#include "Animation.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <cmath>
+
+namespace neu {
+	namespace {
+		// reduction tolerances - keys the interpolators reconstruct closer
+		// than this are dropped at cook time. Mocap exports key every frame,
+		// so near-linear stretches collapse to their endpoints
+		constexpr float kPositionTolerance = 0.0005f;	// world units
+		constexpr float kScaleTolerance = 0.0005f;
+		constexpr float kRotationToleranceDot = 1e-6f;	// 1 - |dot|, ~0.16 degrees
+
+		// quantization range for the three stored components - the dropped
+		// largest component guarantees the rest fit [-1/sqrt2, 1/sqrt2]
+		constexpr float kQuatRange = 0.70710678f;
+
+		float KeyError(const glm::vec3& reconstructed, const glm::vec3& value) {
+			return glm::distance(reconstructed, value);
+		}
+
+		float KeyError(const glm::quat& reconstructed, const glm::quat& value) {
+			return 1.0f - std::fabs(glm::dot(reconstructed, value));
+		}
+
+		glm::vec3 Blend(const glm::vec3& a, const glm::vec3& b, float t) {
+			return glm::mix(a, b, t);
+		}
+
+		glm::quat Blend(const glm::quat& a, const glm::quat& b, float t) {
+			return glm::slerp(a, b, t);
+		}
+
+		// greedy keyframe reduction - extend each kept key's span as long as
+		// every interior key reconstructs within tolerance from the span's
+		// endpoints, then emit the span end and restart from it
+		template <typename T>
+		void ReduceKeys(std::vector<AnimationClip::Key<T>>& keys, float tolerance) {
+			if (keys.size() < 3) return;
+
+			std::vector<AnimationClip::Key<T>> reduced;
+			reduced.reserve(keys.size());
+			reduced.push_back(keys.front());
+
+			size_t anchor = 0;
+			while (anchor < keys.size() - 1) {
+				// furthest end the anchor can reach with every interior key
+				// within tolerance
+				size_t end = anchor + 1;
+				for (size_t candidate = anchor + 2; candidate < keys.size(); candidate++) {
+					bool within = true;
+					for (size_t k = anchor + 1; k < candidate && within; k++) {
+						float span = keys[candidate].time - keys[anchor].time;
+						float t = (span > 0) ? (keys[k].time - keys[anchor].time) / span : 0;
+						within = KeyError(Blend(keys[anchor].value, keys[candidate].value, t), keys[k].value) <= tolerance;
+					}
+					if (!within) break;
+					end = candidate;
+				}
+
+				reduced.push_back(keys[end]);
+				anchor = end;
+			}
+
+			keys = std::move(reduced);
+		}
+
+		// linear cursor advance - cheap when time moves forward a frame at a
+		// time, the common case. cursor indexes the key at or before time
+		uint32_t Advance(const std::vector<float>& times, float time, uint32_t& cursor) {
+			if (cursor >= times.size()) cursor = 0;
+			while (cursor + 1 < times.size() && times[cursor + 1] <= time) cursor++;
+			return cursor;
+		}
+
+		glm::vec3 SampleVec3(const std::vector<float>& times, const std::vector<glm::vec3>& values, float time, uint32_t& cursor, const glm::vec3& fallback) {
+			if (values.empty()) return fallback;
+			if (values.size() == 1 || time <= times.front()) return values.front();
+			if (time >= times.back()) return values.back();
+
+			uint32_t i = Advance(times, time, cursor);
+			float t = (time - times[i]) / (times[i + 1] - times[i]);
+			return glm::mix(values[i], values[i + 1], t);
+		}
+
+		glm::quat SampleQuat(const std::vector<float>& times, const std::vector<AnimationClip::PackedQuat>& values, float time, uint32_t& cursor) {
+			if (values.empty()) return glm::quat{ 1, 0, 0, 0 };
+			if (values.size() == 1 || time <= times.front()) return animation::UnpackQuat(values.front());
+			if (time >= times.back()) return animation::UnpackQuat(values.back());
+
+			uint32_t i = Advance(times, time, cursor);
+			float t = (time - times[i]) / (times[i + 1] - times[i]);
+			return glm::slerp(animation::UnpackQuat(values[i]), animation::UnpackQuat(values[i + 1]), t);
+		}
+	}
+
+	namespace animation {
+		AnimationClip::PackedQuat PackQuat(const glm::quat& q) {
+			float components[4] = { q.x, q.y, q.z, q.w };
+
+			int largest = 0;
+			for (int i = 1; i < 4; i++) {
+				if (std::fabs(components[i]) > std::fabs(components[largest])) largest = i;
+			}
+
+			// force the dropped component positive so it reconstructs from
+			// unit length without a sign bit (q and -q are the same rotation)
+			float sign = (components[largest] < 0) ? -1.0f : 1.0f;
+
+			// 2-bit largest index, then three 15-bit snorm components
+			uint64_t bits = (uint64_t)largest;
+			int shift = 2;
+			for (int i = 0; i < 4; i++) {
+				if (i == largest) continue;
+
+				float normalized = math::clamp(components[i] * sign / kQuatRange, -1.0f, 1.0f);
+				uint64_t quantized = (uint64_t)std::lround((normalized * 0.5f + 0.5f) * 32767.0f);
+				bits |= quantized << shift;
+				shift += 15;
+			}
+
+			AnimationClip::PackedQuat packed;
+			packed.data[0] = (uint16_t)(bits);
+			packed.data[1] = (uint16_t)(bits >> 16);
+			packed.data[2] = (uint16_t)(bits >> 32);
+			return packed;
+		}
+
+		glm::quat UnpackQuat(const AnimationClip::PackedQuat& packed) {
+			uint64_t bits = (uint64_t)packed.data[0] | ((uint64_t)packed.data[1] << 16) | ((uint64_t)packed.data[2] << 32);
+
+			int largest = (int)(bits & 0x3);
+			int shift = 2;
+
+			float components[4];
+			float sumSquares = 0;
+			for (int i = 0; i < 4; i++) {
+				if (i == largest) continue;
+
+				float normalized = ((bits >> shift) & 0x7fff) / 32767.0f * 2.0f - 1.0f;
+				components[i] = normalized * kQuatRange;
+				sumSquares += components[i] * components[i];
+				shift += 15;
+			}
+			components[largest] = std::sqrt(math::max(0.0f, 1.0f - sumSquares));
+
+			return glm::normalize(glm::quat{ components[3], components[0], components[1], components[2] });
+		}
+
+		void BuildTrack(std::vector<AnimationClip::Key<glm::vec3>>& positions,
+			std::vector<AnimationClip::Key<glm::quat>>& rotations,
+			std::vector<AnimationClip::Key<glm::vec3>>& scales,
+			AnimationClip::Track& track) {
+			ReduceKeys(positions, kPositionTolerance);
+			ReduceKeys(rotations, kRotationToleranceDot);
+			ReduceKeys(scales, kScaleTolerance);
+
+			track.positionTimes.reserve(positions.size());
+			track.positions.reserve(positions.size());
+			for (auto& key : positions) {
+				track.positionTimes.push_back(key.time);
+				track.positions.push_back(key.value);
+			}
+
+			track.rotationTimes.reserve(rotations.size());
+			track.rotations.reserve(rotations.size());
+			for (auto& key : rotations) {
+				track.rotationTimes.push_back(key.time);
+				track.rotations.push_back(PackQuat(key.value));
+			}
+
+			track.scaleTimes.reserve(scales.size());
+			track.scales.reserve(scales.size());
+			for (auto& key : scales) {
+				track.scaleTimes.push_back(key.time);
+				track.scales.push_back(key.value);
+			}
+		}
+
+		void SamplePalette(const Skeleton& skeleton, ClipSampler& sampler, float time, std::vector<glm::mat4>& palette) {
+			if (!sampler.clip) return;
+			const AnimationClip& clip = *sampler.clip;
+
+			size_t count = skeleton.joints.size();
+			palette.resize(count);
+
+			// cursors only advance forward - loops and scrubs rewind them
+			if (time < sampler.time) {
+				for (auto& cursor : sampler.cursors) cursor = 0;
+			}
+			sampler.time = time;
+
+			// global transform scratch - thread_local because actor updates
+			// (and so clip sampling) run on the job workers
+			static thread_local std::vector<glm::mat4> globals;
+			globals.resize(count);
+
+			for (size_t i = 0; i < count; i++) {
+				const auto& joint = skeleton.joints[i];
+
+				// untracked joints hold their bind-local transform
+				glm::mat4 local = joint.localBind;
+				if (i < clip.tracks.size()) {
+					const auto& track = clip.tracks[i];
+					if (!track.positions.empty() || !track.rotations.empty() || !track.scales.empty()) {
+						uint32_t* cursors = sampler.cursors.data() + i * 3;
+
+						glm::vec3 position = SampleVec3(track.positionTimes, track.positions, time, cursors[0], glm::vec3{ 0 });
+						glm::quat rotation = SampleQuat(track.rotationTimes, track.rotations, time, cursors[1]);
+						glm::vec3 scale = SampleVec3(track.scaleTimes, track.scales, time, cursors[2], glm::vec3{ 1 });
+
+						local = glm::translate(glm::mat4{ 1 }, position) * glm::mat4_cast(rotation) * glm::scale(glm::mat4{ 1 }, scale);
+					}
+				}
+
+				// parents precede children, so the parent global is final
+				globals[i] = (joint.parent >= 0) ? globals[joint.parent] * local : local;
+				palette[i] = globals[i] * joint.inverseBind;
+			}
+		}
+	}
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace neu {
+	// joint hierarchy cooked from the import, ordered parents-first so a
+	// single forward pass over the joints composes every global transform
+	struct Skeleton {
+		struct Joint {
+			uint64_t nameHash;		// FNV-1a of the source node name, matches clip channels
+			int32_t parent;			// index into joints, -1 for the root
+			glm::mat4 localBind;	// node-local bind transform, used when a clip has no track
+			glm::mat4 inverseBind;	// mesh space -> joint space at bind time
+		};
+		std::vector<Joint> joints;
+
+		// linear lookup by name hash - skeletons are tens of joints
+		int FindJoint(uint64_t nameHash) const {
+			for (int i = 0; i < (int)joints.size(); i++) {
+				if (joints[i].nameHash == nameHash) return i;
+			}
+			return -1;
+		}
+	};
+
+	// one animation clip, compressed at cook time: keyframe reduction drops
+	// keys the interpolators reconstruct within tolerance, rotations pack
+	// to 48 bits and each channel stores times and values as separate
+	// arrays so the sampler's key scan stays dense in cache
+	struct AnimationClip {
+		// raw import key - cook-side intermediate only, the reducer and
+		// quantizer consume these into the track's SoA storage
+		template <typename T>
+		struct Key {
+			float time;
+			T value;
+		};
+
+		// smallest-three quaternion: 2-bit largest-component index and the
+		// other three components snorm-quantized to 15 bits each over
+		// [-1/sqrt2, 1/sqrt2] - the largest reconstructs from unit length
+		struct PackedQuat {
+			uint16_t data[3];
+		};
+		static_assert(sizeof(PackedQuat) == 6, "PackedQuat must stay 48 bits - cooked clips assume it");
+
+		struct Track {
+			std::vector<float> positionTimes;
+			std::vector<glm::vec3> positions;
+			std::vector<float> rotationTimes;
+			std::vector<PackedQuat> rotations;
+			std::vector<float> scaleTimes;
+			std::vector<glm::vec3> scales;
+		};
+
+		std::string name;
+		uint64_t nameHash{ 0 };
+		float duration{ 0 };
+		std::vector<Track> tracks;	// parallels the skeleton's joints
+	};
+
+	namespace animation {
+		// FNV-1a over the name bytes - joints and clips resolve by hash so
+		// the cooked format never compares strings at runtime
+		inline uint64_t HashName(const char* name) {
+			uint64_t hash = 14695981039346656037ull;
+			for (; *name; name++) {
+				hash ^= (uint8_t)*name;
+				hash *= 1099511628211ull;
+			}
+			return hash;
+		}
+
+		AnimationClip::PackedQuat PackQuat(const glm::quat& q);
+		glm::quat UnpackQuat(const AnimationClip::PackedQuat& packed);
+
+		// cook-side: keyframe reduction against the error tolerances, then
+		// quantization into the track's SoA storage
+		void BuildTrack(std::vector<AnimationClip::Key<glm::vec3>>& positions,
+			std::vector<AnimationClip::Key<glm::quat>>& rotations,
+			std::vector<AnimationClip::Key<glm::vec3>>& scales,
+			AnimationClip::Track& track);
+
+		// per-instance sampling state - one cursor per channel, advanced
+		// linearly as playback time moves forward so a frame's sample only
+		// touches the keys it crossed instead of binary searching per bone.
+		// Rewinds (loops, scrubs) reset the cursors and re-advance
+		struct ClipSampler {
+			const AnimationClip* clip{ nullptr };
+			std::vector<uint32_t> cursors;	// 3 per track: position, rotation, scale
+			float time{ 0 };
+
+			void Reset(const AnimationClip* newClip) {
+				clip = newClip;
+				cursors.assign(clip ? clip->tracks.size() * 3 : 0, 0);
+				time = 0;
+			}
+		};
+
+		// advances the sampler to time, samples every track into joint-local
+		// transforms, composes the hierarchy (joints are cooked parents-
+		// first) and multiplies the inverse binds - palette holds one
+		// skinning matrix per joint after
+		void SamplePalette(const Skeleton& skeleton, ClipSampler& sampler, float time, std::vector<glm::mat4>& palette);
+	}
+}
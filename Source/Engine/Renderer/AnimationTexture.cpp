@@ -0,0 +1,85 @@
+#include "EnginePCH.h"
+#include "AnimationTexture.h"
+
+namespace neu {
+	AnimationTexture::~AnimationTexture() {
+		if (m_gpuBytes) GPUMemory::Untrack(GPUMemory::Type::Texture, m_gpuBytes);
+		if (m_texture) {
+			GLState::InvalidateTexture(m_texture);
+			glDeleteTextures(1, &m_texture);
+		}
+	}
+
+	bool AnimationTexture::Create(const Model& model, float fps) {
+		const Skeleton& skeleton = model.GetSkeleton();
+		const auto& clips = model.GetClips();
+		if (skeleton.joints.empty() || clips.empty() || fps <= 0) return false;
+
+		m_jointCount = (int)skeleton.joints.size();
+		int width = m_jointCount * 4;
+
+		// lay the clips out back to back, one row per baked frame - the
+		// extra end frame gives a shader that lerps between rows a valid
+		// pair for the last interval of a loop
+		int totalRows = 0;
+		m_clips.clear();
+		for (auto& clip : clips) {
+			int frames = math::max(2, (int)std::ceil(clip.duration * fps) + 1);
+			m_clips.push_back({ totalRows, frames, fps, clip.duration });
+			totalRows += frames;
+		}
+
+		// step every clip through the regular palette sampler - the bake
+		// walks time forward, so the sampler's linear cursors never rewind
+		std::vector<glm::vec4> texels((size_t)width * totalRows);
+		std::vector<glm::mat4> palette;
+		animation::ClipSampler sampler;
+		for (size_t index = 0; index < clips.size(); index++) {
+			sampler.Reset(&clips[index]);
+			const ClipInfo& info = m_clips[index];
+			for (int frame = 0; frame < info.frameCount; frame++) {
+				float time = math::min(frame / fps, clips[index].duration);
+				animation::SamplePalette(skeleton, sampler, time, palette);
+
+				// four texels per joint, one matrix column each
+				glm::vec4* row = &texels[(size_t)(info.firstRow + frame) * width];
+				for (int joint = 0; joint < m_jointCount; joint++) {
+					const glm::mat4& matrix = palette[joint];
+					row[joint * 4 + 0] = matrix[0];
+					row[joint * 4 + 1] = matrix[1];
+					row[joint * 4 + 2] = matrix[2];
+					row[joint * 4 + 3] = matrix[3];
+				}
+			}
+		}
+
+		m_gpuBytes = texels.size() * sizeof(glm::vec4);
+		GPUMemory::Track(GPUMemory::Type::Texture, m_gpuBytes);
+
+		if (GLState::SupportsDSA()) {
+			glCreateTextures(GL_TEXTURE_2D, 1, &m_texture);
+			glTextureStorage2D(m_texture, 1, GL_RGBA32F, width, totalRows);
+			glTextureSubImage2D(m_texture, 0, 0, 0, width, totalRows, GL_RGBA, GL_FLOAT, texels.data());
+			glTextureParameteri(m_texture, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+			glTextureParameteri(m_texture, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+			glTextureParameteri(m_texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTextureParameteri(m_texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		}
+		else {
+			glGenTextures(1, &m_texture);
+			GLState::BindTexture(GL_TEXTURE_2D, m_texture);
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA32F, width, totalRows, 0, GL_RGBA, GL_FLOAT, texels.data());
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		}
+
+		return true;
+	}
+
+	void AnimationTexture::Bind(GLenum unit) const {
+		GLState::SetActiveTexture(unit);
+		GLState::BindTexture(GL_TEXTURE_2D, m_texture);
+	}
+}
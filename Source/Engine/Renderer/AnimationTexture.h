@@ -0,0 +1,58 @@
+#pragma once
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace neu {
+	class Model;
+
+	/// <summary>
+	/// Skinned animation baked into a bone-matrix texture so instanced
+	/// crowds skin without per-draw palette uploads. Every clip on a model
+	/// samples at a fixed rate into one RGBA32F texture - four texels per
+	/// joint hold one skinning matrix's columns, one row per baked frame,
+	/// clips laid out back to back - and the crowd material's vertex
+	/// shader texelFetches its instance's row from the clip's row range
+	/// plus playback phase. NEAREST filtering keeps the fetches exact;
+	/// inter-frame blending is the shader's choice (fetch two rows, lerp).
+	///
+	/// A typical character (40 joints, a few seconds of clips at 30 fps)
+	/// bakes to well under a megabyte, paid once the first time the model
+	/// draws through a crowd.
+	/// </summary>
+	class AnimationTexture {
+	public:
+		// row range one clip occupies, in the shader's texelFetch space
+		struct ClipInfo {
+			int firstRow{ 0 };
+			int frameCount{ 0 };
+			float fps{ 0 };
+			float duration{ 0 };
+		};
+
+		AnimationTexture() = default;
+		~AnimationTexture();
+
+		// owns a GL name, so no copies
+		AnimationTexture(const AnimationTexture&) = delete;
+		AnimationTexture& operator=(const AnimationTexture&) = delete;
+
+		// samples every clip on the model at the given rate through the
+		// regular palette path and uploads the packed rows - false if the
+		// model has no skeleton or no clips
+		bool Create(const Model& model, float fps);
+
+		// binds the baked texture to the given texture unit (GL_TEXTUREn)
+		void Bind(GLenum unit) const;
+
+		bool IsCreated() const { return m_texture != 0; }
+		int GetJointCount() const { return m_jointCount; }
+		const std::vector<ClipInfo>& GetClips() const { return m_clips; }
+
+	private:
+		GLuint m_texture{ 0 };
+		int m_jointCount{ 0 };
+		std::vector<ClipInfo> m_clips;
+		size_t m_gpuBytes{ 0 };
+	};
+}
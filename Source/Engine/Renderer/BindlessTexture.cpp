@@ -0,0 +1,55 @@
+#include "EnginePCH.h"
+#include "BindlessTexture.h"
+#include <SDL3/SDL.h>
+
+namespace neu {
+	namespace bindless {
+		namespace {
+			// local PFN typedefs - glad has none for this extension
+			typedef GLuint64(APIENTRYP PFNGETTEXTUREHANDLEPROC)(GLuint texture);
+			typedef void (APIENTRYP PFNMAKEHANDLERESIDENTPROC)(GLuint64 handle);
+			typedef void (APIENTRYP PFNMAKEHANDLENONRESIDENTPROC)(GLuint64 handle);
+			typedef void (APIENTRYP PFNUNIFORMHANDLEUI64PROC)(GLint location, GLuint64 value);
+
+			PFNGETTEXTUREHANDLEPROC getTextureHandle = nullptr;
+			PFNMAKEHANDLERESIDENTPROC makeHandleResident = nullptr;
+			PFNMAKEHANDLENONRESIDENTPROC makeHandleNonResident = nullptr;
+			PFNUNIFORMHANDLEUI64PROC uniformHandle = nullptr;
+
+			bool supported = false;
+		}
+
+		bool Load() {
+			supported = false;
+			if (!SDL_GL_ExtensionSupported("GL_ARB_bindless_texture")) return false;
+
+			getTextureHandle = (PFNGETTEXTUREHANDLEPROC)SDL_GL_GetProcAddress("glGetTextureHandleARB");
+			makeHandleResident = (PFNMAKEHANDLERESIDENTPROC)SDL_GL_GetProcAddress("glMakeTextureHandleResidentARB");
+			makeHandleNonResident = (PFNMAKEHANDLENONRESIDENTPROC)SDL_GL_GetProcAddress("glMakeTextureHandleNonResidentARB");
+			uniformHandle = (PFNUNIFORMHANDLEUI64PROC)SDL_GL_GetProcAddress("glUniformHandleui64ARB");
+
+			supported = getTextureHandle && makeHandleResident && makeHandleNonResident && uniformHandle;
+			return supported;
+		}
+
+		bool IsSupported() {
+			return supported;
+		}
+
+		GLuint64 AcquireHandle(GLuint texture) {
+			if (!supported || !texture) return 0;
+
+			GLuint64 handle = getTextureHandle(texture);
+			if (handle) makeHandleResident(handle);
+			return handle;
+		}
+
+		void ReleaseHandle(GLuint64 handle) {
+			if (supported && handle) makeHandleNonResident(handle);
+		}
+
+		void SetHandleUniform(GLint location, GLuint64 handle) {
+			if (supported && location >= 0) uniformHandle(location, handle);
+		}
+	}
+}
@@ -0,0 +1,25 @@
+#pragma once
+#include <glad/glad.h>
+
+namespace neu {
+	// GL_ARB_bindless_texture support - the vendored glad build predates
+	// the extension, so the handful of entry points the bindless path needs
+	// load straight from the driver at context creation. when the extension
+	// is missing every call is a harmless no-op (queries return 0/false)
+	// and materials stay on the texture array or binding path
+	namespace bindless {
+		// queries the extension and fetches the entry points, called once
+		// by Renderer::CreateWindow right after the context exists
+		bool Load();
+		bool IsSupported();
+
+		// resident handle for a texture object, 0 on failure. handles die
+		// with the texture object - release before deleting it, and never
+		// take one for a texture whose object gets rebuilt (mip streaming)
+		GLuint64 AcquireHandle(GLuint texture);
+		void ReleaseHandle(GLuint64 handle);
+
+		// glUniformHandleui64ARB - pushes a handle into a sampler uniform
+		void SetHandleUniform(GLint location, GLuint64 handle);
+	}
+}
@@ -0,0 +1,114 @@
+#include "EnginePCH.h"
+#include "BufferArena.h"
+#include <vector>
+
+namespace neu {
+	namespace {
+		// page size balances object count against stranded tail space -
+		// 16 MB holds several hundred typical cooked meshes. Oversized
+		// allocations get a dedicated page of their own size
+		constexpr size_t kPageSize = 16 * 1024 * 1024;
+
+		// offsets align for vertex binding performance and so index offsets
+		// stay multiples of every index type's size
+		constexpr size_t kAlignment = 16;
+
+		struct Page {
+			GLuint buffer{ 0 };
+			size_t size{ 0 };
+
+			// free ranges sorted by offset, neighbours coalesce on Free
+			struct Range {
+				size_t offset;
+				size_t size;
+			};
+			std::vector<Range> freeRanges;
+		};
+
+		std::vector<Page> pages;
+		size_t pageBytes = 0;
+
+		size_t Align(size_t size) {
+			return (size + kAlignment - 1) & ~(kAlignment - 1);
+		}
+
+		// first-fit scan of one page's free list
+		bool AllocateFromPage(Page& page, size_t size, size_t& outOffset) {
+			for (size_t i = 0; i < page.freeRanges.size(); i++) {
+				auto& range = page.freeRanges[i];
+				if (range.size < size) continue;
+
+				outOffset = range.offset;
+				range.offset += size;
+				range.size -= size;
+				if (range.size == 0) page.freeRanges.erase(page.freeRanges.begin() + i);
+				return true;
+			}
+			return false;
+		}
+	}
+
+	BufferArena::Allocation BufferArena::Allocate(size_t size, const void* data) {
+		if (!GLState::SupportsDSA() || size == 0) return {};
+
+		size = Align(size);
+
+		size_t offset = 0;
+		Page* page = nullptr;
+		for (auto& candidate : pages) {
+			if (AllocateFromPage(candidate, size, offset)) {
+				page = &candidate;
+				break;
+			}
+		}
+
+		if (!page) {
+			// immutable storage with SubData upload rights - the page never
+			// resizes, growth just adds pages
+			Page fresh;
+			fresh.size = std::max(size, kPageSize);
+			glCreateBuffers(1, &fresh.buffer);
+			glNamedBufferStorage(fresh.buffer, fresh.size, nullptr, GL_DYNAMIC_STORAGE_BIT);
+			GLDebug::Label(GL_BUFFER, fresh.buffer, std::format("buffer arena page {}", pages.size()));
+
+			fresh.freeRanges.push_back({ 0, fresh.size });
+			pageBytes += fresh.size;
+			GPUMemory::Track(GPUMemory::Type::Geometry, fresh.size);
+			pages.push_back(std::move(fresh));
+
+			page = &pages.back();
+			AllocateFromPage(*page, size, offset);
+		}
+
+		if (data) glNamedBufferSubData(page->buffer, offset, size, data);
+
+		return { page->buffer, offset, size };
+	}
+
+	void BufferArena::Free(const Allocation& allocation) {
+		if (!allocation.buffer) return;
+
+		for (auto& page : pages) {
+			if (page.buffer != allocation.buffer) continue;
+
+			// insert sorted by offset, then coalesce with both neighbours
+			auto position = page.freeRanges.begin();
+			while (position != page.freeRanges.end() && position->offset < allocation.offset) ++position;
+			position = page.freeRanges.insert(position, { allocation.offset, allocation.size });
+
+			if (position + 1 != page.freeRanges.end() && position->offset + position->size == (position + 1)->offset) {
+				position->size += (position + 1)->size;
+				page.freeRanges.erase(position + 1);
+			}
+			if (position != page.freeRanges.begin() && (position - 1)->offset + (position - 1)->size == position->offset) {
+				(position - 1)->size += position->size;
+				page.freeRanges.erase(position);
+			}
+			return;
+		}
+	}
+
+	size_t BufferArena::GetPageBytes() {
+		return pageBytes;
+	}
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstddef>
+
+namespace neu {
+	// sub-allocator over large immutable GL buffer pages - static mesh data
+	// packs into shared pages instead of one buffer object per mesh, so a
+	// level's thousands of small buffers collapse into a few pages, draws
+	// share buffer bindings, and the layout is ready for multi-draw-indirect.
+	// Frees return ranges to a per-page free list (coalescing neighbours)
+	// for recycling on model unload. DSA-only; the bind-to-edit path keeps
+	// per-mesh buffers
+	class BufferArena {
+	public:
+		struct Allocation {
+			GLuint buffer{ 0 };	// page buffer object, shared across allocations
+			size_t offset{ 0 };	// byte offset of this allocation within the page
+			size_t size{ 0 };	// rounded allocation size
+		};
+
+		// allocates and uploads - returns a zero-buffer Allocation when the
+		// arena is unavailable (no DSA), callers fall back to own buffers
+		static Allocation Allocate(size_t size, const void* data);
+
+		static void Free(const Allocation& allocation);
+
+		// resident page bytes, for the resource budget accounting
+		static size_t GetPageBytes();
+	};
+}
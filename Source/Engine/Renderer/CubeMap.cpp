@@ -2,21 +2,255 @@
 #include "CubeMap.h"
 
 namespace neu {
-	bool CubeMap::Load(const std::string& filenames) {
-		m_target = GL_TEXTURE_CUBE_MAP;
+	namespace {
+		// cooked environment container: header, then the prefiltered chain
+		// (per level, six RGB8 faces +X -X +Y -Y +Z -Z), then the six
+		// irradiance faces
+		constexpr uint32_t kEnvMagic = 0x564e454e;	// "NENV"
+		constexpr uint32_t kEnvVersion = 1;
+
+		struct EnvHeader {
+			uint32_t magic;
+			uint32_t version;
+			uint32_t size;				// mip 0 face edge
+			uint32_t mipCount;			// prefiltered chain length
+			uint32_t irradianceSize;	// irradiance face edge
+		};
+
+		// chain stops at 8px faces - below that the lobe is wider than the
+		// texel footprint anyway
+		constexpr int kMaxEnvMips = 6;
+		constexpr int kMinEnvFaceSize = 8;
+		constexpr int kIrradianceSize = 16;
+		constexpr int kPrefilterSamples = 64;
+		constexpr int kIrradianceSamples = 256;
 
-		glGenTextures(1, &m_texture);
-		glBindTexture(m_target, m_texture);
+		GLuint kFaceTargets[] = {
+			GL_TEXTURE_CUBE_MAP_POSITIVE_X,
+			GL_TEXTURE_CUBE_MAP_NEGATIVE_X,
+			GL_TEXTURE_CUBE_MAP_POSITIVE_Y,
+			GL_TEXTURE_CUBE_MAP_NEGATIVE_Y,
+			GL_TEXTURE_CUBE_MAP_POSITIVE_Z,
+			GL_TEXTURE_CUBE_MAP_NEGATIVE_Z
+		};
 
-		GLuint targets[] = {
-		GL_TEXTURE_CUBE_MAP_POSITIVE_X,
-		GL_TEXTURE_CUBE_MAP_NEGATIVE_X,
-		GL_TEXTURE_CUBE_MAP_POSITIVE_Y,
-		GL_TEXTURE_CUBE_MAP_NEGATIVE_Y,
-		GL_TEXTURE_CUBE_MAP_POSITIVE_Z,
-		GL_TEXTURE_CUBE_MAP_NEGATIVE_Z
+		// one cube level in float RGB, faces in GL order
+		struct EnvLevel {
+			int size{ 0 };
+			std::vector<glm::vec3> faces[6];
 		};
 
+		// world direction through the center of a face texel, standard GL
+		// cube conventions (u right, v down on each face)
+		glm::vec3 TexelDirection(int face, float u, float v) {
+			switch (face) {
+			case 0: return glm::normalize(glm::vec3(1, -v, -u));
+			case 1: return glm::normalize(glm::vec3(-1, -v, u));
+			case 2: return glm::normalize(glm::vec3(u, 1, v));
+			case 3: return glm::normalize(glm::vec3(u, -1, -v));
+			case 4: return glm::normalize(glm::vec3(u, -v, 1));
+			default: return glm::normalize(glm::vec3(-u, -v, -1));
+			}
+		}
+
+		// nearest-texel fetch by direction, inverse of TexelDirection
+		glm::vec3 SampleLevel(const EnvLevel& level, const glm::vec3& direction) {
+			glm::vec3 a = glm::abs(direction);
+			int face;
+			float u, v, m;
+			if (a.x >= a.y && a.x >= a.z) {
+				face = (direction.x > 0) ? 0 : 1;
+				m = a.x;
+				u = (direction.x > 0) ? -direction.z : direction.z;
+				v = -direction.y;
+			}
+			else if (a.y >= a.z) {
+				face = (direction.y > 0) ? 2 : 3;
+				m = a.y;
+				u = direction.x;
+				v = (direction.y > 0) ? direction.z : -direction.z;
+			}
+			else {
+				face = (direction.z > 0) ? 4 : 5;
+				m = a.z;
+				u = (direction.z > 0) ? direction.x : -direction.x;
+				v = -direction.y;
+			}
+
+			int size = level.size;
+			int x = math::clamp((int)((u / m * 0.5f + 0.5f) * size), 0, size - 1);
+			int y = math::clamp((int)((v / m * 0.5f + 0.5f) * size), 0, size - 1);
+			return level.faces[face][y * size + x];
+		}
+
+		// box-downsample one cube level to half resolution
+		EnvLevel Downsample(const EnvLevel& source) {
+			EnvLevel result;
+			result.size = source.size / 2;
+			for (int face = 0; face < 6; face++) {
+				result.faces[face].resize(result.size * result.size);
+				for (int y = 0; y < result.size; y++) {
+					for (int x = 0; x < result.size; x++) {
+						const glm::vec3* rowA = &source.faces[face][(y * 2) * source.size + x * 2];
+						const glm::vec3* rowB = rowA + source.size;
+						result.faces[face][y * result.size + x] = (rowA[0] + rowA[1] + rowB[0] + rowB[1]) * 0.25f;
+					}
+				}
+			}
+			return result;
+		}
+
+		// orthonormal basis around the lobe axis
+		void BuildBasis(const glm::vec3& normal, glm::vec3& tangent, glm::vec3& bitangent) {
+			glm::vec3 up = (math::fabs(normal.y) < 0.99f) ? glm::vec3{ 0, 1, 0 } : glm::vec3{ 1, 0, 0 };
+			tangent = glm::normalize(glm::cross(up, normal));
+			bitangent = glm::cross(normal, tangent);
+		}
+
+		// convolves the source level with a cosine-power lobe around every
+		// texel direction - importance-sampled (golden-angle spiral over the
+		// lobe), so the samples weight equally
+		void Convolve(const EnvLevel& source, EnvLevel& target, float power, int sampleCount) {
+			constexpr float kGoldenAngle = 2.399963f;
+
+			for (int face = 0; face < 6; face++) {
+				target.faces[face].resize(target.size * target.size);
+				for (int y = 0; y < target.size; y++) {
+					for (int x = 0; x < target.size; x++) {
+						float u = ((x + 0.5f) / target.size) * 2 - 1;
+						float v = ((y + 0.5f) / target.size) * 2 - 1;
+						glm::vec3 normal = TexelDirection(face, u, v);
+
+						glm::vec3 tangent, bitangent;
+						BuildBasis(normal, tangent, bitangent);
+
+						glm::vec3 sum{ 0 };
+						for (int i = 0; i < sampleCount; i++) {
+							float cosTheta = std::pow(1 - (i + 0.5f) / sampleCount, 1.0f / (power + 1));
+							float sinTheta = std::sqrt(math::max(0.0f, 1 - cosTheta * cosTheta));
+							float phi = i * kGoldenAngle;
+
+							glm::vec3 direction =
+								tangent * (std::cos(phi) * sinTheta) +
+								bitangent * (std::sin(phi) * sinTheta) +
+								normal * cosTheta;
+							sum += SampleLevel(source, direction);
+						}
+						target.faces[face][y * target.size + x] = sum / (float)sampleCount;
+					}
+				}
+			}
+		}
+
+		// appends a level's faces to the cooked payload as RGB8
+		void AppendLevel(const EnvLevel& level, std::vector<uint8_t>& data) {
+			for (int face = 0; face < 6; face++) {
+				for (auto& pixel : level.faces[face]) {
+					glm::vec3 clamped = glm::clamp(pixel, 0.0f, 1.0f);
+					data.push_back((uint8_t)(clamped.r * 255.0f + 0.5f));
+					data.push_back((uint8_t)(clamped.g * 255.0f + 0.5f));
+					data.push_back((uint8_t)(clamped.b * 255.0f + 0.5f));
+				}
+			}
+		}
+
+		// decodes the six raw faces into float RGB, all square and equal size
+		bool LoadFaces(const std::vector<std::string>& filenames, EnvLevel& level) {
+			for (size_t i = 0; i < filenames.size(); i++) {
+				SDL_Surface* surface = IMG_Load(filenames[i].c_str());
+				if (!surface) {
+					LOG_CAT_ERROR(Renderer, "Could not load image: {}", filenames[i]);
+					return false;
+				}
+				if (surface->w != surface->h || (level.size && surface->w != level.size)) {
+					LOG_CAT_ERROR(Renderer, "Cube map faces must be square and equal size: {}", filenames[i]);
+					SDL_DestroySurface(surface);
+					return false;
+				}
+
+				const SDL_PixelFormatDetails* details = SDL_GetPixelFormatDetails(surface->format);
+				int channels = details->bytes_per_pixel;
+				if (channels < 3) {
+					SDL_DestroySurface(surface);
+					return false;
+				}
+
+				level.size = surface->w;
+				level.faces[i].resize(level.size * level.size);
+				const uint8_t* pixels = (const uint8_t*)surface->pixels;
+				for (int y = 0; y < level.size; y++) {
+					const uint8_t* row = pixels + y * surface->pitch;
+					for (int x = 0; x < level.size; x++) {
+						const uint8_t* pixel = row + x * channels;
+						level.faces[i][y * level.size + x] = glm::vec3(pixel[0], pixel[1], pixel[2]) / 255.0f;
+					}
+				}
+				SDL_DestroySurface(surface);
+			}
+			return true;
+		}
+
+		// the cooked sibling rides next to the first face
+		std::string GetCookedFilename(const std::vector<std::string>& filenames) {
+			return filenames.empty() ? std::string{} : filenames[0] + ".nenv";
+		}
+
+		// full offline prefilter: box chain as the convolution source, then
+		// per-mip lobes from mirror (copied) to wide, then the irradiance
+		// cube from the smallest box level. One-time cook cost, every later
+		// load is a straight upload
+		bool CookEnvironment(const std::vector<std::string>& filenames, const std::string& cookedFilename) {
+			EnvLevel source;
+			if (!LoadFaces(filenames, source)) return false;
+
+			int mipCount = 1;
+			while (mipCount < kMaxEnvMips && (source.size >> mipCount) >= kMinEnvFaceSize) mipCount++;
+
+			// box-filtered pyramid keeps each convolution reading a source
+			// matched to its own resolution instead of the full map
+			std::vector<EnvLevel> boxChain;
+			boxChain.push_back(source);
+			for (int level = 1; level < mipCount; level++) {
+				boxChain.push_back(Downsample(boxChain.back()));
+			}
+
+			EnvHeader header{ kEnvMagic, kEnvVersion, (uint32_t)source.size, (uint32_t)mipCount, kIrradianceSize };
+			std::vector<uint8_t> data;
+			data.insert(data.end(), (const uint8_t*)&header, (const uint8_t*)&header + sizeof(header));
+
+			// mip 0 stays the raw faces (mirror reflection); deeper mips get
+			// progressively wider lobes - shaders pick the level from
+			// roughness via textureLod
+			AppendLevel(boxChain[0], data);
+			for (int level = 1; level < mipCount; level++) {
+				float power = std::exp2f((float)(mipCount - 1 - level) * 2.0f);
+				EnvLevel filtered;
+				filtered.size = boxChain[level].size;
+				Convolve(boxChain[level], filtered, power, kPrefilterSamples);
+				AppendLevel(filtered, data);
+			}
+
+			// cosine lobe over the smallest box level for diffuse ambient
+			EnvLevel irradiance;
+			irradiance.size = kIrradianceSize;
+			Convolve(boxChain.back(), irradiance, 1.0f, kIrradianceSamples);
+			AppendLevel(irradiance, data);
+
+			if (!file::WriteBinaryFile(cookedFilename, data)) {
+				LOG_CAT_WARNING(Renderer, "Could not write cooked environment: {}", cookedFilename);
+				return false;
+			}
+			return true;
+		}
+	}
+
+	CubeMap::~CubeMap() {
+		if (m_irradiance) glDeleteTextures(1, &m_irradiance);
+	}
+
+	bool CubeMap::Load(const std::string& filenames) {
+		m_target = GL_TEXTURE_CUBE_MAP;
+
 		// extract cubemap from filename
 		std::vector<std::string> filename_split;
 		std::istringstream stream(filenames);
@@ -26,10 +260,34 @@ namespace neu {
 			filename_split.push_back(tempstring);
 		}
 
+		// prefer the cooked environment when it exists and is not older than
+		// any face; cook it on first load otherwise - same scheme as models
+		std::string cookedFilename = GetCookedFilename(filename_split);
+		if (file::Exists(cookedFilename)) {
+			bool stale = false;
+			for (auto& face : filename_split) {
+				stale |= file::Exists(face) &&
+					std::filesystem::last_write_time(cookedFilename) < std::filesystem::last_write_time(face);
+			}
+			if (!stale && LoadCooked(cookedFilename)) return true;
+		}
+
+		if (filename_split.size() == 6 && CookEnvironment(filename_split, cookedFilename) && LoadCooked(cookedFilename)) {
+			return true;
+		}
+
+		// raw fallback: six faces uploaded as-is, no prefiltered chain and
+		// no irradiance cube
+		bool dsa = GLState::SupportsDSA();
+		if (!dsa) {
+			glGenTextures(1, &m_texture);
+			GLState::BindTexture(m_target, m_texture);
+		}
+
 		for (size_t i = 0; i < filename_split.size(); i++) {
 			SDL_Surface* surface = IMG_Load(filename_split[i].c_str());
 			if (!surface) {
-				LOG_ERROR("Could not load image: {}", filenames);
+				LOG_CAT_ERROR(Renderer, "Could not load image: {}", filenames);
 				return false;
 			}
 
@@ -39,18 +297,142 @@ namespace neu {
 			GLenum internalFormat = (channels == 4) ? GL_RGBA8 : GL_RGB8;
 			GLenum format = (channels == 4) ? GL_RGBA : GL_RGB;
 
-			glTexImage2D(targets[i], 0, internalFormat, surface->w, surface->h, 0, format, GL_UNSIGNED_BYTE, surface->pixels);
+			if (dsa) {
+				// DSA: immutable storage sized from the first face, faces
+				// filled as array layers without touching a bind point
+				if (!m_texture) {
+					glCreateTextures(m_target, 1, &m_texture);
+					glTextureStorage2D(m_texture, 1, internalFormat, surface->w, surface->h);
+				}
+				glTextureSubImage3D(m_texture, 0, 0, 0, (GLint)i, surface->w, surface->h, 1, format, GL_UNSIGNED_BYTE, surface->pixels);
+			}
+			else {
+				glTexImage2D(kFaceTargets[i], 0, internalFormat, surface->w, surface->h, 0, format, GL_UNSIGNED_BYTE, surface->pixels);
+			}
 			SDL_DestroySurface(surface);
 		}
 
-		glTexParameteri(m_target, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		glTexParameteri(m_target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		if (dsa) {
+			glTextureParameteri(m_texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+			glTextureParameteri(m_texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+			glTextureParameteri(m_texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTextureParameteri(m_texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+			glTextureParameteri(m_texture, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+		}
+		else {
+			glTexParameteri(m_target, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+			glTexParameteri(m_target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+			glTexParameteri(m_target, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTexParameteri(m_target, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+			glTexParameteri(m_target, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+		}
+
+		return true;
+	}
+
+	bool CubeMap::LoadCooked(const std::string& filename) {
+		std::vector<uint8_t> data;
+		if (!file::ReadBinaryFile(filename, data)) return false;
+		if (data.size() < sizeof(EnvHeader)) return false;
+
+		EnvHeader header;
+		std::memcpy(&header, data.data(), sizeof(header));
+		if (header.magic != kEnvMagic || header.version != kEnvVersion) {
+			LOG_CAT_WARNING(Renderer, "Cooked environment has wrong magic/version: {}", filename);
+			return false;
+		}
+		if (header.mipCount == 0 || header.size == 0) return false;
+
+		// header claims must fit the payload - prefiltered chain plus the
+		// irradiance faces, 3 bytes per texel
+		size_t expected = sizeof(EnvHeader);
+		for (uint32_t level = 0; level < header.mipCount; level++) {
+			size_t size = header.size >> level;
+			expected += size * size * 6 * 3;
+		}
+		expected += (size_t)header.irradianceSize * header.irradianceSize * 6 * 3;
+		if (data.size() < expected) return false;
+
+		m_size = { (int)header.size, (int)header.size };
+		m_envMipCount = (int)header.mipCount;
+
+		bool dsa = GLState::SupportsDSA();
+		size_t offset = sizeof(EnvHeader);
+
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+		// prefiltered chain straight into the mip levels - no
+		// glGenerateMipmap, the levels ARE the filtered data
+		if (dsa) {
+			glCreateTextures(m_target, 1, &m_texture);
+			glTextureStorage2D(m_texture, m_envMipCount, GL_RGB8, m_size.x, m_size.y);
+		}
+		else {
+			glGenTextures(1, &m_texture);
+			GLState::BindTexture(m_target, m_texture);
+		}
+
+		for (int level = 0; level < m_envMipCount; level++) {
+			GLsizei size = (GLsizei)(header.size >> level);
+			size_t faceBytes = (size_t)size * size * 3;
+			for (int face = 0; face < 6; face++) {
+				if (dsa) glTextureSubImage3D(m_texture, level, 0, 0, face, size, size, 1, GL_RGB, GL_UNSIGNED_BYTE, data.data() + offset);
+				else glTexImage2D(kFaceTargets[face], level, GL_RGB8, size, size, 0, GL_RGB, GL_UNSIGNED_BYTE, data.data() + offset);
+				offset += faceBytes;
+			}
+		}
+
+		if (dsa) {
+			glTextureParameteri(m_texture, GL_TEXTURE_MIN_FILTER, (m_envMipCount > 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+			glTextureParameteri(m_texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTextureParameteri(m_texture, GL_TEXTURE_MAX_LEVEL, m_envMipCount - 1);
+			glTextureParameteri(m_texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTextureParameteri(m_texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+			glTextureParameteri(m_texture, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+		}
+		else {
+			glTexParameteri(m_target, GL_TEXTURE_MIN_FILTER, (m_envMipCount > 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+			glTexParameteri(m_target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTexParameteri(m_target, GL_TEXTURE_MAX_LEVEL, m_envMipCount - 1);
+			glTexParameteri(m_target, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTexParameteri(m_target, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+			glTexParameteri(m_target, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+		}
+
+		// irradiance cube, one level
+		GLsizei irradianceSize = (GLsizei)header.irradianceSize;
+		size_t irradianceFaceBytes = (size_t)irradianceSize * irradianceSize * 3;
+		if (dsa) {
+			glCreateTextures(m_target, 1, &m_irradiance);
+			glTextureStorage2D(m_irradiance, 1, GL_RGB8, irradianceSize, irradianceSize);
+			for (int face = 0; face < 6; face++) {
+				glTextureSubImage3D(m_irradiance, 0, 0, 0, face, irradianceSize, irradianceSize, 1, GL_RGB, GL_UNSIGNED_BYTE, data.data() + offset);
+				offset += irradianceFaceBytes;
+			}
+			glTextureParameteri(m_irradiance, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+			glTextureParameteri(m_irradiance, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTextureParameteri(m_irradiance, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTextureParameteri(m_irradiance, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+			glTextureParameteri(m_irradiance, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+		}
+		else {
+			glGenTextures(1, &m_irradiance);
+			GLState::BindTexture(m_target, m_irradiance);
+			for (int face = 0; face < 6; face++) {
+				glTexImage2D(kFaceTargets[face], 0, GL_RGB8, irradianceSize, irradianceSize, 0, GL_RGB, GL_UNSIGNED_BYTE, data.data() + offset);
+				offset += irradianceFaceBytes;
+			}
+			glTexParameteri(m_target, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+			glTexParameteri(m_target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTexParameteri(m_target, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTexParameteri(m_target, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+			glTexParameteri(m_target, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+		}
 
-		glTexParameteri(m_target, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-		glTexParameteri(m_target, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		glTexParameteri(m_target, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 
-		
 		return true;
 	}
-}
\ No newline at end of file
+}
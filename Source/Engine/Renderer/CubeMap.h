@@ -2,11 +2,41 @@
 #include "Texture.h"
 
 namespace neu {
+	/// <summary>
+	/// Environment cube map with offline-prefiltered reflections.
+	///
+	/// On first load the six raw faces are convolved on the CPU into a
+	/// roughness mip chain (mip 0 mirror, deeper mips progressively wider
+	/// Phong lobes) plus a small cosine-convolved irradiance cube, and the
+	/// result is written as a cooked ".nenv" sibling - the same cook-on-
+	/// first-load scheme models use. Later loads upload the cooked levels
+	/// straight into the mips, so roughness-dependent reflections sample
+	/// textureLod with no runtime or load-time GPU filtering at all.
+	/// </summary>
 	class CubeMap : public Texture {
 	public:
 		// CLASS_PROTOTYPE(CubeMap)
 
+		~CubeMap();
+
 		bool Load(const std::string& filenames);
 		void UpdateGUI() override {};
+
+		/// <summary>
+		/// Cosine-convolved irradiance cube for diffuse ambient lookups,
+		/// 0 when the map loaded through the raw fallback path.
+		/// </summary>
+		GLuint GetIrradianceTexture() const { return m_irradiance; }
+
+		int GetMipCount() const { return m_envMipCount; }
+
+	private:
+		// uploads a cooked ".nenv" environment: prefiltered chain into the
+		// mip levels, irradiance faces into their own small cube
+		bool LoadCooked(const std::string& filename);
+
+	private:
+		GLuint m_irradiance{ 0 };
+		int m_envMipCount{ 1 };
 	};
-}
\ No newline at end of file
+}
@@ -0,0 +1,141 @@
+#include "EnginePCH.h"
+#include "DebugDraw.h"
+
+#if NEU_DEBUG_DRAW_ENABLED
+
+namespace neu {
+
+	void DebugDraw::AddLine(const glm::vec3& from, const glm::vec3& to, const glm::vec4& color, bool overlay)
+	{
+		std::lock_guard lock(m_mutex);
+		auto& lines = overlay ? m_overlayLines : m_lines;
+		lines.push_back(LineVertex{ glm::vec4{ from, 1 }, color });
+		lines.push_back(LineVertex{ glm::vec4{ to, 1 }, color });
+	}
+
+	void DebugDraw::AddBox(const Bounds& bounds, const glm::vec4& color, bool overlay)
+	{
+		glm::vec3 min = bounds.min;
+		glm::vec3 max = bounds.max;
+
+		// 12 edges, bottom square then top square then the risers
+		glm::vec3 corners[8] = {
+			{ min.x, min.y, min.z }, { max.x, min.y, min.z },
+			{ max.x, min.y, max.z }, { min.x, min.y, max.z },
+			{ min.x, max.y, min.z }, { max.x, max.y, min.z },
+			{ max.x, max.y, max.z }, { min.x, max.y, max.z }
+		};
+		constexpr int edges[12][2] = {
+			{ 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 0 },
+			{ 4, 5 }, { 5, 6 }, { 6, 7 }, { 7, 4 },
+			{ 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 }
+		};
+		for (auto& edge : edges) {
+			AddLine(corners[edge[0]], corners[edge[1]], color, overlay);
+		}
+	}
+
+	void DebugDraw::AddSphere(const glm::vec3& center, float radius, const glm::vec4& color, bool overlay)
+	{
+		// three great circles, one per axis pair
+		constexpr int kSegments = 24;
+		for (int i = 0; i < kSegments; i++) {
+			float a0 = math::twoPi * i / kSegments;
+			float a1 = math::twoPi * (i + 1) / kSegments;
+			glm::vec2 p0{ math::cos(a0) * radius, math::sin(a0) * radius };
+			glm::vec2 p1{ math::cos(a1) * radius, math::sin(a1) * radius };
+
+			AddLine(center + glm::vec3{ p0.x, p0.y, 0 }, center + glm::vec3{ p1.x, p1.y, 0 }, color, overlay);
+			AddLine(center + glm::vec3{ p0.x, 0, p0.y }, center + glm::vec3{ p1.x, 0, p1.y }, color, overlay);
+			AddLine(center + glm::vec3{ 0, p0.x, p0.y }, center + glm::vec3{ 0, p1.x, p1.y }, color, overlay);
+		}
+	}
+
+	void DebugDraw::AddText(const glm::vec3& position, const std::string& text, const glm::vec4& color)
+	{
+		std::lock_guard lock(m_mutex);
+		m_labels.push_back(Label{ position, color, text });
+	}
+
+	void DebugDraw::Clear()
+	{
+		std::lock_guard lock(m_mutex);
+		m_lines.clear();
+		m_overlayLines.clear();
+		m_labels.clear();
+	}
+
+	void DebugDraw::Flush(Renderer& renderer, const glm::mat4& viewProjection)
+	{
+		std::lock_guard lock(m_mutex);
+
+		// world-anchored labels ride the ImGui background draw list, which
+		// the GUI pass after Scene::Draw composites
+		if (!m_labels.empty()) {
+			glm::vec2 screenSize{ (float)renderer.GetWidth(), (float)renderer.GetHeight() };
+			for (auto& label : m_labels) {
+				glm::vec4 clip = viewProjection * glm::vec4{ label.position, 1 };
+				if (clip.w <= 0) continue;
+
+				glm::vec2 screen{
+					(clip.x / clip.w * 0.5f + 0.5f) * screenSize.x,
+					(1.0f - (clip.y / clip.w * 0.5f + 0.5f)) * screenSize.y
+				};
+				ImGui::GetBackgroundDrawList()->AddText(
+					ImVec2{ screen.x, screen.y },
+					ImGui::ColorConvertFloat4ToU32(ImVec4{ label.color.r, label.color.g, label.color.b, label.color.a }),
+					label.text.c_str());
+			}
+		}
+
+		size_t lineVertices = m_lines.size() + m_overlayLines.size();
+		if (lineVertices == 0) return;
+
+		if (!m_programChecked) {
+			m_programChecked = true;
+			m_program = Resources().Get<Program>("Shaders/debug.prog");
+		}
+		if (!m_program || !m_program->m_program) return;
+
+		// both variants share one upload: depth-tested vertices first,
+		// overlay vertices after, each drawn as one range
+		m_scratch.clear();
+		m_scratch.insert(m_scratch.end(), m_lines.begin(), m_lines.end());
+		m_scratch.insert(m_scratch.end(), m_overlayLines.begin(), m_overlayLines.end());
+
+		if (lineVertices > m_capacity) {
+			m_capacity = math::max<size_t>(m_capacity * 2, 1024);
+			while (m_capacity < lineVertices) m_capacity *= 2;
+			m_buffer = StorageBuffer{};
+			m_buffer.Create(m_capacity * sizeof(LineVertex), 0);
+		}
+		m_buffer.Upload(m_scratch.data(), m_scratch.size() * sizeof(LineVertex));
+
+		// attribute-less draw - the vertex shader pulls the vertex at
+		// u_base + gl_VertexID from the stream
+		if (!m_vao) glGenVertexArrays(1, &m_vao);
+
+		m_program->Use();
+		m_program->SetUniform("u_viewProjection", viewProjection);
+
+		GLState::BindVertexArray(m_vao);
+		GLState::SetDepthMask(false);
+
+		if (!m_lines.empty()) {
+			m_program->SetUniform("u_base", 0);
+			glDrawArrays(GL_LINES, 0, (GLsizei)m_lines.size());
+			FrameStats::AddDraw(0);
+		}
+		if (!m_overlayLines.empty()) {
+			glDisable(GL_DEPTH_TEST);
+			m_program->SetUniform("u_base", (int)m_lines.size());
+			glDrawArrays(GL_LINES, 0, (GLsizei)m_overlayLines.size());
+			FrameStats::AddDraw(0);
+			glEnable(GL_DEPTH_TEST);
+		}
+
+		GLState::SetDepthMask(true);
+	}
+}
+
+#endif
@@ -0,0 +1,92 @@
+#pragma once
+#include "Core/Singleton.h"
+#include "Resources/Resource.h"
+#include "StorageBuffer.h"
+#include "Math/Bounds.h"
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// debug drawing compiles in for debug builds, or anywhere with
+// NEU_DEBUG_DRAW defined (mirrors the NEU_LOG_ALL override in Logger.h)
+#if defined(_DEBUG) || defined(NEU_DEBUG_DRAW)
+	#define NEU_DEBUG_DRAW_ENABLED 1
+#else
+	#define NEU_DEBUG_DRAW_ENABLED 0
+#endif
+
+namespace neu {
+	class Renderer;
+	class Program;
+
+	// retained per-frame debug drawing: lines, boxes, spheres and world-
+	// anchored labels submit from anywhere - including job system workers,
+	// submission just appends under a mutex - and accumulate into one
+	// shared vertex stream. Scene::Draw flushes the lot over the finished
+	// frame as at most two GL_LINES draws (one depth-tested, one overlay)
+	// through "Shaders/debug.prog"; labels route through the ImGui
+	// background draw list. Everything compiles to empty inlines in
+	// shipping builds.
+	class DebugDraw : public Singleton<DebugDraw> {
+	public:
+#if NEU_DEBUG_DRAW_ENABLED
+		// overlay primitives skip the depth test and draw over geometry
+		void AddLine(const glm::vec3& from, const glm::vec3& to, const glm::vec4& color = { 1, 1, 1, 1 }, bool overlay = false);
+		void AddBox(const Bounds& bounds, const glm::vec4& color = { 1, 1, 1, 1 }, bool overlay = false);
+		void AddSphere(const glm::vec3& center, float radius, const glm::vec4& color = { 1, 1, 1, 1 }, bool overlay = false);
+		void AddText(const glm::vec3& position, const std::string& text, const glm::vec4& color = { 1, 1, 1, 1 });
+
+		// drops this frame's submissions - runs at the top of every update
+		void Clear();
+
+		// draws the accumulated primitives, called by Scene::Draw after the
+		// passes with the main camera's view-projection
+		void Flush(Renderer& renderer, const glm::mat4& viewProjection);
+#else
+		// shipping builds: every call inlines away, no state, no locks
+		void AddLine(const glm::vec3&, const glm::vec3&, const glm::vec4& = { 1, 1, 1, 1 }, bool = false) {}
+		void AddBox(const Bounds&, const glm::vec4& = { 1, 1, 1, 1 }, bool = false) {}
+		void AddSphere(const glm::vec3&, float, const glm::vec4& = { 1, 1, 1, 1 }, bool = false) {}
+		void AddText(const glm::vec3&, const std::string&, const glm::vec4& = { 1, 1, 1, 1 }) {}
+		void Clear() {}
+		void Flush(Renderer&, const glm::mat4&) {}
+#endif
+
+	private:
+		friend class Singleton<DebugDraw>;
+		DebugDraw() = default;
+
+#if NEU_DEBUG_DRAW_ENABLED
+		// matches the std430 layout the debug vertex shader reads
+		struct LineVertex {
+			glm::vec4 position;
+			glm::vec4 color;
+		};
+
+		struct Label {
+			glm::vec3 position;
+			glm::vec4 color;
+			std::string text;
+		};
+
+		// guards the submission vectors - workers append during the frame,
+		// the GL thread drains them in Flush
+		std::mutex m_mutex;
+		std::vector<LineVertex> m_lines;
+		std::vector<LineVertex> m_overlayLines;
+		std::vector<Label> m_labels;
+		std::vector<LineVertex> m_scratch;	// combined upload, reused across frames
+
+		// vertex stream on the persistent-mapped ring, grown on demand
+		StorageBuffer m_buffer;
+		size_t m_capacity{ 0 };
+		GLuint m_vao{ 0 };
+
+		// line program shared by both draws, fetched once
+		res_t<Program> m_program;
+		bool m_programChecked{ false };
+#endif
+	};
+}
@@ -0,0 +1,56 @@
+#include "DrawList.h"
+#include <cstring>
+#include <utility>
+
+namespace neu {
+	uint64_t DrawList::MakeKey(uint32_t programId, uint32_t materialId, float viewDepth) {
+		// monotonic unsigned mapping of the float depth so nearer draws sort
+		// first within a material (flip all bits for negatives, set the sign
+		// bit for positives)
+		uint32_t depthBits;
+		std::memcpy(&depthBits, &viewDepth, sizeof(depthBits));
+		depthBits = (depthBits & 0x80000000u) ? ~depthBits : (depthBits | 0x80000000u);
+
+		return ((uint64_t)(programId & 0xffff) << 48) |
+			((uint64_t)(materialId & 0xffff) << 32) |
+			(uint64_t)depthBits;
+	}
+
+	void DrawList::Sort() {
+		size_t count = m_records.size();
+		if (count < 2) return;
+
+		m_scratch.resize(count);
+
+		DrawRecord* src = m_records.data();
+		DrawRecord* dst = m_scratch.data();
+
+		for (int shift = 0; shift < 64; shift += 8) {
+			size_t counts[256] = {};
+			for (size_t i = 0; i < count; i++) {
+				counts[(src[i].key >> shift) & 0xff]++;
+			}
+
+			// every key shares this byte, nothing to move this pass
+			if (counts[(src[0].key >> shift) & 0xff] == count) continue;
+
+			// prefix sum the counts into scatter offsets
+			size_t offsets[256];
+			size_t total = 0;
+			for (int i = 0; i < 256; i++) {
+				offsets[i] = total;
+				total += counts[i];
+			}
+
+			// stable scatter into the other buffer
+			for (size_t i = 0; i < count; i++) {
+				dst[offsets[(src[i].key >> shift) & 0xff]++] = src[i];
+			}
+
+			std::swap(src, dst);
+		}
+
+		// sorted data may have ended up in the scratch buffer
+		if (src == m_scratch.data()) m_records.swap(m_scratch);
+	}
+}
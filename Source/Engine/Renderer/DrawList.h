@@ -0,0 +1,40 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+namespace neu {
+	class ModelRenderer;
+
+	// compact draw record emitted by renderer components each frame, the
+	// 64-bit key orders records so playback touches GL state only on
+	// key transitions
+	struct DrawRecord {
+		uint64_t key;
+		ModelRenderer* renderer;
+	};
+
+	// per-frame draw submission list - renderer components append records,
+	// Scene radix sorts on the key and plays the sorted list back with
+	// state changes only where the program/material actually differ
+	class DrawList {
+	public:
+		// key layout, high to low: program id (16) | material id (16) |
+		// view-space depth (32), so draws group by program, then material,
+		// then render front to back
+		static uint64_t MakeKey(uint32_t programId, uint32_t materialId, float viewDepth);
+
+		void Clear() { m_records.clear(); }
+		void Add(uint64_t key, ModelRenderer* renderer) { m_records.push_back({ key, renderer }); }
+
+		// least-significant-digit radix sort over the 64-bit keys, 8 bits
+		// per pass - O(n) per pass with no comparisons, and passes where
+		// every key shares the byte are skipped
+		void Sort();
+
+		const std::vector<DrawRecord>& GetRecords() const { return m_records; }
+
+	private:
+		std::vector<DrawRecord> m_records;
+		std::vector<DrawRecord> m_scratch;
+	};
+}
@@ -0,0 +1,178 @@
+#include "EnginePCH.h"
+#include "FlipbookBatcher.h"
+
+namespace neu {
+
+	FlipbookBatcher::handle_t FlipbookBatcher::Add(const res_t<TextureAnimation>& animation)
+	{
+		handle_t handle;
+		if (!m_freeList.empty()) {
+			handle = m_freeList.back();
+			m_freeList.pop_back();
+		}
+		else {
+			handle = (handle_t)m_quads.size();
+			m_quads.emplace_back();
+		}
+
+		m_quads[handle] = Quad{};
+		m_quads[handle].animation = animation;
+		m_quads[handle].active = true;
+
+		return handle;
+	}
+
+	void FlipbookBatcher::Remove(handle_t handle)
+	{
+		if (handle < 0 || handle >= (handle_t)m_quads.size() || !m_quads[handle].active) return;
+
+		m_quads[handle] = Quad{};
+		m_freeList.push_back(handle);
+	}
+
+	void FlipbookBatcher::Set(handle_t handle, const glm::vec3& position, const glm::vec2& size, const glm::vec4& color)
+	{
+		if (handle < 0 || handle >= (handle_t)m_quads.size()) return;
+
+		auto& quad = m_quads[handle];
+		quad.position = position;
+		quad.size = size;
+		quad.color = color;
+	}
+
+	void FlipbookBatcher::Restart(handle_t handle)
+	{
+		if (handle < 0 || handle >= (handle_t)m_quads.size()) return;
+
+		m_quads[handle].time = 0;
+		m_quads[handle].frame = 0;
+	}
+
+	void FlipbookBatcher::Update(float dt)
+	{
+		// every quad's playback advances in one flat pass here instead of
+		// scattered per-owner updates - just arithmetic over a contiguous
+		// array, so hundreds of quads cost one cache-friendly loop
+		for (auto& quad : m_quads) {
+			if (!quad.active || !quad.animation) continue;
+
+			quad.time += dt;
+			int frame = (int)(quad.time * quad.animation->GetFPS());
+			int total = quad.animation->GetTotalFrames();
+			if (total > 0) {
+				// looping animations wrap, one-shots hold their last frame
+				quad.frame = quad.animation->IsLooping() ? frame % total : math::min(frame, total - 1);
+			}
+		}
+	}
+
+	void FlipbookBatcher::Draw()
+	{
+		m_drawCount = 0;
+		if (m_quads.empty()) return;
+
+		if (!m_programChecked) {
+			m_programChecked = true;
+			m_program = Resources().Get<Program>("Shaders/flipbook.prog");
+		}
+		if (!m_program || !m_program->m_program) return;
+
+		// group the live quads by atlas texture so each texture becomes one
+		// contiguous instance range and one draw
+		m_order.clear();
+		for (handle_t handle = 0; handle < (handle_t)m_quads.size(); handle++) {
+			auto& quad = m_quads[handle];
+			if (quad.active && quad.animation && quad.animation->GetTexture()) m_order.push_back(handle);
+		}
+		if (m_order.empty()) return;
+
+		std::stable_sort(m_order.begin(), m_order.end(), [this](handle_t a, handle_t b) {
+			return m_quads[a].animation->GetTexture().get() < m_quads[b].animation->GetTexture().get();
+		});
+
+		// resolve each quad's current frame rect into the instance stream -
+		// the frame indices were advanced in bulk by Update
+		m_instances.clear();
+		for (auto handle : m_order) {
+			auto& quad = m_quads[handle];
+			auto texture = quad.animation->GetTexture();
+			glm::vec2 textureSize = texture->GetSize();
+			rect frameRect = quad.animation->GetFrameRect(quad.frame);
+
+			QuadInstance instance;
+			instance.position = glm::vec4{ quad.position, (float)quad.frame };
+			instance.uvRect = glm::vec4{
+				frameRect.x / textureSize.x, frameRect.y / textureSize.y,
+				frameRect.w / textureSize.x, frameRect.h / textureSize.y
+			};
+			instance.color = quad.color;
+			instance.size = glm::vec4{ quad.size, 0, 0 };
+			m_instances.push_back(instance);
+		}
+
+		// grow the ring when the quad count outruns it - streamed buffers
+		// are fixed-size, so replace rather than resize
+		if (m_instances.size() > m_instanceCapacity) {
+			m_instanceCapacity = math::max<size_t>(m_instanceCapacity * 2, 64);
+			while (m_instanceCapacity < m_instances.size()) m_instanceCapacity *= 2;
+			m_instanceBuffer = StorageBuffer{};
+			m_instanceBuffer.Create(m_instanceCapacity * sizeof(QuadInstance), 0);
+		}
+		m_instanceBuffer.Upload(m_instances.data(), m_instances.size() * sizeof(QuadInstance));
+
+		// attribute-less draw - the vertex shader pulls the quad's instance
+		// from the stream at u_base + gl_InstanceID and expands the corners
+		if (!m_vao) glGenVertexArrays(1, &m_vao);
+
+		m_program->Use();
+		m_program->SetUniform("u_texture", 0);
+
+		// overlays blend over the shaded result with depth writes off, same
+		// as the transparent queue
+		GLState::SetBlend(true);
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		GLState::SetDepthMask(false);
+		GLState::BindVertexArray(m_vao);
+
+		// one instanced draw per contiguous same-texture range
+		size_t start = 0;
+		while (start < m_order.size()) {
+			auto texture = m_quads[m_order[start]].animation->GetTexture();
+
+			size_t end = start + 1;
+			while (end < m_order.size() && m_quads[m_order[end]].animation->GetTexture().get() == texture.get()) end++;
+
+			texture->SetActive(GL_TEXTURE0);
+			texture->Bind();
+			m_program->SetUniform("u_base", (int)start);
+			glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, (GLsizei)(end - start));
+			FrameStats::AddDraw(2 * (uint32_t)(end - start));
+			m_drawCount++;
+
+			start = end;
+		}
+
+		GLState::SetDepthMask(true);
+		GLState::SetBlend(false);
+	}
+
+	void FlipbookBatcher::Clear()
+	{
+		m_quads.clear();
+		m_freeList.clear();
+		m_order.clear();
+		m_instances.clear();
+
+		m_instanceBuffer = StorageBuffer{};
+		m_instanceCapacity = 0;
+
+		if (m_vao) {
+			GLState::InvalidateVertexArray(m_vao);
+			glDeleteVertexArrays(1, &m_vao);
+			m_vao = 0;
+		}
+
+		m_program = nullptr;
+		m_programChecked = false;
+	}
+}
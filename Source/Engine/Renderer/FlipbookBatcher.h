@@ -0,0 +1,101 @@
+#pragma once
+#include "Core/Singleton.h"
+#include "Resources/Resource.h"
+#include "StorageBuffer.h"
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace neu {
+	class Program;
+	class TextureAnimation;
+
+	// batches every animated flipbook quad (HUD elements, effect overlays)
+	// into one instanced draw per atlas texture instead of a draw call and
+	// material bind per quad.
+	//
+	// owners register a quad once with its TextureAnimation and update its
+	// placement as it moves; playback state stays here, so Update() advances
+	// every quad's frame in one flat pass over contiguous data. Draw()
+	// resolves each quad's current frame rect, streams the instance data
+	// through the persistent-mapped ring (SSBO binding 0, same scheme the
+	// particle systems use) grouped by atlas texture, and issues one
+	// attribute-less instanced draw per texture with the shared flipbook
+	// program ("Shaders/flipbook.prog" - quads don't render without it).
+	class FlipbookBatcher : public Singleton<FlipbookBatcher> {
+	public:
+		using handle_t = int;
+
+		// registers a quad playing the given animation from frame 0 and
+		// returns its handle; place it with Set (once for static HUD
+		// elements, per frame for moving ones)
+		handle_t Add(const res_t<TextureAnimation>& animation);
+
+		// releases a quad's slot for reuse by a later Add
+		void Remove(handle_t handle);
+
+		// per-frame placement - world position, quad size and tint
+		void Set(handle_t handle, const glm::vec3& position, const glm::vec2& size, const glm::vec4& color);
+
+		// rewinds playback to frame 0 (one-shot effect replays)
+		void Restart(handle_t handle);
+
+		// advances every registered quad's playback - non-looping
+		// animations hold their last frame
+		void Update(float dt);
+
+		// streams this frame's instance data and submits one instanced
+		// draw per atlas texture, blended with depth writes off
+		void Draw();
+
+		// drops every quad and the GL objects
+		void Clear();
+
+		// editor stats, draw count from the last Draw
+		size_t GetQuadCount() const { return m_quads.size() - m_freeList.size(); }
+		size_t GetDrawCount() const { return m_drawCount; }
+
+	private:
+		friend class Singleton<FlipbookBatcher>;
+		FlipbookBatcher() = default;
+
+		struct Quad {
+			res_t<TextureAnimation> animation;
+			float time{ 0 };
+			int frame{ 0 };
+			glm::vec3 position{ 0 };
+			glm::vec2 size{ 1, 1 };
+			glm::vec4 color{ 1 };
+			bool active{ false };
+		};
+
+		// matches the std430 layout the flipbook vertex shader reads
+		struct QuadInstance {
+			glm::vec4 position;	// xyz world position, w current frame index
+			glm::vec4 uvRect;	// current frame rect in texture space (u, v, w, h)
+			glm::vec4 color;
+			glm::vec4 size;		// xy quad size in world units
+		};
+
+		// quad slots, indexed by handle - removed slots recycle via the
+		// free list so handles stay stable
+		std::vector<Quad> m_quads;
+		std::vector<handle_t> m_freeList;
+
+		// per-draw scratch, reused across frames
+		std::vector<handle_t> m_order;
+		std::vector<QuadInstance> m_instances;
+
+		// instance stream on the persistent-mapped ring - recreated larger
+		// when the quad count outgrows it
+		StorageBuffer m_instanceBuffer;
+		size_t m_instanceCapacity{ 0 };
+
+		GLuint m_vao{ 0 };
+		size_t m_drawCount{ 0 };
+
+		// shared program for every flipbook draw, fetched once
+		res_t<Program> m_program;
+		bool m_programChecked{ false };
+	};
+}
@@ -0,0 +1,143 @@
+#include "EnginePCH.h"
+#include "Font.h"
+
+namespace neu {
+
+	Font::~Font()
+	{
+		if (m_atlas) {
+			GLState::InvalidateTexture(m_atlas);
+			glDeleteTextures(1, &m_atlas);
+		}
+	}
+
+	bool Font::Load(const std::string& filename, float size)
+	{
+		TTF_Font* font = TTF_OpenFont(filename.c_str(), size);
+		if (!font) {
+			LOG_CAT_ERROR(Renderer, "Could not load font {}", filename);
+			return false;
+		}
+
+		m_fontSize = size;
+		m_lineHeight = (float)TTF_GetFontHeight(font);
+		float ascent = (float)TTF_GetFontAscent(font);
+
+		// rasterize each glyph once and record where it will land in the
+		// atlas - rows of line height, wrapping at a fixed atlas width
+		constexpr int kAtlasWidth = 512;
+		constexpr int kPadding = 1;		// keeps linear filtering from bleeding neighbors
+
+		struct Baked {
+			SDL_Surface* surface{ nullptr };
+			glm::ivec2 position{ 0 };
+		};
+		std::vector<Baked> baked(kLastGlyph - kFirstGlyph + 1);
+		m_glyphs.resize(baked.size());
+
+		glm::ivec2 pen{ kPadding, kPadding };
+		int rowHeight = 0;
+		for (int ch = kFirstGlyph; ch <= kLastGlyph; ch++) {
+			int index = ch - kFirstGlyph;
+			auto& glyph = m_glyphs[index];
+
+			int minx = 0, maxx = 0, miny = 0, maxy = 0, advance = 0;
+			TTF_GetGlyphMetrics(font, (Uint32)ch, &minx, &maxx, &miny, &maxy, &advance);
+			glyph.advance = (float)advance;
+
+			// spaces and other blanks carry an advance but no bitmap
+			SDL_Surface* rendered = TTF_RenderGlyph_Blended(font, (Uint32)ch, SDL_Color{ 255, 255, 255, 255 });
+			if (!rendered) continue;
+
+			SDL_Surface* surface = SDL_ConvertSurface(rendered, SDL_PIXELFORMAT_RGBA32);
+			SDL_DestroySurface(rendered);
+			if (!surface) continue;
+
+			if (pen.x + surface->w + kPadding > kAtlasWidth) {
+				pen.x = kPadding;
+				pen.y += rowHeight + kPadding;
+				rowHeight = 0;
+			}
+
+			baked[index].surface = surface;
+			baked[index].position = pen;
+
+			glyph.size = { (float)surface->w, (float)surface->h };
+			// the blended surface spans minx..maxx horizontally; vertically
+			// the pen sits at the line top, so drop by ascent minus the
+			// glyph's rise above the baseline
+			glyph.offset = { (float)minx, ascent - (float)maxy };
+
+			pen.x += surface->w + kPadding;
+			rowHeight = math::max(rowHeight, surface->h);
+		}
+		TTF_CloseFont(font);
+
+		m_atlasSize = { kAtlasWidth, pen.y + rowHeight + kPadding };
+
+		// copy every glyph bitmap into one CPU image and upload it in a
+		// single glTexImage2D - the only texture upload this font ever does
+		std::vector<uint8_t> pixels((size_t)m_atlasSize.x * m_atlasSize.y * 4, 0);
+		for (size_t index = 0; index < baked.size(); index++) {
+			SDL_Surface* surface = baked[index].surface;
+			if (!surface) continue;
+
+			auto& glyph = m_glyphs[index];
+			glm::ivec2 position = baked[index].position;
+			for (int row = 0; row < surface->h; row++) {
+				std::memcpy(
+					pixels.data() + ((size_t)(position.y + row) * m_atlasSize.x + position.x) * 4,
+					(uint8_t*)surface->pixels + (size_t)row * surface->pitch,
+					(size_t)surface->w * 4);
+			}
+
+			glyph.uvRect = {
+				position.x / (float)m_atlasSize.x, position.y / (float)m_atlasSize.y,
+				glyph.size.x / m_atlasSize.x, glyph.size.y / m_atlasSize.y
+			};
+
+			SDL_DestroySurface(surface);
+		}
+
+		glGenTextures(1, &m_atlas);
+		GLState::BindTexture(GL_TEXTURE_2D, m_atlas);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, m_atlasSize.x, m_atlasSize.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+		return true;
+	}
+
+	const Font::Glyph* Font::GetGlyph(char ch) const
+	{
+		if (ch < kFirstGlyph || ch > kLastGlyph) return nullptr;
+		return &m_glyphs[ch - kFirstGlyph];
+	}
+
+	glm::vec2 Font::MeasureText(const std::string& text) const
+	{
+		glm::vec2 size{ 0, text.empty() ? 0.0f : m_lineHeight };
+		float lineWidth = 0;
+		for (char ch : text) {
+			if (ch == '\n') {
+				size.x = math::max(size.x, lineWidth);
+				size.y += m_lineHeight;
+				lineWidth = 0;
+				continue;
+			}
+			if (auto glyph = GetGlyph(ch)) lineWidth += glyph->advance;
+		}
+		size.x = math::max(size.x, lineWidth);
+
+		return size;
+	}
+
+	void Font::UpdateGUI()
+	{
+		ImGui::Text("Size: %.1f (line height %.1f)", m_fontSize, m_lineHeight);
+		ImGui::Text("Atlas: %d x %d", m_atlasSize.x, m_atlasSize.y);
+		ImGui::Separator();
+	}
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "Resources/Resource.h"
+#include "GLState.h"
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <string>
+#include <vector>
+
+namespace neu {
+	// a TTF font baked into a glyph atlas: every printable ASCII glyph is
+	// rasterized once at load into one shared texture, so rendering a string
+	// is a handful of textured quads referencing atlas regions instead of a
+	// TTF surface render and texture upload per string change. Dynamic text
+	// (score counters, timers) only rewrites a small vertex stream - see
+	// Text, which lays out and draws strings against this atlas.
+	class Font : public Resource {
+	public:
+		// one baked glyph - atlas region plus the metrics layout needs
+		struct Glyph {
+			glm::vec4 uvRect{ 0 };		// atlas region (u, v, w, h) in texture space
+			glm::vec2 size{ 0 };		// bitmap size in pixels
+			glm::vec2 offset{ 0 };		// placement relative to the pen, y down from the line top
+			float advance{ 0 };			// horizontal pen advance in pixels
+		};
+
+		Font() = default;
+		~Font();
+
+		// opens the TTF file at the given point size, rasterizes the ASCII
+		// range into the atlas and closes the font - load is the only time
+		// SDL_ttf runs
+		bool Load(const std::string& filename, float size);
+
+		// baked glyph for a character, nullptr outside the ASCII range
+		const Glyph* GetGlyph(char ch) const;
+
+		// pixel size of a laid-out string (tabs/newlines included)
+		glm::vec2 MeasureText(const std::string& text) const;
+
+		float GetLineHeight() const { return m_lineHeight; }
+		float GetFontSize() const { return m_fontSize; }
+		glm::ivec2 GetAtlasSize() const { return m_atlasSize; }
+		GLuint GetAtlasTexture() const { return m_atlas; }
+
+		void SetActive(GLuint unit) { GLState::SetActiveTexture(unit); }
+		void BindAtlas() { GLState::BindTexture(GL_TEXTURE_2D, m_atlas); }
+
+		void UpdateGUI() override;
+
+	private:
+		// printable ASCII - the range baked into the atlas
+		static constexpr int kFirstGlyph = 32;
+		static constexpr int kLastGlyph = 126;
+
+		std::vector<Glyph> m_glyphs;
+		float m_fontSize{ 0 };
+		float m_lineHeight{ 0 };
+
+		GLuint m_atlas{ 0 };
+		glm::ivec2 m_atlasSize{ 0, 0 };
+	};
+}
@@ -0,0 +1,21 @@
+#include "FrameStats.h"
+#include "GLState.h"
+
+namespace neu {
+#ifdef NEU_FRAME_STATS_ENABLED
+
+	void FrameStats::NewFrame()
+	{
+		// GLState::NewFrame has already rolled its counters, so this reads
+		// the issued state changes of the frame just completed
+		s_current.stateChanges = GLState::GetBindsIssued();
+
+		s_last = s_current;
+		s_current = Frame{};
+
+		s_drawHistory[s_historyIndex] = (float)s_last.drawCalls;
+		s_historyIndex = (s_historyIndex + 1) % (int)kHistory;
+	}
+
+#endif
+}
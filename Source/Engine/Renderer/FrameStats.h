@@ -0,0 +1,83 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstdint>
+
+// frame counters compile into debug builds by default; define
+// NEU_FRAME_STATS to keep them in optimized builds (the benchmark
+// harness reports them alongside its timing rows)
+#if defined(_DEBUG) || defined(NEU_FRAME_STATS)
+#define NEU_FRAME_STATS_ENABLED
+#endif
+
+namespace neu {
+	// Counts the render work a frame issues - draw calls, triangles, program
+	// and material binds, texture binds, state changes and buffer upload
+	// bytes. Call sites (VertexBuffer draws, Program::Use, Material::Bind,
+	// the streaming buffer uploads, GLState's issued binds) increment the
+	// running frame; Renderer::Present rolls it into the readable last frame
+	// and a short history for the editor plot. When NEU_FRAME_STATS_ENABLED
+	// is off every increment is an empty inline and the service holds no
+	// state.
+	class FrameStats {
+	public:
+		static constexpr size_t kHistory = 120;
+
+		struct Frame {
+			uint32_t drawCalls{ 0 };
+			uint32_t triangles{ 0 };
+			uint32_t programBinds{ 0 };
+			uint32_t materialBinds{ 0 };
+			uint32_t textureBinds{ 0 };
+			uint32_t stateChanges{ 0 };
+			uint64_t uploadBytes{ 0 };
+		};
+
+		// triangles a draw of vertexCount vertices produces, for the
+		// primitive types the engine draws with - lines and points count zero
+		static uint32_t TriangleCount(GLenum primitiveType, uint32_t vertexCount) {
+			switch (primitiveType) {
+			case GL_TRIANGLES: return vertexCount / 3;
+			case GL_TRIANGLE_STRIP:
+			case GL_TRIANGLE_FAN: return (vertexCount > 2) ? vertexCount - 2 : 0;
+			default: return 0;
+			}
+		}
+
+#ifdef NEU_FRAME_STATS_ENABLED
+		static void AddDraw(uint32_t triangles) { s_current.drawCalls++; s_current.triangles += triangles; }
+		static void AddProgramBind() { s_current.programBinds++; }
+		static void AddMaterialBind() { s_current.materialBinds++; }
+		static void AddTextureBinds(uint32_t count) { s_current.textureBinds += count; }
+		static void AddUpload(uint64_t bytes) { s_current.uploadBytes += bytes; }
+
+		// rolls the running counters into the readable frame and the history
+		// ring - called by Renderer::Present after GLState::NewFrame so the
+		// state change count snapshots the frame just completed
+		static void NewFrame();
+
+		// counters of the last completed frame
+		static const Frame& GetFrame() { return s_last; }
+
+		// draw call history for the editor plot, oldest at GetHistoryIndex
+		static const float* GetDrawHistory() { return s_drawHistory; }
+		static int GetHistoryIndex() { return s_historyIndex; }
+
+	private:
+		inline static Frame s_current;
+		inline static Frame s_last;
+		inline static float s_drawHistory[kHistory]{};
+		inline static int s_historyIndex{ 0 };
+#else
+		// shipping builds keep the API and report nothing
+		static void AddDraw(uint32_t) {}
+		static void AddProgramBind() {}
+		static void AddMaterialBind() {}
+		static void AddTextureBinds(uint32_t) {}
+		static void AddUpload(uint64_t) {}
+		static void NewFrame() {}
+		static const Frame& GetFrame() { static Frame empty; return empty; }
+		static const float* GetDrawHistory() { static float empty[kHistory]{}; return empty; }
+		static int GetHistoryIndex() { return 0; }
+#endif
+	};
+}
@@ -0,0 +1,69 @@
+#include "EnginePCH.h"
+#include "GLDebug.h"
+#include <unordered_map>
+
+namespace neu {
+
+	namespace {
+		// each distinct message id logs a few times then goes quiet - the
+		// interesting ones repeat every frame and would bury everything else
+		constexpr uint32_t kMaxLogsPerId = 4;
+		std::unordered_map<GLuint, uint32_t> s_messageCounts;
+	}
+
+	void GLDebug::Init()
+	{
+		if (!GLAD_GL_VERSION_4_3) return;
+
+		glEnable(GL_DEBUG_OUTPUT);
+		// synchronous delivery keeps the callback on the GL thread, so the
+		// rate-limit map needs no locking
+		glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+		glDebugMessageCallback(OnMessage, nullptr);
+
+		// notifications are chatty and informational, drop them at the source
+		glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);
+	}
+
+	void GLDebug::PushGroup(const char* name)
+	{
+		if (!GLAD_GL_VERSION_4_3) return;
+		glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, -1, name);
+	}
+
+	void GLDebug::PopGroup()
+	{
+		if (!GLAD_GL_VERSION_4_3) return;
+		glPopDebugGroup();
+	}
+
+	void GLDebug::Label(GLenum identifier, GLuint name, const std::string& label)
+	{
+		if (!GLAD_GL_VERSION_4_3 || !name) return;
+		glObjectLabel(identifier, name, (GLsizei)label.size(), label.c_str());
+	}
+
+	void GLAPIENTRY GLDebug::OnMessage(GLenum source, GLenum type, GLuint id, GLenum severity,
+		GLsizei length, const GLchar* message, const void* userParam)
+	{
+		// our own group and label calls echo back through this source
+		if (source == GL_DEBUG_SOURCE_APPLICATION) return;
+
+		// only errors and driver performance findings are worth a line
+		if (type != GL_DEBUG_TYPE_ERROR && type != GL_DEBUG_TYPE_PERFORMANCE) return;
+
+		uint32_t& count = s_messageCounts[id];
+		if (count >= kMaxLogsPerId) return;
+		count++;
+
+		std::string text = (length > 0) ? std::string(message, (size_t)length) : std::string(message);
+		const char* suffix = (count == kMaxLogsPerId) ? " (further reports suppressed)" : "";
+
+		if (type == GL_DEBUG_TYPE_ERROR) {
+			LOG_CAT_ERROR(Renderer, "GL error [{}]: {}{}", id, text, suffix);
+		}
+		else {
+			LOG_CAT_WARNING(Renderer, "GL performance [{}]: {}{}", id, text, suffix);
+		}
+	}
+}
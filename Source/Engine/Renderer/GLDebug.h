@@ -0,0 +1,36 @@
+#pragma once
+#include <glad/glad.h>
+#include <string>
+
+namespace neu {
+	// KHR_debug annotation and driver message surfacing. PushGroup/PopGroup
+	// bracket render passes and per-material batches so GPU captures show a
+	// named hierarchy instead of a flat list of draws, Label names GL objects
+	// after the files they were loaded from, and Init routes the driver's
+	// debug output - GL errors and performance findings - into the Logger,
+	// rate limited per message id so a complaint repeated every frame can't
+	// flood the log. Everything no-ops on contexts older than GL 4.3.
+	class GLDebug {
+	public:
+		// installs the message callback on the current context, called by
+		// the renderer once glad has loaded
+		static void Init();
+
+		static void PushGroup(const char* name);
+		static void PopGroup();
+
+		// human-readable name for a GL object (GL_TEXTURE, GL_PROGRAM,
+		// GL_VERTEX_ARRAY, GL_BUFFER, ...) shown by capture tools
+		static void Label(GLenum identifier, GLuint name, const std::string& label);
+
+		// scoped group for pass-shaped annotation
+		struct Scope {
+			Scope(const char* name) { PushGroup(name); }
+			~Scope() { PopGroup(); }
+		};
+
+	private:
+		static void GLAPIENTRY OnMessage(GLenum source, GLenum type, GLuint id, GLenum severity,
+			GLsizei length, const GLchar* message, const void* userParam);
+	};
+}
@@ -0,0 +1,179 @@
+#include "GLState.h"
+#include "FrameStats.h"
+
+namespace neu {
+
+	void GLState::UseProgram(GLuint program)
+	{
+		if (program == s_program) {
+			s_bindsAvoided++;
+			return;
+		}
+		glUseProgram(program);
+		s_program = program;
+		s_bindsIssued++;
+	}
+
+	void GLState::BindVertexArray(GLuint vao)
+	{
+		if (vao == s_vao) {
+			s_bindsAvoided++;
+			return;
+		}
+		glBindVertexArray(vao);
+		s_vao = vao;
+		s_bindsIssued++;
+	}
+
+	void GLState::SetActiveTexture(GLenum unit)
+	{
+		if (unit == s_activeUnit) {
+			s_bindsAvoided++;
+			return;
+		}
+		glActiveTexture(unit);
+		s_activeUnit = unit;
+		s_bindsIssued++;
+	}
+
+	void GLState::BindTexture(GLenum target, GLuint texture)
+	{
+		// texture bindings are tracked per unit, only cache while the active
+		// unit is known and in range
+		size_t unit = s_activeUnit - GL_TEXTURE0;
+		if (unit < kMaxTextureUnits) {
+			TextureBinding& binding = s_textures[unit];
+			if (binding.target == target && binding.texture == texture) {
+				s_bindsAvoided++;
+				return;
+			}
+			binding.target = target;
+			binding.texture = texture;
+		}
+		glBindTexture(target, texture);
+		s_bindsIssued++;
+		FrameStats::AddTextureBinds(1);
+	}
+
+	void GLState::BindSampler(GLuint unit, GLuint sampler)
+	{
+		if (unit >= kMaxTextureUnits) {
+			glBindSampler(unit, sampler);
+			return;
+		}
+		if (s_samplers[unit] == sampler) {
+			s_bindsAvoided++;
+			return;
+		}
+		glBindSampler(unit, sampler);
+		s_samplers[unit] = sampler;
+		s_bindsIssued++;
+	}
+
+	bool GLState::SupportsDSA()
+	{
+		return GLAD_GL_VERSION_4_5 != 0;
+	}
+
+	void GLState::BindTextures(GLuint firstUnit, GLsizei count, const GLuint* textures)
+	{
+		// whole-run skip when every unit already holds its texture
+		bool dirty = false;
+		for (GLsizei i = 0; i < count; i++) {
+			size_t unit = firstUnit + i;
+			if (unit >= kMaxTextureUnits || s_textures[unit].texture != textures[i]) {
+				dirty = true;
+				break;
+			}
+		}
+		if (!dirty) {
+			s_bindsAvoided++;
+			return;
+		}
+
+		glBindTextures(firstUnit, count, textures);
+		for (GLsizei i = 0; i < count; i++) {
+			size_t unit = firstUnit + i;
+			// the per-name target isn't known here - record target 0 so a
+			// later single-unit bind treats the mismatch as dirty
+			if (unit < kMaxTextureUnits) s_textures[unit] = { 0, textures[i] };
+		}
+		s_bindsIssued++;
+		FrameStats::AddTextureBinds(count);
+	}
+
+	void GLState::SetDepthMask(bool enable)
+	{
+		if ((int)enable == s_depthMask) {
+			s_bindsAvoided++;
+			return;
+		}
+		glDepthMask(enable);
+		s_depthMask = enable;
+		s_bindsIssued++;
+	}
+
+	void GLState::SetCullFace(GLenum mode)
+	{
+		if (mode == s_cullFace) {
+			s_bindsAvoided++;
+			return;
+		}
+		glCullFace(mode);
+		s_cullFace = mode;
+		s_bindsIssued++;
+	}
+
+	void GLState::SetBlend(bool enable)
+	{
+		// enable state only - call sites set the blend func themselves,
+		// it changes with the pass (alpha for transparents, additive for
+		// debug views) and costs nothing against an enabled unit
+		if ((int)enable == s_blend) {
+			s_bindsAvoided++;
+			return;
+		}
+		if (enable) glEnable(GL_BLEND);
+		else glDisable(GL_BLEND);
+		s_blend = enable;
+		s_bindsIssued++;
+	}
+
+	void GLState::InvalidateProgram(GLuint program)
+	{
+		if (s_program == program) s_program = kUnknown;
+	}
+
+	void GLState::InvalidateVertexArray(GLuint vao)
+	{
+		if (s_vao == vao) s_vao = kUnknown;
+	}
+
+	void GLState::InvalidateTexture(GLuint texture)
+	{
+		for (TextureBinding& binding : s_textures) {
+			if (binding.texture == texture) binding = TextureBinding{};
+		}
+	}
+
+	void GLState::Invalidate()
+	{
+		s_program = kUnknown;
+		s_vao = kUnknown;
+		s_activeUnit = 0;
+		for (TextureBinding& binding : s_textures) binding = TextureBinding{};
+		for (GLuint& sampler : s_samplers) sampler = kUnknown;
+		s_depthMask = -1;
+		s_cullFace = 0;
+		s_blend = -1;
+	}
+
+	void GLState::NewFrame()
+	{
+		s_lastBindsAvoided = s_bindsAvoided;
+		s_lastBindsIssued = s_bindsIssued;
+		s_bindsAvoided = 0;
+		s_bindsIssued = 0;
+		Invalidate();
+	}
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstdint>
+
+namespace neu {
+	// Caches the GL binding and raster state the engine touches so redundant
+	// driver calls can be skipped. Engine call sites (Program::Use,
+	// Texture::Bind, VertexBuffer draws, ...) route through here instead of
+	// calling GL directly. The Renderer owns the cache lifecycle - it
+	// invalidates the bindings once per present, since ImGui issues its own
+	// GL calls behind the cache's back.
+	class GLState {
+	public:
+		static void UseProgram(GLuint program);
+		static void BindVertexArray(GLuint vao);
+		static void SetActiveTexture(GLenum unit);
+		static void BindTexture(GLenum target, GLuint texture);
+
+		// GL 4.5 direct state access - object creation and edits that never
+		// touch the bind points, so they can't pollute this cache. The
+		// loader flag is per context, checked at each creation site
+		static bool SupportsDSA();
+
+		// binds a contiguous run of texture units in one glBindTextures
+		// call - each texture attaches to the target it was created with.
+		// DSA-era drivers only; callers gate on SupportsDSA
+		static void BindTextures(GLuint firstUnit, GLsizei count, const GLuint* textures);
+
+		// binds a sampler object to a texture unit (unit index, not
+		// GL_TEXTUREn), tracked like the texture bindings. Sampler 0
+		// restores the texture object's own parameter state - paths that
+		// sample outside the material system bind it before drawing
+		static void BindSampler(GLuint unit, GLuint sampler);
+		static void SetDepthMask(bool enable);
+		static void SetCullFace(GLenum mode);
+		static void SetBlend(bool enable);
+
+		// deleted GL names can be reused by the driver, so resource
+		// destructors clear any cache entries that still reference them
+		static void InvalidateProgram(GLuint program);
+		static void InvalidateVertexArray(GLuint vao);
+		static void InvalidateTexture(GLuint texture);
+
+		// forgets all cached state, forcing the next calls through to GL
+		static void Invalidate();
+
+		// rolls the per-frame counters and invalidates, called by Renderer::Present
+		static void NewFrame();
+
+		// calls skipped / issued over the last completed frame, for tracking
+		// batching regressions
+		static uint32_t GetBindsAvoided() { return s_lastBindsAvoided; }
+		static uint32_t GetBindsIssued() { return s_lastBindsIssued; }
+
+	private:
+		static constexpr GLuint kUnknown = 0xffffffff;
+		static constexpr size_t kMaxTextureUnits = 16;
+
+		struct TextureBinding {
+			GLenum target{ 0 };
+			GLuint texture{ kUnknown };
+		};
+
+		inline static GLuint s_program{ kUnknown };
+		inline static GLuint s_vao{ kUnknown };
+		inline static GLenum s_activeUnit{ 0 }; // 0 = unknown
+		inline static TextureBinding s_textures[kMaxTextureUnits];
+		inline static GLuint s_samplers[kMaxTextureUnits];
+		inline static int s_depthMask{ -1 };    // -1 = unknown
+		inline static GLenum s_cullFace{ 0 };   // 0 = unknown
+		inline static int s_blend{ -1 };        // -1 = unknown
+
+		inline static uint32_t s_bindsAvoided{ 0 };
+		inline static uint32_t s_bindsIssued{ 0 };
+		inline static uint32_t s_lastBindsAvoided{ 0 };
+		inline static uint32_t s_lastBindsIssued{ 0 };
+	};
+}
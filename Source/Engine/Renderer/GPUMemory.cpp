@@ -0,0 +1,132 @@
+#include "EnginePCH.h"
+#include "GPUMemory.h"
+#include "TextureStreamer.h"
+
+// both memory extensions predate core profiles, so older glad headers may
+// not define their tokens - the values are fixed by the extension specs
+#ifndef GL_GPU_MEMORY_INFO_DEDICATED_VIDMEM_NVX
+#define GL_GPU_MEMORY_INFO_DEDICATED_VIDMEM_NVX 0x9047
+#endif
+#ifndef GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX
+#define GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX 0x9049
+#endif
+#ifndef GL_GPU_MEMORY_INFO_EVICTION_COUNT_NVX
+#define GL_GPU_MEMORY_INFO_EVICTION_COUNT_NVX 0x904A
+#endif
+#ifndef GL_GPU_MEMORY_INFO_EVICTED_MEMORY_NVX
+#define GL_GPU_MEMORY_INFO_EVICTED_MEMORY_NVX 0x904B
+#endif
+#ifndef GL_TEXTURE_FREE_MEMORY_ATI
+#define GL_TEXTURE_FREE_MEMORY_ATI 0x87FC
+#endif
+
+namespace neu {
+	namespace {
+		enum class DriverExtension { None, NVX, ATI };
+		DriverExtension driverExtension = DriverExtension::None;
+
+		// driver queries are glGetIntegerv round trips - once a second is
+		// plenty for a number that moves at streaming speed
+		constexpr int kSampleIntervalFrames = 60;
+		int framesUntilSample = 0;
+
+		// streaming never shrinks below this no matter how tight the card
+		// is - below it the scene is sampling placeholder-quality mips anyway
+		constexpr uint64_t kMinStreamingBudget = 64ull << 20;
+	}
+
+	const char* GPUMemory::TypeName(Type type) {
+		switch (type) {
+		case Type::Texture:			return "Texture";
+		case Type::RenderTarget:	return "RenderTarget";
+		case Type::Geometry:		return "Geometry";
+		case Type::Buffer:			return "Buffer";
+		default:					return "Unknown";
+		}
+	}
+
+	uint64_t GPUMemory::GetTotalBytes() {
+		uint64_t total = 0;
+		for (int type = 0; type < (int)Type::Count; type++) total += s_bytes[type];
+		return total;
+	}
+
+	void GPUMemory::Init() {
+		// vendor extensions, probed the same way the bindless support is
+		if (SDL_GL_ExtensionSupported("GL_NVX_gpu_memory_info")) {
+			driverExtension = DriverExtension::NVX;
+
+			GLint dedicated = 0;
+			glGetIntegerv(GL_GPU_MEMORY_INFO_DEDICATED_VIDMEM_NVX, &dedicated);
+			s_driver.totalBytes = (uint64_t)dedicated << 10;
+			s_driver.available = true;
+		}
+		else if (SDL_GL_ExtensionSupported("GL_ATI_meminfo")) {
+			driverExtension = DriverExtension::ATI;
+			s_driver.available = true;
+		}
+
+		if (!s_driver.available) {
+			LOG_CAT_INFO(Renderer, "No driver memory extension - GPU budget runs on engine accounting only");
+			return;
+		}
+
+		// first sample now; ATI has no total query, so the free pool at
+		// startup stands in for it
+		framesUntilSample = 0;
+		Update();
+		if (driverExtension == DriverExtension::ATI) s_driver.totalBytes = s_driver.freeBytes;
+
+		LOG_CAT_INFO(Renderer, "GPU memory: {} MB total, {} MB free",
+			s_driver.totalBytes >> 20, s_driver.freeBytes >> 20);
+	}
+
+	void GPUMemory::Update() {
+		if (!s_driver.available) return;
+		if (framesUntilSample-- > 0) return;
+		framesUntilSample = kSampleIntervalFrames;
+
+		if (driverExtension == DriverExtension::NVX) {
+			// all NVX values are reported in kilobytes
+			GLint free = 0, evictions = 0, evicted = 0;
+			glGetIntegerv(GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX, &free);
+			glGetIntegerv(GL_GPU_MEMORY_INFO_EVICTION_COUNT_NVX, &evictions);
+			glGetIntegerv(GL_GPU_MEMORY_INFO_EVICTED_MEMORY_NVX, &evicted);
+			s_driver.freeBytes = (uint64_t)free << 10;
+			s_driver.evictionCount = (uint32_t)evictions;
+			s_driver.evictedBytes = (uint64_t)evicted << 10;
+		}
+		else {
+			// four values per pool; [0] is the total free memory in kilobytes
+			GLint free[4]{};
+			glGetIntegerv(GL_TEXTURE_FREE_MEMORY_ATI, free);
+			s_driver.freeBytes = (uint64_t)free[0] << 10;
+		}
+
+		// hand the streamer everything above the pressure floor: resident
+		// mips it already holds plus the headroom still free. When the
+		// floor is breached the budget drops below residency and the
+		// streamer's next update evicts back under it - oversubscription
+		// self-corrects instead of just showing up on the panel
+		TextureStreamer& streamer = TextureStreamer::Instance();
+		if (!streamer.IsAutoBudget()) return;
+
+		uint64_t floor = GetPressureFloor();
+		uint64_t resident = streamer.GetResidentBytes();
+		uint64_t budget = (s_driver.freeBytes > floor)
+			? resident + (s_driver.freeBytes - floor)
+			: resident - math::min(resident, floor - s_driver.freeBytes);
+		streamer.SetBudget((size_t)math::max(budget, kMinStreamingBudget));
+	}
+
+	uint64_t GPUMemory::GetPressureFloor() {
+		// a tenth of the card, but never less than 256 MB - compositors and
+		// capture tools eat into small cards disproportionately
+		return math::max(s_driver.totalBytes / 10, 256ull << 20);
+	}
+
+	bool GPUMemory::IsUnderPressure() {
+		if (!s_driver.available) return false;
+		return s_driver.freeBytes < GetPressureFloor() || s_driver.evictedBytes > 0;
+	}
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+namespace neu {
+	// Byte accounting for the engine's GPU allocations plus the driver's own
+	// memory report. Creation sites (Texture uploads, render target storage,
+	// arena pages and own buffers, persistent uniform/storage stores) call
+	// Track/Untrack with the bytes they requested; the driver side polls
+	// GL_NVX_gpu_memory_info or GL_ATI_meminfo where the driver exposes one.
+	// Unlike the CPU-side MemoryTracker this stays in every build - the
+	// driver headroom feeds the texture streaming budget, so shipping builds
+	// need the numbers too. All GL allocation happens on the main thread, so
+	// the counters are plain integers.
+	class GPUMemory {
+	public:
+		// allocation type a creation site accounts against - keep in sync
+		// with TypeName()
+		enum class Type : uint8_t {
+			Texture,		// sampled textures: image uploads and resident cooked mips
+			RenderTarget,	// render texture color storage and depth renderbuffers
+			Geometry,		// vertex/index data: arena pages and own mesh buffers
+			Buffer,			// uniform, storage, instance and streaming buffers
+
+			Count
+		};
+
+		static const char* TypeName(Type type);
+
+		static void Track(Type type, size_t bytes) { s_bytes[(int)type] += bytes; }
+		static void Untrack(Type type, size_t bytes) { s_bytes[(int)type] -= bytes; }
+
+		static uint64_t GetBytes(Type type) { return s_bytes[(int)type]; }
+		static uint64_t GetTotalBytes();
+
+		// the driver's view of video memory - only trustworthy when
+		// available is set (NVIDIA and AMD expose it, Intel and core-profile
+		// drivers generally don't)
+		struct DriverInfo {
+			bool available{ false };
+			uint64_t totalBytes{ 0 };		// dedicated VRAM (ATI reports the free pool at startup instead)
+			uint64_t freeBytes{ 0 };		// currently allocatable
+			uint32_t evictionCount{ 0 };	// allocations the driver paged out to system memory (NVX only)
+			uint64_t evictedBytes{ 0 };		// bytes currently evicted (NVX only)
+		};
+
+		// probes the driver memory extensions and takes the first sample -
+		// called once by the renderer after context creation
+		static void Init();
+
+		// re-samples the driver report at ~1s intervals and, when the
+		// streamer's auto budget is on, re-derives the texture streaming
+		// budget from the free headroom - called once per engine update
+		static void Update();
+
+		static const DriverInfo& GetDriverInfo() { return s_driver; }
+
+		// free memory the budget feed refuses to hand to streaming - the
+		// driver needs working room and other applications share the card
+		static uint64_t GetPressureFloor();
+
+		// true while driver-reported free memory sits below the pressure
+		// floor, or the driver has evicted allocations this session - the
+		// editor shows the warning and streaming is already pulling back
+		static bool IsUnderPressure();
+
+	private:
+		inline static uint64_t s_bytes[(int)Type::Count]{};
+		inline static DriverInfo s_driver;
+	};
+}
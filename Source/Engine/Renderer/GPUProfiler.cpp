@@ -0,0 +1,72 @@
+#include "GPUProfiler.h"
+
+namespace neu {
+
+	GPUProfiler::Scope& GPUProfiler::FindScope(const char* name)
+	{
+		for (auto& scope : s_scopes) {
+			if (scope.name == name) return scope;
+		}
+
+		Scope scope;
+		scope.name = name;
+		glGenQueries(2, scope.queries[0]);
+		glGenQueries(2, scope.queries[1]);
+		s_scopes.push_back(scope);
+
+		return s_scopes.back();
+	}
+
+	void GPUProfiler::BeginScope(const char* name)
+	{
+		Scope& scope = FindScope(name);
+		scope.depth = s_stackDepth;
+
+		glQueryCounter(scope.queries[s_write][0], GL_TIMESTAMP);
+		scope.cpuStart = std::chrono::high_resolution_clock::now();
+
+		if (s_stackDepth < (int)std::size(s_stack)) {
+			s_stack[s_stackDepth] = (int)(&scope - s_scopes.data());
+		}
+		s_stackDepth++;
+	}
+
+	void GPUProfiler::EndScope()
+	{
+		if (s_stackDepth <= 0) return;
+		s_stackDepth--;
+		if (s_stackDepth >= (int)std::size(s_stack)) return;
+
+		Scope& scope = s_scopes[s_stack[s_stackDepth]];
+
+		glQueryCounter(scope.queries[s_write][1], GL_TIMESTAMP);
+		scope.issued[s_write] = true;
+		scope.cpuMs = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - scope.cpuStart).count();
+	}
+
+	void GPUProfiler::NewFrame()
+	{
+		// flip to the buffer whose queries were issued two frames ago and
+		// harvest it before reuse, by now the results are available
+		s_write = s_write ^ 1;
+
+		for (auto& scope : s_scopes) {
+			if (scope.issued[s_write]) {
+				GLuint available = 0;
+				glGetQueryObjectuiv(scope.queries[s_write][1], GL_QUERY_RESULT_AVAILABLE, &available);
+				if (available) {
+					GLuint64 begin = 0;
+					GLuint64 end = 0;
+					glGetQueryObjectui64v(scope.queries[s_write][0], GL_QUERY_RESULT, &begin);
+					glGetQueryObjectui64v(scope.queries[s_write][1], GL_QUERY_RESULT, &end);
+					scope.gpuMs = (float)((end - begin) * 1e-6);
+				}
+				scope.issued[s_write] = false;
+			}
+
+			scope.gpuHistory[scope.historyIndex] = scope.gpuMs;
+			scope.cpuHistory[scope.historyIndex] = scope.cpuMs;
+			scope.historyIndex = (scope.historyIndex + 1) % kHistory;
+		}
+	}
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <glad/glad.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace neu {
+	// Scoped GPU timing built on GL_TIMESTAMP queries. Each scope owns a
+	// double-buffered begin/end query pair - NewFrame harvests a buffer two
+	// frames after its queries were issued, so reading the results never
+	// stalls on the driver. A matching CPU timer runs over the same scope for
+	// comparison. The editor Profiler panel graphs the per-scope history.
+	class GPUProfiler {
+	public:
+		static constexpr size_t kHistory = 120;
+
+		struct Scope {
+			std::string name;
+			GLuint queries[2][2]{};	// [buffer][begin/end]
+			bool issued[2]{};
+
+			std::chrono::high_resolution_clock::time_point cpuStart;
+			float cpuMs{ 0 };
+			float gpuMs{ 0 };
+
+			// nesting depth at BeginScope - 0 for top-level pass scopes
+			int depth{ 0 };
+
+			float gpuHistory[kHistory]{};
+			float cpuHistory[kHistory]{};
+			int historyIndex{ 0 };
+		};
+
+	public:
+		static void BeginScope(const char* name);
+		static void EndScope();
+
+		// harvests the query buffer about to be reused and rolls the history
+		// buffers, called by Renderer::Present
+		static void NewFrame();
+
+		static const std::vector<Scope>& GetScopes() { return s_scopes; }
+
+		// harvested GPU time of the last completed frame, summed over the
+		// top-level scopes - feeds the renderer's dynamic resolution
+		// controller
+		static float GetFrameMs() {
+			float ms = 0;
+			for (auto& scope : s_scopes) {
+				if (scope.depth == 0) ms += scope.gpuMs;
+			}
+			return ms;
+		}
+
+	private:
+		static Scope& FindScope(const char* name);
+
+		inline static std::vector<Scope> s_scopes;
+		inline static int s_stack[8]{};
+		inline static int s_stackDepth{ 0 };
+		inline static int s_write{ 0 };
+	};
+}
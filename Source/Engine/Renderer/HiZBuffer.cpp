@@ -0,0 +1,159 @@
+#include "HiZBuffer.h"
+
+namespace neu {
+	HiZBuffer::~HiZBuffer() {
+		if (m_fbo) glDeleteFramebuffers(1, &m_fbo);
+		if (m_depthBuffer) glDeleteRenderbuffers(1, &m_depthBuffer);
+		if (m_readbacks[0]) glDeleteBuffers(2, m_readbacks);
+	}
+
+	void HiZBuffer::Capture(GLuint sourceFbo, const glm::ivec2& sourceSize, const glm::mat4& viewProjection) {
+		m_culled = 0;
+		m_tested = 0;
+
+		if (!m_enabled) {
+			// drop stale state so re-enabling starts from fresh captures
+			m_valid = false;
+			m_issued[0] = m_issued[1] = false;
+			return;
+		}
+
+		if (!m_fbo) {
+			glGenFramebuffers(1, &m_fbo);
+			glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
+
+			glGenRenderbuffers(1, &m_depthBuffer);
+			glBindRenderbuffer(GL_RENDERBUFFER, m_depthBuffer);
+			glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, kSize, kSize);
+			glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, m_depthBuffer);
+			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+			glGenBuffers(2, m_readbacks);
+			for (int i = 0; i < 2; i++) {
+				glBindBuffer(GL_PIXEL_PACK_BUFFER, m_readbacks[i]);
+				glBufferData(GL_PIXEL_PACK_BUFFER, kSize * kSize * sizeof(float), nullptr, GL_STREAM_READ);
+			}
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		}
+
+		// harvest the readback issued last frame before its buffer is
+		// reused - by now the transfer has retired, so the map is free
+		int read = m_cursor ^ 1;
+		if (m_issued[read]) {
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, m_readbacks[read]);
+			float* depths = (float*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, kSize * kSize * sizeof(float), GL_MAP_READ_BIT);
+			if (depths) {
+				BuildPyramid(depths);
+				m_viewProjection = m_pendingVP[read];
+				m_valid = true;
+				glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+			}
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+			m_issued[read] = false;
+		}
+
+		// downsample the fresh pass depth and kick its async readback
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, sourceFbo);
+		glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_fbo);
+		glBlitFramebuffer(
+			0, 0, sourceSize.x, sourceSize.y,
+			0, 0, kSize, kSize,
+			GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, m_fbo);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, m_readbacks[m_cursor]);
+		glReadPixels(0, 0, kSize, kSize, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+		m_pendingVP[m_cursor] = viewProjection;
+		m_issued[m_cursor] = true;
+		m_cursor ^= 1;
+	}
+
+	void HiZBuffer::BuildPyramid(const float* depths) {
+		m_pyramid[0].assign(depths, depths + kSize * kSize);
+
+		int size = kSize;
+		for (int level = 1; level < kLevels; level++) {
+			int parentSize = size;
+			size = math::max(size / 2, 1);
+			m_pyramid[level].resize((size_t)size * size);
+
+			// each texel keeps the farthest depth of its 2x2 children, so
+			// a coarse texel never claims more occlusion than exists
+			for (int y = 0; y < size; y++) {
+				for (int x = 0; x < size; x++) {
+					const float* parent = m_pyramid[level - 1].data();
+					float d0 = parent[(y * 2) * parentSize + (x * 2)];
+					float d1 = parent[(y * 2) * parentSize + math::min(x * 2 + 1, parentSize - 1)];
+					float d2 = parent[math::min(y * 2 + 1, parentSize - 1) * parentSize + (x * 2)];
+					float d3 = parent[math::min(y * 2 + 1, parentSize - 1) * parentSize + math::min(x * 2 + 1, parentSize - 1)];
+					m_pyramid[level][(size_t)y * size + x] = math::max(math::max(d0, d1), math::max(d2, d3));
+				}
+			}
+		}
+	}
+
+	bool HiZBuffer::IsOccluded(const Bounds& bounds) {
+		if (!m_enabled || !m_valid || !bounds.valid) return false;
+		m_tested++;
+
+		// project the eight corners with the view-projection the pyramid's
+		// depth was rendered with - not this frame's camera
+		glm::vec2 minNdc{ 1.0f };
+		glm::vec2 maxNdc{ -1.0f };
+		float minDepth = 1.0f;
+		for (int i = 0; i < 8; i++) {
+			glm::vec3 corner{
+				(i & 1) ? bounds.max.x : bounds.min.x,
+				(i & 2) ? bounds.max.y : bounds.min.y,
+				(i & 4) ? bounds.max.z : bounds.min.z
+			};
+
+			glm::vec4 clip = m_viewProjection * glm::vec4(corner, 1);
+			// a corner at or behind the near plane can't be depth-tested
+			if (clip.w <= 0.0f) return false;
+
+			glm::vec3 ndc = glm::vec3(clip) / clip.w;
+			minNdc = glm::min(minNdc, glm::vec2(ndc));
+			maxNdc = glm::max(maxNdc, glm::vec2(ndc));
+			minDepth = math::min(minDepth, ndc.z * 0.5f + 0.5f);
+		}
+
+		// footprint in base-grid texels, clamped to the screen
+		float minX = math::clamp(minNdc.x * 0.5f + 0.5f, 0.0f, 1.0f) * kSize;
+		float maxX = math::clamp(maxNdc.x * 0.5f + 0.5f, 0.0f, 1.0f) * kSize;
+		float minY = math::clamp(minNdc.y * 0.5f + 0.5f, 0.0f, 1.0f) * kSize;
+		float maxY = math::clamp(maxNdc.y * 0.5f + 0.5f, 0.0f, 1.0f) * kSize;
+
+		// walk up until the footprint covers at most 2x2 texels at the
+		// chosen level, so the test below reads a handful of values
+		int level = 0;
+		while (level < kLevels - 1 &&
+			((maxX - minX) / (1 << level) > 2.0f || (maxY - minY) / (1 << level) > 2.0f)) {
+			level++;
+		}
+
+		// max depth over the covering texels, dilated a texel outward to
+		// absorb the point-subsampled base grid
+		int levelSize = math::max(kSize >> level, 1);
+		int x0 = math::max((int)(minX / (1 << level)) - 1, 0);
+		int x1 = math::min((int)(maxX / (1 << level)) + 1, levelSize - 1);
+		int y0 = math::max((int)(minY / (1 << level)) - 1, 0);
+		int y1 = math::min((int)(maxY / (1 << level)) + 1, levelSize - 1);
+
+		float maxOccluderDepth = 0.0f;
+		for (int y = y0; y <= y1; y++) {
+			for (int x = x0; x <= x1; x++) {
+				maxOccluderDepth = math::max(maxOccluderDepth, m_pyramid[level][(size_t)y * levelSize + x]);
+			}
+		}
+
+		if (minDepth > maxOccluderDepth) {
+			m_culled++;
+			return true;
+		}
+		return false;
+	}
+}
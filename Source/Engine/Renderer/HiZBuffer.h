@@ -0,0 +1,69 @@
+#pragma once
+#include "Math/Bounds.h"
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace neu {
+	// Hierarchical-Z occlusion buffer fed by the previous frame's depth.
+	//
+	// Capture blits the pass depth down to a small grid and kicks an async
+	// PBO readback; the readback issued the frame before is harvested at
+	// the same time and folded into a CPU max-depth pyramid, together with
+	// the view-projection it was rendered with. RecordPass then tests
+	// visible bounds against the pyramid before submission - an object
+	// whose nearest point is behind the farthest depth in its screen
+	// footprint was hidden last frame and is skipped this one.
+	//
+	// The readback pipeline is two frames deep so it never stalls on the
+	// driver. The base grid is point-subsampled from the full depth
+	// buffer, and the test dilates its footprint by a texel to absorb
+	// that; fast disocclusions still draw one frame late, the usual
+	// temporal-culling trade
+	class HiZBuffer {
+	public:
+		~HiZBuffer();
+
+		void SetEnabled(bool enabled) { m_enabled = enabled; }
+		bool IsEnabled() const { return m_enabled; }
+
+		// records the depth of the pass that just drew and harvests last
+		// frame's readback into the pyramid - GL thread, once per frame
+		void Capture(GLuint sourceFbo, const glm::ivec2& sourceSize, const glm::mat4& viewProjection);
+
+		// true when the bounds were behind last frame's depth everywhere in
+		// their footprint; false until two captures have completed
+		bool IsOccluded(const Bounds& bounds);
+
+		// rolls the per-frame cull counters, called from Capture
+		int GetCulledCount() const { return m_culled; }
+		int GetTestedCount() const { return m_tested; }
+
+	private:
+		void BuildPyramid(const float* depths);
+
+		// 64x64 base grid, max-reduced down to 1x1
+		static constexpr int kSize = 64;
+		static constexpr int kLevels = 7;
+
+		bool m_enabled{ false };
+		bool m_valid{ false };
+
+		// small depth target the pass depth is blitted into, plus a two
+		// deep pixel-pack ring for the stall-free readback
+		GLuint m_fbo{ 0 };
+		GLuint m_depthBuffer{ 0 };
+		GLuint m_readbacks[2]{};
+		bool m_issued[2]{};
+		glm::mat4 m_pendingVP[2]{};
+		int m_cursor{ 0 };
+
+		// CPU pyramid - level 0 is the readback grid, each level above
+		// holds the max (farthest) depth of its 2x2 children
+		std::vector<float> m_pyramid[kLevels];
+		glm::mat4 m_viewProjection{ 1 };
+
+		int m_culled{ 0 };
+		int m_tested{ 0 };
+	};
+}
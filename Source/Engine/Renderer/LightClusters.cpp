@@ -0,0 +1,145 @@
+#include "LightClusters.h"
+#include "RenderQueue.h"
+#include "Components/LightComponent.h"
+#include "Components/CameraComponent.h"
+
+namespace neu {
+	LightClusters::~LightClusters() {
+		if (m_buffers[0]) glDeleteBuffers(3, m_buffers);
+	}
+
+	void LightClusters::Build(RenderPass& pass, const frame_vector<LightComponent*>& lights, const CameraComponent& camera)
+	{
+		if (lights.empty()) return;
+
+		PROFILE_SCOPE("LightClusters::Build");
+
+		const glm::mat4& view = camera.view;
+		float near = camera.near;
+		float far = camera.far;
+
+		// view-space light records - unlike the uniform block these are not
+		// capped, the cluster lists keep the per-fragment cost bounded
+		pass.clusterLights.reserve(lights.size());
+		for (auto light : lights) {
+			ClusterLight data;
+			glm::vec3 position = glm::vec3(view * glm::vec4(light->owner->transform.position, 1));
+			glm::vec3 direction = glm::normalize(glm::mat3(view) * light->owner->transform.Forward());
+
+			data.positionRange = { position, light->range };
+			data.directionIntensity = { direction, light->intensity };
+			data.colorType = { light->color, (float)light->lightType };
+			data.spot = { glm::radians(light->innerSpotAngle), glm::radians(light->outerSpotAngle), light->shadowCaster ? 1.0f : 0.0f, 0.0f };
+			pass.clusterLights.push_back(data);
+		}
+
+		// conservative cluster index range per light from its bounding
+		// sphere - tiles from the projected view-space box, slices from the
+		// logarithmic depth distribution (mirrored in the shaders)
+		struct Range { int x0, x1, y0, y1, z0, z1; };
+		frame_vector<Range> ranges;
+		ranges.reserve(pass.clusterLights.size());
+
+		float logScale = kSlicesZ / std::log(far / near);
+
+		for (const ClusterLight& light : pass.clusterLights) {
+			// directional lights reach every cluster
+			Range range{ 0, kTilesX - 1, 0, kTilesY - 1, 0, kSlicesZ - 1 };
+
+			if ((int)light.colorType.w != LightComponent::Directional) {
+				glm::vec3 position = glm::vec3(light.positionRange);
+				float radius = light.positionRange.w;
+
+				// view depth extent of the sphere - entirely outside the
+				// near/far range means no cluster sees the light
+				float depthNear = -position.z - radius;
+				float depthFar = -position.z + radius;
+				if (depthFar <= near || depthNear >= far) {
+					range = { 1, 0, 1, 0, 1, 0 };
+					ranges.push_back(range);
+					continue;
+				}
+
+				range.z0 = math::clamp((int)(std::log(math::max(depthNear, near) / near) * logScale), 0, kSlicesZ - 1);
+				range.z1 = math::clamp((int)(std::log(math::min(depthFar, far) / near) * logScale), 0, kSlicesZ - 1);
+
+				// screen tiles from the projected corners of the sphere's
+				// view-space box - a sphere crossing the near plane has no
+				// stable projection and covers the full screen
+				if (depthNear > near) {
+					glm::vec2 minNdc{ 1, 1 };
+					glm::vec2 maxNdc{ -1, -1 };
+					for (int corner = 0; corner < 8; corner++) {
+						glm::vec3 offset{
+							(corner & 1) ? radius : -radius,
+							(corner & 2) ? radius : -radius,
+							(corner & 4) ? radius : -radius };
+						glm::vec4 clip = camera.projection * glm::vec4(position + offset, 1);
+						glm::vec2 ndc = glm::vec2(clip) / clip.w;
+						minNdc = glm::min(minNdc, ndc);
+						maxNdc = glm::max(maxNdc, ndc);
+					}
+
+					range.x0 = math::clamp((int)((minNdc.x * 0.5f + 0.5f) * kTilesX), 0, kTilesX - 1);
+					range.x1 = math::clamp((int)((maxNdc.x * 0.5f + 0.5f) * kTilesX), 0, kTilesX - 1);
+					range.y0 = math::clamp((int)((minNdc.y * 0.5f + 0.5f) * kTilesY), 0, kTilesY - 1);
+					range.y1 = math::clamp((int)((maxNdc.y * 0.5f + 0.5f) * kTilesY), 0, kTilesY - 1);
+				}
+			}
+
+			ranges.push_back(range);
+		}
+
+		// counting pass, then prefix sums become the cluster offsets and the
+		// second walk packs the flattened index list
+		frame_vector<uint32_t> counts(kClusterCount, 0);
+		for (const Range& range : ranges) {
+			for (int z = range.z0; z <= range.z1; z++)
+				for (int y = range.y0; y <= range.y1; y++)
+					for (int x = range.x0; x <= range.x1; x++)
+						counts[(z * kTilesY + y) * kTilesX + x]++;
+		}
+
+		pass.clusterRanges.resize(kClusterCount);
+		uint32_t offset = 0;
+		for (int cluster = 0; cluster < kClusterCount; cluster++) {
+			pass.clusterRanges[cluster] = { offset, 0 };
+			offset += counts[cluster];
+		}
+
+		// the range's count doubles as the fill cursor and lands on the
+		// final per-cluster count
+		pass.clusterIndices.resize(offset);
+		for (uint32_t index = 0; index < (uint32_t)ranges.size(); index++) {
+			const Range& range = ranges[index];
+			for (int z = range.z0; z <= range.z1; z++)
+				for (int y = range.y0; y <= range.y1; y++)
+					for (int x = range.x0; x <= range.x1; x++) {
+						glm::uvec2& cluster = pass.clusterRanges[(z * kTilesY + y) * kTilesX + x];
+						pass.clusterIndices[cluster.x + cluster.y++] = index;
+					}
+		}
+	}
+
+	void LightClusters::Upload(const RenderPass& pass)
+	{
+		if (!m_buffers[0]) glGenBuffers(3, m_buffers);
+
+		// stream-orphaned each upload - the sizes change frame to frame and
+		// the driver renames the storage instead of syncing with in-flight
+		// reads, which keeps this a straight memcpy per pass
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_buffers[0]);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, pass.clusterLights.size() * sizeof(ClusterLight), pass.clusterLights.data(), GL_STREAM_DRAW);
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, lightDataBinding, m_buffers[0]);
+
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_buffers[1]);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, pass.clusterRanges.size() * sizeof(glm::uvec2), pass.clusterRanges.data(), GL_STREAM_DRAW);
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, clusterGridBinding, m_buffers[1]);
+
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_buffers[2]);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, pass.clusterIndices.size() * sizeof(uint32_t), pass.clusterIndices.data(), GL_STREAM_DRAW);
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, lightIndexBinding, m_buffers[2]);
+
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+	}
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "Core/FrameArena.h"
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+namespace neu {
+	class LightComponent;
+	class CameraComponent;
+	struct RenderPass;
+
+	// one view-space light as the clustered shaders read it (std430,
+	// everything packed into vec4s)
+	struct ClusterLight {
+		glm::vec4 positionRange;        // xyz view-space position, w range
+		glm::vec4 directionIntensity;   // xyz view-space direction, w intensity
+		glm::vec4 colorType;            // rgb color, w light type
+		glm::vec4 spot;                 // x/y inner/outer spot angle, z shadow caster
+	};
+
+	/// <summary>
+	/// Clustered forward lighting. The camera frustum is divided into a
+	/// froxel grid (screen tiles x logarithmic depth slices); each frame
+	/// the record phase bins every light into the clusters its bounding
+	/// sphere crosses, and playback uploads the light data, per-cluster
+	/// ranges and flattened index list as SSBOs. Shaders declaring the
+	/// cluster blocks shade only the lights crossing their fragment's
+	/// cluster, so light count no longer multiplies with pixels - the
+	/// uniform-block path and its light cap remain for older programs.
+	/// </summary>
+	class LightClusters {
+	public:
+		// froxel grid dimensions, mirrored as constants in the shaders
+		static constexpr int kTilesX = 16;
+		static constexpr int kTilesY = 9;
+		static constexpr int kSlicesZ = 24;
+		static constexpr int kClusterCount = kTilesX * kTilesY * kSlicesZ;
+
+		// SSBO binding points, after the camera/light uniform blocks
+		static constexpr GLuint lightDataBinding = 2;
+		static constexpr GLuint clusterGridBinding = 3;
+		static constexpr GLuint lightIndexBinding = 4;
+
+		~LightClusters();
+
+		/// <summary>
+		/// Bins the lights into the pass camera's froxel grid. GL-free, so
+		/// it runs on the record side (job system worker included): each
+		/// light's bounding sphere maps to a conservative tile/slice range,
+		/// then a counting pass packs the per-cluster index lists into the
+		/// pass's flat arrays.
+		/// </summary>
+		static void Build(RenderPass& pass, const frame_vector<LightComponent*>& lights, const CameraComponent& camera);
+
+		/// <summary>
+		/// Uploads the pass's binned light set and binds the SSBOs. Called
+		/// at playback on the context thread, once per clustered pass.
+		/// </summary>
+		void Upload(const RenderPass& pass);
+
+	private:
+		// light data / cluster grid / light index buffers, stream-orphaned
+		// per upload since the counts change frame to frame
+		GLuint m_buffers[3]{};
+	};
+}
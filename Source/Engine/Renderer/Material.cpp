@@ -1,124 +1,482 @@
 #pragma once
 #include "Material.h"
 #include "Program.h"
+#include "SamplerCache.h"
 #include "Resources/ResourceManager.h"
+#include "Resources/ContentBudgets.h"
+#include <bit>
+
+namespace {
+	// std140 mirror of the shader-side MaterialBlock - the vec3s pad to 16
+	// bytes, so the scalars pack into their pad slots
+	struct MaterialBlockData {
+		glm::vec3 baseColor; float shininess;
+		glm::vec3 emissiveColor; float ior;
+		glm::vec2 tiling; glm::vec2 offset;
+		uint32_t parameters; uint32_t pad[3];
+	};
+
+	// every material's block lives as one slice of this shared UBO, written
+	// at load and on editor edits - switching materials in the draw loop
+	// costs one glBindBufferRange instead of six uniform uploads. Slices
+	// are spaced to the driver's bind-offset alignment
+	constexpr int kMaxMaterialBlocks = 1024;
+	GLuint materialBlockBuffer = 0;
+	GLsizeiptr materialBlockStride = 0;
+	int materialBlockCount = 0;
+
+	int AcquireBlockSlot() {
+		if (!materialBlockBuffer) {
+			GLint alignment = 1;
+			glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+			materialBlockStride = (sizeof(MaterialBlockData) + alignment - 1) / alignment * alignment;
+
+			glGenBuffers(1, &materialBlockBuffer);
+			glBindBuffer(GL_UNIFORM_BUFFER, materialBlockBuffer);
+			glBufferData(GL_UNIFORM_BUFFER, materialBlockStride * kMaxMaterialBlocks, nullptr, GL_DYNAMIC_DRAW);
+			glBindBuffer(GL_UNIFORM_BUFFER, 0);
+		}
+
+		if (materialBlockCount >= kMaxMaterialBlocks) return -1;
+		return materialBlockCount++;
+	}
+}
 
 namespace neu {
 	bool Material::Load(const std::string& filename) {
-		// load material document
-		serial::document_t document;
-		if (!serial::Load(filename, document)) {
-			LOG_WARNING("Could not load program file: {}", filename);
+		// load material document through the shared parse cache - an async
+		// load's worker prefetch already parsed it, so this is a lookup
+		auto document = Resources().GetDocument(filename);
+		if (!document) {
+			LOG_CAT_WARNING(Renderer, "Could not load material file: {}", filename);
 			return false;
 		}
-		//program
+		//program - fetched after the maps below, which select its variant
 		std::string programName;
-		SERIAL_READ_NAME(document, "program", programName);
-
-		program = Resources().Get<Program>(programName);
+		SERIAL_READ_NAME(*document, "program", programName);
 
 		//texture
 		std::string textureName;
-		SERIAL_READ_NAME(document, "baseMap", textureName);
+		SERIAL_READ_NAME(*document, "baseMap", textureName);
 
 		baseMap = Resources().Get<Texture>(textureName);
 
 		//specular
 		std::string specularName;
-		SERIAL_READ_NAME(document, "specularMap", specularName);
+		SERIAL_READ_NAME(*document, "specularMap", specularName);
 
 		if(!specularName.empty()) specularMap = Resources().Get<Texture>(specularName);
 
 		//emissive
 		std::string emissiveName;
-		SERIAL_READ_NAME(document, "emissiveMap", emissiveName);
+		SERIAL_READ_NAME(*document, "emissiveMap", emissiveName);
 
 		if(!emissiveName.empty()) emissiveMap = Resources().Get<Texture>(emissiveName);
 
 		//normals
 		std::string normalName;
-		SERIAL_READ_NAME(document, "normalMap", normalName);
+		SERIAL_READ_NAME(*document, "normalMap", normalName);
 
 		if(!normalName.empty()) normalMap = Resources().Get<Texture>(normalName);
 
 		//cubemap
 		std::string cubeMapName;
-		SERIAL_READ_NAME(document, "cubeMap", cubeMapName);
+		SERIAL_READ_NAME(*document, "cubeMap", cubeMapName);
 
 		if(!cubeMapName.empty()) cubeMap = Resources().Get<CubeMap>(cubeMapName);
 
 		//shadowmap
 		std::string shadowMapName;
-		SERIAL_READ_NAME(document, "shadowMap", shadowMapName);
+		SERIAL_READ_NAME(*document, "shadowMap", shadowMapName);
 
 		if(!shadowMapName.empty()) shadowMap = Resources().Get<Texture>(shadowMapName);
 
+		//lightmap - baked static lighting
+		std::string lightMapName;
+		SERIAL_READ_NAME(*document, "lightMap", lightMapName);
+
+		if(!lightMapName.empty()) lightMap = Resources().Get<Texture>(lightMapName);
+
+		// the resolved maps select the program variant: each present map
+		// compiles in as a USE_* define, so this material runs a permutation
+		// specialized to exactly the maps it has instead of branching on the
+		// parameter flags per fragment. Identical permutations across
+		// materials dedup through the cache by the variant id
+		uint32_t variant = 0;
+		if (baseMap)     variant |= (uint32_t)Parameters::BaseMap;
+		if (specularMap) variant |= (uint32_t)Parameters::SpecularMap;
+		if (emissiveMap) variant |= (uint32_t)Parameters::EmissiveMap;
+		if (normalMap)   variant |= (uint32_t)Parameters::NormalMap;
+		if (cubeMap)     variant |= (uint32_t)Parameters::CubeMap;
+		if (shadowMap)   variant |= (uint32_t)Parameters::ShadowMap;
+		if (lightMap)    variant |= (uint32_t)Parameters::LightMap;
+
+		// budget gate on the declared map count - every present map is a
+		// sampler bind and a fetch in the permutation this material selects
+		if (!ContentBudgets::CheckMaterial(filename, std::popcount(variant))) return false;
+
+		program = Resources().GetWithID<Program>(Program::VariantId(programName, variant), programName, variant);
+
 		//shininess
-		SERIAL_READ(document, shininess);
+		SERIAL_READ(*document, shininess);
 
 		//tiling
-		SERIAL_READ(document, tiling);
+		SERIAL_READ(*document, tiling);
 
 		//offset
-		SERIAL_READ(document, offset);
+		SERIAL_READ(*document, offset);
 
 		//color
-		SERIAL_READ(document, baseColor);
+		SERIAL_READ(*document, baseColor);
 
 		//emissive color
-		SERIAL_READ(document, emissiveColor);
+		SERIAL_READ(*document, emissiveColor);
+
+		//transparency - routes draws into the sorted transparent queue
+		SERIAL_READ(*document, transparent);
+
+		//sky - routes draws into the post-opaque sky stage
+		SERIAL_READ(*document, sky);
+
+		// bindless path first - on capable drivers programs that declare
+		// u_baseMapHandle get resident handles pushed as uniforms and Bind
+		// touches no texture units at all. all-or-nothing per material, and
+		// streaming maps refuse handles, so partial materials drop through
+		// to the array/binding paths below
+		if (bindless::IsSupported() && program && program->GetUniformHandle("u_baseMapHandle") != Program::invalidUniform) {
+			m_useBindless = true;
+			if (baseMap) m_useBindless &= baseMap->GetBindlessHandle() != 0;
+			if (specularMap) m_useBindless &= specularMap->GetBindlessHandle() != 0;
+			if (emissiveMap) m_useBindless &= emissiveMap->GetBindlessHandle() != 0;
+			if (normalMap) m_useBindless &= normalMap->GetBindlessHandle() != 0;
+
+			if (!m_useBindless) LOG_CAT_WARNING(Renderer, "Material {} falls back from bindless (streaming map)", filename);
+		}
+
+		// pack the 2D maps into shared texture arrays when the program
+		// samples them that way (declares u_baseMapArray) - materials whose
+		// maps share a bucket then bind identical array objects and only
+		// the layer uniforms change between them. all-or-nothing per
+		// material so the shader never mixes array and plain lookups
+		if (!m_useBindless && program && program->GetUniformHandle("u_baseMapArray") != Program::invalidUniform) {
+			m_useArrays = true;
+			if (baseMap) m_useArrays &= TextureArrayCache::Instance().Acquire(*baseMap, m_baseSlot);
+			if (specularMap) m_useArrays &= TextureArrayCache::Instance().Acquire(*specularMap, m_specularSlot);
+			if (emissiveMap) m_useArrays &= TextureArrayCache::Instance().Acquire(*emissiveMap, m_emissiveSlot);
+			if (normalMap) m_useArrays &= TextureArrayCache::Instance().Acquire(*normalMap, m_normalSlot);
+
+			if (!m_useArrays) LOG_CAT_WARNING(Renderer, "Material {} falls back to texture bindings (unpackable map)", filename);
+		}
+
+		// publish the parameter block - from here on Bind only selects it
+		UploadBlock();
 
 		return true;
 	}
+
+	uint32_t Material::ReadVariantBits(const serial::document_t& document) {
+		static constexpr std::pair<const char*, Parameters> kMapKeys[] = {
+			{ "baseMap",     Parameters::BaseMap },
+			{ "specularMap", Parameters::SpecularMap },
+			{ "emissiveMap", Parameters::EmissiveMap },
+			{ "normalMap",   Parameters::NormalMap },
+			{ "cubeMap",     Parameters::CubeMap },
+			{ "shadowMap",   Parameters::ShadowMap },
+			{ "lightMap",    Parameters::LightMap },
+		};
+
+		uint32_t bits = 0;
+		for (auto& [key, bit] : kMapKeys) {
+			std::string name;
+			SERIAL_READ_NAME(document, key, name);
+			if (!name.empty()) bits |= (uint32_t)bit;
+		}
+		return bits;
+	}
+
+	void Material::Prefetch(const std::string& filename) {
+		// parse once through the shared document cache - the main-thread
+		// Load() that follows reuses this parse instead of repeating it
+		auto document = Resources().GetDocument(filename);
+		if (!document) return;
+
+		// fan the dependencies out as their own worker items: the program
+		// (which fans out its shader sources in turn) and every map decode
+		// run concurrently, and the finalize joins on the whole tree - so
+		// the material costs about its slowest dependency, not the sum
+		std::string name;
+		SERIAL_READ_NAME(*document, "program", name);
+		if (!name.empty()) Resources().QueueDependency(name, [name]() { Program::Prefetch(name); });
+
+		for (auto key : { "baseMap", "specularMap", "emissiveMap", "normalMap", "shadowMap", "lightMap" }) {
+			name.clear();
+			SERIAL_READ_NAME(*document, key, name);
+			if (!name.empty()) Resources().QueueDependency(name, [name]() { Texture::Prefetch(name); });
+		}
+
+		// cube maps have no decode hook - warm the file like a plain resource
+		name.clear();
+		SERIAL_READ_NAME(*document, "cubeMap", name);
+		if (!name.empty()) {
+			Resources().QueueDependency(name, [name]() {
+				std::vector<uint8_t> data;
+				file::ReadBinaryFile(name, data);
+			});
+		}
+	}
+
+	void Material::UploadBlock() {
+		if (m_blockSlot < 0) m_blockSlot = AcquireBlockSlot();
+		if (m_blockSlot < 0) {
+			LOG_CAT_WARNING(Renderer, "Material block table full, {} falls back to uniforms", name);
+			return;
+		}
+
+		// the map-presence flags are fixed once Load resolved the maps, so
+		// they ride in the block instead of a per-draw uniform
+		uint32_t flags = 0;
+		if (baseMap)     flags |= (uint32_t)Parameters::BaseMap;
+		if (specularMap) flags |= (uint32_t)Parameters::SpecularMap;
+		if (emissiveMap) flags |= (uint32_t)Parameters::EmissiveMap;
+		if (normalMap)   flags |= (uint32_t)Parameters::NormalMap;
+		if (cubeMap)     flags |= (uint32_t)Parameters::CubeMap;
+		if (shadowMap)   flags |= (uint32_t)Parameters::ShadowMap;
+		if (lightMap)    flags |= (uint32_t)Parameters::LightMap;
+
+		MaterialBlockData block{};
+		block.baseColor = baseColor;
+		block.shininess = shininess;
+		block.emissiveColor = emissiveColor;
+		block.ior = ior;
+		block.tiling = tiling;
+		block.offset = offset;
+		block.parameters = flags;
+
+		glBindBuffer(GL_UNIFORM_BUFFER, materialBlockBuffer);
+		glBufferSubData(GL_UNIFORM_BUFFER, m_blockSlot * materialBlockStride, sizeof(block), &block);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	}
+
+	bool Material::Reload(const std::string& filename) {
+		// reset everything Load populates - including defaults, so a key
+		// removed from the edited document falls back instead of keeping
+		// its old value - then re-run it. Program and map fetches resolve
+		// through the cache and reuse resources hot reload just refreshed
+		program.reset();
+		baseMap.reset();
+		specularMap.reset();
+		emissiveMap.reset();
+		normalMap.reset();
+		cubeMap.reset();
+		shadowMap.reset();
+		lightMap.reset();
+
+		shininess = 2;
+		tiling = { 1, 1 };
+		offset = { 0, 0 };
+		baseColor = { 0, 0, 0 };
+		emissiveColor = { 0, 0, 0 };
+		ior = 1.3f;
+		transparent = false;
+		sky = false;
+		parameters = Parameters::None;
+		m_useBindless = false;
+		m_useArrays = false;
+
+		// m_blockSlot is deliberately kept - Load re-uploads the parameter
+		// block into the same UBO slice
+
+		return Load(filename);
+	}
+
 	void Material::Bind() {
+		FrameStats::AddMaterialBind();
 		parameters = Parameters::None;
 		program->Use();
 
-		if (baseMap) {
-			baseMap->SetActive(GL_TEXTURE0);
-			baseMap->Bind();
-			program->SetUniform("u_baseMap", 0);
-			parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::BaseMap);
-		}
-		if (specularMap) {
-			specularMap->SetActive(GL_TEXTURE1);
-			specularMap->Bind();
-			program->SetUniform("u_specularMap", 1);
-			parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::SpecularMap);
-		}
-		if (emissiveMap) {
-			emissiveMap->SetActive(GL_TEXTURE2);
-			emissiveMap->Bind();
-			program->SetUniform("u_emissiveMap", 2);
-			parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::EmissiveMap);
-		}
-		if (normalMap) {
-			normalMap->SetActive(GL_TEXTURE3);
-			normalMap->Bind();
-			program->SetUniform("u_normalMap", 3);
-			parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::NormalMap);
-		}
-		if (cubeMap) {
-			cubeMap->SetActive(GL_TEXTURE4);
-			cubeMap->Bind();
-			program->SetUniform("u_cubeMap", 4);
-			parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::CubeMap);
-		}
-		if (shadowMap) {
-			shadowMap->SetActive(GL_TEXTURE5);
-			shadowMap->Bind();
-			program->SetUniform("u_shadowMap", 5);
-			parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::ShadowMap);
-		}
-
-		program->SetUniform("u_material.shininess", shininess);
-		program->SetUniform("u_material.tiling", tiling);
-		program->SetUniform("u_material.offset", offset);
-		program->SetUniform("u_material.baseColor", baseColor);
-		program->SetUniform("u_material.emissiveColor", emissiveColor);
-		program->SetUniform("u_material.parameters", (uint32_t)(parameters));
-		program->SetUniform("u_ior.offset", ior);
+		if (m_useBindless) {
+			// bindless path - no units, no binds, the resident handles go
+			// straight into the sampler uniforms
+			if (baseMap) {
+				program->SetUniform("u_baseMapHandle", baseMap->GetBindlessHandle());
+				parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::BaseMap);
+			}
+			if (specularMap) {
+				program->SetUniform("u_specularMapHandle", specularMap->GetBindlessHandle());
+				parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::SpecularMap);
+			}
+			if (emissiveMap) {
+				program->SetUniform("u_emissiveMapHandle", emissiveMap->GetBindlessHandle());
+				parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::EmissiveMap);
+			}
+			if (normalMap) {
+				program->SetUniform("u_normalMapHandle", normalMap->GetBindlessHandle());
+				parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::NormalMap);
+			}
+		}
+		else if (m_useArrays) {
+			// array path - the objects rebind through GLState's cache, so
+			// consecutive materials in the same buckets issue no texture
+			// binds at all, just the layer uniforms below
+			if (baseMap) {
+				GLState::SetActiveTexture(GL_TEXTURE0);
+				GLState::BindTexture(GL_TEXTURE_2D_ARRAY, m_baseSlot.texture);
+				program->SetUniform("u_baseMapArray", 0);
+				program->SetUniform("u_baseLayer", m_baseSlot.layer);
+				parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::BaseMap);
+			}
+			if (specularMap) {
+				GLState::SetActiveTexture(GL_TEXTURE1);
+				GLState::BindTexture(GL_TEXTURE_2D_ARRAY, m_specularSlot.texture);
+				program->SetUniform("u_specularMapArray", 1);
+				program->SetUniform("u_specularLayer", m_specularSlot.layer);
+				parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::SpecularMap);
+			}
+			if (emissiveMap) {
+				GLState::SetActiveTexture(GL_TEXTURE2);
+				GLState::BindTexture(GL_TEXTURE_2D_ARRAY, m_emissiveSlot.texture);
+				program->SetUniform("u_emissiveMapArray", 2);
+				program->SetUniform("u_emissiveLayer", m_emissiveSlot.layer);
+				parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::EmissiveMap);
+			}
+			if (normalMap) {
+				GLState::SetActiveTexture(GL_TEXTURE3);
+				GLState::BindTexture(GL_TEXTURE_2D_ARRAY, m_normalSlot.texture);
+				program->SetUniform("u_normalMapArray", 3);
+				program->SetUniform("u_normalLayer", m_normalSlot.layer);
+				parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::NormalMap);
+			}
+		}
+
+		if (!m_useBindless && !m_useArrays && GLState::SupportsDSA()) {
+			// plain path on a DSA driver: one glBindTextures call covers
+			// units 0-6 (multi-bind attaches each texture to its own
+			// target), replacing up to seven active-unit/bind pairs
+			GLuint textures[7] = {
+				baseMap ? baseMap->m_texture : 0,
+				specularMap ? specularMap->m_texture : 0,
+				emissiveMap ? emissiveMap->m_texture : 0,
+				normalMap ? normalMap->m_texture : 0,
+				cubeMap ? cubeMap->m_texture : 0,
+				shadowMap ? shadowMap->m_texture : 0,
+				lightMap ? lightMap->m_texture : 0
+			};
+			GLState::BindTextures(0, 7, textures);
 
+			if (baseMap) {
+				program->SetUniform("u_baseMap", 0);
+				parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::BaseMap);
+			}
+			if (specularMap) {
+				program->SetUniform("u_specularMap", 1);
+				parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::SpecularMap);
+			}
+			if (emissiveMap) {
+				program->SetUniform("u_emissiveMap", 2);
+				parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::EmissiveMap);
+			}
+			if (normalMap) {
+				program->SetUniform("u_normalMap", 3);
+				parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::NormalMap);
+			}
+			if (cubeMap) {
+				program->SetUniform("u_cubeMap", 4);
+				parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::CubeMap);
+			}
+			if (shadowMap) {
+				program->SetUniform("u_shadowMap", 5);
+				parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::ShadowMap);
+			}
+			if (lightMap) {
+				program->SetUniform("u_lightMap", 6);
+				parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::LightMap);
+			}
+		}
+		else {
+			if (!m_useBindless && !m_useArrays && baseMap) {
+				baseMap->SetActive(GL_TEXTURE0);
+				baseMap->Bind();
+				program->SetUniform("u_baseMap", 0);
+				parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::BaseMap);
+			}
+			if (!m_useBindless && !m_useArrays && specularMap) {
+				specularMap->SetActive(GL_TEXTURE1);
+				specularMap->Bind();
+				program->SetUniform("u_specularMap", 1);
+				parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::SpecularMap);
+			}
+			if (!m_useBindless && !m_useArrays && emissiveMap) {
+				emissiveMap->SetActive(GL_TEXTURE2);
+				emissiveMap->Bind();
+				program->SetUniform("u_emissiveMap", 2);
+				parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::EmissiveMap);
+			}
+			if (!m_useBindless && !m_useArrays && normalMap) {
+				normalMap->SetActive(GL_TEXTURE3);
+				normalMap->Bind();
+				program->SetUniform("u_normalMap", 3);
+				parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::NormalMap);
+			}
+			if (cubeMap) {
+				cubeMap->SetActive(GL_TEXTURE4);
+				cubeMap->Bind();
+				program->SetUniform("u_cubeMap", 4);
+				parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::CubeMap);
+			}
+			if (shadowMap) {
+				shadowMap->SetActive(GL_TEXTURE5);
+				shadowMap->Bind();
+				program->SetUniform("u_shadowMap", 5);
+				parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::ShadowMap);
+			}
+			if (lightMap) {
+				lightMap->SetActive(GL_TEXTURE6);
+				lightMap->Bind();
+				program->SetUniform("u_lightMap", 6);
+				parameters = (Parameters)((uint32_t)parameters | (uint32_t)Parameters::LightMap);
+			}
+		}
+
+		// shared samplers for the color-map units - identical filter/wrap
+		// state is one driver object however many textures use it, and the
+		// quality tier's anisotropy level lives on the samplers, never on
+		// the texture objects. Bindless handles bake the texture's own
+		// parameters, so that path stays sampler-free; the cubemap, shadow
+		// (compare mode) and lightmap units keep texture-object state
+		if (!m_useBindless) {
+			SamplerCache& samplers = SamplerCache::Instance();
+			if (m_useArrays) {
+				// array buckets are keyed by mip count, so the slot knows
+				// whether a mip filter is complete
+				if (baseMap) GLState::BindSampler(0, samplers.Get(m_baseSlot.GetSamplerDesc()));
+				if (specularMap) GLState::BindSampler(1, samplers.Get(m_specularSlot.GetSamplerDesc()));
+				if (emissiveMap) GLState::BindSampler(2, samplers.Get(m_emissiveSlot.GetSamplerDesc()));
+				if (normalMap) GLState::BindSampler(3, samplers.Get(m_normalSlot.GetSamplerDesc()));
+			}
+			else {
+				if (baseMap) GLState::BindSampler(0, samplers.Get(baseMap->GetSamplerDesc()));
+				if (specularMap) GLState::BindSampler(1, samplers.Get(specularMap->GetSamplerDesc()));
+				if (emissiveMap) GLState::BindSampler(2, samplers.Get(emissiveMap->GetSamplerDesc()));
+				if (normalMap) GLState::BindSampler(3, samplers.Get(normalMap->GetSamplerDesc()));
+			}
+		}
+
+		// parameter upload - programs declaring MaterialBlock select this
+		// material's UBO slice with a single bind-range; the legacy
+		// per-uniform path stays for programs without the block
+		if (program->HasMaterialBlock() && m_blockSlot >= 0) {
+			glBindBufferRange(GL_UNIFORM_BUFFER, Program::materialBlockBinding,
+				materialBlockBuffer, m_blockSlot * materialBlockStride, sizeof(MaterialBlockData));
+		}
+		else {
+			program->SetUniform("u_material.shininess", shininess);
+			program->SetUniform("u_material.tiling", tiling);
+			program->SetUniform("u_material.offset", offset);
+			program->SetUniform("u_material.baseColor", baseColor);
+			program->SetUniform("u_material.emissiveColor", emissiveColor);
+			program->SetUniform("u_material.parameters", (uint32_t)(parameters));
+			program->SetUniform("u_ior.offset", ior);
+		}
 	}
 
 	void Material::UpdateGUI()
@@ -147,14 +505,24 @@ namespace neu {
 				Editor::GetDialogResource<Texture>(emissiveMap, "EmissiveMapDialog", "Open_texture", "Image (*.png;*jpg;*.bmp;*.jpeg;*.tga){.png,.jpg,.bmp,.jpeg,.tga},.*");
 				ImGui::Separator();
 			}
-			//if (cubeMap)ImGui::Text("cubeMap: %s", cubeMap->name.c_str());
+			if (lightMap) {
+			ImGui::Text("lightMap: %s", lightMap->name.c_str());
+			Editor::ShowTexture(*lightMap, 32, 32);
+			Editor::GetDialogResource<Texture>(lightMap, "LightMapDialog", "Open_texture", "Image (*.png;*jpg;*.bmp;*.jpeg;*.tga){.png,.jpg,.bmp,.jpeg,.tga},.*");
+			ImGui::Separator();
+		}
+		//if (cubeMap)ImGui::Text("cubeMap: %s", cubeMap->name.c_str());
 			ImGui::Separator();
 
-			ImGui::ColorEdit3("Emissive Color", glm::value_ptr(emissiveColor));
-			ImGui::ColorEdit3("Color", glm::value_ptr(baseColor));
-			ImGui::DragFloat("Shininess", &shininess, 1.0f, 1.0f, 256.0f);
-			ImGui::DragFloat2("tiling", glm::value_ptr(tiling), 0.0);
-			ImGui::DragFloat2("offset", glm::value_ptr(offset), 0.0);
+			// re-upload this material's UBO slice only when a widget edits
+			// it - untouched materials never touch the buffer
+			bool edited = false;
+			edited |= ImGui::ColorEdit3("Emissive Color", glm::value_ptr(emissiveColor));
+			edited |= ImGui::ColorEdit3("Color", glm::value_ptr(baseColor));
+			edited |= ImGui::DragFloat("Shininess", &shininess, 1.0f, 1.0f, 256.0f);
+			edited |= ImGui::DragFloat2("tiling", glm::value_ptr(tiling), 0.0);
+			edited |= ImGui::DragFloat2("offset", glm::value_ptr(offset), 0.0);
+			if (edited) UploadBlock();
 		}
 	}
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #pragma once
+#include "TextureArrayCache.h"
 #include <glm/glm.hpp>
 #include "GUI/GUI.h"
 
@@ -16,7 +17,8 @@ namespace neu {
 			EmissiveMap	= (1<<2),
 			NormalMap	= (1<<3),
 			CubeMap		= (1<<4),
-			ShadowMap	= (1<<5)
+			ShadowMap	= (1<<5),
+			LightMap	= (1<<6)
 		};
 
 
@@ -25,6 +27,24 @@ namespace neu {
 		~Material() = default;
 
 		bool Load(const std::string& filename);
+
+		// derives the Parameters bits a material document will request from
+		// the map entries it declares - Load uses the loaded maps instead,
+		// but the cook-time warm-up pass pre-builds permutations from the
+		// documents alone
+		static uint32_t ReadVariantBits(const serial::document_t& document);
+
+		// worker-side async hook: parses the material document and fans its
+		// program and map dependencies out across the worker pool, so the
+		// composite's I/O and decode cost approaches its largest single
+		// dependency instead of the serial sum
+		static void Prefetch(const std::string& filename);
+
+		// hot reload: drops the program/map references and binding-path
+		// flags, then re-runs Load - referenced resources resolve through
+		// the cache, so freshly reloaded programs and textures are reused
+		bool Reload(const std::string& filename) override;
+
 		void Bind();
 		
 		void UpdateGUI() override;
@@ -45,10 +65,47 @@ namespace neu {
 		res_t <Texture> cubeMap;
 		res_t <Texture> shadowMap;
 
+		// baked static lighting, cooked offline and sampled additively -
+		// lights marked baked contribute only through this map
+		res_t <Texture> lightMap;
+
 		float ior{ 1.3f };
-		
+
+		// transparent materials skip the state-grouped opaque queue and draw
+		// last, back to front, with alpha blending and depth writes off
+		bool transparent{ false };
+
+		// sky materials draw once after all opaques at the far plane with a
+		// depth-equal test, so covered sky pixels never shade
+		bool sky{ false };
+
 		Parameters parameters = Parameters::None;
 
+	private:
+		// true when the driver supports bindless textures, the program
+		// declares u_baseMapHandle, and every present 2D map yielded a
+		// resident handle - Bind then uploads handles and binds nothing
+		bool m_useBindless{ false };
+
+		// layer slots when the 2D maps were packed into shared texture
+		// arrays at load - taken only when the program declares the array
+		// samplers and every present map packed, otherwise Bind uses the
+		// per-map binding path
+		bool m_useArrays{ false };
+		TextureArraySlot m_baseSlot;
+		TextureArraySlot m_specularSlot;
+		TextureArraySlot m_emissiveSlot;
+		TextureArraySlot m_normalSlot;
+
+		// writes this material's std140 parameter slice into the shared
+		// material UBO - called at load and on editor edits, so Bind only
+		// selects the slice with glBindBufferRange and untouched materials
+		// never re-upload
+		void UploadBlock();
+
+		// slice index into the shared material UBO, taken on first upload;
+		// -1 when the table is full and Bind falls back to plain uniforms
+		int m_blockSlot{ -1 };
 	};
 
 
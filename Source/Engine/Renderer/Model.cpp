@@ -1,88 +1,982 @@
 #include "Model.h"
+#include "Resources/ContentBudgets.h"
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
+#include <glm/gtc/packing.hpp>
+#include <unordered_map>
+#include <unordered_set>
+#include <cmath>
 
 namespace neu {
+	namespace {
+		// cooked binary model format, written next to the source file so the
+		// Assimp import (triangulate, normals, tangents) only runs once
+		constexpr uint32_t kCookedMagic = 0x4c444d4e;	// "NMDL"
+		constexpr uint32_t kCookedVersion = 6;			// v6 compressed clip tracks (reduced keys, packed quats, SoA)
+
+		struct CookedHeader {
+			uint32_t magic;
+			uint32_t version;
+			uint32_t submeshCount;
+		};
+
+		struct CookedSubmesh {
+			uint32_t lodCount;
+			glm::vec3 boundsMin;
+			glm::vec3 boundsMax;
+		};
+
+		struct CookedLod {
+			uint32_t vertexCount;
+			uint32_t indexCount;
+			uint32_t skinCount;		// 0 for rigid meshes, else == vertexCount
+		};
+
+		// Assimp matrices are row-major, glm column-major
+		glm::mat4 ToGlm(const aiMatrix4x4& m) {
+			return glm::mat4{
+				m.a1, m.b1, m.c1, m.d1,
+				m.a2, m.b2, m.c2, m.d2,
+				m.a3, m.b3, m.c3, m.d3,
+				m.a4, m.b4, m.c4, m.d4 };
+		}
+
+		// depth-first emit of the marked nodes so every joint's parent lands
+		// before it - intermediate nodes carry their bind transform down the
+		// chain but have no inverse bind (nothing weights to them)
+		void EmitJoints(const aiNode* node, int32_t parent,
+			const std::unordered_set<const aiNode*>& needed,
+			const std::unordered_map<std::string, aiMatrix4x4>& boneOffsets,
+			Skeleton& skeleton) {
+			int32_t index = parent;
+			if (needed.contains(node)) {
+				index = (int32_t)skeleton.joints.size();
+
+				Skeleton::Joint joint;
+				joint.nameHash = animation::HashName(node->mName.C_Str());
+				joint.parent = parent;
+				joint.localBind = ToGlm(node->mTransformation);
+
+				auto offset = boneOffsets.find(node->mName.C_Str());
+				joint.inverseBind = (offset != boneOffsets.end()) ? ToGlm(offset->second) : glm::mat4{ 1 };
+
+				skeleton.joints.push_back(joint);
+			}
+
+			for (unsigned int i = 0; i < node->mNumChildren; i++) {
+				EmitJoints(node->mChildren[i], index, needed, boneOffsets, skeleton);
+			}
+		}
+
+		// Forsyth vertex-cache scoring (linear-speed cache optimization) -
+		// recently-used vertices score high, the three verts of the last
+		// triangle slightly lower (avoids fan order), low-valence vertices
+		// get a boost so isolated corners finish early
+		constexpr int kCacheSize = 32;
+		constexpr float kCacheDecayPower = 1.5f;
+		constexpr float kLastTriScore = 0.75f;
+		constexpr float kValenceBoostScale = 2.0f;
+		constexpr float kValenceBoostPower = 0.5f;
+
+		// triangles per cluster in the overdraw sort - clusters keep the
+		// cache-friendly order internally, only their order changes
+		constexpr size_t kOverdrawClusterSize = 128;
+
+		// simplification grid cell size per LOD level, as a fraction of the
+		// submesh's largest extent - each level collapses roughly 4x more
+		constexpr float kLodCellFraction[Model::kLodCount] = { 0, 1.0f / 48, 1.0f / 24, 1.0f / 12 };
+
+		float VertexScore(int cachePosition, int activeTriangles) {
+			if (activeTriangles == 0) return -1.0f;
+
+			float score = 0;
+			if (cachePosition >= 0) {
+				if (cachePosition < 3) score = kLastTriScore;
+				else score = std::pow(1.0f - (cachePosition - 3) * (1.0f / (kCacheSize - 3)), kCacheDecayPower);
+			}
+			score += kValenceBoostScale * std::pow((float)activeTriangles, -kValenceBoostPower);
+			return score;
+		}
+
+		// merge bit-identical vertices and remap the indices - DCC exports
+		// routinely duplicate vertices along UV seams that quantization has
+		// since collapsed, and ProcessMesh never welded at all
+		void WeldVertices(std::vector<Model::VertexPacked>& vertices, std::vector<GLuint>& indices) {
+			auto hash = [](const Model::VertexPacked& vertex) {
+				// FNV-1a over the packed bytes - the layout has no padding
+				size_t h = 14695981039346656037ull;
+				auto bytes = reinterpret_cast<const uint8_t*>(&vertex);
+				for (size_t i = 0; i < sizeof(vertex); i++) {
+					h ^= bytes[i];
+					h *= 1099511628211ull;
+				}
+				return h;
+			};
+			auto equal = [](const Model::VertexPacked& a, const Model::VertexPacked& b) {
+				return std::memcmp(&a, &b, sizeof(a)) == 0;
+			};
+
+			std::unordered_map<Model::VertexPacked, GLuint, decltype(hash), decltype(equal)> unique(vertices.size(), hash, equal);
+			std::vector<Model::VertexPacked> welded;
+			welded.reserve(vertices.size());
+
+			std::vector<GLuint> remap(vertices.size());
+			for (size_t i = 0; i < vertices.size(); i++) {
+				auto [entry, inserted] = unique.try_emplace(vertices[i], (GLuint)welded.size());
+				if (inserted) welded.push_back(vertices[i]);
+				remap[i] = entry->second;
+			}
+
+			for (auto& index : indices) index = remap[index];
+			vertices = std::move(welded);
+		}
+
+		// Forsyth's linear-speed vertex cache optimization - greedily emits
+		// the highest-scoring triangle, modelling a 32-entry FIFO cache so
+		// the reordered indices re-hit post-transform results
+		void OptimizeVertexCache(std::vector<GLuint>& indices, size_t vertexCount) {
+			size_t triangleCount = indices.size() / 3;
+			if (triangleCount == 0) return;
+
+			// per-vertex valence and triangle adjacency (CSR layout)
+			std::vector<int> remaining(vertexCount, 0);
+			for (auto index : indices) remaining[index]++;
+
+			std::vector<uint32_t> offsets(vertexCount + 1, 0);
+			for (size_t v = 0; v < vertexCount; v++) offsets[v + 1] = offsets[v] + remaining[v];
+
+			std::vector<uint32_t> adjacency(indices.size());
+			{
+				std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+				for (size_t t = 0; t < triangleCount; t++) {
+					for (int j = 0; j < 3; j++) adjacency[cursor[indices[t * 3 + j]]++] = (uint32_t)t;
+				}
+			}
+
+			std::vector<int> cachePosition(vertexCount, -1);
+			std::vector<float> vertexScore(vertexCount);
+			for (size_t v = 0; v < vertexCount; v++) vertexScore[v] = VertexScore(-1, remaining[v]);
+
+			std::vector<bool> emitted(triangleCount, false);
+			std::vector<float> triangleScore(triangleCount, 0);
+			for (size_t t = 0; t < triangleCount; t++) {
+				triangleScore[t] = vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+			}
+
+			std::vector<GLuint> output;
+			output.reserve(indices.size());
+
+			// modelled FIFO, three slots of headroom for the incoming triangle
+			int cache[kCacheSize + 3];
+			int cacheCount = 0;
+
+			int bestTriangle = 0;
+			for (size_t t = 1; t < triangleCount; t++) {
+				if (triangleScore[t] > triangleScore[bestTriangle]) bestTriangle = (int)t;
+			}
+			size_t scanCursor = 0;
+
+			for (size_t emittedCount = 0; emittedCount < triangleCount; emittedCount++) {
+				// connectivity break (new component) - restart from the next
+				// unemitted triangle, the cursor keeps the scan linear overall
+				if (bestTriangle < 0) {
+					while (emitted[scanCursor]) scanCursor++;
+					bestTriangle = (int)scanCursor;
+				}
+
+				emitted[bestTriangle] = true;
+				GLuint triangle[3];
+				for (int j = 0; j < 3; j++) {
+					triangle[j] = indices[bestTriangle * 3 + j];
+					output.push_back(triangle[j]);
+					remaining[triangle[j]]--;
+				}
+
+				// push the triangle's vertices onto the modelled FIFO, dropping
+				// duplicates and anything past the cache size
+				int updated[kCacheSize + 3];
+				int updatedCount = 0;
+				for (int j = 0; j < 3; j++) updated[updatedCount++] = (int)triangle[j];
+				for (int c = 0; c < cacheCount && updatedCount < kCacheSize + 3; c++) {
+					int vertex = cache[c];
+					if (vertex == (int)triangle[0] || vertex == (int)triangle[1] || vertex == (int)triangle[2]) continue;
+					updated[updatedCount++] = vertex;
+				}
+
+				// rescore every touched vertex - entries pushed past the cache
+				// size fall back to their valence-only score
+				bestTriangle = -1;
+				float bestScore = 0;
+				for (int c = 0; c < updatedCount; c++) {
+					int vertex = updated[c];
+					cachePosition[vertex] = (c < kCacheSize) ? c : -1;
+
+					float score = VertexScore(cachePosition[vertex], remaining[vertex]);
+					float delta = score - vertexScore[vertex];
+					vertexScore[vertex] = score;
+
+					for (uint32_t a = offsets[vertex]; a < offsets[vertex + 1]; a++) {
+						uint32_t t = adjacency[a];
+						if (emitted[t]) continue;
+
+						triangleScore[t] += delta;
+						if (bestTriangle < 0 || triangleScore[t] > bestScore) {
+							bestTriangle = (int)t;
+							bestScore = triangleScore[t];
+						}
+					}
+				}
+
+				cacheCount = math::min(updatedCount, kCacheSize);
+				std::memcpy(cache, updated, cacheCount * sizeof(int));
+			}
+
+			indices = std::move(output);
+		}
+
+		// overdraw-aware cluster sort - split the cache-optimized list into
+		// fixed-size clusters and draw the outward-facing shell first, so
+		// interior geometry fails the depth test instead of shading
+		void SortForOverdraw(const std::vector<Model::VertexPacked>& vertices, std::vector<GLuint>& indices) {
+			size_t triangleCount = indices.size() / 3;
+			if (triangleCount <= kOverdrawClusterSize) return;
+
+			glm::vec3 meshCenter{ 0 };
+			for (auto& vertex : vertices) meshCenter += vertex.position;
+			meshCenter /= (float)vertices.size();
+
+			struct Cluster {
+				size_t firstTriangle;
+				size_t triangleCount;
+				float key;
+			};
+			std::vector<Cluster> clusters;
+
+			for (size_t first = 0; first < triangleCount; first += kOverdrawClusterSize) {
+				Cluster cluster{ first, math::min(kOverdrawClusterSize, triangleCount - first), 0 };
+
+				// cluster centroid and summed face normals from the positions
+				glm::vec3 centroid{ 0 };
+				glm::vec3 normal{ 0 };
+				for (size_t t = cluster.firstTriangle; t < cluster.firstTriangle + cluster.triangleCount; t++) {
+					glm::vec3 a = vertices[indices[t * 3]].position;
+					glm::vec3 b = vertices[indices[t * 3 + 1]].position;
+					glm::vec3 c = vertices[indices[t * 3 + 2]].position;
+
+					centroid += (a + b + c) / 3.0f;
+					normal += glm::cross(b - a, c - a);
+				}
+				centroid /= (float)cluster.triangleCount;
+
+				// how much the cluster faces away from the mesh interior -
+				// high values are the outer shell, drawn first
+				glm::vec3 outward = centroid - meshCenter;
+				float outwardLength = glm::length(outward);
+				float normalLength = glm::length(normal);
+				if (outwardLength > 0 && normalLength > 0) {
+					cluster.key = glm::dot(outward / outwardLength, normal / normalLength);
+				}
+
+				clusters.push_back(cluster);
+			}
+
+			std::stable_sort(clusters.begin(), clusters.end(),
+				[](const Cluster& a, const Cluster& b) { return a.key > b.key; });
+
+			std::vector<GLuint> output;
+			output.reserve(indices.size());
+			for (auto& cluster : clusters) {
+				output.insert(output.end(),
+					indices.begin() + cluster.firstTriangle * 3,
+					indices.begin() + (cluster.firstTriangle + cluster.triangleCount) * 3);
+			}
+			indices = std::move(output);
+		}
+
+		// vertex-clustering simplification for the LOD chain - snap positions
+		// to a grid, collapse every cell to its first vertex and drop the
+		// triangles that degenerate. crude next to edge-collapse simplifiers,
+		// but monotonic and fast, and the levels it feeds replace detail that
+		// is sub-pixel anyway. orphaned vertices are dropped by the fetch
+		// reorder that runs on every level afterwards
+		Model::Submesh::Lod SimplifyLod(const Model::Submesh::Lod& source, const Bounds& bounds, float cellSize) {
+			Model::Submesh::Lod lod;
+			lod.vertices = source.vertices;
+
+			// map every vertex to its cell's representative
+			std::unordered_map<uint64_t, GLuint> cells;
+			std::vector<GLuint> representative(source.vertices.size());
+			for (size_t i = 0; i < source.vertices.size(); i++) {
+				glm::vec3 local = glm::max((source.vertices[i].position - bounds.min) / cellSize, glm::vec3{ 0 });
+				uint64_t cell = ((uint64_t)local.x) | ((uint64_t)local.y << 21) | ((uint64_t)local.z << 42);
+
+				auto [entry, inserted] = cells.try_emplace(cell, (GLuint)i);
+				representative[i] = entry->second;
+			}
+
+			// rebuild the triangle list over representatives, dropping the
+			// triangles the collapse flattened
+			lod.indices.reserve(source.indices.size());
+			for (size_t t = 0; t + 2 < source.indices.size(); t += 3) {
+				GLuint a = representative[source.indices[t]];
+				GLuint b = representative[source.indices[t + 1]];
+				GLuint c = representative[source.indices[t + 2]];
+				if (a == b || b == c || a == c) continue;
+
+				lod.indices.push_back(a);
+				lod.indices.push_back(b);
+				lod.indices.push_back(c);
+			}
+
+			return lod;
+		}
+
+		// reorder the vertex buffer into first-use order of the final index
+		// list so vertex fetch walks memory forward; also drops vertices no
+		// triangle references (welding and simplification orphan them)
+		void OptimizeVertexFetch(std::vector<Model::VertexPacked>& vertices, std::vector<GLuint>& indices) {
+			constexpr GLuint kUnused = ~0u;
+			std::vector<GLuint> remap(vertices.size(), kUnused);
+
+			std::vector<Model::VertexPacked> reordered;
+			reordered.reserve(vertices.size());
+
+			for (auto& index : indices) {
+				if (remap[index] == kUnused) {
+					remap[index] = (GLuint)reordered.size();
+					reordered.push_back(vertices[index]);
+				}
+				index = remap[index];
+			}
+			vertices = std::move(reordered);
+		}
+	}
+
 	bool Model::Load(const std::string& filename) {
+		std::vector<Submesh> submeshes;
+
+		// prefer the cooked binary when it exists and is not older than the source
+		std::string cookedFilename = GetCookedFilename(filename);
+		if (file::Exists(cookedFilename)) {
+			bool stale = file::Exists(filename) &&
+				std::filesystem::last_write_time(cookedFilename) < std::filesystem::last_write_time(filename);
+
+			if (!stale && LoadCooked(cookedFilename, submeshes)) {
+				CreateVertexBuffers(submeshes, filename);
+				return true;
+			}
+		}
+
+		// cooked file missing or stale, run the full Assimp import - bone
+		// weights capped at the four the skin stream stores
 		Assimp::Importer importer;
-		const aiScene* scene = importer.ReadFile(filename, aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_CalcTangentSpace);
+		const aiScene* scene = importer.ReadFile(filename, aiProcess_Triangulate | aiProcess_GenSmoothNormals | aiProcess_CalcTangentSpace | aiProcess_LimitBoneWeights);
 
 		if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
-			LOG_WARNING("Could not load assimp file {} : {}", filename, importer.GetErrorString());
+			LOG_CAT_WARNING(Renderer, "Could not load assimp file {} : {}", filename, importer.GetErrorString());
 			return false;
 		}
 
-		ProcessNode(scene->mRootNode, scene);
+		// the skeleton comes first so mesh skin streams and clip channels
+		// can resolve their joints against it
+		ProcessSkeleton(scene);
+
+		// each mesh converts into its own Submesh with no shared state (the
+		// skeleton is read-only by now), so the conversion fans out across
+		// the workers - GL buffer creation stays serialized on this thread
+		std::vector<aiMesh*> meshes;
+		ProcessNode(scene->mRootNode, scene, meshes);
+
+		submeshes.resize(meshes.size());
+		GetEngine().GetJobSystem().ParallelFor(meshes.size(), 1, [&](size_t index) {
+			ProcessMesh(meshes[index], scene, submeshes[index]);
+		});
+
+		ProcessAnimations(scene);
+
+		// collapse same-material parts before the optimization passes so
+		// welding and the cache sort see the combined geometry
+		MergeSubmeshes(submeshes);
+
+		// GPU optimization passes run once here - the cooked file stores the
+		// optimized buffers, so only a fresh or stale import pays for them
+		OptimizeSubmeshes(submeshes);
+
+		// budget gate before the cooked file is written - an over-budget
+		// import fails here, at cook time, with the asset named, instead of
+		// surfacing weeks later in a frame capture
+		size_t triangles = 0;
+		for (auto& submesh : submeshes) triangles += submesh.lods[0].indices.size() / 3;
+		if (!ContentBudgets::CheckModel(filename, triangles, m_skeleton.joints.size())) return false;
+
+		// cook for the next run so future loads skip the import entirely
+		WriteCooked(cookedFilename, submeshes);
+
+		CreateVertexBuffers(submeshes, filename);
 
 		return true;
 	}
 
-	void Model::Draw(GLenum primitiveType) {
+	bool Model::Reload(const std::string& filename) {
+		// drop the GL buffers and reload in place - the res_t<VertexBuffer>
+		// handles release the old objects, and Load rebuilds from the edited
+		// source (re-cooking if the cooked sibling went stale)
+		m_vertexBuffers.clear();
+		m_lodBuffers.clear();
+		m_lodCount = 1;
+		m_bounds = {};
+		m_memorySize = 0;
+		m_skeleton.joints.clear();
+		m_clips.clear();
+
+		return Load(filename);
+	}
+
+	std::string Model::GetCookedFilename(const std::string& filename) {
+		return filename + ".nmdl";
+	}
+
+	bool Model::LoadCooked(const std::string& filename, std::vector<Submesh>& submeshes) {
+		std::vector<uint8_t> data;
+		if (!file::ReadBinaryFile(filename, data)) return false;
+
+		if (data.size() < sizeof(CookedHeader)) return false;
+
+		CookedHeader header;
+		std::memcpy(&header, data.data(), sizeof(header));
+		if (header.magic != kCookedMagic || header.version != kCookedVersion) {
+			LOG_CAT_WARNING(Renderer, "Cooked model has wrong magic/version: {}", filename);
+			return false;
+		}
+
+		size_t offset = sizeof(CookedHeader);
+		submeshes.resize(header.submeshCount);
+		for (auto& submesh : submeshes) {
+			if (offset + sizeof(CookedSubmesh) > data.size()) return false;
+
+			CookedSubmesh info;
+			std::memcpy(&info, data.data() + offset, sizeof(info));
+			offset += sizeof(info);
+
+			submesh.bounds.Encapsulate(info.boundsMin);
+			submesh.bounds.Encapsulate(info.boundsMax);
+
+			submesh.lods.resize(info.lodCount);
+			for (auto& lod : submesh.lods) {
+				if (offset + sizeof(CookedLod) > data.size()) return false;
+
+				CookedLod lodInfo;
+				std::memcpy(&lodInfo, data.data() + offset, sizeof(lodInfo));
+				offset += sizeof(lodInfo);
+
+				size_t vertexBytes = lodInfo.vertexCount * sizeof(VertexPacked);
+				size_t indexBytes = lodInfo.indexCount * sizeof(GLuint);
+				size_t skinBytes = lodInfo.skinCount * sizeof(VertexSkin);
+				if (offset + vertexBytes + indexBytes + skinBytes > data.size()) return false;
+
+				// vertex blob matches the VertexPacked layout exactly, no parsing needed
+				lod.vertices.resize(lodInfo.vertexCount);
+				std::memcpy(lod.vertices.data(), data.data() + offset, vertexBytes);
+				offset += vertexBytes;
+
+				lod.indices.resize(lodInfo.indexCount);
+				std::memcpy(lod.indices.data(), data.data() + offset, indexBytes);
+				offset += indexBytes;
+
+				lod.skin.resize(lodInfo.skinCount);
+				std::memcpy(lod.skin.data(), data.data() + offset, skinBytes);
+				offset += skinBytes;
+			}
+			if (submesh.lods.empty()) return false;
+		}
+
+		// skeleton and clip chunks follow the geometry - fields are written
+		// individually, so reads go through a checked cursor
+		auto read = [&data, &offset](void* dst, size_t size) {
+			if (offset + size > data.size()) return false;
+			std::memcpy(dst, data.data() + offset, size);
+			offset += size;
+			return true;
+		};
+
+		uint32_t jointCount = 0;
+		if (!read(&jointCount, sizeof(jointCount))) return false;
+
+		m_skeleton.joints.resize(jointCount);
+		for (auto& joint : m_skeleton.joints) {
+			if (!read(&joint.nameHash, sizeof(joint.nameHash))) return false;
+			if (!read(&joint.parent, sizeof(joint.parent))) return false;
+			if (!read(&joint.localBind, sizeof(joint.localBind))) return false;
+			if (!read(&joint.inverseBind, sizeof(joint.inverseBind))) return false;
+		}
+
+		uint32_t clipCount = 0;
+		if (!read(&clipCount, sizeof(clipCount))) return false;
+
+		m_clips.resize(clipCount);
+		for (auto& clip : m_clips) {
+			uint32_t nameLength = 0;
+			if (!read(&nameLength, sizeof(nameLength))) return false;
+			if (offset + nameLength > data.size()) return false;
+
+			clip.name.assign(reinterpret_cast<const char*>(data.data() + offset), nameLength);
+			offset += nameLength;
+			clip.nameHash = animation::HashName(clip.name.c_str());
+
+			if (!read(&clip.duration, sizeof(clip.duration))) return false;
+
+			// SoA channel arrays read as blobs - times first, then values
+			clip.tracks.resize(jointCount);
+			for (auto& track : clip.tracks) {
+				uint32_t counts[3];
+				if (!read(counts, sizeof(counts))) return false;
+
+				track.positionTimes.resize(counts[0]);
+				track.positions.resize(counts[0]);
+				track.rotationTimes.resize(counts[1]);
+				track.rotations.resize(counts[1]);
+				track.scaleTimes.resize(counts[2]);
+				track.scales.resize(counts[2]);
+				if (!read(track.positionTimes.data(), counts[0] * sizeof(float))) return false;
+				if (!read(track.positions.data(), counts[0] * sizeof(glm::vec3))) return false;
+				if (!read(track.rotationTimes.data(), counts[1] * sizeof(float))) return false;
+				if (!read(track.rotations.data(), counts[1] * sizeof(AnimationClip::PackedQuat))) return false;
+				if (!read(track.scaleTimes.data(), counts[2] * sizeof(float))) return false;
+				if (!read(track.scales.data(), counts[2] * sizeof(glm::vec3))) return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool Model::WriteCooked(const std::string& filename, const std::vector<Submesh>& submeshes) {
+		std::vector<uint8_t> data;
+
+		CookedHeader header{ kCookedMagic, kCookedVersion, (uint32_t)submeshes.size() };
+		auto append = [&data](const void* src, size_t size) {
+			const uint8_t* bytes = static_cast<const uint8_t*>(src);
+			data.insert(data.end(), bytes, bytes + size);
+		};
+
+		append(&header, sizeof(header));
+		for (auto& submesh : submeshes) {
+			CookedSubmesh info{ (uint32_t)submesh.lods.size(), submesh.bounds.min, submesh.bounds.max };
+			append(&info, sizeof(info));
+
+			for (auto& lod : submesh.lods) {
+				CookedLod lodInfo{ (uint32_t)lod.vertices.size(), (uint32_t)lod.indices.size(), (uint32_t)lod.skin.size() };
+				append(&lodInfo, sizeof(lodInfo));
+				append(lod.vertices.data(), lod.vertices.size() * sizeof(VertexPacked));
+				append(lod.indices.data(), lod.indices.size() * sizeof(GLuint));
+				append(lod.skin.data(), lod.skin.size() * sizeof(VertexSkin));
+			}
+		}
+
+		// skeleton and clip chunks - fields append individually so struct
+		// padding never lands in the file
+		uint32_t jointCount = (uint32_t)m_skeleton.joints.size();
+		append(&jointCount, sizeof(jointCount));
+		for (auto& joint : m_skeleton.joints) {
+			append(&joint.nameHash, sizeof(joint.nameHash));
+			append(&joint.parent, sizeof(joint.parent));
+			append(&joint.localBind, sizeof(joint.localBind));
+			append(&joint.inverseBind, sizeof(joint.inverseBind));
+		}
+
+		uint32_t clipCount = (uint32_t)m_clips.size();
+		append(&clipCount, sizeof(clipCount));
+		for (auto& clip : m_clips) {
+			uint32_t nameLength = (uint32_t)clip.name.size();
+			append(&nameLength, sizeof(nameLength));
+			append(clip.name.data(), nameLength);
+			append(&clip.duration, sizeof(clip.duration));
+
+			for (auto& track : clip.tracks) {
+				uint32_t counts[3] = { (uint32_t)track.positions.size(), (uint32_t)track.rotations.size(), (uint32_t)track.scales.size() };
+				append(counts, sizeof(counts));
+				append(track.positionTimes.data(), track.positionTimes.size() * sizeof(float));
+				append(track.positions.data(), track.positions.size() * sizeof(glm::vec3));
+				append(track.rotationTimes.data(), track.rotationTimes.size() * sizeof(float));
+				append(track.rotations.data(), track.rotations.size() * sizeof(AnimationClip::PackedQuat));
+				append(track.scaleTimes.data(), track.scaleTimes.size() * sizeof(float));
+				append(track.scales.data(), track.scales.size() * sizeof(glm::vec3));
+			}
+		}
+
+		if (!file::WriteBinaryFile(filename, data)) {
+			LOG_CAT_WARNING(Renderer, "Could not write cooked model: {}", filename);
+			return false;
+		}
+
+		return true;
+	}
+
+	void Model::CreateVertexBuffers(const std::vector<Submesh>& submeshes, const std::string& filename) {
+		for (auto& submesh : submeshes) {
+			// model bounds enclose every submesh bound
+			m_bounds.Encapsulate(submesh.bounds);
+
+			// one buffer set per cooked LOD
+			fixed_vector<res_t<VertexBuffer>, kLodCount> lodBuffers;
+			for (auto& lod : submesh.lods) {
+				auto vertexBuffer = std::make_shared<VertexBuffer>();
+				vertexBuffer->CreateVertexBuffer((GLsizei)(sizeof(VertexPacked) * lod.vertices.size()), (GLsizei)lod.vertices.size(), (GLvoid*)lod.vertices.data());
+
+				// compressed layout - the normalized/half attribute types expand
+				// to the floats the shaders declare, packed formats require size 4
+				vertexBuffer->SetAttribute(0, 3, GL_FLOAT, GL_FALSE, sizeof(VertexPacked), offsetof(VertexPacked, position));
+				vertexBuffer->SetAttribute(1, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(VertexPacked), offsetof(VertexPacked, texcoord));
+				vertexBuffer->SetAttribute(2, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(VertexPacked), offsetof(VertexPacked, normal));
+				vertexBuffer->SetAttribute(3, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(VertexPacked), offsetof(VertexPacked, tangent));
+
+				// skinned meshes attach the parallel influence stream - joint
+				// indices stay unnormalized (the shader reads them back as
+				// ints), weights expand to [0,1]
+				if (!lod.skin.empty()) {
+					vertexBuffer->CreateSkinBuffer((GLsizei)(sizeof(VertexSkin) * lod.skin.size()), lod.skin.data());
+					vertexBuffer->SetAttribute(skinJointsAttribute, 4, GL_UNSIGNED_BYTE, GL_FALSE, sizeof(VertexSkin), offsetof(VertexSkin, joints));
+					vertexBuffer->SetAttribute(skinWeightsAttribute, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(VertexSkin), offsetof(VertexSkin, weights));
+					m_memorySize += sizeof(VertexSkin) * lod.skin.size();
+				}
+
+				// create index vertex buffer
+				vertexBuffer->CreateIndexBuffer(GL_UNSIGNED_INT, (GLsizei)lod.indices.size(), (GLvoid*)lod.indices.data());
+
+				// name the buffers after the source file for GPU captures
+				vertexBuffer->SetLabel(std::format("{}[{}] lod{}", filename, m_vertexBuffers.size(), lodBuffers.size()));
+
+				lodBuffers.push_back(vertexBuffer);
+
+				// account the GPU bytes for the resource budget
+				m_memorySize += sizeof(VertexPacked) * lod.vertices.size() + sizeof(GLuint) * lod.indices.size();
+			}
+
+			// full-detail buffer doubles into the flat list the batching and
+			// instancing paths use
+			m_vertexBuffers.push_back(lodBuffers.front());
+			m_lodCount = math::max(m_lodCount, (int)lodBuffers.size());
+			m_lodBuffers.push_back(std::move(lodBuffers));
+		}
+	}
+
+	void Model::Draw(int lod, GLenum primitiveType) {
+		for (auto& buffers : m_lodBuffers) {
+			// clamp to the submesh's deepest cooked level
+			buffers[math::min((size_t)math::max(lod, 0), buffers.size() - 1)]->Draw(primitiveType);
+		}
+	}
+
+	void Model::DrawInstanced(GLsizei instanceCount, GLenum primitiveType) {
 		for (auto& vertexBuffer : m_vertexBuffers) {
-			vertexBuffer->Draw(primitiveType);
+			vertexBuffer->DrawInstanced(instanceCount, primitiveType);
 		}
 	}
 
-	void Model::ProcessNode(aiNode* node, const aiScene* scene) {
-		// process the current node meshes
+	void Model::SetInstanceData(const glm::mat4* transforms, size_t count) {
+		for (auto& vertexBuffer : m_vertexBuffers) {
+			vertexBuffer->CreateInstanceBuffer((GLsizei)(sizeof(glm::mat4) * count), (GLsizei)count, transforms);
+
+			// a mat4 attribute takes four consecutive vec4 attribute slots
+			for (int i = 0; i < 4; i++) {
+				vertexBuffer->SetInstanceAttribute(instanceMatrixAttribute + i, 4, sizeof(glm::mat4), (GLuint)(sizeof(glm::vec4) * i));
+			}
+		}
+	}
+
+	void Model::ProcessNode(aiNode* node, const aiScene* scene, std::vector<aiMesh*>& meshes) {
+		// gather the current node meshes
 		for (unsigned int i = 0; i < node->mNumMeshes; i++) {
-			aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
-			ProcessMesh(mesh, scene);
+			meshes.push_back(scene->mMeshes[node->mMeshes[i]]);
 		}
-		// process the current node children
+		// gather the current node children
 		for (unsigned int i = 0; i < node->mNumChildren; i++) {
-			ProcessNode(node->mChildren[i], scene);
+			ProcessNode(node->mChildren[i], scene, meshes);
 		}
 	}
 
-	void Model::ProcessMesh(aiMesh* mesh, const aiScene* scene) {
-		std::vector<Vertex> vertices;
+	void Model::ProcessMesh(aiMesh* mesh, const aiScene* scene, Submesh& submesh) {
+		submesh.lods.resize(1);
+		std::vector<VertexPacked>& vertices = submesh.lods[0].vertices;
+		vertices.resize(mesh->mNumVertices);
 
-		// get model vertex attributes
+		// per-stream conversion - each loop reads one source array in order
+		// and writes one packed field, which the compiler can vectorize
+		// where the old per-vertex, per-field version could not. Compression
+		// loses well under a degree on unit normals/tangents at 10 bits and
+		// keeps texcoords exact to ~1/2048 over [0,1] as halves
 		for (size_t i = 0; i < mesh->mNumVertices; i++) {
-			Vertex vertex;
+			glm::vec3 position{ mesh->mVertices[i].x, mesh->mVertices[i].y, mesh->mVertices[i].z };
+			vertices[i].position = position;
+			submesh.bounds.Encapsulate(position);
+		}
 
-			vertex.position = glm::vec3{ mesh->mVertices[i].x, mesh->mVertices[i].y, mesh->mVertices[i].z };
+		if (mesh->mTextureCoords[0]) {
+			for (size_t i = 0; i < mesh->mNumVertices; i++) {
+				vertices[i].texcoord = glm::packHalf2x16(glm::vec2{ mesh->mTextureCoords[0][i].x, mesh->mTextureCoords[0][i].y });
+			}
+		}
+		else {
+			uint32_t zero = glm::packHalf2x16(glm::vec2{ 0, 0 });
+			for (size_t i = 0; i < mesh->mNumVertices; i++) vertices[i].texcoord = zero;
+		}
 
-			vertex.texcoord = (mesh->mTextureCoords[0])
-				? glm::vec2{ mesh->mTextureCoords[0][i].x, mesh->mTextureCoords[0][i].y }
-			: glm::vec2{ 0, 0 };
+		if (mesh->mNormals) {
+			for (size_t i = 0; i < mesh->mNumVertices; i++) {
+				vertices[i].normal = glm::packSnorm3x10_1x2(glm::vec4{ mesh->mNormals[i].x, mesh->mNormals[i].y, mesh->mNormals[i].z, 0 });
+			}
+		}
+		else {
+			uint32_t zero = glm::packSnorm3x10_1x2(glm::vec4{ 0 });
+			for (size_t i = 0; i < mesh->mNumVertices; i++) vertices[i].normal = zero;
+		}
 
-			vertex.normal = (mesh->mNormals)
-				? glm::vec3{ mesh->mNormals[i].x, mesh->mNormals[i].y, mesh->mNormals[i].z }
-			: glm::vec3{ 0, 0, 0 };
+		if (mesh->mTangents) {
+			for (size_t i = 0; i < mesh->mNumVertices; i++) {
+				vertices[i].tangent = glm::packSnorm3x10_1x2(glm::vec4{ mesh->mTangents[i].x, mesh->mTangents[i].y, mesh->mTangents[i].z, 0 });
+			}
+		}
+		else {
+			uint32_t zero = glm::packSnorm3x10_1x2(glm::vec4{ 0 });
+			for (size_t i = 0; i < mesh->mNumVertices; i++) vertices[i].tangent = zero;
+		}
 
-			vertex.tangent = (mesh->mTangents)
-				? glm::vec3{ mesh->mTangents[i].x, mesh->mTangents[i].y, mesh->mTangents[i].z }
-			: glm::vec3{ 0, 0, 0 };
+		// triangulated on import, so faces hold three indices each - size
+		// exactly and bulk-copy each face's range instead of pushing one
+		// index at a time through capacity growth
+		std::vector<GLuint>& indices = submesh.lods[0].indices;
+		indices.reserve((size_t)mesh->mNumFaces * 3);
+		for (size_t i = 0; i < mesh->mNumFaces; i++) {
+			const aiFace& face = mesh->mFaces[i];
+			indices.insert(indices.end(), face.mIndices, face.mIndices + face.mNumIndices);
+		}
+
+		// fill the parallel skin stream - keep the four strongest influences
+		// per vertex (the import already capped at four) and renormalize the
+		// byte weights so each vertex sums to 255
+		if (mesh->HasBones() && !m_skeleton.joints.empty()) {
+			std::vector<VertexSkin>& skin = submesh.lods[0].skin;
+			skin.resize(mesh->mNumVertices, VertexSkin{});
+
+			std::vector<glm::vec4> influenceWeights(mesh->mNumVertices, glm::vec4{ 0 });
+			std::vector<glm::ivec4> influenceJoints(mesh->mNumVertices, glm::ivec4{ 0 });
+
+			for (unsigned int b = 0; b < mesh->mNumBones; b++) {
+				aiBone* bone = mesh->mBones[b];
+				int joint = m_skeleton.FindJoint(animation::HashName(bone->mName.C_Str()));
+				if (joint < 0) continue;
 
-			vertices.push_back(vertex);
+				for (unsigned int w = 0; w < bone->mNumWeights; w++) {
+					auto& weight = bone->mWeights[w];
+
+					// replace the weakest slot when this influence is stronger
+					int slot = 0;
+					for (int s = 1; s < 4; s++) {
+						if (influenceWeights[weight.mVertexId][s] < influenceWeights[weight.mVertexId][slot]) slot = s;
+					}
+					if (weight.mWeight > influenceWeights[weight.mVertexId][slot]) {
+						influenceWeights[weight.mVertexId][slot] = weight.mWeight;
+						influenceJoints[weight.mVertexId][slot] = joint;
+					}
+				}
+			}
+
+			for (size_t i = 0; i < skin.size(); i++) {
+				float sum = influenceWeights[i].x + influenceWeights[i].y + influenceWeights[i].z + influenceWeights[i].w;
+				if (sum <= 0) {
+					// unweighted vertex - pin it to the root joint
+					skin[i].weights[0] = 255;
+					continue;
+				}
+				for (int s = 0; s < 4; s++) {
+					skin[i].joints[s] = (uint8_t)influenceJoints[i][s];
+					skin[i].weights[s] = (uint8_t)math::clamp((int)std::lround(influenceWeights[i][s] / sum * 255.0f), 0, 255);
+				}
+			}
 		}
 
-		// create vertex buffer and attributes
-		auto vertexBuffer = std::make_shared<VertexBuffer>();
-		vertexBuffer->CreateVertexBuffer((GLsizei)(sizeof(Vertex) * vertices.size()), (GLsizei)vertices.size(), vertices.data());
-		vertexBuffer->SetAttribute(0, 3, sizeof(Vertex), offsetof(Vertex, position));
-		vertexBuffer->SetAttribute(1, 2, sizeof(Vertex), offsetof(Vertex, texcoord));
-		vertexBuffer->SetAttribute(2, 3, sizeof(Vertex), offsetof(Vertex, normal));
-		vertexBuffer->SetAttribute(3, 3, sizeof(Vertex), offsetof(Vertex, tangent));
+		submesh.materialIndex = mesh->mMaterialIndex;
+	}
 
-		// get model index vertices
-		std::vector<GLuint> indices;
-		for (size_t i = 0; i < mesh->mNumFaces; i++)
-		{
-			aiFace face = mesh->mFaces[i];
-			for (size_t j = 0; j < face.mNumIndices; j++)
-			{
-				indices.push_back(face.mIndices[j]);
+	void Model::MergeSubmeshes(std::vector<Submesh>& submeshes) {
+		if (submeshes.size() < 2) return;
+		size_t importedCount = submeshes.size();
+
+		// merge runs before the LOD build, so every submesh is one level.
+		// Rigid and skinned parts never combine - the skin stream must
+		// parallel the merged vertices or stay absent entirely
+		std::vector<Submesh> merged;
+		for (auto& submesh : submeshes) {
+			Submesh* target = nullptr;
+			for (auto& candidate : merged) {
+				if (candidate.materialIndex != submesh.materialIndex) continue;
+				if (candidate.lods[0].skin.empty() != submesh.lods[0].skin.empty()) continue;
+				target = &candidate;
+				break;
+			}
+
+			if (!target) {
+				merged.push_back(std::move(submesh));
+				continue;
+			}
+
+			auto& into = target->lods[0];
+			auto& from = submesh.lods[0];
+
+			// rebase the incoming indices past the existing vertices
+			GLuint base = (GLuint)into.vertices.size();
+			into.vertices.insert(into.vertices.end(), from.vertices.begin(), from.vertices.end());
+			into.skin.insert(into.skin.end(), from.skin.begin(), from.skin.end());
+			for (auto index : from.indices) into.indices.push_back(base + index);
+
+			target->bounds.Encapsulate(submesh.bounds);
+		}
+
+		if (merged.size() < importedCount) {
+			LOG_CAT_INFO(Renderer, "Merged {} submeshes into {} by material", importedCount, merged.size());
+		}
+		submeshes = std::move(merged);
+	}
+
+	void Model::ProcessSkeleton(const aiScene* scene) {
+		// gather every bone name and its inverse bind across the meshes
+		std::unordered_map<std::string, aiMatrix4x4> boneOffsets;
+		for (unsigned int m = 0; m < scene->mNumMeshes; m++) {
+			aiMesh* mesh = scene->mMeshes[m];
+			for (unsigned int b = 0; b < mesh->mNumBones; b++) {
+				aiBone* bone = mesh->mBones[b];
+				boneOffsets.try_emplace(bone->mName.C_Str(), bone->mOffsetMatrix);
+			}
+		}
+		if (boneOffsets.empty()) return;
+
+		// mark the bone nodes and every ancestor so the emitted hierarchy is
+		// closed under parenting
+		std::unordered_set<const aiNode*> needed;
+		for (auto& [name, offset] : boneOffsets) {
+			for (const aiNode* node = scene->mRootNode->FindNode(name.c_str()); node; node = node->mParent) {
+				if (!needed.insert(node).second) break;
+			}
+		}
+
+		EmitJoints(scene->mRootNode, -1, needed, boneOffsets, m_skeleton);
+
+		// the skin stream stores byte joint indices
+		if (m_skeleton.joints.size() > 256) {
+			LOG_CAT_WARNING(Renderer, "Skeleton has {} joints, the skin stream indexes at most 256", m_skeleton.joints.size());
+		}
+	}
+
+	void Model::ProcessAnimations(const aiScene* scene) {
+		if (m_skeleton.joints.empty()) return;
+
+		for (unsigned int a = 0; a < scene->mNumAnimations; a++) {
+			const aiAnimation* sceneAnimation = scene->mAnimations[a];
+			double ticksPerSecond = (sceneAnimation->mTicksPerSecond != 0) ? sceneAnimation->mTicksPerSecond : 25.0;
+
+			AnimationClip clip;
+			clip.name = sceneAnimation->mName.C_Str();
+			clip.nameHash = animation::HashName(clip.name.c_str());
+			clip.duration = (float)(sceneAnimation->mDuration / ticksPerSecond);
+			clip.tracks.resize(m_skeleton.joints.size());
+
+			size_t rawKeys = 0;
+			size_t keptKeys = 0;
+			for (unsigned int c = 0; c < sceneAnimation->mNumChannels; c++) {
+				const aiNodeAnim* channel = sceneAnimation->mChannels[c];
+				int joint = m_skeleton.FindJoint(animation::HashName(channel->mNodeName.C_Str()));
+				if (joint < 0) continue;
+
+				// gather the raw keys, then keyframe reduction and rotation
+				// quantization compress them into the track's SoA storage
+				std::vector<AnimationClip::Key<glm::vec3>> positions;
+				std::vector<AnimationClip::Key<glm::quat>> rotations;
+				std::vector<AnimationClip::Key<glm::vec3>> scales;
+
+				positions.reserve(channel->mNumPositionKeys);
+				for (unsigned int k = 0; k < channel->mNumPositionKeys; k++) {
+					auto& key = channel->mPositionKeys[k];
+					positions.push_back({ (float)(key.mTime / ticksPerSecond), { key.mValue.x, key.mValue.y, key.mValue.z } });
+				}
+				rotations.reserve(channel->mNumRotationKeys);
+				for (unsigned int k = 0; k < channel->mNumRotationKeys; k++) {
+					auto& key = channel->mRotationKeys[k];
+					rotations.push_back({ (float)(key.mTime / ticksPerSecond), glm::quat{ key.mValue.w, key.mValue.x, key.mValue.y, key.mValue.z } });
+				}
+				scales.reserve(channel->mNumScalingKeys);
+				for (unsigned int k = 0; k < channel->mNumScalingKeys; k++) {
+					auto& key = channel->mScalingKeys[k];
+					scales.push_back({ (float)(key.mTime / ticksPerSecond), { key.mValue.x, key.mValue.y, key.mValue.z } });
+				}
+
+				rawKeys += channel->mNumPositionKeys + channel->mNumRotationKeys + channel->mNumScalingKeys;
+
+				auto& track = clip.tracks[joint];
+				animation::BuildTrack(positions, rotations, scales, track);
+				keptKeys += track.positions.size() + track.rotations.size() + track.scales.size();
+			}
+
+			if (rawKeys > 0) {
+				LOG_CAT_INFO(Renderer, "Clip \"{}\": reduced {} keys to {}", clip.name, rawKeys, keptKeys);
 			}
+
+			m_clips.push_back(std::move(clip));
 		}
 
-		// create index vertex buffer
-		vertexBuffer->CreateIndexBuffer(GL_UNSIGNED_INT, (GLsizei)indices.size(), indices.data());
+		if (!m_clips.empty()) {
+			LOG_CAT_INFO(Renderer, "Imported {} animation clips over {} joints", m_clips.size(), m_skeleton.joints.size());
+		}
+	}
 
-		// add vertex buffer to vertex buffers
-		m_vertexBuffers.push_back(vertexBuffer);
+	const AnimationClip* Model::FindClip(const std::string& name) const {
+		uint64_t hash = animation::HashName(name.c_str());
+		for (auto& clip : m_clips) {
+			if (clip.nameHash == hash) return &clip;
+		}
+		return nullptr;
+	}
+
+	void Model::OptimizeSubmeshes(std::vector<Submesh>& submeshes) {
+		for (auto& submesh : submeshes) {
+			// skinned submeshes skip the optimization passes - welding and
+			// the fetch reorder remap vertices, which would desync the
+			// parallel skin stream, and the simplifier has no joint-aware
+			// collapse. Characters are also rarely the triangle bottleneck
+			if (!submesh.lods[0].skin.empty()) continue;
+
+			auto& base = submesh.lods[0];
+			size_t importedVertices = base.vertices.size();
+
+			// weld first so simplification and the cache pass see real
+			// shared vertices
+			WeldVertices(base.vertices, base.indices);
+
+			// grow the LOD chain off the welded base, stopping early when a
+			// level no longer removes triangles (small meshes bottom out)
+			float extent = math::max(submesh.bounds.max.x - submesh.bounds.min.x,
+				math::max(submesh.bounds.max.y - submesh.bounds.min.y, submesh.bounds.max.z - submesh.bounds.min.z));
+			for (int level = 1; level < kLodCount && extent > 0; level++) {
+				Submesh::Lod lod = SimplifyLod(base, submesh.bounds, extent * kLodCellFraction[level]);
+				if (lod.indices.empty() || lod.indices.size() >= submesh.lods.back().indices.size()) break;
+
+				submesh.lods.push_back(std::move(lod));
+			}
+
+			// per level: cache order, then cluster sort (which keeps cache
+			// order inside a cluster), fetch reorder last since it only
+			// permutes the vertex buffer to match the final index stream
+			for (auto& lod : submesh.lods) {
+				OptimizeVertexCache(lod.indices, lod.vertices.size());
+				SortForOverdraw(lod.vertices, lod.indices);
+				OptimizeVertexFetch(lod.vertices, lod.indices);
+			}
+
+			if (base.vertices.size() < importedVertices) {
+				LOG_CAT_INFO(Renderer, "Welded {} duplicate vertices ({} -> {})", importedVertices - base.vertices.size(), importedVertices, base.vertices.size());
+			}
+			if (submesh.lods.size() > 1) {
+				LOG_CAT_INFO(Renderer, "Cooked {} LOD levels ({} -> {} triangles)", submesh.lods.size(), base.indices.size() / 3, submesh.lods.back().indices.size() / 3);
+			}
+		}
 	}
 }
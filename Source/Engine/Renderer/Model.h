@@ -1,6 +1,9 @@
 #pragma once
 #include "Resources/Resource.h"
 #include "VertexBuffer.h"
+#include "Animation.h"
+#include "Core/SmallVector.h"
+#include "Math/Bounds.h"
 #include <vector>
 
 
@@ -11,25 +14,157 @@ struct aiScene;
 namespace neu {
 	class Model : public Resource {
 	public:
-		// vertex attributes
-		struct Vertex {
+		// compressed GPU vertex layout: normals/tangents as snorm 10:10:10:2
+		// (GL_INT_2_10_10_10_REV, normalized), UVs as half floats - the
+		// attribute declaration converts, so shaders still see plain floats.
+		// positions stay full float; halving them needs a per-mesh dequantize
+		// uniform in every program. 24 bytes per vertex instead of 44
+		struct VertexPacked {
 			glm::vec3 position;
-			glm::vec2 texcoord;
-			glm::vec3 normal;
-			glm::vec3 tangent;
+			uint32_t texcoord;	// 2 x half float
+			uint32_t normal;	// snorm 10:10:10:2
+			uint32_t tangent;	// snorm 10:10:10:2
 		};
 
+		// per-vertex skinning influences - a parallel second stream so rigid
+		// meshes pay nothing for it. Four strongest joints per vertex, byte
+		// weights renormalized to sum 255 at cook time
+		struct VertexSkin {
+			uint8_t joints[4];
+			uint8_t weights[4];
+		};
+
+		// the attribute setup in CreateVertexBuffers and the cooked file
+		// format both bake these layouts in - fail the build if either
+		// struct picks up padding or reorders instead of corrupting meshes
+		// at runtime
+		static_assert(sizeof(VertexPacked) == 24, "VertexPacked must stay 24 bytes - cooked meshes and attribute strides assume it");
+		static_assert(sizeof(VertexSkin) == 8, "VertexSkin must stay 8 bytes - cooked meshes and attribute strides assume it");
+		static_assert(alignof(VertexPacked) == alignof(float), "VertexPacked alignment must match float so packed arrays stay gapless");
+		static_assert(sizeof(glm::mat4) == 16 * sizeof(float), "instance matrix attributes assume a tightly packed mat4");
+
+	public:
+		// attribute locations 0-3 hold the vertex stream, the per-instance model
+		// matrix occupies the next four vec4 slots
+		static constexpr int instanceMatrixAttribute = 4;
+
+		// skinning stream attributes, past the instance matrix's four slots -
+		// joints as unnormalized bytes (the shader casts to int), weights
+		// normalized to [0,1]
+		static constexpr int skinJointsAttribute = 8;
+		static constexpr int skinWeightsAttribute = 9;
+
+		// detail levels the cooker generates - level 0 is the import, each
+		// further level clusters onto a coarser grid (chains can end early
+		// when simplification bottoms out on small meshes)
+		static constexpr int kLodCount = 4;
+
 	public:
 		bool Load(const std::string& filename);
-		void Draw(GLenum primitiveType = GL_TRIANGLES);
+
+		// hot reload: drops the GL buffers and re-runs Load in place (the
+		// stale cooked sibling revalidates against the edited source, so a
+		// changed import re-cooks). Geometry merged into the static batcher
+		// keeps its batched copy until the scene rebuilds it
+		bool Reload(const std::string& filename) override;
+
+		void Draw(GLenum primitiveType = GL_TRIANGLES) { Draw(0, primitiveType); }
+		void Draw(int lod, GLenum primitiveType);
+		void DrawInstanced(GLsizei instanceCount, GLenum primitiveType = GL_TRIANGLES);
+
+		// deepest cooked level across the submeshes; draws past a submesh's
+		// own chain clamp to its last level
+		int GetLodCount() const { return m_lodCount; }
+
+		// uploads per-instance model matrices into every submesh instance stream
+		void SetInstanceData(const glm::mat4* transforms, size_t count);
+
+		// local-space AABB enclosing every submesh, computed at load time
+		const Bounds& GetBounds() const { return m_bounds; }
+
+		// per-submesh full-detail GL buffers, read by StaticBatcher when
+		// merging static geometry into shared buffers
+		const small_vector<res_t<VertexBuffer>, 4>& GetVertexBuffers() const { return m_vertexBuffers; }
+
+		// skinning data cooked from the import - absent for rigid models
+		bool IsSkinned() const { return !m_skeleton.joints.empty(); }
+		const Skeleton& GetSkeleton() const { return m_skeleton; }
+		const std::vector<AnimationClip>& GetClips() const { return m_clips; }
+		const AnimationClip* FindClip(const std::string& name) const;
+
+		// GPU vertex/index bytes for the resource budget accounting
+		size_t GetMemorySize() const override { return m_memorySize; }
 
 		void UpdateGUI() override {};
 
 	private:
-		void ProcessNode(aiNode* node, const aiScene* scene);
-		void ProcessMesh(aiMesh* mesh, const aiScene* scene);
+		// CPU-side mesh data, either packed from an Assimp import or read from
+		// the cooked binary, used to create GL buffers and to write the cooked
+		// file - vertices are already in the compressed GPU layout
+		struct Submesh {
+			// one detail level's buffers - lods[0] is the full mesh. The skin
+			// stream parallels vertices and stays empty for rigid meshes
+			struct Lod {
+				std::vector<VertexPacked> vertices;
+				std::vector<GLuint> indices;
+				std::vector<VertexSkin> skin;
+			};
+			std::vector<Lod> lods;
+			Bounds bounds;
+
+			// source material slot from the import - only used by the cook-
+			// time merge pass, the engine binds one Material per model draw
+			uint32_t materialIndex{ 0 };
+		};
+
+	private:
+		// the import walks the node tree gathering meshes, then converts
+		// them in parallel jobs (one Submesh per aiMesh, independent
+		// outputs) before the serialized GL buffer creation
+		void ProcessNode(aiNode* node, const aiScene* scene, std::vector<aiMesh*>& meshes);
+		void ProcessMesh(aiMesh* mesh, const aiScene* scene, Submesh& submesh);
+
+		// skinning import - the joint hierarchy is built first (closed over
+		// every bone-referenced node), then meshes fill their skin streams
+		// against it and clips resolve their channels to joint indices
+		void ProcessSkeleton(const aiScene* scene);
+		void ProcessAnimations(const aiScene* scene);
+
+		// cook-time draw reduction: concatenate submeshes that share a
+		// source material into one vertex/index range - DCC exports split
+		// props into dozens of parts that all bind the same material, and
+		// each surviving submesh is one draw at runtime
+		void MergeSubmeshes(std::vector<Submesh>& submeshes);
+
+		// cook-time GPU optimization: weld duplicate vertices, reorder
+		// indices for the post-transform cache, sort triangle clusters to
+		// cut overdraw, then reorder vertices into fetch order - results
+		// land in the cooked file so the import cost is paid once
+		void OptimizeSubmeshes(std::vector<Submesh>& submeshes);
+
+		void CreateVertexBuffers(const std::vector<Submesh>& submeshes, const std::string& filename);
+
+		// cooked binary model format - header, submesh table, raw vertex/index
+		// blobs matching the VertexPacked layout so loading is a single read + upload
+		bool LoadCooked(const std::string& filename, std::vector<Submesh>& submeshes);
+		bool WriteCooked(const std::string& filename, const std::vector<Submesh>& submeshes);
+		static std::string GetCookedFilename(const std::string& filename);
 
 	private:
-		std::vector<res_t<VertexBuffer>> m_vertexBuffers;
+		// flat full-detail buffers (one per submesh) for the batching and
+		// instancing paths, plus the per-submesh LOD chains for Draw(lod) -
+		// m_lodBuffers[submesh][lod], index 0 shares the flat list's buffers.
+		// Inline storage covers typical submesh counts; the LOD chain's cap
+		// is the cooker's kLodCount by construction
+		small_vector<res_t<VertexBuffer>, 4> m_vertexBuffers;
+		std::vector<fixed_vector<res_t<VertexBuffer>, kLodCount>> m_lodBuffers;
+		int m_lodCount{ 1 };
+		Bounds m_bounds;
+		size_t m_memorySize{ 0 };
+
+		// skeleton and clips stay resident (unlike the geometry, which lives
+		// only in GL buffers) - AnimationComponent samples them every frame
+		Skeleton m_skeleton;
+		std::vector<AnimationClip> m_clips;
 	};
 }
@@ -0,0 +1,131 @@
+#include "PostProcessPipeline.h"
+#include "Renderer.h"
+#include "Components/PostProcessComponent.h"
+#include "Core/Quality.h"
+
+namespace neu {
+	PostProcessPipeline::~PostProcessPipeline() {
+		if (m_vao) glDeleteVertexArrays(1, &m_vao);
+	}
+
+	void PostProcessPipeline::Build(RenderGraph& graph, Renderer& renderer, RenderGraph::target_t source, PostProcessComponent& postprocess) {
+		RenderTexture* sourceTexture = graph.GetTexture(source);
+
+		// collect the enabled effects in declared order; a tier with post
+		// processing off leaves the chain empty and takes the plain blit
+		frame_vector<PostProcessComponent::Effect*> chain;
+		if (Quality::IsPostProcessEnabled()) {
+			for (auto& effect : postprocess.effects) {
+				if (effect.enabled && effect.program) chain.push_back(&effect);
+			}
+		}
+
+		// nothing enabled - present the scene color unmodified. The depth
+		// clear drops the previous frame's backbuffer depth before the GUI
+		if (chain.empty()) {
+			glm::ivec2 size = sourceTexture->GetSize();
+			graph.AddPass("Post Process", { source }, RenderGraph::backbuffer,
+				[&graph, &renderer, source, size]() {
+					glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+					glBindFramebuffer(GL_READ_FRAMEBUFFER, graph.GetTexture(source)->m_fbo);
+					glBlitFramebuffer(
+						0, 0, size.x, size.y,
+						0, 0, renderer.GetWidth(), renderer.GetHeight(),
+						GL_COLOR_BUFFER_BIT, GL_LINEAR);
+					glBindFramebuffer(GL_FRAMEBUFFER, 0);
+				});
+			return;
+		}
+
+		if (!m_vao) glGenVertexArrays(1, &m_vao);
+
+		// each effect reads the previous pass's target and writes a fresh
+		// transient (the graph aliases them down to a ping-pong pair); the
+		// last one writes the backbuffer
+		RenderGraph::target_t input = source;
+		for (size_t i = 0; i < chain.size(); i++) {
+			auto effect = chain[i];
+			bool last = (i == chain.size() - 1);
+
+			RenderGraph::target_t output = RenderGraph::backbuffer;
+			if (!last) {
+				// expensive effects (blurs) can run at half resolution -
+				// the next effect upsamples implicitly through sampling
+				RenderTargetDesc desc;
+				desc.width = effect->halfResolution ? math::max(sourceTexture->GetSize().x / 2, 1) : sourceTexture->GetSize().x;
+				desc.height = effect->halfResolution ? math::max(sourceTexture->GetSize().y / 2, 1) : sourceTexture->GetSize().y;
+				// intermediates inherit the scene color's format so an HDR
+				// chain isn't clipped to LDR between effects
+				desc.format = sourceTexture->GetFormat();
+				output = graph.CreateTarget(desc);
+			}
+
+			graph.AddPass("Post Process", { input }, output,
+				[this, &graph, &postprocess, effect, input, last]() {
+					if (last) glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+					auto& program = effect->program;
+					program->Use();
+					postprocess.Apply(*program);
+
+					Texture* inputTexture = graph.GetTexture(input);
+					inputTexture->SetActive(GL_TEXTURE0);
+					inputTexture->Bind();
+					// drop any material sampler left on the unit - the
+					// target samples with its own clamped state
+					GLState::BindSampler(0, 0);
+					program->SetUniform("u_baseMap", 0);
+
+					GLState::BindVertexArray(m_vao);
+					glDrawArrays(GL_TRIANGLES, 0, 3);
+					FrameStats::AddDraw(1);
+				});
+
+			input = output;
+		}
+	}
+
+	void PostProcessPipeline::BuildFXAA(RenderGraph& graph, RenderGraph::target_t source, RenderGraph::target_t output) {
+		if (!m_fxaaProgram) m_fxaaProgram = Resources().Get<Program>("Shaders/fxaa.prog");
+
+		// missing program - pass the scene color through unmodified so the
+		// frame still reaches its output (source and output match in size)
+		if (!m_fxaaProgram) {
+			graph.AddPass("FXAA", { source }, output,
+				[&graph, source, output]() {
+					RenderTexture* sourceTexture = graph.GetTexture(source);
+					if (output == RenderGraph::backbuffer) glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+					glBindFramebuffer(GL_READ_FRAMEBUFFER, sourceTexture->m_fbo);
+					glBlitFramebuffer(
+						0, 0, sourceTexture->GetSize().x, sourceTexture->GetSize().y,
+						0, 0, sourceTexture->GetSize().x, sourceTexture->GetSize().y,
+						GL_COLOR_BUFFER_BIT, GL_NEAREST);
+				});
+			return;
+		}
+
+		if (!m_vao) glGenVertexArrays(1, &m_vao);
+
+		graph.AddPass("FXAA", { source }, output,
+			[this, &graph, source, output]() {
+				// writing the backbuffer also drops its stale depth before
+				// the GUI, same as the post-process chain's final pass
+				if (output == RenderGraph::backbuffer) glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+				m_fxaaProgram->Use();
+
+				Texture* sourceTexture = graph.GetTexture(source);
+				sourceTexture->SetActive(GL_TEXTURE0);
+				sourceTexture->Bind();
+				GLState::BindSampler(0, 0);
+				m_fxaaProgram->SetUniform("u_baseMap", 0);
+				m_fxaaProgram->SetUniform("u_texelSize", glm::vec2{
+					1.0f / sourceTexture->GetSize().x,
+					1.0f / sourceTexture->GetSize().y });
+
+				GLState::BindVertexArray(m_vao);
+				glDrawArrays(GL_TRIANGLES, 0, 3);
+				FrameStats::AddDraw(1);
+			});
+	}
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include "RenderGraph.h"
+
+namespace neu {
+	class Renderer;
+	class PostProcessComponent;
+
+	/// <summary>
+	/// Builds a camera's ordered post-process effect chain as render graph
+	/// passes. Each enabled effect reads the previous pass's output and
+	/// writes a transient graph target (half resolution for expensive
+	/// effects); the last enabled effect writes the backbuffer. The graph
+	/// aliases the transients by lifetime, so a chain of any length runs
+	/// over two pooled textures shared with every other consumer. The
+	/// fullscreen triangle is generated attribute-less from gl_VertexID,
+	/// so no scene geometry is involved.
+	/// </summary>
+	class PostProcessPipeline {
+	public:
+		~PostProcessPipeline();
+
+		/// <summary>
+		/// Declares the component's enabled effects as graph passes, reading
+		/// the scene color from source and presenting to the backbuffer.
+		/// With nothing enabled a single pass blits the source through
+		/// unmodified.
+		/// </summary>
+		/// <param name="graph">Frame graph the passes are declared into</param>
+		/// <param name="renderer">Renderer, for the backbuffer size</param>
+		/// <param name="source">Graph target holding the camera's scene color</param>
+		/// <param name="postprocess">Component holding the effect chain</param>
+		void Build(RenderGraph& graph, Renderer& renderer, RenderGraph::target_t source, PostProcessComponent& postprocess);
+
+		/// <summary>
+		/// Declares the single FXAA pass for the renderer's FXAA
+		/// anti-aliasing mode: one fullscreen triangle over the scene
+		/// color with luma-based edge blending - the cheap alternative to
+		/// MSAA for the low-end quality tier. Reads source, writes output
+		/// (the backbuffer, or a transient when an upscale follows).
+		/// </summary>
+		/// <param name="graph">Frame graph the pass is declared into</param>
+		/// <param name="source">Graph target holding the resolved scene color</param>
+		/// <param name="output">Graph target the anti-aliased image is written to</param>
+		void BuildFXAA(RenderGraph& graph, RenderGraph::target_t source, RenderGraph::target_t output);
+
+	private:
+		// empty VAO for the attribute-less fullscreen triangle
+		GLuint m_vao{ 0 };
+
+		// fullscreen FXAA program, loaded on first use
+		res_t<Program> m_fxaaProgram;
+	};
+}
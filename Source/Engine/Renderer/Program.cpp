@@ -1,5 +1,58 @@
 #include "EnginePCH.h"
 #include "Program.h"
+#include "Material.h"
+
+namespace {
+	// cached driver binary written next to the .prog file so subsequent runs
+	// skip GLSL compilation and linking entirely
+	constexpr uint32_t kBinaryMagic = 0x4752504e;	// "NPRG"
+	constexpr uint32_t kBinaryVersion = 1;
+
+	struct BinaryHeader {
+		uint32_t magic;
+		uint32_t version;
+		uint64_t hash;
+		uint32_t format;	// GLenum from glGetProgramBinary
+		uint32_t size;		// binary blob size in bytes
+	};
+
+	// FNV-1a accumulation - the cache key hashes the shader sources plus the
+	// driver/GL version strings, so shader edits and driver updates both
+	// invalidate the cached binary
+	uint64_t HashText(uint64_t hash, const char* text) {
+		if (!text) return hash;
+		while (*text) {
+			hash ^= static_cast<uint64_t>(static_cast<unsigned char>(*text++));
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	// define names for the variant bits, in Material::Parameters order -
+	// shaders specialize with #ifdef USE_* instead of branching on the
+	// parameter flags at runtime
+	constexpr const char* kVariantDefines[] = {
+		"USE_BASEMAP",
+		"USE_SPECULARMAP",
+		"USE_EMISSIVEMAP",
+		"USE_NORMALMAP",
+		"USE_CUBEMAP",
+		"USE_SHADOWMAP",
+	};
+
+	// the #define block a variant's shaders compile with, one line per set bit
+	std::string VariantDefines(uint32_t variantBits) {
+		std::string defines;
+		for (size_t i = 0; i < std::size(kVariantDefines); i++) {
+			if (variantBits & (1u << i)) {
+				defines += "#define ";
+				defines += kVariantDefines[i];
+				defines += '\n';
+			}
+		}
+		return defines;
+	}
+}
 
 neu::Program::Program()
 {
@@ -8,7 +61,10 @@ neu::Program::Program()
 
 neu::Program::~Program()
 {
-	if (m_program) glDeleteProgram(m_program);
+	if (m_program) {
+		GLState::InvalidateProgram(m_program);
+		glDeleteProgram(m_program);
+	}
 }
 
 void neu::Program::AttachShader(const res_t<Shader>& shader)
@@ -16,23 +72,66 @@ void neu::Program::AttachShader(const res_t<Shader>& shader)
 	glAttachShader(m_program, shader->m_shader);
 }
 
-bool neu::Program::Load(const std::string& filename) {
-	// load program document
-	serial::document_t document;
-	if (!serial::Load(filename, document)) {
-		LOG_WARNING("Could not load program file: {}", filename);
+std::string neu::Program::VariantId(const std::string& filename, uint32_t variantBits) {
+	// the bit-free permutation keeps the plain file name, so existing
+	// fetches by name keep hitting the same cache entry
+	if (variantBits == 0) return filename;
+	return std::format("{}#{:x}", filename, variantBits);
+}
+
+bool neu::Program::Load(const std::string& filename, uint32_t variantBits) {
+	// load program document through the shared parse cache - an async
+	// load's worker prefetch already parsed it, so this is a lookup
+	auto document = Resources().GetDocument(filename);
+	if (!document) {
+		LOG_CAT_WARNING(Renderer, "Could not load program file: {}", filename);
 		return false;
 	}
 
+	m_variantBits = variantBits;
+	std::string defines = VariantDefines(variantBits);
+
 	if (!m_program) m_program = glCreateProgram();
 
-	// get/add vertex shader
-	std::string shaderName;
-	SERIAL_READ_NAME(document, "vertex_shader", shaderName);
-	if (!shaderName.empty()) {
-		auto shader = neu::Resources().Get<neu::Shader>(shaderName, GL_VERTEX_SHADER);
+	// recorded in members so hot reload can relink this program by shader name
+	m_vertexShaderName.clear();
+	SERIAL_READ_NAME(*document, "vertex_shader", m_vertexShaderName);
+	m_fragmentShaderName.clear();
+	SERIAL_READ_NAME(*document, "fragment_shader", m_fragmentShaderName);
+	m_computeShaderName.clear();
+	SERIAL_READ_NAME(*document, "compute_shader", m_computeShaderName);
+
+	// key the binary cache off the preprocessed shader sources, the
+	// variant defines and the driver strings - hashing the resolved text
+	// avoids compiling anything on a cache hit, and an edited shared
+	// include invalidates the binary just like an edit to the shader file
+	uint64_t hash = 14695981039346656037ull;
+	std::string source;
+	if (!m_vertexShaderName.empty() && Shader::Preprocess(m_vertexShaderName, source)) hash = HashText(hash, source.c_str());
+	if (!m_fragmentShaderName.empty() && Shader::Preprocess(m_fragmentShaderName, source)) hash = HashText(hash, source.c_str());
+	if (!m_computeShaderName.empty() && Shader::Preprocess(m_computeShaderName, source)) hash = HashText(hash, source.c_str());
+	hash = HashText(hash, defines.c_str());
+	hash = HashText(hash, (const char*)glGetString(GL_VERSION));
+	hash = HashText(hash, (const char*)glGetString(GL_RENDERER));
+
+	// try the cached driver binary first, skipping compile and link
+	std::string binaryFilename = GetBinaryFilename(filename, variantBits);
+	if (LoadBinary(binaryFilename, hash)) {
+		GLDebug::Label(GL_PROGRAM, m_program, VariantId(filename, variantBits));
+		return true;
+	}
+
+	// cache miss (or stale/rejected binary) - compile from source; ask the
+	// driver to keep the binary retrievable so it can be cached after Link
+	glProgramParameteri(m_program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
+	// get/add vertex shader - variants fetch under the decorated id, so
+	// permutations of the same source cache separately while identical
+	// permutations across programs share one entry
+	if (!m_vertexShaderName.empty()) {
+		auto shader = neu::Resources().GetWithID<neu::Shader>(VariantId(m_vertexShaderName, variantBits), m_vertexShaderName, GL_VERTEX_SHADER, defines);
 		if (!shader) {
-			LOG_WARNING("Could not get vertex shader: {}", shaderName);
+			LOG_CAT_WARNING(Renderer, "Could not get vertex shader: {}", m_vertexShaderName);
 			glDeleteProgram(m_program);
 			m_program = 0;
 
@@ -41,12 +140,11 @@ bool neu::Program::Load(const std::string& filename) {
 		AttachShader(shader);
 	}
 
-	//std::string shaderName;
-	SERIAL_READ_NAME(document, "fragment_shader", shaderName);
-	if (!shaderName.empty()) {
-		auto shader = neu::Resources().Get<neu::Shader>(shaderName, GL_FRAGMENT_SHADER);
+	// get/add fragment shader
+	if (!m_fragmentShaderName.empty()) {
+		auto shader = neu::Resources().GetWithID<neu::Shader>(VariantId(m_fragmentShaderName, variantBits), m_fragmentShaderName, GL_FRAGMENT_SHADER, defines);
 		if (!shader) {
-			LOG_WARNING("Could not get vertex shader: {}", shaderName);
+			LOG_CAT_WARNING(Renderer, "Could not get fragment shader: {}", m_fragmentShaderName);
 			glDeleteProgram(m_program);
 			m_program = 0;
 
@@ -55,7 +153,221 @@ bool neu::Program::Load(const std::string& filename) {
 		AttachShader(shader);
 	}
 
-	return Link();
+	// get/add compute shader - a compute .prog is its own pipeline and
+	// normally declares no other stages
+	if (!m_computeShaderName.empty()) {
+		auto shader = neu::Resources().GetWithID<neu::Shader>(VariantId(m_computeShaderName, variantBits), m_computeShaderName, GL_COMPUTE_SHADER, defines);
+		if (!shader) {
+			LOG_CAT_WARNING(Renderer, "Could not get compute shader: {}", m_computeShaderName);
+			glDeleteProgram(m_program);
+			m_program = 0;
+
+			return false;
+		}
+		AttachShader(shader);
+	}
+
+	if (!Link()) return false;
+
+	// cache the linked binary for the next run
+	SaveBinary(binaryFilename, hash);
+
+	GLDebug::Label(GL_PROGRAM, m_program, VariantId(filename, variantBits));
+	return true;
+}
+
+void neu::Program::Prefetch(const std::string& filename) {
+	auto document = neu::Resources().GetDocument(filename);
+	if (!document) return;
+
+	// shaders compile on the context thread, so prefetching one means
+	// running the preprocessor - that warms the shared include cache and
+	// the OS file cache; each stage queues separately so the reads overlap
+	// with the rest of the composite's dependency tree
+	for (auto key : { "vertex_shader", "fragment_shader", "compute_shader" }) {
+		std::string name;
+		SERIAL_READ_NAME(*document, key, name);
+		if (!name.empty()) {
+			neu::Resources().QueueDependency(name, [name]() {
+				std::string source;
+				neu::Shader::Preprocess(name, source);
+			});
+		}
+	}
+}
+
+bool neu::Program::Reload(const std::string& filename)
+{
+	// the .prog document changed (e.g. points at different shader files) -
+	// detach whatever is attached and run the full load again; Load reuses
+	// the existing GL name, so material references stay valid
+	GLint count = 0;
+	glGetProgramiv(m_program, GL_ATTACHED_SHADERS, &count);
+	if (count > 0) {
+		std::vector<GLuint> attached(count);
+		glGetAttachedShaders(m_program, count, nullptr, attached.data());
+		for (GLuint shader : attached) glDetachShader(m_program, shader);
+	}
+
+	return Load(filename, m_variantBits);
+}
+
+bool neu::Program::UsesShader(const std::string& filename) const
+{
+	return equalsIgnoreCase(m_vertexShaderName, filename) || equalsIgnoreCase(m_fragmentShaderName, filename) || equalsIgnoreCase(m_computeShaderName, filename);
+}
+
+bool neu::Program::Relink()
+{
+	if (!m_program) return false;
+
+	// detach the stale objects - reloaded shaders compiled into fresh GL
+	// names, so the cached resources re-attached below carry the new code.
+	// Programs restored from a driver binary have nothing attached and pick
+	// up their shaders for the first time here
+	GLint count = 0;
+	glGetProgramiv(m_program, GL_ATTACHED_SHADERS, &count);
+	if (count > 0) {
+		std::vector<GLuint> attached(count);
+		glGetAttachedShaders(m_program, count, nullptr, attached.data());
+		for (GLuint shader : attached) glDetachShader(m_program, shader);
+	}
+
+	std::string defines = VariantDefines(m_variantBits);
+	if (!m_vertexShaderName.empty()) {
+		auto shader = Resources().GetWithID<Shader>(VariantId(m_vertexShaderName, m_variantBits), m_vertexShaderName, GL_VERTEX_SHADER, defines);
+		if (!shader) return false;
+		AttachShader(shader);
+	}
+	if (!m_fragmentShaderName.empty()) {
+		auto shader = Resources().GetWithID<Shader>(VariantId(m_fragmentShaderName, m_variantBits), m_fragmentShaderName, GL_FRAGMENT_SHADER, defines);
+		if (!shader) return false;
+		AttachShader(shader);
+	}
+	if (!m_computeShaderName.empty()) {
+		auto shader = Resources().GetWithID<Shader>(VariantId(m_computeShaderName, m_variantBits), m_computeShaderName, GL_COMPUTE_SHADER, defines);
+		if (!shader) return false;
+		AttachShader(shader);
+	}
+
+	glLinkProgram(m_program);
+
+	GLint success = false;
+	glGetProgramiv(m_program, GL_LINK_STATUS, &success);
+	if (!success) {
+		std::string infoLog(512, '\0');
+		GLsizei length;
+		glGetProgramInfoLog(m_program, (GLsizei)infoLog.size(), &length, &infoLog[0]);
+		infoLog.resize(length);
+
+		// keep the program object - the previously linked executable stays
+		// installed, so rendering survives until the shader is fixed
+		LOG_CAT_WARNING(Renderer, "Program relink failed: {}", infoLog);
+		return false;
+	}
+
+	BuildUniformTable();
+	BindUniformBlocks();
+	return true;
+}
+
+std::string neu::Program::GetBinaryFilename(const std::string& filename, uint32_t variantBits) {
+	// one cached binary per permutation, so variants don't evict each other
+	if (variantBits == 0) return filename + ".bin";
+	return std::format("{}.{:x}.bin", filename, variantBits);
+}
+
+bool neu::Program::LoadBinary(const std::string& filename, uint64_t hash) {
+	std::vector<uint8_t> data;
+	if (!file::ReadBinaryFile(filename, data)) return false;
+	if (data.size() < sizeof(BinaryHeader)) return false;
+
+	BinaryHeader header;
+	std::memcpy(&header, data.data(), sizeof(header));
+
+	// stale cache - shader sources or driver changed since it was written
+	if (header.magic != kBinaryMagic || header.version != kBinaryVersion || header.hash != hash) return false;
+	if (sizeof(BinaryHeader) + header.size > data.size()) return false;
+
+	glProgramBinary(m_program, (GLenum)header.format, data.data() + sizeof(BinaryHeader), (GLsizei)header.size);
+
+	// the driver may reject a binary it produced (e.g. after a GPU swap
+	// with matching version strings) - fall back to source compile
+	GLint success = false;
+	glGetProgramiv(m_program, GL_LINK_STATUS, &success);
+	if (!success) return false;
+
+	// same post-link setup as the source path
+	BuildUniformTable();
+	BindUniformBlocks();
+
+	return true;
+}
+
+bool neu::Program::SaveBinary(const std::string& filename, uint64_t hash) {
+	GLint length = 0;
+	glGetProgramiv(m_program, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0) return false;
+
+	std::vector<uint8_t> data(sizeof(BinaryHeader) + length);
+	GLenum format = 0;
+	GLsizei written = 0;
+	glGetProgramBinary(m_program, length, &written, &format, data.data() + sizeof(BinaryHeader));
+	if (written <= 0) return false;
+
+	BinaryHeader header{ kBinaryMagic, kBinaryVersion, hash, (uint32_t)format, (uint32_t)written };
+	std::memcpy(data.data(), &header, sizeof(header));
+	data.resize(sizeof(BinaryHeader) + written);
+
+	if (!file::WriteBinaryFile(filename, data)) {
+		LOG_CAT_WARNING(Renderer, "Could not write program binary cache: {}", filename);
+		return false;
+	}
+
+	return true;
+}
+
+void neu::Program::WarmUp(const std::string& manifestFilename) {
+	serial::document_t document;
+	if (!serial::Load(manifestFilename, document)) {
+		LOG_CAT_WARNING(Renderer, "Could not load program manifest: {}", manifestFilename);
+		return;
+	}
+
+	if (!SERIAL_CONTAINS(document, programs)) {
+		LOG_CAT_WARNING(Renderer, "Program manifest has no \"programs\" array: {}", manifestFilename);
+		return;
+	}
+
+	// fetching through the resource manager links (binary cache or source)
+	// and caches the program, so gameplay fetches later are free
+	int count = 0;
+	for (auto& item : SERIAL_AT(document, programs).GetArray()) {
+		if (!item.IsString()) continue;
+		if (Resources().Get<Program>(item.GetString())) count++;
+	}
+
+	// material entries pre-build the variant permutations shipped content
+	// references: each listed material document derives the bits its maps
+	// select, and fetching the variant links it (filling the binary cache
+	// on a cold run) here instead of at first sight in-game
+	if (SERIAL_CONTAINS(document, materials)) {
+		for (auto& item : SERIAL_AT(document, materials).GetArray()) {
+			if (!item.IsString()) continue;
+
+			auto materialDocument = Resources().GetDocument(item.GetString());
+			if (!materialDocument) continue;
+
+			std::string programName;
+			SERIAL_READ_NAME(*materialDocument, "program", programName);
+			if (programName.empty()) continue;
+
+			uint32_t variant = Material::ReadVariantBits(*materialDocument);
+			if (Resources().GetWithID<Program>(VariantId(programName, variant), programName, variant)) count++;
+		}
+	}
+
+	LOG_CAT_INFO(Renderer, "Warmed up {} programs from {}", count, manifestFilename);
 }
 
 bool neu::Program::Link()
@@ -71,7 +383,7 @@ bool neu::Program::Link()
 		glGetProgramInfoLog(m_program, (GLsizei)infoLog.size(), &length, &infoLog[0]);
 		infoLog.resize(length);
 
-		LOG_WARNING("Program link failed: {}", infoLog);
+		LOG_CAT_WARNING(Renderer, "Program link failed: {}", infoLog);
 
 		glDeleteProgram(m_program);
 		m_program = 0;
@@ -79,12 +391,147 @@ bool neu::Program::Link()
 		return false;
 	}
 
+	// build the uniform reflection table once so per-frame SetUniform calls
+	// never hit glGetUniformLocation or allocate strings
+	BuildUniformTable();
+
+	// wire the shared camera/light blocks to their fixed binding points
+	BindUniformBlocks();
+
 	return true;
 }
 
+void neu::Program::BindUniformBlocks()
+{
+	GLuint blockIndex = glGetUniformBlockIndex(m_program, "CameraBlock");
+	m_hasCameraBlock = (blockIndex != GL_INVALID_INDEX);
+	if (m_hasCameraBlock) glUniformBlockBinding(m_program, blockIndex, cameraBlockBinding);
+
+	blockIndex = glGetUniformBlockIndex(m_program, "LightBlock");
+	m_hasLightBlock = (blockIndex != GL_INVALID_INDEX);
+	if (m_hasLightBlock) glUniformBlockBinding(m_program, blockIndex, lightBlockBinding);
+
+	blockIndex = glGetUniformBlockIndex(m_program, "MaterialBlock");
+	m_hasMaterialBlock = (blockIndex != GL_INVALID_INDEX);
+	if (m_hasMaterialBlock) glUniformBlockBinding(m_program, blockIndex, materialBlockBinding);
+}
+
 void neu::Program::Use()
 {
-	glUseProgram(m_program);
+	FrameStats::AddProgramBind();
+	GLState::UseProgram(m_program);
+}
+
+void neu::Program::Dispatch(int count)
+{
+	if (count <= 0) return;
+
+	GLint groupSize = math::max(m_workGroupSize[0], 1);
+	Use();
+	glDispatchCompute((GLuint)((count + groupSize - 1) / groupSize), 1, 1);
+}
+
+void neu::Program::Dispatch(int x, int y, int z)
+{
+	Use();
+	glDispatchCompute((GLuint)x, (GLuint)y, (GLuint)z);
+}
+
+void neu::Program::BarrierIndirect()
+{
+	glMemoryBarrier(GL_COMMAND_BARRIER_BIT);
+}
+
+void neu::Program::BarrierStorage()
+{
+	glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+}
+
+void neu::Program::BuildUniformTable()
+{
+	m_uniforms.clear();
+	m_uniformLookup.clear();
+
+	GLint numUniforms = 0;
+	glGetProgramiv(m_program, GL_ACTIVE_UNIFORMS, &numUniforms);
+
+	GLint maxNameLength = 0;
+	glGetProgramiv(m_program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+	std::vector<GLchar> nameBuffer(math::max(maxNameLength, 1));
+
+	m_uniforms.reserve(numUniforms);
+	for (GLint i = 0; i < numUniforms; i++) {
+		GLsizei length = 0;
+		UniformInfo info;
+
+		glGetActiveUniform(m_program, i, (GLsizei)nameBuffer.size(), &length, &info.count, &info.type, nameBuffer.data());
+		info.name.assign(nameBuffer.data(), length);
+
+		// array uniforms are reported as "name[0]", strip the suffix so both
+		// "name" and "name[0]" hash to the same entry
+		size_t bracket = info.name.find("[0]");
+		if (bracket != std::string::npos) info.name.erase(bracket);
+
+		info.location = glGetUniformLocation(m_program, info.name.c_str());
+
+		m_uniformLookup[HashName(info.name.c_str())] = m_uniforms.size();
+		m_uniforms.push_back(info);
+	}
+
+	// compute programs record their declared local size for Dispatch(count)
+	if (IsCompute()) glGetProgramiv(m_program, GL_COMPUTE_WORK_GROUP_SIZE, m_workGroupSize);
+}
+
+neu::Program::uniform_handle_t neu::Program::GetUniformHandle(const std::string& name) const
+{
+	auto it = m_uniformLookup.find(HashName(name.c_str()));
+	return (it != m_uniformLookup.end()) ? it->second : invalidUniform;
+}
+
+void neu::Program::SetUniform(uniform_handle_t handle, float value)
+{
+	if (handle != invalidUniform) glUniform1f(m_uniforms[handle].location, value);
+}
+
+void neu::Program::SetUniform(uniform_handle_t handle, int value)
+{
+	if (handle != invalidUniform) glUniform1i(m_uniforms[handle].location, value);
+}
+
+void neu::Program::SetUniform(uniform_handle_t handle, unsigned int value)
+{
+	if (handle != invalidUniform) glUniform1ui(m_uniforms[handle].location, value);
+}
+
+void neu::Program::SetUniform(uniform_handle_t handle, bool value)
+{
+	if (handle != invalidUniform) glUniform1i(m_uniforms[handle].location, (int)value);
+}
+
+void neu::Program::SetUniform(uniform_handle_t handle, const glm::vec2& value)
+{
+	if (handle != invalidUniform) glUniform2f(m_uniforms[handle].location, value.x, value.y);
+}
+
+void neu::Program::SetUniform(uniform_handle_t handle, const glm::vec3& value)
+{
+	if (handle != invalidUniform) glUniform3f(m_uniforms[handle].location, value.x, value.y, value.z);
+}
+
+void neu::Program::SetUniform(uniform_handle_t handle, const glm::vec4& value)
+{
+	if (handle != invalidUniform) glUniform4f(m_uniforms[handle].location, value.x, value.y, value.z, value.w);
+}
+
+void neu::Program::SetUniform(uniform_handle_t handle, const glm::mat3& value)
+{
+	if (handle != invalidUniform) glUniformMatrix3fv(m_uniforms[handle].location, 1, GL_FALSE, glm::value_ptr(value));
+}
+
+void neu::Program::SetUniform(uniform_handle_t handle, const glm::mat4& value)
+{
+	if (handle != invalidUniform) glUniformMatrix4fv(m_uniforms[handle].location, 1, GL_FALSE, glm::value_ptr(value));
 }
 
 void neu::Program::SetUniform(const std::string& name, float value)
@@ -123,6 +570,12 @@ void neu::Program::SetUniform(const std::string& name, const glm::vec3& value)
 	if (location != -1) glUniform3f(location, value.x, value.y, value.z);
 }
 
+void neu::Program::SetUniform(const std::string& name, const glm::vec4& value)
+{
+	GLint location = GetUniformLocation(name);
+	if (location != -1) glUniform4f(location, value.x, value.y, value.z, value.w);
+}
+
 void neu::Program::SetUniform(const std::string& name, const glm::mat3& value)
 {
 	GLint location = GetUniformLocation(name);
@@ -135,23 +588,40 @@ void neu::Program::SetUniform(const std::string& name, const glm::mat4& value)
 	if (location != -1) glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(value));
 }
 
+void neu::Program::SetUniform(uniform_handle_t handle, GLuint64 value)
+{
+	if (handle != invalidUniform) bindless::SetHandleUniform(m_uniforms[handle].location, value);
+}
+
+void neu::Program::SetUniform(const std::string& name, GLuint64 value)
+{
+	GLint location = GetUniformLocation(name);
+	if (location != -1) bindless::SetHandleUniform(location, value);
+}
+
 GLint neu::Program::GetUniformLocation(const std::string& name)
 {
-	// find uniform location in map
-	auto it = m_uniformLocations.find(name);
-	// if not found, get uniform in program
-	if (it == m_uniformLocations.end())
+	// hash the name and look it up in the reflection table (no GL call, no allocation)
+	uint64_t hash = HashName(name.c_str());
+
+	auto it = m_uniformLookup.find(hash);
+	if (it == m_uniformLookup.end())
 	{
-		// get uniform in program, return -1 if not found
-		GLint location = glGetUniformLocation(m_program, name.c_str());
-		if (location == -1)
+		// not in the table - either optimized out by the GL compiler or a struct/array
+		// member name; query the driver once and cache the result (including -1)
+		UniformInfo info;
+		info.name = name;
+		info.location = glGetUniformLocation(m_program, name.c_str());
+		if (info.location == -1)
 		{
-			LOG_WARNING("Could not find uniform: {}", name);
+			LOG_CAT_WARNING(Renderer, "Could not find uniform: {}", name);
 		}
-		m_uniformLocations[name] = location;
-	}
 
-	return m_uniformLocations[name];
-}
+		m_uniformLookup[hash] = m_uniforms.size();
+		m_uniforms.push_back(info);
 
+		return info.location;
+	}
 
+	return m_uniforms[it->second].location;
+}
@@ -1,20 +1,101 @@
 #pragma once
 #include <glm/glm.hpp>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
 namespace neu {
 	class Shader;
 
 	class Program : public Resource
 	{
+	public:
+		// opaque index into the uniform reflection table built at Link() time
+		// callers can fetch a handle once and skip the per-call name hash/lookup
+		using uniform_handle_t = size_t;
+		static constexpr uniform_handle_t invalidUniform = static_cast<uniform_handle_t>(-1);
+
+		// fixed uniform block binding points shared by every program, the
+		// matching std140 blocks are uploaded once per frame by Scene
+		static constexpr GLuint cameraBlockBinding = 0;
+		static constexpr GLuint lightBlockBinding = 1;
+
+		// material parameter slices of the shared material UBO bind here,
+		// one glBindBufferRange per material switch (see Material::Bind)
+		static constexpr GLuint materialBlockBinding = 2;
+
+		// skinning palette SSBO for the current skinned draw - SSBO bindings
+		// 2-4 hold the clustered lighting buffers, so the palette takes 5
+		static constexpr GLuint skinPaletteBinding = 5;
+
+		// per-draw light masks for the static batch path - one uint per
+		// merged draw, indexed by gl_DrawID in the shader (see StaticBatcher)
+		static constexpr GLuint staticLightMaskBinding = 6;
+
+		// reflection info for one active uniform, filled in by BuildUniformTable()
+		struct UniformInfo {
+			std::string name;
+			GLint location = -1;
+			GLenum type = 0;     // GL_FLOAT, GL_FLOAT_VEC3, ...
+			GLint count = 0;     // array element count (1 for non-arrays)
+		};
+
 	public:
 		Program();
 		~Program();
 
-		bool Load(const std::string& filename);
+		// variantBits are Material::Parameters bits - each set bit compiles
+		// the shaders with a matching USE_* define, so the linked program
+		// is a permutation specialized to exactly the maps a material has
+		// instead of branching on the UBO flags at runtime
+		bool Load(const std::string& filename, uint32_t variantBits = 0);
 		void AttachShader(const res_t<Shader>& shader);
 
+		// cache id for a (program, variant) pair - materials fetch variants
+		// through the resource manager under this id, so identical
+		// permutations across materials dedup to one linked program
+		static std::string VariantId(const std::string& filename, uint32_t variantBits);
+
+		uint32_t GetVariantBits() const { return m_variantBits; }
+
+		// worker-side async hook: queues a warming read of each declared
+		// shader source - compilation itself waits for the context thread
+		static void Prefetch(const std::string& filename);
+
+		// re-runs Load into the same GL program name after the .prog file
+		// changed, so res_t<Program> references (materials) stay valid
+		bool Reload(const std::string& filename) override;
+
+		// true if this program links the given shader source file - used by
+		// hot reload to find the programs a shader edit invalidates
+		bool UsesShader(const std::string& filename) const;
+
+		// detaches whatever is attached, re-attaches the (freshly reloaded)
+		// cached shaders and links again - same GL name, new executable.
+		// A failed link keeps the program object; the previous executable
+		// stays installed until a later relink succeeds
+		bool Relink();
+
 		bool Link();
 		void Use();
 
+		// loads every program listed under "programs" in the manifest so the
+		// driver compile/link cost is paid on the loading screen (warm cache:
+		// binary uploads; cold cache: compiles once and fills the cache)
+		static void WarmUp(const std::string& manifestFilename);
+
+		// uniform handles - resolve the name once, then set by handle on the hot path
+		uniform_handle_t GetUniformHandle(const std::string& name) const;
+
+		void SetUniform(uniform_handle_t handle, float value);
+		void SetUniform(uniform_handle_t handle, int value);
+		void SetUniform(uniform_handle_t handle, unsigned int value);
+		void SetUniform(uniform_handle_t handle, bool value);
+		void SetUniform(uniform_handle_t handle, const glm::vec2& value);
+		void SetUniform(uniform_handle_t handle, const glm::vec3& value);
+		void SetUniform(uniform_handle_t handle, const glm::vec4& value);
+		void SetUniform(uniform_handle_t handle, const glm::mat3& value);
+		void SetUniform(uniform_handle_t handle, const glm::mat4& value);
+
 		// uniforms
 		void SetUniform(const std::string& name, float value);
 		void SetUniform(const std::string& name, int value);
@@ -22,17 +103,84 @@ namespace neu {
 		void SetUniform(const std::string& name, bool value);
 		void SetUniform(const std::string& name, const glm::vec2& value);
 		void SetUniform(const std::string& name, const glm::vec3& value);
+		void SetUniform(const std::string& name, const glm::vec4& value);
 
 		void SetUniform(const std::string& name, const glm::mat3& value);
 		void SetUniform(const std::string& name, const glm::mat4& value);
 
+		// bindless texture handles (no-op when the extension is missing)
+		void SetUniform(uniform_handle_t handle, GLuint64 value);
+		void SetUniform(const std::string& name, GLuint64 value);
+
 		void UpdateGUI() override {};
 
+		// true if the shader declares the shared std140 block, programs without
+		// it fall back to the legacy per-uniform upload path
+		bool HasCameraBlock() const { return m_hasCameraBlock; }
+		bool HasLightBlock() const { return m_hasLightBlock; }
+		bool HasMaterialBlock() const { return m_hasMaterialBlock; }
+
+		// true for compute programs (.prog files declaring a "compute_shader"
+		// stage) - dispatched instead of drawn
+		bool IsCompute() const { return !m_computeShaderName.empty(); }
+
+		// runs the compute program over at least the given number of items,
+		// rounded up to whole work groups from the shader's declared local
+		// size; the three-argument overload dispatches raw group counts
+		void Dispatch(int count);
+		void Dispatch(int x, int y, int z);
+
+		// memory barriers ordering compute writes against their consumers,
+		// issued after the dispatches and before the reads
+		static void BarrierIndirect();	// indirect draw command reads
+		static void BarrierStorage();	// SSBO reads in later shader stages
+
+		// FNV-1a 64-bit hash used to key the uniform lookup table
+		static uint64_t HashName(const char* name) {
+			uint64_t hash = 14695981039346656037ull;
+			while (*name) {
+				hash ^= static_cast<uint64_t>(static_cast<unsigned char>(*name++));
+				hash *= 1099511628211ull;
+			}
+			return hash;
+		}
+
 	private:
 		GLint GetUniformLocation(const std::string& name);
+		void BuildUniformTable();
+		void BindUniformBlocks();
+
+		// driver program binary cached next to the .prog file (one per
+		// variant), keyed by a hash of the shader sources and driver strings
+		static std::string GetBinaryFilename(const std::string& filename, uint32_t variantBits);
+		bool LoadBinary(const std::string& filename, uint64_t hash);
+		bool SaveBinary(const std::string& filename, uint64_t hash);
 
 	public:
 		GLuint m_program = 0;
-		std::map<std::string, GLint> m_uniformLocations;
+
+		// uniform reflection table built once at Link() time
+		std::vector<UniformInfo> m_uniforms;
+		// name hash -> index into m_uniforms (no string compares on the hot path)
+		std::unordered_map<uint64_t, size_t> m_uniformLookup;
+
+		bool m_hasCameraBlock = false;
+		bool m_hasLightBlock = false;
+		bool m_hasMaterialBlock = false;
+
+		// declared local size of the compute stage, recorded at link so
+		// Dispatch(count) can round item counts up to whole groups
+		GLint m_workGroupSize[3] = { 1, 1, 1 };
+
+	private:
+		// shader source files from the .prog document, recorded on both the
+		// binary-cache and source paths so hot reload can relink by name
+		std::string m_vertexShaderName;
+		std::string m_fragmentShaderName;
+		std::string m_computeShaderName;
+
+		// the permutation this program linked as, so reload and relink
+		// fetch the same variant shaders
+		uint32_t m_variantBits{ 0 };
 	};
 }
@@ -0,0 +1,134 @@
+#include "RenderGraph.h"
+#include "Renderer.h"
+#include "GPUProfiler.h"
+#include "GLDebug.h"
+
+namespace neu {
+	void RenderGraph::Reset() {
+		m_targets.clear();
+		m_passes.clear();
+		m_livePasses = 0;
+	}
+
+	RenderGraph::target_t RenderGraph::CreateTarget(const RenderTargetDesc& desc) {
+		Target target;
+		target.desc = desc;
+		m_targets.push_back(target);
+		return (target_t)(m_targets.size() - 1);
+	}
+
+	RenderGraph::target_t RenderGraph::ImportTarget(RenderTexture* texture, int layer) {
+		Target target;
+		target.imported = texture;
+		target.layer = layer;
+		m_targets.push_back(target);
+		return (target_t)(m_targets.size() - 1);
+	}
+
+	void RenderGraph::AddPass(const char* name, std::vector<target_t> reads, target_t output, std::function<void()> execute) {
+		Pass pass;
+		pass.name = name;
+		pass.reads = std::move(reads);
+		pass.output = output;
+		pass.execute = std::move(execute);
+		m_passes.push_back(std::move(pass));
+	}
+
+	void RenderGraph::Execute(Renderer& renderer) {
+		// CULL: walk passes back to front keeping those whose output is
+		// observable (backbuffer or an imported target) or feeds a later
+		// live pass, and pull each keeper's reads into the needed set -
+		// a disabled consumer silently turns its producers off too
+		std::vector<bool> needed(m_targets.size(), false);
+		for (auto iter = m_passes.rbegin(); iter != m_passes.rend(); ++iter) {
+			auto& pass = *iter;
+			bool live = pass.output == backbuffer
+				|| (pass.output >= 0 && m_targets[pass.output].imported)
+				|| (pass.output >= 0 && needed[pass.output]);
+
+			pass.culled = !live;
+			if (!live) continue;
+
+			m_livePasses++;
+			for (auto read : pass.reads) {
+				if (read >= 0) needed[read] = true;
+			}
+		}
+
+		// LIFETIME: first and last live pass touching each transient - the
+		// range its pooled texture must be held for
+		for (int index = 0; index < (int)m_passes.size(); index++) {
+			auto& pass = m_passes[index];
+			if (pass.culled) continue;
+
+			auto touch = [this, index](target_t target) {
+				if (target < 0 || m_targets[target].imported) return;
+				if (m_targets[target].firstUse < 0) m_targets[target].firstUse = index;
+				m_targets[target].lastUse = index;
+			};
+			touch(pass.output);
+			for (auto read : pass.reads) touch(read);
+		}
+
+		// RUN: acquire each transient's pooled texture as its first use
+		// comes up and release it after its last user runs - a released
+		// texture is handed to the next same-shaped transient, so
+		// ping-pong chains collapse onto two allocations however long
+		// they are
+		for (int index = 0; index < (int)m_passes.size(); index++) {
+			auto& pass = m_passes[index];
+			if (pass.culled) continue;
+
+			auto resolve = [this](target_t handle) {
+				if (handle < 0) return;
+				auto& target = m_targets[handle];
+				if (target.imported || target.physical) return;
+				target.physical = RenderTargetPool::Instance().Acquire(target.desc);
+			};
+			resolve(pass.output);
+			for (auto read : pass.reads) resolve(read);
+
+			BindOutput(renderer, pass.output);
+
+			// the debug group gives captures the same pass names the
+			// profiler scopes report
+			GLDebug::PushGroup(pass.name);
+			GPUProfiler::BeginScope(pass.name);
+			pass.execute();
+			GPUProfiler::EndScope();
+			GLDebug::PopGroup();
+
+			for (auto& target : m_targets) {
+				if (target.physical && target.lastUse == index) {
+					RenderTargetPool::Instance().Release(target.physical);
+				}
+			}
+		}
+
+		// leave the default framebuffer bound at backbuffer size, matching
+		// what the GUI pass after the scene expects
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		glViewport(0, 0, renderer.GetWidth(), renderer.GetHeight());
+	}
+
+	RenderTexture* RenderGraph::GetTexture(target_t target) {
+		if (target < 0) return nullptr;
+		if (m_targets[target].imported) return m_targets[target].imported;
+		return m_targets[target].physical;
+	}
+
+	void RenderGraph::BindOutput(Renderer& renderer, target_t output) {
+		if (output == backbuffer) {
+			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			glViewport(0, 0, renderer.GetWidth(), renderer.GetHeight());
+			return;
+		}
+
+		auto& target = m_targets[output];
+		RenderTexture* texture = GetTexture(output);
+
+		if (target.layer >= 0) texture->BindFramebufferLayer(target.layer);
+		else texture->BindFramebuffer();
+		glViewport(0, 0, texture->GetSize().x, texture->GetSize().y);
+	}
+}
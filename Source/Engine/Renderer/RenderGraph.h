@@ -0,0 +1,77 @@
+#pragma once
+#include "RenderTargetPool.h"
+#include <functional>
+#include <vector>
+
+namespace neu {
+	class Renderer;
+
+	// Frame-scoped pass scheduler over the render targets.
+	//
+	// Passes declare the targets they read and the target they write; the
+	// graph culls passes whose output nothing consumes, brackets each pass
+	// with the right framebuffer bind and viewport (and a GPU profiler
+	// scope), and backs transient targets with textures acquired from the
+	// shared RenderTargetPool for exactly their live pass range - two
+	// transients with the same shape whose ranges don't overlap share one
+	// allocation. Externally owned targets (camera output textures) are
+	// imported and never aliased or culled.
+	//
+	// Rebuilt every frame by Scene::Draw; the pool persists across frames
+	// so the steady state allocates nothing.
+	class RenderGraph {
+	public:
+		using target_t = int;
+		static constexpr target_t backbuffer = -1;
+
+		// starts a new frame - drops last frame's passes and targets
+		void Reset();
+
+		// declares a transient target the graph backs with pooled memory
+		target_t CreateTarget(const RenderTargetDesc& desc);
+
+		// wraps an externally owned target so passes can declare against
+		// it; layer >= 0 attaches that array layer (shadow cascades)
+		target_t ImportTarget(RenderTexture* texture, int layer = -1);
+
+		// declares a pass: reads are sampled inputs, output is the target
+		// bound while execute runs (backbuffer for the default
+		// framebuffer). The callback runs with the output bound and the
+		// viewport set - it issues draws (and its own clear) only
+		void AddPass(const char* name, std::vector<target_t> reads, target_t output, std::function<void()> execute);
+
+		// schedules and runs the declared passes in submission order
+		void Execute(Renderer& renderer);
+
+		// resolved physical texture behind a target - valid inside the
+		// execute callbacks of passes that declared it
+		RenderTexture* GetTexture(target_t target);
+
+		// editor stat - passes that survived culling last frame
+		size_t GetPassCount() const { return m_livePasses; }
+
+	private:
+		struct Target {
+			RenderTargetDesc desc;
+			RenderTexture* imported = nullptr;
+			int layer = -1;
+			RenderTexture* physical = nullptr;	// pooled, held over the live range
+			int firstUse = -1;	// pass index range the target is live over
+			int lastUse = -1;
+		};
+
+		struct Pass {
+			const char* name = nullptr;
+			std::vector<target_t> reads;
+			target_t output = backbuffer;
+			std::function<void()> execute;
+			bool culled = false;
+		};
+
+		void BindOutput(Renderer& renderer, target_t output);
+
+		std::vector<Target> m_targets;
+		std::vector<Pass> m_passes;
+		size_t m_livePasses = 0;
+	};
+}
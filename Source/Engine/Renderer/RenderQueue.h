@@ -0,0 +1,149 @@
+#pragma once
+#include "LightClusters.h"
+#include "Math/Frustum.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace neu {
+	class Material;
+	class Model;
+	class Program;
+	class CameraComponent;
+	class LightComponent;
+
+	// std140 layouts matching the shared "CameraBlock" and "LightBlock"
+	// declared by shaders, uploaded once per pass instead of per program
+	constexpr int kMaxBlockLights = 8;
+
+	// shadow cascade limit, matching the shaders' u_cascade_* array sizes
+	constexpr int kMaxShadowCascades = 4;
+
+	struct CameraBlockData {
+		glm::mat4 view;
+		glm::mat4 projection;
+		glm::vec3 ambientLight;
+		float _pad0;
+	};
+
+	struct LightBlockData {
+		struct Light {
+			glm::vec3 position;  float range;
+			glm::vec3 direction; float intensity;
+			glm::vec3 color;     int type;
+			float innerSpotAngle;
+			float outerSpotAngle;
+			int shadowCaster;
+			float _pad0;
+		} lights[kMaxBlockLights];
+		int numLights;
+		glm::vec3 _pad1;
+	};
+
+	// one fully resolved draw - everything playback needs (including the
+	// world matrix) is captured by value at record time, so playback makes
+	// GL calls and reads nothing from the scene
+	struct DrawCommand {
+		Material* material;
+		Model* model;
+		glm::mat4 modelMatrix;
+		int lod;
+		bool depthMask;
+		GLint cullFace;
+
+		// nearest captured reflection probe's cube texture, bound over the
+		// material's authored cube map at playback; 0 keeps the authored map
+		GLuint environment;
+
+		// per-draw light mask over the pass's light list - bit i gates
+		// light i in the shader's light loop, all-ones draws every light.
+		// Baked from light reach against the draw's bounds at record time
+		uint32_t lightMask;
+
+		// joint palette for skinned draws, uploaded to the shared skin SSBO
+		// at playback - null for rigid draws. Points at the owning
+		// AnimationComponent's storage, which only mutates during the
+		// update the record ran after
+		const glm::mat4* palette;
+		int paletteCount;
+	};
+
+	// instanced renderers sharing a Model+Material, collapsed into one
+	// instanced draw with the captured per-instance matrices
+	struct InstancedBatch {
+		Material* material;
+		Model* model;
+		std::vector<glm::mat4> transforms;
+	};
+
+	// one camera's recorded pass: the uniform block contents, the culling
+	// frustum (reused by static batch playback) and the sorted commands
+	struct RenderPass {
+		CameraComponent* camera{ nullptr };
+		Frustum frustum{};
+		CameraBlockData cameraData{};
+		LightBlockData lightData{};
+
+		// content hashes over the camera/light inputs, computed at record
+		// time - playback compares them against the last values actually
+		// uploaded and skips the GL calls when nothing changed
+		uint64_t cameraHash{ 0 };
+		uint64_t lightHash{ 0 };
+
+		// shadow cascade this pass renders (the depth array layer playback
+		// attaches), -1 for every non-cascade pass
+		int cascade{ -1 };
+
+		// opaque commands, radix sorted by program | material | depth
+		std::vector<DrawCommand> draws;
+
+		// transparent commands, sorted back to front across materials -
+		// played back last with blending on and depth writes off
+		std::vector<DrawCommand> transparentDraws;
+
+		// sky commands, played back after every opaque at the far plane
+		// with a depth-equal test - sky fragments only shade where no
+		// geometry wrote depth
+		std::vector<DrawCommand> skyDraws;
+
+		std::vector<InstancedBatch> batches;
+
+		// clustered lighting payload - view-space light data, per-cluster
+		// offset/count pairs and the flattened index list, built by
+		// LightClusters::Build at record time and uploaded as SSBOs at
+		// playback. Empty for shadow passes
+		std::vector<ClusterLight> clusterLights;
+		std::vector<glm::uvec2> clusterRanges;
+		std::vector<uint32_t> clusterIndices;
+	};
+
+	// a frame's recorded draw submission, built by Scene::RecordDraw (on a
+	// worker when kicked through RecordDrawAsync) and played back by
+	// Scene::Draw on the GL context thread. Heap vectors rather than
+	// frame-arena scratch so capacity carries across frames and recording
+	// doesn't depend on the arena's reset timing
+	struct RenderQueue {
+		std::vector<RenderPass> passes;
+
+		// per-pass legacy uniform setup and shadow matrix distribution
+		// still happen at playback - these carry what that needs
+		std::vector<Program*> programs;
+		std::vector<LightComponent*> lights;
+		glm::mat4 shadowVP{ 1 };
+		bool hasShadowCamera{ false };
+
+		// cascaded shadow state - count stays 0 on the single-map path.
+		// Matrices carry the bias, splits are view-space far distances
+		int cascadeCount{ 0 };
+		glm::mat4 cascadeVP[kMaxShadowCascades]{};
+		float cascadeSplits[kMaxShadowCascades]{};
+
+		void Clear() {
+			passes.clear();
+			programs.clear();
+			lights.clear();
+			hasShadowCamera = false;
+			cascadeCount = 0;
+		}
+	};
+}
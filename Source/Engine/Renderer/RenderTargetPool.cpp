@@ -0,0 +1,58 @@
+#include "RenderTargetPool.h"
+
+namespace neu {
+	RenderTexture* RenderTargetPool::Acquire(const RenderTargetDesc& desc) {
+		for (auto& entry : m_entries) {
+			if (!entry.acquired && entry.desc == desc) {
+				entry.acquired = true;
+				return entry.texture.get();
+			}
+		}
+
+		Entry entry;
+		entry.desc = desc;
+		entry.texture = std::make_unique<RenderTexture>();
+		entry.acquired = true;
+
+		bool created = desc.depthOnly
+			? (desc.layers > 1
+				? entry.texture->CreateDepthArray(desc.width, desc.height, desc.layers)
+				: entry.texture->CreateDepth(desc.width, desc.height))
+			: entry.texture->Create(desc.width, desc.height, desc.depth, desc.samples, desc.format);
+		if (!created) {
+			LOG_CAT_ERROR(Renderer, "Could not create pooled render target ({}x{})", desc.width, desc.height);
+			return nullptr;
+		}
+
+		m_entries.push_back(std::move(entry));
+		return m_entries.back().texture.get();
+	}
+
+	void RenderTargetPool::Release(RenderTexture* target) {
+		for (auto& entry : m_entries) {
+			if (entry.texture.get() == target) {
+				entry.acquired = false;
+				return;
+			}
+		}
+	}
+
+	void RenderTargetPool::Clear() {
+		m_entries.clear();
+	}
+
+	size_t RenderTargetPool::GetBytes() const {
+		size_t bytes = 0;
+		for (auto& entry : m_entries) {
+			// color plane at the desc's format footprint (the packed HDR
+			// formats cost the same 4 bytes as RGBA8, RGBA16F doubles it),
+			// 24/8 depth-stencil plane when present, 32-bit depth per layer
+			// on the depth-only path; multisampled targets store every sample
+			size_t pixels = (size_t)entry.desc.width * entry.desc.height * entry.desc.samples;
+			size_t colorBytes = entry.desc.format == TargetFormat::RGBA16F ? 8 : 4;
+			if (entry.desc.depthOnly) bytes += pixels * 4 * entry.desc.layers;
+			else bytes += pixels * (colorBytes + (entry.desc.depth ? 4 : 0));
+		}
+		return bytes;
+	}
+}
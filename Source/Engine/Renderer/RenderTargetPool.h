@@ -0,0 +1,57 @@
+#pragma once
+#include "Core/Singleton.h"
+#include "RenderTexture.h"
+#include <memory>
+#include <vector>
+
+namespace neu {
+	// shape of a pooled render target - the reuse key
+	struct RenderTargetDesc {
+		int width = 0;
+		int height = 0;
+		bool depth = false;		// depth attachment alongside the color plane
+		bool depthOnly = false;	// depth-only target (shadow maps)
+		int layers = 1;			// > 1 allocates a depth array (cascades)
+		int samples = 1;		// > 1 allocates a multisampled target (MSAA)
+		TargetFormat format = TargetFormat::RGBA8;	// color plane format (ignored for depth-only)
+
+		bool operator==(const RenderTargetDesc&) const = default;
+	};
+
+	// pools RenderTextures by shape: Acquire hands out a released target
+	// matching the desc before creating a fresh one, and Release returns a
+	// target for reuse within or across frames. Each pooled texture keeps
+	// its FBO for its whole pooled lifetime, so the driver's framebuffer
+	// validation cost is paid once per shape instead of per consumer.
+	// The render graph draws its transient targets from here; anything
+	// else needing a scratch target can too
+	class RenderTargetPool : public Singleton<RenderTargetPool> {
+	public:
+		// returns a free pooled target matching the desc, creating one when
+		// none is available - never returns a target still acquired
+		RenderTexture* Acquire(const RenderTargetDesc& desc);
+
+		// returns an acquired target to the free set; its contents are
+		// undefined to the next Acquire
+		void Release(RenderTexture* target);
+
+		// releases every pooled target, called from Engine::Shutdown while
+		// the GL context is still current
+		void Clear();
+
+		size_t GetCount() const { return m_entries.size(); }
+		size_t GetBytes() const;
+
+	private:
+		friend class Singleton<RenderTargetPool>;
+		RenderTargetPool() = default;
+
+		struct Entry {
+			RenderTargetDesc desc;
+			std::unique_ptr<RenderTexture> texture;
+			bool acquired = false;
+		};
+
+		std::vector<Entry> m_entries;
+	};
+}
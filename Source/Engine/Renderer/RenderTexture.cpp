@@ -1,19 +1,108 @@
 #include "RenderTexture.h"
 
 namespace neu {
+    namespace {
+        GLenum ColorInternalFormat(TargetFormat format) {
+            switch (format) {
+            case TargetFormat::R11G11B10F:  return GL_R11F_G11F_B10F;
+            case TargetFormat::RGB10A2:     return GL_RGB10_A2;
+            case TargetFormat::RGBA16F:     return GL_RGBA16F;
+            default:                        return GL_RGBA8;
+            }
+        }
+
+        // external format/type for the non-DSA glTexImage path - the data
+        // pointer is null, but the combination must stay compatible
+        GLenum ColorExternalFormat(TargetFormat format) {
+            return format == TargetFormat::R11G11B10F ? GL_RGB : GL_RGBA;
+        }
+
+        GLenum ColorExternalType(TargetFormat format) {
+            switch (format) {
+            case TargetFormat::R11G11B10F:  return GL_FLOAT;
+            case TargetFormat::RGB10A2:     return GL_UNSIGNED_INT_2_10_10_10_REV;
+            case TargetFormat::RGBA16F:     return GL_FLOAT;
+            default:                        return GL_UNSIGNED_BYTE;
+            }
+        }
+
+        size_t ColorBytesPerPixel(TargetFormat format) {
+            // the packed formats match RGBA8's footprint - that is the point
+            return format == TargetFormat::RGBA16F ? 8 : 4;
+        }
+
+        GLenum DepthInternalFormat(DepthFormat format) {
+            return format == DepthFormat::D24S8 ? GL_DEPTH24_STENCIL8 : GL_DEPTH_COMPONENT32;
+        }
+
+        GLenum DepthAttachment(DepthFormat format) {
+            return format == DepthFormat::D24S8 ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+        }
+    }
+
     RenderTexture::~RenderTexture() {
         if (m_fbo) glDeleteFramebuffers(1, &m_fbo);
         if (m_depthBuffer) glDeleteRenderbuffers(1, &m_depthBuffer);
     }
 
     bool RenderTexture::Load(const std::string& filename) {
-        LOG_WARNING("RenderTexture cannot load from file: {}", filename);
+        LOG_CAT_WARNING(Renderer, "RenderTexture cannot load from file: {}", filename);
         return false;
     }
 
-    bool RenderTexture::Create(int width, int height, bool depth) {
+    bool RenderTexture::Create(int width, int height, bool depth, int samples,
+        TargetFormat format, DepthFormat depthFormat) {
         m_size.x = width;
         m_size.y = height;
+        m_samples = samples;
+        m_format = format;
+
+        // color plane at the format's footprint plus a 4-byte depth plane,
+        // both scaled by the sample count - ~Texture releases the
+        // accounting with the GL objects
+        m_gpuType = GPUMemory::Type::RenderTarget;
+        m_gpuBytes = (size_t)width * height * samples * (ColorBytesPerPixel(format) + (depth ? 4 : 0));
+        GPUMemory::Track(m_gpuType, m_gpuBytes);
+
+        // multisampled targets use a multisample texture and renderbuffer -
+        // filter and wrap parameters don't apply to multisample textures,
+        // and the contents only leave through a resolve blit
+        bool multisampled = samples > 1;
+        if (multisampled) m_target = GL_TEXTURE_2D_MULTISAMPLE;
+
+        if (GLState::SupportsDSA()) {
+            // DSA: the framebuffer, texture and renderbuffer build without
+            // binding anything, so creating render targets mid-frame can't
+            // disturb the cached GL state
+            glCreateFramebuffers(1, &m_fbo);
+
+            glCreateTextures(m_target, 1, &m_texture);
+            if (multisampled) {
+                glTextureStorage2DMultisample(m_texture, samples, ColorInternalFormat(format), width, height, GL_TRUE);
+            }
+            else {
+                glTextureStorage2D(m_texture, 1, ColorInternalFormat(format), width, height);
+                glTextureParameteri(m_texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+                glTextureParameteri(m_texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+                glTextureParameteri(m_texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+                glTextureParameteri(m_texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            }
+            glNamedFramebufferTexture(m_fbo, GL_COLOR_ATTACHMENT0, m_texture, 0);
+
+            if (depth) {
+                glCreateRenderbuffers(1, &m_depthBuffer);
+                if (multisampled) glNamedRenderbufferStorageMultisample(m_depthBuffer, samples, DepthInternalFormat(depthFormat), width, height);
+                else glNamedRenderbufferStorage(m_depthBuffer, DepthInternalFormat(depthFormat), width, height);
+                glNamedFramebufferRenderbuffer(m_fbo, DepthAttachment(depthFormat), GL_RENDERBUFFER, m_depthBuffer);
+            }
+
+            if (glCheckNamedFramebufferStatus(m_fbo, GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+                LOG_CAT_WARNING(Renderer, "Error creating framebuffer");
+                return false;
+            }
+
+            return true;
+        }
 
         // framebuffer
         glGenFramebuffers(1, &m_fbo);
@@ -21,28 +110,34 @@ namespace neu {
 
         // color texture
         glGenTextures(1, &m_texture);
-        glBindTexture(GL_TEXTURE_2D, m_texture);
+        GLState::BindTexture(m_target, m_texture);
 
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        if (multisampled) {
+            glTexImage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, samples, ColorInternalFormat(format), width, height, GL_TRUE);
+        }
+        else {
+            glTexImage2D(GL_TEXTURE_2D, 0, ColorInternalFormat(format), width, height, 0, ColorExternalFormat(format), ColorExternalType(format), nullptr);
 
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        }
 
-        glFramebufferTexture2D(GL_FRAMEBUFFER,GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_texture, 0);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, m_target, m_texture, 0);
 
         // depth (optional)
         if (depth) {
             glGenRenderbuffers(1, &m_depthBuffer);
             glBindRenderbuffer(GL_RENDERBUFFER, m_depthBuffer);
 
-            glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
-            glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, m_depthBuffer);
+            if (multisampled) glRenderbufferStorageMultisample(GL_RENDERBUFFER, samples, DepthInternalFormat(depthFormat), width, height);
+            else glRenderbufferStorage(GL_RENDERBUFFER, DepthInternalFormat(depthFormat), width, height);
+            glFramebufferRenderbuffer(GL_FRAMEBUFFER, DepthAttachment(depthFormat), GL_RENDERBUFFER, m_depthBuffer);
         }
 
         if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
-            LOG_WARNING("Error creating framebuffer");
+            LOG_CAT_WARNING(Renderer, "Error creating framebuffer");
             return false;
         }
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
@@ -50,27 +145,54 @@ namespace neu {
         return true;
     }
 
-    bool RenderTexture::CreateDepth(int width, int height)
+    bool RenderTexture::CreateDepth(int width, int height, DepthFormat format)
     {
         m_size.x = width;
         m_size.y = height;
 
+        m_gpuType = GPUMemory::Type::RenderTarget;
+        m_gpuBytes = (size_t)width * height * 4;
+        GPUMemory::Track(m_gpuType, m_gpuBytes);
+
+        if (GLState::SupportsDSA()) {
+            glCreateFramebuffers(1, &m_fbo);
+
+            glCreateTextures(GL_TEXTURE_2D, 1, &m_texture);
+            glTextureStorage2D(m_texture, 1, DepthInternalFormat(format), width, height);
+            glTextureParameteri(m_texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTextureParameteri(m_texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTextureParameteri(m_texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTextureParameteri(m_texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glNamedFramebufferTexture(m_fbo, DepthAttachment(format), m_texture, 0);
+
+            glNamedFramebufferDrawBuffer(m_fbo, GL_NONE);
+            glNamedFramebufferReadBuffer(m_fbo, GL_NONE);
+
+            if (glCheckNamedFramebufferStatus(m_fbo, GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+                LOG_CAT_WARNING(Renderer, "Error creating framebuffer");
+                return false;
+            }
+
+            return true;
+        }
+
         // framebuffer
         glGenFramebuffers(1, &m_fbo);
         glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
 
         // color texture
         glGenTextures(1, &m_texture);
-        glBindTexture(GL_TEXTURE_2D, m_texture);
+        GLState::BindTexture(GL_TEXTURE_2D, m_texture);
 
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT32, width, height, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+        if (format == DepthFormat::D24S8) glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH24_STENCIL8, width, height, 0, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, nullptr);
+        else glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT32, width, height, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
 
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, m_texture, 0);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, DepthAttachment(format), GL_TEXTURE_2D, m_texture, 0);
 
         glDrawBuffer(GL_NONE);
         glReadBuffer(GL_NONE);
@@ -78,18 +200,100 @@ namespace neu {
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
 
         if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
-            LOG_WARNING("Error creating framebuffer");
+            LOG_CAT_WARNING(Renderer, "Error creating framebuffer");
             return false;
         }
 
         return true;
     }
 
+    bool RenderTexture::CreateDepthArray(int width, int height, int layers)
+    {
+        m_size.x = width;
+        m_size.y = height;
+        m_layers = layers;
+        m_target = GL_TEXTURE_2D_ARRAY;
+
+        m_gpuType = GPUMemory::Type::RenderTarget;
+        m_gpuBytes = (size_t)width * height * 4 * layers;
+        GPUMemory::Track(m_gpuType, m_gpuBytes);
+
+        if (GLState::SupportsDSA()) {
+            glCreateFramebuffers(1, &m_fbo);
+
+            // depth array texture - one layer per shadow cascade
+            glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &m_texture);
+            glTextureStorage3D(m_texture, 1, GL_DEPTH_COMPONENT32, width, height, layers);
+            glTextureParameteri(m_texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTextureParameteri(m_texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTextureParameteri(m_texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTextureParameteri(m_texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glNamedFramebufferTextureLayer(m_fbo, GL_DEPTH_ATTACHMENT, m_texture, 0, 0);
+
+            glNamedFramebufferDrawBuffer(m_fbo, GL_NONE);
+            glNamedFramebufferReadBuffer(m_fbo, GL_NONE);
+
+            if (glCheckNamedFramebufferStatus(m_fbo, GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+                LOG_CAT_WARNING(Renderer, "Error creating framebuffer");
+                return false;
+            }
+
+            return true;
+        }
+
+        // framebuffer
+        glGenFramebuffers(1, &m_fbo);
+        glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
+
+        // depth array texture - one layer per shadow cascade
+        glGenTextures(1, &m_texture);
+        GLState::BindTexture(GL_TEXTURE_2D_ARRAY, m_texture);
+
+        glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_DEPTH_COMPONENT32, width, height, layers, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, m_texture, 0, 0);
+
+        glDrawBuffer(GL_NONE);
+        glReadBuffer(GL_NONE);
+
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+            LOG_CAT_WARNING(Renderer, "Error creating framebuffer");
+            return false;
+        }
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        return true;
+    }
+
     void RenderTexture::BindFramebuffer() {
         glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
     }
 
+    void RenderTexture::BindFramebufferLayer(int layer) {
+        glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
+        if (m_layers > 1) glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, m_texture, 0, layer);
+    }
+
     void RenderTexture::UnbindFramebuffer() {
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
     }
+
+    void RenderTexture::BlitDepthFrom(RenderTexture& source) {
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, source.m_fbo);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_fbo);
+
+        // depth blits must use nearest filtering
+        glBlitFramebuffer(
+            0, 0, source.GetSize().x, source.GetSize().y,
+            0, 0, m_size.x, m_size.y,
+            GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+
+        // leave this texture's framebuffer bound for the pass that follows
+        glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
+    }
 }
\ No newline at end of file
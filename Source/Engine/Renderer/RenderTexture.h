@@ -2,19 +2,62 @@
 #include "Texture.h"
 
 namespace neu {
+	// color plane format a render target allocates - the bandwidth knob.
+	// R11G11B10F carries HDR range at RGBA8 bandwidth (no alpha), RGB10A2
+	// extends LDR precision at the same cost, RGBA16F is full HDR at
+	// double the bandwidth - reserve it for tiers that can afford it
+	enum class TargetFormat : uint8_t {
+		RGBA8,
+		R11G11B10F,
+		RGB10A2,
+		RGBA16F,
+	};
+
+	// depth attachment format - D24S8 rides a renderbuffer alongside a
+	// color plane, D32 is the full-precision choice for sampled depth
+	enum class DepthFormat : uint8_t {
+		D24S8,
+		D32,
+	};
+
 	class RenderTexture : public Texture {
 	public:
 		~RenderTexture();
 
-		bool Create(int width, int height, bool depth = true);
-		bool CreateDepth(int width, int height);
+		// samples > 1 creates a multisampled target (color and depth both) -
+		// it can only be resolved out of with a blit, never sampled directly
+		bool Create(int width, int height, bool depth = true, int samples = 1,
+			TargetFormat format = TargetFormat::RGBA8, DepthFormat depthFormat = DepthFormat::D24S8);
+		bool CreateDepth(int width, int height, DepthFormat format = DepthFormat::D32);
+		bool CreateDepthArray(int width, int height, int layers);
 		bool Load(const std::string& filename);
 
 		void BindFramebuffer();
 		void UnbindFramebuffer();
 
+		// binds the framebuffer with the given array layer attached - for
+		// depth arrays (shadow cascades); plain textures ignore the layer
+		void BindFramebufferLayer(int layer);
+
+		// copies another render texture's depth attachment into this one,
+		// letting a pass start from cached depth instead of a clear
+		void BlitDepthFrom(RenderTexture& source);
+
+		// render targets sample clamped and unfiltered across mips - they
+		// have no chain, and repeat wrap bleeds opposite edges into blurs
+		SamplerDesc GetSamplerDesc() const override {
+			return { GL_LINEAR, GL_LINEAR, GL_CLAMP_TO_EDGE, false };
+		}
+
+		int GetLayers() const { return m_layers; }
+		int GetSamples() const { return m_samples; }
+		TargetFormat GetFormat() const { return m_format; }
+
 	public:
 		GLuint m_fbo = 0;
 		GLuint m_depthBuffer = 0;
+		int m_layers = 1;
+		int m_samples = 1;
+		TargetFormat m_format = TargetFormat::RGBA8;
 	};
 }
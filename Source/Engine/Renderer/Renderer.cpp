@@ -1,4 +1,8 @@
 #include "Renderer.h"
+#include "GLState.h"
+#include "GPUProfiler.h"
+#include "FrameStats.h"
+#include "GLDebug.h"
 #include "Texture.h"
 
 namespace neu {
@@ -10,13 +14,13 @@ namespace neu {
     bool Renderer::Initialize() {
         // Initialize SDL video subsystem
         if (!SDL_Init(SDL_INIT_VIDEO)) {
-            LOG_ERROR("SDL_Init Error: {}", SDL_GetError());
+            LOG_CAT_ERROR(Renderer, "SDL_Init Error: {}", SDL_GetError());
             return false;
         }
 
         // Initialize SDL_ttf for TrueType font rendering
         if (!TTF_Init()) {
-            LOG_ERROR("TTF_Init Error: {}", SDL_GetError());
+            LOG_CAT_ERROR(Renderer, "TTF_Init Error: {}", SDL_GetError());
             return false;
         }
 
@@ -29,6 +33,23 @@ namespace neu {
     /// Call this during application cleanup.
     /// </summary>
     void Renderer::Shutdown() {
+        // release any latency-limiter fences still pending
+        for (auto& fence : m_frameFences) {
+            if (fence) { glDeleteSync(fence); fence = nullptr; }
+        }
+
+        // in-flight captures are dropped, their callbacks never run
+        for (auto& capture : m_captureRing) {
+            if (capture.fence) { glDeleteSync(capture.fence); capture.fence = nullptr; }
+            if (capture.pbo) { glDeleteBuffers(1, &capture.pbo); capture.pbo = 0; }
+            capture.callbacks.clear();
+        }
+        m_captureRequests.clear();
+
+        // uninstall the modal-loop event watch before the window goes away
+        SDL_RemoveEventWatch(EventWatch, this);
+        m_modalTick = nullptr;
+
         TTF_Quit();                         // Shutdown SDL_ttf
         SDL_GL_DestroyContext(m_context);   // Destroy the OpenGL context
         SDL_DestroyWindow(m_window);        // Destroy the window
@@ -47,16 +68,17 @@ namespace neu {
     /// <param name="width">The logical width of the render area in pixels</param>
     /// <param name="height">The logical height of the render area in pixels</param>
     /// <param name="fullscreen">If true, creates a fullscreen window; otherwise, windowed mode</param>
+    /// <param name="hidden">If true, the window is never shown and vsync is disabled - used by the headless benchmark harness</param>
     /// <returns>True if window and renderer creation succeeded; otherwise, false</returns>
-    bool Renderer::CreateWindow(const std::string& name, int width, int height, bool fullscreen) {
+    bool Renderer::CreateWindow(const std::string& name, int width, int height, bool fullscreen, bool hidden) {
         // Store the logical dimensions
         m_width = width;
         m_height = height;
 
         // Create the SDL window
-        m_window = SDL_CreateWindow(name.c_str(), width, height, SDL_WINDOW_OPENGL | (fullscreen ? SDL_WINDOW_FULLSCREEN : 0));
+        m_window = SDL_CreateWindow(name.c_str(), width, height, SDL_WINDOW_OPENGL | (fullscreen ? SDL_WINDOW_FULLSCREEN : 0) | (hidden ? SDL_WINDOW_HIDDEN : 0));
         if (m_window == nullptr) {
-            LOG_ERROR("SDL_CreateWindow Error: {}", SDL_GetError());
+            LOG_CAT_ERROR(Renderer, "SDL_CreateWindow Error: {}", SDL_GetError());
             SDL_Quit();
             return false;
         }
@@ -68,16 +90,40 @@ namespace neu {
 
         SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
         SDL_GL_SetAttribute(SDL_GL_ACCELERATED_VISUAL, 1);
-        SDL_GL_SetSwapInterval(1);
 
         m_context = SDL_GL_CreateContext(m_window);
         if (m_context == nullptr) {
-            LOG_ERROR("SDL_CreateWindow Error: {}", SDL_GetError());
+            LOG_CAT_ERROR(Renderer, "SDL_CreateWindow Error: {}", SDL_GetError());
             SDL_Quit();
             return false;
         }
         gladLoadGL();
 
+        // the swap interval belongs to the context, so it's set after context
+        // creation. vsync would clamp every measured frame to the display
+        // rate, so the hidden (benchmark) context runs unthrottled
+        SetVSync(hidden ? VSyncMode::Off : VSyncMode::On);
+
+        // optional bindless texture path - the vendored glad build predates
+        // GL_ARB_bindless_texture, so its entry points load here by hand.
+        // capable drivers let materials push resident handles instead of
+        // binding texture units
+        if (bindless::Load()) LOG_CAT_INFO(Renderer, "GL_ARB_bindless_texture supported, bindless material path enabled");
+
+        // KHR_debug - named groups/labels for GPU captures and driver debug
+        // messages routed into the logger
+        GLDebug::Init();
+
+        // keep frames running while the OS holds the thread in a modal
+        // move/resize loop - see SetModalTickCallback
+        SDL_AddEventWatch(EventWatch, this);
+
+        // sample ceiling for the MSAA anti-aliasing modes
+        glGetIntegerv(GL_MAX_SAMPLES, &m_maxSamples);
+
+        // probe the driver memory extensions and take the first VRAM sample
+        GPUMemory::Init();
+
         // After SDL and OpenGL context creation:
         IMGUI_CHECKVERSION();
         ImGui::CreateContext();
@@ -93,6 +139,9 @@ namespace neu {
         glEnable(GL_CULL_FACE);
         glCullFace(GL_FRONT);
         glFrontFace(GL_CCW);
+
+        // the state cache hasn't seen any of the setup above, start it unknown
+        GLState::Invalidate();
         return true;
     }
 
@@ -106,11 +155,273 @@ namespace neu {
     }
 
     /// <summary>
-    /// Presents the rendered frame to the screen by swapping buffers.
-    /// Call this at the end of each frame after all drawing operations are complete.
-    /// Uses double buffering: renders to back buffer, then swaps to front buffer for display.
+    /// Sets the swap interval policy on the live context. Adaptive asks the
+    /// driver for late-swap tearing (interval -1) and falls back to regular
+    /// vsync where that's not supported.
+    /// </summary>
+    void Renderer::SetVSync(VSyncMode mode) {
+        m_vsyncMode = mode;
+
+        int interval = (mode == VSyncMode::Off) ? 0 : (mode == VSyncMode::Adaptive) ? -1 : 1;
+        if (!SDL_GL_SetSwapInterval(interval) && mode == VSyncMode::Adaptive) {
+            LOG_CAT_WARNING(Renderer, "Adaptive vsync not supported, falling back to vsync on");
+            SDL_GL_SetSwapInterval(1);
+            m_vsyncMode = VSyncMode::On;
+        }
+    }
+
+    /// <summary>
+    /// Caps CPU run-ahead for the fence latency limiter in Present.
+    /// Clamped to the fence ring - 0 disables the limiter entirely.
+    /// </summary>
+    void Renderer::SetMaxFramesInFlight(int frames) {
+        m_maxFramesInFlight = math::clamp(frames, 0, kMaxPendingFences - 1);
+    }
+
+    /// <summary>
+    /// Presents the rendered frame to the screen by swapping buffers, then
+    /// applies the latency limiter and frame pacing. Each blocking stage is
+    /// timed separately so a slow frame can be attributed: swap time means
+    /// GPU/display bound, latency time means the CPU outran the frames-in-
+    /// flight cap, pacing time means the frame cap itself is the limiter.
     /// </summary>
     void Renderer::Present() {
+        uint64_t frequency = SDL_GetPerformanceFrequency();
+        uint64_t start = SDL_GetPerformanceCounter();
+
+        // queued captures read the backbuffer into a PBO before it swaps
+        // away - the transfer runs async, fenced, and is delivered by
+        // PollCaptures on a later frame
+        IssueCapture();
+
         SDL_GL_SwapWindow(m_window);
+
+        uint64_t afterSwap = SDL_GetPerformanceCounter();
+        m_swapBlockMs = (afterSwap - start) * 1000.0f / frequency;
+
+        // latency limiter - fence this frame's commands and block until the
+        // frame from m_maxFramesInFlight presents ago has retired on the
+        // GPU. Unlike glFinish this leaves the newer frames queued, so the
+        // pipeline stays fed while the CPU stops running further ahead
+        if (m_maxFramesInFlight > 0) {
+            auto& fence = m_frameFences[m_frameIndex % kMaxPendingFences];
+            if (fence) glDeleteSync(fence);
+            fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+            if (m_frameIndex >= (uint64_t)m_maxFramesInFlight) {
+                auto waitFence = m_frameFences[(m_frameIndex - m_maxFramesInFlight) % kMaxPendingFences];
+                // flush on the first wait so the fenced commands are actually
+                // submitted; 100ms cap so a hung driver can't deadlock us
+                if (waitFence) glClientWaitSync(waitFence, GL_SYNC_FLUSH_COMMANDS_BIT, 100'000'000);
+            }
+        }
+        m_frameIndex++;
+
+        uint64_t afterLatency = SDL_GetPerformanceCounter();
+        m_latencyWaitMs = (afterLatency - afterSwap) * 1000.0f / frequency;
+
+        // frame pacing - wait out the remainder of the target interval,
+        // anchored to the end of the previous Present. Sleep covers the bulk
+        // and the last millisecond spins, since the scheduler's wake-up
+        // granularity would otherwise overshoot the target
+        // the focus throttle stacks onto the target interval - the slower
+        // cap wins, pacing an unfocused or minimized window down without
+        // touching the configured target
+        float frameTime = math::max(m_targetFrameTime, m_throttleFrameTime);
+        if (frameTime > 0 && m_lastPresentTime) {
+            uint64_t target = m_lastPresentTime + (uint64_t)(frameTime * frequency);
+            uint64_t now;
+            while ((now = SDL_GetPerformanceCounter()) < target) {
+                double remaining = (target - now) / (double)frequency;
+                if (remaining > 0.002) SDL_DelayNS((uint64_t)((remaining - 0.001) * 1e9));
+            }
+        }
+
+        uint64_t end = SDL_GetPerformanceCounter();
+        m_pacingWaitMs = (end - afterLatency) * 1000.0f / frequency;
+        m_lastPresentTime = end;
+
+        // deliver captures whose transfers have retired - a zero-timeout
+        // fence check, never a stall
+        PollCaptures();
+
+        // harvest last frame's timer queries and flip the query buffers
+        GPUProfiler::NewFrame();
+
+        // step the dynamic resolution scale from the freshly harvested
+        // GPU frame time
+        UpdateResolutionScale();
+
+        // roll the binds-avoided counters and drop the cached bindings - ImGui
+        // rendered with its own GL calls this frame, so they can't be trusted
+        GLState::NewFrame();
+
+        // snapshot the frame's draw/bind/upload counters for the editor
+        // readout and the benchmark report
+        FrameStats::NewFrame();
+    }
+
+    int Renderer::GetMSAASamples() const {
+        int samples = 0;
+        switch (m_aaMode) {
+        case AAMode::MSAA2x: samples = 2; break;
+        case AAMode::MSAA4x: samples = 4; break;
+        case AAMode::MSAA8x: samples = 8; break;
+        default: break;
+        }
+        return math::min(samples, m_maxSamples);
+    }
+
+    void Renderer::SetDynamicResolution(bool enabled) {
+        m_dynamicResolution = enabled;
+        if (!enabled) m_resolutionScale = 1;
+    }
+
+    void Renderer::SetDynamicResolutionRange(float minScale, float maxScale) {
+        m_minResolutionScale = math::clamp(minScale, 0.1f, 1.0f);
+        m_maxResolutionScale = math::clamp(maxScale, m_minResolutionScale, 1.0f);
+    }
+
+    void Renderer::UpdateResolutionScale() {
+        if (!m_dynamicResolution) return;
+
+        float gpuMs = GPUProfiler::GetFrameMs();
+        if (gpuMs <= 0) return; // queries not harvested yet
+
+        // budget from the frame cap when one is set, otherwise 60 Hz
+        float targetMs = (m_targetFrameTime > 0) ? m_targetFrameTime * 1000.0f : 1000.0f / 60.0f;
+
+        // asymmetric steps with a dead band between them, so the scale
+        // backs off quickly when the GPU falls behind and creeps back up
+        // without oscillating across the threshold
+        if (gpuMs > targetMs * 0.95f) m_resolutionScale -= 0.02f;
+        else if (gpuMs < targetMs * 0.80f) m_resolutionScale += 0.005f;
+
+        m_resolutionScale = math::clamp(m_resolutionScale, m_minResolutionScale, m_maxResolutionScale);
+    }
+
+    bool Renderer::RequestCapture(CaptureCallback callback) {
+        // all requests made during a frame share the next readback; the
+        // ring check happens at issue time, but refusing a saturated ring
+        // here lets the caller notice immediately
+        auto& next = m_captureRing[m_captureHead];
+        if (!next.callbacks.empty() && m_captureRequests.empty()) {
+            m_capturesDropped++;
+            return false;
+        }
+
+        m_captureRequests.push_back(std::move(callback));
+        return true;
+    }
+
+    void Renderer::IssueCapture() {
+        if (m_captureRequests.empty()) return;
+
+        auto& capture = m_captureRing[m_captureHead];
+        if (!capture.callbacks.empty()) {
+            // consumer hasn't kept up - every slot still in flight
+            m_capturesDropped += m_captureRequests.size();
+            m_captureRequests.clear();
+            return;
+        }
+
+        // (re)allocate the PBO on first use or window resize
+        size_t size = (size_t)m_width * m_height * 4;
+        if (capture.pbo == 0) {
+            glGenBuffers(1, &capture.pbo);
+            GLDebug::Label(GL_BUFFER, capture.pbo, "capture pbo");
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, capture.pbo);
+        if (capture.width != m_width || capture.height != m_height) {
+            glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+            capture.width = m_width;
+            capture.height = m_height;
+        }
+
+        // the read targets the PBO, so this returns without draining the
+        // pipeline - the fence tells us when the transfer actually retired
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glReadPixels(0, 0, m_width, m_height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        capture.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        capture.callbacks = std::move(m_captureRequests);
+        m_captureRequests.clear();
+
+        m_captureHead = (m_captureHead + 1) % kCaptureRing;
+    }
+
+    void Renderer::PollCaptures() {
+        // deliver in issue order, stopping at the first transfer still in
+        // flight - zero-timeout waits only, never a stall
+        while (true) {
+            auto& capture = m_captureRing[m_captureTail];
+            if (capture.callbacks.empty()) return;
+
+            GLenum status = glClientWaitSync(capture.fence, 0, 0);
+            if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) return;
+
+            glDeleteSync(capture.fence);
+            capture.fence = nullptr;
+
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, capture.pbo);
+            size_t size = (size_t)capture.width * capture.height * 4;
+            const uint8_t* pixels = (const uint8_t*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+            if (pixels) {
+                for (auto& callback : capture.callbacks) {
+                    callback(capture.width, capture.height, pixels);
+                }
+                glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            }
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+            capture.callbacks.clear();
+            m_captureTail = (m_captureTail + 1) % kCaptureRing;
+        }
+    }
+
+    // SDL invokes event watches synchronously from whichever thread pumps
+    // events. During a Windows title-bar drag that is the nested modal
+    // message pump - the only place any of our code runs until the mouse is
+    // released - so this watch is where the frame keeps ticking. Outside a
+    // modal loop the staleness check below fails and the watch is a cheap
+    // early-out.
+    bool Renderer::EventWatch(void* userdata, SDL_Event* event) {
+        Renderer* renderer = (Renderer*)userdata;
+
+        // only the events the modal pump generates are worth checking
+        switch (event->type) {
+        case SDL_EVENT_WINDOW_MOVED:
+        case SDL_EVENT_WINDOW_RESIZED:
+        case SDL_EVENT_WINDOW_EXPOSED:
+            break;
+        default:
+            return true;
+        }
+
+        // the tick re-enters the whole frame - never from within itself
+        if (!renderer->m_modalTick || renderer->m_inModalTick) return true;
+
+        // only tick when the regular loop is demonstrably starved - normal
+        // frames raise these events too and must not render twice. Two
+        // missed frame intervals separates a drag stall from an on-time
+        // loop that just hasn't presented yet this frame
+        float frameTime = math::max(renderer->m_targetFrameTime, renderer->m_throttleFrameTime);
+        float interval = (frameTime > 0) ? frameTime : 1.0f / 60.0f;
+        float sincePresent = (SDL_GetPerformanceCounter() - renderer->m_lastPresentTime) / (float)SDL_GetPerformanceFrequency();
+        if (sincePresent < interval * 2) return true;
+
+        // run one full frame - update, draw, present. Input state marshals
+        // through the snapshot system as usual: the events this pump is
+        // delivering are also queued for the main loop's SDL_PollEvent, so
+        // nothing is consumed out from under it, and InputSystem::Update
+        // reads device state directly. Presenting also refreshes
+        // m_lastPresentTime, which throttles these ticks to the target rate
+        // during a long drag
+        renderer->m_inModalTick = true;
+        renderer->m_modalTick();
+        renderer->m_inModalTick = false;
+
+        return true;
     }
 }
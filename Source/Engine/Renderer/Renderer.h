@@ -7,11 +7,42 @@
 #include <SDL3_ttf/SDL_ttf.h>
 #include <SDL3_image/SDL_image.h>
 #include <glad/glad.h>
+#include "RenderTexture.h"
+#include <functional>
 #include <iostream>
+#include <vector>
 
 namespace neu {
 
-	
+	/// <summary>
+	/// Swap interval policy for Present. GL has no mailbox present mode -
+	/// the closest equivalent is Off combined with the fence latency
+	/// limiter and frame pacing, which renders unthrottled but keeps the
+	/// CPU from running ahead of the display.
+	/// </summary>
+	enum class VSyncMode {
+		Off,        // swap immediately, tearing allowed
+		On,         // block on the display interval
+		Adaptive    // sync when on time, tear instead of stalling when late
+	};
+
+	/// <summary>
+	/// Anti-aliasing mode for backbuffer-bound scene cameras, the quality
+	/// tier knob. MSAA renders the scene color target multisampled and
+	/// resolves explicitly in the render graph - full edge quality at
+	/// multisampled raster/bandwidth cost. FXAA runs one fullscreen
+	/// post-process pass over the resolved image (~0.3 ms) - softer
+	/// results, but the low-end tier's affordable option. Cameras with
+	/// authored output textures keep their authored targets either way.
+	/// </summary>
+	enum class AAMode {
+		None,
+		MSAA2x,
+		MSAA4x,
+		MSAA8x,
+		FXAA
+	};
+
 	/// <summary>
 	/// Main rendering system that manages the SDL window and renderer.
 	/// Provides methods for initializing the graphics system, clearing the screen,
@@ -45,8 +76,9 @@ namespace neu {
 		/// <param name="width">The width of the window in pixels</param>
 		/// <param name="height">The height of the window in pixels</param>
 		/// <param name="fullscreen">If true, creates a fullscreen window; otherwise, windowed mode</param>
+		/// <param name="hidden">If true, the window is never shown and vsync is disabled - used by the headless benchmark harness</param>
 		/// <returns>True if the window and renderer were successfully created; otherwise, false</returns>
-		bool CreateWindow(const std::string& name, int width, int height, bool fullscreen = false);
+		bool CreateWindow(const std::string& name, int width, int height, bool fullscreen = false, bool hidden = false);
 
 		/// <summary>
 		/// Clears the screen with the current draw color.
@@ -61,6 +93,137 @@ namespace neu {
 		/// </summary>
 		void Present();
 
+		/// <summary>
+		/// Sets the swap interval policy. Adaptive falls back to On when the
+		/// driver refuses late swaps.
+		/// </summary>
+		void SetVSync(VSyncMode mode);
+		VSyncMode GetVSync() const { return m_vsyncMode; }
+
+		/// <summary>
+		/// Caps how many frames the CPU may run ahead of the GPU. Present
+		/// fences each frame's commands and blocks (glClientWaitSync, no
+		/// glFinish) until the frame from this many presents ago has
+		/// retired, bounding input latency without draining the pipeline.
+		/// 0 disables the limiter.
+		/// </summary>
+		void SetMaxFramesInFlight(int frames);
+		int GetMaxFramesInFlight() const { return m_maxFramesInFlight; }
+
+		/// <summary>
+		/// Paces Present to a fixed interval (0 = uncapped) - mostly sleep,
+		/// with a short spin for the final stretch so the target isn't
+		/// overshot by scheduler granularity. Independent of vsync, so
+		/// benchmarks can pace without being display-quantized.
+		/// </summary>
+		void SetTargetFrameRate(float fps) { m_targetFrameTime = (fps > 0) ? 1.0f / fps : 0.0f; }
+		float GetTargetFrameRate() const { return (m_targetFrameTime > 0) ? 1.0f / m_targetFrameTime : 0.0f; }
+
+		/// <summary>
+		/// Extra pacing cap layered over the target frame rate - the engine
+		/// sets it while the window is unfocused or minimized and clears it
+		/// on focus (0 = no throttle). The slower of the two caps wins, so
+		/// a throttle never raises an explicitly low target.
+		/// </summary>
+		void SetThrottleFrameRate(float fps) { m_throttleFrameTime = (fps > 0) ? 1.0f / fps : 0.0f; }
+		float GetThrottleFrameRate() const { return (m_throttleFrameTime > 0) ? 1.0f / m_throttleFrameTime : 0.0f; }
+
+		/// <summary>
+		/// Selects the anti-aliasing mode Scene::Draw applies to
+		/// backbuffer-bound cameras. Takes effect next frame - the scene
+		/// target and its passes are declared fresh every frame, so no
+		/// recreation step is needed.
+		/// </summary>
+		void SetAntiAliasing(AAMode mode) { m_aaMode = mode; }
+		AAMode GetAntiAliasing() const { return m_aaMode; }
+
+		/// <summary>
+		/// Sample count the current mode asks of the scene color target,
+		/// clamped to the driver's GL_MAX_SAMPLES. 0 for non-MSAA modes.
+		/// </summary>
+		int GetMSAASamples() const;
+
+		/// <summary>
+		/// Selects the format of the scene color target and the post-process
+		/// intermediates that inherit from it - the HDR/bandwidth quality
+		/// knob. R11G11B10F carries HDR range at RGBA8 bandwidth; RGBA16F is
+		/// full precision at double the bandwidth, for tiers that can afford
+		/// it. Takes effect next frame, same as the AA mode - the pool keys
+		/// targets by format, so a fresh shape is acquired on the next draw.
+		/// </summary>
+		void SetSceneColorFormat(TargetFormat format) { m_sceneColorFormat = format; }
+		TargetFormat GetSceneColorFormat() const { return m_sceneColorFormat; }
+
+		/// <summary>
+		/// Dynamic resolution scaling. When enabled, Scene::Draw renders
+		/// backbuffer-bound cameras into a transient target sized at
+		/// GetResolutionScale() of the window and upscales it in one linear
+		/// blit; the GUI and editor always draw at native resolution. The
+		/// scale walks up or down each Present from the harvested GPU frame
+		/// time against the target frame rate (60 Hz when no cap is set),
+		/// clamped to the configured range.
+		/// </summary>
+		void SetDynamicResolution(bool enabled);
+		bool IsDynamicResolutionEnabled() const { return m_dynamicResolution; }
+		void SetDynamicResolutionRange(float minScale, float maxScale);
+		float GetResolutionScale() const { return m_resolutionScale; }
+
+		// CPU milliseconds the last Present spent blocked, split by cause -
+		// high swap time means GPU/display bound, high pacing time means the
+		// frame cap is the limiter
+		float GetSwapBlockMs() const { return m_swapBlockMs; }
+		float GetLatencyWaitMs() const { return m_latencyWaitMs; }
+		float GetPacingWaitMs() const { return m_pacingWaitMs; }
+
+		/// <summary>
+		/// Runs one full application frame (update, draw, present).
+		/// Installed by the application so the renderer can keep the frame
+		/// loop alive while the OS owns the main thread.
+		/// </summary>
+		using ModalTickCallback = std::function<void()>;
+
+		/// <summary>
+		/// Registers the frame callback ticked from inside the OS modal
+		/// move/resize loop. On Windows, grabbing the title bar traps the
+		/// main thread in a nested message pump - SDL_PollEvent stops
+		/// returning and simulation and rendering freeze for the whole
+		/// drag. SDL delivers window move/resize/exposed events to event
+		/// watches synchronously from inside that pump, so the renderer
+		/// re-enters this callback whenever those events arrive and the
+		/// regular loop has visibly stalled. Gameplay, presents and frame
+		/// telemetry then run through the drag instead of recording it as
+		/// one giant hitch. Pass nullptr to uninstall (the callback must
+		/// not outlive what it captures).
+		/// </summary>
+		/// <param name="callback">The frame function, or nullptr to uninstall</param>
+		void SetModalTickCallback(ModalTickCallback callback) { m_modalTick = std::move(callback); }
+
+		/// <summary>
+		/// Receives one captured frame on the main thread. Pixels are
+		/// tightly packed RGBA8 in GL row order (bottom row first) and are
+		/// only valid for the duration of the call - copy to keep.
+		/// </summary>
+		using CaptureCallback = std::function<void(int width, int height, const uint8_t* pixels)>;
+
+		/// <summary>
+		/// Requests an asynchronous capture of the frame being presented.
+		/// The readback lands in a PBO ring and completion is fence-polled
+		/// on later Presents, so the pipeline never stalls the way a naive
+		/// glReadPixels does - capture-enabled benchmark runs measure real
+		/// performance. The callback (screenshot encoder, video dump)
+		/// arrives one or two frames later; callers wanting every frame
+		/// just request every frame.
+		/// </summary>
+		/// <param name="callback">Invoked on the main thread with the pixels</param>
+		/// <returns>False if the ring is saturated and this frame was dropped</returns>
+		bool RequestCapture(CaptureCallback callback);
+
+		/// <summary>
+		/// Captures dropped because every ring slot was still in flight -
+		/// nonzero means the consumer is slower than the frame rate.
+		/// </summary>
+		uint64_t GetDroppedCaptures() const { return m_capturesDropped; }
+
 		/// <summary>
 		/// Gets the width of the window/render target.
 		/// </summary>
@@ -73,6 +236,13 @@ namespace neu {
 		/// <returns>The height in pixels</returns>
 		int GetHeight() const { return m_height; }
 
+		/// <summary>
+		/// Gets the SDL window, for systems that need the handle directly
+		/// (e.g. the input system toggling relative mouse mode).
+		/// </summary>
+		/// <returns>The SDL window handle</returns>
+		SDL_Window* GetWindow() const { return m_window; }
+
 	private:
 		// Allow Text and Texture classes to access the SDL renderer for their operations
 		friend class Text;
@@ -85,8 +255,78 @@ namespace neu {
 		// SDL window handle
 		SDL_Window* m_window = nullptr;
 
-		
+
 		// openGL context
 		SDL_GLContext m_context = nullptr;
+
+		// swap/present pacing state
+		VSyncMode m_vsyncMode{ VSyncMode::On };
+		int m_maxFramesInFlight{ 2 };
+		float m_targetFrameTime{ 0 };   // seconds, 0 = no pacing
+		float m_throttleFrameTime{ 0 }; // seconds, 0 = no focus throttle
+
+		// per-frame fence ring for the latency limiter - sized past the
+		// largest allowed frames-in-flight cap
+		static constexpr int kMaxPendingFences = 4;
+		GLsync m_frameFences[kMaxPendingFences]{};
+		uint64_t m_frameIndex{ 0 };
+
+		// performance counter at the end of the last Present, the pacing
+		// anchor for the next frame
+		uint64_t m_lastPresentTime{ 0 };
+
+		// CPU-block times from the last Present, exposed above
+		float m_swapBlockMs{ 0 };
+		float m_latencyWaitMs{ 0 };
+		float m_pacingWaitMs{ 0 };
+
+		// steps m_resolutionScale from the GPU frame time, run once per
+		// Present after the timer queries are harvested
+		void UpdateResolutionScale();
+
+		// anti-aliasing mode for the scene color target; the driver's
+		// sample ceiling is queried once at context creation
+		AAMode m_aaMode{ AAMode::None };
+		int m_maxSamples{ 1 };
+
+		// scene color target format - LDR default, packed HDR for tiers
+		// that light beyond display range
+		TargetFormat m_sceneColorFormat{ TargetFormat::RGBA8 };
+
+		// dynamic resolution state
+		bool m_dynamicResolution{ false };
+		float m_resolutionScale{ 1 };
+		float m_minResolutionScale{ 0.5f };
+		float m_maxResolutionScale{ 1.0f };
+
+		// async capture ring - each slot owns a PBO the backbuffer reads
+		// into before the swap, a fence marking when the transfer retired,
+		// and the callbacks waiting on that frame
+		static constexpr int kCaptureRing = 3;
+
+		struct Capture {
+			GLuint pbo{ 0 };
+			GLsync fence{};
+			int width{ 0 };
+			int height{ 0 };
+			std::vector<CaptureCallback> callbacks;  // empty = slot free
+		};
+		Capture m_captureRing[kCaptureRing];
+		int m_captureHead{ 0 };   // next slot to issue into
+		int m_captureTail{ 0 };   // oldest in-flight slot, polled first
+
+		// callbacks requested since the last Present, issued as one readback
+		std::vector<CaptureCallback> m_captureRequests;
+		uint64_t m_capturesDropped{ 0 };
+
+		// issues the queued readback before the swap / delivers retired ones
+		void IssueCapture();
+		void PollCaptures();
+
+		// re-runs the application frame from inside the OS modal
+		// move/resize loop - see SetModalTickCallback
+		static bool EventWatch(void* userdata, SDL_Event* event);
+		ModalTickCallback m_modalTick;
+		bool m_inModalTick{ false };
 	};
 }
@@ -0,0 +1,43 @@
+#include "SamplerCache.h"
+#include "Math/Math.h"
+
+namespace neu {
+	GLuint SamplerCache::Get(const SamplerDesc& desc) {
+		for (const Entry& entry : m_entries) {
+			if (entry.desc == desc) return entry.sampler;
+		}
+
+		GLuint sampler = 0;
+		glGenSamplers(1, &sampler);
+		glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, desc.minFilter);
+		glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, desc.magFilter);
+		glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, desc.wrap);
+		glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, desc.wrap);
+		if (desc.anisotropic) ApplyAnisotropy(sampler);
+
+		m_entries.push_back({ desc, sampler });
+		return sampler;
+	}
+
+	void SamplerCache::SetMaxAnisotropy(float samples) {
+		m_maxAnisotropy = math::max(samples, 1.0f);
+		for (const Entry& entry : m_entries) {
+			if (entry.desc.anisotropic) ApplyAnisotropy(entry.sampler);
+		}
+	}
+
+	void SamplerCache::ApplyAnisotropy(GLuint sampler) {
+		if (!GLAD_GL_VERSION_4_6) return;
+
+		float driverMax = 1.0f;
+		glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY, &driverMax);
+		glSamplerParameterf(sampler, GL_TEXTURE_MAX_ANISOTROPY, math::min(m_maxAnisotropy, driverMax));
+	}
+
+	void SamplerCache::Clear() {
+		for (const Entry& entry : m_entries) {
+			glDeleteSamplers(1, &entry.sampler);
+		}
+		m_entries.clear();
+	}
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "Core/Singleton.h"
+#include <glad/glad.h>
+#include <vector>
+
+namespace neu {
+	// sampling state a texture wants - the sampler reuse key. Equal descs
+	// share one GL sampler object regardless of how many textures use them
+	struct SamplerDesc {
+		GLenum minFilter{ GL_LINEAR_MIPMAP_LINEAR };
+		GLenum magFilter{ GL_LINEAR };
+		GLenum wrap{ GL_REPEAT };
+		bool anisotropic{ true };	// follows the cache-wide anisotropy level
+
+		bool operator==(const SamplerDesc&) const = default;
+	};
+
+	// shares GL sampler objects keyed by state, so identical filtering/wrap
+	// settings exist driver-side once instead of once per texture object,
+	// and a quality-tier anisotropy change is a handful of sampler updates
+	// instead of a sweep over every resident texture. Material::Bind binds
+	// these per unit alongside the textures; paths sampling outside the
+	// material system bind sampler 0 and keep their texture-object state.
+	// Bindless handles bake the texture's own parameters and stay on them
+	class SamplerCache : public Singleton<SamplerCache> {
+	public:
+		// returns the shared sampler for the desc, creating it on first use
+		GLuint Get(const SamplerDesc& desc);
+
+		// updates the anisotropy level on every cached anisotropic sampler -
+		// the whole point of the cache, quality tiers call this. Clamped to
+		// the driver limit; no-op below GL 4.6 (anisotropy entered core there)
+		void SetMaxAnisotropy(float samples);
+		float GetMaxAnisotropy() const { return m_maxAnisotropy; }
+
+		// releases every sampler, called from Engine::Shutdown while the GL
+		// context is still current
+		void Clear();
+
+		size_t GetCount() const { return m_entries.size(); }
+
+	private:
+		friend class Singleton<SamplerCache>;
+		SamplerCache() = default;
+
+		void ApplyAnisotropy(GLuint sampler);
+
+		struct Entry {
+			SamplerDesc desc;
+			GLuint sampler{ 0 };
+		};
+
+		// linear scan - the whole engine produces a handful of distinct descs
+		std::vector<Entry> m_entries;
+		float m_maxAnisotropy{ 8.0f };
+	};
+}
@@ -1,15 +1,342 @@
 #include "EnginePCH.h"
 #include "Shader.h"
+#include <cstring>
+
+namespace {
+	// one cached include file, revalidated by modification time - shaders
+	// sharing lighting code read and cache the include once, not per shader.
+	// Guarded because Program::Prefetch warms the cache from worker threads
+	struct IncludeEntry {
+		std::string source;
+		uint64_t modifiedTime;
+	};
+	std::mutex includeMutex;
+	std::unordered_map<std::string, IncludeEntry> includeCache;
+
+	// compiled GL shader objects keyed by hash of (stage, post-preprocess
+	// source) - Programs whose shaders preprocess to identical text share
+	// one refcounted object instead of compiling copies
+	struct CompiledShader {
+		GLuint shader;
+		int refs;
+	};
+	std::unordered_map<uint64_t, CompiledShader> compiledShaders;
+
+	// FNV-1a over the stage and the resolved source text
+	uint64_t HashSource(GLuint shaderType, const std::string& source) {
+		uint64_t hash = 14695981039346656037ull;
+		hash ^= shaderType;
+		hash *= 1099511628211ull;
+		for (char c : source) {
+			hash ^= static_cast<uint64_t>(static_cast<uint8_t>(c));
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	// drops one reference to a shared compile, deleting the GL object when
+	// the last Shader using it goes away
+	void ReleaseCompiled(uint64_t hash, GLuint shader) {
+		auto iter = compiledShaders.find(hash);
+		if (iter != compiledShaders.end() && iter->second.shader == shader) {
+			if (--iter->second.refs > 0) return;
+			compiledShaders.erase(iter);
+		}
+		glDeleteShader(shader);
+	}
+
+	// fetches an include file's text through the mtime-validated cache,
+	// reading outside the lock like the document cache does
+	bool GetIncludeSource(const std::string& filename, std::string& source) {
+		uint64_t modifiedTime = neu::file::GetModifiedTime(filename);
+		{
+			std::lock_guard lock(includeMutex);
+			auto iter = includeCache.find(filename);
+			if (iter != includeCache.end() && iter->second.modifiedTime == modifiedTime) {
+				source = iter->second.source;
+				return true;
+			}
+		}
+
+		if (!neu::file::ReadTextFile(filename, source)) return false;
+
+		std::lock_guard lock(includeMutex);
+		includeCache[filename] = { source, modifiedTime };
+		return true;
+	}
+
+	// parses `#include "file"` (or <file>), tolerating leading whitespace
+	bool ParseInclude(const std::string& line, std::string& name) {
+		size_t pos = line.find_first_not_of(" \t");
+		if (pos == std::string::npos || line[pos] != '#') return false;
+		pos = line.find_first_not_of(" \t", pos + 1);
+		if (pos == std::string::npos || line.compare(pos, 7, "include") != 0) return false;
+
+		size_t open = line.find_first_of("\"<", pos + 7);
+		if (open == std::string::npos) return false;
+		size_t close = line.find(line[open] == '<' ? '>' : '"', open + 1);
+		if (close == std::string::npos) return false;
+
+		name = line.substr(open + 1, close - open - 1);
+		return !name.empty();
+	}
+
+	// includes resolve against the including file's directory first, then
+	// as written (relative to the working directory like every asset path)
+	std::string ResolveInclude(const std::string& name, const std::string& from) {
+		std::string sibling = (std::filesystem::path(from).parent_path() / name).generic_string();
+		if (neu::file::Exists(sibling)) return sibling;
+		return name;
+	}
+
+	// ---- cooked SPIR-V ----
+	// the cooked sibling rides next to the source, like .nenv and .ntex
+	std::string GetSpirvFilename(const std::string& filename) {
+		return filename + ".spv";
+	}
+
+	// glslangValidator's stage name for a GL stage enum
+	const char* SpirvStageName(GLuint shaderType) {
+		switch (shaderType) {
+		case GL_VERTEX_SHADER: return "vert";
+		case GL_FRAGMENT_SHADER: return "frag";
+		case GL_GEOMETRY_SHADER: return "geom";
+		case GL_TESS_CONTROL_SHADER: return "tesc";
+		case GL_TESS_EVALUATION_SHADER: return "tese";
+		case GL_COMPUTE_SHADER: return "comp";
+		}
+		return nullptr;
+	}
+
+	// cook-time compiler: glslangValidator from the Vulkan SDK, probed
+	// once. Absent (player machines) means no cooking here - shipped packs
+	// carry binaries cooked on a dev machine, and sources without one fall
+	// back to the text path
+	bool SpirvCompilerAvailable() {
+		static int available = -1;
+		if (available < 0) {
+#ifdef _WIN32
+			available = std::system("glslangValidator --version > NUL 2>&1") == 0 ? 1 : 0;
+#else
+			available = std::system("glslangValidator --version > /dev/null 2>&1") == 0 ? 1 : 0;
+#endif
+			if (!available) {
+				LOG_CAT_INFO(Renderer, "glslangValidator not found - shaders compile from text");
+			}
+		}
+		return available == 1;
+	}
+
+	// SPIR-V streams are word-aligned and open with a fixed magic - the
+	// cheap structural validation applied to every cooked binary, at cook
+	// and again before handing it to the driver
+	bool ValidateSpirv(const std::vector<uint8_t>& binary) {
+		constexpr uint32_t kSpirvMagic = 0x07230203;
+		if (binary.size() < sizeof(uint32_t) || binary.size() % sizeof(uint32_t) != 0) return false;
+		uint32_t magic;
+		std::memcpy(&magic, binary.data(), sizeof(magic));
+		return magic == kSpirvMagic;
+	}
+
+	// compiles the preprocessed source to a cooked SPIR-V sibling through
+	// glslangValidator (-G targets OpenGL semantics). The tool validates
+	// the whole shader, so errors surface here - at cook - instead of at
+	// runtime link on a player's driver
+	bool CookSpirv(const std::string& filename, const std::string& spirvFilename, GLuint shaderType, const std::string& source) {
+		const char* stage = SpirvStageName(shaderType);
+		if (!stage) return false;
+
+		// the source is already include-resolved, so the tool needs no
+		// search paths - write it beside the output and clean up after
+		std::string cookInput = spirvFilename + ".cook";
+		if (!neu::file::WriteTextFile(cookInput, source)) return false;
+
+		std::string command = "glslangValidator -G --quiet -S " + std::string(stage) +
+			" -o \"" + spirvFilename + "\" \"" + cookInput + "\"";
+		int result = std::system(command.c_str());
+
+		std::error_code ec;
+		std::filesystem::remove(cookInput, ec);
+
+		if (result != 0) {
+			LOG_CAT_WARNING(Renderer, "SPIR-V cook failed ({}): glslangValidator reported errors", filename);
+			return false;
+		}
+
+		// structural read-back check - a truncated write must not get
+		// picked up as a fresh binary on the next run
+		std::vector<uint8_t> binary;
+		if (!neu::file::ReadBinaryFile(spirvFilename, binary) || !ValidateSpirv(binary)) {
+			LOG_CAT_WARNING(Renderer, "SPIR-V cook produced an invalid binary: {}", spirvFilename);
+			std::filesystem::remove(spirvFilename, ec);
+			return false;
+		}
+		return true;
+	}
+
+	// FNV-1a over the stage and a cooked binary - same keyspace as
+	// HashSource, so binary and text compiles share the dedup cache
+	uint64_t HashBinary(GLuint shaderType, const std::vector<uint8_t>& binary) {
+		uint64_t hash = 14695981039346656037ull;
+		hash ^= shaderType;
+		hash *= 1099511628211ull;
+		for (uint8_t byte : binary) {
+			hash ^= byte;
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	// loads a cooked binary for a define-less shader - cooking it first
+	// when the sibling is missing or stale and the compiler is on this
+	// machine. false sends the caller down the text path
+	bool TryLoadSpirv(const std::string& filename, GLuint shaderType, const std::string& source,
+		const std::vector<std::string>& dependencies, GLuint& outShader, uint64_t& outHash) {
+		std::string spirvFilename = GetSpirvFilename(filename);
+
+		// development edits win: a loose source (or include) newer than
+		// the cooked sibling recooks or falls back to text, never a stale
+		// binary. No loose files at all is the shipped case - the pack's
+		// binary was cooked against the pack's source
+		bool useCooked = false;
+		if (neu::file::Exists(spirvFilename)) {
+			bool stale = false;
+			for (auto& dependency : dependencies) {
+				stale |= neu::file::Exists(dependency) &&
+					neu::file::GetModifiedTime(dependency) > neu::file::GetModifiedTime(spirvFilename);
+			}
+			useCooked = !stale;
+		}
+		else if (!neu::file::Exists(filename)) {
+			useCooked = true;
+		}
+
+		if (!useCooked) {
+			if (!SpirvCompilerAvailable()) return false;
+			if (!CookSpirv(filename, spirvFilename, shaderType, source)) return false;
+		}
+
+		std::vector<uint8_t> binary;
+		if (!neu::file::ReadBinaryFile(spirvFilename, binary) || !ValidateSpirv(binary)) return false;
+
+		// binary compiles share the same dedup cache as text compiles -
+		// two programs pulling in one cooked shader get one GL object
+		uint64_t hash = HashBinary(shaderType, binary);
+		auto iter = compiledShaders.find(hash);
+		if (iter != compiledShaders.end()) {
+			iter->second.refs++;
+			outShader = iter->second.shader;
+			outHash = hash;
+			return true;
+		}
+
+		GLuint shader = glCreateShader(shaderType);
+		glShaderBinary(1, &shader, GL_SHADER_BINARY_FORMAT_SPIR_V, binary.data(), (GLsizei)binary.size());
+		glSpecializeShader(shader, "main", 0, nullptr, nullptr);
+
+		GLint success;
+		glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+		if (!success) {
+			std::string infoLog(512, '\0');
+			GLsizei length;
+			glGetShaderInfoLog(shader, (GLsizei)infoLog.size(), &length, &infoLog[0]);
+			infoLog.resize(length);
+			LOG_CAT_WARNING(Renderer, "SPIR-V specialization failed ({}): {}", filename, infoLog);
+			glDeleteShader(shader);
+			return false;
+		}
+
+		compiledShaders[hash] = { shader, 1 };
+		outShader = shader;
+		outHash = hash;
+		return true;
+	}
+
+	// variant defines splice in after the #version directive, which GLSL
+	// requires to stay the first line of the source
+	void InjectDefines(std::string& source, const std::string& defines) {
+		size_t pos = 0;
+		if (source.compare(0, 8, "#version") == 0) {
+			pos = source.find('\n');
+			pos = (pos == std::string::npos) ? source.size() : pos + 1;
+		}
+		source.insert(pos, defines);
+	}
+
+	// recursive splice - each file contributes once per shader, so shared
+	// and cyclic includes terminate instead of duplicating or recursing
+	bool Expand(const std::string& filename, std::string& out, std::vector<std::string>* dependencies, std::unordered_set<std::string>& seen) {
+		if (!seen.insert(filename).second) return true;
+
+		std::string source;
+		if (!GetIncludeSource(filename, source)) return false;
+		if (dependencies) dependencies->push_back(filename);
+
+		std::stringstream lines(source);
+		std::string line;
+		while (std::getline(lines, line)) {
+			std::string includeName;
+			if (ParseInclude(line, includeName)) {
+				std::string resolved = ResolveInclude(includeName, filename);
+				if (!Expand(resolved, out, dependencies, seen)) {
+					LOG_CAT_WARNING(Renderer, "Could not resolve shader include {} (from {})", includeName, filename);
+					return false;
+				}
+				continue;
+			}
+			out += line;
+			out += '\n';
+		}
+		return true;
+	}
+}
 
 neu::Shader::~Shader()
 {
-	if (m_shader) glDeleteShader(m_shader);
+	if (m_shader) ReleaseCompiled(m_sourceHash, m_shader);
 }
 
-bool neu::Shader::Load(const std::string& filename, GLuint shaderType)
+bool neu::Shader::Preprocess(const std::string& filename, std::string& source, std::vector<std::string>* dependencies)
 {
+	source.clear();
+	std::unordered_set<std::string> seen;
+	return Expand(filename, source, dependencies, seen);
+}
+
+bool neu::Shader::Load(const std::string& filename, GLuint shaderType, const std::string& defines)
+{
+	m_shaderType = shaderType;
+	m_filename = filename;
+	m_defines = defines;
+
 	std::string source;
-	neu::file::ReadTextFile(filename, source);
+	m_dependencies.clear();
+	if (!Preprocess(filename, source, &m_dependencies)) {
+		LOG_CAT_WARNING(Renderer, "Could not read shader: {}", filename);
+		return false;
+	}
+	if (!defines.empty()) InjectDefines(source, defines);
+
+	// cooked SPIR-V sidesteps the driver's GLSL frontend - the slowest,
+	// most variance-prone part of a cold compile. Variant shaders stay on
+	// the text path (their define set is spliced into text, never
+	// cooked), and pre-4.6 drivers never see a binary
+	if (defines.empty() && GLAD_GL_VERSION_4_6 &&
+		TryLoadSpirv(filename, shaderType, source, m_dependencies, m_shader, m_sourceHash)) {
+		return true;
+	}
+
+	// identical post-preprocess sources share one GL object - a hit means
+	// another Shader already compiled exactly this text for this stage
+	// (including the variant defines, which are part of the text by now)
+	m_sourceHash = HashSource(shaderType, source);
+	auto iter = compiledShaders.find(m_sourceHash);
+	if (iter != compiledShaders.end()) {
+		iter->second.refs++;
+		m_shader = iter->second.shader;
+		return true;
+	}
+
 	const char* source_cstr = source.c_str();
 
 	m_shader = glCreateShader(shaderType);
@@ -23,7 +350,7 @@ bool neu::Shader::Load(const std::string& filename, GLuint shaderType)
 		glGetShaderInfoLog(m_shader, (GLsizei)infoLog.size(), &length, &infoLog[0]);
 		infoLog.resize(length);
 
-		LOG_WARNING("Shader compilation failed: {}", infoLog);
+		LOG_CAT_WARNING(Renderer, "Shader compilation failed ({}): {}", filename, infoLog);
 
 		// delete shader
 		glDeleteShader(m_shader);
@@ -31,5 +358,35 @@ bool neu::Shader::Load(const std::string& filename, GLuint shaderType)
 
 		return false;
 	}
+
+	compiledShaders[m_sourceHash] = { m_shader, 1 };
+	return true;
+}
+
+bool neu::Shader::Reload(const std::string& filename)
+{
+	// recompile from the recorded source file and defines - for variant
+	// shaders the resource name hot reload passes in is the decorated
+	// cache id, not a file on disk
+	const std::string& sourceFile = m_filename.empty() ? filename : m_filename;
+	std::string defines = m_defines;
+
+	// compile the edited source into a new object first - a syntax error
+	// leaves the previous compile in place, so programs keep rendering
+	// with the last good shader until the file is fixed
+	GLuint previous = m_shader;
+	uint64_t previousHash = m_sourceHash;
+	m_shader = 0;
+
+	if (!Load(sourceFile, m_shaderType, defines)) {
+		m_shader = previous;
+		m_sourceHash = previousHash;
+		return false;
+	}
+
+	// the old object may still be attached to programs (or shared with an
+	// unedited identical shader) - releasing the reference is safe, GL
+	// keeps a flagged shader alive until the relink detaches it
+	if (previous) ReleaseCompiled(previousHash, previous);
 	return true;
 }
@@ -5,11 +5,57 @@ namespace neu {
 	public:
 		~Shader();
 
-		bool Load(const std::string& filename, GLuint shaderType);
+		// compiles the preprocessed source, optionally specialized by a
+		// block of #define lines spliced in after the #version directive -
+		// program variants pass their USE_* defines here.
+		// Define-less shaders on GL 4.6 drivers load from a cooked SPIR-V
+		// sibling (<file>.spv, cooked through glslangValidator on machines
+		// that have it - same sibling scheme as .nenv/.ntex) via
+		// glShaderBinary/glSpecializeShader, skipping the driver's GLSL
+		// frontend; stale or missing binaries fall back to this text path
+		bool Load(const std::string& filename, GLuint shaderType, const std::string& defines = "");
+
+		// recompiles from the edited source into a fresh GL shader object,
+		// keeping the old one on a compile error so dependent programs stay
+		// usable while the shader is being fixed. Recompiles from the
+		// recorded source file and defines - variant shaders cache under a
+		// decorated id, not their file name
+		bool Reload(const std::string& filename) override;
+
+		// resolves #include directives recursively into one source string,
+		// optionally recording every file the result depends on. Include
+		// files cache by modification time, so a dozen shaders sharing one
+		// include read it once, and each file splices in at most once per
+		// shader (cycle safe). Also used by Program to key its binary
+		// cache, so an edited include invalidates cached binaries too
+		static bool Preprocess(const std::string& filename, std::string& source, std::vector<std::string>* dependencies = nullptr);
+
+		// files the last compile depended on (the source and its includes) -
+		// hot reload stats these so an edited source or shared include
+		// recompiles every shader (and variant) pulling it in
+		const std::vector<std::string>& GetDependencies() const { return m_dependencies; }
+
+		// the source file the last compile ran from - for variant shaders
+		// this differs from the resource name, which carries the variant id
+		const std::string& GetFilename() const { return m_filename; }
+
 		void UpdateGUI() override {};
 
 	public:
 		GLuint m_shader;
+
+	private:
+		// stage, source file and variant defines recorded at load so hot
+		// reload can recompile in kind
+		GLuint m_shaderType{ 0 };
+		std::string m_filename;
+		std::string m_defines;
+
+		// hash of (stage, post-preprocess source) - identical shaders share
+		// one refcounted GL object, and this keys the release
+		uint64_t m_sourceHash{ 0 };
+
+		std::vector<std::string> m_dependencies;
 	};
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,165 @@
+#include "EnginePCH.h"
+#include "SpriteBatch.h"
+
+namespace neu {
+
+	SpriteBatch::~SpriteBatch()
+	{
+		if (m_vao) {
+			GLState::InvalidateVertexArray(m_vao);
+			glDeleteVertexArrays(1, &m_vao);
+		}
+	}
+
+	void SpriteBatch::Begin(Renderer& renderer)
+	{
+		ASSERT_MSG(!m_begun, "SpriteBatch::Begin called twice without End");
+
+		m_screenSize = { (float)renderer.GetWidth(), (float)renderer.GetHeight() };
+		m_sprites.clear();
+		m_begun = true;
+	}
+
+	void SpriteBatch::Push(GLuint texture, const glm::vec4& rect, const glm::vec4& uvRect, const glm::vec4& color)
+	{
+		ASSERT_MSG(m_begun, "SpriteBatch::Draw outside Begin/End");
+		m_sprites.push_back(Sprite{ texture, rect, uvRect, color });
+	}
+
+	void SpriteBatch::Draw(const res_t<Texture>& texture, const rect& destination, const glm::vec4& color)
+	{
+		if (!texture) return;
+		Push(texture->m_texture,
+			{ destination.x, destination.y, destination.w, destination.h },
+			{ 0, 0, 1, 1 }, color);
+	}
+
+	void SpriteBatch::Draw(const res_t<Texture>& texture, const rect& destination, const rect& source, const glm::vec4& color)
+	{
+		if (!texture) return;
+
+		glm::vec2 size = texture->GetSize();
+		Push(texture->m_texture,
+			{ destination.x, destination.y, destination.w, destination.h },
+			{ source.x / size.x, source.y / size.y, source.w / size.x, source.h / size.y },
+			color);
+	}
+
+	void SpriteBatch::Draw(const res_t<TextureAnimation>& animation, int frame, const rect& destination, const glm::vec4& color)
+	{
+		if (!animation || !animation->GetTexture()) return;
+
+		auto texture = animation->GetTexture();
+		glm::vec2 size = texture->GetSize();
+		rect source = animation->GetFrameRect(frame);
+		Push(texture->m_texture,
+			{ destination.x, destination.y, destination.w, destination.h },
+			{ source.x / size.x, source.y / size.y, source.w / size.x, source.h / size.y },
+			color);
+	}
+
+	void SpriteBatch::Draw(const res_t<Font>& font, const std::string& text, const glm::vec2& position, const glm::vec4& color, float scale)
+	{
+		if (!font) return;
+
+		// glyph quads go through the same stream as every other sprite, so
+		// text costs quads, not a draw per string
+		glm::vec2 pen = position;
+		for (char ch : text) {
+			if (ch == '\n') {
+				pen.x = position.x;
+				pen.y += font->GetLineHeight() * scale;
+				continue;
+			}
+
+			auto glyph = font->GetGlyph(ch);
+			if (!glyph) continue;
+
+			if (glyph->size.x > 0) {
+				Push(font->GetAtlasTexture(),
+					{ pen + glyph->offset * scale, glyph->size * scale },
+					glyph->uvRect, color);
+			}
+			pen.x += glyph->advance * scale;
+		}
+	}
+
+	void SpriteBatch::End()
+	{
+		ASSERT_MSG(m_begun, "SpriteBatch::End without Begin");
+		m_begun = false;
+
+		m_spriteCount = m_sprites.size();
+		m_drawCount = 0;
+		if (m_sprites.empty()) return;
+
+		if (!s_programChecked) {
+			s_programChecked = true;
+			s_program = Resources().Get<Program>("Shaders/sprite.prog");
+			// there is no fallback path - say so once instead of dropping
+			// every batch silently
+			if (!s_program || !s_program->m_program) {
+				LOG_CAT_WARNING(Renderer, "Sprite program missing, sprite batches will not render");
+			}
+		}
+		if (!s_program || !s_program->m_program) return;
+
+		// group by texture, keeping submission order within each group -
+		// each contiguous range becomes one instanced draw
+		std::stable_sort(m_sprites.begin(), m_sprites.end(), [](const Sprite& a, const Sprite& b) {
+			return a.texture < b.texture;
+		});
+
+		m_instances.clear();
+		for (auto& sprite : m_sprites) {
+			m_instances.push_back(SpriteInstance{ sprite.rect, sprite.uvRect, sprite.color });
+		}
+
+		// grow the ring when the sprite count outruns it - streamed buffers
+		// are fixed-size, so replace rather than resize
+		if (m_instances.size() > m_capacity) {
+			m_capacity = math::max<size_t>(m_capacity * 2, 256);
+			while (m_capacity < m_instances.size()) m_capacity *= 2;
+			m_buffer = StorageBuffer{};
+			m_buffer.Create(m_capacity * sizeof(SpriteInstance), 0);
+		}
+		m_buffer.Upload(m_instances.data(), m_instances.size() * sizeof(SpriteInstance));
+
+		// attribute-less draw - the vertex shader pulls the sprite at
+		// u_base + gl_InstanceID and maps pixels to clip space
+		if (!m_vao) glGenVertexArrays(1, &m_vao);
+
+		s_program->Use();
+		s_program->SetUniform("u_screenSize", m_screenSize);
+		s_program->SetUniform("u_texture", 0);
+
+		// overlays blend in submission order with depth untouched
+		GLState::SetBlend(true);
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		GLState::SetDepthMask(false);
+		GLState::SetActiveTexture(GL_TEXTURE0);
+		// overlay textures (font atlases, sprites) sample with their own
+		// clamped parameters, not whatever material sampler is left bound
+		GLState::BindSampler(0, 0);
+		GLState::BindVertexArray(m_vao);
+
+		size_t start = 0;
+		while (start < m_sprites.size()) {
+			GLuint texture = m_sprites[start].texture;
+
+			size_t end = start + 1;
+			while (end < m_sprites.size() && m_sprites[end].texture == texture) end++;
+
+			GLState::BindTexture(GL_TEXTURE_2D, texture);
+			s_program->SetUniform("u_base", (int)start);
+			glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, (GLsizei)(end - start));
+			FrameStats::AddDraw(2 * (uint32_t)(end - start));
+			m_drawCount++;
+
+			start = end;
+		}
+
+		GLState::SetDepthMask(true);
+		GLState::SetBlend(false);
+	}
+}
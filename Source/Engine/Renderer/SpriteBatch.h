@@ -0,0 +1,97 @@
+#pragma once
+#include "Resources/Resource.h"
+#include "StorageBuffer.h"
+#include "Math/Rect.h"
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <string>
+#include <vector>
+
+namespace neu {
+	class Renderer;
+	class Program;
+	class Texture;
+	class TextureAnimation;
+	class Font;
+
+	// immediate-mode 2D batching for HUD and overlay rendering: Begin/Draw/
+	// End calls accumulate textured quads in screen pixels, and End sorts
+	// them by texture, streams the lot through the persistent-mapped ring
+	// (SSBO binding 0) and flushes one instanced draw per texture with the
+	// shared sprite program ("Shaders/sprite.prog" - sprites don't render
+	// without it).
+	//
+	// sprite sheet frames (TextureAnimation) and glyph-atlas text (Font)
+	// submit through the same stream, so a whole menu screen lands in a
+	// handful of draws. Sorting groups by texture, so overlap order between
+	// quads of different textures isn't preserved - batch layers (e.g.
+	// backdrop, widgets, text) separately when that matters.
+	class SpriteBatch {
+	public:
+		SpriteBatch() = default;
+		~SpriteBatch();
+
+		// batches own GL objects, keep one per layer rather than copying
+		SpriteBatch(const SpriteBatch&) = delete;
+		SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+		// starts a batch - the renderer provides the screen size the quads
+		// are laid out in
+		void Begin(Renderer& renderer);
+
+		// whole texture into the destination rect (screen pixels)
+		void Draw(const res_t<Texture>& texture, const rect& destination, const glm::vec4& color = { 1, 1, 1, 1 });
+
+		// source rect (texture pixels) into the destination rect
+		void Draw(const res_t<Texture>& texture, const rect& destination, const rect& source, const glm::vec4& color = { 1, 1, 1, 1 });
+
+		// one sprite sheet frame into the destination rect
+		void Draw(const res_t<TextureAnimation>& animation, int frame, const rect& destination, const glm::vec4& color = { 1, 1, 1, 1 });
+
+		// glyph-atlas text with its top-left at position (screen pixels)
+		void Draw(const res_t<Font>& font, const std::string& text, const glm::vec2& position, const glm::vec4& color = { 1, 1, 1, 1 }, float scale = 1);
+
+		// sorts, streams and submits everything accumulated since Begin
+		void End();
+
+		// stats from the last End
+		size_t GetSpriteCount() const { return m_spriteCount; }
+		size_t GetDrawCount() const { return m_drawCount; }
+
+	private:
+		void Push(GLuint texture, const glm::vec4& rect, const glm::vec4& uvRect, const glm::vec4& color);
+
+		// one queued quad - the GL texture name keys the sort so Texture
+		// objects and font atlases batch through the same path
+		struct Sprite {
+			GLuint texture;
+			glm::vec4 rect;		// x, y, w, h in screen pixels
+			glm::vec4 uvRect;	// source region (u, v, w, h) in texture space
+			glm::vec4 color;
+		};
+
+		// matches the std430 layout the sprite vertex shader reads
+		struct SpriteInstance {
+			glm::vec4 rect;
+			glm::vec4 uvRect;
+			glm::vec4 color;
+		};
+
+		std::vector<Sprite> m_sprites;
+		std::vector<SpriteInstance> m_instances;	// scratch, reused across frames
+		glm::vec2 m_screenSize{ 0 };
+		bool m_begun{ false };
+
+		// instance stream on the persistent-mapped ring, grown on demand
+		StorageBuffer m_buffer;
+		size_t m_capacity{ 0 };
+		GLuint m_vao{ 0 };
+
+		size_t m_spriteCount{ 0 };
+		size_t m_drawCount{ 0 };
+
+		// program shared by every sprite batch, fetched once
+		inline static res_t<Program> s_program;
+		inline static bool s_programChecked{ false };
+	};
+}
@@ -0,0 +1,308 @@
+#include "StaticBatcher.h"
+#include "Material.h"
+#include "Model.h"
+#include "VertexBuffer.h"
+#include "GLState.h"
+#include "Framework/Scene.h"
+#include "Components/LightComponent.h"
+#include "Components/ModelRenderer.h"
+#include <map>
+
+namespace neu {
+	void StaticBatcher::Build(Scene& scene) {
+		PROFILE_SCOPE("StaticBatcher::Build");
+
+		Clear();
+
+		// group static renderers by material - each group becomes one batch
+		// and one indirect submit per pass
+		std::map<Material*, std::vector<ModelRenderer*>> groups;
+		for (auto renderer : scene.GetActorComponents<ModelRenderer>()) {
+			if (!renderer->isStatic) continue;
+			if (!renderer->model || !renderer->material) continue;
+
+			groups[renderer->material.get()].push_back(renderer);
+		}
+
+		for (auto& [material, renderers] : groups) {
+			// size the merged buffers - only indexed GL_UNSIGNED_INT submeshes
+			// merge, which is everything Model produces
+			GLsizeiptr vertexCount = 0;
+			GLsizeiptr indexCount = 0;
+			size_t drawCount = 0;
+			for (auto renderer : renderers) {
+				for (auto& vertexBuffer : renderer->model->GetVertexBuffers()) {
+					if (!vertexBuffer->GetIBO() || vertexBuffer->GetIndexType() != GL_UNSIGNED_INT) continue;
+
+					vertexCount += vertexBuffer->GetVertexCount();
+					indexCount += vertexBuffer->GetIndexCount();
+					drawCount++;
+				}
+			}
+			if (drawCount == 0) continue;
+
+			Batch batch;
+			batch.material = renderers[0]->material;
+			batch.draws.reserve(drawCount);
+
+			glGenBuffers(1, &batch.vbo);
+			glBindBuffer(GL_ARRAY_BUFFER, batch.vbo);
+			glBufferData(GL_ARRAY_BUFFER, vertexCount * sizeof(Model::VertexPacked), nullptr, GL_STATIC_DRAW);
+
+			glGenBuffers(1, &batch.ibo);
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.ibo);
+			glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexCount * sizeof(GLuint), nullptr, GL_STATIC_DRAW);
+
+			// merge GPU-side - the models already uploaded their geometry, so
+			// the batch copies buffer to buffer without touching the CPU data
+			std::vector<glm::mat4> matrices;
+			matrices.reserve(drawCount);
+
+			GLint vertexOffset = 0;
+			GLuint indexOffset = 0;
+			for (auto renderer : renderers) {
+				glm::mat4 world = scene.GetWorldMatrix(renderer->owner);
+				Bounds bounds = renderer->GetWorldBounds();
+
+				for (auto& vertexBuffer : renderer->model->GetVertexBuffers()) {
+					if (!vertexBuffer->GetIBO() || vertexBuffer->GetIndexType() != GL_UNSIGNED_INT) continue;
+
+					glBindBuffer(GL_COPY_READ_BUFFER, vertexBuffer->GetVBO());
+					glBindBuffer(GL_COPY_WRITE_BUFFER, batch.vbo);
+					glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, vertexBuffer->GetVertexByteOffset(), vertexOffset * sizeof(Model::VertexPacked), vertexBuffer->GetVertexCount() * sizeof(Model::VertexPacked));
+
+					glBindBuffer(GL_COPY_READ_BUFFER, vertexBuffer->GetIBO());
+					glBindBuffer(GL_COPY_WRITE_BUFFER, batch.ibo);
+					glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, vertexBuffer->GetIndexByteOffset(), indexOffset * sizeof(GLuint), vertexBuffer->GetIndexCount() * sizeof(GLuint));
+
+					// baseVertex keeps the source indices valid inside the
+					// merged buffer, baseInstance selects this draw's matrix
+					Draw draw;
+					draw.bounds = bounds;
+					draw.indexCount = vertexBuffer->GetIndexCount();
+					draw.firstIndex = indexOffset;
+					draw.baseVertex = vertexOffset;
+					draw.baseInstance = (GLuint)batch.draws.size();
+					batch.draws.push_back(draw);
+
+					matrices.push_back(world);
+
+					vertexOffset += vertexBuffer->GetVertexCount();
+					indexOffset += vertexBuffer->GetIndexCount();
+				}
+			}
+
+			// static world matrices, one row per draw, uploaded once
+			glGenBuffers(1, &batch.matrixVbo);
+			glBindBuffer(GL_ARRAY_BUFFER, batch.matrixVbo);
+			glBufferData(GL_ARRAY_BUFFER, matrices.size() * sizeof(glm::mat4), matrices.data(), GL_STATIC_DRAW);
+
+			// batch VAO - vertex stream on 0-3 (Model::VertexPacked layout), the
+			// per-draw matrix on the instance attribute slots
+			glGenVertexArrays(1, &batch.vao);
+			GLState::BindVertexArray(batch.vao);
+
+			glBindBuffer(GL_ARRAY_BUFFER, batch.vbo);
+			glEnableVertexAttribArray(0);
+			glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Model::VertexPacked), (void*)offsetof(Model::VertexPacked, position));
+			glEnableVertexAttribArray(1);
+			glVertexAttribPointer(1, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(Model::VertexPacked), (void*)offsetof(Model::VertexPacked, texcoord));
+			glEnableVertexAttribArray(2);
+			glVertexAttribPointer(2, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(Model::VertexPacked), (void*)offsetof(Model::VertexPacked, normal));
+			glEnableVertexAttribArray(3);
+			glVertexAttribPointer(3, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(Model::VertexPacked), (void*)offsetof(Model::VertexPacked, tangent));
+
+			glBindBuffer(GL_ARRAY_BUFFER, batch.matrixVbo);
+			for (int i = 0; i < 4; i++) {
+				int index = Model::instanceMatrixAttribute + i;
+				glEnableVertexAttribArray(index);
+				glVertexAttribPointer(index, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)(sizeof(glm::vec4) * i));
+				glVertexAttribDivisor(index, 1);
+			}
+
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.ibo);
+
+			// persistently-mapped command ring - kFrameCount regions so the
+			// cull pass rewrites commands without waiting on the driver
+			glGenBuffers(1, &batch.commandBuffer);
+			glBindBuffer(GL_DRAW_INDIRECT_BUFFER, batch.commandBuffer);
+			GLsizeiptr commandSize = kFrameCount * drawCount * sizeof(IndirectCommand);
+			GLbitfield mapFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			glBufferStorage(GL_DRAW_INDIRECT_BUFFER, commandSize, nullptr, mapFlags);
+			batch.commands = (IndirectCommand*)glMapBufferRange(GL_DRAW_INDIRECT_BUFFER, 0, commandSize, mapFlags);
+
+			// prefill every ring region with complete commands - the GPU cull
+			// only rewrites instanceCount, everything else is immutable
+			for (int frame = 0; frame < kFrameCount; frame++) {
+				for (size_t i = 0; i < batch.draws.size(); i++) {
+					const Draw& draw = batch.draws[i];
+					batch.commands[frame * batch.draws.size() + i] = { draw.indexCount, 1u, draw.firstIndex, draw.baseVertex, draw.baseInstance };
+				}
+			}
+
+			// per-draw world bounds (min/max pairs) read by the culling
+			// compute pass - static geometry, so uploaded once
+			std::vector<glm::vec4> boundsData;
+			boundsData.reserve(batch.draws.size() * 2);
+			for (auto& draw : batch.draws) {
+				boundsData.push_back(glm::vec4(draw.bounds.min, 0));
+				boundsData.push_back(glm::vec4(draw.bounds.max, 0));
+			}
+			batch.boundsBuffer.CreateStatic(boundsData.data(), boundsData.size() * sizeof(glm::vec4), 0);
+
+			m_batches.push_back(std::move(batch));
+		}
+
+		size_t totalDraws = 0;
+		for (auto& batch : m_batches) totalDraws += batch.draws.size();
+		LOG_CAT_INFO(Renderer, "Static batches built: {} batches, {} draws", m_batches.size(), totalDraws);
+	}
+
+	void StaticBatcher::BakeLightMasks(const std::vector<LightComponent*>& lights) {
+		PROFILE_SCOPE("StaticBatcher::BakeLightMasks");
+
+		// a mask bit per light up to the mask width - lights past it (far
+		// beyond the uniform caps anyway) stay enabled for every draw
+		int lightCount = math::min((int)lights.size(), 32);
+
+		std::vector<uint32_t> masks;
+		for (auto& batch : m_batches) {
+			masks.clear();
+			masks.reserve(batch.draws.size());
+			for (auto& draw : batch.draws) {
+				uint32_t mask = ~0u;
+				for (int i = 0; i < lightCount; i++) {
+					if (!lights[i]->Affects(draw.bounds)) mask &= ~(1u << i);
+				}
+				masks.push_back(mask);
+			}
+			if (masks.empty()) continue;
+
+			// immutable contents, replaced outright on each (rare) rebake
+			batch.lightMaskBuffer = StorageBuffer();
+			batch.lightMaskBuffer.CreateStatic(masks.data(), masks.size() * sizeof(uint32_t), Program::staticLightMaskBinding);
+		}
+	}
+
+	void StaticBatcher::Draw(const Frustum& frustum) {
+		if (m_batches.empty()) return;
+
+		PROFILE_SCOPE("StaticBatcher::Draw");
+
+		// one-time fetch of the culling compute program - scenes shipping
+		// without the asset keep the CPU cull below
+		if (!m_cullProgramChecked) {
+			m_cullProgramChecked = true;
+			m_cullProgram = Resources().Get<Program>("Shaders/cull.prog");
+			if (m_cullProgram && !m_cullProgram->IsCompute()) m_cullProgram = nullptr;
+		}
+		bool gpuCull = m_cullProgram && m_cullProgram->m_program;
+
+		// CPU cull rewrites the mapped region, so wait until the GPU has
+		// drained it - with three regions in flight this almost never blocks.
+		// The GPU cull writes server-side and needs no client sync
+		if (!gpuCull && m_fences[m_frame]) {
+			glClientWaitSync(m_fences[m_frame], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull);
+			glDeleteSync(m_fences[m_frame]);
+			m_fences[m_frame] = nullptr;
+		}
+
+		m_drawCount = 0;
+		m_drawsCulled = 0;
+
+		if (gpuCull) {
+			// one dispatch per batch tests every draw's bounds against the
+			// frustum and writes instanceCount into this frame's command
+			// region in place (bounds on binding 0, commands on binding 1,
+			// u_base indexes the region) - per-object work never touches the
+			// CPU, so the culled counter reads zero on this path
+			m_cullProgram->Use();
+			for (int i = 0; i < 6; i++) {
+				m_cullProgram->SetUniform(std::format("u_frustum[{}]", i), frustum.planes[i]);
+			}
+
+			for (auto& batch : m_batches) {
+				m_cullProgram->SetUniform("u_drawCount", (int)batch.draws.size());
+				m_cullProgram->SetUniform("u_base", (int)(m_frame * batch.draws.size()));
+
+				batch.boundsBuffer.Bind();
+				glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, batch.commandBuffer);
+				m_cullProgram->Dispatch((int)batch.draws.size());
+			}
+
+			// the compacted commands must land before the indirect draws
+			// below read them
+			Program::BarrierIndirect();
+		}
+
+		for (auto& batch : m_batches) {
+			size_t base = (size_t)m_frame * batch.draws.size();
+			uint32_t triangles = 0;
+
+			if (!gpuCull) {
+				// per-draw frustum cull straight into the mapped commands -
+				// culled draws keep their slot with instanceCount zero, so the
+				// submit stays one call regardless of visibility
+				for (size_t i = 0; i < batch.draws.size(); i++) {
+					const Draw& draw = batch.draws[i];
+					bool visible = frustum.Intersects(draw.bounds);
+					batch.commands[base + i] = { draw.indexCount, visible ? 1u : 0u, draw.firstIndex, draw.baseVertex, draw.baseInstance };
+					if (visible) triangles += draw.indexCount / 3;
+					else m_drawsCulled++;
+				}
+			}
+			else {
+				// the compute pass writes the commands, so the exact survivor
+				// count isn't known here - report the pre-cull total
+				for (auto& draw : batch.draws) triangles += draw.indexCount / 3;
+			}
+			m_drawCount += batch.draws.size();
+
+			GLDebug::Scope group(batch.material->name.c_str());
+
+			batch.material->Bind();
+
+			// republish this batch's masks - shaders declaring the block
+			// index it by gl_DrawID, others never touch the binding
+			if (batch.lightMaskBuffer.IsCreated()) batch.lightMaskBuffer.Bind();
+
+			GLState::BindVertexArray(batch.vao);
+			glBindBuffer(GL_DRAW_INDIRECT_BUFFER, batch.commandBuffer);
+			glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, (const void*)(base * sizeof(IndirectCommand)), (GLsizei)batch.draws.size(), 0);
+			FrameStats::AddDraw(triangles);
+		}
+
+		if (!gpuCull) m_fences[m_frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		m_frame = (m_frame + 1) % kFrameCount;
+	}
+
+	void StaticBatcher::Clear() {
+		for (auto& batch : m_batches) DestroyBatch(batch);
+		m_batches.clear();
+
+		for (auto& fence : m_fences) {
+			if (fence) {
+				glDeleteSync(fence);
+				fence = nullptr;
+			}
+		}
+		m_frame = 0;
+		m_drawCount = 0;
+		m_drawsCulled = 0;
+	}
+
+	void StaticBatcher::DestroyBatch(Batch& batch) {
+		if (batch.commands) {
+			glBindBuffer(GL_DRAW_INDIRECT_BUFFER, batch.commandBuffer);
+			glUnmapBuffer(GL_DRAW_INDIRECT_BUFFER);
+		}
+		if (batch.commandBuffer) glDeleteBuffers(1, &batch.commandBuffer);
+		if (batch.matrixVbo) glDeleteBuffers(1, &batch.matrixVbo);
+		if (batch.ibo) glDeleteBuffers(1, &batch.ibo);
+		if (batch.vbo) glDeleteBuffers(1, &batch.vbo);
+		if (batch.vao) {
+			GLState::InvalidateVertexArray(batch.vao);
+			glDeleteVertexArrays(1, &batch.vao);
+		}
+	}
+}
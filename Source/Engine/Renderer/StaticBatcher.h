@@ -0,0 +1,112 @@
+#pragma once
+#include "Resources/Resource.h"
+#include "StorageBuffer.h"
+#include "Math/Bounds.h"
+#include "Math/Frustum.h"
+#include <glad/glad.h>
+#include <vector>
+
+namespace neu {
+	class Scene;
+	class Material;
+	class Program;
+	class LightComponent;
+
+	// merges the geometry of static (non-moving) ModelRenderers that share a
+	// material into one vertex/index buffer pair per material at scene load,
+	// and submits each batch with a single glMultiDrawElementsIndirect call.
+	//
+	// per-mesh world matrices ride the instance matrix attribute stream
+	// (baseInstance selects the row, so materials need the same instancing-
+	// capable program the instanced path uses). indirect commands live in a
+	// persistently-mapped ring so per-draw frustum culling just rewrites
+	// instanceCount each frame without a buffer upload or driver sync.
+	//
+	// when the culling compute program ("Shaders/cull.prog") is available
+	// the per-draw frustum tests move to the GPU: draw bounds live in an
+	// SSBO and a dispatch per batch writes each command's instanceCount in
+	// place, so the CPU cost per frame is a fixed handful of dispatches and
+	// one indirect submit per material regardless of draw count. Without
+	// the asset the CPU cull below runs unchanged
+	class StaticBatcher {
+	public:
+		StaticBatcher() = default;
+		~StaticBatcher() { Clear(); }
+
+		// gathers active static ModelRenderers and builds one merged batch
+		// per material; geometry is copied GPU-side from the source models
+		void Build(Scene& scene);
+
+		// culls each merged draw against the frustum and submits one
+		// indirect call per material
+		void Draw(const Frustum& frustum);
+
+		// re-tests every merged draw's bounds against each light's reach
+		// and uploads the resulting bit masks as an immutable SSBO on
+		// Program::staticLightMaskBinding, one uint per draw indexed by
+		// gl_DrawID. Called by Scene when the light set or the batch build
+		// changes - in static lighting setups that's once at load
+		void BakeLightMasks(const std::vector<LightComponent*>& lights);
+
+		// releases every batch's GL objects
+		void Clear();
+
+		// editor stats, counted during the last Draw
+		size_t GetBatchCount() const { return m_batches.size(); }
+		size_t GetDrawCount() const { return m_drawCount; }
+		size_t GetDrawsCulled() const { return m_drawsCulled; }
+
+	private:
+		// matches the GL DrawElementsIndirectCommand layout
+		struct IndirectCommand {
+			GLuint count;
+			GLuint instanceCount;
+			GLuint firstIndex;
+			GLint baseVertex;
+			GLuint baseInstance;
+		};
+
+		// one merged mesh inside a batch - offsets into the shared buffers
+		// plus the world bounds used for per-draw culling
+		struct Draw {
+			Bounds bounds;
+			GLuint indexCount;
+			GLuint firstIndex;
+			GLint baseVertex;
+			GLuint baseInstance;
+		};
+
+		// all static geometry sharing one material
+		struct Batch {
+			res_t<Material> material;
+			GLuint vao{ 0 };
+			GLuint vbo{ 0 };
+			GLuint ibo{ 0 };
+			GLuint matrixVbo{ 0 };
+			GLuint commandBuffer{ 0 };
+			StorageBuffer boundsBuffer;				// per-draw world AABBs for the GPU cull
+			StorageBuffer lightMaskBuffer;			// per-draw light masks, see BakeLightMasks
+			IndirectCommand* commands{ nullptr };	// persistent map, kFrameCount regions
+			std::vector<Draw> draws;
+		};
+
+		void DestroyBatch(Batch& batch);
+
+	private:
+		// command regions cycled per frame so the CPU never rewrites
+		// commands the GPU may still be reading
+		static constexpr int kFrameCount = 3;
+
+		// compute program for the GPU cull, fetched once on first Draw -
+		// null (missing asset or no compute support) keeps the CPU cull
+		res_t<Program> m_cullProgram;
+		bool m_cullProgramChecked{ false };
+
+		std::vector<Batch> m_batches;
+		GLsync m_fences[kFrameCount]{};
+		int m_frame{ 0 };
+
+		size_t m_drawCount{ 0 };
+		size_t m_drawsCulled{ 0 };
+	};
+}
@@ -0,0 +1,127 @@
+#include "EnginePCH.h"
+#include "StorageBuffer.h"
+
+namespace neu {
+
+	StorageBuffer::~StorageBuffer()
+	{
+		Release();
+	}
+
+	StorageBuffer::StorageBuffer(StorageBuffer&& other) noexcept
+	{
+		*this = std::move(other);
+	}
+
+	StorageBuffer& StorageBuffer::operator=(StorageBuffer&& other) noexcept
+	{
+		if (this == &other) return *this;
+		Release();
+
+		m_ssbo = std::exchange(other.m_ssbo, 0);
+		m_binding = other.m_binding;
+		m_size = other.m_size;
+		m_alignedSize = other.m_alignedSize;
+		m_map = std::exchange(other.m_map, nullptr);
+		m_region = other.m_region;
+		for (int i = 0; i < kRegions; i++) m_fences[i] = std::exchange(other.m_fences[i], nullptr);
+
+		return *this;
+	}
+
+	void StorageBuffer::Create(GLsizeiptr size, GLuint binding)
+	{
+		m_size = size;
+		m_binding = binding;
+
+		// region offsets passed to glBindBufferRange must honor the
+		// implementation's SSBO offset alignment
+		GLint alignment = 256;
+		glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+		m_alignedSize = (size + alignment - 1) / alignment * alignment;
+
+		glGenBuffers(1, &m_ssbo);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_ssbo);
+
+		// immutable persistent storage, mapped once for the buffer's lifetime
+		GLbitfield mapFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glBufferStorage(GL_SHADER_STORAGE_BUFFER, kRegions * m_alignedSize, nullptr, mapFlags);
+		m_map = (uint8_t*)glMapBufferRange(GL_SHADER_STORAGE_BUFFER, 0, kRegions * m_alignedSize, mapFlags);
+		GPUMemory::Track(GPUMemory::Type::Buffer, kRegions * m_alignedSize);
+
+		glBindBufferRange(GL_SHADER_STORAGE_BUFFER, binding, m_ssbo, 0, size);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+	}
+
+	void StorageBuffer::CreateStatic(const void* data, GLsizeiptr size, GLuint binding)
+	{
+		m_size = size;
+		m_alignedSize = size;
+		m_binding = binding;
+
+		// device-local immutable contents - no mapping, uploaded here once
+		glGenBuffers(1, &m_ssbo);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_ssbo);
+		glBufferStorage(GL_SHADER_STORAGE_BUFFER, size, data, 0);
+		GPUMemory::Track(GPUMemory::Type::Buffer, size);
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, m_ssbo);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+	}
+
+	void StorageBuffer::Upload(const void* data, GLsizeiptr size, GLintptr offset)
+	{
+		// fence the region the dispatches/draws issued since the previous
+		// upload read from, then advance - the wait only fires if the GPU
+		// has fallen more than kRegions uploads behind
+		if (m_fences[m_region]) glDeleteSync(m_fences[m_region]);
+		m_fences[m_region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+		m_region = (m_region + 1) % kRegions;
+		if (m_fences[m_region]) {
+			glClientWaitSync(m_fences[m_region], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull);
+			glDeleteSync(m_fences[m_region]);
+			m_fences[m_region] = nullptr;
+		}
+
+		// coherent mapping - the write is visible to the GPU without an
+		// explicit flush, and rebinding the range publishes this region
+		GLsizeiptr regionBase = m_region * m_alignedSize;
+		std::memcpy(m_map + regionBase + offset, data, size);
+		glBindBufferRange(GL_SHADER_STORAGE_BUFFER, m_binding, m_ssbo, regionBase, m_size);
+		FrameStats::AddUpload(size);
+	}
+
+	void StorageBuffer::Bind()
+	{
+		if (!m_ssbo) return;
+
+		if (m_map) {
+			glBindBufferRange(GL_SHADER_STORAGE_BUFFER, m_binding, m_ssbo, m_region * m_alignedSize, m_size);
+		}
+		else {
+			glBindBufferBase(GL_SHADER_STORAGE_BUFFER, m_binding, m_ssbo);
+		}
+	}
+
+	void StorageBuffer::Release()
+	{
+		for (auto& fence : m_fences) {
+			if (fence) {
+				glDeleteSync(fence);
+				fence = nullptr;
+			}
+		}
+		if (m_ssbo) {
+			// mapped stores hold kRegions regions, static stores just one
+			GPUMemory::Untrack(GPUMemory::Type::Buffer, (m_map ? kRegions : 1) * m_alignedSize);
+			if (m_map) {
+				glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_ssbo);
+				glUnmapBuffer(GL_SHADER_STORAGE_BUFFER);
+				glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+				m_map = nullptr;
+			}
+			glDeleteBuffers(1, &m_ssbo);
+			m_ssbo = 0;
+		}
+	}
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstdint>
+
+namespace neu {
+	/// <summary>
+	/// Thin wrapper around an OpenGL shader storage buffer object (SSBO),
+	/// the storage side of the compute pipeline: object bounds, compacted
+	/// indirect commands, particle state. Sits alongside UniformBuffer,
+	/// which covers the small fixed-size std140 blocks.
+	///
+	/// Two update paths:
+	/// - CreateStatic uploads immutable contents once (bounds tables,
+	///   merged lookup data) - no per-frame cost beyond the bind
+	/// - Create + Upload streams through persistently-mapped fence-guarded
+	///   regions, the same ring scheme UniformBuffer uses, so per-frame
+	///   writes never stall on dispatches still reading the previous data
+	/// </summary>
+	class StorageBuffer
+	{
+	public:
+		StorageBuffer() = default;
+		~StorageBuffer();
+
+		// buffers own a GL name, so they move but don't copy
+		StorageBuffer(const StorageBuffer&) = delete;
+		StorageBuffer& operator=(const StorageBuffer&) = delete;
+		StorageBuffer(StorageBuffer&& other) noexcept;
+		StorageBuffer& operator=(StorageBuffer&& other) noexcept;
+
+		// streaming buffer: allocates the persistent-mapped ring and binds
+		// region 0 to the given storage binding point
+		void Create(GLsizeiptr size, GLuint binding);
+
+		// immutable buffer uploaded once and bound to the binding point
+		void CreateStatic(const void* data, GLsizeiptr size, GLuint binding);
+
+		// writes data into the next region and publishes it at the binding
+		// point, call once per frame/pass for streamed data
+		void Upload(const void* data, GLsizeiptr size, GLintptr offset = 0);
+
+		// republishes the buffer (current region for streamed buffers) at
+		// its binding point - needed when several buffers share a binding,
+		// e.g. per-batch bounds tables feeding one culling dispatch
+		void Bind();
+
+		bool IsCreated() const { return m_ssbo != 0; }
+
+	private:
+		void Release();
+
+		// regions cycled per upload - three keep the CPU ahead of the GPU
+		// without waiting in the steady state
+		static constexpr int kRegions = 3;
+
+		GLuint m_ssbo = 0;
+		GLuint m_binding = 0;
+		GLsizeiptr m_size = 0;
+		GLsizeiptr m_alignedSize = 0;   // m_size padded to the SSBO offset alignment
+		uint8_t* m_map = nullptr;       // persistent map, kRegions regions (streaming only)
+		int m_region = 0;
+		GLsync m_fences[kRegions]{};
+	};
+}
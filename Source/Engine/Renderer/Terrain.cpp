@@ -0,0 +1,378 @@
+#include "EnginePCH.h"
+#include "Terrain.h"
+#include "Engine.h"
+#include "Core/JobSystem.h"
+#include <bit>
+#include <thread>
+
+namespace neu {
+	namespace {
+		// every quadtree node meshes to the same grid, so descending one
+		// level doubles ground detail - 33x33 keeps a chunk at ~28 KB
+		constexpr int kChunkVerts = 33;
+
+		// built chunks uploaded per Draw - bounds the GL-thread cost of a
+		// streaming burst after a fast camera move
+		constexpr int kMaxUploadsPerDraw = 4;
+
+		// chunks untouched for this many draws release their buffers;
+		// sweeps run every kSweepInterval draws
+		constexpr uint64_t kEvictAge = 240;
+		constexpr uint64_t kSweepInterval = 64;
+
+		// geomorph starts at this fraction of the parent's split distance,
+		// reaching the parent mesh exactly where the LOD switches
+		constexpr float kMorphStart = 0.7f;
+	}
+
+	Terrain::~Terrain() {
+		if (m_heightmapRead != file::kInvalidRead) file::CancelRead(m_heightmapRead);
+
+		// builds only read the immutable heightfield, but they write into
+		// chunks this destructor frees - spin the stragglers out first
+		while (m_buildsInFlight > 0) std::this_thread::yield();
+
+		for (auto& [key, chunk] : m_chunks) {
+			if (chunk->vao) {
+				GLState::InvalidateVertexArray(chunk->vao);
+				glDeleteVertexArrays(1, &chunk->vao);
+			}
+			if (chunk->vbo) glDeleteBuffers(1, &chunk->vbo);
+		}
+		if (m_indexBuffer) glDeleteBuffers(1, &m_indexBuffer);
+		if (m_chunkBytes) GPUMemory::Untrack(GPUMemory::Type::Geometry, m_chunkBytes);
+	}
+
+	bool Terrain::Load(const std::string& filename) {
+		auto document = Resources().GetDocument(filename);
+		if (!document) {
+			LOG_CAT_WARNING(Renderer, "Could not load terrain file: {}", filename);
+			return false;
+		}
+
+		std::string heightmapName;
+		SERIAL_READ_NAME(*document, "heightmap", heightmapName);
+		SERIAL_READ_NAME(*document, "resolution", m_resolution);
+		SERIAL_READ_NAME(*document, "size", m_size);
+		SERIAL_READ_NAME(*document, "heightScale", m_heightScale);
+		SERIAL_READ_NAME(*document, "lodFactor", m_lodFactor);
+
+		std::string materialName;
+		SERIAL_READ_NAME(*document, "material", materialName);
+		if (!materialName.empty()) m_material = Resources().Get<Material>(materialName);
+
+		// the quadtree needs the heightfield to tile exactly: a leaf vertex
+		// per sample, power-of-two leaves per side
+		int leaves = (m_resolution - 1) / (kChunkVerts - 1);
+		if (m_resolution < kChunkVerts || (m_resolution - 1) % (kChunkVerts - 1) != 0 ||
+			!std::has_single_bit((unsigned)leaves)) {
+			LOG_CAT_WARNING(Renderer, "Terrain {} resolution {} must be a power-of-two multiple of {} plus one",
+				filename, m_resolution, kChunkVerts - 1);
+			return false;
+		}
+		m_maxDepth = std::countr_zero((unsigned)leaves);
+
+		// the heightfield streams in - the terrain exists immediately and
+		// starts answering queries and building chunks once the read lands
+		m_heightmapRead = file::ReadAsync(heightmapName, file::ReadPriority::Streaming,
+			[this](bool success, std::vector<uint8_t>& data) { OnHeightmapLoaded(success, data); });
+
+		return true;
+	}
+
+	void Terrain::OnHeightmapLoaded(bool success, std::vector<uint8_t>& data) {
+		m_heightmapRead = file::kInvalidRead;
+
+		size_t samples = (size_t)m_resolution * m_resolution;
+		if (!success || (data.size() != samples && data.size() != samples * 2)) {
+			LOG_CAT_WARNING(Renderer, "Terrain {} heightmap read failed or size mismatch", name);
+			return;
+		}
+
+		// normalize to [0,1] - height scale applies at sample time so the
+		// editor can tune it live without rebaking
+		m_heights.resize(samples);
+		if (data.size() == samples) {
+			for (size_t i = 0; i < samples; i++) m_heights[i] = data[i] / 255.0f;
+		}
+		else {
+			// 16-bit little-endian
+			for (size_t i = 0; i < samples; i++) {
+				m_heights[i] = (data[i * 2] | (data[i * 2 + 1] << 8)) / 65535.0f;
+			}
+		}
+
+		m_ready = true;
+	}
+
+	float Terrain::Sample(int gx, int gz) const {
+		gx = math::clamp(gx, 0, m_resolution - 1);
+		gz = math::clamp(gz, 0, m_resolution - 1);
+		return m_heights[(size_t)gz * m_resolution + gx];
+	}
+
+	bool Terrain::GetHeight(float x, float z, float& height) const {
+		if (!m_ready) return false;
+
+		float u = (x + m_size * 0.5f) / m_size * (m_resolution - 1);
+		float v = (z + m_size * 0.5f) / m_size * (m_resolution - 1);
+		if (u < 0 || v < 0 || u > m_resolution - 1 || v > m_resolution - 1) return false;
+
+		int gx = (int)u;
+		int gz = (int)v;
+		float fx = u - gx;
+		float fz = v - gz;
+
+		float h0 = glm::mix(Sample(gx, gz), Sample(gx + 1, gz), fx);
+		float h1 = glm::mix(Sample(gx, gz + 1), Sample(gx + 1, gz + 1), fx);
+		height = glm::mix(h0, h1, fz) * m_heightScale;
+		return true;
+	}
+
+	bool Terrain::GetNormal(float x, float z, glm::vec3& normal) const {
+		if (!m_ready) return false;
+
+		float u = (x + m_size * 0.5f) / m_size * (m_resolution - 1);
+		float v = (z + m_size * 0.5f) / m_size * (m_resolution - 1);
+		if (u < 0 || v < 0 || u > m_resolution - 1 || v > m_resolution - 1) return false;
+
+		int gx = (int)(u + 0.5f);
+		int gz = (int)(v + 0.5f);
+		float cell = m_size / (m_resolution - 1);
+		float dx = (Sample(gx + 1, gz) - Sample(gx - 1, gz)) * m_heightScale / (2 * cell);
+		float dz = (Sample(gx, gz + 1) - Sample(gx, gz - 1)) * m_heightScale / (2 * cell);
+		normal = glm::normalize(glm::vec3{ -dx, 1, -dz });
+		return true;
+	}
+
+	Bounds Terrain::NodeBounds(int level, int x, int z) const {
+		float nodeSize = m_size / (1 << level);
+		float x0 = -m_size * 0.5f + x * nodeSize;
+		float z0 = -m_size * 0.5f + z * nodeSize;
+
+		// pessimistic height range - built chunks carry their exact bounds
+		Bounds bounds;
+		bounds.Encapsulate(glm::vec3{ x0, 0, z0 });
+		bounds.Encapsulate(glm::vec3{ x0 + nodeSize, m_heightScale, z0 + nodeSize });
+		return bounds;
+	}
+
+	void Terrain::BuildChunk(Chunk& chunk, int level, int x, int z) const {
+		// heightfield step between adjacent vertices at this level - 1 at
+		// the leaves, doubling per level up
+		int step = (m_resolution - 1) / ((1 << level) * (kChunkVerts - 1));
+		int baseX = x * (kChunkVerts - 1) * step;
+		int baseZ = z * (kChunkVerts - 1) * step;
+		float cell = m_size / (m_resolution - 1);
+
+		Bounds bounds;
+		chunk.vertices.resize((size_t)kChunkVerts * kChunkVerts);
+		for (int j = 0; j < kChunkVerts; j++) {
+			for (int i = 0; i < kChunkVerts; i++) {
+				int gx = baseX + i * step;
+				int gz = baseZ + j * step;
+				float height = Sample(gx, gz) * m_heightScale;
+
+				// geomorph target: the height this vertex has in the
+				// parent-level mesh - odd vertices sit on a parent edge (or
+				// its triangulation diagonal) and lerp between its ends
+				float coarse = height;
+				if ((i & 1) && (j & 1)) {
+					coarse = 0.5f * (Sample(gx - step, gz - step) + Sample(gx + step, gz + step)) * m_heightScale;
+				}
+				else if (i & 1) {
+					coarse = 0.5f * (Sample(gx - step, gz) + Sample(gx + step, gz)) * m_heightScale;
+				}
+				else if (j & 1) {
+					coarse = 0.5f * (Sample(gx, gz - step) + Sample(gx, gz + step)) * m_heightScale;
+				}
+
+				float spacing = 2.0f * step * cell;
+				glm::vec3 normal = glm::normalize(glm::vec3{
+					-(Sample(gx + step, gz) - Sample(gx - step, gz)) * m_heightScale / spacing,
+					1,
+					-(Sample(gx, gz + step) - Sample(gx, gz - step)) * m_heightScale / spacing });
+
+				glm::vec3 position{ -m_size * 0.5f + gx * cell, height, -m_size * 0.5f + gz * cell };
+				bounds.Encapsulate(position);
+				chunk.vertices[(size_t)j * kChunkVerts + i] = { position, coarse - height, normal };
+			}
+		}
+		chunk.bounds = bounds;
+
+		chunk.state.store(Chunk::State::Built, std::memory_order_release);
+	}
+
+	Terrain::Chunk* Terrain::RequestChunk(int level, int x, int z) {
+		auto iter = m_chunks.find(ChunkKey(level, x, z));
+		if (iter == m_chunks.end()) {
+			iter = m_chunks.emplace(ChunkKey(level, x, z), std::make_unique<Chunk>()).first;
+		}
+
+		Chunk* chunk = iter->second.get();
+		chunk->lastUsed = m_drawStamp;
+
+		if (chunk->state.load(std::memory_order_acquire) == Chunk::State::Ready) return chunk;
+
+		// kick a background build on first touch - a pure read of the
+		// immutable heightfield, so it runs safely off-thread
+		if (chunk->state == Chunk::State::Empty) {
+			chunk->state = Chunk::State::Building;
+			m_buildsInFlight++;
+			GetEngine().GetJobSystem().Submit([this, chunk, level, x, z]() {
+				BuildChunk(*chunk, level, x, z);
+				m_buildsInFlight--;
+			}, JobPriority::Background);
+		}
+
+		return nullptr;
+	}
+
+	void Terrain::UploadBuiltChunks() {
+		// shared grid index pattern, built once
+		if (!m_indexBuffer) {
+			std::vector<uint32_t> indices;
+			indices.reserve((size_t)(kChunkVerts - 1) * (kChunkVerts - 1) * 6);
+			for (uint32_t j = 0; j < kChunkVerts - 1; j++) {
+				for (uint32_t i = 0; i < kChunkVerts - 1; i++) {
+					uint32_t corner = j * kChunkVerts + i;
+					indices.push_back(corner);
+					indices.push_back(corner + kChunkVerts);
+					indices.push_back(corner + 1);
+					indices.push_back(corner + 1);
+					indices.push_back(corner + kChunkVerts);
+					indices.push_back(corner + kChunkVerts + 1);
+				}
+			}
+			m_indexCount = (GLsizei)indices.size();
+
+			glGenBuffers(1, &m_indexBuffer);
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer);
+			glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint32_t), indices.data(), GL_STATIC_DRAW);
+		}
+
+		int uploads = 0;
+		for (auto& [key, chunk] : m_chunks) {
+			if (uploads >= kMaxUploadsPerDraw) break;
+			if (chunk->state.load(std::memory_order_acquire) != Chunk::State::Built) continue;
+
+			size_t bytes = chunk->vertices.size() * sizeof(Vertex);
+			glGenVertexArrays(1, &chunk->vao);
+			GLState::BindVertexArray(chunk->vao);
+
+			glGenBuffers(1, &chunk->vbo);
+			glBindBuffer(GL_ARRAY_BUFFER, chunk->vbo);
+			glBufferData(GL_ARRAY_BUFFER, bytes, chunk->vertices.data(), GL_STATIC_DRAW);
+
+			// position / morph delta / normal - the terrain program's own
+			// attribute contract, independent of the packed model streams
+			glEnableVertexAttribArray(0);
+			glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
+			glEnableVertexAttribArray(1);
+			glVertexAttribPointer(1, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, morphDelta));
+			glEnableVertexAttribArray(2);
+			glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, normal));
+
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer);
+
+			GPUMemory::Track(GPUMemory::Type::Geometry, bytes);
+			FrameStats::AddUpload(bytes);
+			m_chunkBytes += bytes;
+
+			// the CPU copy has served its purpose
+			chunk->vertices.clear();
+			chunk->vertices.shrink_to_fit();
+
+			chunk->state.store(Chunk::State::Ready, std::memory_order_release);
+			uploads++;
+		}
+	}
+
+	void Terrain::EvictStaleChunks() {
+		if (m_drawStamp % kSweepInterval != 0) return;
+
+		for (auto iter = m_chunks.begin(); iter != m_chunks.end(); ) {
+			Chunk* chunk = iter->second.get();
+
+			// in-flight builds keep their chunk pinned
+			auto state = chunk->state.load(std::memory_order_acquire);
+			bool stale = m_drawStamp - chunk->lastUsed > kEvictAge &&
+				state != Chunk::State::Building;
+
+			if (!stale) {
+				++iter;
+				continue;
+			}
+
+			if (chunk->vao) {
+				GLState::InvalidateVertexArray(chunk->vao);
+				glDeleteVertexArrays(1, &chunk->vao);
+			}
+			if (chunk->vbo) {
+				glDeleteBuffers(1, &chunk->vbo);
+				size_t bytes = (size_t)kChunkVerts * kChunkVerts * sizeof(Vertex);
+				GPUMemory::Untrack(GPUMemory::Type::Geometry, bytes);
+				m_chunkBytes -= bytes;
+			}
+			iter = m_chunks.erase(iter);
+		}
+	}
+
+	void Terrain::Draw(const glm::mat4& world, const Frustum& frustum, const glm::vec3& viewPosition) {
+		if (!m_ready || !m_material || !m_material->program) return;
+
+		m_drawStamp++;
+		UploadBuiltChunks();
+		EvictStaleChunks();
+
+		m_material->Bind();
+		m_material->program->SetUniform("u_model", world);
+
+		DrawNode(0, 0, 0, world, frustum, viewPosition);
+	}
+
+	void Terrain::DrawNode(int level, int x, int z, const glm::mat4& world, const Frustum& frustum, const glm::vec3& viewPosition) {
+		// cull the whole subtree on the node's pessimistic bounds
+		Bounds bounds = NodeBounds(level, x, z).Transformed(world);
+		if (!frustum.Intersects(bounds)) return;
+
+		float nodeSize = m_size / (1 << level);
+		glm::vec3 closest = glm::clamp(viewPosition, bounds.min, bounds.max);
+		float distance = glm::length(viewPosition - closest);
+
+		// split while the camera is inside the node's LOD range, but only
+		// once all four children are resident - until then the node keeps
+		// drawing itself so streaming never opens holes
+		if (level < m_maxDepth && distance < nodeSize * m_lodFactor) {
+			Chunk* children[4] = {
+				RequestChunk(level + 1, x * 2,     z * 2),
+				RequestChunk(level + 1, x * 2 + 1, z * 2),
+				RequestChunk(level + 1, x * 2,     z * 2 + 1),
+				RequestChunk(level + 1, x * 2 + 1, z * 2 + 1),
+			};
+			if (children[0] && children[1] && children[2] && children[3]) {
+				DrawNode(level + 1, x * 2,     z * 2,     world, frustum, viewPosition);
+				DrawNode(level + 1, x * 2 + 1, z * 2,     world, frustum, viewPosition);
+				DrawNode(level + 1, x * 2,     z * 2 + 1, world, frustum, viewPosition);
+				DrawNode(level + 1, x * 2 + 1, z * 2 + 1, world, frustum, viewPosition);
+				return;
+			}
+		}
+
+		Chunk* chunk = RequestChunk(level, x, z);
+		if (!chunk) return;
+
+		// geomorph toward the parent mesh over the outer stretch of the
+		// parent's split range, hitting it exactly where the LOD switches
+		float morph = 0;
+		if (level > 0) {
+			float range = nodeSize * 2 * m_lodFactor;
+			morph = math::clamp((distance / range - kMorphStart) / (1 - kMorphStart), 0.0f, 1.0f);
+		}
+		m_material->program->SetUniform("u_morph", morph);
+
+		GLState::BindVertexArray(chunk->vao);
+		glDrawElements(GL_TRIANGLES, m_indexCount, GL_UNSIGNED_INT, 0);
+		FrameStats::AddDraw((uint32_t)(m_indexCount / 3));
+	}
+}
@@ -0,0 +1,147 @@
+#pragma once
+#include "Resources/Resource.h"
+#include "Core/File.h"
+#include "Math/Bounds.h"
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace neu {
+	class Frustum;
+	class Material;
+
+	/// <summary>
+	/// Heightmap terrain resource: quadtree chunked LOD with geomorphing,
+	/// camera-keyed chunk streaming, and heightfield collision queries.
+	///
+	/// A .terrain document names the heightmap (raw 8- or 16-bit grid),
+	/// its resolution, the world size/height scale and the splat material.
+	/// The heightfield streams in through the async read path and stays
+	/// resident as the collision source of truth - GetHeight/GetNormal
+	/// answer from bilinear heightfield samples, never mesh triangles.
+	///
+	/// Rendering walks a quadtree each pass: every node meshes to the same
+	/// fixed vertex grid, so descending a level doubles ground detail.
+	/// Nodes split while the camera is inside their LOD range and their
+	/// children's meshes are resident; otherwise the node draws itself and
+	/// requests the children, so motion streams detail in without holes.
+	/// Chunk meshes build on background jobs (pure reads of the immutable
+	/// heightfield), upload on the GL thread under a per-frame budget, and
+	/// evict once no pass has touched them for a while - chunk residency
+	/// follows the camera. Each vertex carries the height delta to its
+	/// parent-level mesh; the node's u_morph blends it in near the split
+	/// distance so LOD transitions slide instead of pop.
+	///
+	/// Splatting is the material's concern: the terrain binds its one
+	/// material and the program blends detail layers by the control map's
+	/// weights - no engine-side texture plumbing beyond Material.
+	/// </summary>
+	class Terrain : public Resource {
+	public:
+		Terrain() = default;
+		~Terrain();
+
+		bool Load(const std::string& filename);
+
+		/// <summary>
+		/// Selects this pass's quadtree node set against the camera and
+		/// draws the resident chunks, requesting any missing ones.
+		/// </summary>
+		/// <param name="world">Owner's world matrix</param>
+		/// <param name="frustum">Pass frustum, culls whole subtrees</param>
+		/// <param name="viewPosition">World camera position driving LOD</param>
+		void Draw(const glm::mat4& world, const Frustum& frustum, const glm::vec3& viewPosition);
+
+		/// <summary>
+		/// Bilinear heightfield sample in terrain-local space (x/z over
+		/// [-size/2, size/2]). False until the heightfield has streamed in
+		/// or outside the terrain.
+		/// </summary>
+		bool GetHeight(float x, float z, float& height) const;
+
+		/// <summary>
+		/// Heightfield normal by central differences, terrain-local space.
+		/// </summary>
+		bool GetNormal(float x, float z, glm::vec3& normal) const;
+
+		bool IsReady() const { return m_ready; }
+		float GetSize() const { return m_size; }
+		float GetHeightScale() const { return m_heightScale; }
+		const res_t<Material>& GetMaterial() const { return m_material; }
+
+		// resident chunk stats for the editor panel
+		size_t GetChunkCount() const { return m_chunks.size(); }
+		size_t GetChunkBytes() const { return m_chunkBytes; }
+
+		size_t GetMemorySize() const override { return m_heights.size() * sizeof(float) + m_chunkBytes; }
+
+	private:
+		// vertex layout shared by every chunk - local position, the height
+		// delta to the parent-level mesh (geomorph target) and the
+		// heightfield normal
+		struct Vertex {
+			glm::vec3 position;
+			float morphDelta;
+			glm::vec3 normal;
+		};
+
+		// one quadtree node's mesh. Empty -> Building (job owns vertices)
+		// -> Built (waiting for the GL thread) -> Ready (resident)
+		struct Chunk {
+			enum class State : uint8_t { Empty, Building, Built, Ready };
+
+			std::atomic<State> state{ State::Empty };
+			std::vector<Vertex> vertices;
+			Bounds bounds;			// local-space, valid from Built on
+			GLuint vao{ 0 };
+			GLuint vbo{ 0 };
+			uint64_t lastUsed{ 0 };
+		};
+
+		// quadtree node key: level plus grid coords within the level
+		static uint64_t ChunkKey(int level, int x, int z) {
+			return ((uint64_t)level << 48) | ((uint64_t)(uint32_t)x << 24) | (uint32_t)z;
+		}
+
+		void OnHeightmapLoaded(bool success, std::vector<uint8_t>& data);
+
+		// normalized heightfield sample, clamped to the grid edge
+		float Sample(int gx, int gz) const;
+
+		// resident chunk for the node, kicking a background build on a
+		// miss - null until the mesh is Ready
+		Chunk* RequestChunk(int level, int x, int z);
+		void BuildChunk(Chunk& chunk, int level, int x, int z) const;
+		void UploadBuiltChunks();
+		void EvictStaleChunks();
+
+		// recursive selection: split while the camera is inside the node's
+		// LOD range and the children are resident, else draw this node
+		void DrawNode(int level, int x, int z, const glm::mat4& world, const Frustum& frustum, const glm::vec3& viewPosition);
+
+		// pessimistic local bounds for a node whose mesh hasn't built yet
+		Bounds NodeBounds(int level, int x, int z) const;
+
+		float m_size{ 1000 };		// world meters per side, centered on the owner
+		float m_heightScale{ 100 };
+		float m_lodFactor{ 2.5f };	// split while closer than node size * factor
+		int m_resolution{ 0 };		// heightfield samples per side
+		int m_maxDepth{ 0 };		// leaf level, one heightfield sample per vertex
+
+		std::vector<float> m_heights;	// normalized [0,1], resident for collision
+		std::atomic<bool> m_ready{ false };
+		file::ReadHandle m_heightmapRead{ file::kInvalidRead };
+
+		res_t<Material> m_material;
+
+		std::unordered_map<uint64_t, std::unique_ptr<Chunk>> m_chunks;
+		std::atomic<int> m_buildsInFlight{ 0 };
+		size_t m_chunkBytes{ 0 };
+		GLuint m_indexBuffer{ 0 };	// one grid index pattern shared by every chunk
+		GLsizei m_indexCount{ 0 };
+		uint64_t m_drawStamp{ 0 };	// ages chunk residency, bumped per Draw
+	};
+}
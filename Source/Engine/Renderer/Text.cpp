@@ -0,0 +1,107 @@
+#include "EnginePCH.h"
+#include "Text.h"
+
+namespace neu {
+
+	Text::~Text()
+	{
+		if (m_vao) {
+			GLState::InvalidateVertexArray(m_vao);
+			glDeleteVertexArrays(1, &m_vao);
+		}
+	}
+
+	void Text::SetFont(const res_t<Font>& font)
+	{
+		if (font.get() == m_font.get()) return;
+
+		m_font = font;
+		m_dirty = true;
+	}
+
+	void Text::SetText(const std::string& text)
+	{
+		if (text == m_text) return;
+
+		m_text = text;
+		m_dirty = true;
+	}
+
+	void Text::Rebuild()
+	{
+		m_dirty = false;
+
+		// lay the pen across the string, emitting one quad per visible
+		// glyph - blanks only advance, newlines drop a line
+		m_quads.clear();
+		glm::vec2 pen{ 0 };
+		for (char ch : m_text) {
+			if (ch == '\n') {
+				pen.x = 0;
+				pen.y += m_font->GetLineHeight();
+				continue;
+			}
+
+			auto glyph = m_font->GetGlyph(ch);
+			if (!glyph) continue;
+
+			if (glyph->size.x > 0) {
+				m_quads.push_back(GlyphQuad{
+					glm::vec4{ pen + glyph->offset, glyph->size },
+					glyph->uvRect
+				});
+			}
+			pen.x += glyph->advance;
+		}
+		if (m_quads.empty()) return;
+
+		if (m_quads.size() > m_capacity) {
+			m_capacity = math::max<size_t>(m_capacity * 2, 32);
+			while (m_capacity < m_quads.size()) m_capacity *= 2;
+			m_buffer = StorageBuffer{};
+			m_buffer.Create(m_capacity * sizeof(GlyphQuad), 0);
+		}
+		m_buffer.Upload(m_quads.data(), m_quads.size() * sizeof(GlyphQuad));
+	}
+
+	void Text::Draw(Renderer& renderer)
+	{
+		if (!m_font) return;
+
+		if (!s_programChecked) {
+			s_programChecked = true;
+			s_program = Resources().Get<Program>("Shaders/text.prog");
+		}
+		if (!s_program || !s_program->m_program) return;
+
+		if (m_dirty) Rebuild();
+		if (m_quads.empty()) return;
+
+		// attribute-less draw - the vertex shader pulls the glyph quad at
+		// gl_InstanceID from the stream and maps pixels to clip space
+		if (!m_vao) glGenVertexArrays(1, &m_vao);
+
+		s_program->Use();
+		s_program->SetUniform("u_screenSize", glm::vec2{ (float)renderer.GetWidth(), (float)renderer.GetHeight() });
+		s_program->SetUniform("u_position", m_position);
+		s_program->SetUniform("u_scale", m_scale);
+		s_program->SetUniform("u_color", m_color);
+		s_program->SetUniform("u_texture", 0);
+
+		m_font->SetActive(GL_TEXTURE0);
+		m_font->BindAtlas();
+		m_buffer.Bind();
+
+		// glyph coverage blends over whatever is on screen, depth untouched
+		GLState::SetBlend(true);
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		GLState::SetDepthMask(false);
+
+		GLState::BindVertexArray(m_vao);
+		glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, (GLsizei)m_quads.size());
+		FrameStats::AddDraw(2 * (uint32_t)m_quads.size());
+
+		GLState::SetDepthMask(true);
+		GLState::SetBlend(false);
+	}
+}
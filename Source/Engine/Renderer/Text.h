@@ -0,0 +1,73 @@
+#pragma once
+#include "Font.h"
+#include "StorageBuffer.h"
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <string>
+#include <vector>
+
+namespace neu {
+	class Renderer;
+	class Program;
+
+	// one on-screen string rendered from a Font's baked glyph atlas.
+	//
+	// layout runs only when the string changes: the glyph quads rebuild and
+	// stream through the persistent-mapped ring, so a score counter that
+	// updates every frame costs a small buffer write - no TTF surface, no
+	// texture upload. Draw is one instanced call pulling the quads from the
+	// stream (SSBO binding 0) with the shared text program
+	// ("Shaders/text.prog" - text doesn't render without it), positioned in
+	// screen pixels with the top-left of the string at the set position.
+	class Text {
+	public:
+		Text() = default;
+		explicit Text(const res_t<Font>& font) : m_font{ font } {}
+		~Text();
+
+		Text(const Text&) = delete;
+		Text& operator=(const Text&) = delete;
+
+		void SetFont(const res_t<Font>& font);
+		void SetText(const std::string& text);
+
+		// placement - position is the string's top-left in screen pixels
+		void SetPosition(const glm::vec2& position) { m_position = position; }
+		void SetScale(float scale) { m_scale = scale; }
+		void SetColor(const glm::vec4& color) { m_color = color; }
+
+		// laid-out pixel size of the current string (before scale)
+		glm::vec2 GetSize() const { return m_font ? m_font->MeasureText(m_text) : glm::vec2{ 0 }; }
+
+		// submits the string as one instanced draw over the glyph quads
+		void Draw(Renderer& renderer);
+
+	private:
+		// relayout the glyph quads and stream them - runs on text changes only
+		void Rebuild();
+
+		// matches the std430 layout the text vertex shader reads
+		struct GlyphQuad {
+			glm::vec4 rect;		// x, y, w, h in pixels relative to the string origin
+			glm::vec4 uvRect;	// atlas region (u, v, w, h)
+		};
+
+		res_t<Font> m_font;
+		std::string m_text;
+		glm::vec2 m_position{ 0 };
+		float m_scale{ 1 };
+		glm::vec4 m_color{ 1 };
+
+		std::vector<GlyphQuad> m_quads;
+		bool m_dirty{ false };
+
+		// quad stream on the persistent-mapped ring, grown on demand
+		StorageBuffer m_buffer;
+		size_t m_capacity{ 0 };
+		GLuint m_vao{ 0 };
+
+		// program shared by every text draw, fetched once
+		inline static res_t<Program> s_program;
+		inline static bool s_programChecked{ false };
+	};
+}
@@ -1,48 +1,331 @@
 #include "Texture.h"
 #include "Renderer.h"
+#include "TextureStreamer.h"
+#include "BindlessTexture.h"
+#include "Resources/ContentBudgets.h"
+
+// S3TC formats come from an extension, so older glad headers may not
+// define them - the values are fixed by the spec
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
 
 namespace neu {
+    namespace {
+        // cooked block-compressed texture container: header followed by the
+        // mip chain, largest mip first, each prefixed with its byte size
+        constexpr uint32_t kCookedMagic = 0x5845544e;   // "NTEX"
+        constexpr uint32_t kCookedVersion = 1;
+
+        struct CookedHeader {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t format;    // Texture::Format
+            uint32_t width;     // mip 0 dimensions
+            uint32_t height;
+            uint32_t mipCount;
+        };
+
+        // maps the on-disk format enum to the GL internal format
+        GLenum GetInternalFormat(Texture::Format format) {
+            switch (format) {
+            case Texture::Format::BC1: return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+            case Texture::Format::BC3: return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+            case Texture::Format::BC5: return GL_COMPRESSED_RG_RGTC2;
+            case Texture::Format::BC7: return GL_COMPRESSED_RGBA_BPTC_UNORM;
+            }
+            return 0;
+        }
+
+        // pixel-unpack PBO ring for uncompressed uploads. Pixels are copied
+        // into a mapped PBO and glTexImage2D reads from the bound buffer, so
+        // the driver DMAs from already-resident memory instead of blocking
+        // on the client pointer. Each slot is orphaned before mapping, so a
+        // small ring is enough to keep back-to-back uploads from renaming
+        // against each other. Buffers live for the life of the GL context.
+        constexpr int kUnpackRingSize = 3;
+        GLuint unpackRing[kUnpackRingSize]{};
+        size_t unpackCapacity[kUnpackRingSize]{};
+        int unpackCursor = 0;
+
+        // stages pixels into the next ring slot and leaves it bound as the
+        // GL_PIXEL_UNPACK_BUFFER source; the caller uploads with a null
+        // pointer offset, then unbinds
+        bool StageUnpack(const void* pixels, size_t size) {
+            if (!unpackRing[0]) glGenBuffers(kUnpackRingSize, unpackRing);
+
+            int slot = unpackCursor;
+            unpackCursor = (unpackCursor + 1) % kUnpackRingSize;
+
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, unpackRing[slot]);
+
+            // orphan (or grow) the slot so the map never waits on a previous
+            // upload still in flight
+            if (unpackCapacity[slot] < size) unpackCapacity[slot] = size;
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, unpackCapacity[slot], nullptr, GL_STREAM_DRAW);
+
+            void* mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+            if (!mapped) {
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+                return false;
+            }
+
+            std::memcpy(mapped, pixels, size);
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+            return true;
+        }
+
+        // worker-decoded images waiting for their main-thread upload, keyed
+        // by filename. Workers fill it from Texture::Prefetch, Load() drains
+        // it - both sides under the mutex
+        std::mutex decodeMutex;
+        std::unordered_map<std::string, Texture::DecodedImage> decodedImages;
+    }
     /// <summary>
     /// Destructor ensures proper cleanup of SDL resources.
     /// Destroys the SDL texture if it exists, freeing GPU memory.
     /// </summary>
     Texture::~Texture() {
-		if (m_texture) glDeleteTextures(1, &m_texture);
+        if (m_gpuBytes) GPUMemory::Untrack(m_gpuType, m_gpuBytes);
+        if (IsStreaming()) TextureStreamer::Instance().Unregister(this);
+        if (m_bindlessHandle) bindless::ReleaseHandle(m_bindlessHandle);
+        if (m_texture) {
+            GLState::InvalidateTexture(m_texture);
+            glDeleteTextures(1, &m_texture);
+        }
+    }
+
+    GLuint64 Texture::GetBindlessHandle() {
+        if (m_bindlessHandle) return m_bindlessHandle;
+
+        // never hand out a handle for a streaming texture - StreamMipOut
+        // rebuilds the GL object, which would leave the handle dangling
+        if (IsStreaming() || !bindless::IsSupported()) return 0;
+
+        // taking the handle freezes the texture's sampler state, which is
+        // fine here - parameters are set once at load and never change
+        m_bindlessHandle = bindless::AcquireHandle(m_texture);
+        return m_bindlessHandle;
     }
 
     /// <summary>
-    /// Loads an image file from disk and creates an SDL texture for rendering.
-    /// The loading process involves two steps:
-    /// 1. Load the image into a CPU-side surface using SDL_image
-    /// 2. Create a GPU-side texture from the surface for efficient rendering
-    /// The surface is freed after texture creation to conserve memory.
+    /// Loads an image file from disk and creates a GL texture for rendering.
+    /// The decode and the upload are split: Decode() produces CPU pixels
+    /// (and may already have run on a worker thread via Prefetch), Upload()
+    /// stages them through the PBO ring and creates the GL object. The
+    /// main thread only ever pays for the upload on the async path.
     /// </summary>
     /// <param name="filename">Path to the image file to load</param>
-    /// <param name="renderer">Reference to the Renderer that provides the SDL_Renderer context</param>
     /// <returns>True if the texture was successfully loaded and created; otherwise, false</returns>
     bool Texture::Load(const std::string& filename) {
+        // cooked container carries a compressed mip chain, everything else
+        // goes through the uncompressed SDL_image development path
+        if (equalsIgnoreCase(file::GetExtension(filename), ".ntex")) {
+            return LoadCooked(filename);
+        }
+
+        // a worker may have decoded this file already - otherwise decode
+        // here (synchronous Get() calls still work, they just pay for it)
+        DecodedImage image;
+        if (!TakeDecoded(filename, image) && !Decode(filename, image)) {
+            LOG_CAT_ERROR(Renderer, "Could not load image: {}", filename);
+            return false;
+        }
+
+        // this path uploads the source raw - the budget gate catches the
+        // oversized uncompressed texture before it reaches the GPU
+        if (!ContentBudgets::CheckTexture(filename, image.size.x, image.size.y, false)) return false;
+
+        if (!Upload(image)) return false;
+
+        GLDebug::Label(GL_TEXTURE, m_texture, filename);
+        return true;
+    }
+
+    /// <summary>
+    /// Hot reload: releases the GL-side state exactly as the destructor
+    /// would, resets the load-time bookkeeping and runs a fresh Load. The
+    /// Texture object itself survives, so existing references pick up the
+    /// new GL name on their next Bind.
+    /// </summary>
+    /// <param name="filename">The source file to reload from</param>
+    /// <returns>True if the texture reloaded; otherwise, false</returns>
+    bool Texture::Reload(const std::string& filename) {
+        if (m_gpuBytes) {
+            GPUMemory::Untrack(m_gpuType, m_gpuBytes);
+            m_gpuBytes = 0;
+        }
+        if (IsStreaming()) TextureStreamer::Instance().Unregister(this);
+        if (m_bindlessHandle) {
+            bindless::ReleaseHandle(m_bindlessHandle);
+            m_bindlessHandle = 0;
+        }
+        if (m_texture) {
+            GLState::InvalidateTexture(m_texture);
+            glDeleteTextures(1, &m_texture);
+            m_texture = 0;
+        }
+
+        m_size = { 0, 0 };
+        m_mipCount = 1;
+        m_mipRegions.clear();
+        m_cookedFilename.clear();
+        m_internalFormat = 0;
+        m_streamFirstLevel = 0;
+        m_streamMaxFirstLevel = 0;
+        m_streamInFlight = false;
+        m_residentBytes = 0;
+
+        return Load(filename);
+    }
+
+    /// <summary>
+    /// Decodes an image file into tightly packed CPU pixels. SDL_image
+    /// decoding touches no GL state, so this is the part of the load that
+    /// moves to worker threads. Rows are flipped to GL's bottom-up
+    /// convention and repacked without the surface pitch padding.
+    /// </summary>
+    /// <param name="filename">Path to the image file</param>
+    /// <param name="image">Receives the decoded pixels and layout</param>
+    /// <returns>True if the image was decoded; otherwise, false</returns>
+    bool Texture::Decode(const std::string& filename, DecodedImage& image) {
         // Load image onto a CPU-side surface
         // SDL_image supports various formats: PNG, JPG, BMP, GIF, etc.
         SDL_Surface* surface = IMG_Load(filename.c_str());
-        if (!surface) {
-            LOG_ERROR("Could not load image: {}", filename);
-            return false;
-        }
+        if (!surface) return false;
+
         SDL_FlipSurface(surface, SDL_FLIP_VERTICAL);
 
         const SDL_PixelFormatDetails* details = SDL_GetPixelFormatDetails(surface->format);
 
-        int channels = details->bytes_per_pixel;
-        GLenum internalFormat = (channels == 4) ? GL_RGBA8 : GL_RGB8;
-        GLenum format = (channels == 4) ? GL_RGBA : GL_RGB;
+        image.channels = details->bytes_per_pixel;
+        image.size = { surface->w, surface->h };
+
+        // repack row by row - the surface pitch may carry alignment padding
+        // that the tightly packed upload path doesn't want
+        size_t rowBytes = (size_t)surface->w * image.channels;
+        image.pixels.resize(rowBytes * surface->h);
+        const uint8_t* source = (const uint8_t*)surface->pixels;
+        for (int row = 0; row < surface->h; row++) {
+            std::memcpy(image.pixels.data() + row * rowBytes, source + row * surface->pitch, rowBytes);
+        }
+
+        SDL_DestroySurface(surface);
+        return true;
+    }
+
+    /// <summary>
+    /// Worker-side async hook: decodes the image into the stash that Load()
+    /// drains on the main thread. Cooked textures have no decode step, so
+    /// they fall back to warming the OS file cache like any other resource.
+    /// </summary>
+    /// <param name="filename">Path to the image file</param>
+    void Texture::Prefetch(const std::string& filename) {
+        if (equalsIgnoreCase(file::GetExtension(filename), ".ntex")) {
+            std::vector<uint8_t> data;
+            file::ReadBinaryFile(filename, data);
+            return;
+        }
+
+        // another composite's prefetch may have decoded this file already
+        // (two materials sharing a map) - the stashed decode serves both
+        {
+            std::lock_guard lock(decodeMutex);
+            if (decodedImages.contains(filename)) return;
+        }
+
+        DecodedImage image;
+        if (!Decode(filename, image)) return;
+
+        std::lock_guard lock(decodeMutex);
+        decodedImages[filename] = std::move(image);
+    }
+
+    /// <summary>
+    /// Claims a worker-decoded image for this filename, removing it from
+    /// the stash.
+    /// </summary>
+    /// <param name="filename">Path the image was prefetched under</param>
+    /// <param name="image">Receives the decoded image on a hit</param>
+    /// <returns>True if a prefetched decode was claimed; otherwise, false</returns>
+    bool Texture::TakeDecoded(const std::string& filename, DecodedImage& image) {
+        std::lock_guard lock(decodeMutex);
+        auto iter = decodedImages.find(filename);
+        if (iter == decodedImages.end()) return false;
+
+        image = std::move(iter->second);
+        decodedImages.erase(iter);
+        return true;
+    }
+
+    /// <summary>
+    /// Creates the GL texture from decoded pixels. The payload is staged
+    /// through the pixel-unpack PBO ring, so glTexImage2D sources from
+    /// driver-resident memory and returns without waiting on the copy.
+    /// </summary>
+    /// <param name="image">Decoded pixels from Decode()</param>
+    /// <returns>True if the texture was created; otherwise, false</returns>
+    bool Texture::Upload(const DecodedImage& image) {
+        GLenum internalFormat = (image.channels == 4) ? GL_RGBA8 : GL_RGB8;
+        GLenum format = (image.channels == 4) ? GL_RGBA : GL_RGB;
+
+        m_size = image.size;
+
+        // account the storage up front - both paths below allocate it
+        m_gpuBytes = (size_t)image.size.x * image.size.y * image.channels;
+        GPUMemory::Track(m_gpuType, m_gpuBytes);
+
+        if (GLState::SupportsDSA()) {
+            // DSA creation never touches the texture bind points - the
+            // state cache stays sound and the driver skips the per-call
+            // target validation of the bind-to-edit path
+            glCreateTextures(m_target, 1, &m_texture);
+            glTextureStorage2D(m_texture, 1, internalFormat, image.size.x, image.size.y);
 
-        m_size.x = surface->w;
-        m_size.y = surface->h;
+            // rows are tightly packed, which the default 4-byte unpack
+            // alignment would misread for odd-width RGB images
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+            if (StageUnpack(image.pixels.data(), image.pixels.size())) {
+                // null pointer = offset into the bound unpack PBO
+                glTextureSubImage2D(m_texture, 0, 0, 0, image.size.x, image.size.y, format, GL_UNSIGNED_BYTE, nullptr);
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            }
+            else {
+                glTextureSubImage2D(m_texture, 0, 0, 0, image.size.x, image.size.y, format, GL_UNSIGNED_BYTE, image.pixels.data());
+            }
+
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+            glTextureParameteri(m_texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTextureParameteri(m_texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTextureParameteri(m_texture, GL_TEXTURE_WRAP_S, GL_REPEAT);
+            glTextureParameteri(m_texture, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+            return true;
+        }
 
         glGenTextures(1, &m_texture);
-        glBindTexture(m_target, m_texture);
+        GLState::BindTexture(m_target, m_texture);
 
-        glTexImage2D(m_target, 0, internalFormat, surface->w, surface->h, 0, format, GL_UNSIGNED_BYTE, surface->pixels);
+        // rows are tightly packed, which the default 4-byte unpack
+        // alignment would misread for odd-width RGB images
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        if (StageUnpack(image.pixels.data(), image.pixels.size())) {
+            // null pointer = offset into the bound unpack PBO
+            glTexImage2D(m_target, 0, internalFormat, image.size.x, image.size.y, 0, format, GL_UNSIGNED_BYTE, nullptr);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        }
+        else {
+            // mapping failed - upload straight from client memory
+            glTexImage2D(m_target, 0, internalFormat, image.size.x, image.size.y, 0, format, GL_UNSIGNED_BYTE, image.pixels.data());
+        }
+
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 
         // Texture parameters
         glTexParameteri(m_target, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
@@ -51,15 +334,256 @@ namespace neu {
         glTexParameteri(m_target, GL_TEXTURE_WRAP_S, GL_REPEAT);
         glTexParameteri(m_target, GL_TEXTURE_WRAP_T, GL_REPEAT);
 
-        glActiveTexture(GL_TEXTURE0);
+        GLState::SetActiveTexture(GL_TEXTURE0);
 
-        SDL_DestroySurface(surface);
         return true;
-    } 
+    }
+
+    /// <summary>
+    /// Uploads a cooked .ntex file: block-compressed payload (BC1/BC3/BC5/
+    /// BC7) with pre-generated mipmaps, each level fed to the GPU as-is via
+    /// glCompressedTexImage2D. No decode, no mip generation, and a fraction
+    /// of the VRAM of the uncompressed path.
+    ///
+    /// When mip streaming is enabled, only the smallest mips are read and
+    /// uploaded here; the texture registers with TextureStreamer, which
+    /// pages the larger levels in and out against the VRAM budget. Sampling
+    /// goes through GL_TEXTURE_BASE_LEVEL, so the shader-visible chain is
+    /// always complete.
+    /// </summary>
+    /// <param name="filename">Path to the cooked texture file</param>
+    /// <returns>True if the texture was successfully uploaded; otherwise, false</returns>
+    bool Texture::LoadCooked(const std::string& filename) {
+        // header and per-level layout first, so the streaming path can skip
+        // reading the high mips it is not going to upload yet
+        std::vector<uint8_t> scratch;
+        if (!file::ReadBinaryFileRegion(filename, 0, sizeof(CookedHeader), scratch)) {
+            LOG_CAT_ERROR(Renderer, "Could not load cooked texture: {}", filename);
+            return false;
+        }
+
+        CookedHeader header;
+        std::memcpy(&header, scratch.data(), sizeof(header));
+        if (header.magic != kCookedMagic || header.version != kCookedVersion) {
+            LOG_CAT_WARNING(Renderer, "Cooked texture has wrong magic/version: {}", filename);
+            return false;
+        }
+        if (header.mipCount == 0) return false;
+
+        m_internalFormat = GetInternalFormat((Format)header.format);
+        if (!m_internalFormat) {
+            LOG_CAT_WARNING(Renderer, "Cooked texture has unknown format {}: {}", header.format, filename);
+            return false;
+        }
+
+        // cooked payloads are compressed, so only the dimension budget applies
+        if (!ContentBudgets::CheckTexture(filename, (int)header.width, (int)header.height, true)) return false;
+
+        m_size.x = (int)header.width;
+        m_size.y = (int)header.height;
+        m_mipCount = (int)header.mipCount;
+        m_cookedFilename = filename;
+
+        // walk the size prefixes to build the level table (largest first)
+        m_mipRegions.resize(header.mipCount);
+        size_t offset = sizeof(CookedHeader);
+        for (uint32_t level = 0; level < header.mipCount; level++) {
+            uint32_t size;
+            if (!file::ReadBinaryFileRegion(filename, offset, sizeof(size), scratch)) return false;
+            std::memcpy(&size, scratch.data(), sizeof(size));
+            offset += sizeof(size);
+
+            m_mipRegions[level] = { (uint32_t)offset, size };
+            offset += size;
+        }
+
+        // streaming mode holds back the large mips; otherwise the whole
+        // chain is resident from the start
+        TextureStreamer& streamer = TextureStreamer::Instance();
+        int firstLevel = 0;
+        if (streamer.IsEnabled() && m_mipCount > streamer.GetSyncMipCount()) {
+            firstLevel = m_mipCount - streamer.GetSyncMipCount();
+        }
+        m_streamFirstLevel = firstLevel;
+        m_streamMaxFirstLevel = firstLevel;
+
+        // the resident tail of the chain is contiguous on disk - one read
+        const MipRegion& first = m_mipRegions[firstLevel];
+        const MipRegion& last = m_mipRegions[m_mipCount - 1];
+        size_t tailStart = first.offset;
+        size_t tailSize = (size_t)last.offset + last.size - tailStart;
+
+        std::vector<uint8_t> data;
+        if (!file::ReadBinaryFileRegion(filename, tailStart, tailSize, data)) {
+            LOG_CAT_ERROR(Renderer, "Could not load cooked texture: {}", filename);
+            return false;
+        }
+
+        if (firstLevel == 0 && GLState::SupportsDSA()) {
+            // non-streamed chain: immutable DSA storage, filled level by
+            // level without touching a bind point. Streamed textures stay
+            // on the mutable path below - eviction respecifies levels,
+            // which immutable storage doesn't allow
+            glCreateTextures(m_target, 1, &m_texture);
+            glTextureStorage2D(m_texture, m_mipCount, m_internalFormat, m_size.x, m_size.y);
+            GLDebug::Label(GL_TEXTURE, m_texture, filename);
+
+            for (int level = 0; level < m_mipCount; level++) {
+                const MipRegion& region = m_mipRegions[level];
+                GLsizei width = math::max(1, (GLsizei)(header.width >> level));
+                GLsizei height = math::max(1, (GLsizei)(header.height >> level));
+                glCompressedTextureSubImage2D(m_texture, level, 0, 0, width, height, m_internalFormat, (GLsizei)region.size, data.data() + (region.offset - tailStart));
+                m_residentBytes += region.size;
+            }
+
+            m_gpuBytes = m_residentBytes;
+            GPUMemory::Track(m_gpuType, m_gpuBytes);
+
+            // sample through the pre-generated chain (no glGenerateMipmap)
+            glTextureParameteri(m_texture, GL_TEXTURE_MIN_FILTER, (m_mipCount > 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+            glTextureParameteri(m_texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTextureParameteri(m_texture, GL_TEXTURE_MAX_LEVEL, m_mipCount - 1);
+            glTextureParameteri(m_texture, GL_TEXTURE_WRAP_S, GL_REPEAT);
+            glTextureParameteri(m_texture, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+            return true;
+        }
+
+        glGenTextures(1, &m_texture);
+        GLState::BindTexture(m_target, m_texture);
+        GLDebug::Label(GL_TEXTURE, m_texture, filename);
+
+        for (int level = firstLevel; level < m_mipCount; level++) {
+            const MipRegion& region = m_mipRegions[level];
+            GLsizei width = math::max(1, (GLsizei)(header.width >> level));
+            GLsizei height = math::max(1, (GLsizei)(header.height >> level));
+            glCompressedTexImage2D(m_target, level, m_internalFormat, width, height, 0, (GLsizei)region.size, data.data() + (region.offset - tailStart));
+            m_residentBytes += region.size;
+        }
+
+        m_gpuBytes = m_residentBytes;
+        GPUMemory::Track(m_gpuType, m_gpuBytes);
+
+        // sample through the pre-generated chain (no glGenerateMipmap)
+        glTexParameteri(m_target, GL_TEXTURE_MIN_FILTER, (m_mipCount > 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+        glTexParameteri(m_target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(m_target, GL_TEXTURE_BASE_LEVEL, firstLevel);
+        glTexParameteri(m_target, GL_TEXTURE_MAX_LEVEL, m_mipCount - 1);
+
+        glTexParameteri(m_target, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(m_target, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+        GLState::SetActiveTexture(GL_TEXTURE0);
+
+        if (IsStreaming()) streamer.Register(this);
+
+        return true;
+    }
+
+    /// <summary>
+    /// File region holding the next larger mip (base level - 1), for
+    /// TextureStreamer to read off-thread before calling StreamMipIn.
+    /// </summary>
+    /// <param name="offset">Receives the byte offset of the mip payload</param>
+    /// <param name="size">Receives the payload size in bytes</param>
+    /// <returns>True if a larger mip exists to stream in; otherwise, false</returns>
+    bool Texture::GetStreamInRegion(uint32_t& offset, uint32_t& size) const {
+        if (!CanStreamIn()) return false;
+
+        const MipRegion& region = m_mipRegions[m_streamFirstLevel - 1];
+        offset = region.offset;
+        size = region.size;
+        return true;
+    }
+
+    /// <summary>
+    /// Uploads one streamed-in mip level and lowers the sampling base level
+    /// to include it. The level must still be the one directly above the
+    /// current base - a read that went stale while in flight (the base level
+    /// moved due to eviction) is dropped and re-requested later.
+    /// </summary>
+    /// <param name="level">Mip level the data belongs to</param>
+    /// <param name="data">Compressed payload for that level</param>
+    /// <returns>True if the level was uploaded; otherwise, false</returns>
+    bool Texture::StreamMipIn(int level, const std::vector<uint8_t>& data) {
+        if (level != m_streamFirstLevel - 1) return false;
+        if (data.size() != m_mipRegions[level].size) return false;
+
+        GLsizei width = math::max(1, m_size.x >> level);
+        GLsizei height = math::max(1, m_size.y >> level);
+
+        GLState::BindTexture(m_target, m_texture);
+        glCompressedTexImage2D(m_target, level, m_internalFormat, width, height, 0, (GLsizei)data.size(), data.data());
+        glTexParameteri(m_target, GL_TEXTURE_BASE_LEVEL, level);
+        GLState::SetActiveTexture(GL_TEXTURE0);
+
+        m_streamFirstLevel = level;
+        m_residentBytes += m_mipRegions[level].size;
+        m_gpuBytes += m_mipRegions[level].size;
+        GPUMemory::Track(m_gpuType, m_mipRegions[level].size);
+        return true;
+    }
+
+    /// <summary>
+    /// Drops the current base level. Respecifying a single level of a
+    /// texture doesn't release its memory, so the kept levels are copied
+    /// GPU-side (glCopyImageSubData) into a fresh texture object and the old
+    /// one is deleted - no disk reads or re-uploads, and the driver can
+    /// actually reclaim the evicted mip.
+    /// </summary>
+    /// <returns>True if a level was evicted; otherwise, false</returns>
+    bool Texture::StreamMipOut() {
+        if (!CanStreamOut()) return false;
+
+        int newFirst = m_streamFirstLevel + 1;
+
+        GLuint texture;
+        glGenTextures(1, &texture);
+        GLState::BindTexture(m_target, texture);
+
+        // size the kept levels (null data - contents come from the copy below)
+        for (int level = newFirst; level < m_mipCount; level++) {
+            GLsizei width = math::max(1, m_size.x >> level);
+            GLsizei height = math::max(1, m_size.y >> level);
+            glCompressedTexImage2D(m_target, level, m_internalFormat, width, height, 0, (GLsizei)m_mipRegions[level].size, nullptr);
+        }
+
+        glTexParameteri(m_target, GL_TEXTURE_MIN_FILTER, (m_mipCount > 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+        glTexParameteri(m_target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(m_target, GL_TEXTURE_BASE_LEVEL, newFirst);
+        glTexParameteri(m_target, GL_TEXTURE_MAX_LEVEL, m_mipCount - 1);
+
+        glTexParameteri(m_target, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(m_target, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+        for (int level = newFirst; level < m_mipCount; level++) {
+            GLsizei width = math::max(1, m_size.x >> level);
+            GLsizei height = math::max(1, m_size.y >> level);
+            glCopyImageSubData(m_texture, m_target, level, 0, 0, 0, texture, m_target, level, 0, 0, 0, width, height, 1);
+        }
+
+        GLState::InvalidateTexture(m_texture);
+        glDeleteTextures(1, &m_texture);
+        m_texture = texture;
+
+        m_residentBytes -= m_mipRegions[m_streamFirstLevel].size;
+        m_gpuBytes -= m_mipRegions[m_streamFirstLevel].size;
+        GPUMemory::Untrack(m_gpuType, m_mipRegions[m_streamFirstLevel].size);
+        m_streamFirstLevel = newFirst;
+
+        GLState::SetActiveTexture(GL_TEXTURE0);
+        return true;
+    }
 
     void Texture::UpdateGUI() {
         ImGui::Text("Name: %s", file::GetFilename(name).c_str());
         ImGui::Text("Size: %dx%d", m_size.x, m_size.y);
+        if (IsStreaming()) {
+            ImGui::Text("Mips: %d / %d resident (%zu KB)", m_mipCount - m_streamFirstLevel, m_mipCount, m_residentBytes >> 10);
+        }
+        else {
+            ImGui::Text("Mips: %d", m_mipCount);
+        }
         Editor::ShowTexture(*this, 64, 64);
     }
 }
\ No newline at end of file
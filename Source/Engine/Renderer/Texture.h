@@ -1,7 +1,11 @@
 #pragma once
 #include "Resources/Resource.h"
+#include "GLState.h"
+#include "SamplerCache.h"
+#include "GPUMemory.h"
 #include "Math/Vector2.h"
 #include <string>
+#include <vector>
 #include <glad/glad.h>
 
 struct SDL_Texture;
@@ -26,21 +30,93 @@ namespace neu {
 			ClampEdge
 		};
 
+		// block-compressed payload formats carried by the cooked .ntex
+		// container (values are stored on disk, do not reorder)
+		enum class Format {
+			BC1,	// RGB(A), 4 bits/pixel
+			BC3,	// RGBA, 8 bits/pixel
+			BC5,	// two channel (normal maps), 8 bits/pixel
+			BC7		// high quality RGBA, 8 bits/pixel
+		};
+
+		/// <summary>
+		/// CPU-side decoded image - tightly packed rows, bottom-up. Produced
+		/// off-thread by Decode() so the main thread only pays for the GPU
+		/// upload, never the SDL_image decode.
+		/// </summary>
+		struct DecodedImage {
+			std::vector<uint8_t> pixels;
+			glm::ivec2 size{ 0, 0 };
+			int channels{ 0 };
+		};
+
 	public:
 		Texture() = default;
 		~Texture();
 
 		/// <summary>
 		/// Loads an image file and creates a texture for rendering.
-		/// Supports common image formats like PNG, JPG, BMP through SDL_image.
+		/// Dispatches on extension: .ntex files are the cooked container
+		/// (block-compressed payload with pre-generated mipmaps, uploaded
+		/// via glCompressedTexImage2D); everything else goes through the
+		/// SDL_image path (PNG, JPG, BMP) as a development fallback. When a
+		/// worker decoded the image ahead of time (see Prefetch), the decode
+		/// is picked up from the stash and only the upload runs here.
 		/// </summary>
 		/// <param name="filename">Path to the image file (e.g., "assets/textures/player.png")</param>
-		/// <param name="renderer">Reference to the Renderer that will manage this texture</param>
 		/// <returns>True if the texture was successfully loaded; otherwise, false</returns>
 		bool Load(const std::string& filename);
 
-		void SetActive(GLuint unit) { glActiveTexture(unit); }
-		void Bind() { glBindTexture(m_target, m_texture); }
+		/// <summary>
+		/// Decodes an image file into CPU memory. No GL calls - safe to run
+		/// on any thread. Rows are repacked tightly and flipped to GL's
+		/// bottom-up convention.
+		/// </summary>
+		/// <param name="filename">Path to the image file</param>
+		/// <param name="image">Receives the decoded pixels and layout</param>
+		/// <returns>True if the image was decoded; otherwise, false</returns>
+		static bool Decode(const std::string& filename, DecodedImage& image);
+
+		/// <summary>
+		/// Worker-side hook used by ResourceManager::GetAsync. Decodes the
+		/// image off-thread into a stash that Load() drains on the main
+		/// thread, so async texture loads cost the context thread an upload
+		/// and nothing else. Cooked .ntex files carry no decode work, so
+		/// they just warm the OS file cache.
+		/// </summary>
+		/// <param name="filename">Path to the image file</param>
+		static void Prefetch(const std::string& filename);
+
+		/// <summary>
+		/// Hot reload: tears down the GL object (and its streamer/bindless
+		/// state) and loads the edited file into this same Texture instance,
+		/// so every res_t held by materials and components sees the new
+		/// pixels. Maps packed into shared texture arrays keep their stale
+		/// array copy until the owning material reloads.
+		/// </summary>
+		/// <param name="filename">The source file to reload from</param>
+		/// <returns>True if the texture reloaded; otherwise, false</returns>
+		bool Reload(const std::string& filename) override;
+
+		void SetActive(GLuint unit) { GLState::SetActiveTexture(unit); }
+		void Bind() { GLState::BindTexture(m_target, m_texture); }
+
+		/// <summary>
+		/// The shared-sampler state this texture samples with when bound
+		/// through a material - mip filtering only when a chain exists (a
+		/// mipmap filter on a single-level texture is incomplete), repeat
+		/// wrap, anisotropy on mipmapped color maps. Render targets
+		/// override with clamped unfiltered state.
+		/// </summary>
+		/// <returns>Sampler desc for SamplerCache::Get</returns>
+		virtual SamplerDesc GetSamplerDesc() const {
+			SamplerDesc desc;
+			if (m_mipCount <= 1) {
+				desc.minFilter = GL_LINEAR;
+				desc.anisotropic = false;
+			}
+			return desc;
+		}
 
 		void UpdateGUI() override;
 
@@ -50,14 +126,96 @@ namespace neu {
 		/// <returns>A vec2 containing the width and height of the texture</returns>
 		glm::ivec2 GetSize() { return m_size;  }
 
+		// --- mip streaming (cooked textures only, driven by TextureStreamer) ---
+		// levels are indexed against the full chain; m_streamFirstLevel is the
+		// current GL base level, 0 means the whole chain is resident
+
+		int GetStreamFirstLevel() const { return m_streamFirstLevel; }
+		int GetStreamMaxFirstLevel() const { return m_streamMaxFirstLevel; }
+		bool IsStreaming() const { return m_streamMaxFirstLevel > 0; }
+		bool CanStreamIn() const { return m_streamFirstLevel > 0; }
+		bool CanStreamOut() const { return m_streamFirstLevel < m_streamMaxFirstLevel; }
+
+		// resident GL_ARB_bindless_texture handle, created on first request
+		// and released with the texture object. returns 0 when the driver
+		// lacks the extension or the texture streams - streamed objects are
+		// rebuilt on eviction, which would strand an outstanding handle
+		GLuint64 GetBindlessHandle();
+
+		// bytes of compressed mip data currently uploaded to the GPU
+		size_t GetResidentBytes() const { return m_residentBytes; }
+
+		// resident GPU bytes for the budget accounting - exact compressed
+		// bytes for cooked textures, an RGBA8 estimate for the SDL path
+		size_t GetMemorySize() const override { return m_residentBytes ? m_residentBytes : (size_t)m_size.x * m_size.y * 4; }
+
+		const std::string& GetCookedFilename() const { return m_cookedFilename; }
+
+		// file region holding the next larger mip (base level - 1), read
+		// off-thread by TextureStreamer before StreamMipIn uploads it
+		bool GetStreamInRegion(uint32_t& offset, uint32_t& size) const;
+
+		// uploads one mip level and lowers the sampling base level; level
+		// must be the current base level - 1 (stale in-flight reads are dropped)
+		bool StreamMipIn(int level, const std::vector<uint8_t>& data);
+
+		// drops the current base level, rebuilding the texture object so the
+		// driver can actually release the memory
+		bool StreamMipOut();
+
+	private:
+		// cooked container path - compressed mip chain upload
+		bool LoadCooked(const std::string& filename);
+
+		// creates the GL texture from decoded pixels, staging the payload
+		// through the pixel-unpack PBO ring so glTexImage2D sources from
+		// driver memory instead of stalling on the client copy
+		bool Upload(const DecodedImage& image);
+
+		// claims a worker-decoded image for this filename, if one is stashed
+		static bool TakeDecoded(const std::string& filename, DecodedImage& image);
+
 	public:
 		// Allow Renderer class to access the texture for drawing operations
 		friend class Renderer;
-		GLuint m_texture{ 0 };           
+		GLuint m_texture{ 0 };
 		GLenum m_target = GL_TEXTURE_2D;
 
-		
+
 		// The dimensions of the texture in pixels
 		glm::ivec2 m_size{ 0, 0 };
+
+		// mip levels in the full chain (1 for the uncompressed SDL_image path)
+		int m_mipCount{ 1 };
+
+		// per-frame streaming scratch written by TextureStreamer
+		float m_streamDistance{ 0 };
+		int m_streamDesiredLevel{ 0 };
+		uint64_t m_streamStamp{ 0 };
+		bool m_streamInFlight{ false };
+
+	protected:
+		// bytes accounted to GPUMemory for this object, released by the
+		// destructor - RenderTexture accounts under its own type
+		size_t m_gpuBytes{ 0 };
+		GPUMemory::Type m_gpuType{ GPUMemory::Type::Texture };
+
+	private:
+		// byte layout of one mip payload inside the cooked file
+		struct MipRegion {
+			uint32_t offset;
+			uint32_t size;
+		};
+
+		// cooked file layout, one entry per level (largest first)
+		std::vector<MipRegion> m_mipRegions;
+		std::string m_cookedFilename;
+		GLenum m_internalFormat{ 0 };
+
+		int m_streamFirstLevel{ 0 };		// current GL base level
+		int m_streamMaxFirstLevel{ 0 };	// base level at load, eviction floor
+		size_t m_residentBytes{ 0 };
+
+		GLuint64 m_bindlessHandle{ 0 };
 	};
 }
\ No newline at end of file
@@ -22,7 +22,7 @@ namespace neu {
 		// Load the JSON document
 		neu::serial::document_t document;
 		if (!neu::serial::Load(filename, document)) {
-			LOG_ERROR("Could not load TextureAnimation json {}", filename);
+			LOG_CAT_ERROR(Renderer, "Could not load TextureAnimation json {}", filename);
 			return false;
 		}
 
@@ -33,7 +33,7 @@ namespace neu {
 		// Load the sprite sheet texture using the resource manager
 		m_texture = Resources().Get<Texture>(texture_name);
 		if (!m_texture) {
-			LOG_ERROR("Could not load texture in Texture Animation {}", texture_name);
+			LOG_CAT_ERROR(Renderer, "Could not load texture in Texture Animation {}", texture_name);
 		}
 
 		// Read animation configuration from JSON
@@ -70,7 +70,7 @@ namespace neu {
 	{
 		// Validate frame index and default to frame 0 if out of bounds
 		if (!IsValidFrame(frame)) {
-			LOG_WARNING("Frame is outside bounds {}/{}", frame, m_totalFrames);
+			LOG_CAT_WARNING(Renderer, "Frame is outside bounds {}/{}", frame, m_totalFrames);
 			frame = 0;
 		}
 
@@ -0,0 +1,85 @@
+#include "EnginePCH.h"
+#include "TextureArrayCache.h"
+#include "Texture.h"
+
+namespace neu {
+	bool TextureArrayCache::Acquire(Texture& texture, TextureArraySlot& slot) {
+		if (!texture.m_texture || texture.m_target != GL_TEXTURE_2D) return false;
+
+		// a streamed texture rebuilds its GL object when mips evict, the
+		// copied layer would go stale - those stay on the binding path
+		if (texture.IsStreaming()) return false;
+
+		auto found = m_slots.find(texture.m_texture);
+		if (found != m_slots.end()) {
+			slot = found->second;
+			return true;
+		}
+
+		// bucket parameters come from the live GL object, so the cooked
+		// (compressed) and SDL_image (RGBA8) paths both work unchanged
+		glm::ivec2 size = texture.GetSize();
+		int mipCount = texture.m_mipCount;
+
+		texture.Bind();
+		GLint internalFormat = 0;
+		glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &internalFormat);
+		if (size.x <= 0 || size.y <= 0 || internalFormat == 0) return false;
+
+		uint64_t key = ((uint64_t)(uint16_t)size.x << 48) | ((uint64_t)(uint16_t)size.y << 32) |
+			((uint64_t)(uint32_t)internalFormat << 8) | (uint64_t)(uint8_t)mipCount;
+
+		// first bucket for the key with a free layer, or a fresh one
+		auto& buckets = m_buckets[key];
+		Bucket* bucket = nullptr;
+		for (auto& candidate : buckets) {
+			if (candidate.layersUsed < kLayersPerArray) {
+				bucket = &candidate;
+				break;
+			}
+		}
+
+		if (!bucket) {
+			Bucket created;
+			glGenTextures(1, &created.texture);
+			GLState::BindTexture(GL_TEXTURE_2D_ARRAY, created.texture);
+			glTexStorage3D(GL_TEXTURE_2D_ARRAY, mipCount, internalFormat, size.x, size.y, kLayersPerArray);
+
+			glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, (mipCount > 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+			glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+			glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+			buckets.push_back(created);
+			bucket = &buckets.back();
+			m_arrayCount++;
+		}
+
+		// GPU-side copy of the whole mip chain into the assigned layer -
+		// works for compressed formats, no CPU readback
+		int layer = bucket->layersUsed++;
+		for (int level = 0; level < mipCount; level++) {
+			int levelWidth = math::max(size.x >> level, 1);
+			int levelHeight = math::max(size.y >> level, 1);
+			glCopyImageSubData(texture.m_texture, GL_TEXTURE_2D, level, 0, 0, 0,
+				bucket->texture, GL_TEXTURE_2D_ARRAY, level, 0, 0, layer,
+				levelWidth, levelHeight, 1);
+		}
+
+		slot = { bucket->texture, layer, mipCount > 1 };
+		m_slots[texture.m_texture] = slot;
+		return true;
+	}
+
+	void TextureArrayCache::Clear() {
+		for (auto& [key, buckets] : m_buckets) {
+			for (auto& bucket : buckets) {
+				GLState::InvalidateTexture(bucket.texture);
+				glDeleteTextures(1, &bucket.texture);
+			}
+		}
+		m_buckets.clear();
+		m_slots.clear();
+		m_arrayCount = 0;
+	}
+}
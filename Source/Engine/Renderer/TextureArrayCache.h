@@ -0,0 +1,73 @@
+#pragma once
+#include "Core/Singleton.h"
+#include "SamplerCache.h"
+#include <glad/glad.h>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+namespace neu {
+	class Texture;
+
+	// where a texture landed inside a shared array - the array texture
+	// object plus the layer index the material pushes as a uniform
+	struct TextureArraySlot {
+		GLuint texture{ 0 };
+		int layer{ -1 };
+		bool mipmapped{ true };	// the bucket's whole chain, keyed at Acquire
+
+		// shared-sampler state matching the bucket - a mip filter only
+		// when the bucket actually stores a chain
+		SamplerDesc GetSamplerDesc() const {
+			SamplerDesc desc;
+			if (!mipmapped) {
+				desc.minFilter = GL_LINEAR;
+				desc.anisotropic = false;
+			}
+			return desc;
+		}
+	};
+
+	// groups same-size/same-format textures into GL_TEXTURE_2D_ARRAY
+	// objects, so materials whose maps share a bucket bind identical
+	// texture objects - GLState's bind cache then elides the per-material
+	// rebinds and only a layer uniform changes between draws
+	class TextureArrayCache : public Singleton<TextureArrayCache> {
+	public:
+		// copies the texture's mip chain into a layer of the matching
+		// bucket (allocated on first use). fails - and the material falls
+		// back to plain bindings - for streaming textures, whose GL object
+		// is rebuilt on mip eviction and would leave the copied layer stale
+		bool Acquire(Texture& texture, TextureArraySlot& slot);
+
+		// releases every array texture, called from Engine::Shutdown after
+		// the resource cache is cleared
+		void Clear();
+
+		size_t GetArrayCount() const { return m_arrayCount; }
+		size_t GetLayersUsed() const { return m_slots.size(); }
+
+	private:
+		friend class Singleton<TextureArrayCache>;
+		TextureArrayCache() = default;
+
+		// layers allocated per array - glTexStorage3D commits the whole
+		// slab up front, so this trades a little VRAM slack at the tail of
+		// each bucket for fewer distinct bind targets
+		static constexpr int kLayersPerArray = 32;
+
+		struct Bucket {
+			GLuint texture{ 0 };
+			int layersUsed{ 0 };
+		};
+
+		// buckets keyed by (size, internal format, mip count); a key grows
+		// a new bucket when every layer of the previous ones is taken
+		std::unordered_map<uint64_t, std::vector<Bucket>> m_buckets;
+
+		// source texture object -> slot, so shared textures pack once
+		std::unordered_map<GLuint, TextureArraySlot> m_slots;
+
+		size_t m_arrayCount{ 0 };
+	};
+}
@@ -0,0 +1,176 @@
+#include "TextureStreamer.h"
+#include "Texture.h"
+#include "Material.h"
+#include "UploadScheduler.h"
+#include "Framework/Scene.h"
+#include "Components/ModelRenderer.h"
+#include "Components/CameraComponent.h"
+#include "Resources/ResourceManager.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace neu {
+    void TextureStreamer::Register(Texture* texture) {
+        m_textures.push_back(texture);
+    }
+
+    void TextureStreamer::Unregister(Texture* texture) {
+        std::erase(m_textures, texture);
+    }
+
+    size_t TextureStreamer::GetResidentBytes() const {
+        size_t bytes = 0;
+        for (auto texture : m_textures) bytes += texture->GetResidentBytes();
+        return bytes;
+    }
+
+    void TextureStreamer::Update(Scene& scene) {
+        PROFILE_SCOPE("TextureStreamer::Update");
+
+        if (m_textures.empty()) return;
+        m_frame++;
+
+        // camera position drives priority - with no camera, residency holds
+        auto cameras = scene.GetActorComponents<CameraComponent>();
+        if (cameras.empty()) return;
+        glm::vec3 eye = cameras[0]->owner->transform.position;
+
+        // distance pass: the nearest ModelRenderer referencing a texture
+        // sets its priority, and touching it at all refreshes the LRU stamp
+        for (auto texture : m_textures) {
+            texture->m_streamDistance = std::numeric_limits<float>::max();
+        }
+        // batch the camera distances: gather every renderer position into
+        // SoA frame-arena scratch and run the one-to-many kernel once,
+        // instead of a scalar length/sqrt per renderer
+        auto renderers = scene.GetActorComponents<ModelRenderer>();
+        auto positions = math::batch::Soa3::FromFrameArena(renderers.size());
+        for (size_t i = 0; i < renderers.size(); i++) {
+            const glm::vec3& position = renderers[i]->owner->transform.position;
+            positions.x[i] = position.x;
+            positions.y[i] = position.y;
+            positions.z[i] = position.z;
+        }
+        float* distances = (float*)FrameArena::Allocate(renderers.size() * sizeof(float), 16);
+        math::batch::Distance(eye, positions, distances, renderers.size());
+
+        for (size_t i = 0; i < renderers.size(); i++) {
+            auto renderer = renderers[i];
+            if (!renderer->material) continue;
+
+            float distance = distances[i];
+            Material* material = renderer->material.get();
+            Texture* maps[] = { material->baseMap.get(), material->specularMap.get(), material->emissiveMap.get(), material->normalMap.get() };
+            for (auto map : maps) {
+                if (!map || !map->IsStreaming()) continue;
+
+                if (distance < map->m_streamDistance) map->m_streamDistance = distance;
+                map->m_streamStamp = m_frame;
+            }
+        }
+
+        // target base level from distance: full chain close up, one level
+        // dropped per doubling past kFullResDistance; unreferenced textures
+        // fall back to minimum residency
+        for (auto texture : m_textures) {
+            int level = texture->GetStreamMaxFirstLevel();
+            if (texture->m_streamDistance < std::numeric_limits<float>::max()) {
+                level = 0;
+                if (texture->m_streamDistance > kFullResDistance) {
+                    level = (int)std::log2(texture->m_streamDistance / kFullResDistance);
+                }
+                level = math::min(level, texture->GetStreamMaxFirstLevel());
+            }
+            texture->m_streamDesiredLevel = level;
+        }
+
+        // evictions: when over budget, least-recently-needed textures give
+        // up their top mips first, farthest first among ties
+        size_t resident = GetResidentBytes();
+        if (resident > m_budgetBytes) {
+            frame_vector<Texture*> candidates;
+            for (auto texture : m_textures) {
+                if (texture->CanStreamOut()) candidates.push_back(texture);
+            }
+            std::sort(candidates.begin(), candidates.end(), [](Texture* a, Texture* b) {
+                if (a->m_streamStamp != b->m_streamStamp) return a->m_streamStamp < b->m_streamStamp;
+                return a->m_streamDistance > b->m_streamDistance;
+            });
+
+            for (auto texture : candidates) {
+                while (resident > m_budgetBytes && texture->CanStreamOut()) {
+                    size_t before = texture->GetResidentBytes();
+                    texture->StreamMipOut();
+                    resident -= before - texture->GetResidentBytes();
+                }
+                if (resident <= m_budgetBytes) break;
+            }
+        }
+
+        // stream-ins: closest textures missing mips first, one level per
+        // texture per request, never pushing residency past the budget
+        frame_vector<Texture*> wanted;
+        for (auto texture : m_textures) {
+            if (texture->m_streamInFlight) continue;
+            if (texture->GetStreamFirstLevel() > texture->m_streamDesiredLevel) wanted.push_back(texture);
+        }
+        std::sort(wanted.begin(), wanted.end(), [](Texture* a, Texture* b) {
+            return a->m_streamDistance < b->m_streamDistance;
+        });
+
+        for (auto texture : wanted) {
+            if (m_inFlight >= kMaxInFlight) break;
+
+            uint32_t offset, size;
+            if (!texture->GetStreamInRegion(offset, size)) continue;
+            if (resident + size > m_budgetBytes) continue;
+
+            int level = texture->GetStreamFirstLevel() - 1;
+            std::string filename = texture->GetCookedFilename();
+
+            // async streaming-priority read - the I/O pool keeps several
+            // mip reads in flight and coalesces adjacent cooked ranges;
+            // the completion lands on the main thread under the pump's
+            // frame budget, same cadence as the old worker-pool path
+            file::ReadRegionAsync(filename, offset, size, file::ReadPriority::Streaming,
+                [this, texture, level](bool, std::vector<uint8_t>& data) {
+                    CompleteRequest(texture, level, data);
+                });
+
+            texture->m_streamInFlight = true;
+            m_inFlight++;
+            resident += size;
+        }
+    }
+
+    void TextureStreamer::CompleteRequest(Texture* texture, int level, std::vector<uint8_t>& data) {
+        m_inFlight--;
+
+        // the texture may have been destroyed while the read was in flight -
+        // only dereference it if it is still registered
+        if (std::find(m_textures.begin(), m_textures.end(), texture) == m_textures.end()) return;
+
+        // the GL upload goes through the upload governor rather than
+        // running here, so a burst of completions spreads across frames;
+        // close textures the player is looking at outrank speculative
+        // warming. The texture stays marked in flight until the upload
+        // lands, keeping Update from requesting its next mip early
+        auto priority = texture->m_streamDistance < kFullResDistance
+            ? UploadScheduler::Priority::High
+            : UploadScheduler::Priority::Low;
+
+        size_t bytes = data.size();     // before the move below
+        UploadScheduler::Instance().Queue(priority, bytes,
+            [this, texture, level, data = std::move(data)]() mutable {
+                // re-check registration - frames may pass before this runs
+                if (std::find(m_textures.begin(), m_textures.end(), texture) == m_textures.end()) return;
+
+                texture->m_streamInFlight = false;
+
+                // StreamMipIn drops stale data (base level moved while in
+                // flight); the next Update re-requests what is still wanted
+                texture->StreamMipIn(level, data);
+            });
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include "Core/Singleton.h"
+#include <cstdint>
+#include <vector>
+
+namespace neu {
+	class Scene;
+	class Texture;
+
+	/// <summary>
+	/// Pages texture mips in and out of VRAM against a configurable budget.
+	///
+	/// Cooked textures above the synchronous mip count load with only their
+	/// smallest levels resident and register here. Each frame the streamer
+	/// scores every registered texture by the camera distance of the nearest
+	/// ModelRenderer referencing it, derives a target base level (one mip
+	/// dropped per doubling of distance), evicts the least-recently-needed
+	/// high mips when over budget, and queues worker-thread disk reads for
+	/// the mips closest textures are missing. Reads go through the
+	/// ResourceManager worker pool, so the GL uploads land inside the same
+	/// main-thread frame budget as async resource loads.
+	/// </summary>
+	class TextureStreamer : public Singleton<TextureStreamer> {
+	public:
+		// smallest mips uploaded synchronously at load (64x64 base for a
+		// full chain) - everything above streams in on demand
+		static constexpr int kSyncMips = 7;
+
+		// recomputes priorities, evicts over budget, and issues read requests
+		void Update(Scene& scene);
+
+		// called by Texture as cooked textures enter and leave streaming mode
+		void Register(Texture* texture);
+		void Unregister(Texture* texture);
+
+		// disabling streaming makes subsequent cooked loads fully resident;
+		// already-registered textures keep streaming
+		void SetEnabled(bool enabled) { m_enabled = enabled; }
+		bool IsEnabled() const { return m_enabled; }
+		int GetSyncMipCount() const { return kSyncMips; }
+
+		void SetBudget(size_t bytes) { m_budgetBytes = bytes; }
+		size_t GetBudget() const { return m_budgetBytes; }
+		size_t GetResidentBytes() const;
+
+		// auto budget lets GPUMemory re-derive the budget from the driver's
+		// free-memory report each sample, so streaming backs off before the
+		// driver starts evicting - switch it off to pin a manual budget
+		void SetAutoBudget(bool enabled) { m_autoBudget = enabled; }
+		bool IsAutoBudget() const { return m_autoBudget; }
+
+	private:
+		friend class Singleton<TextureStreamer>;
+		TextureStreamer() = default;
+
+		// main-thread completion of one worker read (upload + bookkeeping)
+		void CompleteRequest(Texture* texture, int level, std::vector<uint8_t>& data);
+
+	private:
+		// camera distance where a texture earns its full mip chain - each
+		// doubling past this drops one more level
+		static constexpr float kFullResDistance = 10.0f;
+
+		// reads outstanding at once, so one frame's completions stay inside
+		// the ResourceManager finalize budget
+		static constexpr int kMaxInFlight = 4;
+
+		bool m_enabled{ true };
+		bool m_autoBudget{ true };
+		size_t m_budgetBytes{ 256ull << 20 };
+		uint64_t m_frame{ 0 };
+		int m_inFlight{ 0 };
+
+		std::vector<Texture*> m_textures;
+	};
+}
@@ -0,0 +1,68 @@
+#include "EnginePCH.h"
+#include "UniformBuffer.h"
+
+namespace neu {
+
+	UniformBuffer::~UniformBuffer()
+	{
+		for (auto& fence : m_fences) {
+			if (fence) glDeleteSync(fence);
+		}
+		if (m_ubo) {
+			GPUMemory::Untrack(GPUMemory::Type::Buffer, kRegions * m_alignedSize);
+			if (m_map) {
+				glBindBuffer(GL_UNIFORM_BUFFER, m_ubo);
+				glUnmapBuffer(GL_UNIFORM_BUFFER);
+				glBindBuffer(GL_UNIFORM_BUFFER, 0);
+			}
+			glDeleteBuffers(1, &m_ubo);
+		}
+	}
+
+	void UniformBuffer::Create(GLsizeiptr size, GLuint binding)
+	{
+		m_size = size;
+		m_binding = binding;
+
+		// region offsets passed to glBindBufferRange must honor the
+		// implementation's UBO offset alignment
+		GLint alignment = 256;
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+		m_alignedSize = (size + alignment - 1) / alignment * alignment;
+
+		glGenBuffers(1, &m_ubo);
+		glBindBuffer(GL_UNIFORM_BUFFER, m_ubo);
+
+		// immutable persistent storage, mapped once for the buffer's lifetime
+		GLbitfield mapFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glBufferStorage(GL_UNIFORM_BUFFER, kRegions * m_alignedSize, nullptr, mapFlags);
+		m_map = (uint8_t*)glMapBufferRange(GL_UNIFORM_BUFFER, 0, kRegions * m_alignedSize, mapFlags);
+		GPUMemory::Track(GPUMemory::Type::Buffer, kRegions * m_alignedSize);
+
+		glBindBufferRange(GL_UNIFORM_BUFFER, binding, m_ubo, 0, size);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	}
+
+	void UniformBuffer::Upload(const void* data, GLsizeiptr size, GLintptr offset)
+	{
+		// fence the region the draws issued since the previous upload read
+		// from, then advance - the wait only fires if the GPU has fallen
+		// more than kRegions uploads behind
+		if (m_fences[m_region]) glDeleteSync(m_fences[m_region]);
+		m_fences[m_region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+		m_region = (m_region + 1) % kRegions;
+		if (m_fences[m_region]) {
+			glClientWaitSync(m_fences[m_region], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull);
+			glDeleteSync(m_fences[m_region]);
+			m_fences[m_region] = nullptr;
+		}
+
+		// coherent mapping - the write is visible to the GPU without an
+		// explicit flush, and rebinding the range publishes this region
+		GLsizeiptr regionBase = m_region * m_alignedSize;
+		std::memcpy(m_map + regionBase + offset, data, size);
+		glBindBufferRange(GL_UNIFORM_BUFFER, m_binding, m_ubo, regionBase, m_size);
+		FrameStats::AddUpload(size);
+	}
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstdint>
+
+namespace neu {
+	/// <summary>
+	/// Thin wrapper around an OpenGL uniform buffer object (UBO).
+	/// Used to share per-frame data (camera matrices, lights) across all
+	/// programs through a fixed binding point instead of setting the same
+	/// uniforms on every program individually.
+	///
+	/// Backed by persistently-mapped storage split into fence-guarded
+	/// regions: each Upload writes the next region and rebinds the range,
+	/// so per-pass uploads never stall on the driver synchronizing with
+	/// draws still reading the previous contents.
+	/// </summary>
+	class UniformBuffer
+	{
+	public:
+		UniformBuffer() = default;
+		~UniformBuffer();
+
+		// allocates the buffer and binds it to the given uniform binding point
+		void Create(GLsizeiptr size, GLuint binding);
+
+		// writes data into the next region and publishes it at the binding
+		// point, call once per pass for shared blocks
+		void Upload(const void* data, GLsizeiptr size, GLintptr offset = 0);
+
+		bool IsCreated() const { return m_ubo != 0; }
+
+	private:
+		// regions cycled per upload - three keep the CPU ahead of the GPU
+		// without waiting in the steady state
+		static constexpr int kRegions = 3;
+
+		GLuint m_ubo = 0;
+		GLuint m_binding = 0;
+		GLsizeiptr m_size = 0;
+		GLsizeiptr m_alignedSize = 0;   // m_size padded to the UBO offset alignment
+		uint8_t* m_map = nullptr;       // persistent map, kRegions regions
+		int m_region = 0;
+		GLsync m_fences[kRegions]{};
+	};
+}
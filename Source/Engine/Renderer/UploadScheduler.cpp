@@ -0,0 +1,70 @@
+#include "UploadScheduler.h"
+#include "GPUProfiler.h"
+#include "Core/Profiler.h"
+#include "Engine.h"
+#include <chrono>
+
+namespace neu {
+	void UploadScheduler::Queue(Priority priority, size_t bytes, std::function<void()> upload) {
+		m_queues[(size_t)priority].push_back({ std::move(upload), bytes, m_frame });
+		m_queuedBytes += bytes;
+	}
+
+	size_t UploadScheduler::GetQueuedCount() const {
+		size_t count = 0;
+		for (auto& queue : m_queues) count += queue.size();
+		return count;
+	}
+
+	void UploadScheduler::Drain() {
+		PROFILE_SCOPE("UploadScheduler::Drain");
+
+		m_frame++;
+		if (m_queuedBytes == 0) return;
+
+		// starvation aging - entries that waited kAgeFrames move up one
+		// level, to the back of the higher queue (they are still younger
+		// work than anything already promoted there)
+		for (size_t level = 1; level < (size_t)Priority::Count; level++) {
+			auto& queue = m_queues[level];
+			while (!queue.empty() && m_frame - queue.front().queuedFrame >= kAgeFrames) {
+				m_queues[level - 1].push_back(std::move(queue.front()));
+				queue.pop_front();
+			}
+		}
+
+		// GPU feedback: while the harvested frame time is over the target
+		// (frame cap when set, otherwise 60 Hz - same rule as dynamic
+		// resolution), keep only a fraction of the byte allowance
+		size_t byteAllowance = m_byteBudget;
+		float targetFps = GetEngine().GetRenderer().GetTargetFrameRate();
+		float targetMs = (targetFps > 0) ? 1000.0f / targetFps : 1000.0f / 60.0f;
+		float gpuMs = GPUProfiler::GetFrameMs();
+		if (gpuMs > targetMs * 0.95f) {
+			byteAllowance = (size_t)(byteAllowance * kThrottledFraction);
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		size_t drainedBytes = 0;
+		bool drainedAny = false;
+
+		for (auto& queue : m_queues) {
+			while (!queue.empty()) {
+				// always let one upload through so an entry larger than
+				// the whole allowance still makes progress
+				if (drainedAny && drainedBytes + queue.front().bytes > byteAllowance) return;
+
+				Upload upload = std::move(queue.front());
+				queue.pop_front();
+
+				upload.upload();
+				drainedBytes += upload.bytes;
+				m_queuedBytes -= upload.bytes;
+				drainedAny = true;
+
+				std::chrono::duration<float> elapsed = std::chrono::steady_clock::now() - start;
+				if (elapsed.count() >= m_timeBudget) return;
+			}
+		}
+	}
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include "Core/Singleton.h"
+#include <cstdint>
+#include <deque>
+#include <functional>
+
+namespace neu {
+	/// <summary>
+	/// Central per-frame budget governor for streaming GPU uploads.
+	///
+	/// Streaming producers (texture mips today; mesh pages and audio banks
+	/// as they land) queue their glTexSubImage/glBufferSubData work here
+	/// instead of uploading on completion, and Drain plays the queue back
+	/// once per frame up to a byte and main-thread time budget - so a burst
+	/// of completions spreads across frames instead of blowing one. The
+	/// byte allowance also backs off while the harvested GPU frame time is
+	/// over the frame target (same feedback the dynamic resolution
+	/// controller steps on), since upload bandwidth competes with draw work
+	/// on the transfer queue.
+	///
+	/// Queued items age: an entry promotes one priority level per
+	/// kAgeFrames frames waited, so low-priority uploads behind a steady
+	/// stream of high-priority ones still land eventually.
+	/// </summary>
+	class UploadScheduler : public Singleton<UploadScheduler> {
+	public:
+		/// <summary>
+		/// Dispatch class - High drains first (uploads the player is
+		/// staring at, e.g. close mips), Low last (speculative warming).
+		/// </summary>
+		enum class Priority : uint8_t {
+			High,
+			Normal,
+			Low,
+
+			Count
+		};
+
+		/// <summary>
+		/// Queues one upload. The callable runs on the main (GL) thread
+		/// from a later Drain; it owns its data and must tolerate running
+		/// any number of frames after queueing.
+		/// </summary>
+		/// <param name="priority">Dispatch class - High drains first</param>
+		/// <param name="bytes">Bytes the upload will push, counted against the frame budget</param>
+		/// <param name="upload">The GL upload work</param>
+		void Queue(Priority priority, size_t bytes, std::function<void()> upload);
+
+		/// <summary>
+		/// Plays queued uploads back up to the frame's allowance, called
+		/// once per frame by Engine::Update on the main thread. At least
+		/// one upload runs per frame regardless of budget, so oversized
+		/// items can't wedge the queue.
+		/// </summary>
+		void Drain();
+
+		/// <summary>
+		/// Sets the per-frame upload allowance: bytes pushed and
+		/// main-thread seconds spent, whichever runs out first.
+		/// </summary>
+		void SetBudget(size_t bytesPerFrame, float secondsPerFrame) {
+			m_byteBudget = bytesPerFrame;
+			m_timeBudget = secondsPerFrame;
+		}
+
+		size_t GetQueuedBytes() const { return m_queuedBytes; }
+		size_t GetQueuedCount() const;
+
+	private:
+		friend class Singleton<UploadScheduler>;
+		UploadScheduler() = default;
+
+	private:
+		// frames an entry waits before moving up one priority level
+		static constexpr uint64_t kAgeFrames = 8;
+
+		// fraction of the byte allowance kept while the GPU is over the
+		// frame target - uploads slow to a trickle rather than stopping,
+		// so streaming still converges on a GPU-bound scene
+		static constexpr float kThrottledFraction = 0.25f;
+
+		struct Upload {
+			std::function<void()> upload;
+			size_t bytes;
+			uint64_t queuedFrame;
+		};
+		std::deque<Upload> m_queues[(size_t)Priority::Count];
+
+		size_t m_byteBudget{ 8 * 1024 * 1024 };
+		float m_timeBudget{ 0.001f };
+		size_t m_queuedBytes{ 0 };
+		uint64_t m_frame{ 0 };
+	};
+}
@@ -1,48 +1,193 @@
 #include "EnginePCH.h"
 #include "VertexBuffer.h"
 #include "Model.h"
+#include <unordered_map>
 
 namespace neu {
 
+	// one VAO per distinct attribute format (DSA path) - formats declare the
+	// layout once with glVertexArrayAttribFormat, draws just re-attach their
+	// buffers per binding slot. Collapses the per-mesh VAOs into a handful
+	// and makes consecutive same-format draws skip the VAO switch entirely
+	struct SharedVertexFormat {
+		// attribute indexes double as binding slots, matching the private
+		// VAO setup - the skin stream's location 9 is the current ceiling
+		static constexpr int kMaxBindings = 16;
+
+		struct Binding {
+			GLuint buffer = 0;
+			GLuint offset = 0;
+		};
+
+		GLuint vao = 0;
+		Binding bindings[kMaxBindings]{};
+		GLuint ibo = 0;
+	};
+
+	namespace {
+		std::unordered_map<uint64_t, std::unique_ptr<SharedVertexFormat>> sharedFormats;
+
+		// a deleted buffer name can be reused by GL - drop any cached
+		// attachment so the next draw re-attaches instead of false-skipping
+		void InvalidateSharedBuffer(GLuint buffer) {
+			if (!buffer) return;
+			for (auto& [key, format] : sharedFormats) {
+				for (auto& binding : format->bindings) {
+					if (binding.buffer == buffer) binding = {};
+				}
+				if (format->ibo == buffer) format->ibo = 0;
+			}
+		}
+	}
+
 	VertexBuffer::VertexBuffer()
 	{
+		// the DSA path specifies the whole layout by name and never binds
+		// the vertex array or the edit targets, so buffer setup can't
+		// pollute the GLState cache
+		if (GLState::SupportsDSA()) {
+			glCreateVertexArrays(1, &m_vao);
+			return;
+		}
+
 		glGenVertexArrays(1, &m_vao);
-		glBindVertexArray(m_vao);
+		GLState::BindVertexArray(m_vao);
 	}
 
-	VertexBuffer::~VertexBuffer() 
+	VertexBuffer::~VertexBuffer()
 	{
-		if(m_ibo) glDeleteBuffers(1, &m_ibo);
-		if(m_vbo) glDeleteBuffers(1, &m_vbo);
-		if (m_vao) glDeleteVertexArrays(1, &m_vao);
+		DestroyStreamBuffer();
+
+		if (m_gpuBytes) GPUMemory::Untrack(GPUMemory::Type::Geometry, m_gpuBytes);
+		if (m_instanceBytes) GPUMemory::Untrack(GPUMemory::Type::Buffer, m_instanceBytes);
+
+		// arena-backed buffers free their range back to the shared page -
+		// page names live on, so their cached VAO attachments stay valid.
+		// Owned buffer names can be reused by GL and must invalidate
+		if (m_skinAllocation.buffer) BufferArena::Free(m_skinAllocation);
+		else if (m_skinVbo) {
+			InvalidateSharedBuffer(m_skinVbo);
+			glDeleteBuffers(1, &m_skinVbo);
+		}
+
+		if (m_instanceVbo) {
+			InvalidateSharedBuffer(m_instanceVbo);
+			glDeleteBuffers(1, &m_instanceVbo);
+		}
+
+		if (m_indexAllocation.buffer) BufferArena::Free(m_indexAllocation);
+		else if (m_ibo) {
+			InvalidateSharedBuffer(m_ibo);
+			glDeleteBuffers(1, &m_ibo);
+		}
+
+		if (m_vertexAllocation.buffer) BufferArena::Free(m_vertexAllocation);
+		else if (m_vbo) {
+			InvalidateSharedBuffer(m_vbo);
+			glDeleteBuffers(1, &m_vbo);
+		}
+		if (m_vao) {
+			GLState::InvalidateVertexArray(m_vao);
+			glDeleteVertexArrays(1, &m_vao);
+		}
 	}
 	void VertexBuffer::Draw(GLenum primitiveType)
 	{
-		glBindVertexArray(m_vao);
+		BindForDraw();
 
 		if (m_ibo) {
-			glDrawElements(primitiveType, m_indexCount, m_indexType, 0);
+			glDrawElements(primitiveType, m_indexCount, m_indexType, (void*)m_indexAllocation.offset);
+			FrameStats::AddDraw(FrameStats::TriangleCount(primitiveType, m_indexCount));
 		}
 		else if (m_vbo) {
 			glDrawArrays(primitiveType, 0, m_vertexCount);
+			FrameStats::AddDraw(FrameStats::TriangleCount(primitiveType, m_vertexCount));
+		}
+	}
+
+	void VertexBuffer::DrawInstanced(GLsizei instanceCount, GLenum primitiveType)
+	{
+		BindForDraw();
+
+		if (m_ibo) {
+			glDrawElementsInstanced(primitiveType, m_indexCount, m_indexType, (void*)m_indexAllocation.offset, instanceCount);
+			FrameStats::AddDraw(FrameStats::TriangleCount(primitiveType, m_indexCount) * instanceCount);
+		}
+		else if (m_vbo) {
+			glDrawArraysInstanced(primitiveType, 0, m_vertexCount, instanceCount);
+			FrameStats::AddDraw(FrameStats::TriangleCount(primitiveType, m_vertexCount) * instanceCount);
+		}
+	}
+
+	void VertexBuffer::DrawWarmup()
+	{
+		BindForDraw();
+
+		// no FrameStats - warmup runs on the load path, not in a frame
+		if (m_ibo) {
+			glDrawElements(GL_TRIANGLES, (GLsizei)math::min(3u, m_indexCount), m_indexType, (void*)m_indexAllocation.offset);
+		}
+		else if (m_vbo) {
+			glDrawArrays(GL_TRIANGLES, 0, (GLsizei)math::min(3u, m_vertexCount));
 		}
 	}
 
+	uint64_t VertexBuffer::GetFormatKey() const
+	{
+		uint64_t key = 14695981039346656037ull;
+		auto mix = [&key](uint64_t value) {
+			key ^= value;
+			key *= 1099511628211ull;
+		};
+
+		for (auto& attribute : m_attributes) {
+			mix((uint64_t)attribute.index);
+			mix((uint64_t)attribute.size);
+			mix((uint64_t)attribute.type);
+			mix((uint64_t)attribute.normalized);
+			mix((uint64_t)attribute.stride);
+			mix((uint64_t)attribute.offset);
+			mix((uint64_t)attribute.divisor);
+		}
+		return key;
+	}
+
 	void VertexBuffer::CreateVertexBuffer(GLsizei size, GLsizei count, GLvoid* data)
 	{
 		m_vertexCount = count;
+
+		if (GLState::SupportsDSA()) {
+			// static mesh data packs into shared arena pages - the vertex
+			// binding's byte offset points draws at this mesh's range
+			m_vertexAllocation = BufferArena::Allocate(size, data);
+			if (m_vertexAllocation.buffer) {
+				m_vbo = m_vertexAllocation.buffer;
+				m_attributeBuffer = m_vbo;
+				m_attributeBase = (GLuint)m_vertexAllocation.offset;
+				return;
+			}
+
+			glCreateBuffers(1, &m_vbo);
+			glNamedBufferData(m_vbo, size, data, GL_STATIC_DRAW);
+			m_gpuBytes += size;
+			GPUMemory::Track(GPUMemory::Type::Geometry, size);
+			m_attributeBuffer = m_vbo;
+			m_attributeBase = 0;
+			return;
+		}
+
 		glGenBuffers(1, &m_vbo);
 
 		glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
 		glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
+		m_gpuBytes += size;
+		GPUMemory::Track(GPUMemory::Type::Geometry, size);
 	}
 
 	void VertexBuffer::CreateIndexBuffer(GLenum indexType, GLsizei count, GLvoid* data)
 	{
 		m_indexType = indexType;
 		m_indexCount = count;
-		glGenBuffers(1, &m_ibo);
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ibo);
 		GLsizei size = 0;
 		switch (indexType)
 		{
@@ -56,14 +201,314 @@ namespace neu {
 			break;
 		}
 
+		if (GLState::SupportsDSA()) {
+			// indices pack into the arena too - draws pass the byte offset
+			// where they passed zero, every mesh sharing one element buffer
+			m_indexAllocation = BufferArena::Allocate(size, data);
+			if (m_indexAllocation.buffer) {
+				m_ibo = m_indexAllocation.buffer;
+				glVertexArrayElementBuffer(m_vao, m_ibo);
+				return;
+			}
+
+			glCreateBuffers(1, &m_ibo);
+			glNamedBufferData(m_ibo, size, data, GL_STATIC_DRAW);
+			m_gpuBytes += size;
+			GPUMemory::Track(GPUMemory::Type::Geometry, size);
+			glVertexArrayElementBuffer(m_vao, m_ibo);
+			return;
+		}
+
+		glGenBuffers(1, &m_ibo);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ibo);
 		glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
+		m_gpuBytes += size;
+		GPUMemory::Track(GPUMemory::Type::Geometry, size);
 
 	}
 
-	void VertexBuffer::SetAttribute(int index, GLint size, GLsizei stride, GLuint offset)
+	void VertexBuffer::CreateInstanceBuffer(GLsizei size, GLsizei count, const GLvoid* data)
 	{
-		glEnableVertexAttribArray(index);
-		glVertexAttribPointer(index, size, GL_FLOAT, GL_FALSE, stride, (void*)offset);
+		m_instanceCount = count;
+		FrameStats::AddUpload(size);
+
+		// orphaning respecifies the store to exactly this size
+		GPUMemory::Untrack(GPUMemory::Type::Buffer, m_instanceBytes);
+		GPUMemory::Track(GPUMemory::Type::Buffer, size);
+		m_instanceBytes = size;
+
+		if (GLState::SupportsDSA()) {
+			if (!m_instanceVbo) glCreateBuffers(1, &m_instanceVbo);
+			// orphan and refill, instance batches change every frame
+			glNamedBufferData(m_instanceVbo, size, data, GL_DYNAMIC_DRAW);
+			m_attributeBuffer = m_instanceVbo;
+			m_attributeBase = 0;
+			return;
+		}
+
+		GLState::BindVertexArray(m_vao);
+
+		if (!m_instanceVbo) glGenBuffers(1, &m_instanceVbo);
+		glBindBuffer(GL_ARRAY_BUFFER, m_instanceVbo);
+		// orphan and refill, instance batches change every frame
+		glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+	}
 
+	void VertexBuffer::CreateSkinBuffer(GLsizei size, const GLvoid* data)
+	{
+		if (GLState::SupportsDSA()) {
+			m_skinAllocation = BufferArena::Allocate(size, data);
+			if (m_skinAllocation.buffer) {
+				m_skinVbo = m_skinAllocation.buffer;
+				m_attributeBuffer = m_skinVbo;
+				m_attributeBase = (GLuint)m_skinAllocation.offset;
+				return;
+			}
+
+			glCreateBuffers(1, &m_skinVbo);
+			glNamedBufferData(m_skinVbo, size, data, GL_STATIC_DRAW);
+			m_gpuBytes += size;
+			GPUMemory::Track(GPUMemory::Type::Geometry, size);
+			m_attributeBuffer = m_skinVbo;
+			m_attributeBase = 0;
+			return;
+		}
+
+		glGenBuffers(1, &m_skinVbo);
+
+		glBindBuffer(GL_ARRAY_BUFFER, m_skinVbo);
+		glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
+		m_gpuBytes += size;
+		GPUMemory::Track(GPUMemory::Type::Geometry, size);
+	}
+
+	void VertexBuffer::UpdateDynamic(GLsizei size, GLsizei count, const GLvoid* data)
+	{
+		bool dsa = GLState::SupportsDSA();
+		if (!dsa) GLState::BindVertexArray(m_vao);
+
+		// (re)create the stream storage on first use or growth - immutable
+		// persistent storage can't be resized, so growth replaces it (the
+		// driver keeps the old buffer alive for any in-flight draws)
+		if (size > m_streamCapacity) {
+			DestroyStreamBuffer();
+
+			m_streamCapacity = std::max((GLsizeiptr)size, m_streamCapacity * 2);
+
+			GLbitfield mapFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			if (dsa) {
+				glCreateBuffers(1, &m_streamVbo);
+				glNamedBufferStorage(m_streamVbo, kStreamRegions * m_streamCapacity, nullptr, mapFlags);
+				m_streamMap = (uint8_t*)glMapNamedBufferRange(m_streamVbo, 0, kStreamRegions * m_streamCapacity, mapFlags);
+			}
+			else {
+				glGenBuffers(1, &m_streamVbo);
+				glBindBuffer(GL_ARRAY_BUFFER, m_streamVbo);
+
+				glBufferStorage(GL_ARRAY_BUFFER, kStreamRegions * m_streamCapacity, nullptr, mapFlags);
+				m_streamMap = (uint8_t*)glMapBufferRange(GL_ARRAY_BUFFER, 0, kStreamRegions * m_streamCapacity, mapFlags);
+			}
+			GPUMemory::Track(GPUMemory::Type::Buffer, kStreamRegions * m_streamCapacity);
+			m_attributeBuffer = m_streamVbo;
+			m_attributeBase = 0;
+		}
+		else {
+			// fence the region the draws issued since the last update read
+			// from, then advance - waiting here only happens if the GPU is
+			// more than kStreamRegions frames behind
+			if (m_streamFences[m_streamRegion]) glDeleteSync(m_streamFences[m_streamRegion]);
+			m_streamFences[m_streamRegion] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+			m_streamRegion = (m_streamRegion + 1) % kStreamRegions;
+			if (m_streamFences[m_streamRegion]) {
+				glClientWaitSync(m_streamFences[m_streamRegion], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull);
+				glDeleteSync(m_streamFences[m_streamRegion]);
+				m_streamFences[m_streamRegion] = nullptr;
+			}
+		}
+
+		// coherent mapping - the write is visible to the draw without an
+		// explicit flush or driver copy
+		GLsizeiptr regionBase = m_streamRegion * m_streamCapacity;
+		std::memcpy(m_streamMap + regionBase, data, size);
+		m_vertexCount = count;
+		FrameStats::AddUpload(size);
+
+		// re-point the recorded layout at the active region
+		if (dsa) {
+			// DSA keeps format and buffer separate, so the repoint is one
+			// binding offset update per attribute - no attribute respecify.
+			// instance attributes (divisor 1) live in their own buffer
+			for (auto& attribute : m_attributes) {
+				if (attribute.divisor) continue;
+				glVertexArrayVertexBuffer(m_vao, attribute.index, m_streamVbo, regionBase + attribute.offset, attribute.stride);
+			}
+			return;
+		}
+
+		glBindBuffer(GL_ARRAY_BUFFER, m_streamVbo);
+		for (auto& attribute : m_attributes) {
+			if (attribute.divisor) continue;
+			glEnableVertexAttribArray(attribute.index);
+			glVertexAttribPointer(attribute.index, attribute.size, attribute.type, attribute.normalized, attribute.stride, (void*)(size_t)(regionBase + attribute.offset));
+		}
+	}
+
+	void VertexBuffer::DestroyStreamBuffer()
+	{
+		for (auto& fence : m_streamFences) {
+			if (fence) {
+				glDeleteSync(fence);
+				fence = nullptr;
+			}
+		}
+		if (m_streamVbo) {
+			GPUMemory::Untrack(GPUMemory::Type::Buffer, kStreamRegions * m_streamCapacity);
+			if (GLState::SupportsDSA()) {
+				glUnmapNamedBuffer(m_streamVbo);
+			}
+			else {
+				glBindBuffer(GL_ARRAY_BUFFER, m_streamVbo);
+				glUnmapBuffer(GL_ARRAY_BUFFER);
+			}
+			glDeleteBuffers(1, &m_streamVbo);
+			m_streamVbo = 0;
+			m_streamMap = nullptr;
+		}
+		m_streamRegion = 0;
+	}
+
+	void VertexBuffer::SetAttribute(int index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, GLuint offset)
+	{
+		if (GLState::SupportsDSA()) {
+			// separate format and binding, one binding slot per attribute -
+			// the buffer is whichever Create*/UpdateDynamic ran last, same
+			// implicit pairing the bind-to-edit path gets from GL_ARRAY_BUFFER
+			glEnableVertexArrayAttrib(m_vao, index);
+			glVertexArrayVertexBuffer(m_vao, index, m_attributeBuffer, m_attributeBase + offset, stride);
+			glVertexArrayAttribFormat(m_vao, index, size, type, normalized, 0);
+			glVertexArrayAttribBinding(m_vao, index, index);
+		}
+		else {
+			glEnableVertexAttribArray(index);
+			glVertexAttribPointer(index, size, type, normalized, stride, (void*)offset);
+		}
+
+		// record the layout so UpdateDynamic can re-point it per region and
+		// the shared-VAO path knows which buffer each binding attaches
+		m_formatDirty = true;
+		for (auto& attribute : m_attributes) {
+			if (attribute.index == index) {
+				attribute = { index, size, type, normalized, stride, offset, m_attributeBuffer, m_attributeBase, 0 };
+				return;
+			}
+		}
+		m_attributes.push_back({ index, size, type, normalized, stride, offset, m_attributeBuffer, m_attributeBase, 0 });
+	}
+
+	void VertexBuffer::SetInstanceAttribute(int index, GLint size, GLsizei stride, GLuint offset)
+	{
+		if (GLState::SupportsDSA()) {
+			glEnableVertexArrayAttrib(m_vao, index);
+			glVertexArrayVertexBuffer(m_vao, index, m_instanceVbo, offset, stride);
+			glVertexArrayAttribFormat(m_vao, index, size, GL_FLOAT, GL_FALSE, 0);
+			glVertexArrayAttribBinding(m_vao, index, index);
+			// advance the attribute once per instance instead of once per vertex
+			glVertexArrayBindingDivisor(m_vao, index, 1);
+		}
+		else {
+			glEnableVertexAttribArray(index);
+			glVertexAttribPointer(index, size, GL_FLOAT, GL_FALSE, stride, (void*)offset);
+			// advance the attribute once per instance instead of once per vertex
+			glVertexAttribDivisor(index, 1);
+		}
+
+		// divisor 1 keeps UpdateDynamic from re-pointing this at the stream
+		m_formatDirty = true;
+		for (auto& attribute : m_attributes) {
+			if (attribute.index == index) {
+				attribute = { index, size, GL_FLOAT, GL_FALSE, stride, offset, m_instanceVbo, 0, 1 };
+				return;
+			}
+		}
+		m_attributes.push_back({ index, size, GL_FLOAT, GL_FALSE, stride, offset, m_instanceVbo, 0, 1 });
+	}
+
+	void VertexBuffer::BindForDraw()
+	{
+		// streaming meshes re-point offsets per region and the bind-to-edit
+		// path has no separate format state - both keep the private VAO
+		if (!GLState::SupportsDSA() || m_streamVbo || m_attributes.empty()) {
+			GLState::BindVertexArray(m_vao);
+			return;
+		}
+
+		if (m_formatDirty) {
+			m_formatDirty = false;
+			m_sharedFormat = nullptr;
+
+			// FNV-1a over the layout - everything but the buffer names, so
+			// meshes sharing a format land on one VAO
+			uint64_t key = 14695981039346656037ull;
+			auto mix = [&key](uint64_t value) {
+				key ^= value;
+				key *= 1099511628211ull;
+			};
+
+			bool shareable = true;
+			for (auto& attribute : m_attributes) {
+				if (attribute.index >= SharedVertexFormat::kMaxBindings) {
+					shareable = false;
+					break;
+				}
+				mix((uint64_t)attribute.index);
+				mix((uint64_t)attribute.size);
+				mix((uint64_t)attribute.type);
+				mix((uint64_t)attribute.normalized);
+				mix((uint64_t)attribute.stride);
+				mix((uint64_t)attribute.offset);
+				mix((uint64_t)attribute.divisor);
+			}
+
+			if (shareable) {
+				auto& entry = sharedFormats[key];
+				if (!entry) {
+					entry = std::make_unique<SharedVertexFormat>();
+					glCreateVertexArrays(1, &entry->vao);
+					GLDebug::Label(GL_VERTEX_ARRAY, entry->vao, std::format("shared format {:x}", key));
+
+					for (auto& attribute : m_attributes) {
+						glEnableVertexArrayAttrib(entry->vao, attribute.index);
+						glVertexArrayAttribFormat(entry->vao, attribute.index, attribute.size, attribute.type, attribute.normalized, 0);
+						glVertexArrayAttribBinding(entry->vao, attribute.index, attribute.index);
+						if (attribute.divisor) glVertexArrayBindingDivisor(entry->vao, attribute.index, attribute.divisor);
+					}
+				}
+				m_sharedFormat = entry.get();
+			}
+		}
+
+		if (!m_sharedFormat) {
+			GLState::BindVertexArray(m_vao);
+			return;
+		}
+
+		// same-format draws reuse the bound VAO and only re-attach buffers
+		// the previous draw didn't leave in place
+		SharedVertexFormat& shared = *m_sharedFormat;
+		GLState::BindVertexArray(shared.vao);
+
+		for (auto& attribute : m_attributes) {
+			auto& binding = shared.bindings[attribute.index];
+			GLuint bufferOffset = attribute.base + attribute.offset;
+			if (binding.buffer != attribute.buffer || binding.offset != bufferOffset) {
+				glVertexArrayVertexBuffer(shared.vao, attribute.index, attribute.buffer, bufferOffset, attribute.stride);
+				binding = { attribute.buffer, bufferOffset };
+			}
+		}
+		if (shared.ibo != m_ibo) {
+			glVertexArrayElementBuffer(shared.vao, m_ibo);
+			shared.ibo = m_ibo;
+		}
 	}
 }
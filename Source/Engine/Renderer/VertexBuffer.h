@@ -1,10 +1,18 @@
 #pragma once
 #include "Resources/Resource.h"
+#include "BufferArena.h"
+#include "GLState.h"
+#include "GLDebug.h"
 #include <glad/glad.h>
 #include <vector>
 
 namespace neu
 {
+	// one VAO shared by every mesh with an identical attribute layout -
+	// declared in VertexBuffer.cpp, meshes cache a pointer after the first
+	// format lookup
+	struct SharedVertexFormat;
+
 	class VertexBuffer : public Resource
 	{
 	public:
@@ -12,12 +20,58 @@ namespace neu
 		virtual ~VertexBuffer();
 
 		void Draw(GLenum primitiveType = GL_TRIANGLES);
-		void Bind() { glBindVertexArray(m_vao); }
+		void DrawInstanced(GLsizei instanceCount, GLenum primitiveType = GL_TRIANGLES);
+
+		// draws the first triangle only - the scene warmup uses it to force
+		// driver pipeline specialization of a program/vertex-format pair
+		// without shading real work (see Scene::WarmupDraws)
+		void DrawWarmup();
+
+		// FNV-1a over the attribute layout, buffer names excluded - meshes
+		// sharing a vertex format share a key (same fields BindForDraw hashes)
+		uint64_t GetFormatKey() const;
+		void Bind() { GLState::BindVertexArray(m_vao); }
 
 		void CreateVertexBuffer(GLsizei size, GLsizei count, GLvoid* data);
 		void CreateIndexBuffer(GLenum indexType, GLsizei count, GLvoid* data);
 
-		void SetAttribute(int index, GLint size, GLsizei stride, GLuint offset);
+		// per-instance attribute stream, re-uploaded each frame for dynamic batches
+		void CreateInstanceBuffer(GLsizei size, GLsizei count, const GLvoid* data);
+
+		// second static vertex stream (skin joints/weights ride here so the
+		// rigid vertex layout stays untouched) - following SetAttribute
+		// calls attach to it, like the other Create* methods
+		void CreateSkinBuffer(GLsizei size, const GLvoid* data);
+
+		// per-frame vertex data without driver stalls: writes land in a
+		// triple-buffered persistently-mapped store (fence-guarded regions),
+		// replacing the delete/recreate path dynamic users needed before.
+		// call SetAttribute after the first update to declare the layout -
+		// later updates re-point the attributes at the active region
+		void UpdateDynamic(GLsizei size, GLsizei count, const GLvoid* data);
+
+		// float attributes and, through the typed overload, packed formats
+		// (normalized snorm 10:10:10:2, half floats) that the fetch expands
+		// to the floats the shader declares
+		void SetAttribute(int index, GLint size, GLsizei stride, GLuint offset) { SetAttribute(index, size, GL_FLOAT, GL_FALSE, stride, offset); }
+		void SetAttribute(int index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, GLuint offset);
+		void SetInstanceAttribute(int index, GLint size, GLsizei stride, GLuint offset);
+
+		// raw buffer access for GPU-side merging (StaticBatcher copies
+		// geometry into shared buffers with glCopyBufferSubData) - arena-
+		// packed meshes share page objects, so copies start at the byte
+		// offsets rather than zero
+		GLuint GetVBO() const { return m_vbo; }
+		GLuint GetIBO() const { return m_ibo; }
+		size_t GetVertexByteOffset() const { return m_vertexAllocation.offset; }
+		size_t GetIndexByteOffset() const { return m_indexAllocation.offset; }
+		GLuint GetVertexCount() const { return m_vertexCount; }
+		GLuint GetIndexCount() const { return m_indexCount; }
+		GLenum GetIndexType() const { return m_indexType; }
+
+		// names the vertex array in GPU capture tools - callers label with
+		// the file (and mesh) the geometry came from
+		void SetLabel(const std::string& label) { GLDebug::Label(GL_VERTEX_ARRAY, m_vao, label); }
 
 		void UpdateGUI() override {};
 
@@ -33,5 +87,73 @@ namespace neu
 		GLuint m_ibo = 0;   // index buffer object
 		GLuint m_indexCount = 0; // number of indices index buffer
 		GLenum m_indexType = 0;  // data type of index
+
+		// instance buffer
+		GLuint m_instanceVbo = 0;   // per-instance attribute buffer object
+		GLuint m_instanceCount = 0; // number of instances in instance buffer
+
+		// skin buffer (second vertex stream)
+		GLuint m_skinVbo = 0;
+
+		// GPU bytes accounted for own (non-arena) static buffers, and the
+		// instance buffer's current size - arena allocations are accounted
+		// at the page level, the stream store at (re)creation
+		size_t m_gpuBytes = 0;
+		GLsizei m_instanceBytes = 0;
+
+		// arena sub-allocations backing the static buffers - when the
+		// buffer member names a shared page, the matching allocation holds
+		// the byte offset and the destructor frees the range, not the page
+		BufferArena::Allocation m_vertexAllocation;
+		BufferArena::Allocation m_indexAllocation;
+		BufferArena::Allocation m_skinAllocation;
+
+		// streaming buffer (UpdateDynamic) - persistently-mapped storage
+		// split into regions cycled per update, each guarded by a fence so
+		// the CPU never writes memory the GPU is still reading
+		static constexpr int kStreamRegions = 3;
+
+		GLuint m_streamVbo = 0;
+		GLsizeiptr m_streamCapacity = 0;    // bytes per region
+		uint8_t* m_streamMap = nullptr;     // persistent map, kStreamRegions regions
+		int m_streamRegion = 0;
+		GLsync m_streamFences[kStreamRegions]{};
+
+		// buffer the next SetAttribute attaches on the DSA path - the last
+		// one a Create*/UpdateDynamic call produced, mirroring the implicit
+		// GL_ARRAY_BUFFER pairing of the bind-to-edit path. The base is the
+		// buffer's byte offset within its arena page (0 for own buffers)
+		GLuint m_attributeBuffer = 0;
+		GLuint m_attributeBase = 0;
+
+		// vertex layout recorded by SetAttribute so UpdateDynamic can
+		// re-point the attributes at the active stream region and the
+		// shared-VAO path can attach the right buffer per binding
+		struct Attribute {
+			int index;
+			GLint size;
+			GLenum type;
+			GLboolean normalized;
+			GLsizei stride;
+			GLuint offset;
+			GLuint buffer;		// buffer the attribute was declared against
+			GLuint base;		// buffer's arena page offset, excluded from format hashing
+			GLuint divisor;		// 0 per-vertex, 1 per-instance
+		};
+		std::vector<Attribute> m_attributes;
+
+	private:
+		void DestroyStreamBuffer();
+
+		// binds the VAO the draw should use - on the DSA path static meshes
+		// share one VAO per distinct attribute format and only re-attach
+		// their buffers when the previous draw used different ones; streaming
+		// meshes and the non-DSA path keep the private per-mesh VAO
+		void BindForDraw();
+
+		// shared format resolved from m_attributes on first draw, dropped
+		// when the layout changes
+		SharedVertexFormat* m_sharedFormat = nullptr;
+		bool m_formatDirty = true;
 	};
 }
\ No newline at end of file
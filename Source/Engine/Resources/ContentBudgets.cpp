@@ -0,0 +1,123 @@
+#include "ContentBudgets.h"
+#include "Core/File.h"
+#include "Core/Json.h"
+#include "Core/Logger.h"
+#include "Math/Math.h"
+
+namespace neu {
+    namespace {
+        constexpr const char* kBudgetsFile = "budgets.json";
+    }
+
+    void ContentBudgets::EnsureLoaded() {
+        if (s_loaded) return;
+        s_loaded = true;
+
+        if (!file::Exists(kBudgetsFile)) return;
+
+        serial::document_t document;
+        if (!serial::Load(kBudgetsFile, document)) {
+            LOG_CAT_WARNING(Content, "Could not parse {} - content validation disabled", kBudgetsFile);
+            return;
+        }
+
+        SERIAL_READ_NAME(document, "maxTextureSize", s_limits.maxTextureSize);
+        SERIAL_READ_NAME(document, "maxUncompressedTextureSize", s_limits.maxUncompressedTextureSize);
+        SERIAL_READ_NAME(document, "maxTriangles", s_limits.maxTriangles);
+        SERIAL_READ_NAME(document, "maxBones", s_limits.maxBones);
+        SERIAL_READ_NAME(document, "maxMaterialMaps", s_limits.maxMaterialMaps);
+        SERIAL_READ_NAME(document, "maxSceneTextureMB", s_limits.maxSceneTextureMB);
+        SERIAL_READ_NAME(document, "maxSceneAudioMB", s_limits.maxSceneAudioMB);
+        SERIAL_READ_NAME(document, "maxSceneDraws", s_limits.maxSceneDraws);
+
+        s_enabled = true;
+        LOG_CAT_INFO(Content, "content budgets declared in {}", kBudgetsFile);
+    }
+
+    bool ContentBudgets::IsEnabled() {
+        EnsureLoaded();
+        return s_enabled;
+    }
+
+    const ContentBudgets::Limits& ContentBudgets::GetLimits() {
+        EnsureLoaded();
+        return s_limits;
+    }
+
+    bool ContentBudgets::CheckTexture(const std::string& filename, int width, int height, bool compressed) {
+        if (!IsEnabled()) return true;
+
+        bool withinBudget = true;
+        int largest = math::max(width, height);
+
+        if (s_limits.maxTextureSize && largest > s_limits.maxTextureSize) {
+            LOG_CAT_ERROR(Content, "{}: {}x{} exceeds the {} texture size budget", filename, width, height, s_limits.maxTextureSize);
+            withinBudget = false;
+        }
+
+        // block-compressed payloads already went through a cooker - the raw
+        // path is where oversized sources cost four times the memory
+        if (!compressed && s_limits.maxUncompressedTextureSize && largest > s_limits.maxUncompressedTextureSize) {
+            LOG_CAT_ERROR(Content, "{}: {}x{} uncompressed exceeds the {} budget - cook it to a compressed format", filename, width, height, s_limits.maxUncompressedTextureSize);
+            withinBudget = false;
+        }
+
+        return withinBudget;
+    }
+
+    bool ContentBudgets::CheckModel(const std::string& filename, size_t triangles, size_t bones) {
+        if (!IsEnabled()) return true;
+
+        bool withinBudget = true;
+
+        if (s_limits.maxTriangles && triangles > (size_t)s_limits.maxTriangles) {
+            LOG_CAT_ERROR(Content, "{}: {} triangles exceeds the {} triangle budget", filename, triangles, s_limits.maxTriangles);
+            withinBudget = false;
+        }
+
+        if (s_limits.maxBones && bones > (size_t)s_limits.maxBones) {
+            LOG_CAT_ERROR(Content, "{}: {} bones exceeds the {} bone budget", filename, bones, s_limits.maxBones);
+            withinBudget = false;
+        }
+
+        return withinBudget;
+    }
+
+    bool ContentBudgets::CheckMaterial(const std::string& filename, int mapCount) {
+        if (!IsEnabled()) return true;
+
+        if (s_limits.maxMaterialMaps && mapCount > s_limits.maxMaterialMaps) {
+            LOG_CAT_ERROR(Content, "{}: {} texture maps exceeds the {} map budget", filename, mapCount, s_limits.maxMaterialMaps);
+            return false;
+        }
+
+        return true;
+    }
+
+    void ContentBudgets::ReportScene(const std::string& name, size_t textureBytes, size_t audioBytes, size_t drawEstimate) {
+        if (!IsEnabled()) return;
+
+        size_t textureMB = textureBytes >> 20;
+        size_t audioMB = audioBytes >> 20;
+        bool withinBudget = true;
+
+        if (s_limits.maxSceneTextureMB && textureMB > (size_t)s_limits.maxSceneTextureMB) {
+            LOG_CAT_ERROR(Content, "{}: {} MB of referenced textures exceeds the {} MB scene budget", name, textureMB, s_limits.maxSceneTextureMB);
+            withinBudget = false;
+        }
+
+        if (s_limits.maxSceneAudioMB && audioMB > (size_t)s_limits.maxSceneAudioMB) {
+            LOG_CAT_ERROR(Content, "{}: {} MB of referenced audio exceeds the {} MB scene budget - categorize clips in their .meta so the cook can transcode them", name, audioMB, s_limits.maxSceneAudioMB);
+            withinBudget = false;
+        }
+
+        if (s_limits.maxSceneDraws && drawEstimate > (size_t)s_limits.maxSceneDraws) {
+            LOG_CAT_ERROR(Content, "{}: ~{} draws exceeds the {} draw scene budget", name, drawEstimate, s_limits.maxSceneDraws);
+            withinBudget = false;
+        }
+
+        if (withinBudget) {
+            LOG_CAT_INFO(Content, "{}: {} MB textures, {} MB audio, ~{} draws - within budget", name, textureMB, audioMB, drawEstimate);
+        }
+    }
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include <string>
+#include <cstddef>
+
+namespace neu {
+    /// <summary>
+    /// Cook-time content validation against declared performance budgets.
+    ///
+    /// Budgets live in an optional budgets.json next to the executable - a
+    /// project that declares none gets no validation and no behavior
+    /// change. With budgets declared, the cook paths (model import,
+    /// texture load, material load) call the Check* functions and fail the
+    /// cook with a clear error naming the asset, the measured value and
+    /// the limit, so an 8k uncompressed source or a few-million-triangle
+    /// prop is caught the day it lands instead of weeks later in a frame
+    /// capture. Scene loads additionally report their aggregates
+    /// (referenced texture bytes, audio clip bytes, draw estimate)
+    /// against per-scene limits.
+    ///
+    /// All limits are optional; 0 (or absent) means unlimited:
+    ///   {
+    ///     "maxTextureSize": 4096,
+    ///     "maxUncompressedTextureSize": 1024,
+    ///     "maxTriangles": 250000,
+    ///     "maxBones": 128,
+    ///     "maxMaterialMaps": 5,
+    ///     "maxSceneTextureMB": 1024,
+    ///     "maxSceneAudioMB": 64,
+    ///     "maxSceneDraws": 4096
+    ///   }
+    /// </summary>
+    class ContentBudgets {
+    public:
+        struct Limits {
+            int maxTextureSize{ 0 };              // largest dimension, any texture
+            int maxUncompressedTextureSize{ 0 };  // largest dimension on the raw SDL_image path
+            int maxTriangles{ 0 };                // LOD 0 triangles per model
+            int maxBones{ 0 };                    // skeleton joints per model
+            int maxMaterialMaps{ 0 };             // texture maps one material declares
+            int maxSceneTextureMB{ 0 };           // referenced texture bytes per scene
+            int maxSceneAudioMB{ 0 };             // referenced audio clip bytes per scene
+            int maxSceneDraws{ 0 };               // submesh draw estimate per scene
+        };
+
+        /// <summary>
+        /// True when a budgets file was found and parsed - callers can skip
+        /// gathering measurements entirely when nothing is declared.
+        /// </summary>
+        static bool IsEnabled();
+
+        static const Limits& GetLimits();
+
+        /// <summary>
+        /// Validates a texture's dimensions at its cook/load point. The
+        /// uncompressed limit applies to sources the SDL_image development
+        /// path uploads raw - the usual way an oversized PNG slips in.
+        /// </summary>
+        /// <param name="filename">Asset name for the report</param>
+        /// <param name="width">Mip 0 width</param>
+        /// <param name="height">Mip 0 height</param>
+        /// <param name="compressed">True for cooked block-compressed payloads</param>
+        /// <returns>True within budget; false fails the load/cook</returns>
+        static bool CheckTexture(const std::string& filename, int width, int height, bool compressed);
+
+        /// <summary>
+        /// Validates an imported model before its cooked file is written.
+        /// </summary>
+        /// <param name="filename">Asset name for the report</param>
+        /// <param name="triangles">LOD 0 triangle count across submeshes</param>
+        /// <param name="bones">Skeleton joint count</param>
+        /// <returns>True within budget; false fails the cook</returns>
+        static bool CheckModel(const std::string& filename, size_t triangles, size_t bones);
+
+        /// <summary>
+        /// Validates the number of texture maps a material declares.
+        /// </summary>
+        /// <param name="filename">Asset name for the report</param>
+        /// <param name="mapCount">Present map count (variant bit count)</param>
+        /// <returns>True within budget; false fails the load</returns>
+        static bool CheckMaterial(const std::string& filename, int mapCount);
+
+        /// <summary>
+        /// Reports a loaded scene's aggregates against the per-scene
+        /// limits. Violations log as errors; a scene is never unloaded
+        /// over budget - the report is the deliverable.
+        /// </summary>
+        /// <param name="name">Scene name for the report</param>
+        /// <param name="textureBytes">Bytes across distinct referenced textures</param>
+        /// <param name="audioBytes">Resident bytes across distinct referenced audio clips</param>
+        /// <param name="drawEstimate">Submesh draws across the scene's renderers</param>
+        static void ReportScene(const std::string& name, size_t textureBytes, size_t audioBytes, size_t drawEstimate);
+
+    private:
+        // parses budgets.json on first use; absent file leaves validation off
+        static void EnsureLoaded();
+
+        inline static bool s_loaded{ false };
+        inline static bool s_enabled{ false };
+        inline static Limits s_limits;
+    };
+}
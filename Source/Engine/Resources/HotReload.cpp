@@ -0,0 +1,112 @@
+#include "EnginePCH.h"
+#include "HotReload.h"
+#include "Renderer/Shader.h"
+#include "Renderer/Program.h"
+
+namespace neu {
+    void HotReload::Update(float dt) {
+        if (!m_enabled) return;
+
+        m_timer += dt;
+        if (m_timer < m_interval) return;
+        m_timer = 0;
+
+        PROFILE_SCOPE("HotReload::Update");
+
+        std::vector<std::string> reloadedShaders;
+
+        // shaders first, through their recorded dependency lists: the
+        // compile depends on the source file plus its includes, and variant
+        // shaders cache under a decorated id that isn't a file at all - so
+        // stat the dependencies, collect edits once (the stamps are
+        // shared), then recompile every shader pulling a changed file in
+        auto shaders = Resources().GetByType<Shader>();
+        std::unordered_set<std::string> changedFiles;
+        for (Shader* shader : shaders) {
+            for (const std::string& include : shader->GetDependencies()) {
+                if (changedFiles.contains(include)) continue;
+
+                uint64_t modified = file::GetModifiedTime(include);
+                if (modified == 0) continue;
+
+                uint64_t& stamp = m_modifiedTimes[include];
+                if (stamp == 0) {
+                    stamp = modified;
+                    continue;
+                }
+                if (stamp == modified) continue;
+                stamp = modified;
+                changedFiles.insert(include);
+            }
+        }
+        if (!changedFiles.empty()) {
+            for (Shader* shader : shaders) {
+                bool stale = false;
+                for (const std::string& include : shader->GetDependencies()) {
+                    if (changedFiles.contains(include)) {
+                        stale = true;
+                        break;
+                    }
+                }
+                if (!stale || !shader->Reload(shader->name)) continue;
+
+                LOG_CAT_INFO(Resources, "Hot reloaded: {}", shader->name);
+                m_reloadCount++;
+                EVENT_NOTIFY_DATA(asset_reloaded, shader->name);
+
+                // relink matching below compares source file names, which
+                // for variant shaders differ from the resource id
+                reloadedShaders.push_back(shader->GetFilename());
+            }
+        }
+
+        // stat every other cached resource's source file against the
+        // recorded modification time - the resource id is the load path for
+        // every file-backed type, and types without a Reload override just
+        // get their stamps tracked. Shaders are skipped here; the
+        // dependency sweep above covers them
+        for (Resource* resource : Resources().GetByType<Resource>()) {
+            if (dynamic_cast<Shader*>(resource)) continue;
+
+            const std::string& filename = resource->name;
+            if (filename.empty()) continue;
+
+            uint64_t modified = file::GetModifiedTime(filename);
+            if (modified == 0) continue;    // packed or generated - nothing to watch
+
+            uint64_t& stamp = m_modifiedTimes[filename];
+            if (stamp == 0) {
+                // first sight - record the baseline without reloading
+                stamp = modified;
+                continue;
+            }
+            if (stamp == modified) continue;
+            stamp = modified;
+
+            // not reloadable, or the reload failed and kept the old contents
+            if (!resource->Reload(filename)) continue;
+
+            LOG_CAT_INFO(Resources, "Hot reloaded: {}", filename);
+            m_reloadCount++;
+            EVENT_NOTIFY_DATA(asset_reloaded, filename);
+        }
+
+        if (reloadedShaders.empty()) return;
+
+        // a recompiled shader invalidates every program linking it - relink
+        // them against the fresh shader objects. The GL program names are
+        // unchanged, so material references stay valid
+        for (Program* program : Resources().GetByType<Program>()) {
+            for (const std::string& shaderName : reloadedShaders) {
+                if (!program->UsesShader(shaderName)) continue;
+
+                if (program->Relink()) {
+                    LOG_CAT_INFO(Resources, "Relinked program: {}", program->name);
+                    m_reloadCount++;
+                    EVENT_NOTIFY_DATA(asset_reloaded, program->name);
+                }
+                break;
+            }
+        }
+    }
+}
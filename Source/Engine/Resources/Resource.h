@@ -24,7 +24,34 @@ namespace neu {
         /// </summary>
         virtual ~Resource() = default;
 
+        /// <summary>
+        /// Approximate bytes this resource keeps resident (CPU and/or GPU).
+        /// Implemented by resource types with measurable payloads (Texture,
+        /// Model, AudioClip) so ResourceManager can account memory against a
+        /// budget. Resources reporting 0 are not counted and never evicted
+        /// by the budget pass.
+        /// </summary>
+        /// <returns>Resident size in bytes, or 0 if not tracked</returns>
+        virtual size_t GetMemorySize() const { return 0; }
+
+        /// <summary>
+        /// Reloads the resource in place from its (changed) source file.
+        /// Implemented by hot-reloadable types (Shader, Program, Texture,
+        /// Model, Material) so every res_t held anywhere in the engine picks
+        /// up the new contents without re-fetching. The default says "not
+        /// reloadable" and the hot-reload watcher skips the type.
+        /// </summary>
+        /// <param name="filename">The source file to reload from</param>
+        /// <returns>True if the resource reloaded; false if unsupported or reload failed</returns>
+        virtual bool Reload(const std::string& filename) { return false; }
+
         std::string name;
+
+        /// <summary>
+        /// Monotonic use stamp set by ResourceManager on each Get. Orders
+        /// least-recently-used eviction when the cache exceeds its budget.
+        /// </summary>
+        uint64_t lastUsed{ 0 };
     };
 
     /// <summary>
@@ -0,0 +1,280 @@
+#include "ResourceManager.h"
+#include "Core/Profiler.h"
+#include "Renderer/Texture.h"
+#include "Renderer/Program.h"
+#include "Renderer/Material.h"
+#include "Renderer/Model.h"
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+
+namespace neu {
+    std::shared_ptr<const serial::document_t> ResourceManager::GetDocument(const std::string& name) {
+        uint64_t key = HashId(name);
+        uint64_t modifiedTime = file::GetModifiedTime(name);
+
+        {
+            std::lock_guard lock(m_documentMutex);
+            auto iter = m_documents.find(key);
+            if (iter != m_documents.end() && iter->second.modifiedTime == modifiedTime) {
+                return iter->second.document;
+            }
+        }
+
+        // parse outside the lock - workers and the main thread may be
+        // loading different documents at the same time
+        auto document = std::make_shared<serial::document_t>();
+        if (!serial::Load(name, *document)) {
+            return nullptr;
+        }
+
+        std::lock_guard lock(m_documentMutex);
+        CachedDocument& entry = m_documents[key];
+        entry.document = document;
+        entry.modifiedTime = modifiedTime;
+        return entry.document;
+    }
+
+    void ResourceManager::QueueWork(std::function<void()> prefetch, std::function<void()> finalize) {
+        auto request = std::make_shared<AsyncRequest>();
+        request->prefetch = std::move(prefetch);
+        request->finalize = std::move(finalize);
+
+        {
+            std::lock_guard lock(m_queueMutex);
+            m_prefetchQueue.push_back(request);
+        }
+        m_queueCondition.notify_one();
+    }
+
+    void ResourceManager::QueueDependency(const std::string& name, std::function<void()> prefetch) {
+        // outside a worker prefetch there is no tree to join - do the work here
+        auto root = t_workerRoot;
+        if (!root) {
+            prefetch();
+            return;
+        }
+
+        // one fetch per name per tree - a map shared between slots (or a
+        // cyclic document reference) queues nothing the second time
+        {
+            std::lock_guard lock(root->visitedMutex);
+            if (!root->visited.insert(HashId(name)).second) return;
+        }
+
+        auto request = std::make_shared<AsyncRequest>();
+        request->prefetch = std::move(prefetch);
+        request->root = root;
+
+        // taken while the current prefetch still holds its own count, so
+        // the root can't reach the finalize queue before this child runs
+        root->pending++;
+
+        {
+            std::lock_guard lock(m_queueMutex);
+            m_prefetchQueue.push_back(request);
+        }
+        m_queueCondition.notify_one();
+    }
+
+    void ResourceManager::WriteSessionManifest(const std::string& filename) {
+        std::lock_guard lock(m_manifestMutex);
+        if (m_sessionLoads.empty()) return;
+
+        std::string content;
+        for (auto& name : m_sessionLoads) {
+            content += name + "\n";
+        }
+        file::WriteTextFile(filename, content);
+    }
+
+    void ResourceManager::PreloadSessionManifest(const std::string& filename) {
+        std::string content;
+        if (!file::ReadTextFile(filename, content)) return; // no manifest yet
+
+        // one manifest line per recorded file, in last session's first-use
+        // order; skip anything that no longer exists (renamed/removed asset)
+        struct PreloadEntry {
+            std::string name;
+            const uint8_t* packed; // position within the pack mapping, or null
+        };
+        std::vector<PreloadEntry> entries;
+        std::stringstream lines(content);
+        std::string line;
+        while (std::getline(lines, line)) {
+            if (line.empty()) continue;
+            if (!file::Exists(line)) continue;
+
+            size_t size, rawSize;
+            entries.push_back({ line, file::FindPacked(line, size, rawSize) });
+        }
+        if (entries.empty()) return;
+
+        // packed entries sweep the pack front to back (the mapping pointer
+        // orders by pack offset); loose files follow in recorded order
+        std::stable_sort(entries.begin(), entries.end(),
+            [](const PreloadEntry& a, const PreloadEntry& b) {
+                if ((a.packed != nullptr) != (b.packed != nullptr)) return a.packed != nullptr;
+                return a.packed != nullptr && a.packed < b.packed;
+            });
+
+        // streaming priority so a real load requested during the preload
+        // still jumps the queue; the data itself is discarded - the point
+        // is the warm OS cache the first-use Load() will hit
+        for (auto& entry : entries) {
+            file::ReadAsync(entry.name, file::ReadPriority::Streaming,
+                [](bool, std::vector<uint8_t>&) {});
+        }
+
+        LOG_CAT_INFO(Resources, "preloading {} assets from {}", entries.size(), filename);
+    }
+
+    void ResourceManager::StartWorkers(int count) {
+        if (m_workersRunning) return;
+
+        m_workersRunning = true;
+        for (int i = 0; i < count; i++) {
+            m_workers.emplace_back([this]() { WorkerLoop(); });
+        }
+    }
+
+    void ResourceManager::StopWorkers() {
+        if (!m_workersRunning) return;
+
+        m_workersRunning = false;
+        m_queueCondition.notify_all();
+        for (auto& worker : m_workers) {
+            if (worker.joinable()) worker.join();
+        }
+        m_workers.clear();
+    }
+
+    void ResourceManager::WorkerLoop() {
+        while (m_workersRunning) {
+            std::shared_ptr<AsyncRequest> request;
+            {
+                std::unique_lock lock(m_queueMutex);
+                m_queueCondition.wait(lock, [this]() { return !m_prefetchQueue.empty() || !m_workersRunning; });
+                if (!m_workersRunning) break;
+
+                request = m_prefetchQueue.front();
+                m_prefetchQueue.pop_front();
+            }
+
+            // publish the request's tree root so QueueDependency calls made
+            // from inside the prefetch join against it
+            std::shared_ptr<AsyncRequest> root = request->root ? request->root : request;
+            t_workerRoot = root;
+            request->prefetch();
+            t_workerRoot = nullptr;
+
+            // the prefetch completing the dependency tree (usually the only
+            // one) hands the root over to the main-thread finalize queue
+            if (--root->pending == 0) {
+                std::lock_guard lock(m_queueMutex);
+                m_finalizeQueue.push_back(root);
+            }
+        }
+    }
+
+    void ResourceManager::Update(float budgetSeconds) {
+        PROFILE_SCOPE("ResourceManager::Update");
+
+        auto start = std::chrono::steady_clock::now();
+
+        while (true) {
+            std::shared_ptr<AsyncRequest> request;
+            {
+                std::lock_guard lock(m_queueMutex);
+                if (m_finalizeQueue.empty()) break;
+
+                request = m_finalizeQueue.front();
+                m_finalizeQueue.pop_front();
+            }
+
+            request->finalize();
+
+            // spread remaining loads across future frames once over budget
+            std::chrono::duration<float> elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed.count() >= budgetSeconds) break;
+        }
+
+        EnforceBudget();
+    }
+
+    size_t ResourceManager::GetMemoryUsed() const {
+        size_t used = 0;
+        for (auto& shard : m_shards) {
+            auto snapshot = shard.snapshot.load();
+            for (auto& [key, entry] : *snapshot) {
+                used += entry.resource->GetMemorySize();
+            }
+        }
+        return used;
+    }
+
+    void ResourceManager::EnforceBudget() {
+        if (m_budget == 0) return;
+
+        size_t used = GetMemoryUsed();
+        if (used <= m_budget) return;
+
+        // only resources the cache alone keeps alive are evictable - a
+        // use_count above one means a component or system still holds it
+        // (or a reader still has an older snapshot in hand, which makes
+        // the check conservative, never unsafe)
+        struct Candidate {
+            size_t shard;
+            uint64_t key;
+            size_t size;
+            uint64_t lastUsed;
+        };
+        std::vector<Candidate> candidates;
+        for (size_t i = 0; i < kShardCount; i++) {
+            auto snapshot = m_shards[i].snapshot.load();
+            for (auto& [key, entry] : *snapshot) {
+                if (entry.resource.use_count() == 1 && entry.resource->GetMemorySize() > 0) {
+                    candidates.push_back({ i, key, entry.resource->GetMemorySize(), entry.resource->lastUsed });
+                }
+            }
+        }
+
+        // least recently used goes first
+        std::sort(candidates.begin(), candidates.end(),
+            [](const Candidate& a, const Candidate& b) { return a.lastUsed < b.lastUsed; });
+
+        // pick victims until the total fits, then apply the erases with
+        // one copy-and-publish per touched shard
+        std::vector<uint64_t> evicted[kShardCount];
+        for (auto& candidate : candidates) {
+            if (used <= m_budget) break;
+            used -= candidate.size;
+            evicted[candidate.shard].push_back(candidate.key);
+        }
+        for (size_t i = 0; i < kShardCount; i++) {
+            if (evicted[i].empty()) continue;
+
+            Shard& shard = m_shards[i];
+            std::lock_guard lock(shard.mutex);
+            auto next = std::make_shared<map_t>(*shard.snapshot.load());
+            for (uint64_t key : evicted[i]) next->erase(key);
+            shard.snapshot.store(std::move(next));
+        }
+    }
+
+    // Explicit instantiation definitions for the resource types nearly every
+    // translation unit requests by plain name. The matching extern template
+    // declarations at the end of EngineMinimal.h stop those units from
+    // compiling the Get/GetWithID bodies themselves - the templates build
+    // once here instead of once per includer. Specializations with extra
+    // Load arguments (shader stage, audio system, program variant bits) stay
+    // implicit at their few call sites.
+    template res_t<Texture> ResourceManager::Get<Texture>(const std::string&);
+    template res_t<Texture> ResourceManager::GetWithID<Texture>(const std::string&, const std::string&);
+    template res_t<Program> ResourceManager::Get<Program>(const std::string&);
+    template res_t<Program> ResourceManager::GetWithID<Program>(const std::string&, const std::string&);
+    template res_t<Material> ResourceManager::Get<Material>(const std::string&);
+    template res_t<Material> ResourceManager::GetWithID<Material>(const std::string&, const std::string&);
+    template res_t<Model> ResourceManager::Get<Model>(const std::string&);
+    template res_t<Model> ResourceManager::GetWithID<Model>(const std::string&, const std::string&);
+}
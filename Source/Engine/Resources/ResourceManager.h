@@ -2,10 +2,21 @@
 #include "Core/StringHelper.h"
 #include "Core/Singleton.h"
 #include "Core/Logger.h"
+#include "Core/File.h"
+#include "Core/AssetPack.h"
+#include "Core/Json.h"
 #include "Resource.h"
 #include <string>
-#include <map>
-#include <iostream>
+#include <unordered_map>
+#include <unordered_set>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace neu {
     /// <summary>
@@ -18,7 +29,10 @@ namespace neu {
     /// - Memory management: Uses shared_ptr for automatic cleanup
     /// - Case-insensitive keys: Resource IDs are normalized to lowercase
     /// - Flexible loading: Supports forwarding arbitrary arguments to resource constructors
-    /// 
+    /// - Thread safety: lock-free cache-hit lookups against published
+    ///   snapshots, sharded writer locks, and duplicate-load suppression
+    ///   so concurrent requests for one uncached asset load it once
+    ///
     /// The ResourceManager uses the Singleton pattern to provide global access throughout the engine.
     /// </summary>
     class ResourceManager : public Singleton<ResourceManager> {
@@ -28,7 +42,26 @@ namespace neu {
         /// This clears the internal resource cache, which may trigger resource destruction
         /// if no other references exist. Useful for memory cleanup or level transitions.
         /// </summary>
-        void RemoveAll() { m_resources.clear(); }
+        void RemoveAll() {
+            for (auto& shard : m_shards) {
+                std::lock_guard lock(shard.mutex);
+                shard.snapshot.store(std::make_shared<map_t>());
+            }
+            std::lock_guard lock(m_documentMutex);
+            m_documents.clear();
+        }
+
+        /// <summary>
+        /// Returns a shared parsed document for a serialized file, parsing it
+        /// once and handing out the cached parse on repeat requests. The
+        /// cache revalidates against the file's modification time, so edited
+        /// files re-parse while repeat loads (sub-scene streaming, scene
+        /// restarts) reuse the in-memory document. Callers get a const view -
+        /// the document is shared.
+        /// </summary>
+        /// <param name="name">The serialized file name/path</param>
+        /// <returns>Shared pointer to the parsed document, or nullptr if loading failed</returns>
+        std::shared_ptr<const serial::document_t> GetDocument(const std::string& name);
 
         /// <summary>
         /// Retrieves or loads a resource using the filename as both ID and name.
@@ -73,6 +106,101 @@ namespace neu {
             requires std::derived_from<T, Resource>
         bool AddResource(const std::string& name, const res_t<T>& resource);
 
+        /// <summary>
+        /// Requests a resource load without stalling the calling frame.
+        ///
+        /// File I/O is warmed by a worker thread while the actual Load() (which
+        /// may create GL objects) runs on the main thread inside Update() under
+        /// a per-frame time budget. The returned future resolves to the loaded
+        /// resource, or an empty pointer if loading failed. Callers may pass a
+        /// placeholder to use until the future is ready.
+        /// </summary>
+        /// <typeparam name="T">The specific resource type that must inherit from Resource</typeparam>
+        /// <param name="name">The resource name/filename</param>
+        /// <param name="args">Additional arguments forwarded to the resource's Load method</param>
+        /// <returns>Shared future resolving to the loaded resource</returns>
+        template<typename T, typename ... Args>
+            requires std::derived_from<T, Resource>
+        std::shared_future<res_t<T>> GetAsync(const std::string& name, Args&& ... args);
+
+        /// <summary>
+        /// Queues arbitrary split work on the async path: prefetch runs on a
+        /// worker thread, finalize runs on the main thread inside Update()'s
+        /// per-frame budget. Used by systems that stream data through the
+        /// same worker pool as resource loads (e.g. texture mip streaming).
+        /// </summary>
+        /// <param name="prefetch">Work to run on a worker thread (file I/O, decode)</param>
+        /// <param name="finalize">Work to run afterwards on the main thread (GL uploads)</param>
+        void QueueWork(std::function<void()> prefetch, std::function<void()> finalize);
+
+        /// <summary>
+        /// Queues one dependency of the composite resource currently being
+        /// prefetched on this worker thread. The dependency's prefetch runs
+        /// as its own queue item, so a material's program and maps fetch and
+        /// decode concurrently across the pool while the composite's
+        /// finalize waits for the whole tree. Repeat names within one tree
+        /// are skipped, which dedups shared dependencies and terminates
+        /// reference cycles. Called outside a worker prefetch, the work
+        /// just runs inline.
+        /// </summary>
+        /// <param name="name">The dependency's resource name (dedup/cycle key)</param>
+        /// <param name="prefetch">Worker-side prefetch for the dependency</param>
+        void QueueDependency(const std::string& name, std::function<void()> prefetch);
+
+        /// <summary>
+        /// Drains pending async loads on the main thread under a time budget.
+        /// Called once per frame by Engine::Update so GL object creation stays
+        /// on the context thread and load spikes are spread across frames.
+        /// </summary>
+        /// <param name="budgetSeconds">Maximum main-thread time to spend finalizing loads</param>
+        void Update(float budgetSeconds = 0.002f);
+
+        /// <summary>
+        /// Sets the cache memory budget in bytes (0 = unlimited). When the
+        /// accounted total exceeds the budget, Update() evicts resources
+        /// whose only remaining reference is the cache itself, least
+        /// recently used first. Resources still held anywhere else are
+        /// never evicted - shared_ptr semantics make eviction safe.
+        /// </summary>
+        /// <param name="bytes">Budget in bytes, 0 disables eviction</param>
+        void SetBudget(size_t bytes) { m_budget = bytes; }
+        size_t GetBudget() const { return m_budget; }
+
+        /// <summary>
+        /// Sums GetMemorySize over every cached resource.
+        /// </summary>
+        /// <returns>Accounted resident bytes across the cache</returns>
+        size_t GetMemoryUsed() const;
+
+        /// <summary>
+        /// Writes the resources first loaded this session, in first-use
+        /// order, to a manifest file. Called at engine shutdown; the next
+        /// run's PreloadSessionManifest replays it.
+        /// </summary>
+        /// <param name="filename">Manifest file to write</param>
+        void WriteSessionManifest(const std::string& filename = "session.manifest");
+
+        /// <summary>
+        /// Replays a previous session's manifest through the async read
+        /// service: every recorded file is read at streaming priority with
+        /// packed entries sorted by their pack offset, so what the last run
+        /// discovered lazily as scattered first-use reads becomes one
+        /// sequential sweep that warms the OS cache during startup. Actual
+        /// Load() calls still happen at first use - against warm data.
+        /// Quietly does nothing when no manifest exists (first ever run).
+        /// </summary>
+        /// <param name="filename">Manifest file to replay</param>
+        void PreloadSessionManifest(const std::string& filename = "session.manifest");
+
+        /// <summary>
+        /// Starts the worker thread pool used to prefetch file data off-thread.
+        /// </summary>
+        void StartWorkers(int count = 2);
+
+        /// <summary>
+        /// Stops the worker thread pool, joining all worker threads.
+        /// </summary>
+        void StopWorkers();
 
     private:
         /// <summary>
@@ -88,14 +216,162 @@ namespace neu {
 
     private:
         /// <summary>
-        /// Internal cache storing all loaded resources.
-        /// Key: Lowercase resource identifier for case-insensitive lookup
-        /// Value: Shared pointer to base Resource (stored as base type for type erasure)
-        /// 
-        /// Resources are stored as base Resource pointers and dynamically cast to specific
-        /// types when retrieved, allowing heterogeneous storage in a single container.
+        /// Case-insensitive FNV-1a hash of a resource id.
+        /// Hashing lowercases on the fly, so lookups never allocate the
+        /// temporary string that toLower() produced with the old map cache.
+        /// </summary>
+        static uint64_t HashId(const std::string& id) {
+            uint64_t hash = 14695981039346656037ull;
+            for (char c : id) {
+                hash ^= static_cast<uint64_t>(static_cast<uint8_t>(std::tolower(static_cast<unsigned char>(c))));
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        /// <summary>
+        /// Combined cache key: the id hash mixed with the concrete type, so
+        /// one flat sharded table serves every resource type and the same
+        /// path loaded as two types stays two entries.
+        /// </summary>
+        static uint64_t MakeKey(uint64_t idHash, const std::type_info& type) {
+            return idHash ^ static_cast<uint64_t>(type.hash_code()) * 1099511628211ull;
+        }
+
+        /// <summary>
+        /// One cached resource plus its concrete type, recorded so
+        /// GetByType can slice the flat table without RTTI casts.
+        /// </summary>
+        struct CacheEntry {
+            res_t<Resource> resource;
+            const std::type_info* type;
+        };
+        using map_t = std::unordered_map<uint64_t, CacheEntry>;
+
+        // key low bits pick the shard, so must be a power of two
+        static constexpr size_t kShardCount = 16;
+
+        /// <summary>
+        /// One cache shard. The read path is a single atomic load of the
+        /// published snapshot followed by a plain probe of that immutable
+        /// map - no lock, which keeps per-frame cache hits from gameplay
+        /// free of contention with loader threads. Writers (cache misses)
+        /// take the shard mutex, copy the map, mutate the copy and publish
+        /// it; readers mid-probe keep their snapshot alive through the
+        /// shared_ptr. Misses are rare after warmup, so the copy stays off
+        /// the hot path.
+        /// </summary>
+        struct Shard {
+            std::atomic<std::shared_ptr<const map_t>> snapshot{ std::make_shared<map_t>() };
+            std::mutex mutex;
+
+            // in-flight loads keyed like the cache - the first requester
+            // installs a future and loads, later requesters wait on it
+            // instead of loading the same asset again
+            std::unordered_map<uint64_t, std::shared_future<res_t<Resource>>> pending;
+        };
+        Shard m_shards[kShardCount];
+
+        Shard& GetShard(uint64_t key) { return m_shards[key & (kShardCount - 1)]; }
+
+        /// <summary>
+        /// Lock-free cache probe - one atomic snapshot load and a find.
+        /// </summary>
+        res_t<Resource> FindCached(uint64_t key) {
+            auto snapshot = GetShard(key).snapshot.load();
+            auto iter = snapshot->find(key);
+            return iter != snapshot->end() ? iter->second.resource : nullptr;
+        }
+
+        /// <summary>
+        /// Inserts under the shard lock by copy-and-publish. The caller
+        /// must not already hold the shard mutex.
+        /// </summary>
+        void Publish(uint64_t key, const res_t<Resource>& resource, const std::type_info& type) {
+            Shard& shard = GetShard(key);
+            std::lock_guard lock(shard.mutex);
+            auto next = std::make_shared<map_t>(*shard.snapshot.load());
+            (*next)[key] = CacheEntry{ resource, &type };
+            shard.snapshot.store(std::move(next));
+        }
+
+        /// <summary>
+        /// One queued async load: a worker-side prefetch that warms the file
+        /// data off-thread and a main-thread finalize that performs the actual
+        /// Load() and cache insertion.
+        /// </summary>
+        struct AsyncRequest {
+            std::function<void()> prefetch;
+            std::function<void()> finalize;
+
+            // dependency join state - pending counts this request's own
+            // prefetch plus every dependency queued under it, and the
+            // prefetch that drops it to zero hands the root to the finalize
+            // queue. visited keys every name in the tree, so shared
+            // dependencies fetch once and reference cycles terminate
+            std::atomic<int> pending{ 1 };
+            std::shared_ptr<AsyncRequest> root;    // null on root requests
+            std::mutex visitedMutex;
+            std::unordered_set<uint64_t> visited;
+        };
+
+        void WorkerLoop();
+
+        // root of the dependency tree whose prefetch is running on this
+        // worker thread - QueueDependency joins new work against it
+        inline static thread_local std::shared_ptr<AsyncRequest> t_workerRoot;
+
+        // worker pool and queues for async loading
+        std::vector<std::thread> m_workers;
+        std::atomic<bool> m_workersRunning{ false };
+
+        std::mutex m_queueMutex;
+        std::condition_variable m_queueCondition;
+        std::deque<std::shared_ptr<AsyncRequest>> m_prefetchQueue;   // consumed by workers
+        std::deque<std::shared_ptr<AsyncRequest>> m_finalizeQueue;   // consumed by Update()
+
+        /// <summary>
+        /// One cached parse of a serialized file, revalidated by the file's
+        /// modification time on each request.
         /// </summary>
-        std::map<std::string, res_t<Resource>> m_resources;
+        struct CachedDocument {
+            std::shared_ptr<const serial::document_t> document;
+            uint64_t modifiedTime{ 0 };
+        };
+
+        // parsed document cache, keyed by hashed file name; guarded by its
+        // own mutex since workers and the main thread both request documents
+        std::mutex m_documentMutex;
+        std::unordered_map<uint64_t, CachedDocument> m_documents;
+
+        /// <summary>
+        /// Evicts cache-only resources, least recently used first, until the
+        /// accounted total fits the budget. Runs at the end of Update().
+        /// </summary>
+        void EnforceBudget();
+
+        /// <summary>
+        /// Records a cache-miss load for the session manifest, keeping
+        /// first-use order and dropping repeats.
+        /// </summary>
+        void RecordSessionLoad(const std::string& name) {
+            std::lock_guard lock(m_manifestMutex);
+            if (m_sessionSeen.insert(HashId(name)).second) {
+                m_sessionLoads.push_back(name);
+            }
+        }
+
+        // ordered record of the session's first-use loads; guarded because
+        // async finalizes and direct Gets both land here
+        std::mutex m_manifestMutex;
+        std::vector<std::string> m_sessionLoads;
+        std::unordered_set<uint64_t> m_sessionSeen;
+
+        // memory budget (0 = unlimited) and the monotonic stamp that orders
+        // LRU eviction; the stamp is atomic since any thread may touch
+        // cached resources
+        size_t m_budget{ 0 };
+        std::atomic<uint64_t> m_useStamp{ 0 };
     };
 
     /// <summary>
@@ -116,40 +392,95 @@ namespace neu {
     template<typename T, typename ...Args>
         requires std::derived_from<T, Resource>
     inline res_t<T> ResourceManager::GetWithID(const std::string& id, const std::string& name, Args && ...args) {
-        // Normalize the cache key to lowercase for case-insensitive lookup
-        std::string key = toLower(id);
-
-        // Check if resource already exists in cache
-        auto iter = m_resources.find(key);
-        if (iter != m_resources.end()) {
-            // Resource found in cache - attempt to cast to requested type
-            auto base = iter->second;
-            auto resource = std::dynamic_pointer_cast<T>(base);
-
-            // Verify the cast was successful (type safety check)
-            if (resource == nullptr) {
-                LOG_ERROR("Resource type mismatch: {}", key);
-                return res_t<T>();  // Return empty shared_ptr on type mismatch
+        // hash the id in place - no lowercase temporary, no string compares
+        uint64_t key = MakeKey(HashId(id), typeid(T));
+
+        // hot path: lock-free probe of the published snapshot. The
+        // lastUsed stamp is an unsynchronized write by design - it only
+        // orders LRU eviction, and a torn ordering between two
+        // simultaneous touches of one resource is meaningless
+        if (auto cached = FindCached(key)) {
+            cached->lastUsed = ++m_useStamp;
+            return std::static_pointer_cast<T>(cached);
+        }
+
+        if (id == name) {
+            // byte-identical assets cook into one pack blob with aliased
+            // index entries - keying aliased paths by the canonical hash
+            // makes every duplicate path share one cached resource (and
+            // one GPU upload). A loose file shadows its packed entry, so
+            // a shadowed path keeps its own key and loads the edited file;
+            // custom ids (id != name) were chosen deliberately and are
+            // never collapsed
+            uint64_t alias = file::ResolvePackedAlias(name);
+            if (alias && !file::Exists(name)) {
+                key = MakeKey(alias, typeid(T));
+                if (auto cached = FindCached(key)) {
+                    cached->lastUsed = ++m_useStamp;
+                    return std::static_pointer_cast<T>(cached);
+                }
             }
+        }
 
-            // Return the cached resource with correct type
-            return resource;
+        // miss - suppress duplicate loads: the first requester installs a
+        // future under the shard lock and performs the load, later
+        // requesters for the same key wait on that future instead of
+        // loading the asset a second time
+        Shard& shard = GetShard(key);
+        auto promise = std::make_shared<std::promise<res_t<Resource>>>();
+        std::shared_future<res_t<Resource>> inFlight;
+        {
+            std::lock_guard lock(shard.mutex);
+
+            // re-check under the lock - another thread may have published
+            // between the probe and here
+            auto snapshot = shard.snapshot.load();
+            auto iter = snapshot->find(key);
+            if (iter != snapshot->end()) {
+                iter->second.resource->lastUsed = ++m_useStamp;
+                return std::static_pointer_cast<T>(iter->second.resource);
+            }
+
+            auto pending = shard.pending.find(key);
+            if (pending != shard.pending.end()) {
+                inFlight = pending->second;
+            }
+            else {
+                shard.pending.emplace(key, promise->get_future().share());
+            }
+        }
+        if (inFlight.valid()) {
+            return std::static_pointer_cast<T>(inFlight.get());
         }
 
-        // Resource not in cache - create and load new instance
+        // this thread owns the load - outside every lock, so a composite
+        // resource's dependency Gets recurse freely
         res_t<T> resource = std::make_shared<T>();
 
         // Attempt to load the resource with provided arguments
         // Perfect forwarding preserves argument value categories
         if (resource->Load(name, std::forward<Args>(args)...) == false) {
-            LOG_ERROR("Could not load resource: {}", name);
-            return res_t<T>();  // Return empty shared_ptr on load failure
+            LOG_CAT_ERROR(Resources, "Could not load resource: {}", name);
+            resource = res_t<T>();  // waiters see the failure; later Gets retry
+        }
+        else {
+            resource->name = toLower(id);
+            resource->lastUsed = ++m_useStamp;
+            Publish(key, resource, typeid(T));
+
+            // remember the first-use order so the next run can preload
+            // this file before anything asks for it
+            RecordSessionLoad(name);
         }
 
-        // Successfully loaded - add to cache for future use
-        // Store as base Resource pointer for type erasure
-        m_resources[key] = resource;
-        resource->name = key;
+        // resolve waiters after dropping the pending entry - they hold
+        // their own copies of the shared future
+        {
+            std::lock_guard lock(shard.mutex);
+            shard.pending.erase(key);
+        }
+        promise->set_value(resource);
+
         return resource;
     }
 
@@ -157,13 +488,21 @@ namespace neu {
         requires std::derived_from<T, Resource>
     inline std::vector<T*> ResourceManager::GetByType()
     {
+        // editor/browsing and hot-reload use - walks every shard's
+        // snapshot, filtering on the recorded concrete type. Raw pointers
+        // stay valid as long as the cache (or any other holder) keeps the
+        // resources alive, same contract as before
         std::vector<T*> results;
 
-        for (auto& resource : m_resources) {
-            auto result = dynamic_cast<T*>(resource.second.get());
-
-            if (result) {
-                results.push_back(result);
+        for (auto& shard : m_shards) {
+            auto snapshot = shard.snapshot.load();
+            for (auto& [key, entry] : *snapshot) {
+                if constexpr (std::is_same_v<T, Resource>) {
+                    results.push_back(entry.resource.get());
+                }
+                else {
+                    if (*entry.type == typeid(T)) results.push_back(static_cast<T*>(entry.resource.get()));
+                }
             }
         }
 
@@ -174,18 +513,70 @@ namespace neu {
         requires std::derived_from<T, Resource>
     inline bool ResourceManager::AddResource(const std::string& name, const res_t<T>& resource)
     {
-        std::string key = toLower(name);
+        uint64_t key = MakeKey(HashId(name), typeid(T));
 
-        auto iterate = m_resources.find(key);
-        if (iterate != m_resources.end()) {
-            LOG_WARNING("Resource already exists {}", key);
+        if (FindCached(key)) {
+            LOG_CAT_WARNING(Resources, "Resource already exists {}", name);
             return false;
         }
-        resource->name = key;
-        m_resources[key] = resource;
+        resource->name = toLower(name);
+        Publish(key, resource, typeid(T));
         return true;
     }
 
+    /// <summary>
+    /// Template implementation for GetAsync() method.
+    /// Queues a worker-side file prefetch and a main-thread finalize that
+    /// performs the actual Load(), resolving the returned future.
+    /// </summary>
+    template<typename T, typename ... Args>
+        requires std::derived_from<T, Resource>
+    inline std::shared_future<res_t<T>> ResourceManager::GetAsync(const std::string& name, Args&& ... args) {
+        auto promise = std::make_shared<std::promise<res_t<T>>>();
+        auto future = promise->get_future().share();
+
+        // already cached - resolve immediately without touching the queues
+        if (auto cached = FindCached(MakeKey(HashId(name), typeid(T)))) {
+            promise->set_value(std::static_pointer_cast<T>(cached));
+            return future;
+        }
+
+        auto request = std::make_shared<AsyncRequest>();
+
+        // the root's own name seeds the dedup set, so a self-referencing
+        // document terminates instead of queueing itself forever
+        request->visited.insert(HashId(name));
+
+        // worker-side: resource types with a static Prefetch hook move real
+        // work off-thread (e.g. Texture's image decode, Material's
+        // dependency fan-out via QueueDependency); everything else reads
+        // the file once so the OS cache is warm when the main-thread Load()
+        // performs its own read
+        if constexpr (requires(const std::string& file) { T::Prefetch(file); }) {
+            request->prefetch = [name]() { T::Prefetch(name); };
+        }
+        else {
+            request->prefetch = [name]() {
+                std::vector<uint8_t> data;
+                file::ReadBinaryFile(name, data);
+            };
+        }
+
+        // main-thread: the actual load (may create GL objects) + cache insert
+        request->finalize = [this, promise, name, ...args = std::forward<Args>(args)]() mutable {
+            promise->set_value(Get<T>(name, std::forward<Args>(args)...));
+        };
+
+        {
+            std::lock_guard lock(m_queueMutex);
+            m_prefetchQueue.push_back(request);
+        }
+        m_queueCondition.notify_one();
+
+        return future;
+    }
+
+
     /// <summary>
     /// Global convenience function for accessing the ResourceManager singleton.
     /// Provides a shorter, more convenient syntax for resource operations.
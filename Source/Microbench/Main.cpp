@@ -0,0 +1,290 @@
+#include <chrono>
+#include <format>
+
+// Microbenchmark suite for the primitives the frame is built from:
+// resource cache hits and misses, factory creation, event dispatch at
+// varying observer counts, actor cloning and spawning, the scene's typed
+// component query, JSON loading and the math batch kernels.
+//
+// Methodology: every benchmark body runs in a tight loop; one run times
+// the loop and divides by the iteration count, and the reported number is
+// the median of several runs taken after a full warmup run - page faults,
+// cold caches and scheduler noise land outside the measurement or in the
+// discarded tails. Results write to JSON so a saved run serves as the
+// baseline the next run diffs against, and container/cache changes land
+// with numbers attached.
+//
+//   Microbench [--output file] [--baseline file] [--runs N] [--filter text]
+
+namespace {
+    using bench_clock = std::chrono::steady_clock;
+
+    // optimization sink - accumulating results into a volatile keeps the
+    // measured work observable without a fence per iteration
+    volatile uint64_t g_sink = 0;
+
+    // one output row: the median timing for one benchmark
+    struct BenchResult {
+        std::string name;
+        double nsPerOp{ 0 };
+        size_t iterations{ 0 };
+    };
+
+    std::vector<BenchResult> g_results;
+    int g_runs = 5;
+    std::string g_filter;
+
+    // one measurement: run the body for every iteration index, return
+    // nanoseconds per call
+    template <typename F>
+    double MeasureRun(size_t iterations, F& body) {
+        auto start = bench_clock::now();
+        for (size_t i = 0; i < iterations; i++) body(i);
+        return std::chrono::duration<double, std::nano>(bench_clock::now() - start).count() / iterations;
+    }
+
+    // one benchmark: a discarded warmup run, then g_runs measured runs,
+    // reporting the median - the run-to-run spread is logged so a noisy
+    // machine is visible in the output
+    template <typename F>
+    void Bench(const std::string& name, size_t iterations, F body) {
+        if (!g_filter.empty() && name.find(g_filter) == std::string::npos) return;
+
+        MeasureRun(iterations, body);
+
+        std::vector<double> runs((size_t)g_runs);
+        for (auto& run : runs) run = MeasureRun(iterations, body);
+        std::sort(runs.begin(), runs.end());
+
+        double median = runs[runs.size() / 2];
+        g_results.push_back({ name, median, iterations });
+        LOG_INFO("{:<44} {:>10.1f} ns/op  (spread {:.1f} - {:.1f}, {} iters x {} runs)",
+            name, median, runs.front(), runs.back(), iterations, g_runs);
+    }
+
+    // trivial resource so the cache benchmarks exercise the manager's
+    // lookup and construction paths without touching disk, GL or FMOD
+    class BenchResource : public neu::Resource {
+    public:
+        bool Load(const std::string&) { return true; }
+    };
+
+    // counting observer for the dispatch benchmarks
+    class BenchObserver : public neu::IObserver {
+    public:
+        void OnNotify(const neu::Event&) override { g_sink = g_sink + 1; }
+    };
+}
+
+int main(int argc, char* argv[]) {
+    std::string outputName = "microbench.json";
+    std::string baselineName;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--output" && i + 1 < argc) outputName = argv[++i];
+        else if (arg == "--baseline" && i + 1 < argc) baselineName = argv[++i];
+        else if (arg == "--runs" && i + 1 < argc) g_runs = std::atoi(argv[++i]);
+        else if (arg == "--filter" && i + 1 < argc) g_filter = argv[++i];
+    }
+
+    neu::file::SetCurrentDirectory("Assets");
+    if (neu::file::Exists("assets.npak")) neu::file::MountPack("assets.npak");
+
+    // headless boot like the scene benchmark - the primitives under test
+    // assume a live engine (job system, frame arena, factories registered)
+    LOG_INFO("initialize engine (headless)...");
+    neu::GetEngine().Initialize(true);
+    neu::random::seed(0x5EED);
+
+    // RESOURCE MANAGER - cache hit vs miss
+    {
+        auto& resources = neu::Resources();
+
+        // enough unique names for the warmup and every measured run, so
+        // each Get is a genuine miss that constructs and caches an entry
+        size_t missCount = 4096 * ((size_t)g_runs + 1);
+        std::vector<std::string> names;
+        names.reserve(missCount);
+        for (size_t i = 0; i < missCount; i++) names.push_back(std::format("bench/resource_{}", i));
+
+        size_t nextMiss = 0;
+        Bench("ResourceManager::Get miss", 4096, [&](size_t) {
+            g_sink = g_sink + (resources.Get<BenchResource>(names[nextMiss++]) != nullptr);
+        });
+
+        // hits cycle through a resident working set
+        Bench("ResourceManager::Get hit", 8192, [&](size_t i) {
+            g_sink = g_sink + (resources.Get<BenchResource>(names[i & 4095]) != nullptr);
+        });
+    }
+
+    // FACTORY - name lookup vs resolved id
+    {
+        auto& factory = neu::Factory::Instance();
+
+        Bench("Factory::Create by name", 8192, [&](size_t) {
+            g_sink = g_sink + (factory.Create<neu::Actor>("Actor") != nullptr);
+        });
+
+        auto id = factory.GetTypeId("Actor");
+        Bench("Factory::Create by id", 8192, [&](size_t) {
+            g_sink = g_sink + (factory.Create<neu::Actor>(id) != nullptr);
+        });
+    }
+
+    // EVENT MANAGER - immediate dispatch at varying observer counts
+    {
+        auto& events = neu::EventManager::Instance();
+        std::vector<std::unique_ptr<BenchObserver>> observers;
+
+        for (int count : { 1, 16, 256 }) {
+            while ((int)observers.size() < count) {
+                observers.push_back(std::make_unique<BenchObserver>());
+                events.AddObserver(EVENT_ID(bench_event), *observers.back());
+            }
+
+            neu::Event event{ EVENT_ID(bench_event), 1 };
+            Bench(std::format("EventManager::Notify {} observers", count), 8192, [&](size_t) {
+                events.Notify(event);
+            });
+        }
+
+        // the IObserver destructor removes each observer from the manager
+        observers.clear();
+    }
+
+    // ACTOR - prototype clone and scene spawn
+    {
+        auto& factory = neu::Factory::Instance();
+
+        // prototype with a typical lightweight component attached
+        auto prototype = std::make_unique<neu::Actor>();
+        prototype->name = "bench_actor";
+        prototype->AddComponent(factory.Create<neu::RotationComponent>("RotationComponent"));
+        factory.RegisterPrototype("bench_actor", std::move(prototype));
+
+        Bench("Actor clone (prototype Create)", 4096, [&](size_t) {
+            g_sink = g_sink + (factory.Create<neu::Actor>("bench_actor") != nullptr);
+        });
+
+        // spawn clones into a live scene - the scene grows across runs,
+        // which is the realistic case for a spawn-heavy frame
+        auto scene = std::make_unique<neu::Scene>();
+        Bench("Scene::Instantiate", 4096, [&](size_t) {
+            g_sink = g_sink + (scene->Instantiate("bench_actor") != nullptr);
+        });
+
+        // typed component query over everything spawned above - the arena
+        // reset mirrors the per-frame reset the query's storage assumes
+        Bench(std::format("Scene::GetActorComponents ({} spawned)", 4096 * ((size_t)g_runs + 1)), 1024, [&](size_t) {
+            neu::FrameArena::Reset();
+            auto components = scene->GetActorComponents<neu::RotationComponent>();
+            g_sink = g_sink + components.size();
+        });
+
+        scene->Destroyed();
+    }
+
+    // SERIALIZATION - read and parse a small representative document.
+    // After the first touch the OS caches the file, so the number is
+    // parse-dominated - which is the cost scene loads actually pay per
+    // document once the warming sweep has run
+    {
+        const char* document =
+            "{ \"actors\": ["
+            " { \"name\": \"a\", \"transform\": { \"position\": [1, 2, 3], \"scale\": [1, 1, 1] },"
+            "   \"components\": [ { \"type\": \"RotationComponent\" } ] },"
+            " { \"name\": \"b\", \"transform\": { \"position\": [4, 5, 6], \"scale\": [2, 2, 2] },"
+            "   \"components\": [ { \"type\": \"RotationComponent\" } ] }"
+            "] }";
+
+        std::string filename = "microbench_tmp.json";
+        {
+            std::ofstream file(filename);
+            file << document;
+        }
+
+        Bench("serial::Load (small document)", 2048, [&](size_t) {
+            neu::serial::document_t parsed;
+            g_sink = g_sink + neu::serial::Load(filename, parsed);
+        });
+
+        std::filesystem::remove(filename);
+    }
+
+    // MATH BATCH KERNELS - the SoA loops systems feed thousands of points
+    {
+        constexpr size_t kCount = 4096;
+        std::vector<float> ax(kCount), ay(kCount), az(kCount);
+        std::vector<float> bx(kCount), by(kCount), bz(kCount);
+        std::vector<float> out(kCount);
+        for (size_t i = 0; i < kCount; i++) {
+            ax[i] = neu::random::getReal(-100.0f, 100.0f); ay[i] = neu::random::getReal(-100.0f, 100.0f); az[i] = neu::random::getReal(-100.0f, 100.0f);
+            bx[i] = neu::random::getReal(-100.0f, 100.0f); by[i] = neu::random::getReal(-100.0f, 100.0f); bz[i] = neu::random::getReal(-100.0f, 100.0f);
+        }
+
+        neu::math::batch::Soa3 a{ ax.data(), ay.data(), az.data(), kCount };
+        neu::math::batch::Soa3 b{ bx.data(), by.data(), bz.data(), kCount };
+
+        Bench("math::batch::Add 4096", 4096, [&](size_t) {
+            neu::math::batch::Add(ax.data(), bx.data(), out.data(), kCount);
+            g_sink = g_sink + (uint64_t)out[kCount - 1];
+        });
+
+        Bench("math::batch::Dot Soa3 4096", 4096, [&](size_t) {
+            neu::math::batch::Dot(a, b, out.data(), kCount);
+            g_sink = g_sink + (uint64_t)out[kCount - 1];
+        });
+
+        Bench("math::batch::Distance Soa3 4096", 4096, [&](size_t) {
+            neu::math::batch::Distance(a, b, out.data(), kCount);
+            g_sink = g_sink + (uint64_t)out[kCount - 1];
+        });
+    }
+
+    // emit the report - the same shape --baseline reads back
+    {
+        std::ofstream output(outputName);
+        output << "{\n  \"benchmarks\": [\n";
+        for (size_t i = 0; i < g_results.size(); i++) {
+            auto& result = g_results[i];
+            output << std::format(
+                "    {{ \"name\": \"{}\", \"ns_per_op\": {:.2f}, \"iterations\": {} }}{}\n",
+                result.name, result.nsPerOp, result.iterations,
+                (i + 1 < g_results.size()) ? "," : "");
+        }
+        output << "  ]\n}\n";
+    }
+    LOG_INFO("microbench report written to {}", outputName);
+
+    // diff against a saved baseline - the per-benchmark delta is the
+    // number a container or cache change lands with
+    if (!baselineName.empty()) {
+        neu::serial::document_t baseline;
+        if (neu::serial::Load(baselineName, baseline) && baseline.HasMember("benchmarks")) {
+            std::map<std::string, double> reference;
+            for (auto& item : baseline["benchmarks"].GetArray()) {
+                if (item.HasMember("name") && item.HasMember("ns_per_op")) {
+                    reference[item["name"].GetString()] = item["ns_per_op"].GetDouble();
+                }
+            }
+
+            for (auto& result : g_results) {
+                auto it = reference.find(result.name);
+                if (it == reference.end() || it->second <= 0) continue;
+
+                double delta = (result.nsPerOp - it->second) / it->second * 100.0;
+                LOG_INFO("{:<44} {:>+8.1f}% vs baseline ({:.1f} -> {:.1f} ns/op)",
+                    result.name, delta, it->second, result.nsPerOp);
+            }
+        }
+        else {
+            LOG_WARNING("could not read baseline {}", baselineName);
+        }
+    }
+
+    neu::GetEngine().Shutdown();
+
+    return 0;
+}
@@ -0,0 +1 @@
+#include "MicrobenchPCH.h"
@@ -0,0 +1,4 @@
+#pragma once
+
+#include "EngineMinimal.h"
+#include "Engine.h"
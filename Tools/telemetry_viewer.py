@@ -0,0 +1,247 @@
+#!/usr/bin/env python3
+"""Live viewer for the engine's telemetry stream (Core/TelemetryServer).
+
+Connects to one or more running engines, graphs frame time / memory /
+queue depths per machine, and optionally records the raw stream so an
+overnight session can be replayed the next morning:
+
+    telemetry_viewer.py minspec-01 minspec-02:7711 --record soak.ntel
+    telemetry_viewer.py --replay soak.ntel
+
+Graphing uses matplotlib when available; without it the viewer degrades
+to one console line per packet (still usable over ssh, and --record
+works either way).
+"""
+import argparse
+import socket
+import struct
+import sys
+import time
+from collections import deque
+
+MAGIC = 0x4C45544E  # "NTEL"
+VERSION = 1
+DEFAULT_PORT = 7711
+
+HEADER_FMT = "<IHH"
+HEADER_SIZE = struct.calcsize(HEADER_FMT)
+
+MEM_TAGS = ["Core", "Scene", "Renderer", "Resources", "Audio"]
+
+# matches StatsBlock in TelemetryServer.cpp (packed, little-endian)
+STATS_FMT = "<Q" + "f" * 6 + "I" + "I" * 6 + "Q" + "I" * 3 + "Q" + "Q" * 11
+STATS_SIZE = struct.calcsize(STATS_FMT)
+STATS_FIELDS = (
+    ["packet_index", "time_s",
+     "frame_ms", "p50_ms", "p95_ms", "p99_ms", "low1_ms", "hitches",
+     "draw_calls", "triangles", "program_binds", "material_binds",
+     "texture_binds", "state_changes", "upload_bytes",
+     "pending_jobs", "pending_reads", "queued_uploads", "queued_upload_bytes"]
+    + [f"mem_live_{t}" for t in MEM_TAGS]
+    + [f"mem_peak_{t}" for t in MEM_TAGS]
+    + ["mem_total"]
+)
+
+
+def parse_packet(payload, names):
+    """Decodes one packet body (after the header) into a stats dict,
+    updating the connection's hash->scope-name table as names arrive."""
+    stats = dict(zip(STATS_FIELDS, struct.unpack_from(STATS_FMT, payload, 0)))
+    offset = STATS_SIZE
+
+    (scope_count,) = struct.unpack_from("<B", payload, offset)
+    offset += 1
+    scopes = []
+    for _ in range(scope_count):
+        scope_hash, total_us = struct.unpack_from("<II", payload, offset)
+        offset += 8
+        scopes.append((scope_hash, total_us))
+
+    (name_count,) = struct.unpack_from("<B", payload, offset)
+    offset += 1
+    for _ in range(name_count):
+        scope_hash, length = struct.unpack_from("<IB", payload, offset)
+        offset += 5
+        names[scope_hash] = payload[offset:offset + length].decode("utf-8", "replace")
+        offset += length
+
+    stats["scopes"] = [(names.get(h, f"#{h:08x}"), us) for h, us in scopes]
+    return stats
+
+
+class Connection:
+    """One machine's socket, receive buffer and scope-name table."""
+
+    def __init__(self, host, port):
+        self.label = f"{host}:{port}"
+        self.names = {}
+        self.buffer = b""
+        self.sock = socket.create_connection((host, port), timeout=5)
+        self.sock.setblocking(False)
+
+    def poll(self):
+        """Returns every complete packet received since the last poll as
+        (raw_bytes, stats) pairs."""
+        try:
+            while True:
+                chunk = self.sock.recv(65536)
+                if not chunk:
+                    raise ConnectionError("closed")
+                self.buffer += chunk
+        except BlockingIOError:
+            pass
+
+        packets = []
+        while len(self.buffer) >= HEADER_SIZE:
+            magic, version, size = struct.unpack_from(HEADER_FMT, self.buffer, 0)
+            if magic != MAGIC or version != VERSION:
+                raise ConnectionError(f"bad packet (magic {magic:#x} version {version})")
+            if len(self.buffer) < size:
+                break
+            raw = self.buffer[:size]
+            self.buffer = self.buffer[size:]
+            packets.append((raw, parse_packet(raw[HEADER_SIZE:], self.names)))
+        return packets
+
+
+def console_line(label, stats):
+    mem_mb = stats["mem_total"] / (1024 * 1024)
+    top = ", ".join(f"{n} {us / 1000:.2f}ms" for n, us in stats["scopes"][:3])
+    return (f"{label}  frame {stats['frame_ms']:6.2f} ms  p95 {stats['p95_ms']:6.2f}"
+            f"  draws {stats['draw_calls']:5d}  mem {mem_mb:7.1f} MB"
+            f"  jobs {stats['pending_jobs']:3d}  reads {stats['pending_reads']:3d}  | {top}")
+
+
+def run_live(args):
+    connections = []
+    for target in args.hosts:
+        host, _, port = target.partition(":")
+        connections.append(Connection(host, int(port) if port else args.port))
+        print(f"connected to {connections[-1].label}")
+
+    record = open(args.record, "wb") if args.record else None
+    history = {c.label: deque(maxlen=args.history) for c in connections}
+
+    plot = None
+    if not args.no_gui:
+        try:
+            plot = LivePlot([c.label for c in connections])
+        except ImportError:
+            print("matplotlib not available, console output only", file=sys.stderr)
+
+    try:
+        while connections:
+            for connection in list(connections):
+                try:
+                    packets = connection.poll()
+                except (ConnectionError, OSError) as error:
+                    print(f"{connection.label}: {error}", file=sys.stderr)
+                    connections.remove(connection)
+                    continue
+                for raw, stats in packets:
+                    if record:
+                        record.write(struct.pack("<dH", time.time(), len(raw)) + raw)
+                    history[connection.label].append(stats)
+                    if plot is None:
+                        print(console_line(connection.label, stats))
+            if plot:
+                if not plot.draw(history):
+                    break
+            else:
+                time.sleep(0.05)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if record:
+            record.close()
+            print(f"recorded to {args.record}")
+
+
+def run_replay(args):
+    names = {}
+    history = {"replay": deque(maxlen=args.history)}
+    with open(args.replay, "rb") as recording:
+        while True:
+            prefix = recording.read(10)
+            if len(prefix) < 10:
+                break
+            _, size = struct.unpack("<dH", prefix)
+            raw = recording.read(size)
+            stats = parse_packet(raw[HEADER_SIZE:], names)
+            history["replay"].append(stats)
+            if args.no_gui:
+                print(console_line("replay", stats))
+    if not args.no_gui:
+        try:
+            plot = LivePlot(["replay"])
+        except ImportError:
+            for stats in history["replay"]:
+                print(console_line("replay", stats))
+            return
+        plot.draw(history, block=True)
+
+
+class LivePlot:
+    """Frame time, memory and queue depth axes, one line per machine."""
+
+    def __init__(self, labels):
+        import matplotlib.pyplot as plt  # noqa: F401 - raises ImportError cleanly
+        self.plt = plt
+        self.figure, (self.ax_frame, self.ax_mem, self.ax_queues) = plt.subplots(
+            3, 1, sharex=True, figsize=(10, 8))
+        self.figure.canvas.manager.set_window_title("engine telemetry")
+        self.labels = labels
+        plt.ion()
+        plt.show()
+
+    def draw(self, history, block=False):
+        if not self.plt.fignum_exists(self.figure.number):
+            return False
+        for axis, title in ((self.ax_frame, "frame ms (solid) / p95 (dotted)"),
+                            (self.ax_mem, "memory MB"),
+                            (self.ax_queues, "queue depths")):
+            axis.clear()
+            axis.set_title(title, fontsize=9)
+        for label in self.labels:
+            samples = list(history.get(label, ()))
+            if not samples:
+                continue
+            x = [s["time_s"] for s in samples]
+            self.ax_frame.plot(x, [s["frame_ms"] for s in samples], label=label)
+            self.ax_frame.plot(x, [s["p95_ms"] for s in samples], linestyle=":")
+            self.ax_mem.plot(x, [s["mem_total"] / (1024 * 1024) for s in samples], label=label)
+            self.ax_queues.plot(x, [s["pending_jobs"] for s in samples], label=f"{label} jobs")
+            self.ax_queues.plot(x, [s["pending_reads"] for s in samples], label=f"{label} reads")
+            self.ax_queues.plot(x, [s["queued_uploads"] for s in samples], label=f"{label} uploads")
+        self.ax_frame.legend(fontsize=7, loc="upper left")
+        self.ax_queues.legend(fontsize=7, loc="upper left")
+        if block:
+            self.plt.ioff()
+            self.plt.show()
+            return False
+        self.figure.canvas.draw_idle()
+        self.figure.canvas.flush_events()
+        return True
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("hosts", nargs="*", help="machines to watch, host or host:port")
+    parser.add_argument("--port", type=int, default=DEFAULT_PORT, help="default port")
+    parser.add_argument("--record", metavar="FILE", help="append raw packets to FILE")
+    parser.add_argument("--replay", metavar="FILE", help="replay a recorded session")
+    parser.add_argument("--history", type=int, default=1800, help="samples kept per machine")
+    parser.add_argument("--no-gui", action="store_true", help="console output only")
+    args = parser.parse_args()
+
+    if args.replay:
+        run_replay(args)
+    elif args.hosts:
+        run_live(args)
+    else:
+        parser.error("give at least one host, or --replay FILE")
+
+
+if __name__ == "__main__":
+    main()